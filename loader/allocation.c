@@ -106,6 +106,157 @@ void *loader_realloc(const VkAllocationCallbacks *pAllocator, void *pMemory, siz
     return pNewMem;
 }
 
+// The instance arena hands out the allocations made while vkCreateInstance runs which live until vkDestroyInstance (the strings
+// of the layer properties and the dispatch table) from a few large chunks. Callers ask for it with
+// loader_instance_heap_calloc_long_lived, everything else, including temporaries and lists which get reallocated, stays on the
+// heap so the arena never holds memory that is no longer used. Freeing arena memory is a no-op and the chunks are all released
+// together in loader_destroy_instance_arena.
+#define LOADER_ARENA_CHUNK_SIZE (64 * 1024)
+#define LOADER_ARENA_ALIGN(size) (((size) + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1))
+
+// Only cleared by tests, to compare against the memory used without the arena
+TEST_FUNCTION_EXPORT bool loader_instance_arena_enabled = true;
+
+struct loader_arena_chunk {
+    struct loader_arena_chunk *next;
+    size_t size;  // Usable bytes after the header
+    size_t used;
+};
+
+struct loader_instance_arena {
+    struct loader_arena_chunk *chunks;  // Allocations are carved from the first chunk, the rest are full or dedicated
+    bool accepting;
+    // Every chunk sorted by address, so that each free can tell whether it points into the arena with a binary search
+    struct loader_arena_chunk **sorted_chunks;
+    uint32_t sorted_chunk_count;
+    uint32_t sorted_chunk_capacity;
+};
+
+uint8_t *loader_arena_chunk_data(struct loader_arena_chunk *chunk) {
+    return (uint8_t *)chunk + LOADER_ARENA_ALIGN(sizeof(struct loader_arena_chunk));
+}
+
+VkResult loader_create_instance_arena(struct loader_instance *inst) {
+    if (!loader_instance_arena_enabled) {
+        return VK_SUCCESS;
+    }
+    inst->arena = loader_calloc(&inst->alloc_callbacks, sizeof(struct loader_instance_arena), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == inst->arena) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    inst->arena->accepting = true;
+    return VK_SUCCESS;
+}
+
+void loader_close_instance_arena(struct loader_instance *inst) {
+    if (NULL != inst->arena) {
+        inst->arena->accepting = false;
+    }
+}
+
+void loader_destroy_instance_arena(struct loader_instance *inst) {
+    if (NULL == inst->arena) {
+        return;
+    }
+    struct loader_arena_chunk *chunk = inst->arena->chunks;
+    while (NULL != chunk) {
+        struct loader_arena_chunk *next = chunk->next;
+        loader_free(&inst->alloc_callbacks, chunk);
+        chunk = next;
+    }
+    loader_free(&inst->alloc_callbacks, inst->arena->sorted_chunks);
+    loader_free(&inst->alloc_callbacks, inst->arena);
+    inst->arena = NULL;
+}
+
+// Returns the index of the first chunk in sorted_chunks which starts after pMemory
+uint32_t loader_arena_upper_bound(const struct loader_instance_arena *arena, const void *pMemory) {
+    uint32_t low = 0;
+    uint32_t high = arena->sorted_chunk_count;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if ((uintptr_t)arena->sorted_chunks[mid] <= (uintptr_t)pMemory) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// Adds chunk to sorted_chunks, which only fails if the array has to grow and can't
+bool loader_arena_add_sorted_chunk(const struct loader_instance *inst, struct loader_arena_chunk *chunk) {
+    struct loader_instance_arena *arena = inst->arena;
+    if (arena->sorted_chunk_count == arena->sorted_chunk_capacity) {
+        uint32_t new_capacity = 0 == arena->sorted_chunk_capacity ? 16 : arena->sorted_chunk_capacity * 2;
+        size_t entry_size = sizeof(struct loader_arena_chunk *);
+        void *new_sorted_chunks =
+            loader_realloc(&inst->alloc_callbacks, arena->sorted_chunks, arena->sorted_chunk_capacity * entry_size,
+                           new_capacity * entry_size, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == new_sorted_chunks) {
+            return false;
+        }
+        arena->sorted_chunks = new_sorted_chunks;
+        arena->sorted_chunk_capacity = new_capacity;
+    }
+    uint32_t index = loader_arena_upper_bound(arena, chunk);
+    memmove(&arena->sorted_chunks[index + 1], &arena->sorted_chunks[index],
+            (arena->sorted_chunk_count - index) * sizeof(struct loader_arena_chunk *));
+    arena->sorted_chunks[index] = chunk;
+    arena->sorted_chunk_count++;
+    return true;
+}
+
+bool loader_instance_arena_owns(const struct loader_instance *inst, const void *pMemory) {
+    if (NULL == inst || NULL == inst->arena || NULL == pMemory) {
+        return false;
+    }
+    // Only the last chunk starting at or before pMemory can contain it
+    uint32_t index = loader_arena_upper_bound(inst->arena, pMemory);
+    if (0 == index) {
+        return false;
+    }
+    struct loader_arena_chunk *chunk = inst->arena->sorted_chunks[index - 1];
+    const uint8_t *data = loader_arena_chunk_data(chunk);
+    return (const uint8_t *)pMemory >= data && (const uint8_t *)pMemory < data + chunk->size;
+}
+
+// Returns zeroed memory, chunks are zeroed when created and nothing handed out is ever reused
+void *loader_instance_arena_alloc(const struct loader_instance *inst, size_t size) {
+    struct loader_instance_arena *arena = inst->arena;
+    // Zero sized allocations still get a unique address inside the chunk so that freeing them is recognized as a no-op
+    size = LOADER_ARENA_ALIGN(size == 0 ? 1 : size);
+    struct loader_arena_chunk *chunk = arena->chunks;
+    if (NULL != chunk && chunk->size - chunk->used >= size) {
+        void *pMemory = loader_arena_chunk_data(chunk) + chunk->used;
+        chunk->used += size;
+        return pMemory;
+    }
+
+    // Big allocations get a chunk of their own so they don't waste the rest of the current chunk
+    bool dedicated = size > LOADER_ARENA_CHUNK_SIZE / 4;
+    size_t chunk_size = dedicated ? size : LOADER_ARENA_CHUNK_SIZE;
+    chunk = loader_calloc(&inst->alloc_callbacks, LOADER_ARENA_ALIGN(sizeof(struct loader_arena_chunk)) + chunk_size,
+                          VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == chunk) {
+        return NULL;
+    }
+    if (!loader_arena_add_sorted_chunk(inst, chunk)) {
+        loader_free(&inst->alloc_callbacks, chunk);
+        return NULL;
+    }
+    chunk->size = chunk_size;
+    chunk->used = size;
+    if (dedicated && NULL != arena->chunks) {
+        chunk->next = arena->chunks->next;
+        arena->chunks->next = chunk;
+    } else {
+        chunk->next = arena->chunks;
+        arena->chunks = chunk;
+    }
+    return loader_arena_chunk_data(chunk);
+}
+
 void *loader_instance_heap_alloc(const struct loader_instance *inst, size_t size, VkSystemAllocationScope allocation_scope) {
     return loader_alloc(inst ? &inst->alloc_callbacks : NULL, size, allocation_scope);
 }
@@ -114,12 +265,33 @@ void *loader_instance_heap_calloc(const struct loader_instance *inst, size_t siz
     return loader_calloc(inst ? &inst->alloc_callbacks : NULL, size, allocation_scope);
 }
 
+void *loader_instance_heap_calloc_long_lived(const struct loader_instance *inst, size_t size) {
+    if (NULL != inst && NULL != inst->arena && inst->arena->accepting) {
+        return loader_instance_arena_alloc(inst, size);
+    }
+    return loader_calloc(inst ? &inst->alloc_callbacks : NULL, size, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+}
+
 void loader_instance_heap_free(const struct loader_instance *inst, void *pMemory) {
+    if (loader_instance_arena_owns(inst, pMemory)) {
+        return;
+    }
     loader_free(inst ? &inst->alloc_callbacks : NULL, pMemory);
 }
 void *loader_instance_heap_realloc(const struct loader_instance *inst, void *pMemory, size_t orig_size, size_t size,
                                    VkSystemAllocationScope allocation_scope) {
-    return loader_realloc(inst ? &inst->alloc_callbacks : NULL, pMemory, orig_size, size, allocation_scope);
+    if (!loader_instance_arena_owns(inst, pMemory)) {
+        return loader_realloc(inst ? &inst->alloc_callbacks : NULL, pMemory, orig_size, size, allocation_scope);
+    }
+    if (size == 0) {
+        return NULL;
+    }
+    // Long lived allocations aren't expected to be resized, if one is anyway it moves to the heap
+    void *pNewMem = loader_instance_heap_calloc(inst, size, allocation_scope);
+    if (NULL != pNewMem) {
+        memcpy(pNewMem, pMemory, orig_size < size ? orig_size : size);
+    }
+    return pNewMem;
 }
 
 void *loader_device_heap_alloc(const struct loader_device *dev, size_t size, VkSystemAllocationScope allocation_scope) {
@@ -36,6 +36,18 @@ void loader_instance_heap_free(const struct loader_instance *instance, void *pMe
 void *loader_instance_heap_realloc(const struct loader_instance *instance, void *pMemory, size_t orig_size, size_t size,
                                    VkSystemAllocationScope allocation_scope);
 
+// Zeroed instance scoped memory which is only freed when the instance is destroyed and never resized. While vkCreateInstance runs
+// it is carved from the instance arena, afterwards it comes from the heap.
+void *loader_instance_heap_calloc_long_lived(const struct loader_instance *instance, size_t size);
+
+// The instance arena only takes allocations between loader_create_instance_arena and loader_close_instance_arena, memory it
+// handed out stays valid until loader_destroy_instance_arena
+extern TEST_FUNCTION_EXPORT bool loader_instance_arena_enabled;
+VkResult loader_create_instance_arena(struct loader_instance *inst);
+void loader_close_instance_arena(struct loader_instance *inst);
+void loader_destroy_instance_arena(struct loader_instance *inst);
+bool loader_instance_arena_owns(const struct loader_instance *inst, const void *pMemory);
+
 void *loader_device_heap_alloc(const struct loader_device *device, size_t size, VkSystemAllocationScope allocationScope);
 void *loader_device_heap_calloc(const struct loader_device *device, size_t size, VkSystemAllocationScope allocationScope);
 void loader_device_heap_free(const struct loader_device *device, void *pMemory);
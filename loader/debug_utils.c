@@ -58,6 +58,7 @@ VkResult util_CreateDebugUtilsMessenger(struct loader_instance *inst, const VkDe
     new_dbg_function_node->pNext = inst->instance_only_dbg_function_head;
     inst->instance_only_dbg_function_head = new_dbg_function_node;
     inst->current_dbg_function_head = inst->instance_only_dbg_function_head;
+    util_UpdateDebugCallbackMasks(inst);
 
     return VK_SUCCESS;
 }
@@ -67,9 +68,9 @@ VKAPI_ATTR VkResult VKAPI_CALL debug_utils_CreateDebugUtilsMessengerEXT(VkInstan
                                                                         const VkAllocationCallbacks *pAllocator,
                                                                         VkDebugUtilsMessengerEXT *pMessenger) {
     struct loader_instance *inst = loader_get_instance(instance);
-    loader_platform_thread_lock_mutex(&loader_lock);
+    loader_platform_thread_lock_mutex(&inst->debug_callbacks_lock);
     VkResult result = inst->disp->layer_inst_disp.CreateDebugUtilsMessengerEXT(inst->instance, pCreateInfo, pAllocator, pMessenger);
-    loader_platform_thread_unlock_mutex(&loader_lock);
+    loader_platform_thread_unlock_mutex(&inst->debug_callbacks_lock);
     return result;
 }
 
@@ -78,7 +79,11 @@ VkBool32 util_SubmitDebugUtilsMessageEXT(const struct loader_instance *inst, VkD
                                          const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData) {
     VkBool32 bail = false;
 
-    if (NULL != pCallbackData) {
+    // Messages are logged for const instances, but the callbacks still need to be guarded against concurrent changes
+    loader_platform_thread_mutex *debug_callbacks_lock = (loader_platform_thread_mutex *)&inst->debug_callbacks_lock;
+    loader_platform_thread_lock_mutex(debug_callbacks_lock);
+    // Skip walking the list for a message no callback would receive
+    if (NULL != pCallbackData && util_DebugUtilsMessageHasCallbacks(inst, messageSeverity, messageTypes)) {
         VkLayerDbgFunctionNode *pTrav = inst->current_dbg_function_head;
         VkDebugReportObjectTypeEXT object_type = VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT;
         VkDebugReportFlagsEXT object_flags = 0;
@@ -104,10 +109,27 @@ VkBool32 util_SubmitDebugUtilsMessageEXT(const struct loader_instance *inst, VkD
             pTrav = pTrav->pNext;
         }
     }
+    loader_platform_thread_unlock_mutex(debug_callbacks_lock);
 
     return bail;
 }
 
+bool util_DebugUtilsMessageHasCallbacks(const struct loader_instance *inst, VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
+                                        VkDebugUtilsMessageTypeFlagsEXT messageTypes) {
+    VkDebugReportFlagsEXT object_flags = 0;
+    debug_utils_AnnotFlagsToReportFlags(messageSeverity, messageTypes, &object_flags);
+
+    // The masks change whenever a callback is created or destroyed, so they are read under the same lock as the callbacks. The
+    // lock is uncontended unless callbacks are being changed or called, which is far cheaper than formatting the message.
+    loader_platform_thread_mutex *debug_callbacks_lock = (loader_platform_thread_mutex *)&inst->debug_callbacks_lock;
+    loader_platform_thread_lock_mutex(debug_callbacks_lock);
+    // The masks are a union over every callback, so a match here doesn't guarantee one callback accepts both the severity and type
+    bool has_callbacks = ((inst->dbg_messenger_severities & messageSeverity) && (inst->dbg_messenger_types & messageTypes)) ||
+                         0 != (inst->dbg_report_flags & object_flags);
+    loader_platform_thread_unlock_mutex(debug_callbacks_lock);
+    return has_callbacks;
+}
+
 void util_DestroyDebugUtilsMessenger(struct loader_instance *inst, VkDebugUtilsMessengerEXT messenger,
                                      const VkAllocationCallbacks *pAllocator) {
     VkLayerDbgFunctionNode *pTrav = inst->current_dbg_function_head;
@@ -119,6 +141,7 @@ void util_DestroyDebugUtilsMessenger(struct loader_instance *inst, VkDebugUtilsM
             if (inst->current_dbg_function_head == pTrav) inst->current_dbg_function_head = pTrav->pNext;
             if (inst->instance_only_dbg_function_head == pTrav) inst->instance_only_dbg_function_head = pTrav->pNext;
             loader_free_with_instance_fallback(pAllocator, inst, pTrav);
+            util_UpdateDebugCallbackMasks(inst);
             break;
         }
         pPrev = pTrav;
@@ -159,11 +182,11 @@ VKAPI_ATTR void VKAPI_CALL debug_utils_SubmitDebugUtilsMessageEXT(VkInstance ins
 VKAPI_ATTR void VKAPI_CALL debug_utils_DestroyDebugUtilsMessengerEXT(VkInstance instance, VkDebugUtilsMessengerEXT messenger,
                                                                      const VkAllocationCallbacks *pAllocator) {
     struct loader_instance *inst = loader_get_instance(instance);
-    loader_platform_thread_lock_mutex(&loader_lock);
+    loader_platform_thread_lock_mutex(&inst->debug_callbacks_lock);
 
     inst->disp->layer_inst_disp.DestroyDebugUtilsMessengerEXT(inst->instance, messenger, pAllocator);
 
-    loader_platform_thread_unlock_mutex(&loader_lock);
+    loader_platform_thread_unlock_mutex(&inst->debug_callbacks_lock);
 }
 
 // This is the instance chain terminator function for CreateDebugUtilsMessenger
@@ -175,7 +198,10 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDebugUtilsMessengerEXT(VkInstanc
     VkResult res = VK_SUCCESS;
     VkLayerDbgFunctionNode *new_dbg_func_node = NULL;
     uint32_t next_index = 0;
+    bool acquired_index = false;
 
+    // Layers may call down the chain without going through debug_utils_Create*, so the lists are locked here as well
+    loader_platform_thread_lock_mutex(&inst->debug_callbacks_lock);
     uint32_t *pNextIndex = loader_instance_heap_alloc(inst, sizeof(uint32_t), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
     if (NULL == pNextIndex) {
         res = VK_ERROR_OUT_OF_HOST_MEMORY;
@@ -186,25 +212,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDebugUtilsMessengerEXT(VkInstanc
     if (res != VK_SUCCESS) {
         goto out;
     }
+    acquired_index = true;
 
+    // Only ICDs which are already in use get their messenger now, the rest create it in util_ActivateDriverDebugCallbacks
     for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->debug_utils_messenger_list.list == NULL) {
-            res = loader_init_generic_list(inst, (struct loader_generic_list *)&icd_term->debug_utils_messenger_list,
-                                           sizeof(VkDebugUtilsMessengerEXT));
-            if (res != VK_SUCCESS) {
-                goto out;
-            }
-        } else if (icd_term->debug_utils_messenger_list.capacity <= next_index * sizeof(VkDebugUtilsMessengerEXT)) {
-            res = loader_resize_generic_list(inst, (struct loader_generic_list *)&icd_term->debug_utils_messenger_list);
-            if (res != VK_SUCCESS) {
-                goto out;
-            }
-        }
-
-        if (icd_term->dispatch.CreateDebugUtilsMessengerEXT) {
-            res = icd_term->dispatch.CreateDebugUtilsMessengerEXT(icd_term->instance, pCreateInfo, pAllocator,
-                                                                  &icd_term->debug_utils_messenger_list.list[next_index]);
-
+        if (icd_term->debug_callbacks_active) {
+            res = util_CreateDriverDebugUtilsMessenger(inst, icd_term, next_index, pCreateInfo, pAllocator);
             if (res != VK_SUCCESS) {
                 goto out;
             }
@@ -228,6 +241,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDebugUtilsMessengerEXT(VkInstanc
     new_dbg_func_node->pUserData = pCreateInfo->pUserData;
     new_dbg_func_node->pNext = inst->current_dbg_function_head;
     inst->current_dbg_function_head = new_dbg_func_node;
+    util_UpdateDebugCallbackMasks(inst);
     *pNextIndex = next_index;
     *pMessenger = (VkDebugUtilsMessengerEXT)(uintptr_t)pNextIndex;
     new_dbg_func_node->messenger.messenger = *pMessenger;
@@ -236,25 +250,16 @@ out:
 
     // Roll back on errors
     if (VK_SUCCESS != res) {
-        if (pNextIndex) {
+        if (acquired_index) {
             for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term; icd_term = icd_term->next) {
-                if (icd_term->debug_utils_messenger_list.list && icd_term->debug_utils_messenger_list.list[next_index] &&
-                    NULL != icd_term->dispatch.DestroyDebugUtilsMessengerEXT) {
-                    icd_term->dispatch.DestroyDebugUtilsMessengerEXT(
-                        icd_term->instance, icd_term->debug_utils_messenger_list.list[next_index], pAllocator);
-                }
-            }
-        }
-        if (inst->debug_utils_messengers_list.list &&
-            inst->debug_utils_messengers_list.capacity > (*pNextIndex) * sizeof(struct loader_used_object_status)) {
-            inst->debug_utils_messengers_list.list[*pNextIndex].status = VK_FALSE;
-            if (NULL != pAllocator) {
-                inst->debug_utils_messengers_list.list[*pNextIndex].allocation_callbacks = *pAllocator;
+                util_DestroyDriverDebugUtilsMessenger(icd_term, next_index, pAllocator);
             }
+            loader_release_object_from_list(&inst->debug_utils_messengers_list, next_index);
         }
         loader_free_with_instance_fallback(pAllocator, inst, new_dbg_func_node);
         loader_free_with_instance_fallback(pAllocator, inst, pNextIndex);
     }
+    loader_platform_thread_unlock_mutex(&inst->debug_callbacks_lock);
 
     return res;
 }
@@ -269,22 +274,14 @@ VKAPI_ATTR void VKAPI_CALL terminator_DestroyDebugUtilsMessengerEXT(VkInstance i
         return;
     }
 
+    loader_platform_thread_lock_mutex(&inst->debug_callbacks_lock);
     for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term; icd_term = icd_term->next) {
-        if (icd_term->debug_utils_messenger_list.list && icd_term->debug_utils_messenger_list.list[*debug_messenger_index] &&
-            NULL != icd_term->dispatch.DestroyDebugUtilsMessengerEXT) {
-            icd_term->dispatch.DestroyDebugUtilsMessengerEXT(
-                icd_term->instance, icd_term->debug_utils_messenger_list.list[*debug_messenger_index], pAllocator);
-        }
+        util_DestroyDriverDebugUtilsMessenger(icd_term, *debug_messenger_index, pAllocator);
     }
 
     util_DestroyDebugUtilsMessenger(inst, messenger, pAllocator);
-    if (inst->debug_utils_messengers_list.list &&
-        inst->debug_utils_messengers_list.capacity > (*debug_messenger_index) * sizeof(struct loader_used_object_status)) {
-        inst->debug_utils_messengers_list.list[*debug_messenger_index].status = VK_FALSE;
-        if (NULL != pAllocator) {
-            inst->debug_utils_messengers_list.list[*debug_messenger_index].allocation_callbacks = *pAllocator;
-        }
-    }
+    loader_release_object_from_list(&inst->debug_utils_messengers_list, *debug_messenger_index);
+    loader_platform_thread_unlock_mutex(&inst->debug_callbacks_lock);
 
     loader_free_with_instance_fallback(pAllocator, inst, debug_messenger_index);
 }
@@ -294,14 +291,12 @@ VKAPI_ATTR void VKAPI_CALL terminator_SubmitDebugUtilsMessageEXT(VkInstance inst
                                                                  VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
                                                                  VkDebugUtilsMessageTypeFlagsEXT messageTypes,
                                                                  const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData) {
-    loader_platform_thread_lock_mutex(&loader_lock);
+    struct loader_instance *inst = (struct loader_instance *)instance;
     // NOTE: Just make the callback ourselves because there could be one or more ICDs that support this extension
     //       and each one will trigger the callback to the user.  This would result in multiple callback triggers
     //       per message.  Instead, if we get a messaged up to here, then just trigger the message ourselves and
     //       return.  This would still allow the ICDs to trigger their own messages, but won't get any external ones.
-    struct loader_instance *inst = (struct loader_instance *)instance;
     util_SubmitDebugUtilsMessageEXT(inst, messageSeverity, messageTypes, pCallbackData);
-    loader_platform_thread_unlock_mutex(&loader_lock);
 }
 
 // VK_EXT_debug_report related items
@@ -324,6 +319,7 @@ VkResult util_CreateDebugReportCallback(struct loader_instance *inst, const VkDe
     new_dbg_func_node->pNext = inst->instance_only_dbg_function_head;
     inst->instance_only_dbg_function_head = new_dbg_func_node;
     inst->current_dbg_function_head = inst->instance_only_dbg_function_head;
+    util_UpdateDebugCallbackMasks(inst);
 
     return VK_SUCCESS;
 }
@@ -333,9 +329,9 @@ VKAPI_ATTR VkResult VKAPI_CALL debug_utils_CreateDebugReportCallbackEXT(VkInstan
                                                                         const VkAllocationCallbacks *pAllocator,
                                                                         VkDebugReportCallbackEXT *pCallback) {
     struct loader_instance *inst = loader_get_instance(instance);
-    loader_platform_thread_lock_mutex(&loader_lock);
+    loader_platform_thread_lock_mutex(&inst->debug_callbacks_lock);
     VkResult result = inst->disp->layer_inst_disp.CreateDebugReportCallbackEXT(inst->instance, pCreateInfo, pAllocator, pCallback);
-    loader_platform_thread_unlock_mutex(&loader_lock);
+    loader_platform_thread_unlock_mutex(&inst->debug_callbacks_lock);
     return result;
 }
 
@@ -343,13 +339,23 @@ VKAPI_ATTR VkResult VKAPI_CALL debug_utils_CreateDebugReportCallbackEXT(VkInstan
 VkBool32 util_DebugReportMessage(const struct loader_instance *inst, VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType,
                                  uint64_t srcObject, size_t location, int32_t msgCode, const char *pLayerPrefix, const char *pMsg) {
     VkBool32 bail = false;
-    VkLayerDbgFunctionNode *pTrav = inst->current_dbg_function_head;
+    VkLayerDbgFunctionNode *pTrav = NULL;
     VkDebugUtilsMessageSeverityFlagBitsEXT severity;
     VkDebugUtilsMessageTypeFlagsEXT types;
     VkDebugUtilsMessengerCallbackDataEXT callback_data;
     VkDebugUtilsObjectNameInfoEXT object_name;
 
     debug_utils_ReportFlagsToAnnotFlags(msgFlags, false, &severity, &types);
+
+    // The masks are updated under debug_callbacks_lock whenever a callback is created or destroyed
+    loader_platform_thread_mutex *debug_callbacks_lock = (loader_platform_thread_mutex *)&inst->debug_callbacks_lock;
+    loader_platform_thread_lock_mutex(debug_callbacks_lock);
+    // Nothing to do if no callback can receive the message
+    if (0 == (inst->dbg_report_flags & msgFlags) &&
+        (0 == (inst->dbg_messenger_severities & severity) || 0 == (inst->dbg_messenger_types & types))) {
+        loader_platform_thread_unlock_mutex(debug_callbacks_lock);
+        return bail;
+    }
     debug_utils_ReportObjectToAnnotObject(objectType, srcObject, &object_name);
 
     callback_data.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT;
@@ -365,6 +371,7 @@ VkBool32 util_DebugReportMessage(const struct loader_instance *inst, VkFlags msg
     callback_data.objectCount = 1;
     callback_data.pObjects = &object_name;
 
+    pTrav = inst->current_dbg_function_head;
     while (pTrav) {
         if (!pTrav->is_messenger && pTrav->report.msgFlags & msgFlags) {
             if (pTrav->report.pfnMsgCallback(msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix, pMsg,
@@ -380,6 +387,7 @@ VkBool32 util_DebugReportMessage(const struct loader_instance *inst, VkFlags msg
 
         pTrav = pTrav->pNext;
     }
+    loader_platform_thread_unlock_mutex(debug_callbacks_lock);
 
     return bail;
 }
@@ -396,6 +404,7 @@ void util_DestroyDebugReportCallback(struct loader_instance *inst, VkDebugReport
             if (inst->instance_only_dbg_function_head == pTrav) inst->instance_only_dbg_function_head = pTrav->pNext;
             if (inst->current_dbg_function_head == pTrav) inst->current_dbg_function_head = pTrav->pNext;
             loader_free_with_instance_fallback(pAllocator, inst, pTrav);
+            util_UpdateDebugCallbackMasks(inst);
             break;
         }
         pPrev = pTrav;
@@ -427,11 +436,11 @@ VkResult util_CreateDebugReportCallbacks(struct loader_instance *inst, const voi
 VKAPI_ATTR void VKAPI_CALL debug_utils_DestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT callback,
                                                                      const VkAllocationCallbacks *pAllocator) {
     struct loader_instance *inst = loader_get_instance(instance);
-    loader_platform_thread_lock_mutex(&loader_lock);
+    loader_platform_thread_lock_mutex(&inst->debug_callbacks_lock);
 
     inst->disp->layer_inst_disp.DestroyDebugReportCallbackEXT(inst->instance, callback, pAllocator);
 
-    loader_platform_thread_unlock_mutex(&loader_lock);
+    loader_platform_thread_unlock_mutex(&inst->debug_callbacks_lock);
 }
 
 VKAPI_ATTR void VKAPI_CALL debug_utils_DebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags,
@@ -453,7 +462,10 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDebugReportCallbackEXT(VkInstanc
     VkResult res = VK_SUCCESS;
     VkLayerDbgFunctionNode *new_dbg_func_node = NULL;
     uint32_t next_index = 0;
+    bool acquired_index = false;
 
+    // Layers may call down the chain without going through debug_utils_Create*, so the lists are locked here as well
+    loader_platform_thread_lock_mutex(&inst->debug_callbacks_lock);
     uint32_t *pNextIndex = loader_instance_heap_alloc(inst, sizeof(uint32_t), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
     if (NULL == pNextIndex) {
         res = VK_ERROR_OUT_OF_HOST_MEMORY;
@@ -464,25 +476,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDebugReportCallbackEXT(VkInstanc
     if (res != VK_SUCCESS) {
         goto out;
     }
+    acquired_index = true;
 
+    // Only ICDs which are already in use get their callback now, the rest create it in util_ActivateDriverDebugCallbacks
     for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->debug_report_callback_list.list == NULL) {
-            res = loader_init_generic_list(inst, (struct loader_generic_list *)&icd_term->debug_report_callback_list,
-                                           sizeof(VkDebugUtilsMessengerEXT));
-            if (res != VK_SUCCESS) {
-                goto out;
-            }
-        } else if (icd_term->debug_report_callback_list.capacity <= next_index * sizeof(VkDebugReportCallbackEXT)) {
-            res = loader_resize_generic_list(inst, (struct loader_generic_list *)&icd_term->debug_report_callback_list);
-            if (res != VK_SUCCESS) {
-                goto out;
-            }
-        }
-
-        if (icd_term->dispatch.CreateDebugReportCallbackEXT) {
-            res = icd_term->dispatch.CreateDebugReportCallbackEXT(icd_term->instance, pCreateInfo, pAllocator,
-                                                                  &icd_term->debug_report_callback_list.list[next_index]);
-
+        if (icd_term->debug_callbacks_active) {
+            res = util_CreateDriverDebugReportCallback(inst, icd_term, next_index, pCreateInfo, pAllocator);
             if (res != VK_SUCCESS) {
                 goto out;
             }
@@ -506,6 +505,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDebugReportCallbackEXT(VkInstanc
     new_dbg_func_node->pUserData = pCreateInfo->pUserData;
     new_dbg_func_node->pNext = inst->current_dbg_function_head;
     inst->current_dbg_function_head = new_dbg_func_node;
+    util_UpdateDebugCallbackMasks(inst);
     *pNextIndex = next_index;
     *pCallback = (VkDebugReportCallbackEXT)(uintptr_t)pNextIndex;
     new_dbg_func_node->report.msgCallback = *pCallback;
@@ -514,25 +514,16 @@ out:
 
     // Roll back on errors
     if (VK_SUCCESS != res) {
-        if (pNextIndex) {
+        if (acquired_index) {
             for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term; icd_term = icd_term->next) {
-                if (icd_term->debug_report_callback_list.list && icd_term->debug_report_callback_list.list[next_index] &&
-                    NULL != icd_term->dispatch.DestroyDebugReportCallbackEXT) {
-                    icd_term->dispatch.DestroyDebugReportCallbackEXT(
-                        icd_term->instance, icd_term->debug_report_callback_list.list[next_index], pAllocator);
-                }
-            }
-        }
-        if (inst->debug_report_callbacks_list.list &&
-            inst->debug_report_callbacks_list.capacity > (*pNextIndex) * sizeof(struct loader_used_object_status)) {
-            inst->debug_report_callbacks_list.list[*pNextIndex].status = VK_FALSE;
-            if (NULL != pAllocator) {
-                inst->debug_report_callbacks_list.list[*pNextIndex].allocation_callbacks = *pAllocator;
+                util_DestroyDriverDebugReportCallback(icd_term, next_index, pAllocator);
             }
+            loader_release_object_from_list(&inst->debug_report_callbacks_list, next_index);
         }
         loader_free_with_instance_fallback(pAllocator, inst, new_dbg_func_node);
         loader_free_with_instance_fallback(pAllocator, inst, pNextIndex);
     }
+    loader_platform_thread_unlock_mutex(&inst->debug_callbacks_lock);
 
     return res;
 }
@@ -546,22 +537,14 @@ VKAPI_ATTR void VKAPI_CALL terminator_DestroyDebugReportCallbackEXT(VkInstance i
     if (NULL == debug_report_index) {
         return;
     }
+    loader_platform_thread_lock_mutex(&inst->debug_callbacks_lock);
     for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term; icd_term = icd_term->next) {
-        if (icd_term->debug_report_callback_list.list && icd_term->debug_report_callback_list.list[*debug_report_index] &&
-            NULL != icd_term->dispatch.DestroyDebugReportCallbackEXT) {
-            icd_term->dispatch.DestroyDebugReportCallbackEXT(
-                icd_term->instance, icd_term->debug_report_callback_list.list[*debug_report_index], pAllocator);
-        }
+        util_DestroyDriverDebugReportCallback(icd_term, *debug_report_index, pAllocator);
     }
 
     util_DestroyDebugReportCallback(inst, callback, pAllocator);
-    if (inst->debug_report_callbacks_list.list &&
-        inst->debug_report_callbacks_list.capacity > (*debug_report_index) * sizeof(struct loader_used_object_status)) {
-        inst->debug_report_callbacks_list.list[*debug_report_index].status = VK_FALSE;
-        if (NULL != pAllocator) {
-            inst->debug_report_callbacks_list.list[*debug_report_index].allocation_callbacks = *pAllocator;
-        }
-    }
+    loader_release_object_from_list(&inst->debug_report_callbacks_list, *debug_report_index);
+    loader_platform_thread_unlock_mutex(&inst->debug_callbacks_lock);
     loader_free_with_instance_fallback(pAllocator, inst, debug_report_index);
 }
 
@@ -569,15 +552,21 @@ VKAPI_ATTR void VKAPI_CALL terminator_DestroyDebugReportCallbackEXT(VkInstance i
 VKAPI_ATTR void VKAPI_CALL terminator_DebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags,
                                                             VkDebugReportObjectTypeEXT objType, uint64_t object, size_t location,
                                                             int32_t msgCode, const char *pLayerPrefix, const char *pMsg) {
-    const struct loader_icd_term *icd_term;
+    struct loader_icd_term *icd_term;
 
     struct loader_instance *inst = (struct loader_instance *)instance;
 
-    loader_platform_thread_lock_mutex(&loader_lock);
+    loader_platform_thread_lock_mutex(&inst->debug_callbacks_lock);
     for (icd_term = inst->icd_terms; icd_term; icd_term = icd_term->next) {
-        if (icd_term->dispatch.DebugReportMessageEXT != NULL) {
-            icd_term->dispatch.DebugReportMessageEXT(icd_term->instance, flags, objType, object, location, msgCode, pLayerPrefix,
-                                                     pMsg);
+        if (ICD_DISPATCH(icd_term, DebugReportMessageEXT) != NULL) {
+            // The ICD reports the message through its own callbacks, so they have to exist by now
+            if (VK_SUCCESS != util_ActivateDriverDebugCallbacks(icd_term)) {
+                loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                           "terminator_DebugReportMessageEXT: Failed to create the debug callbacks of ICD %s",
+                           icd_term->scanned_icd->lib_name);
+            }
+            ICD_DISPATCH(icd_term, DebugReportMessageEXT)(icd_term->instance, flags, objType, object, location, msgCode,
+                                                          pLayerPrefix, pMsg);
         }
     }
 
@@ -586,7 +575,7 @@ VKAPI_ATTR void VKAPI_CALL terminator_DebugReportMessageEXT(VkInstance instance,
 
     util_DebugReportMessage(inst, flags, objType, object, location, msgCode, pLayerPrefix, pMsg);
 
-    loader_platform_thread_unlock_mutex(&loader_lock);
+    loader_platform_thread_unlock_mutex(&inst->debug_callbacks_lock);
 }
 
 // General utilities
@@ -605,6 +594,132 @@ void destroy_debug_callbacks_chain(struct loader_instance *inst, const VkAllocat
         pTrav = pNext;
     }
     inst->current_dbg_function_head = NULL;
+    util_UpdateDebugCallbackMasks(inst);
+}
+
+void util_UpdateDebugCallbackMasks(struct loader_instance *inst) {
+    inst->dbg_messenger_severities = 0;
+    inst->dbg_messenger_types = 0;
+    inst->dbg_report_flags = 0;
+    for (VkLayerDbgFunctionNode *pTrav = inst->current_dbg_function_head; NULL != pTrav; pTrav = pTrav->pNext) {
+        if (pTrav->is_messenger) {
+            inst->dbg_messenger_severities |= pTrav->messenger.messageSeverity;
+            inst->dbg_messenger_types |= pTrav->messenger.messageType;
+        } else {
+            inst->dbg_report_flags |= pTrav->report.msgFlags;
+        }
+    }
+}
+
+VkResult util_CreateDriverDebugUtilsMessenger(const struct loader_instance *inst, struct loader_icd_term *icd_term, uint32_t index,
+                                              const VkDebugUtilsMessengerCreateInfoEXT *pCreateInfo,
+                                              const VkAllocationCallbacks *pAllocator) {
+    if (NULL == ICD_DISPATCH(icd_term, CreateDebugUtilsMessengerEXT)) {
+        return VK_SUCCESS;
+    }
+    VkResult res = loader_reserve_generic_list_index(inst, (struct loader_generic_list *)&icd_term->debug_utils_messenger_list,
+                                                     sizeof(VkDebugUtilsMessengerEXT), index);
+    if (VK_SUCCESS != res || icd_term->debug_utils_messenger_list.list[index]) {
+        return res;
+    }
+    res = ICD_DISPATCH(icd_term, CreateDebugUtilsMessengerEXT)(icd_term->instance, pCreateInfo, pAllocator,
+                                                               &icd_term->debug_utils_messenger_list.list[index]);
+    if (VK_SUCCESS != res) {
+        icd_term->debug_utils_messenger_list.list[index] = (VkDebugUtilsMessengerEXT)(uintptr_t)NULL;
+    }
+    return res;
+}
+
+void util_DestroyDriverDebugUtilsMessenger(struct loader_icd_term *icd_term, uint32_t index,
+                                           const VkAllocationCallbacks *pAllocator) {
+    if (NULL != icd_term->debug_utils_messenger_list.list &&
+        icd_term->debug_utils_messenger_list.capacity > index * sizeof(VkDebugUtilsMessengerEXT) &&
+        icd_term->debug_utils_messenger_list.list[index] && NULL != ICD_DISPATCH(icd_term, DestroyDebugUtilsMessengerEXT)) {
+        ICD_DISPATCH(icd_term, DestroyDebugUtilsMessengerEXT)(icd_term->instance, icd_term->debug_utils_messenger_list.list[index],
+                                                              pAllocator);
+        icd_term->debug_utils_messenger_list.list[index] = (VkDebugUtilsMessengerEXT)(uintptr_t)NULL;
+    }
+}
+
+VkResult util_CreateDriverDebugReportCallback(const struct loader_instance *inst, struct loader_icd_term *icd_term, uint32_t index,
+                                              const VkDebugReportCallbackCreateInfoEXT *pCreateInfo,
+                                              const VkAllocationCallbacks *pAllocator) {
+    if (NULL == ICD_DISPATCH(icd_term, CreateDebugReportCallbackEXT)) {
+        return VK_SUCCESS;
+    }
+    VkResult res = loader_reserve_generic_list_index(inst, (struct loader_generic_list *)&icd_term->debug_report_callback_list,
+                                                     sizeof(VkDebugReportCallbackEXT), index);
+    if (VK_SUCCESS != res || icd_term->debug_report_callback_list.list[index]) {
+        return res;
+    }
+    res = ICD_DISPATCH(icd_term, CreateDebugReportCallbackEXT)(icd_term->instance, pCreateInfo, pAllocator,
+                                                               &icd_term->debug_report_callback_list.list[index]);
+    if (VK_SUCCESS != res) {
+        icd_term->debug_report_callback_list.list[index] = (VkDebugReportCallbackEXT)(uintptr_t)NULL;
+    }
+    return res;
+}
+
+void util_DestroyDriverDebugReportCallback(struct loader_icd_term *icd_term, uint32_t index,
+                                           const VkAllocationCallbacks *pAllocator) {
+    if (NULL != icd_term->debug_report_callback_list.list &&
+        icd_term->debug_report_callback_list.capacity > index * sizeof(VkDebugReportCallbackEXT) &&
+        icd_term->debug_report_callback_list.list[index] && NULL != ICD_DISPATCH(icd_term, DestroyDebugReportCallbackEXT)) {
+        ICD_DISPATCH(icd_term, DestroyDebugReportCallbackEXT)(icd_term->instance, icd_term->debug_report_callback_list.list[index],
+                                                              pAllocator);
+        icd_term->debug_report_callback_list.list[index] = (VkDebugReportCallbackEXT)(uintptr_t)NULL;
+    }
+}
+
+VkResult util_ActivateDriverDebugCallbacks(struct loader_icd_term *icd_term) {
+    struct loader_instance *inst = (struct loader_instance *)icd_term->this_instance;
+    VkResult res = VK_SUCCESS;
+
+    loader_platform_thread_lock_mutex(&inst->debug_callbacks_lock);
+    if (icd_term->debug_callbacks_active) {
+        goto out;
+    }
+
+    // Recreate every messenger and report callback the application made so far, the instance-only ones at the end of the chain
+    // were already handed to the ICD through vkCreateInstance
+    for (VkLayerDbgFunctionNode *pTrav = inst->current_dbg_function_head;
+         NULL != pTrav && pTrav != inst->instance_only_dbg_function_head; pTrav = pTrav->pNext) {
+        if (pTrav->is_messenger) {
+            uint32_t index = *(uint32_t *)(uintptr_t)pTrav->messenger.messenger;
+            const VkAllocationCallbacks *pAllocator = NULL;
+            if (inst->debug_utils_messengers_list.capacity > index * sizeof(struct loader_used_object_status)) {
+                pAllocator = ignore_null_callback(&inst->debug_utils_messengers_list.list[index].allocation_callbacks);
+            }
+            VkDebugUtilsMessengerCreateInfoEXT create_info = {0};
+            create_info.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
+            create_info.messageSeverity = pTrav->messenger.messageSeverity;
+            create_info.messageType = pTrav->messenger.messageType;
+            create_info.pfnUserCallback = pTrav->messenger.pfnUserCallback;
+            create_info.pUserData = pTrav->pUserData;
+            res = util_CreateDriverDebugUtilsMessenger(inst, icd_term, index, &create_info, pAllocator);
+        } else {
+            uint32_t index = *(uint32_t *)(uintptr_t)pTrav->report.msgCallback;
+            const VkAllocationCallbacks *pAllocator = NULL;
+            if (inst->debug_report_callbacks_list.capacity > index * sizeof(struct loader_used_object_status)) {
+                pAllocator = ignore_null_callback(&inst->debug_report_callbacks_list.list[index].allocation_callbacks);
+            }
+            VkDebugReportCallbackCreateInfoEXT create_info = {0};
+            create_info.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
+            create_info.flags = pTrav->report.msgFlags;
+            create_info.pfnCallback = pTrav->report.pfnMsgCallback;
+            create_info.pUserData = pTrav->pUserData;
+            res = util_CreateDriverDebugReportCallback(inst, icd_term, index, &create_info, pAllocator);
+        }
+        if (VK_SUCCESS != res) {
+            // Whatever was created stays in the ICD lists, a later activation only fills in the missing entries
+            goto out;
+        }
+    }
+    icd_term->debug_callbacks_active = true;
+
+out:
+    loader_platform_thread_unlock_mutex(&inst->debug_callbacks_lock);
+    return res;
 }
 
 VkResult add_debug_extensions_to_ext_list(const struct loader_instance *inst, struct loader_extension_list *ext_list) {
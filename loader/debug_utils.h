@@ -43,6 +43,21 @@ bool debug_utils_AnnotObjectToDebugReportObject(const VkDebugUtilsObjectNameInfo
 
 void destroy_debug_callbacks_chain(struct loader_instance *inst, const VkAllocationCallbacks *pAllocator);
 
+// Recomputes the aggregate callback masks of inst, must be called whenever current_dbg_function_head changes
+void util_UpdateDebugCallbackMasks(struct loader_instance *inst);
+
+// Driver side debug messengers and report callbacks. ICDs only get them once they are in use, util_ActivateDriverDebugCallbacks
+// creates every callback the application already made in icd_term and marks it so later ones are created right away.
+VkResult util_ActivateDriverDebugCallbacks(struct loader_icd_term *icd_term);
+VkResult util_CreateDriverDebugUtilsMessenger(const struct loader_instance *inst, struct loader_icd_term *icd_term, uint32_t index,
+                                              const VkDebugUtilsMessengerCreateInfoEXT *pCreateInfo,
+                                              const VkAllocationCallbacks *pAllocator);
+void util_DestroyDriverDebugUtilsMessenger(struct loader_icd_term *icd_term, uint32_t index, const VkAllocationCallbacks *pAllocator);
+VkResult util_CreateDriverDebugReportCallback(const struct loader_instance *inst, struct loader_icd_term *icd_term, uint32_t index,
+                                              const VkDebugReportCallbackCreateInfoEXT *pCreateInfo,
+                                              const VkAllocationCallbacks *pAllocator);
+void util_DestroyDriverDebugReportCallback(struct loader_icd_term *icd_term, uint32_t index, const VkAllocationCallbacks *pAllocator);
+
 // VK_EXT_debug_utils related items
 
 VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDebugUtilsMessengerEXT(VkInstance instance,
@@ -59,6 +74,10 @@ VkResult util_CreateDebugUtilsMessengers(struct loader_instance *inst, const voi
 VkBool32 util_SubmitDebugUtilsMessageEXT(const struct loader_instance *inst, VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
                                          VkDebugUtilsMessageTypeFlagsEXT messageTypes,
                                          const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData);
+// Returns true if any debug utils messenger or debug report callback of inst would receive a message with the given severity and
+// types, so that callers can skip building messages nobody will see.
+bool util_DebugUtilsMessageHasCallbacks(const struct loader_instance *inst, VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
+                                        VkDebugUtilsMessageTypeFlagsEXT messageTypes);
 
 // VK_EXT_debug_report related items
 
@@ -25,6 +25,7 @@
  */
 
 // clang-format off
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -63,6 +64,13 @@ VKAPI_ATTR bool VKAPI_CALL loader_icd_init_entries(struct loader_instance* inst,
         }                                                                               \
     } while (0)
 
+// Commands the loader doesn't need itself are looked up by ICD_DISPATCH the first time they are used
+#define LAZY_GIPA(func)                                                                 \
+    do {                                                                                \
+        icd_term->dispatch.func = (PFN_vk##func)loader_icd_unresolved_entry;            \
+        icd_term->lazy_dispatch_entry_count++;                                          \
+    } while (0)
+
 
     // ---- Core Vulkan 1.0
     LOOKUP_REQUIRED_GIPA(DestroyInstance);
@@ -80,261 +88,275 @@ VKAPI_ATTR bool VKAPI_CALL loader_icd_init_entries(struct loader_instance* inst,
 
     // ---- Core Vulkan 1.1
     LOOKUP_GIPA(EnumeratePhysicalDeviceGroups);
-    LOOKUP_GIPA(GetPhysicalDeviceFeatures2);
+    LAZY_GIPA(GetPhysicalDeviceFeatures2);
     LOOKUP_GIPA(GetPhysicalDeviceProperties2);
-    LOOKUP_GIPA(GetPhysicalDeviceFormatProperties2);
-    LOOKUP_GIPA(GetPhysicalDeviceImageFormatProperties2);
-    LOOKUP_GIPA(GetPhysicalDeviceQueueFamilyProperties2);
-    LOOKUP_GIPA(GetPhysicalDeviceMemoryProperties2);
-    LOOKUP_GIPA(GetPhysicalDeviceSparseImageFormatProperties2);
-    LOOKUP_GIPA(GetPhysicalDeviceExternalBufferProperties);
-    LOOKUP_GIPA(GetPhysicalDeviceExternalFenceProperties);
-    LOOKUP_GIPA(GetPhysicalDeviceExternalSemaphoreProperties);
+    LAZY_GIPA(GetPhysicalDeviceFormatProperties2);
+    LAZY_GIPA(GetPhysicalDeviceImageFormatProperties2);
+    LAZY_GIPA(GetPhysicalDeviceQueueFamilyProperties2);
+    LAZY_GIPA(GetPhysicalDeviceMemoryProperties2);
+    LAZY_GIPA(GetPhysicalDeviceSparseImageFormatProperties2);
+    LAZY_GIPA(GetPhysicalDeviceExternalBufferProperties);
+    LAZY_GIPA(GetPhysicalDeviceExternalFenceProperties);
+    LAZY_GIPA(GetPhysicalDeviceExternalSemaphoreProperties);
 
     // ---- Core Vulkan 1.3
-    LOOKUP_GIPA(GetPhysicalDeviceToolProperties);
+    LAZY_GIPA(GetPhysicalDeviceToolProperties);
 
     // ---- VK_KHR_surface extension commands
-    LOOKUP_GIPA(DestroySurfaceKHR);
-    LOOKUP_GIPA(GetPhysicalDeviceSurfaceSupportKHR);
-    LOOKUP_GIPA(GetPhysicalDeviceSurfaceCapabilitiesKHR);
-    LOOKUP_GIPA(GetPhysicalDeviceSurfaceFormatsKHR);
-    LOOKUP_GIPA(GetPhysicalDeviceSurfacePresentModesKHR);
+    LAZY_GIPA(DestroySurfaceKHR);
+    LAZY_GIPA(GetPhysicalDeviceSurfaceSupportKHR);
+    LAZY_GIPA(GetPhysicalDeviceSurfaceCapabilitiesKHR);
+    LAZY_GIPA(GetPhysicalDeviceSurfaceFormatsKHR);
+    LAZY_GIPA(GetPhysicalDeviceSurfacePresentModesKHR);
 
     // ---- VK_KHR_swapchain extension commands
-    LOOKUP_GIPA(GetPhysicalDevicePresentRectanglesKHR);
+    LAZY_GIPA(GetPhysicalDevicePresentRectanglesKHR);
 
     // ---- VK_KHR_display extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceDisplayPropertiesKHR);
-    LOOKUP_GIPA(GetPhysicalDeviceDisplayPlanePropertiesKHR);
-    LOOKUP_GIPA(GetDisplayPlaneSupportedDisplaysKHR);
-    LOOKUP_GIPA(GetDisplayModePropertiesKHR);
-    LOOKUP_GIPA(CreateDisplayModeKHR);
-    LOOKUP_GIPA(GetDisplayPlaneCapabilitiesKHR);
-    LOOKUP_GIPA(CreateDisplayPlaneSurfaceKHR);
+    LAZY_GIPA(GetPhysicalDeviceDisplayPropertiesKHR);
+    LAZY_GIPA(GetPhysicalDeviceDisplayPlanePropertiesKHR);
+    LAZY_GIPA(GetDisplayPlaneSupportedDisplaysKHR);
+    LAZY_GIPA(GetDisplayModePropertiesKHR);
+    LAZY_GIPA(CreateDisplayModeKHR);
+    LAZY_GIPA(GetDisplayPlaneCapabilitiesKHR);
+    LAZY_GIPA(CreateDisplayPlaneSurfaceKHR);
 
     // ---- VK_KHR_xlib_surface extension commands
 #if defined(VK_USE_PLATFORM_XLIB_KHR)
-    LOOKUP_GIPA(CreateXlibSurfaceKHR);
+    LAZY_GIPA(CreateXlibSurfaceKHR);
 #endif // VK_USE_PLATFORM_XLIB_KHR
 #if defined(VK_USE_PLATFORM_XLIB_KHR)
-    LOOKUP_GIPA(GetPhysicalDeviceXlibPresentationSupportKHR);
+    LAZY_GIPA(GetPhysicalDeviceXlibPresentationSupportKHR);
 #endif // VK_USE_PLATFORM_XLIB_KHR
 
     // ---- VK_KHR_xcb_surface extension commands
 #if defined(VK_USE_PLATFORM_XCB_KHR)
-    LOOKUP_GIPA(CreateXcbSurfaceKHR);
+    LAZY_GIPA(CreateXcbSurfaceKHR);
 #endif // VK_USE_PLATFORM_XCB_KHR
 #if defined(VK_USE_PLATFORM_XCB_KHR)
-    LOOKUP_GIPA(GetPhysicalDeviceXcbPresentationSupportKHR);
+    LAZY_GIPA(GetPhysicalDeviceXcbPresentationSupportKHR);
 #endif // VK_USE_PLATFORM_XCB_KHR
 
     // ---- VK_KHR_wayland_surface extension commands
 #if defined(VK_USE_PLATFORM_WAYLAND_KHR)
-    LOOKUP_GIPA(CreateWaylandSurfaceKHR);
+    LAZY_GIPA(CreateWaylandSurfaceKHR);
 #endif // VK_USE_PLATFORM_WAYLAND_KHR
 #if defined(VK_USE_PLATFORM_WAYLAND_KHR)
-    LOOKUP_GIPA(GetPhysicalDeviceWaylandPresentationSupportKHR);
+    LAZY_GIPA(GetPhysicalDeviceWaylandPresentationSupportKHR);
 #endif // VK_USE_PLATFORM_WAYLAND_KHR
 
     // ---- VK_KHR_android_surface extension commands
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
-    LOOKUP_GIPA(CreateAndroidSurfaceKHR);
+    LAZY_GIPA(CreateAndroidSurfaceKHR);
 #endif // VK_USE_PLATFORM_ANDROID_KHR
 
     // ---- VK_KHR_win32_surface extension commands
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    LOOKUP_GIPA(CreateWin32SurfaceKHR);
+    LAZY_GIPA(CreateWin32SurfaceKHR);
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    LOOKUP_GIPA(GetPhysicalDeviceWin32PresentationSupportKHR);
+    LAZY_GIPA(GetPhysicalDeviceWin32PresentationSupportKHR);
 #endif // VK_USE_PLATFORM_WIN32_KHR
 
     // ---- VK_KHR_video_queue extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceVideoCapabilitiesKHR);
-    LOOKUP_GIPA(GetPhysicalDeviceVideoFormatPropertiesKHR);
+    LAZY_GIPA(GetPhysicalDeviceVideoCapabilitiesKHR);
+    LAZY_GIPA(GetPhysicalDeviceVideoFormatPropertiesKHR);
 
     // ---- VK_KHR_get_physical_device_properties2 extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceFeatures2KHR);
+    LAZY_GIPA(GetPhysicalDeviceFeatures2KHR);
     LOOKUP_GIPA(GetPhysicalDeviceProperties2KHR);
-    LOOKUP_GIPA(GetPhysicalDeviceFormatProperties2KHR);
-    LOOKUP_GIPA(GetPhysicalDeviceImageFormatProperties2KHR);
-    LOOKUP_GIPA(GetPhysicalDeviceQueueFamilyProperties2KHR);
-    LOOKUP_GIPA(GetPhysicalDeviceMemoryProperties2KHR);
-    LOOKUP_GIPA(GetPhysicalDeviceSparseImageFormatProperties2KHR);
+    LAZY_GIPA(GetPhysicalDeviceFormatProperties2KHR);
+    LAZY_GIPA(GetPhysicalDeviceImageFormatProperties2KHR);
+    LAZY_GIPA(GetPhysicalDeviceQueueFamilyProperties2KHR);
+    LAZY_GIPA(GetPhysicalDeviceMemoryProperties2KHR);
+    LAZY_GIPA(GetPhysicalDeviceSparseImageFormatProperties2KHR);
 
     // ---- VK_KHR_device_group_creation extension commands
     LOOKUP_GIPA(EnumeratePhysicalDeviceGroupsKHR);
 
     // ---- VK_KHR_external_memory_capabilities extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceExternalBufferPropertiesKHR);
+    LAZY_GIPA(GetPhysicalDeviceExternalBufferPropertiesKHR);
 
     // ---- VK_KHR_external_semaphore_capabilities extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceExternalSemaphorePropertiesKHR);
+    LAZY_GIPA(GetPhysicalDeviceExternalSemaphorePropertiesKHR);
 
     // ---- VK_KHR_external_fence_capabilities extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceExternalFencePropertiesKHR);
+    LAZY_GIPA(GetPhysicalDeviceExternalFencePropertiesKHR);
 
     // ---- VK_KHR_performance_query extension commands
-    LOOKUP_GIPA(EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR);
-    LOOKUP_GIPA(GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR);
+    LAZY_GIPA(EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR);
+    LAZY_GIPA(GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR);
 
     // ---- VK_KHR_get_surface_capabilities2 extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceSurfaceCapabilities2KHR);
-    LOOKUP_GIPA(GetPhysicalDeviceSurfaceFormats2KHR);
+    LAZY_GIPA(GetPhysicalDeviceSurfaceCapabilities2KHR);
+    LAZY_GIPA(GetPhysicalDeviceSurfaceFormats2KHR);
 
     // ---- VK_KHR_get_display_properties2 extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceDisplayProperties2KHR);
-    LOOKUP_GIPA(GetPhysicalDeviceDisplayPlaneProperties2KHR);
-    LOOKUP_GIPA(GetDisplayModeProperties2KHR);
-    LOOKUP_GIPA(GetDisplayPlaneCapabilities2KHR);
+    LAZY_GIPA(GetPhysicalDeviceDisplayProperties2KHR);
+    LAZY_GIPA(GetPhysicalDeviceDisplayPlaneProperties2KHR);
+    LAZY_GIPA(GetDisplayModeProperties2KHR);
+    LAZY_GIPA(GetDisplayPlaneCapabilities2KHR);
 
     // ---- VK_KHR_fragment_shading_rate extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceFragmentShadingRatesKHR);
+    LAZY_GIPA(GetPhysicalDeviceFragmentShadingRatesKHR);
 
     // ---- VK_KHR_video_encode_queue extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR);
+    LAZY_GIPA(GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR);
 
     // ---- VK_KHR_cooperative_matrix extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceCooperativeMatrixPropertiesKHR);
+    LAZY_GIPA(GetPhysicalDeviceCooperativeMatrixPropertiesKHR);
 
     // ---- VK_KHR_calibrated_timestamps extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceCalibrateableTimeDomainsKHR);
+    LAZY_GIPA(GetPhysicalDeviceCalibrateableTimeDomainsKHR);
 
     // ---- VK_EXT_debug_report extension commands
-    LOOKUP_GIPA(CreateDebugReportCallbackEXT);
-    LOOKUP_GIPA(DestroyDebugReportCallbackEXT);
-    LOOKUP_GIPA(DebugReportMessageEXT);
+    LAZY_GIPA(CreateDebugReportCallbackEXT);
+    LAZY_GIPA(DestroyDebugReportCallbackEXT);
+    LAZY_GIPA(DebugReportMessageEXT);
 
     // ---- VK_GGP_stream_descriptor_surface extension commands
 #if defined(VK_USE_PLATFORM_GGP)
-    LOOKUP_GIPA(CreateStreamDescriptorSurfaceGGP);
+    LAZY_GIPA(CreateStreamDescriptorSurfaceGGP);
 #endif // VK_USE_PLATFORM_GGP
 
     // ---- VK_NV_external_memory_capabilities extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceExternalImageFormatPropertiesNV);
+    LAZY_GIPA(GetPhysicalDeviceExternalImageFormatPropertiesNV);
 
     // ---- VK_NN_vi_surface extension commands
 #if defined(VK_USE_PLATFORM_VI_NN)
-    LOOKUP_GIPA(CreateViSurfaceNN);
+    LAZY_GIPA(CreateViSurfaceNN);
 #endif // VK_USE_PLATFORM_VI_NN
 
     // ---- VK_EXT_direct_mode_display extension commands
-    LOOKUP_GIPA(ReleaseDisplayEXT);
+    LAZY_GIPA(ReleaseDisplayEXT);
 
     // ---- VK_EXT_acquire_xlib_display extension commands
 #if defined(VK_USE_PLATFORM_XLIB_XRANDR_EXT)
-    LOOKUP_GIPA(AcquireXlibDisplayEXT);
+    LAZY_GIPA(AcquireXlibDisplayEXT);
 #endif // VK_USE_PLATFORM_XLIB_XRANDR_EXT
 #if defined(VK_USE_PLATFORM_XLIB_XRANDR_EXT)
-    LOOKUP_GIPA(GetRandROutputDisplayEXT);
+    LAZY_GIPA(GetRandROutputDisplayEXT);
 #endif // VK_USE_PLATFORM_XLIB_XRANDR_EXT
 
     // ---- VK_EXT_display_surface_counter extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceSurfaceCapabilities2EXT);
+    LAZY_GIPA(GetPhysicalDeviceSurfaceCapabilities2EXT);
 
     // ---- VK_MVK_ios_surface extension commands
 #if defined(VK_USE_PLATFORM_IOS_MVK)
-    LOOKUP_GIPA(CreateIOSSurfaceMVK);
+    LAZY_GIPA(CreateIOSSurfaceMVK);
 #endif // VK_USE_PLATFORM_IOS_MVK
 
     // ---- VK_MVK_macos_surface extension commands
 #if defined(VK_USE_PLATFORM_MACOS_MVK)
-    LOOKUP_GIPA(CreateMacOSSurfaceMVK);
+    LAZY_GIPA(CreateMacOSSurfaceMVK);
 #endif // VK_USE_PLATFORM_MACOS_MVK
 
     // ---- VK_EXT_debug_utils extension commands
-    LOOKUP_GIPA(CreateDebugUtilsMessengerEXT);
-    LOOKUP_GIPA(DestroyDebugUtilsMessengerEXT);
-    LOOKUP_GIPA(SubmitDebugUtilsMessageEXT);
+    LAZY_GIPA(CreateDebugUtilsMessengerEXT);
+    LAZY_GIPA(DestroyDebugUtilsMessengerEXT);
+    LAZY_GIPA(SubmitDebugUtilsMessageEXT);
 
     // ---- VK_EXT_sample_locations extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceMultisamplePropertiesEXT);
+    LAZY_GIPA(GetPhysicalDeviceMultisamplePropertiesEXT);
 
     // ---- VK_EXT_calibrated_timestamps extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceCalibrateableTimeDomainsEXT);
+    LAZY_GIPA(GetPhysicalDeviceCalibrateableTimeDomainsEXT);
 
     // ---- VK_FUCHSIA_imagepipe_surface extension commands
 #if defined(VK_USE_PLATFORM_FUCHSIA)
-    LOOKUP_GIPA(CreateImagePipeSurfaceFUCHSIA);
+    LAZY_GIPA(CreateImagePipeSurfaceFUCHSIA);
 #endif // VK_USE_PLATFORM_FUCHSIA
 
     // ---- VK_EXT_metal_surface extension commands
 #if defined(VK_USE_PLATFORM_METAL_EXT)
-    LOOKUP_GIPA(CreateMetalSurfaceEXT);
+    LAZY_GIPA(CreateMetalSurfaceEXT);
 #endif // VK_USE_PLATFORM_METAL_EXT
 
     // ---- VK_EXT_tooling_info extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceToolPropertiesEXT);
+    LAZY_GIPA(GetPhysicalDeviceToolPropertiesEXT);
 
     // ---- VK_NV_cooperative_matrix extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceCooperativeMatrixPropertiesNV);
+    LAZY_GIPA(GetPhysicalDeviceCooperativeMatrixPropertiesNV);
 
     // ---- VK_NV_coverage_reduction_mode extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV);
+    LAZY_GIPA(GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV);
 
     // ---- VK_EXT_full_screen_exclusive extension commands
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    LOOKUP_GIPA(GetPhysicalDeviceSurfacePresentModes2EXT);
+    LAZY_GIPA(GetPhysicalDeviceSurfacePresentModes2EXT);
 #endif // VK_USE_PLATFORM_WIN32_KHR
 
     // ---- VK_EXT_headless_surface extension commands
-    LOOKUP_GIPA(CreateHeadlessSurfaceEXT);
+    LAZY_GIPA(CreateHeadlessSurfaceEXT);
 
     // ---- VK_EXT_acquire_drm_display extension commands
-    LOOKUP_GIPA(AcquireDrmDisplayEXT);
-    LOOKUP_GIPA(GetDrmDisplayEXT);
+    LAZY_GIPA(AcquireDrmDisplayEXT);
+    LAZY_GIPA(GetDrmDisplayEXT);
 
     // ---- VK_NV_acquire_winrt_display extension commands
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    LOOKUP_GIPA(AcquireWinrtDisplayNV);
+    LAZY_GIPA(AcquireWinrtDisplayNV);
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    LOOKUP_GIPA(GetWinrtDisplayNV);
+    LAZY_GIPA(GetWinrtDisplayNV);
 #endif // VK_USE_PLATFORM_WIN32_KHR
 
     // ---- VK_EXT_directfb_surface extension commands
 #if defined(VK_USE_PLATFORM_DIRECTFB_EXT)
-    LOOKUP_GIPA(CreateDirectFBSurfaceEXT);
+    LAZY_GIPA(CreateDirectFBSurfaceEXT);
 #endif // VK_USE_PLATFORM_DIRECTFB_EXT
 #if defined(VK_USE_PLATFORM_DIRECTFB_EXT)
-    LOOKUP_GIPA(GetPhysicalDeviceDirectFBPresentationSupportEXT);
+    LAZY_GIPA(GetPhysicalDeviceDirectFBPresentationSupportEXT);
 #endif // VK_USE_PLATFORM_DIRECTFB_EXT
 
     // ---- VK_QNX_screen_surface extension commands
 #if defined(VK_USE_PLATFORM_SCREEN_QNX)
-    LOOKUP_GIPA(CreateScreenSurfaceQNX);
+    LAZY_GIPA(CreateScreenSurfaceQNX);
 #endif // VK_USE_PLATFORM_SCREEN_QNX
 #if defined(VK_USE_PLATFORM_SCREEN_QNX)
-    LOOKUP_GIPA(GetPhysicalDeviceScreenPresentationSupportQNX);
+    LAZY_GIPA(GetPhysicalDeviceScreenPresentationSupportQNX);
 #endif // VK_USE_PLATFORM_SCREEN_QNX
 
     // ---- VK_NV_optical_flow extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceOpticalFlowImageFormatsNV);
+    LAZY_GIPA(GetPhysicalDeviceOpticalFlowImageFormatsNV);
 
     // ---- VK_OHOS_surface extension commands
 #if defined(VK_USE_PLATFORM_OHOS)
-    LOOKUP_GIPA(CreateSurfaceOHOS);
+    LAZY_GIPA(CreateSurfaceOHOS);
 #endif // VK_USE_PLATFORM_OHOS
 
     // ---- VK_NV_cooperative_vector extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceCooperativeVectorPropertiesNV);
+    LAZY_GIPA(GetPhysicalDeviceCooperativeVectorPropertiesNV);
 
     // ---- VK_NV_cooperative_matrix2 extension commands
-    LOOKUP_GIPA(GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV);
+    LAZY_GIPA(GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV);
 
+#undef LAZY_GIPA
 #undef LOOKUP_REQUIRED_GIPA
 #undef LOOKUP_GIPA
 
     return true;
 };
 
-// Init Device function pointer dispatch table with core commands
+// Returns whether extension_name is in the list of extensions enabled in pCreateInfo
+static bool loader_device_extension_enabled(const VkDeviceCreateInfo *pCreateInfo, const char *extension_name) {
+    for (uint32_t i = 0; i < pCreateInfo->enabledExtensionCount; i++) {
+        if (!strcmp(pCreateInfo->ppEnabledExtensionNames[i], extension_name)) return true;
+    }
+    return false;
+}
+
+// Init Device function pointer dispatch table with core commands. Only the commands of API versions up to api_version
+// are queried, every other entry points at vkDevExtError.
 VKAPI_ATTR void VKAPI_CALL loader_init_device_dispatch_table(struct loader_dev_dispatch_table *dev_table, PFN_vkGetDeviceProcAddr gpa,
-                                                             VkDevice dev) {
+                                                             VkDevice dev, uint32_t api_version) {
     VkLayerDispatchTable *table = &dev_table->core_dispatch;
     if (table->magic != DEVICE_DISP_TABLE_MAGIC_NUMBER) { abort(); }
     for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) dev_table->ext_dispatch[i] = (PFN_vkDevExt)vkDevExtError;
+    PFN_vkVoidFunction *entries = (PFN_vkVoidFunction *)&table->GetDeviceProcAddr;
+    for (size_t i = 0; i < (sizeof(*table) - offsetof(VkLayerDispatchTable, GetDeviceProcAddr)) / sizeof(PFN_vkVoidFunction); i++) {
+        entries[i] = (PFN_vkVoidFunction)vkDevExtError;
+    }
 
     // ---- Core Vulkan 1.0 commands
     table->GetDeviceProcAddr = gpa;
@@ -460,379 +482,501 @@ VKAPI_ATTR void VKAPI_CALL loader_init_device_dispatch_table(struct loader_dev_d
     table->CmdExecuteCommands = (PFN_vkCmdExecuteCommands)gpa(dev, "vkCmdExecuteCommands");
 
     // ---- Core Vulkan 1.1 commands
-    table->BindBufferMemory2 = (PFN_vkBindBufferMemory2)gpa(dev, "vkBindBufferMemory2");
-    table->BindImageMemory2 = (PFN_vkBindImageMemory2)gpa(dev, "vkBindImageMemory2");
-    table->GetDeviceGroupPeerMemoryFeatures = (PFN_vkGetDeviceGroupPeerMemoryFeatures)gpa(dev, "vkGetDeviceGroupPeerMemoryFeatures");
-    table->CmdSetDeviceMask = (PFN_vkCmdSetDeviceMask)gpa(dev, "vkCmdSetDeviceMask");
-    table->CmdDispatchBase = (PFN_vkCmdDispatchBase)gpa(dev, "vkCmdDispatchBase");
-    table->GetImageMemoryRequirements2 = (PFN_vkGetImageMemoryRequirements2)gpa(dev, "vkGetImageMemoryRequirements2");
-    table->GetBufferMemoryRequirements2 = (PFN_vkGetBufferMemoryRequirements2)gpa(dev, "vkGetBufferMemoryRequirements2");
-    table->GetImageSparseMemoryRequirements2 = (PFN_vkGetImageSparseMemoryRequirements2)gpa(dev, "vkGetImageSparseMemoryRequirements2");
-    table->TrimCommandPool = (PFN_vkTrimCommandPool)gpa(dev, "vkTrimCommandPool");
-    table->GetDeviceQueue2 = (PFN_vkGetDeviceQueue2)gpa(dev, "vkGetDeviceQueue2");
-    table->CreateSamplerYcbcrConversion = (PFN_vkCreateSamplerYcbcrConversion)gpa(dev, "vkCreateSamplerYcbcrConversion");
-    table->DestroySamplerYcbcrConversion = (PFN_vkDestroySamplerYcbcrConversion)gpa(dev, "vkDestroySamplerYcbcrConversion");
-    table->CreateDescriptorUpdateTemplate = (PFN_vkCreateDescriptorUpdateTemplate)gpa(dev, "vkCreateDescriptorUpdateTemplate");
-    table->DestroyDescriptorUpdateTemplate = (PFN_vkDestroyDescriptorUpdateTemplate)gpa(dev, "vkDestroyDescriptorUpdateTemplate");
-    table->UpdateDescriptorSetWithTemplate = (PFN_vkUpdateDescriptorSetWithTemplate)gpa(dev, "vkUpdateDescriptorSetWithTemplate");
-    table->GetDescriptorSetLayoutSupport = (PFN_vkGetDescriptorSetLayoutSupport)gpa(dev, "vkGetDescriptorSetLayoutSupport");
+    if (api_version >= VK_API_VERSION_1_1) {
+        table->BindBufferMemory2 = (PFN_vkBindBufferMemory2)gpa(dev, "vkBindBufferMemory2");
+        table->BindImageMemory2 = (PFN_vkBindImageMemory2)gpa(dev, "vkBindImageMemory2");
+        table->GetDeviceGroupPeerMemoryFeatures = (PFN_vkGetDeviceGroupPeerMemoryFeatures)gpa(dev, "vkGetDeviceGroupPeerMemoryFeatures");
+        table->CmdSetDeviceMask = (PFN_vkCmdSetDeviceMask)gpa(dev, "vkCmdSetDeviceMask");
+        table->CmdDispatchBase = (PFN_vkCmdDispatchBase)gpa(dev, "vkCmdDispatchBase");
+        table->GetImageMemoryRequirements2 = (PFN_vkGetImageMemoryRequirements2)gpa(dev, "vkGetImageMemoryRequirements2");
+        table->GetBufferMemoryRequirements2 = (PFN_vkGetBufferMemoryRequirements2)gpa(dev, "vkGetBufferMemoryRequirements2");
+        table->GetImageSparseMemoryRequirements2 = (PFN_vkGetImageSparseMemoryRequirements2)gpa(dev, "vkGetImageSparseMemoryRequirements2");
+        table->TrimCommandPool = (PFN_vkTrimCommandPool)gpa(dev, "vkTrimCommandPool");
+        table->GetDeviceQueue2 = (PFN_vkGetDeviceQueue2)gpa(dev, "vkGetDeviceQueue2");
+        table->CreateSamplerYcbcrConversion = (PFN_vkCreateSamplerYcbcrConversion)gpa(dev, "vkCreateSamplerYcbcrConversion");
+        table->DestroySamplerYcbcrConversion = (PFN_vkDestroySamplerYcbcrConversion)gpa(dev, "vkDestroySamplerYcbcrConversion");
+        table->CreateDescriptorUpdateTemplate = (PFN_vkCreateDescriptorUpdateTemplate)gpa(dev, "vkCreateDescriptorUpdateTemplate");
+        table->DestroyDescriptorUpdateTemplate = (PFN_vkDestroyDescriptorUpdateTemplate)gpa(dev, "vkDestroyDescriptorUpdateTemplate");
+        table->UpdateDescriptorSetWithTemplate = (PFN_vkUpdateDescriptorSetWithTemplate)gpa(dev, "vkUpdateDescriptorSetWithTemplate");
+        table->GetDescriptorSetLayoutSupport = (PFN_vkGetDescriptorSetLayoutSupport)gpa(dev, "vkGetDescriptorSetLayoutSupport");
+    }
 
     // ---- Core Vulkan 1.2 commands
-    table->CmdDrawIndirectCount = (PFN_vkCmdDrawIndirectCount)gpa(dev, "vkCmdDrawIndirectCount");
-    table->CmdDrawIndexedIndirectCount = (PFN_vkCmdDrawIndexedIndirectCount)gpa(dev, "vkCmdDrawIndexedIndirectCount");
-    table->CreateRenderPass2 = (PFN_vkCreateRenderPass2)gpa(dev, "vkCreateRenderPass2");
-    table->CmdBeginRenderPass2 = (PFN_vkCmdBeginRenderPass2)gpa(dev, "vkCmdBeginRenderPass2");
-    table->CmdNextSubpass2 = (PFN_vkCmdNextSubpass2)gpa(dev, "vkCmdNextSubpass2");
-    table->CmdEndRenderPass2 = (PFN_vkCmdEndRenderPass2)gpa(dev, "vkCmdEndRenderPass2");
-    table->ResetQueryPool = (PFN_vkResetQueryPool)gpa(dev, "vkResetQueryPool");
-    table->GetSemaphoreCounterValue = (PFN_vkGetSemaphoreCounterValue)gpa(dev, "vkGetSemaphoreCounterValue");
-    table->WaitSemaphores = (PFN_vkWaitSemaphores)gpa(dev, "vkWaitSemaphores");
-    table->SignalSemaphore = (PFN_vkSignalSemaphore)gpa(dev, "vkSignalSemaphore");
-    table->GetBufferDeviceAddress = (PFN_vkGetBufferDeviceAddress)gpa(dev, "vkGetBufferDeviceAddress");
-    table->GetBufferOpaqueCaptureAddress = (PFN_vkGetBufferOpaqueCaptureAddress)gpa(dev, "vkGetBufferOpaqueCaptureAddress");
-    table->GetDeviceMemoryOpaqueCaptureAddress = (PFN_vkGetDeviceMemoryOpaqueCaptureAddress)gpa(dev, "vkGetDeviceMemoryOpaqueCaptureAddress");
+    if (api_version >= VK_API_VERSION_1_2) {
+        table->CmdDrawIndirectCount = (PFN_vkCmdDrawIndirectCount)gpa(dev, "vkCmdDrawIndirectCount");
+        table->CmdDrawIndexedIndirectCount = (PFN_vkCmdDrawIndexedIndirectCount)gpa(dev, "vkCmdDrawIndexedIndirectCount");
+        table->CreateRenderPass2 = (PFN_vkCreateRenderPass2)gpa(dev, "vkCreateRenderPass2");
+        table->CmdBeginRenderPass2 = (PFN_vkCmdBeginRenderPass2)gpa(dev, "vkCmdBeginRenderPass2");
+        table->CmdNextSubpass2 = (PFN_vkCmdNextSubpass2)gpa(dev, "vkCmdNextSubpass2");
+        table->CmdEndRenderPass2 = (PFN_vkCmdEndRenderPass2)gpa(dev, "vkCmdEndRenderPass2");
+        table->ResetQueryPool = (PFN_vkResetQueryPool)gpa(dev, "vkResetQueryPool");
+        table->GetSemaphoreCounterValue = (PFN_vkGetSemaphoreCounterValue)gpa(dev, "vkGetSemaphoreCounterValue");
+        table->WaitSemaphores = (PFN_vkWaitSemaphores)gpa(dev, "vkWaitSemaphores");
+        table->SignalSemaphore = (PFN_vkSignalSemaphore)gpa(dev, "vkSignalSemaphore");
+        table->GetBufferDeviceAddress = (PFN_vkGetBufferDeviceAddress)gpa(dev, "vkGetBufferDeviceAddress");
+        table->GetBufferOpaqueCaptureAddress = (PFN_vkGetBufferOpaqueCaptureAddress)gpa(dev, "vkGetBufferOpaqueCaptureAddress");
+        table->GetDeviceMemoryOpaqueCaptureAddress = (PFN_vkGetDeviceMemoryOpaqueCaptureAddress)gpa(dev, "vkGetDeviceMemoryOpaqueCaptureAddress");
+    }
 
     // ---- Core Vulkan 1.3 commands
-    table->CreatePrivateDataSlot = (PFN_vkCreatePrivateDataSlot)gpa(dev, "vkCreatePrivateDataSlot");
-    table->DestroyPrivateDataSlot = (PFN_vkDestroyPrivateDataSlot)gpa(dev, "vkDestroyPrivateDataSlot");
-    table->SetPrivateData = (PFN_vkSetPrivateData)gpa(dev, "vkSetPrivateData");
-    table->GetPrivateData = (PFN_vkGetPrivateData)gpa(dev, "vkGetPrivateData");
-    table->CmdSetEvent2 = (PFN_vkCmdSetEvent2)gpa(dev, "vkCmdSetEvent2");
-    table->CmdResetEvent2 = (PFN_vkCmdResetEvent2)gpa(dev, "vkCmdResetEvent2");
-    table->CmdWaitEvents2 = (PFN_vkCmdWaitEvents2)gpa(dev, "vkCmdWaitEvents2");
-    table->CmdPipelineBarrier2 = (PFN_vkCmdPipelineBarrier2)gpa(dev, "vkCmdPipelineBarrier2");
-    table->CmdWriteTimestamp2 = (PFN_vkCmdWriteTimestamp2)gpa(dev, "vkCmdWriteTimestamp2");
-    table->QueueSubmit2 = (PFN_vkQueueSubmit2)gpa(dev, "vkQueueSubmit2");
-    table->CmdCopyBuffer2 = (PFN_vkCmdCopyBuffer2)gpa(dev, "vkCmdCopyBuffer2");
-    table->CmdCopyImage2 = (PFN_vkCmdCopyImage2)gpa(dev, "vkCmdCopyImage2");
-    table->CmdCopyBufferToImage2 = (PFN_vkCmdCopyBufferToImage2)gpa(dev, "vkCmdCopyBufferToImage2");
-    table->CmdCopyImageToBuffer2 = (PFN_vkCmdCopyImageToBuffer2)gpa(dev, "vkCmdCopyImageToBuffer2");
-    table->CmdBlitImage2 = (PFN_vkCmdBlitImage2)gpa(dev, "vkCmdBlitImage2");
-    table->CmdResolveImage2 = (PFN_vkCmdResolveImage2)gpa(dev, "vkCmdResolveImage2");
-    table->CmdBeginRendering = (PFN_vkCmdBeginRendering)gpa(dev, "vkCmdBeginRendering");
-    table->CmdEndRendering = (PFN_vkCmdEndRendering)gpa(dev, "vkCmdEndRendering");
-    table->CmdSetCullMode = (PFN_vkCmdSetCullMode)gpa(dev, "vkCmdSetCullMode");
-    table->CmdSetFrontFace = (PFN_vkCmdSetFrontFace)gpa(dev, "vkCmdSetFrontFace");
-    table->CmdSetPrimitiveTopology = (PFN_vkCmdSetPrimitiveTopology)gpa(dev, "vkCmdSetPrimitiveTopology");
-    table->CmdSetViewportWithCount = (PFN_vkCmdSetViewportWithCount)gpa(dev, "vkCmdSetViewportWithCount");
-    table->CmdSetScissorWithCount = (PFN_vkCmdSetScissorWithCount)gpa(dev, "vkCmdSetScissorWithCount");
-    table->CmdBindVertexBuffers2 = (PFN_vkCmdBindVertexBuffers2)gpa(dev, "vkCmdBindVertexBuffers2");
-    table->CmdSetDepthTestEnable = (PFN_vkCmdSetDepthTestEnable)gpa(dev, "vkCmdSetDepthTestEnable");
-    table->CmdSetDepthWriteEnable = (PFN_vkCmdSetDepthWriteEnable)gpa(dev, "vkCmdSetDepthWriteEnable");
-    table->CmdSetDepthCompareOp = (PFN_vkCmdSetDepthCompareOp)gpa(dev, "vkCmdSetDepthCompareOp");
-    table->CmdSetDepthBoundsTestEnable = (PFN_vkCmdSetDepthBoundsTestEnable)gpa(dev, "vkCmdSetDepthBoundsTestEnable");
-    table->CmdSetStencilTestEnable = (PFN_vkCmdSetStencilTestEnable)gpa(dev, "vkCmdSetStencilTestEnable");
-    table->CmdSetStencilOp = (PFN_vkCmdSetStencilOp)gpa(dev, "vkCmdSetStencilOp");
-    table->CmdSetRasterizerDiscardEnable = (PFN_vkCmdSetRasterizerDiscardEnable)gpa(dev, "vkCmdSetRasterizerDiscardEnable");
-    table->CmdSetDepthBiasEnable = (PFN_vkCmdSetDepthBiasEnable)gpa(dev, "vkCmdSetDepthBiasEnable");
-    table->CmdSetPrimitiveRestartEnable = (PFN_vkCmdSetPrimitiveRestartEnable)gpa(dev, "vkCmdSetPrimitiveRestartEnable");
-    table->GetDeviceBufferMemoryRequirements = (PFN_vkGetDeviceBufferMemoryRequirements)gpa(dev, "vkGetDeviceBufferMemoryRequirements");
-    table->GetDeviceImageMemoryRequirements = (PFN_vkGetDeviceImageMemoryRequirements)gpa(dev, "vkGetDeviceImageMemoryRequirements");
-    table->GetDeviceImageSparseMemoryRequirements = (PFN_vkGetDeviceImageSparseMemoryRequirements)gpa(dev, "vkGetDeviceImageSparseMemoryRequirements");
+    if (api_version >= VK_API_VERSION_1_3) {
+        table->CreatePrivateDataSlot = (PFN_vkCreatePrivateDataSlot)gpa(dev, "vkCreatePrivateDataSlot");
+        table->DestroyPrivateDataSlot = (PFN_vkDestroyPrivateDataSlot)gpa(dev, "vkDestroyPrivateDataSlot");
+        table->SetPrivateData = (PFN_vkSetPrivateData)gpa(dev, "vkSetPrivateData");
+        table->GetPrivateData = (PFN_vkGetPrivateData)gpa(dev, "vkGetPrivateData");
+        table->CmdSetEvent2 = (PFN_vkCmdSetEvent2)gpa(dev, "vkCmdSetEvent2");
+        table->CmdResetEvent2 = (PFN_vkCmdResetEvent2)gpa(dev, "vkCmdResetEvent2");
+        table->CmdWaitEvents2 = (PFN_vkCmdWaitEvents2)gpa(dev, "vkCmdWaitEvents2");
+        table->CmdPipelineBarrier2 = (PFN_vkCmdPipelineBarrier2)gpa(dev, "vkCmdPipelineBarrier2");
+        table->CmdWriteTimestamp2 = (PFN_vkCmdWriteTimestamp2)gpa(dev, "vkCmdWriteTimestamp2");
+        table->QueueSubmit2 = (PFN_vkQueueSubmit2)gpa(dev, "vkQueueSubmit2");
+        table->CmdCopyBuffer2 = (PFN_vkCmdCopyBuffer2)gpa(dev, "vkCmdCopyBuffer2");
+        table->CmdCopyImage2 = (PFN_vkCmdCopyImage2)gpa(dev, "vkCmdCopyImage2");
+        table->CmdCopyBufferToImage2 = (PFN_vkCmdCopyBufferToImage2)gpa(dev, "vkCmdCopyBufferToImage2");
+        table->CmdCopyImageToBuffer2 = (PFN_vkCmdCopyImageToBuffer2)gpa(dev, "vkCmdCopyImageToBuffer2");
+        table->CmdBlitImage2 = (PFN_vkCmdBlitImage2)gpa(dev, "vkCmdBlitImage2");
+        table->CmdResolveImage2 = (PFN_vkCmdResolveImage2)gpa(dev, "vkCmdResolveImage2");
+        table->CmdBeginRendering = (PFN_vkCmdBeginRendering)gpa(dev, "vkCmdBeginRendering");
+        table->CmdEndRendering = (PFN_vkCmdEndRendering)gpa(dev, "vkCmdEndRendering");
+        table->CmdSetCullMode = (PFN_vkCmdSetCullMode)gpa(dev, "vkCmdSetCullMode");
+        table->CmdSetFrontFace = (PFN_vkCmdSetFrontFace)gpa(dev, "vkCmdSetFrontFace");
+        table->CmdSetPrimitiveTopology = (PFN_vkCmdSetPrimitiveTopology)gpa(dev, "vkCmdSetPrimitiveTopology");
+        table->CmdSetViewportWithCount = (PFN_vkCmdSetViewportWithCount)gpa(dev, "vkCmdSetViewportWithCount");
+        table->CmdSetScissorWithCount = (PFN_vkCmdSetScissorWithCount)gpa(dev, "vkCmdSetScissorWithCount");
+        table->CmdBindVertexBuffers2 = (PFN_vkCmdBindVertexBuffers2)gpa(dev, "vkCmdBindVertexBuffers2");
+        table->CmdSetDepthTestEnable = (PFN_vkCmdSetDepthTestEnable)gpa(dev, "vkCmdSetDepthTestEnable");
+        table->CmdSetDepthWriteEnable = (PFN_vkCmdSetDepthWriteEnable)gpa(dev, "vkCmdSetDepthWriteEnable");
+        table->CmdSetDepthCompareOp = (PFN_vkCmdSetDepthCompareOp)gpa(dev, "vkCmdSetDepthCompareOp");
+        table->CmdSetDepthBoundsTestEnable = (PFN_vkCmdSetDepthBoundsTestEnable)gpa(dev, "vkCmdSetDepthBoundsTestEnable");
+        table->CmdSetStencilTestEnable = (PFN_vkCmdSetStencilTestEnable)gpa(dev, "vkCmdSetStencilTestEnable");
+        table->CmdSetStencilOp = (PFN_vkCmdSetStencilOp)gpa(dev, "vkCmdSetStencilOp");
+        table->CmdSetRasterizerDiscardEnable = (PFN_vkCmdSetRasterizerDiscardEnable)gpa(dev, "vkCmdSetRasterizerDiscardEnable");
+        table->CmdSetDepthBiasEnable = (PFN_vkCmdSetDepthBiasEnable)gpa(dev, "vkCmdSetDepthBiasEnable");
+        table->CmdSetPrimitiveRestartEnable = (PFN_vkCmdSetPrimitiveRestartEnable)gpa(dev, "vkCmdSetPrimitiveRestartEnable");
+        table->GetDeviceBufferMemoryRequirements = (PFN_vkGetDeviceBufferMemoryRequirements)gpa(dev, "vkGetDeviceBufferMemoryRequirements");
+        table->GetDeviceImageMemoryRequirements = (PFN_vkGetDeviceImageMemoryRequirements)gpa(dev, "vkGetDeviceImageMemoryRequirements");
+        table->GetDeviceImageSparseMemoryRequirements = (PFN_vkGetDeviceImageSparseMemoryRequirements)gpa(dev, "vkGetDeviceImageSparseMemoryRequirements");
+    }
 
     // ---- Core Vulkan 1.4 commands
-    table->CmdSetLineStipple = (PFN_vkCmdSetLineStipple)gpa(dev, "vkCmdSetLineStipple");
-    table->MapMemory2 = (PFN_vkMapMemory2)gpa(dev, "vkMapMemory2");
-    table->UnmapMemory2 = (PFN_vkUnmapMemory2)gpa(dev, "vkUnmapMemory2");
-    table->CmdBindIndexBuffer2 = (PFN_vkCmdBindIndexBuffer2)gpa(dev, "vkCmdBindIndexBuffer2");
-    table->GetRenderingAreaGranularity = (PFN_vkGetRenderingAreaGranularity)gpa(dev, "vkGetRenderingAreaGranularity");
-    table->GetDeviceImageSubresourceLayout = (PFN_vkGetDeviceImageSubresourceLayout)gpa(dev, "vkGetDeviceImageSubresourceLayout");
-    table->GetImageSubresourceLayout2 = (PFN_vkGetImageSubresourceLayout2)gpa(dev, "vkGetImageSubresourceLayout2");
-    table->CmdPushDescriptorSet = (PFN_vkCmdPushDescriptorSet)gpa(dev, "vkCmdPushDescriptorSet");
-    table->CmdPushDescriptorSetWithTemplate = (PFN_vkCmdPushDescriptorSetWithTemplate)gpa(dev, "vkCmdPushDescriptorSetWithTemplate");
-    table->CmdSetRenderingAttachmentLocations = (PFN_vkCmdSetRenderingAttachmentLocations)gpa(dev, "vkCmdSetRenderingAttachmentLocations");
-    table->CmdSetRenderingInputAttachmentIndices = (PFN_vkCmdSetRenderingInputAttachmentIndices)gpa(dev, "vkCmdSetRenderingInputAttachmentIndices");
-    table->CmdBindDescriptorSets2 = (PFN_vkCmdBindDescriptorSets2)gpa(dev, "vkCmdBindDescriptorSets2");
-    table->CmdPushConstants2 = (PFN_vkCmdPushConstants2)gpa(dev, "vkCmdPushConstants2");
-    table->CmdPushDescriptorSet2 = (PFN_vkCmdPushDescriptorSet2)gpa(dev, "vkCmdPushDescriptorSet2");
-    table->CmdPushDescriptorSetWithTemplate2 = (PFN_vkCmdPushDescriptorSetWithTemplate2)gpa(dev, "vkCmdPushDescriptorSetWithTemplate2");
-    table->CopyMemoryToImage = (PFN_vkCopyMemoryToImage)gpa(dev, "vkCopyMemoryToImage");
-    table->CopyImageToMemory = (PFN_vkCopyImageToMemory)gpa(dev, "vkCopyImageToMemory");
-    table->CopyImageToImage = (PFN_vkCopyImageToImage)gpa(dev, "vkCopyImageToImage");
-    table->TransitionImageLayout = (PFN_vkTransitionImageLayout)gpa(dev, "vkTransitionImageLayout");
-}
-
-// Init Device function pointer dispatch table with extension commands
+    if (api_version >= VK_API_VERSION_1_4) {
+        table->CmdSetLineStipple = (PFN_vkCmdSetLineStipple)gpa(dev, "vkCmdSetLineStipple");
+        table->MapMemory2 = (PFN_vkMapMemory2)gpa(dev, "vkMapMemory2");
+        table->UnmapMemory2 = (PFN_vkUnmapMemory2)gpa(dev, "vkUnmapMemory2");
+        table->CmdBindIndexBuffer2 = (PFN_vkCmdBindIndexBuffer2)gpa(dev, "vkCmdBindIndexBuffer2");
+        table->GetRenderingAreaGranularity = (PFN_vkGetRenderingAreaGranularity)gpa(dev, "vkGetRenderingAreaGranularity");
+        table->GetDeviceImageSubresourceLayout = (PFN_vkGetDeviceImageSubresourceLayout)gpa(dev, "vkGetDeviceImageSubresourceLayout");
+        table->GetImageSubresourceLayout2 = (PFN_vkGetImageSubresourceLayout2)gpa(dev, "vkGetImageSubresourceLayout2");
+        table->CmdPushDescriptorSet = (PFN_vkCmdPushDescriptorSet)gpa(dev, "vkCmdPushDescriptorSet");
+        table->CmdPushDescriptorSetWithTemplate = (PFN_vkCmdPushDescriptorSetWithTemplate)gpa(dev, "vkCmdPushDescriptorSetWithTemplate");
+        table->CmdSetRenderingAttachmentLocations = (PFN_vkCmdSetRenderingAttachmentLocations)gpa(dev, "vkCmdSetRenderingAttachmentLocations");
+        table->CmdSetRenderingInputAttachmentIndices = (PFN_vkCmdSetRenderingInputAttachmentIndices)gpa(dev, "vkCmdSetRenderingInputAttachmentIndices");
+        table->CmdBindDescriptorSets2 = (PFN_vkCmdBindDescriptorSets2)gpa(dev, "vkCmdBindDescriptorSets2");
+        table->CmdPushConstants2 = (PFN_vkCmdPushConstants2)gpa(dev, "vkCmdPushConstants2");
+        table->CmdPushDescriptorSet2 = (PFN_vkCmdPushDescriptorSet2)gpa(dev, "vkCmdPushDescriptorSet2");
+        table->CmdPushDescriptorSetWithTemplate2 = (PFN_vkCmdPushDescriptorSetWithTemplate2)gpa(dev, "vkCmdPushDescriptorSetWithTemplate2");
+        table->CopyMemoryToImage = (PFN_vkCopyMemoryToImage)gpa(dev, "vkCopyMemoryToImage");
+        table->CopyImageToMemory = (PFN_vkCopyImageToMemory)gpa(dev, "vkCopyImageToMemory");
+        table->CopyImageToImage = (PFN_vkCopyImageToImage)gpa(dev, "vkCopyImageToImage");
+        table->TransitionImageLayout = (PFN_vkTransitionImageLayout)gpa(dev, "vkTransitionImageLayout");
+    }
+}
+
+// Init Device function pointer dispatch table with extension commands. Only the commands of the extensions enabled in
+// pCreateInfo are queried, the entries of the other extensions are left pointing at vkDevExtError.
 VKAPI_ATTR void VKAPI_CALL loader_init_device_extension_dispatch_table(struct loader_dev_dispatch_table *dev_table,
                                                                        PFN_vkGetInstanceProcAddr gipa,
                                                                        PFN_vkGetDeviceProcAddr gdpa,
                                                                        VkInstance inst,
-                                                                       VkDevice dev) {
+                                                                       VkDevice dev,
+                                                                       const VkDeviceCreateInfo *pCreateInfo) {
     VkLayerDispatchTable *table = &dev_table->core_dispatch;
     table->magic = DEVICE_DISP_TABLE_MAGIC_NUMBER;
 
     // ---- VK_KHR_swapchain extension commands
     table->CreateSwapchainKHR = (PFN_vkCreateSwapchainKHR)gdpa(dev, "vkCreateSwapchainKHR");
-    table->DestroySwapchainKHR = (PFN_vkDestroySwapchainKHR)gdpa(dev, "vkDestroySwapchainKHR");
-    table->GetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR)gdpa(dev, "vkGetSwapchainImagesKHR");
-    table->AcquireNextImageKHR = (PFN_vkAcquireNextImageKHR)gdpa(dev, "vkAcquireNextImageKHR");
-    table->QueuePresentKHR = (PFN_vkQueuePresentKHR)gdpa(dev, "vkQueuePresentKHR");
-    table->GetDeviceGroupPresentCapabilitiesKHR = (PFN_vkGetDeviceGroupPresentCapabilitiesKHR)gdpa(dev, "vkGetDeviceGroupPresentCapabilitiesKHR");
-    table->GetDeviceGroupSurfacePresentModesKHR = (PFN_vkGetDeviceGroupSurfacePresentModesKHR)gdpa(dev, "vkGetDeviceGroupSurfacePresentModesKHR");
-    table->AcquireNextImage2KHR = (PFN_vkAcquireNextImage2KHR)gdpa(dev, "vkAcquireNextImage2KHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_swapchain")) {
+        table->DestroySwapchainKHR = (PFN_vkDestroySwapchainKHR)gdpa(dev, "vkDestroySwapchainKHR");
+        table->GetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR)gdpa(dev, "vkGetSwapchainImagesKHR");
+        table->AcquireNextImageKHR = (PFN_vkAcquireNextImageKHR)gdpa(dev, "vkAcquireNextImageKHR");
+        table->QueuePresentKHR = (PFN_vkQueuePresentKHR)gdpa(dev, "vkQueuePresentKHR");
+    }
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_swapchain") || loader_device_extension_enabled(pCreateInfo, "VK_KHR_device_group")) {
+        table->GetDeviceGroupPresentCapabilitiesKHR = (PFN_vkGetDeviceGroupPresentCapabilitiesKHR)gdpa(dev, "vkGetDeviceGroupPresentCapabilitiesKHR");
+        table->GetDeviceGroupSurfacePresentModesKHR = (PFN_vkGetDeviceGroupSurfacePresentModesKHR)gdpa(dev, "vkGetDeviceGroupSurfacePresentModesKHR");
+        table->AcquireNextImage2KHR = (PFN_vkAcquireNextImage2KHR)gdpa(dev, "vkAcquireNextImage2KHR");
+    }
 
     // ---- VK_KHR_display_swapchain extension commands
-    table->CreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR)gdpa(dev, "vkCreateSharedSwapchainsKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_display_swapchain")) {
+        table->CreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR)gdpa(dev, "vkCreateSharedSwapchainsKHR");
+    }
 
     // ---- VK_KHR_video_queue extension commands
-    table->CreateVideoSessionKHR = (PFN_vkCreateVideoSessionKHR)gdpa(dev, "vkCreateVideoSessionKHR");
-    table->DestroyVideoSessionKHR = (PFN_vkDestroyVideoSessionKHR)gdpa(dev, "vkDestroyVideoSessionKHR");
-    table->GetVideoSessionMemoryRequirementsKHR = (PFN_vkGetVideoSessionMemoryRequirementsKHR)gdpa(dev, "vkGetVideoSessionMemoryRequirementsKHR");
-    table->BindVideoSessionMemoryKHR = (PFN_vkBindVideoSessionMemoryKHR)gdpa(dev, "vkBindVideoSessionMemoryKHR");
-    table->CreateVideoSessionParametersKHR = (PFN_vkCreateVideoSessionParametersKHR)gdpa(dev, "vkCreateVideoSessionParametersKHR");
-    table->UpdateVideoSessionParametersKHR = (PFN_vkUpdateVideoSessionParametersKHR)gdpa(dev, "vkUpdateVideoSessionParametersKHR");
-    table->DestroyVideoSessionParametersKHR = (PFN_vkDestroyVideoSessionParametersKHR)gdpa(dev, "vkDestroyVideoSessionParametersKHR");
-    table->CmdBeginVideoCodingKHR = (PFN_vkCmdBeginVideoCodingKHR)gdpa(dev, "vkCmdBeginVideoCodingKHR");
-    table->CmdEndVideoCodingKHR = (PFN_vkCmdEndVideoCodingKHR)gdpa(dev, "vkCmdEndVideoCodingKHR");
-    table->CmdControlVideoCodingKHR = (PFN_vkCmdControlVideoCodingKHR)gdpa(dev, "vkCmdControlVideoCodingKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_video_queue")) {
+        table->CreateVideoSessionKHR = (PFN_vkCreateVideoSessionKHR)gdpa(dev, "vkCreateVideoSessionKHR");
+        table->DestroyVideoSessionKHR = (PFN_vkDestroyVideoSessionKHR)gdpa(dev, "vkDestroyVideoSessionKHR");
+        table->GetVideoSessionMemoryRequirementsKHR = (PFN_vkGetVideoSessionMemoryRequirementsKHR)gdpa(dev, "vkGetVideoSessionMemoryRequirementsKHR");
+        table->BindVideoSessionMemoryKHR = (PFN_vkBindVideoSessionMemoryKHR)gdpa(dev, "vkBindVideoSessionMemoryKHR");
+        table->CreateVideoSessionParametersKHR = (PFN_vkCreateVideoSessionParametersKHR)gdpa(dev, "vkCreateVideoSessionParametersKHR");
+        table->UpdateVideoSessionParametersKHR = (PFN_vkUpdateVideoSessionParametersKHR)gdpa(dev, "vkUpdateVideoSessionParametersKHR");
+        table->DestroyVideoSessionParametersKHR = (PFN_vkDestroyVideoSessionParametersKHR)gdpa(dev, "vkDestroyVideoSessionParametersKHR");
+        table->CmdBeginVideoCodingKHR = (PFN_vkCmdBeginVideoCodingKHR)gdpa(dev, "vkCmdBeginVideoCodingKHR");
+        table->CmdEndVideoCodingKHR = (PFN_vkCmdEndVideoCodingKHR)gdpa(dev, "vkCmdEndVideoCodingKHR");
+        table->CmdControlVideoCodingKHR = (PFN_vkCmdControlVideoCodingKHR)gdpa(dev, "vkCmdControlVideoCodingKHR");
+    }
 
     // ---- VK_KHR_video_decode_queue extension commands
-    table->CmdDecodeVideoKHR = (PFN_vkCmdDecodeVideoKHR)gdpa(dev, "vkCmdDecodeVideoKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_video_decode_queue")) {
+        table->CmdDecodeVideoKHR = (PFN_vkCmdDecodeVideoKHR)gdpa(dev, "vkCmdDecodeVideoKHR");
+    }
 
     // ---- VK_KHR_dynamic_rendering extension commands
-    table->CmdBeginRenderingKHR = (PFN_vkCmdBeginRenderingKHR)gdpa(dev, "vkCmdBeginRenderingKHR");
-    table->CmdEndRenderingKHR = (PFN_vkCmdEndRenderingKHR)gdpa(dev, "vkCmdEndRenderingKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_dynamic_rendering")) {
+        table->CmdBeginRenderingKHR = (PFN_vkCmdBeginRenderingKHR)gdpa(dev, "vkCmdBeginRenderingKHR");
+        table->CmdEndRenderingKHR = (PFN_vkCmdEndRenderingKHR)gdpa(dev, "vkCmdEndRenderingKHR");
+    }
 
     // ---- VK_KHR_device_group extension commands
-    table->GetDeviceGroupPeerMemoryFeaturesKHR = (PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR)gdpa(dev, "vkGetDeviceGroupPeerMemoryFeaturesKHR");
-    table->CmdSetDeviceMaskKHR = (PFN_vkCmdSetDeviceMaskKHR)gdpa(dev, "vkCmdSetDeviceMaskKHR");
-    table->CmdDispatchBaseKHR = (PFN_vkCmdDispatchBaseKHR)gdpa(dev, "vkCmdDispatchBaseKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_device_group")) {
+        table->GetDeviceGroupPeerMemoryFeaturesKHR = (PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR)gdpa(dev, "vkGetDeviceGroupPeerMemoryFeaturesKHR");
+        table->CmdSetDeviceMaskKHR = (PFN_vkCmdSetDeviceMaskKHR)gdpa(dev, "vkCmdSetDeviceMaskKHR");
+        table->CmdDispatchBaseKHR = (PFN_vkCmdDispatchBaseKHR)gdpa(dev, "vkCmdDispatchBaseKHR");
+    }
 
     // ---- VK_KHR_maintenance1 extension commands
-    table->TrimCommandPoolKHR = (PFN_vkTrimCommandPoolKHR)gdpa(dev, "vkTrimCommandPoolKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_maintenance1")) {
+        table->TrimCommandPoolKHR = (PFN_vkTrimCommandPoolKHR)gdpa(dev, "vkTrimCommandPoolKHR");
+    }
 
     // ---- VK_KHR_external_memory_win32 extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_external_memory_win32")) {
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    table->GetMemoryWin32HandleKHR = (PFN_vkGetMemoryWin32HandleKHR)gdpa(dev, "vkGetMemoryWin32HandleKHR");
+        table->GetMemoryWin32HandleKHR = (PFN_vkGetMemoryWin32HandleKHR)gdpa(dev, "vkGetMemoryWin32HandleKHR");
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    table->GetMemoryWin32HandlePropertiesKHR = (PFN_vkGetMemoryWin32HandlePropertiesKHR)gdpa(dev, "vkGetMemoryWin32HandlePropertiesKHR");
+        table->GetMemoryWin32HandlePropertiesKHR = (PFN_vkGetMemoryWin32HandlePropertiesKHR)gdpa(dev, "vkGetMemoryWin32HandlePropertiesKHR");
 #endif // VK_USE_PLATFORM_WIN32_KHR
+    }
 
     // ---- VK_KHR_external_memory_fd extension commands
-    table->GetMemoryFdKHR = (PFN_vkGetMemoryFdKHR)gdpa(dev, "vkGetMemoryFdKHR");
-    table->GetMemoryFdPropertiesKHR = (PFN_vkGetMemoryFdPropertiesKHR)gdpa(dev, "vkGetMemoryFdPropertiesKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_external_memory_fd")) {
+        table->GetMemoryFdKHR = (PFN_vkGetMemoryFdKHR)gdpa(dev, "vkGetMemoryFdKHR");
+        table->GetMemoryFdPropertiesKHR = (PFN_vkGetMemoryFdPropertiesKHR)gdpa(dev, "vkGetMemoryFdPropertiesKHR");
+    }
 
     // ---- VK_KHR_external_semaphore_win32 extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_external_semaphore_win32")) {
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    table->ImportSemaphoreWin32HandleKHR = (PFN_vkImportSemaphoreWin32HandleKHR)gdpa(dev, "vkImportSemaphoreWin32HandleKHR");
+        table->ImportSemaphoreWin32HandleKHR = (PFN_vkImportSemaphoreWin32HandleKHR)gdpa(dev, "vkImportSemaphoreWin32HandleKHR");
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    table->GetSemaphoreWin32HandleKHR = (PFN_vkGetSemaphoreWin32HandleKHR)gdpa(dev, "vkGetSemaphoreWin32HandleKHR");
+        table->GetSemaphoreWin32HandleKHR = (PFN_vkGetSemaphoreWin32HandleKHR)gdpa(dev, "vkGetSemaphoreWin32HandleKHR");
 #endif // VK_USE_PLATFORM_WIN32_KHR
+    }
 
     // ---- VK_KHR_external_semaphore_fd extension commands
-    table->ImportSemaphoreFdKHR = (PFN_vkImportSemaphoreFdKHR)gdpa(dev, "vkImportSemaphoreFdKHR");
-    table->GetSemaphoreFdKHR = (PFN_vkGetSemaphoreFdKHR)gdpa(dev, "vkGetSemaphoreFdKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_external_semaphore_fd")) {
+        table->ImportSemaphoreFdKHR = (PFN_vkImportSemaphoreFdKHR)gdpa(dev, "vkImportSemaphoreFdKHR");
+        table->GetSemaphoreFdKHR = (PFN_vkGetSemaphoreFdKHR)gdpa(dev, "vkGetSemaphoreFdKHR");
+    }
 
     // ---- VK_KHR_push_descriptor extension commands
-    table->CmdPushDescriptorSetKHR = (PFN_vkCmdPushDescriptorSetKHR)gdpa(dev, "vkCmdPushDescriptorSetKHR");
-    table->CmdPushDescriptorSetWithTemplateKHR = (PFN_vkCmdPushDescriptorSetWithTemplateKHR)gdpa(dev, "vkCmdPushDescriptorSetWithTemplateKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_push_descriptor")) {
+        table->CmdPushDescriptorSetKHR = (PFN_vkCmdPushDescriptorSetKHR)gdpa(dev, "vkCmdPushDescriptorSetKHR");
+    }
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_push_descriptor") || loader_device_extension_enabled(pCreateInfo, "VK_KHR_descriptor_update_template")) {
+        table->CmdPushDescriptorSetWithTemplateKHR = (PFN_vkCmdPushDescriptorSetWithTemplateKHR)gdpa(dev, "vkCmdPushDescriptorSetWithTemplateKHR");
+    }
 
     // ---- VK_KHR_descriptor_update_template extension commands
-    table->CreateDescriptorUpdateTemplateKHR = (PFN_vkCreateDescriptorUpdateTemplateKHR)gdpa(dev, "vkCreateDescriptorUpdateTemplateKHR");
-    table->DestroyDescriptorUpdateTemplateKHR = (PFN_vkDestroyDescriptorUpdateTemplateKHR)gdpa(dev, "vkDestroyDescriptorUpdateTemplateKHR");
-    table->UpdateDescriptorSetWithTemplateKHR = (PFN_vkUpdateDescriptorSetWithTemplateKHR)gdpa(dev, "vkUpdateDescriptorSetWithTemplateKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_descriptor_update_template")) {
+        table->CreateDescriptorUpdateTemplateKHR = (PFN_vkCreateDescriptorUpdateTemplateKHR)gdpa(dev, "vkCreateDescriptorUpdateTemplateKHR");
+        table->DestroyDescriptorUpdateTemplateKHR = (PFN_vkDestroyDescriptorUpdateTemplateKHR)gdpa(dev, "vkDestroyDescriptorUpdateTemplateKHR");
+        table->UpdateDescriptorSetWithTemplateKHR = (PFN_vkUpdateDescriptorSetWithTemplateKHR)gdpa(dev, "vkUpdateDescriptorSetWithTemplateKHR");
+    }
 
     // ---- VK_KHR_create_renderpass2 extension commands
-    table->CreateRenderPass2KHR = (PFN_vkCreateRenderPass2KHR)gdpa(dev, "vkCreateRenderPass2KHR");
-    table->CmdBeginRenderPass2KHR = (PFN_vkCmdBeginRenderPass2KHR)gdpa(dev, "vkCmdBeginRenderPass2KHR");
-    table->CmdNextSubpass2KHR = (PFN_vkCmdNextSubpass2KHR)gdpa(dev, "vkCmdNextSubpass2KHR");
-    table->CmdEndRenderPass2KHR = (PFN_vkCmdEndRenderPass2KHR)gdpa(dev, "vkCmdEndRenderPass2KHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_create_renderpass2")) {
+        table->CreateRenderPass2KHR = (PFN_vkCreateRenderPass2KHR)gdpa(dev, "vkCreateRenderPass2KHR");
+        table->CmdBeginRenderPass2KHR = (PFN_vkCmdBeginRenderPass2KHR)gdpa(dev, "vkCmdBeginRenderPass2KHR");
+        table->CmdNextSubpass2KHR = (PFN_vkCmdNextSubpass2KHR)gdpa(dev, "vkCmdNextSubpass2KHR");
+        table->CmdEndRenderPass2KHR = (PFN_vkCmdEndRenderPass2KHR)gdpa(dev, "vkCmdEndRenderPass2KHR");
+    }
 
     // ---- VK_KHR_shared_presentable_image extension commands
-    table->GetSwapchainStatusKHR = (PFN_vkGetSwapchainStatusKHR)gdpa(dev, "vkGetSwapchainStatusKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_shared_presentable_image")) {
+        table->GetSwapchainStatusKHR = (PFN_vkGetSwapchainStatusKHR)gdpa(dev, "vkGetSwapchainStatusKHR");
+    }
 
     // ---- VK_KHR_external_fence_win32 extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_external_fence_win32")) {
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    table->ImportFenceWin32HandleKHR = (PFN_vkImportFenceWin32HandleKHR)gdpa(dev, "vkImportFenceWin32HandleKHR");
+        table->ImportFenceWin32HandleKHR = (PFN_vkImportFenceWin32HandleKHR)gdpa(dev, "vkImportFenceWin32HandleKHR");
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    table->GetFenceWin32HandleKHR = (PFN_vkGetFenceWin32HandleKHR)gdpa(dev, "vkGetFenceWin32HandleKHR");
+        table->GetFenceWin32HandleKHR = (PFN_vkGetFenceWin32HandleKHR)gdpa(dev, "vkGetFenceWin32HandleKHR");
 #endif // VK_USE_PLATFORM_WIN32_KHR
+    }
 
     // ---- VK_KHR_external_fence_fd extension commands
-    table->ImportFenceFdKHR = (PFN_vkImportFenceFdKHR)gdpa(dev, "vkImportFenceFdKHR");
-    table->GetFenceFdKHR = (PFN_vkGetFenceFdKHR)gdpa(dev, "vkGetFenceFdKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_external_fence_fd")) {
+        table->ImportFenceFdKHR = (PFN_vkImportFenceFdKHR)gdpa(dev, "vkImportFenceFdKHR");
+        table->GetFenceFdKHR = (PFN_vkGetFenceFdKHR)gdpa(dev, "vkGetFenceFdKHR");
+    }
 
     // ---- VK_KHR_performance_query extension commands
-    table->AcquireProfilingLockKHR = (PFN_vkAcquireProfilingLockKHR)gdpa(dev, "vkAcquireProfilingLockKHR");
-    table->ReleaseProfilingLockKHR = (PFN_vkReleaseProfilingLockKHR)gdpa(dev, "vkReleaseProfilingLockKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_performance_query")) {
+        table->AcquireProfilingLockKHR = (PFN_vkAcquireProfilingLockKHR)gdpa(dev, "vkAcquireProfilingLockKHR");
+        table->ReleaseProfilingLockKHR = (PFN_vkReleaseProfilingLockKHR)gdpa(dev, "vkReleaseProfilingLockKHR");
+    }
 
     // ---- VK_KHR_get_memory_requirements2 extension commands
-    table->GetImageMemoryRequirements2KHR = (PFN_vkGetImageMemoryRequirements2KHR)gdpa(dev, "vkGetImageMemoryRequirements2KHR");
-    table->GetBufferMemoryRequirements2KHR = (PFN_vkGetBufferMemoryRequirements2KHR)gdpa(dev, "vkGetBufferMemoryRequirements2KHR");
-    table->GetImageSparseMemoryRequirements2KHR = (PFN_vkGetImageSparseMemoryRequirements2KHR)gdpa(dev, "vkGetImageSparseMemoryRequirements2KHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_get_memory_requirements2")) {
+        table->GetImageMemoryRequirements2KHR = (PFN_vkGetImageMemoryRequirements2KHR)gdpa(dev, "vkGetImageMemoryRequirements2KHR");
+        table->GetBufferMemoryRequirements2KHR = (PFN_vkGetBufferMemoryRequirements2KHR)gdpa(dev, "vkGetBufferMemoryRequirements2KHR");
+        table->GetImageSparseMemoryRequirements2KHR = (PFN_vkGetImageSparseMemoryRequirements2KHR)gdpa(dev, "vkGetImageSparseMemoryRequirements2KHR");
+    }
 
     // ---- VK_KHR_sampler_ycbcr_conversion extension commands
-    table->CreateSamplerYcbcrConversionKHR = (PFN_vkCreateSamplerYcbcrConversionKHR)gdpa(dev, "vkCreateSamplerYcbcrConversionKHR");
-    table->DestroySamplerYcbcrConversionKHR = (PFN_vkDestroySamplerYcbcrConversionKHR)gdpa(dev, "vkDestroySamplerYcbcrConversionKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_sampler_ycbcr_conversion")) {
+        table->CreateSamplerYcbcrConversionKHR = (PFN_vkCreateSamplerYcbcrConversionKHR)gdpa(dev, "vkCreateSamplerYcbcrConversionKHR");
+        table->DestroySamplerYcbcrConversionKHR = (PFN_vkDestroySamplerYcbcrConversionKHR)gdpa(dev, "vkDestroySamplerYcbcrConversionKHR");
+    }
 
     // ---- VK_KHR_bind_memory2 extension commands
-    table->BindBufferMemory2KHR = (PFN_vkBindBufferMemory2KHR)gdpa(dev, "vkBindBufferMemory2KHR");
-    table->BindImageMemory2KHR = (PFN_vkBindImageMemory2KHR)gdpa(dev, "vkBindImageMemory2KHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_bind_memory2")) {
+        table->BindBufferMemory2KHR = (PFN_vkBindBufferMemory2KHR)gdpa(dev, "vkBindBufferMemory2KHR");
+        table->BindImageMemory2KHR = (PFN_vkBindImageMemory2KHR)gdpa(dev, "vkBindImageMemory2KHR");
+    }
 
     // ---- VK_KHR_maintenance3 extension commands
-    table->GetDescriptorSetLayoutSupportKHR = (PFN_vkGetDescriptorSetLayoutSupportKHR)gdpa(dev, "vkGetDescriptorSetLayoutSupportKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_maintenance3")) {
+        table->GetDescriptorSetLayoutSupportKHR = (PFN_vkGetDescriptorSetLayoutSupportKHR)gdpa(dev, "vkGetDescriptorSetLayoutSupportKHR");
+    }
 
     // ---- VK_KHR_draw_indirect_count extension commands
-    table->CmdDrawIndirectCountKHR = (PFN_vkCmdDrawIndirectCountKHR)gdpa(dev, "vkCmdDrawIndirectCountKHR");
-    table->CmdDrawIndexedIndirectCountKHR = (PFN_vkCmdDrawIndexedIndirectCountKHR)gdpa(dev, "vkCmdDrawIndexedIndirectCountKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_draw_indirect_count")) {
+        table->CmdDrawIndirectCountKHR = (PFN_vkCmdDrawIndirectCountKHR)gdpa(dev, "vkCmdDrawIndirectCountKHR");
+        table->CmdDrawIndexedIndirectCountKHR = (PFN_vkCmdDrawIndexedIndirectCountKHR)gdpa(dev, "vkCmdDrawIndexedIndirectCountKHR");
+    }
 
     // ---- VK_KHR_timeline_semaphore extension commands
-    table->GetSemaphoreCounterValueKHR = (PFN_vkGetSemaphoreCounterValueKHR)gdpa(dev, "vkGetSemaphoreCounterValueKHR");
-    table->WaitSemaphoresKHR = (PFN_vkWaitSemaphoresKHR)gdpa(dev, "vkWaitSemaphoresKHR");
-    table->SignalSemaphoreKHR = (PFN_vkSignalSemaphoreKHR)gdpa(dev, "vkSignalSemaphoreKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_timeline_semaphore")) {
+        table->GetSemaphoreCounterValueKHR = (PFN_vkGetSemaphoreCounterValueKHR)gdpa(dev, "vkGetSemaphoreCounterValueKHR");
+        table->WaitSemaphoresKHR = (PFN_vkWaitSemaphoresKHR)gdpa(dev, "vkWaitSemaphoresKHR");
+        table->SignalSemaphoreKHR = (PFN_vkSignalSemaphoreKHR)gdpa(dev, "vkSignalSemaphoreKHR");
+    }
 
     // ---- VK_KHR_fragment_shading_rate extension commands
-    table->CmdSetFragmentShadingRateKHR = (PFN_vkCmdSetFragmentShadingRateKHR)gdpa(dev, "vkCmdSetFragmentShadingRateKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_fragment_shading_rate")) {
+        table->CmdSetFragmentShadingRateKHR = (PFN_vkCmdSetFragmentShadingRateKHR)gdpa(dev, "vkCmdSetFragmentShadingRateKHR");
+    }
 
     // ---- VK_KHR_dynamic_rendering_local_read extension commands
-    table->CmdSetRenderingAttachmentLocationsKHR = (PFN_vkCmdSetRenderingAttachmentLocationsKHR)gdpa(dev, "vkCmdSetRenderingAttachmentLocationsKHR");
-    table->CmdSetRenderingInputAttachmentIndicesKHR = (PFN_vkCmdSetRenderingInputAttachmentIndicesKHR)gdpa(dev, "vkCmdSetRenderingInputAttachmentIndicesKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_dynamic_rendering_local_read")) {
+        table->CmdSetRenderingAttachmentLocationsKHR = (PFN_vkCmdSetRenderingAttachmentLocationsKHR)gdpa(dev, "vkCmdSetRenderingAttachmentLocationsKHR");
+        table->CmdSetRenderingInputAttachmentIndicesKHR = (PFN_vkCmdSetRenderingInputAttachmentIndicesKHR)gdpa(dev, "vkCmdSetRenderingInputAttachmentIndicesKHR");
+    }
 
     // ---- VK_KHR_present_wait extension commands
-    table->WaitForPresentKHR = (PFN_vkWaitForPresentKHR)gdpa(dev, "vkWaitForPresentKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_present_wait")) {
+        table->WaitForPresentKHR = (PFN_vkWaitForPresentKHR)gdpa(dev, "vkWaitForPresentKHR");
+    }
 
     // ---- VK_KHR_buffer_device_address extension commands
-    table->GetBufferDeviceAddressKHR = (PFN_vkGetBufferDeviceAddressKHR)gdpa(dev, "vkGetBufferDeviceAddressKHR");
-    table->GetBufferOpaqueCaptureAddressKHR = (PFN_vkGetBufferOpaqueCaptureAddressKHR)gdpa(dev, "vkGetBufferOpaqueCaptureAddressKHR");
-    table->GetDeviceMemoryOpaqueCaptureAddressKHR = (PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR)gdpa(dev, "vkGetDeviceMemoryOpaqueCaptureAddressKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_buffer_device_address")) {
+        table->GetBufferDeviceAddressKHR = (PFN_vkGetBufferDeviceAddressKHR)gdpa(dev, "vkGetBufferDeviceAddressKHR");
+        table->GetBufferOpaqueCaptureAddressKHR = (PFN_vkGetBufferOpaqueCaptureAddressKHR)gdpa(dev, "vkGetBufferOpaqueCaptureAddressKHR");
+        table->GetDeviceMemoryOpaqueCaptureAddressKHR = (PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR)gdpa(dev, "vkGetDeviceMemoryOpaqueCaptureAddressKHR");
+    }
 
     // ---- VK_KHR_deferred_host_operations extension commands
-    table->CreateDeferredOperationKHR = (PFN_vkCreateDeferredOperationKHR)gdpa(dev, "vkCreateDeferredOperationKHR");
-    table->DestroyDeferredOperationKHR = (PFN_vkDestroyDeferredOperationKHR)gdpa(dev, "vkDestroyDeferredOperationKHR");
-    table->GetDeferredOperationMaxConcurrencyKHR = (PFN_vkGetDeferredOperationMaxConcurrencyKHR)gdpa(dev, "vkGetDeferredOperationMaxConcurrencyKHR");
-    table->GetDeferredOperationResultKHR = (PFN_vkGetDeferredOperationResultKHR)gdpa(dev, "vkGetDeferredOperationResultKHR");
-    table->DeferredOperationJoinKHR = (PFN_vkDeferredOperationJoinKHR)gdpa(dev, "vkDeferredOperationJoinKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_deferred_host_operations")) {
+        table->CreateDeferredOperationKHR = (PFN_vkCreateDeferredOperationKHR)gdpa(dev, "vkCreateDeferredOperationKHR");
+        table->DestroyDeferredOperationKHR = (PFN_vkDestroyDeferredOperationKHR)gdpa(dev, "vkDestroyDeferredOperationKHR");
+        table->GetDeferredOperationMaxConcurrencyKHR = (PFN_vkGetDeferredOperationMaxConcurrencyKHR)gdpa(dev, "vkGetDeferredOperationMaxConcurrencyKHR");
+        table->GetDeferredOperationResultKHR = (PFN_vkGetDeferredOperationResultKHR)gdpa(dev, "vkGetDeferredOperationResultKHR");
+        table->DeferredOperationJoinKHR = (PFN_vkDeferredOperationJoinKHR)gdpa(dev, "vkDeferredOperationJoinKHR");
+    }
 
     // ---- VK_KHR_pipeline_executable_properties extension commands
-    table->GetPipelineExecutablePropertiesKHR = (PFN_vkGetPipelineExecutablePropertiesKHR)gdpa(dev, "vkGetPipelineExecutablePropertiesKHR");
-    table->GetPipelineExecutableStatisticsKHR = (PFN_vkGetPipelineExecutableStatisticsKHR)gdpa(dev, "vkGetPipelineExecutableStatisticsKHR");
-    table->GetPipelineExecutableInternalRepresentationsKHR = (PFN_vkGetPipelineExecutableInternalRepresentationsKHR)gdpa(dev, "vkGetPipelineExecutableInternalRepresentationsKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_pipeline_executable_properties")) {
+        table->GetPipelineExecutablePropertiesKHR = (PFN_vkGetPipelineExecutablePropertiesKHR)gdpa(dev, "vkGetPipelineExecutablePropertiesKHR");
+        table->GetPipelineExecutableStatisticsKHR = (PFN_vkGetPipelineExecutableStatisticsKHR)gdpa(dev, "vkGetPipelineExecutableStatisticsKHR");
+        table->GetPipelineExecutableInternalRepresentationsKHR = (PFN_vkGetPipelineExecutableInternalRepresentationsKHR)gdpa(dev, "vkGetPipelineExecutableInternalRepresentationsKHR");
+    }
 
     // ---- VK_KHR_map_memory2 extension commands
-    table->MapMemory2KHR = (PFN_vkMapMemory2KHR)gdpa(dev, "vkMapMemory2KHR");
-    table->UnmapMemory2KHR = (PFN_vkUnmapMemory2KHR)gdpa(dev, "vkUnmapMemory2KHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_map_memory2")) {
+        table->MapMemory2KHR = (PFN_vkMapMemory2KHR)gdpa(dev, "vkMapMemory2KHR");
+        table->UnmapMemory2KHR = (PFN_vkUnmapMemory2KHR)gdpa(dev, "vkUnmapMemory2KHR");
+    }
 
     // ---- VK_KHR_video_encode_queue extension commands
-    table->GetEncodedVideoSessionParametersKHR = (PFN_vkGetEncodedVideoSessionParametersKHR)gdpa(dev, "vkGetEncodedVideoSessionParametersKHR");
-    table->CmdEncodeVideoKHR = (PFN_vkCmdEncodeVideoKHR)gdpa(dev, "vkCmdEncodeVideoKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_video_encode_queue")) {
+        table->GetEncodedVideoSessionParametersKHR = (PFN_vkGetEncodedVideoSessionParametersKHR)gdpa(dev, "vkGetEncodedVideoSessionParametersKHR");
+        table->CmdEncodeVideoKHR = (PFN_vkCmdEncodeVideoKHR)gdpa(dev, "vkCmdEncodeVideoKHR");
+    }
 
     // ---- VK_KHR_synchronization2 extension commands
-    table->CmdSetEvent2KHR = (PFN_vkCmdSetEvent2KHR)gdpa(dev, "vkCmdSetEvent2KHR");
-    table->CmdResetEvent2KHR = (PFN_vkCmdResetEvent2KHR)gdpa(dev, "vkCmdResetEvent2KHR");
-    table->CmdWaitEvents2KHR = (PFN_vkCmdWaitEvents2KHR)gdpa(dev, "vkCmdWaitEvents2KHR");
-    table->CmdPipelineBarrier2KHR = (PFN_vkCmdPipelineBarrier2KHR)gdpa(dev, "vkCmdPipelineBarrier2KHR");
-    table->CmdWriteTimestamp2KHR = (PFN_vkCmdWriteTimestamp2KHR)gdpa(dev, "vkCmdWriteTimestamp2KHR");
-    table->QueueSubmit2KHR = (PFN_vkQueueSubmit2KHR)gdpa(dev, "vkQueueSubmit2KHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_synchronization2")) {
+        table->CmdSetEvent2KHR = (PFN_vkCmdSetEvent2KHR)gdpa(dev, "vkCmdSetEvent2KHR");
+        table->CmdResetEvent2KHR = (PFN_vkCmdResetEvent2KHR)gdpa(dev, "vkCmdResetEvent2KHR");
+        table->CmdWaitEvents2KHR = (PFN_vkCmdWaitEvents2KHR)gdpa(dev, "vkCmdWaitEvents2KHR");
+        table->CmdPipelineBarrier2KHR = (PFN_vkCmdPipelineBarrier2KHR)gdpa(dev, "vkCmdPipelineBarrier2KHR");
+        table->CmdWriteTimestamp2KHR = (PFN_vkCmdWriteTimestamp2KHR)gdpa(dev, "vkCmdWriteTimestamp2KHR");
+        table->QueueSubmit2KHR = (PFN_vkQueueSubmit2KHR)gdpa(dev, "vkQueueSubmit2KHR");
+    }
 
     // ---- VK_KHR_copy_commands2 extension commands
-    table->CmdCopyBuffer2KHR = (PFN_vkCmdCopyBuffer2KHR)gdpa(dev, "vkCmdCopyBuffer2KHR");
-    table->CmdCopyImage2KHR = (PFN_vkCmdCopyImage2KHR)gdpa(dev, "vkCmdCopyImage2KHR");
-    table->CmdCopyBufferToImage2KHR = (PFN_vkCmdCopyBufferToImage2KHR)gdpa(dev, "vkCmdCopyBufferToImage2KHR");
-    table->CmdCopyImageToBuffer2KHR = (PFN_vkCmdCopyImageToBuffer2KHR)gdpa(dev, "vkCmdCopyImageToBuffer2KHR");
-    table->CmdBlitImage2KHR = (PFN_vkCmdBlitImage2KHR)gdpa(dev, "vkCmdBlitImage2KHR");
-    table->CmdResolveImage2KHR = (PFN_vkCmdResolveImage2KHR)gdpa(dev, "vkCmdResolveImage2KHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_copy_commands2")) {
+        table->CmdCopyBuffer2KHR = (PFN_vkCmdCopyBuffer2KHR)gdpa(dev, "vkCmdCopyBuffer2KHR");
+        table->CmdCopyImage2KHR = (PFN_vkCmdCopyImage2KHR)gdpa(dev, "vkCmdCopyImage2KHR");
+        table->CmdCopyBufferToImage2KHR = (PFN_vkCmdCopyBufferToImage2KHR)gdpa(dev, "vkCmdCopyBufferToImage2KHR");
+        table->CmdCopyImageToBuffer2KHR = (PFN_vkCmdCopyImageToBuffer2KHR)gdpa(dev, "vkCmdCopyImageToBuffer2KHR");
+        table->CmdBlitImage2KHR = (PFN_vkCmdBlitImage2KHR)gdpa(dev, "vkCmdBlitImage2KHR");
+        table->CmdResolveImage2KHR = (PFN_vkCmdResolveImage2KHR)gdpa(dev, "vkCmdResolveImage2KHR");
+    }
 
     // ---- VK_KHR_ray_tracing_maintenance1 extension commands
-    table->CmdTraceRaysIndirect2KHR = (PFN_vkCmdTraceRaysIndirect2KHR)gdpa(dev, "vkCmdTraceRaysIndirect2KHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_ray_tracing_maintenance1")) {
+        table->CmdTraceRaysIndirect2KHR = (PFN_vkCmdTraceRaysIndirect2KHR)gdpa(dev, "vkCmdTraceRaysIndirect2KHR");
+    }
 
     // ---- VK_KHR_maintenance4 extension commands
-    table->GetDeviceBufferMemoryRequirementsKHR = (PFN_vkGetDeviceBufferMemoryRequirementsKHR)gdpa(dev, "vkGetDeviceBufferMemoryRequirementsKHR");
-    table->GetDeviceImageMemoryRequirementsKHR = (PFN_vkGetDeviceImageMemoryRequirementsKHR)gdpa(dev, "vkGetDeviceImageMemoryRequirementsKHR");
-    table->GetDeviceImageSparseMemoryRequirementsKHR = (PFN_vkGetDeviceImageSparseMemoryRequirementsKHR)gdpa(dev, "vkGetDeviceImageSparseMemoryRequirementsKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_maintenance4")) {
+        table->GetDeviceBufferMemoryRequirementsKHR = (PFN_vkGetDeviceBufferMemoryRequirementsKHR)gdpa(dev, "vkGetDeviceBufferMemoryRequirementsKHR");
+        table->GetDeviceImageMemoryRequirementsKHR = (PFN_vkGetDeviceImageMemoryRequirementsKHR)gdpa(dev, "vkGetDeviceImageMemoryRequirementsKHR");
+        table->GetDeviceImageSparseMemoryRequirementsKHR = (PFN_vkGetDeviceImageSparseMemoryRequirementsKHR)gdpa(dev, "vkGetDeviceImageSparseMemoryRequirementsKHR");
+    }
 
     // ---- VK_KHR_maintenance5 extension commands
-    table->CmdBindIndexBuffer2KHR = (PFN_vkCmdBindIndexBuffer2KHR)gdpa(dev, "vkCmdBindIndexBuffer2KHR");
-    table->GetRenderingAreaGranularityKHR = (PFN_vkGetRenderingAreaGranularityKHR)gdpa(dev, "vkGetRenderingAreaGranularityKHR");
-    table->GetDeviceImageSubresourceLayoutKHR = (PFN_vkGetDeviceImageSubresourceLayoutKHR)gdpa(dev, "vkGetDeviceImageSubresourceLayoutKHR");
-    table->GetImageSubresourceLayout2KHR = (PFN_vkGetImageSubresourceLayout2KHR)gdpa(dev, "vkGetImageSubresourceLayout2KHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_maintenance5")) {
+        table->CmdBindIndexBuffer2KHR = (PFN_vkCmdBindIndexBuffer2KHR)gdpa(dev, "vkCmdBindIndexBuffer2KHR");
+        table->GetRenderingAreaGranularityKHR = (PFN_vkGetRenderingAreaGranularityKHR)gdpa(dev, "vkGetRenderingAreaGranularityKHR");
+        table->GetDeviceImageSubresourceLayoutKHR = (PFN_vkGetDeviceImageSubresourceLayoutKHR)gdpa(dev, "vkGetDeviceImageSubresourceLayoutKHR");
+        table->GetImageSubresourceLayout2KHR = (PFN_vkGetImageSubresourceLayout2KHR)gdpa(dev, "vkGetImageSubresourceLayout2KHR");
+    }
 
     // ---- VK_KHR_pipeline_binary extension commands
-    table->CreatePipelineBinariesKHR = (PFN_vkCreatePipelineBinariesKHR)gdpa(dev, "vkCreatePipelineBinariesKHR");
-    table->DestroyPipelineBinaryKHR = (PFN_vkDestroyPipelineBinaryKHR)gdpa(dev, "vkDestroyPipelineBinaryKHR");
-    table->GetPipelineKeyKHR = (PFN_vkGetPipelineKeyKHR)gdpa(dev, "vkGetPipelineKeyKHR");
-    table->GetPipelineBinaryDataKHR = (PFN_vkGetPipelineBinaryDataKHR)gdpa(dev, "vkGetPipelineBinaryDataKHR");
-    table->ReleaseCapturedPipelineDataKHR = (PFN_vkReleaseCapturedPipelineDataKHR)gdpa(dev, "vkReleaseCapturedPipelineDataKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_pipeline_binary")) {
+        table->CreatePipelineBinariesKHR = (PFN_vkCreatePipelineBinariesKHR)gdpa(dev, "vkCreatePipelineBinariesKHR");
+        table->DestroyPipelineBinaryKHR = (PFN_vkDestroyPipelineBinaryKHR)gdpa(dev, "vkDestroyPipelineBinaryKHR");
+        table->GetPipelineKeyKHR = (PFN_vkGetPipelineKeyKHR)gdpa(dev, "vkGetPipelineKeyKHR");
+        table->GetPipelineBinaryDataKHR = (PFN_vkGetPipelineBinaryDataKHR)gdpa(dev, "vkGetPipelineBinaryDataKHR");
+        table->ReleaseCapturedPipelineDataKHR = (PFN_vkReleaseCapturedPipelineDataKHR)gdpa(dev, "vkReleaseCapturedPipelineDataKHR");
+    }
 
     // ---- VK_KHR_line_rasterization extension commands
-    table->CmdSetLineStippleKHR = (PFN_vkCmdSetLineStippleKHR)gdpa(dev, "vkCmdSetLineStippleKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_line_rasterization")) {
+        table->CmdSetLineStippleKHR = (PFN_vkCmdSetLineStippleKHR)gdpa(dev, "vkCmdSetLineStippleKHR");
+    }
 
     // ---- VK_KHR_calibrated_timestamps extension commands
-    table->GetCalibratedTimestampsKHR = (PFN_vkGetCalibratedTimestampsKHR)gdpa(dev, "vkGetCalibratedTimestampsKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_calibrated_timestamps")) {
+        table->GetCalibratedTimestampsKHR = (PFN_vkGetCalibratedTimestampsKHR)gdpa(dev, "vkGetCalibratedTimestampsKHR");
+    }
 
     // ---- VK_KHR_maintenance6 extension commands
-    table->CmdBindDescriptorSets2KHR = (PFN_vkCmdBindDescriptorSets2KHR)gdpa(dev, "vkCmdBindDescriptorSets2KHR");
-    table->CmdPushConstants2KHR = (PFN_vkCmdPushConstants2KHR)gdpa(dev, "vkCmdPushConstants2KHR");
-    table->CmdPushDescriptorSet2KHR = (PFN_vkCmdPushDescriptorSet2KHR)gdpa(dev, "vkCmdPushDescriptorSet2KHR");
-    table->CmdPushDescriptorSetWithTemplate2KHR = (PFN_vkCmdPushDescriptorSetWithTemplate2KHR)gdpa(dev, "vkCmdPushDescriptorSetWithTemplate2KHR");
-    table->CmdSetDescriptorBufferOffsets2EXT = (PFN_vkCmdSetDescriptorBufferOffsets2EXT)gdpa(dev, "vkCmdSetDescriptorBufferOffsets2EXT");
-    table->CmdBindDescriptorBufferEmbeddedSamplers2EXT = (PFN_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT)gdpa(dev, "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_maintenance6")) {
+        table->CmdBindDescriptorSets2KHR = (PFN_vkCmdBindDescriptorSets2KHR)gdpa(dev, "vkCmdBindDescriptorSets2KHR");
+        table->CmdPushConstants2KHR = (PFN_vkCmdPushConstants2KHR)gdpa(dev, "vkCmdPushConstants2KHR");
+        table->CmdPushDescriptorSet2KHR = (PFN_vkCmdPushDescriptorSet2KHR)gdpa(dev, "vkCmdPushDescriptorSet2KHR");
+        table->CmdPushDescriptorSetWithTemplate2KHR = (PFN_vkCmdPushDescriptorSetWithTemplate2KHR)gdpa(dev, "vkCmdPushDescriptorSetWithTemplate2KHR");
+        table->CmdSetDescriptorBufferOffsets2EXT = (PFN_vkCmdSetDescriptorBufferOffsets2EXT)gdpa(dev, "vkCmdSetDescriptorBufferOffsets2EXT");
+        table->CmdBindDescriptorBufferEmbeddedSamplers2EXT = (PFN_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT)gdpa(dev, "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT");
+    }
 
     // ---- VK_EXT_debug_marker extension commands
-    table->DebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT)gdpa(dev, "vkDebugMarkerSetObjectTagEXT");
-    table->DebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT)gdpa(dev, "vkDebugMarkerSetObjectNameEXT");
-    table->CmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT)gdpa(dev, "vkCmdDebugMarkerBeginEXT");
-    table->CmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT)gdpa(dev, "vkCmdDebugMarkerEndEXT");
-    table->CmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT)gdpa(dev, "vkCmdDebugMarkerInsertEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_debug_marker")) {
+        table->DebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT)gdpa(dev, "vkDebugMarkerSetObjectTagEXT");
+        table->DebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT)gdpa(dev, "vkDebugMarkerSetObjectNameEXT");
+        table->CmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT)gdpa(dev, "vkCmdDebugMarkerBeginEXT");
+        table->CmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT)gdpa(dev, "vkCmdDebugMarkerEndEXT");
+        table->CmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT)gdpa(dev, "vkCmdDebugMarkerInsertEXT");
+    }
 
     // ---- VK_EXT_transform_feedback extension commands
-    table->CmdBindTransformFeedbackBuffersEXT = (PFN_vkCmdBindTransformFeedbackBuffersEXT)gdpa(dev, "vkCmdBindTransformFeedbackBuffersEXT");
-    table->CmdBeginTransformFeedbackEXT = (PFN_vkCmdBeginTransformFeedbackEXT)gdpa(dev, "vkCmdBeginTransformFeedbackEXT");
-    table->CmdEndTransformFeedbackEXT = (PFN_vkCmdEndTransformFeedbackEXT)gdpa(dev, "vkCmdEndTransformFeedbackEXT");
-    table->CmdBeginQueryIndexedEXT = (PFN_vkCmdBeginQueryIndexedEXT)gdpa(dev, "vkCmdBeginQueryIndexedEXT");
-    table->CmdEndQueryIndexedEXT = (PFN_vkCmdEndQueryIndexedEXT)gdpa(dev, "vkCmdEndQueryIndexedEXT");
-    table->CmdDrawIndirectByteCountEXT = (PFN_vkCmdDrawIndirectByteCountEXT)gdpa(dev, "vkCmdDrawIndirectByteCountEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_transform_feedback")) {
+        table->CmdBindTransformFeedbackBuffersEXT = (PFN_vkCmdBindTransformFeedbackBuffersEXT)gdpa(dev, "vkCmdBindTransformFeedbackBuffersEXT");
+        table->CmdBeginTransformFeedbackEXT = (PFN_vkCmdBeginTransformFeedbackEXT)gdpa(dev, "vkCmdBeginTransformFeedbackEXT");
+        table->CmdEndTransformFeedbackEXT = (PFN_vkCmdEndTransformFeedbackEXT)gdpa(dev, "vkCmdEndTransformFeedbackEXT");
+        table->CmdBeginQueryIndexedEXT = (PFN_vkCmdBeginQueryIndexedEXT)gdpa(dev, "vkCmdBeginQueryIndexedEXT");
+        table->CmdEndQueryIndexedEXT = (PFN_vkCmdEndQueryIndexedEXT)gdpa(dev, "vkCmdEndQueryIndexedEXT");
+        table->CmdDrawIndirectByteCountEXT = (PFN_vkCmdDrawIndirectByteCountEXT)gdpa(dev, "vkCmdDrawIndirectByteCountEXT");
+    }
 
     // ---- VK_NVX_binary_import extension commands
-    table->CreateCuModuleNVX = (PFN_vkCreateCuModuleNVX)gdpa(dev, "vkCreateCuModuleNVX");
-    table->CreateCuFunctionNVX = (PFN_vkCreateCuFunctionNVX)gdpa(dev, "vkCreateCuFunctionNVX");
-    table->DestroyCuModuleNVX = (PFN_vkDestroyCuModuleNVX)gdpa(dev, "vkDestroyCuModuleNVX");
-    table->DestroyCuFunctionNVX = (PFN_vkDestroyCuFunctionNVX)gdpa(dev, "vkDestroyCuFunctionNVX");
-    table->CmdCuLaunchKernelNVX = (PFN_vkCmdCuLaunchKernelNVX)gdpa(dev, "vkCmdCuLaunchKernelNVX");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NVX_binary_import")) {
+        table->CreateCuModuleNVX = (PFN_vkCreateCuModuleNVX)gdpa(dev, "vkCreateCuModuleNVX");
+        table->CreateCuFunctionNVX = (PFN_vkCreateCuFunctionNVX)gdpa(dev, "vkCreateCuFunctionNVX");
+        table->DestroyCuModuleNVX = (PFN_vkDestroyCuModuleNVX)gdpa(dev, "vkDestroyCuModuleNVX");
+        table->DestroyCuFunctionNVX = (PFN_vkDestroyCuFunctionNVX)gdpa(dev, "vkDestroyCuFunctionNVX");
+        table->CmdCuLaunchKernelNVX = (PFN_vkCmdCuLaunchKernelNVX)gdpa(dev, "vkCmdCuLaunchKernelNVX");
+    }
 
     // ---- VK_NVX_image_view_handle extension commands
-    table->GetImageViewHandleNVX = (PFN_vkGetImageViewHandleNVX)gdpa(dev, "vkGetImageViewHandleNVX");
-    table->GetImageViewHandle64NVX = (PFN_vkGetImageViewHandle64NVX)gdpa(dev, "vkGetImageViewHandle64NVX");
-    table->GetImageViewAddressNVX = (PFN_vkGetImageViewAddressNVX)gdpa(dev, "vkGetImageViewAddressNVX");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NVX_image_view_handle")) {
+        table->GetImageViewHandleNVX = (PFN_vkGetImageViewHandleNVX)gdpa(dev, "vkGetImageViewHandleNVX");
+        table->GetImageViewHandle64NVX = (PFN_vkGetImageViewHandle64NVX)gdpa(dev, "vkGetImageViewHandle64NVX");
+        table->GetImageViewAddressNVX = (PFN_vkGetImageViewAddressNVX)gdpa(dev, "vkGetImageViewAddressNVX");
+    }
 
     // ---- VK_AMD_draw_indirect_count extension commands
-    table->CmdDrawIndirectCountAMD = (PFN_vkCmdDrawIndirectCountAMD)gdpa(dev, "vkCmdDrawIndirectCountAMD");
-    table->CmdDrawIndexedIndirectCountAMD = (PFN_vkCmdDrawIndexedIndirectCountAMD)gdpa(dev, "vkCmdDrawIndexedIndirectCountAMD");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_AMD_draw_indirect_count")) {
+        table->CmdDrawIndirectCountAMD = (PFN_vkCmdDrawIndirectCountAMD)gdpa(dev, "vkCmdDrawIndirectCountAMD");
+        table->CmdDrawIndexedIndirectCountAMD = (PFN_vkCmdDrawIndexedIndirectCountAMD)gdpa(dev, "vkCmdDrawIndexedIndirectCountAMD");
+    }
 
     // ---- VK_AMD_shader_info extension commands
-    table->GetShaderInfoAMD = (PFN_vkGetShaderInfoAMD)gdpa(dev, "vkGetShaderInfoAMD");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_AMD_shader_info")) {
+        table->GetShaderInfoAMD = (PFN_vkGetShaderInfoAMD)gdpa(dev, "vkGetShaderInfoAMD");
+    }
 
     // ---- VK_NV_external_memory_win32 extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_external_memory_win32")) {
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    table->GetMemoryWin32HandleNV = (PFN_vkGetMemoryWin32HandleNV)gdpa(dev, "vkGetMemoryWin32HandleNV");
+        table->GetMemoryWin32HandleNV = (PFN_vkGetMemoryWin32HandleNV)gdpa(dev, "vkGetMemoryWin32HandleNV");
 #endif // VK_USE_PLATFORM_WIN32_KHR
+    }
 
     // ---- VK_EXT_conditional_rendering extension commands
-    table->CmdBeginConditionalRenderingEXT = (PFN_vkCmdBeginConditionalRenderingEXT)gdpa(dev, "vkCmdBeginConditionalRenderingEXT");
-    table->CmdEndConditionalRenderingEXT = (PFN_vkCmdEndConditionalRenderingEXT)gdpa(dev, "vkCmdEndConditionalRenderingEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_conditional_rendering")) {
+        table->CmdBeginConditionalRenderingEXT = (PFN_vkCmdBeginConditionalRenderingEXT)gdpa(dev, "vkCmdBeginConditionalRenderingEXT");
+        table->CmdEndConditionalRenderingEXT = (PFN_vkCmdEndConditionalRenderingEXT)gdpa(dev, "vkCmdEndConditionalRenderingEXT");
+    }
 
     // ---- VK_NV_clip_space_w_scaling extension commands
-    table->CmdSetViewportWScalingNV = (PFN_vkCmdSetViewportWScalingNV)gdpa(dev, "vkCmdSetViewportWScalingNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_clip_space_w_scaling")) {
+        table->CmdSetViewportWScalingNV = (PFN_vkCmdSetViewportWScalingNV)gdpa(dev, "vkCmdSetViewportWScalingNV");
+    }
 
     // ---- VK_EXT_display_control extension commands
-    table->DisplayPowerControlEXT = (PFN_vkDisplayPowerControlEXT)gdpa(dev, "vkDisplayPowerControlEXT");
-    table->RegisterDeviceEventEXT = (PFN_vkRegisterDeviceEventEXT)gdpa(dev, "vkRegisterDeviceEventEXT");
-    table->RegisterDisplayEventEXT = (PFN_vkRegisterDisplayEventEXT)gdpa(dev, "vkRegisterDisplayEventEXT");
-    table->GetSwapchainCounterEXT = (PFN_vkGetSwapchainCounterEXT)gdpa(dev, "vkGetSwapchainCounterEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_display_control")) {
+        table->DisplayPowerControlEXT = (PFN_vkDisplayPowerControlEXT)gdpa(dev, "vkDisplayPowerControlEXT");
+        table->RegisterDeviceEventEXT = (PFN_vkRegisterDeviceEventEXT)gdpa(dev, "vkRegisterDeviceEventEXT");
+        table->RegisterDisplayEventEXT = (PFN_vkRegisterDisplayEventEXT)gdpa(dev, "vkRegisterDisplayEventEXT");
+        table->GetSwapchainCounterEXT = (PFN_vkGetSwapchainCounterEXT)gdpa(dev, "vkGetSwapchainCounterEXT");
+    }
 
     // ---- VK_GOOGLE_display_timing extension commands
-    table->GetRefreshCycleDurationGOOGLE = (PFN_vkGetRefreshCycleDurationGOOGLE)gdpa(dev, "vkGetRefreshCycleDurationGOOGLE");
-    table->GetPastPresentationTimingGOOGLE = (PFN_vkGetPastPresentationTimingGOOGLE)gdpa(dev, "vkGetPastPresentationTimingGOOGLE");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_GOOGLE_display_timing")) {
+        table->GetRefreshCycleDurationGOOGLE = (PFN_vkGetRefreshCycleDurationGOOGLE)gdpa(dev, "vkGetRefreshCycleDurationGOOGLE");
+        table->GetPastPresentationTimingGOOGLE = (PFN_vkGetPastPresentationTimingGOOGLE)gdpa(dev, "vkGetPastPresentationTimingGOOGLE");
+    }
 
     // ---- VK_EXT_discard_rectangles extension commands
-    table->CmdSetDiscardRectangleEXT = (PFN_vkCmdSetDiscardRectangleEXT)gdpa(dev, "vkCmdSetDiscardRectangleEXT");
-    table->CmdSetDiscardRectangleEnableEXT = (PFN_vkCmdSetDiscardRectangleEnableEXT)gdpa(dev, "vkCmdSetDiscardRectangleEnableEXT");
-    table->CmdSetDiscardRectangleModeEXT = (PFN_vkCmdSetDiscardRectangleModeEXT)gdpa(dev, "vkCmdSetDiscardRectangleModeEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_discard_rectangles")) {
+        table->CmdSetDiscardRectangleEXT = (PFN_vkCmdSetDiscardRectangleEXT)gdpa(dev, "vkCmdSetDiscardRectangleEXT");
+        table->CmdSetDiscardRectangleEnableEXT = (PFN_vkCmdSetDiscardRectangleEnableEXT)gdpa(dev, "vkCmdSetDiscardRectangleEnableEXT");
+        table->CmdSetDiscardRectangleModeEXT = (PFN_vkCmdSetDiscardRectangleModeEXT)gdpa(dev, "vkCmdSetDiscardRectangleModeEXT");
+    }
 
     // ---- VK_EXT_hdr_metadata extension commands
-    table->SetHdrMetadataEXT = (PFN_vkSetHdrMetadataEXT)gdpa(dev, "vkSetHdrMetadataEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_hdr_metadata")) {
+        table->SetHdrMetadataEXT = (PFN_vkSetHdrMetadataEXT)gdpa(dev, "vkSetHdrMetadataEXT");
+    }
 
     // ---- VK_EXT_debug_utils extension commands
     table->SetDebugUtilsObjectNameEXT = (PFN_vkSetDebugUtilsObjectNameEXT)gipa(inst, "vkSetDebugUtilsObjectNameEXT");
@@ -845,454 +989,592 @@ VKAPI_ATTR void VKAPI_CALL loader_init_device_extension_dispatch_table(struct lo
     table->CmdInsertDebugUtilsLabelEXT = (PFN_vkCmdInsertDebugUtilsLabelEXT)gipa(inst, "vkCmdInsertDebugUtilsLabelEXT");
 
     // ---- VK_ANDROID_external_memory_android_hardware_buffer extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_ANDROID_external_memory_android_hardware_buffer")) {
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
-    table->GetAndroidHardwareBufferPropertiesANDROID = (PFN_vkGetAndroidHardwareBufferPropertiesANDROID)gdpa(dev, "vkGetAndroidHardwareBufferPropertiesANDROID");
+        table->GetAndroidHardwareBufferPropertiesANDROID = (PFN_vkGetAndroidHardwareBufferPropertiesANDROID)gdpa(dev, "vkGetAndroidHardwareBufferPropertiesANDROID");
 #endif // VK_USE_PLATFORM_ANDROID_KHR
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
-    table->GetMemoryAndroidHardwareBufferANDROID = (PFN_vkGetMemoryAndroidHardwareBufferANDROID)gdpa(dev, "vkGetMemoryAndroidHardwareBufferANDROID");
+        table->GetMemoryAndroidHardwareBufferANDROID = (PFN_vkGetMemoryAndroidHardwareBufferANDROID)gdpa(dev, "vkGetMemoryAndroidHardwareBufferANDROID");
 #endif // VK_USE_PLATFORM_ANDROID_KHR
+    }
 
     // ---- VK_AMDX_shader_enqueue extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_AMDX_shader_enqueue")) {
 #if defined(VK_ENABLE_BETA_EXTENSIONS)
-    table->CreateExecutionGraphPipelinesAMDX = (PFN_vkCreateExecutionGraphPipelinesAMDX)gdpa(dev, "vkCreateExecutionGraphPipelinesAMDX");
+        table->CreateExecutionGraphPipelinesAMDX = (PFN_vkCreateExecutionGraphPipelinesAMDX)gdpa(dev, "vkCreateExecutionGraphPipelinesAMDX");
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #if defined(VK_ENABLE_BETA_EXTENSIONS)
-    table->GetExecutionGraphPipelineScratchSizeAMDX = (PFN_vkGetExecutionGraphPipelineScratchSizeAMDX)gdpa(dev, "vkGetExecutionGraphPipelineScratchSizeAMDX");
+        table->GetExecutionGraphPipelineScratchSizeAMDX = (PFN_vkGetExecutionGraphPipelineScratchSizeAMDX)gdpa(dev, "vkGetExecutionGraphPipelineScratchSizeAMDX");
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #if defined(VK_ENABLE_BETA_EXTENSIONS)
-    table->GetExecutionGraphPipelineNodeIndexAMDX = (PFN_vkGetExecutionGraphPipelineNodeIndexAMDX)gdpa(dev, "vkGetExecutionGraphPipelineNodeIndexAMDX");
+        table->GetExecutionGraphPipelineNodeIndexAMDX = (PFN_vkGetExecutionGraphPipelineNodeIndexAMDX)gdpa(dev, "vkGetExecutionGraphPipelineNodeIndexAMDX");
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #if defined(VK_ENABLE_BETA_EXTENSIONS)
-    table->CmdInitializeGraphScratchMemoryAMDX = (PFN_vkCmdInitializeGraphScratchMemoryAMDX)gdpa(dev, "vkCmdInitializeGraphScratchMemoryAMDX");
+        table->CmdInitializeGraphScratchMemoryAMDX = (PFN_vkCmdInitializeGraphScratchMemoryAMDX)gdpa(dev, "vkCmdInitializeGraphScratchMemoryAMDX");
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #if defined(VK_ENABLE_BETA_EXTENSIONS)
-    table->CmdDispatchGraphAMDX = (PFN_vkCmdDispatchGraphAMDX)gdpa(dev, "vkCmdDispatchGraphAMDX");
+        table->CmdDispatchGraphAMDX = (PFN_vkCmdDispatchGraphAMDX)gdpa(dev, "vkCmdDispatchGraphAMDX");
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #if defined(VK_ENABLE_BETA_EXTENSIONS)
-    table->CmdDispatchGraphIndirectAMDX = (PFN_vkCmdDispatchGraphIndirectAMDX)gdpa(dev, "vkCmdDispatchGraphIndirectAMDX");
+        table->CmdDispatchGraphIndirectAMDX = (PFN_vkCmdDispatchGraphIndirectAMDX)gdpa(dev, "vkCmdDispatchGraphIndirectAMDX");
 #endif // VK_ENABLE_BETA_EXTENSIONS
 #if defined(VK_ENABLE_BETA_EXTENSIONS)
-    table->CmdDispatchGraphIndirectCountAMDX = (PFN_vkCmdDispatchGraphIndirectCountAMDX)gdpa(dev, "vkCmdDispatchGraphIndirectCountAMDX");
+        table->CmdDispatchGraphIndirectCountAMDX = (PFN_vkCmdDispatchGraphIndirectCountAMDX)gdpa(dev, "vkCmdDispatchGraphIndirectCountAMDX");
 #endif // VK_ENABLE_BETA_EXTENSIONS
+    }
 
     // ---- VK_EXT_sample_locations extension commands
-    table->CmdSetSampleLocationsEXT = (PFN_vkCmdSetSampleLocationsEXT)gdpa(dev, "vkCmdSetSampleLocationsEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_sample_locations")) {
+        table->CmdSetSampleLocationsEXT = (PFN_vkCmdSetSampleLocationsEXT)gdpa(dev, "vkCmdSetSampleLocationsEXT");
+    }
 
     // ---- VK_EXT_image_drm_format_modifier extension commands
-    table->GetImageDrmFormatModifierPropertiesEXT = (PFN_vkGetImageDrmFormatModifierPropertiesEXT)gdpa(dev, "vkGetImageDrmFormatModifierPropertiesEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_image_drm_format_modifier")) {
+        table->GetImageDrmFormatModifierPropertiesEXT = (PFN_vkGetImageDrmFormatModifierPropertiesEXT)gdpa(dev, "vkGetImageDrmFormatModifierPropertiesEXT");
+    }
 
     // ---- VK_EXT_validation_cache extension commands
-    table->CreateValidationCacheEXT = (PFN_vkCreateValidationCacheEXT)gdpa(dev, "vkCreateValidationCacheEXT");
-    table->DestroyValidationCacheEXT = (PFN_vkDestroyValidationCacheEXT)gdpa(dev, "vkDestroyValidationCacheEXT");
-    table->MergeValidationCachesEXT = (PFN_vkMergeValidationCachesEXT)gdpa(dev, "vkMergeValidationCachesEXT");
-    table->GetValidationCacheDataEXT = (PFN_vkGetValidationCacheDataEXT)gdpa(dev, "vkGetValidationCacheDataEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_validation_cache")) {
+        table->CreateValidationCacheEXT = (PFN_vkCreateValidationCacheEXT)gdpa(dev, "vkCreateValidationCacheEXT");
+        table->DestroyValidationCacheEXT = (PFN_vkDestroyValidationCacheEXT)gdpa(dev, "vkDestroyValidationCacheEXT");
+        table->MergeValidationCachesEXT = (PFN_vkMergeValidationCachesEXT)gdpa(dev, "vkMergeValidationCachesEXT");
+        table->GetValidationCacheDataEXT = (PFN_vkGetValidationCacheDataEXT)gdpa(dev, "vkGetValidationCacheDataEXT");
+    }
 
     // ---- VK_NV_shading_rate_image extension commands
-    table->CmdBindShadingRateImageNV = (PFN_vkCmdBindShadingRateImageNV)gdpa(dev, "vkCmdBindShadingRateImageNV");
-    table->CmdSetViewportShadingRatePaletteNV = (PFN_vkCmdSetViewportShadingRatePaletteNV)gdpa(dev, "vkCmdSetViewportShadingRatePaletteNV");
-    table->CmdSetCoarseSampleOrderNV = (PFN_vkCmdSetCoarseSampleOrderNV)gdpa(dev, "vkCmdSetCoarseSampleOrderNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_shading_rate_image")) {
+        table->CmdBindShadingRateImageNV = (PFN_vkCmdBindShadingRateImageNV)gdpa(dev, "vkCmdBindShadingRateImageNV");
+        table->CmdSetViewportShadingRatePaletteNV = (PFN_vkCmdSetViewportShadingRatePaletteNV)gdpa(dev, "vkCmdSetViewportShadingRatePaletteNV");
+        table->CmdSetCoarseSampleOrderNV = (PFN_vkCmdSetCoarseSampleOrderNV)gdpa(dev, "vkCmdSetCoarseSampleOrderNV");
+    }
 
     // ---- VK_NV_ray_tracing extension commands
-    table->CreateAccelerationStructureNV = (PFN_vkCreateAccelerationStructureNV)gdpa(dev, "vkCreateAccelerationStructureNV");
-    table->DestroyAccelerationStructureNV = (PFN_vkDestroyAccelerationStructureNV)gdpa(dev, "vkDestroyAccelerationStructureNV");
-    table->GetAccelerationStructureMemoryRequirementsNV = (PFN_vkGetAccelerationStructureMemoryRequirementsNV)gdpa(dev, "vkGetAccelerationStructureMemoryRequirementsNV");
-    table->BindAccelerationStructureMemoryNV = (PFN_vkBindAccelerationStructureMemoryNV)gdpa(dev, "vkBindAccelerationStructureMemoryNV");
-    table->CmdBuildAccelerationStructureNV = (PFN_vkCmdBuildAccelerationStructureNV)gdpa(dev, "vkCmdBuildAccelerationStructureNV");
-    table->CmdCopyAccelerationStructureNV = (PFN_vkCmdCopyAccelerationStructureNV)gdpa(dev, "vkCmdCopyAccelerationStructureNV");
-    table->CmdTraceRaysNV = (PFN_vkCmdTraceRaysNV)gdpa(dev, "vkCmdTraceRaysNV");
-    table->CreateRayTracingPipelinesNV = (PFN_vkCreateRayTracingPipelinesNV)gdpa(dev, "vkCreateRayTracingPipelinesNV");
-    table->GetRayTracingShaderGroupHandlesKHR = (PFN_vkGetRayTracingShaderGroupHandlesKHR)gdpa(dev, "vkGetRayTracingShaderGroupHandlesKHR");
-    table->GetRayTracingShaderGroupHandlesNV = (PFN_vkGetRayTracingShaderGroupHandlesNV)gdpa(dev, "vkGetRayTracingShaderGroupHandlesNV");
-    table->GetAccelerationStructureHandleNV = (PFN_vkGetAccelerationStructureHandleNV)gdpa(dev, "vkGetAccelerationStructureHandleNV");
-    table->CmdWriteAccelerationStructuresPropertiesNV = (PFN_vkCmdWriteAccelerationStructuresPropertiesNV)gdpa(dev, "vkCmdWriteAccelerationStructuresPropertiesNV");
-    table->CompileDeferredNV = (PFN_vkCompileDeferredNV)gdpa(dev, "vkCompileDeferredNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_ray_tracing")) {
+        table->CreateAccelerationStructureNV = (PFN_vkCreateAccelerationStructureNV)gdpa(dev, "vkCreateAccelerationStructureNV");
+        table->DestroyAccelerationStructureNV = (PFN_vkDestroyAccelerationStructureNV)gdpa(dev, "vkDestroyAccelerationStructureNV");
+        table->GetAccelerationStructureMemoryRequirementsNV = (PFN_vkGetAccelerationStructureMemoryRequirementsNV)gdpa(dev, "vkGetAccelerationStructureMemoryRequirementsNV");
+        table->BindAccelerationStructureMemoryNV = (PFN_vkBindAccelerationStructureMemoryNV)gdpa(dev, "vkBindAccelerationStructureMemoryNV");
+        table->CmdBuildAccelerationStructureNV = (PFN_vkCmdBuildAccelerationStructureNV)gdpa(dev, "vkCmdBuildAccelerationStructureNV");
+        table->CmdCopyAccelerationStructureNV = (PFN_vkCmdCopyAccelerationStructureNV)gdpa(dev, "vkCmdCopyAccelerationStructureNV");
+        table->CmdTraceRaysNV = (PFN_vkCmdTraceRaysNV)gdpa(dev, "vkCmdTraceRaysNV");
+        table->CreateRayTracingPipelinesNV = (PFN_vkCreateRayTracingPipelinesNV)gdpa(dev, "vkCreateRayTracingPipelinesNV");
+        table->GetRayTracingShaderGroupHandlesKHR = (PFN_vkGetRayTracingShaderGroupHandlesKHR)gdpa(dev, "vkGetRayTracingShaderGroupHandlesKHR");
+        table->GetRayTracingShaderGroupHandlesNV = (PFN_vkGetRayTracingShaderGroupHandlesNV)gdpa(dev, "vkGetRayTracingShaderGroupHandlesNV");
+        table->GetAccelerationStructureHandleNV = (PFN_vkGetAccelerationStructureHandleNV)gdpa(dev, "vkGetAccelerationStructureHandleNV");
+        table->CmdWriteAccelerationStructuresPropertiesNV = (PFN_vkCmdWriteAccelerationStructuresPropertiesNV)gdpa(dev, "vkCmdWriteAccelerationStructuresPropertiesNV");
+        table->CompileDeferredNV = (PFN_vkCompileDeferredNV)gdpa(dev, "vkCompileDeferredNV");
+    }
 
     // ---- VK_EXT_external_memory_host extension commands
-    table->GetMemoryHostPointerPropertiesEXT = (PFN_vkGetMemoryHostPointerPropertiesEXT)gdpa(dev, "vkGetMemoryHostPointerPropertiesEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_external_memory_host")) {
+        table->GetMemoryHostPointerPropertiesEXT = (PFN_vkGetMemoryHostPointerPropertiesEXT)gdpa(dev, "vkGetMemoryHostPointerPropertiesEXT");
+    }
 
     // ---- VK_AMD_buffer_marker extension commands
-    table->CmdWriteBufferMarkerAMD = (PFN_vkCmdWriteBufferMarkerAMD)gdpa(dev, "vkCmdWriteBufferMarkerAMD");
-    table->CmdWriteBufferMarker2AMD = (PFN_vkCmdWriteBufferMarker2AMD)gdpa(dev, "vkCmdWriteBufferMarker2AMD");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_AMD_buffer_marker")) {
+        table->CmdWriteBufferMarkerAMD = (PFN_vkCmdWriteBufferMarkerAMD)gdpa(dev, "vkCmdWriteBufferMarkerAMD");
+        table->CmdWriteBufferMarker2AMD = (PFN_vkCmdWriteBufferMarker2AMD)gdpa(dev, "vkCmdWriteBufferMarker2AMD");
+    }
 
     // ---- VK_EXT_calibrated_timestamps extension commands
-    table->GetCalibratedTimestampsEXT = (PFN_vkGetCalibratedTimestampsEXT)gdpa(dev, "vkGetCalibratedTimestampsEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_calibrated_timestamps")) {
+        table->GetCalibratedTimestampsEXT = (PFN_vkGetCalibratedTimestampsEXT)gdpa(dev, "vkGetCalibratedTimestampsEXT");
+    }
 
     // ---- VK_NV_mesh_shader extension commands
-    table->CmdDrawMeshTasksNV = (PFN_vkCmdDrawMeshTasksNV)gdpa(dev, "vkCmdDrawMeshTasksNV");
-    table->CmdDrawMeshTasksIndirectNV = (PFN_vkCmdDrawMeshTasksIndirectNV)gdpa(dev, "vkCmdDrawMeshTasksIndirectNV");
-    table->CmdDrawMeshTasksIndirectCountNV = (PFN_vkCmdDrawMeshTasksIndirectCountNV)gdpa(dev, "vkCmdDrawMeshTasksIndirectCountNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_mesh_shader")) {
+        table->CmdDrawMeshTasksNV = (PFN_vkCmdDrawMeshTasksNV)gdpa(dev, "vkCmdDrawMeshTasksNV");
+        table->CmdDrawMeshTasksIndirectNV = (PFN_vkCmdDrawMeshTasksIndirectNV)gdpa(dev, "vkCmdDrawMeshTasksIndirectNV");
+        table->CmdDrawMeshTasksIndirectCountNV = (PFN_vkCmdDrawMeshTasksIndirectCountNV)gdpa(dev, "vkCmdDrawMeshTasksIndirectCountNV");
+    }
 
     // ---- VK_NV_scissor_exclusive extension commands
-    table->CmdSetExclusiveScissorEnableNV = (PFN_vkCmdSetExclusiveScissorEnableNV)gdpa(dev, "vkCmdSetExclusiveScissorEnableNV");
-    table->CmdSetExclusiveScissorNV = (PFN_vkCmdSetExclusiveScissorNV)gdpa(dev, "vkCmdSetExclusiveScissorNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_scissor_exclusive")) {
+        table->CmdSetExclusiveScissorEnableNV = (PFN_vkCmdSetExclusiveScissorEnableNV)gdpa(dev, "vkCmdSetExclusiveScissorEnableNV");
+        table->CmdSetExclusiveScissorNV = (PFN_vkCmdSetExclusiveScissorNV)gdpa(dev, "vkCmdSetExclusiveScissorNV");
+    }
 
     // ---- VK_NV_device_diagnostic_checkpoints extension commands
-    table->CmdSetCheckpointNV = (PFN_vkCmdSetCheckpointNV)gdpa(dev, "vkCmdSetCheckpointNV");
-    table->GetQueueCheckpointDataNV = (PFN_vkGetQueueCheckpointDataNV)gdpa(dev, "vkGetQueueCheckpointDataNV");
-    table->GetQueueCheckpointData2NV = (PFN_vkGetQueueCheckpointData2NV)gdpa(dev, "vkGetQueueCheckpointData2NV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_device_diagnostic_checkpoints")) {
+        table->CmdSetCheckpointNV = (PFN_vkCmdSetCheckpointNV)gdpa(dev, "vkCmdSetCheckpointNV");
+        table->GetQueueCheckpointDataNV = (PFN_vkGetQueueCheckpointDataNV)gdpa(dev, "vkGetQueueCheckpointDataNV");
+        table->GetQueueCheckpointData2NV = (PFN_vkGetQueueCheckpointData2NV)gdpa(dev, "vkGetQueueCheckpointData2NV");
+    }
 
     // ---- VK_INTEL_performance_query extension commands
-    table->InitializePerformanceApiINTEL = (PFN_vkInitializePerformanceApiINTEL)gdpa(dev, "vkInitializePerformanceApiINTEL");
-    table->UninitializePerformanceApiINTEL = (PFN_vkUninitializePerformanceApiINTEL)gdpa(dev, "vkUninitializePerformanceApiINTEL");
-    table->CmdSetPerformanceMarkerINTEL = (PFN_vkCmdSetPerformanceMarkerINTEL)gdpa(dev, "vkCmdSetPerformanceMarkerINTEL");
-    table->CmdSetPerformanceStreamMarkerINTEL = (PFN_vkCmdSetPerformanceStreamMarkerINTEL)gdpa(dev, "vkCmdSetPerformanceStreamMarkerINTEL");
-    table->CmdSetPerformanceOverrideINTEL = (PFN_vkCmdSetPerformanceOverrideINTEL)gdpa(dev, "vkCmdSetPerformanceOverrideINTEL");
-    table->AcquirePerformanceConfigurationINTEL = (PFN_vkAcquirePerformanceConfigurationINTEL)gdpa(dev, "vkAcquirePerformanceConfigurationINTEL");
-    table->ReleasePerformanceConfigurationINTEL = (PFN_vkReleasePerformanceConfigurationINTEL)gdpa(dev, "vkReleasePerformanceConfigurationINTEL");
-    table->QueueSetPerformanceConfigurationINTEL = (PFN_vkQueueSetPerformanceConfigurationINTEL)gdpa(dev, "vkQueueSetPerformanceConfigurationINTEL");
-    table->GetPerformanceParameterINTEL = (PFN_vkGetPerformanceParameterINTEL)gdpa(dev, "vkGetPerformanceParameterINTEL");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_INTEL_performance_query")) {
+        table->InitializePerformanceApiINTEL = (PFN_vkInitializePerformanceApiINTEL)gdpa(dev, "vkInitializePerformanceApiINTEL");
+        table->UninitializePerformanceApiINTEL = (PFN_vkUninitializePerformanceApiINTEL)gdpa(dev, "vkUninitializePerformanceApiINTEL");
+        table->CmdSetPerformanceMarkerINTEL = (PFN_vkCmdSetPerformanceMarkerINTEL)gdpa(dev, "vkCmdSetPerformanceMarkerINTEL");
+        table->CmdSetPerformanceStreamMarkerINTEL = (PFN_vkCmdSetPerformanceStreamMarkerINTEL)gdpa(dev, "vkCmdSetPerformanceStreamMarkerINTEL");
+        table->CmdSetPerformanceOverrideINTEL = (PFN_vkCmdSetPerformanceOverrideINTEL)gdpa(dev, "vkCmdSetPerformanceOverrideINTEL");
+        table->AcquirePerformanceConfigurationINTEL = (PFN_vkAcquirePerformanceConfigurationINTEL)gdpa(dev, "vkAcquirePerformanceConfigurationINTEL");
+        table->ReleasePerformanceConfigurationINTEL = (PFN_vkReleasePerformanceConfigurationINTEL)gdpa(dev, "vkReleasePerformanceConfigurationINTEL");
+        table->QueueSetPerformanceConfigurationINTEL = (PFN_vkQueueSetPerformanceConfigurationINTEL)gdpa(dev, "vkQueueSetPerformanceConfigurationINTEL");
+        table->GetPerformanceParameterINTEL = (PFN_vkGetPerformanceParameterINTEL)gdpa(dev, "vkGetPerformanceParameterINTEL");
+    }
 
     // ---- VK_AMD_display_native_hdr extension commands
-    table->SetLocalDimmingAMD = (PFN_vkSetLocalDimmingAMD)gdpa(dev, "vkSetLocalDimmingAMD");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_AMD_display_native_hdr")) {
+        table->SetLocalDimmingAMD = (PFN_vkSetLocalDimmingAMD)gdpa(dev, "vkSetLocalDimmingAMD");
+    }
 
     // ---- VK_EXT_buffer_device_address extension commands
-    table->GetBufferDeviceAddressEXT = (PFN_vkGetBufferDeviceAddressEXT)gdpa(dev, "vkGetBufferDeviceAddressEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_buffer_device_address")) {
+        table->GetBufferDeviceAddressEXT = (PFN_vkGetBufferDeviceAddressEXT)gdpa(dev, "vkGetBufferDeviceAddressEXT");
+    }
 
     // ---- VK_EXT_full_screen_exclusive extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_full_screen_exclusive")) {
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    table->AcquireFullScreenExclusiveModeEXT = (PFN_vkAcquireFullScreenExclusiveModeEXT)gdpa(dev, "vkAcquireFullScreenExclusiveModeEXT");
+        table->AcquireFullScreenExclusiveModeEXT = (PFN_vkAcquireFullScreenExclusiveModeEXT)gdpa(dev, "vkAcquireFullScreenExclusiveModeEXT");
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    table->ReleaseFullScreenExclusiveModeEXT = (PFN_vkReleaseFullScreenExclusiveModeEXT)gdpa(dev, "vkReleaseFullScreenExclusiveModeEXT");
+        table->ReleaseFullScreenExclusiveModeEXT = (PFN_vkReleaseFullScreenExclusiveModeEXT)gdpa(dev, "vkReleaseFullScreenExclusiveModeEXT");
 #endif // VK_USE_PLATFORM_WIN32_KHR
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-    table->GetDeviceGroupSurfacePresentModes2EXT = (PFN_vkGetDeviceGroupSurfacePresentModes2EXT)gdpa(dev, "vkGetDeviceGroupSurfacePresentModes2EXT");
+        table->GetDeviceGroupSurfacePresentModes2EXT = (PFN_vkGetDeviceGroupSurfacePresentModes2EXT)gdpa(dev, "vkGetDeviceGroupSurfacePresentModes2EXT");
 #endif // VK_USE_PLATFORM_WIN32_KHR
+    }
 
     // ---- VK_EXT_line_rasterization extension commands
-    table->CmdSetLineStippleEXT = (PFN_vkCmdSetLineStippleEXT)gdpa(dev, "vkCmdSetLineStippleEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_line_rasterization")) {
+        table->CmdSetLineStippleEXT = (PFN_vkCmdSetLineStippleEXT)gdpa(dev, "vkCmdSetLineStippleEXT");
+    }
 
     // ---- VK_EXT_host_query_reset extension commands
-    table->ResetQueryPoolEXT = (PFN_vkResetQueryPoolEXT)gdpa(dev, "vkResetQueryPoolEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_host_query_reset")) {
+        table->ResetQueryPoolEXT = (PFN_vkResetQueryPoolEXT)gdpa(dev, "vkResetQueryPoolEXT");
+    }
 
     // ---- VK_EXT_extended_dynamic_state extension commands
-    table->CmdSetCullModeEXT = (PFN_vkCmdSetCullModeEXT)gdpa(dev, "vkCmdSetCullModeEXT");
-    table->CmdSetFrontFaceEXT = (PFN_vkCmdSetFrontFaceEXT)gdpa(dev, "vkCmdSetFrontFaceEXT");
-    table->CmdSetPrimitiveTopologyEXT = (PFN_vkCmdSetPrimitiveTopologyEXT)gdpa(dev, "vkCmdSetPrimitiveTopologyEXT");
-    table->CmdSetViewportWithCountEXT = (PFN_vkCmdSetViewportWithCountEXT)gdpa(dev, "vkCmdSetViewportWithCountEXT");
-    table->CmdSetScissorWithCountEXT = (PFN_vkCmdSetScissorWithCountEXT)gdpa(dev, "vkCmdSetScissorWithCountEXT");
-    table->CmdBindVertexBuffers2EXT = (PFN_vkCmdBindVertexBuffers2EXT)gdpa(dev, "vkCmdBindVertexBuffers2EXT");
-    table->CmdSetDepthTestEnableEXT = (PFN_vkCmdSetDepthTestEnableEXT)gdpa(dev, "vkCmdSetDepthTestEnableEXT");
-    table->CmdSetDepthWriteEnableEXT = (PFN_vkCmdSetDepthWriteEnableEXT)gdpa(dev, "vkCmdSetDepthWriteEnableEXT");
-    table->CmdSetDepthCompareOpEXT = (PFN_vkCmdSetDepthCompareOpEXT)gdpa(dev, "vkCmdSetDepthCompareOpEXT");
-    table->CmdSetDepthBoundsTestEnableEXT = (PFN_vkCmdSetDepthBoundsTestEnableEXT)gdpa(dev, "vkCmdSetDepthBoundsTestEnableEXT");
-    table->CmdSetStencilTestEnableEXT = (PFN_vkCmdSetStencilTestEnableEXT)gdpa(dev, "vkCmdSetStencilTestEnableEXT");
-    table->CmdSetStencilOpEXT = (PFN_vkCmdSetStencilOpEXT)gdpa(dev, "vkCmdSetStencilOpEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_extended_dynamic_state") || loader_device_extension_enabled(pCreateInfo, "VK_EXT_shader_object")) {
+        table->CmdSetCullModeEXT = (PFN_vkCmdSetCullModeEXT)gdpa(dev, "vkCmdSetCullModeEXT");
+        table->CmdSetFrontFaceEXT = (PFN_vkCmdSetFrontFaceEXT)gdpa(dev, "vkCmdSetFrontFaceEXT");
+        table->CmdSetPrimitiveTopologyEXT = (PFN_vkCmdSetPrimitiveTopologyEXT)gdpa(dev, "vkCmdSetPrimitiveTopologyEXT");
+        table->CmdSetViewportWithCountEXT = (PFN_vkCmdSetViewportWithCountEXT)gdpa(dev, "vkCmdSetViewportWithCountEXT");
+        table->CmdSetScissorWithCountEXT = (PFN_vkCmdSetScissorWithCountEXT)gdpa(dev, "vkCmdSetScissorWithCountEXT");
+        table->CmdBindVertexBuffers2EXT = (PFN_vkCmdBindVertexBuffers2EXT)gdpa(dev, "vkCmdBindVertexBuffers2EXT");
+        table->CmdSetDepthTestEnableEXT = (PFN_vkCmdSetDepthTestEnableEXT)gdpa(dev, "vkCmdSetDepthTestEnableEXT");
+        table->CmdSetDepthWriteEnableEXT = (PFN_vkCmdSetDepthWriteEnableEXT)gdpa(dev, "vkCmdSetDepthWriteEnableEXT");
+        table->CmdSetDepthCompareOpEXT = (PFN_vkCmdSetDepthCompareOpEXT)gdpa(dev, "vkCmdSetDepthCompareOpEXT");
+        table->CmdSetDepthBoundsTestEnableEXT = (PFN_vkCmdSetDepthBoundsTestEnableEXT)gdpa(dev, "vkCmdSetDepthBoundsTestEnableEXT");
+        table->CmdSetStencilTestEnableEXT = (PFN_vkCmdSetStencilTestEnableEXT)gdpa(dev, "vkCmdSetStencilTestEnableEXT");
+        table->CmdSetStencilOpEXT = (PFN_vkCmdSetStencilOpEXT)gdpa(dev, "vkCmdSetStencilOpEXT");
+    }
 
     // ---- VK_EXT_host_image_copy extension commands
-    table->CopyMemoryToImageEXT = (PFN_vkCopyMemoryToImageEXT)gdpa(dev, "vkCopyMemoryToImageEXT");
-    table->CopyImageToMemoryEXT = (PFN_vkCopyImageToMemoryEXT)gdpa(dev, "vkCopyImageToMemoryEXT");
-    table->CopyImageToImageEXT = (PFN_vkCopyImageToImageEXT)gdpa(dev, "vkCopyImageToImageEXT");
-    table->TransitionImageLayoutEXT = (PFN_vkTransitionImageLayoutEXT)gdpa(dev, "vkTransitionImageLayoutEXT");
-    table->GetImageSubresourceLayout2EXT = (PFN_vkGetImageSubresourceLayout2EXT)gdpa(dev, "vkGetImageSubresourceLayout2EXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_host_image_copy")) {
+        table->CopyMemoryToImageEXT = (PFN_vkCopyMemoryToImageEXT)gdpa(dev, "vkCopyMemoryToImageEXT");
+        table->CopyImageToMemoryEXT = (PFN_vkCopyImageToMemoryEXT)gdpa(dev, "vkCopyImageToMemoryEXT");
+        table->CopyImageToImageEXT = (PFN_vkCopyImageToImageEXT)gdpa(dev, "vkCopyImageToImageEXT");
+        table->TransitionImageLayoutEXT = (PFN_vkTransitionImageLayoutEXT)gdpa(dev, "vkTransitionImageLayoutEXT");
+    }
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_host_image_copy") || loader_device_extension_enabled(pCreateInfo, "VK_EXT_image_compression_control")) {
+        table->GetImageSubresourceLayout2EXT = (PFN_vkGetImageSubresourceLayout2EXT)gdpa(dev, "vkGetImageSubresourceLayout2EXT");
+    }
 
     // ---- VK_EXT_swapchain_maintenance1 extension commands
-    table->ReleaseSwapchainImagesEXT = (PFN_vkReleaseSwapchainImagesEXT)gdpa(dev, "vkReleaseSwapchainImagesEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_swapchain_maintenance1")) {
+        table->ReleaseSwapchainImagesEXT = (PFN_vkReleaseSwapchainImagesEXT)gdpa(dev, "vkReleaseSwapchainImagesEXT");
+    }
 
     // ---- VK_NV_device_generated_commands extension commands
-    table->GetGeneratedCommandsMemoryRequirementsNV = (PFN_vkGetGeneratedCommandsMemoryRequirementsNV)gdpa(dev, "vkGetGeneratedCommandsMemoryRequirementsNV");
-    table->CmdPreprocessGeneratedCommandsNV = (PFN_vkCmdPreprocessGeneratedCommandsNV)gdpa(dev, "vkCmdPreprocessGeneratedCommandsNV");
-    table->CmdExecuteGeneratedCommandsNV = (PFN_vkCmdExecuteGeneratedCommandsNV)gdpa(dev, "vkCmdExecuteGeneratedCommandsNV");
-    table->CmdBindPipelineShaderGroupNV = (PFN_vkCmdBindPipelineShaderGroupNV)gdpa(dev, "vkCmdBindPipelineShaderGroupNV");
-    table->CreateIndirectCommandsLayoutNV = (PFN_vkCreateIndirectCommandsLayoutNV)gdpa(dev, "vkCreateIndirectCommandsLayoutNV");
-    table->DestroyIndirectCommandsLayoutNV = (PFN_vkDestroyIndirectCommandsLayoutNV)gdpa(dev, "vkDestroyIndirectCommandsLayoutNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_device_generated_commands")) {
+        table->GetGeneratedCommandsMemoryRequirementsNV = (PFN_vkGetGeneratedCommandsMemoryRequirementsNV)gdpa(dev, "vkGetGeneratedCommandsMemoryRequirementsNV");
+        table->CmdPreprocessGeneratedCommandsNV = (PFN_vkCmdPreprocessGeneratedCommandsNV)gdpa(dev, "vkCmdPreprocessGeneratedCommandsNV");
+        table->CmdExecuteGeneratedCommandsNV = (PFN_vkCmdExecuteGeneratedCommandsNV)gdpa(dev, "vkCmdExecuteGeneratedCommandsNV");
+        table->CmdBindPipelineShaderGroupNV = (PFN_vkCmdBindPipelineShaderGroupNV)gdpa(dev, "vkCmdBindPipelineShaderGroupNV");
+        table->CreateIndirectCommandsLayoutNV = (PFN_vkCreateIndirectCommandsLayoutNV)gdpa(dev, "vkCreateIndirectCommandsLayoutNV");
+        table->DestroyIndirectCommandsLayoutNV = (PFN_vkDestroyIndirectCommandsLayoutNV)gdpa(dev, "vkDestroyIndirectCommandsLayoutNV");
+    }
 
     // ---- VK_EXT_depth_bias_control extension commands
-    table->CmdSetDepthBias2EXT = (PFN_vkCmdSetDepthBias2EXT)gdpa(dev, "vkCmdSetDepthBias2EXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_depth_bias_control")) {
+        table->CmdSetDepthBias2EXT = (PFN_vkCmdSetDepthBias2EXT)gdpa(dev, "vkCmdSetDepthBias2EXT");
+    }
 
     // ---- VK_EXT_private_data extension commands
-    table->CreatePrivateDataSlotEXT = (PFN_vkCreatePrivateDataSlotEXT)gdpa(dev, "vkCreatePrivateDataSlotEXT");
-    table->DestroyPrivateDataSlotEXT = (PFN_vkDestroyPrivateDataSlotEXT)gdpa(dev, "vkDestroyPrivateDataSlotEXT");
-    table->SetPrivateDataEXT = (PFN_vkSetPrivateDataEXT)gdpa(dev, "vkSetPrivateDataEXT");
-    table->GetPrivateDataEXT = (PFN_vkGetPrivateDataEXT)gdpa(dev, "vkGetPrivateDataEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_private_data")) {
+        table->CreatePrivateDataSlotEXT = (PFN_vkCreatePrivateDataSlotEXT)gdpa(dev, "vkCreatePrivateDataSlotEXT");
+        table->DestroyPrivateDataSlotEXT = (PFN_vkDestroyPrivateDataSlotEXT)gdpa(dev, "vkDestroyPrivateDataSlotEXT");
+        table->SetPrivateDataEXT = (PFN_vkSetPrivateDataEXT)gdpa(dev, "vkSetPrivateDataEXT");
+        table->GetPrivateDataEXT = (PFN_vkGetPrivateDataEXT)gdpa(dev, "vkGetPrivateDataEXT");
+    }
 
     // ---- VK_NV_cuda_kernel_launch extension commands
-    table->CreateCudaModuleNV = (PFN_vkCreateCudaModuleNV)gdpa(dev, "vkCreateCudaModuleNV");
-    table->GetCudaModuleCacheNV = (PFN_vkGetCudaModuleCacheNV)gdpa(dev, "vkGetCudaModuleCacheNV");
-    table->CreateCudaFunctionNV = (PFN_vkCreateCudaFunctionNV)gdpa(dev, "vkCreateCudaFunctionNV");
-    table->DestroyCudaModuleNV = (PFN_vkDestroyCudaModuleNV)gdpa(dev, "vkDestroyCudaModuleNV");
-    table->DestroyCudaFunctionNV = (PFN_vkDestroyCudaFunctionNV)gdpa(dev, "vkDestroyCudaFunctionNV");
-    table->CmdCudaLaunchKernelNV = (PFN_vkCmdCudaLaunchKernelNV)gdpa(dev, "vkCmdCudaLaunchKernelNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_cuda_kernel_launch")) {
+        table->CreateCudaModuleNV = (PFN_vkCreateCudaModuleNV)gdpa(dev, "vkCreateCudaModuleNV");
+        table->GetCudaModuleCacheNV = (PFN_vkGetCudaModuleCacheNV)gdpa(dev, "vkGetCudaModuleCacheNV");
+        table->CreateCudaFunctionNV = (PFN_vkCreateCudaFunctionNV)gdpa(dev, "vkCreateCudaFunctionNV");
+        table->DestroyCudaModuleNV = (PFN_vkDestroyCudaModuleNV)gdpa(dev, "vkDestroyCudaModuleNV");
+        table->DestroyCudaFunctionNV = (PFN_vkDestroyCudaFunctionNV)gdpa(dev, "vkDestroyCudaFunctionNV");
+        table->CmdCudaLaunchKernelNV = (PFN_vkCmdCudaLaunchKernelNV)gdpa(dev, "vkCmdCudaLaunchKernelNV");
+    }
 
     // ---- VK_EXT_metal_objects extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_metal_objects")) {
 #if defined(VK_USE_PLATFORM_METAL_EXT)
-    table->ExportMetalObjectsEXT = (PFN_vkExportMetalObjectsEXT)gdpa(dev, "vkExportMetalObjectsEXT");
+        table->ExportMetalObjectsEXT = (PFN_vkExportMetalObjectsEXT)gdpa(dev, "vkExportMetalObjectsEXT");
 #endif // VK_USE_PLATFORM_METAL_EXT
+    }
 
     // ---- VK_EXT_descriptor_buffer extension commands
-    table->GetDescriptorSetLayoutSizeEXT = (PFN_vkGetDescriptorSetLayoutSizeEXT)gdpa(dev, "vkGetDescriptorSetLayoutSizeEXT");
-    table->GetDescriptorSetLayoutBindingOffsetEXT = (PFN_vkGetDescriptorSetLayoutBindingOffsetEXT)gdpa(dev, "vkGetDescriptorSetLayoutBindingOffsetEXT");
-    table->GetDescriptorEXT = (PFN_vkGetDescriptorEXT)gdpa(dev, "vkGetDescriptorEXT");
-    table->CmdBindDescriptorBuffersEXT = (PFN_vkCmdBindDescriptorBuffersEXT)gdpa(dev, "vkCmdBindDescriptorBuffersEXT");
-    table->CmdSetDescriptorBufferOffsetsEXT = (PFN_vkCmdSetDescriptorBufferOffsetsEXT)gdpa(dev, "vkCmdSetDescriptorBufferOffsetsEXT");
-    table->CmdBindDescriptorBufferEmbeddedSamplersEXT = (PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT)gdpa(dev, "vkCmdBindDescriptorBufferEmbeddedSamplersEXT");
-    table->GetBufferOpaqueCaptureDescriptorDataEXT = (PFN_vkGetBufferOpaqueCaptureDescriptorDataEXT)gdpa(dev, "vkGetBufferOpaqueCaptureDescriptorDataEXT");
-    table->GetImageOpaqueCaptureDescriptorDataEXT = (PFN_vkGetImageOpaqueCaptureDescriptorDataEXT)gdpa(dev, "vkGetImageOpaqueCaptureDescriptorDataEXT");
-    table->GetImageViewOpaqueCaptureDescriptorDataEXT = (PFN_vkGetImageViewOpaqueCaptureDescriptorDataEXT)gdpa(dev, "vkGetImageViewOpaqueCaptureDescriptorDataEXT");
-    table->GetSamplerOpaqueCaptureDescriptorDataEXT = (PFN_vkGetSamplerOpaqueCaptureDescriptorDataEXT)gdpa(dev, "vkGetSamplerOpaqueCaptureDescriptorDataEXT");
-    table->GetAccelerationStructureOpaqueCaptureDescriptorDataEXT = (PFN_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT)gdpa(dev, "vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_descriptor_buffer")) {
+        table->GetDescriptorSetLayoutSizeEXT = (PFN_vkGetDescriptorSetLayoutSizeEXT)gdpa(dev, "vkGetDescriptorSetLayoutSizeEXT");
+        table->GetDescriptorSetLayoutBindingOffsetEXT = (PFN_vkGetDescriptorSetLayoutBindingOffsetEXT)gdpa(dev, "vkGetDescriptorSetLayoutBindingOffsetEXT");
+        table->GetDescriptorEXT = (PFN_vkGetDescriptorEXT)gdpa(dev, "vkGetDescriptorEXT");
+        table->CmdBindDescriptorBuffersEXT = (PFN_vkCmdBindDescriptorBuffersEXT)gdpa(dev, "vkCmdBindDescriptorBuffersEXT");
+        table->CmdSetDescriptorBufferOffsetsEXT = (PFN_vkCmdSetDescriptorBufferOffsetsEXT)gdpa(dev, "vkCmdSetDescriptorBufferOffsetsEXT");
+        table->CmdBindDescriptorBufferEmbeddedSamplersEXT = (PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT)gdpa(dev, "vkCmdBindDescriptorBufferEmbeddedSamplersEXT");
+        table->GetBufferOpaqueCaptureDescriptorDataEXT = (PFN_vkGetBufferOpaqueCaptureDescriptorDataEXT)gdpa(dev, "vkGetBufferOpaqueCaptureDescriptorDataEXT");
+        table->GetImageOpaqueCaptureDescriptorDataEXT = (PFN_vkGetImageOpaqueCaptureDescriptorDataEXT)gdpa(dev, "vkGetImageOpaqueCaptureDescriptorDataEXT");
+        table->GetImageViewOpaqueCaptureDescriptorDataEXT = (PFN_vkGetImageViewOpaqueCaptureDescriptorDataEXT)gdpa(dev, "vkGetImageViewOpaqueCaptureDescriptorDataEXT");
+        table->GetSamplerOpaqueCaptureDescriptorDataEXT = (PFN_vkGetSamplerOpaqueCaptureDescriptorDataEXT)gdpa(dev, "vkGetSamplerOpaqueCaptureDescriptorDataEXT");
+        table->GetAccelerationStructureOpaqueCaptureDescriptorDataEXT = (PFN_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT)gdpa(dev, "vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT");
+    }
 
     // ---- VK_NV_fragment_shading_rate_enums extension commands
-    table->CmdSetFragmentShadingRateEnumNV = (PFN_vkCmdSetFragmentShadingRateEnumNV)gdpa(dev, "vkCmdSetFragmentShadingRateEnumNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_fragment_shading_rate_enums")) {
+        table->CmdSetFragmentShadingRateEnumNV = (PFN_vkCmdSetFragmentShadingRateEnumNV)gdpa(dev, "vkCmdSetFragmentShadingRateEnumNV");
+    }
 
     // ---- VK_EXT_device_fault extension commands
-    table->GetDeviceFaultInfoEXT = (PFN_vkGetDeviceFaultInfoEXT)gdpa(dev, "vkGetDeviceFaultInfoEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_device_fault")) {
+        table->GetDeviceFaultInfoEXT = (PFN_vkGetDeviceFaultInfoEXT)gdpa(dev, "vkGetDeviceFaultInfoEXT");
+    }
 
     // ---- VK_EXT_vertex_input_dynamic_state extension commands
-    table->CmdSetVertexInputEXT = (PFN_vkCmdSetVertexInputEXT)gdpa(dev, "vkCmdSetVertexInputEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_vertex_input_dynamic_state") || loader_device_extension_enabled(pCreateInfo, "VK_EXT_shader_object")) {
+        table->CmdSetVertexInputEXT = (PFN_vkCmdSetVertexInputEXT)gdpa(dev, "vkCmdSetVertexInputEXT");
+    }
 
     // ---- VK_FUCHSIA_external_memory extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_FUCHSIA_external_memory")) {
 #if defined(VK_USE_PLATFORM_FUCHSIA)
-    table->GetMemoryZirconHandleFUCHSIA = (PFN_vkGetMemoryZirconHandleFUCHSIA)gdpa(dev, "vkGetMemoryZirconHandleFUCHSIA");
+        table->GetMemoryZirconHandleFUCHSIA = (PFN_vkGetMemoryZirconHandleFUCHSIA)gdpa(dev, "vkGetMemoryZirconHandleFUCHSIA");
 #endif // VK_USE_PLATFORM_FUCHSIA
 #if defined(VK_USE_PLATFORM_FUCHSIA)
-    table->GetMemoryZirconHandlePropertiesFUCHSIA = (PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA)gdpa(dev, "vkGetMemoryZirconHandlePropertiesFUCHSIA");
+        table->GetMemoryZirconHandlePropertiesFUCHSIA = (PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA)gdpa(dev, "vkGetMemoryZirconHandlePropertiesFUCHSIA");
 #endif // VK_USE_PLATFORM_FUCHSIA
+    }
 
     // ---- VK_FUCHSIA_external_semaphore extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_FUCHSIA_external_semaphore")) {
 #if defined(VK_USE_PLATFORM_FUCHSIA)
-    table->ImportSemaphoreZirconHandleFUCHSIA = (PFN_vkImportSemaphoreZirconHandleFUCHSIA)gdpa(dev, "vkImportSemaphoreZirconHandleFUCHSIA");
+        table->ImportSemaphoreZirconHandleFUCHSIA = (PFN_vkImportSemaphoreZirconHandleFUCHSIA)gdpa(dev, "vkImportSemaphoreZirconHandleFUCHSIA");
 #endif // VK_USE_PLATFORM_FUCHSIA
 #if defined(VK_USE_PLATFORM_FUCHSIA)
-    table->GetSemaphoreZirconHandleFUCHSIA = (PFN_vkGetSemaphoreZirconHandleFUCHSIA)gdpa(dev, "vkGetSemaphoreZirconHandleFUCHSIA");
+        table->GetSemaphoreZirconHandleFUCHSIA = (PFN_vkGetSemaphoreZirconHandleFUCHSIA)gdpa(dev, "vkGetSemaphoreZirconHandleFUCHSIA");
 #endif // VK_USE_PLATFORM_FUCHSIA
+    }
 
     // ---- VK_FUCHSIA_buffer_collection extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_FUCHSIA_buffer_collection")) {
 #if defined(VK_USE_PLATFORM_FUCHSIA)
-    table->CreateBufferCollectionFUCHSIA = (PFN_vkCreateBufferCollectionFUCHSIA)gdpa(dev, "vkCreateBufferCollectionFUCHSIA");
+        table->CreateBufferCollectionFUCHSIA = (PFN_vkCreateBufferCollectionFUCHSIA)gdpa(dev, "vkCreateBufferCollectionFUCHSIA");
 #endif // VK_USE_PLATFORM_FUCHSIA
 #if defined(VK_USE_PLATFORM_FUCHSIA)
-    table->SetBufferCollectionImageConstraintsFUCHSIA = (PFN_vkSetBufferCollectionImageConstraintsFUCHSIA)gdpa(dev, "vkSetBufferCollectionImageConstraintsFUCHSIA");
+        table->SetBufferCollectionImageConstraintsFUCHSIA = (PFN_vkSetBufferCollectionImageConstraintsFUCHSIA)gdpa(dev, "vkSetBufferCollectionImageConstraintsFUCHSIA");
 #endif // VK_USE_PLATFORM_FUCHSIA
 #if defined(VK_USE_PLATFORM_FUCHSIA)
-    table->SetBufferCollectionBufferConstraintsFUCHSIA = (PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA)gdpa(dev, "vkSetBufferCollectionBufferConstraintsFUCHSIA");
+        table->SetBufferCollectionBufferConstraintsFUCHSIA = (PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA)gdpa(dev, "vkSetBufferCollectionBufferConstraintsFUCHSIA");
 #endif // VK_USE_PLATFORM_FUCHSIA
 #if defined(VK_USE_PLATFORM_FUCHSIA)
-    table->DestroyBufferCollectionFUCHSIA = (PFN_vkDestroyBufferCollectionFUCHSIA)gdpa(dev, "vkDestroyBufferCollectionFUCHSIA");
+        table->DestroyBufferCollectionFUCHSIA = (PFN_vkDestroyBufferCollectionFUCHSIA)gdpa(dev, "vkDestroyBufferCollectionFUCHSIA");
 #endif // VK_USE_PLATFORM_FUCHSIA
 #if defined(VK_USE_PLATFORM_FUCHSIA)
-    table->GetBufferCollectionPropertiesFUCHSIA = (PFN_vkGetBufferCollectionPropertiesFUCHSIA)gdpa(dev, "vkGetBufferCollectionPropertiesFUCHSIA");
+        table->GetBufferCollectionPropertiesFUCHSIA = (PFN_vkGetBufferCollectionPropertiesFUCHSIA)gdpa(dev, "vkGetBufferCollectionPropertiesFUCHSIA");
 #endif // VK_USE_PLATFORM_FUCHSIA
+    }
 
     // ---- VK_HUAWEI_subpass_shading extension commands
-    table->GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI = (PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI)gdpa(dev, "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI");
-    table->CmdSubpassShadingHUAWEI = (PFN_vkCmdSubpassShadingHUAWEI)gdpa(dev, "vkCmdSubpassShadingHUAWEI");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_HUAWEI_subpass_shading")) {
+        table->GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI = (PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI)gdpa(dev, "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI");
+        table->CmdSubpassShadingHUAWEI = (PFN_vkCmdSubpassShadingHUAWEI)gdpa(dev, "vkCmdSubpassShadingHUAWEI");
+    }
 
     // ---- VK_HUAWEI_invocation_mask extension commands
-    table->CmdBindInvocationMaskHUAWEI = (PFN_vkCmdBindInvocationMaskHUAWEI)gdpa(dev, "vkCmdBindInvocationMaskHUAWEI");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_HUAWEI_invocation_mask")) {
+        table->CmdBindInvocationMaskHUAWEI = (PFN_vkCmdBindInvocationMaskHUAWEI)gdpa(dev, "vkCmdBindInvocationMaskHUAWEI");
+    }
 
     // ---- VK_NV_external_memory_rdma extension commands
-    table->GetMemoryRemoteAddressNV = (PFN_vkGetMemoryRemoteAddressNV)gdpa(dev, "vkGetMemoryRemoteAddressNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_external_memory_rdma")) {
+        table->GetMemoryRemoteAddressNV = (PFN_vkGetMemoryRemoteAddressNV)gdpa(dev, "vkGetMemoryRemoteAddressNV");
+    }
 
     // ---- VK_EXT_pipeline_properties extension commands
-    table->GetPipelinePropertiesEXT = (PFN_vkGetPipelinePropertiesEXT)gdpa(dev, "vkGetPipelinePropertiesEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_pipeline_properties")) {
+        table->GetPipelinePropertiesEXT = (PFN_vkGetPipelinePropertiesEXT)gdpa(dev, "vkGetPipelinePropertiesEXT");
+    }
 
     // ---- VK_EXT_extended_dynamic_state2 extension commands
-    table->CmdSetPatchControlPointsEXT = (PFN_vkCmdSetPatchControlPointsEXT)gdpa(dev, "vkCmdSetPatchControlPointsEXT");
-    table->CmdSetRasterizerDiscardEnableEXT = (PFN_vkCmdSetRasterizerDiscardEnableEXT)gdpa(dev, "vkCmdSetRasterizerDiscardEnableEXT");
-    table->CmdSetDepthBiasEnableEXT = (PFN_vkCmdSetDepthBiasEnableEXT)gdpa(dev, "vkCmdSetDepthBiasEnableEXT");
-    table->CmdSetLogicOpEXT = (PFN_vkCmdSetLogicOpEXT)gdpa(dev, "vkCmdSetLogicOpEXT");
-    table->CmdSetPrimitiveRestartEnableEXT = (PFN_vkCmdSetPrimitiveRestartEnableEXT)gdpa(dev, "vkCmdSetPrimitiveRestartEnableEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_extended_dynamic_state2") || loader_device_extension_enabled(pCreateInfo, "VK_EXT_shader_object")) {
+        table->CmdSetPatchControlPointsEXT = (PFN_vkCmdSetPatchControlPointsEXT)gdpa(dev, "vkCmdSetPatchControlPointsEXT");
+        table->CmdSetRasterizerDiscardEnableEXT = (PFN_vkCmdSetRasterizerDiscardEnableEXT)gdpa(dev, "vkCmdSetRasterizerDiscardEnableEXT");
+        table->CmdSetDepthBiasEnableEXT = (PFN_vkCmdSetDepthBiasEnableEXT)gdpa(dev, "vkCmdSetDepthBiasEnableEXT");
+        table->CmdSetLogicOpEXT = (PFN_vkCmdSetLogicOpEXT)gdpa(dev, "vkCmdSetLogicOpEXT");
+        table->CmdSetPrimitiveRestartEnableEXT = (PFN_vkCmdSetPrimitiveRestartEnableEXT)gdpa(dev, "vkCmdSetPrimitiveRestartEnableEXT");
+    }
 
     // ---- VK_EXT_color_write_enable extension commands
-    table->CmdSetColorWriteEnableEXT = (PFN_vkCmdSetColorWriteEnableEXT)gdpa(dev, "vkCmdSetColorWriteEnableEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_color_write_enable")) {
+        table->CmdSetColorWriteEnableEXT = (PFN_vkCmdSetColorWriteEnableEXT)gdpa(dev, "vkCmdSetColorWriteEnableEXT");
+    }
 
     // ---- VK_EXT_multi_draw extension commands
-    table->CmdDrawMultiEXT = (PFN_vkCmdDrawMultiEXT)gdpa(dev, "vkCmdDrawMultiEXT");
-    table->CmdDrawMultiIndexedEXT = (PFN_vkCmdDrawMultiIndexedEXT)gdpa(dev, "vkCmdDrawMultiIndexedEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_multi_draw")) {
+        table->CmdDrawMultiEXT = (PFN_vkCmdDrawMultiEXT)gdpa(dev, "vkCmdDrawMultiEXT");
+        table->CmdDrawMultiIndexedEXT = (PFN_vkCmdDrawMultiIndexedEXT)gdpa(dev, "vkCmdDrawMultiIndexedEXT");
+    }
 
     // ---- VK_EXT_opacity_micromap extension commands
-    table->CreateMicromapEXT = (PFN_vkCreateMicromapEXT)gdpa(dev, "vkCreateMicromapEXT");
-    table->DestroyMicromapEXT = (PFN_vkDestroyMicromapEXT)gdpa(dev, "vkDestroyMicromapEXT");
-    table->CmdBuildMicromapsEXT = (PFN_vkCmdBuildMicromapsEXT)gdpa(dev, "vkCmdBuildMicromapsEXT");
-    table->BuildMicromapsEXT = (PFN_vkBuildMicromapsEXT)gdpa(dev, "vkBuildMicromapsEXT");
-    table->CopyMicromapEXT = (PFN_vkCopyMicromapEXT)gdpa(dev, "vkCopyMicromapEXT");
-    table->CopyMicromapToMemoryEXT = (PFN_vkCopyMicromapToMemoryEXT)gdpa(dev, "vkCopyMicromapToMemoryEXT");
-    table->CopyMemoryToMicromapEXT = (PFN_vkCopyMemoryToMicromapEXT)gdpa(dev, "vkCopyMemoryToMicromapEXT");
-    table->WriteMicromapsPropertiesEXT = (PFN_vkWriteMicromapsPropertiesEXT)gdpa(dev, "vkWriteMicromapsPropertiesEXT");
-    table->CmdCopyMicromapEXT = (PFN_vkCmdCopyMicromapEXT)gdpa(dev, "vkCmdCopyMicromapEXT");
-    table->CmdCopyMicromapToMemoryEXT = (PFN_vkCmdCopyMicromapToMemoryEXT)gdpa(dev, "vkCmdCopyMicromapToMemoryEXT");
-    table->CmdCopyMemoryToMicromapEXT = (PFN_vkCmdCopyMemoryToMicromapEXT)gdpa(dev, "vkCmdCopyMemoryToMicromapEXT");
-    table->CmdWriteMicromapsPropertiesEXT = (PFN_vkCmdWriteMicromapsPropertiesEXT)gdpa(dev, "vkCmdWriteMicromapsPropertiesEXT");
-    table->GetDeviceMicromapCompatibilityEXT = (PFN_vkGetDeviceMicromapCompatibilityEXT)gdpa(dev, "vkGetDeviceMicromapCompatibilityEXT");
-    table->GetMicromapBuildSizesEXT = (PFN_vkGetMicromapBuildSizesEXT)gdpa(dev, "vkGetMicromapBuildSizesEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_opacity_micromap")) {
+        table->CreateMicromapEXT = (PFN_vkCreateMicromapEXT)gdpa(dev, "vkCreateMicromapEXT");
+        table->DestroyMicromapEXT = (PFN_vkDestroyMicromapEXT)gdpa(dev, "vkDestroyMicromapEXT");
+        table->CmdBuildMicromapsEXT = (PFN_vkCmdBuildMicromapsEXT)gdpa(dev, "vkCmdBuildMicromapsEXT");
+        table->BuildMicromapsEXT = (PFN_vkBuildMicromapsEXT)gdpa(dev, "vkBuildMicromapsEXT");
+        table->CopyMicromapEXT = (PFN_vkCopyMicromapEXT)gdpa(dev, "vkCopyMicromapEXT");
+        table->CopyMicromapToMemoryEXT = (PFN_vkCopyMicromapToMemoryEXT)gdpa(dev, "vkCopyMicromapToMemoryEXT");
+        table->CopyMemoryToMicromapEXT = (PFN_vkCopyMemoryToMicromapEXT)gdpa(dev, "vkCopyMemoryToMicromapEXT");
+        table->WriteMicromapsPropertiesEXT = (PFN_vkWriteMicromapsPropertiesEXT)gdpa(dev, "vkWriteMicromapsPropertiesEXT");
+        table->CmdCopyMicromapEXT = (PFN_vkCmdCopyMicromapEXT)gdpa(dev, "vkCmdCopyMicromapEXT");
+        table->CmdCopyMicromapToMemoryEXT = (PFN_vkCmdCopyMicromapToMemoryEXT)gdpa(dev, "vkCmdCopyMicromapToMemoryEXT");
+        table->CmdCopyMemoryToMicromapEXT = (PFN_vkCmdCopyMemoryToMicromapEXT)gdpa(dev, "vkCmdCopyMemoryToMicromapEXT");
+        table->CmdWriteMicromapsPropertiesEXT = (PFN_vkCmdWriteMicromapsPropertiesEXT)gdpa(dev, "vkCmdWriteMicromapsPropertiesEXT");
+        table->GetDeviceMicromapCompatibilityEXT = (PFN_vkGetDeviceMicromapCompatibilityEXT)gdpa(dev, "vkGetDeviceMicromapCompatibilityEXT");
+        table->GetMicromapBuildSizesEXT = (PFN_vkGetMicromapBuildSizesEXT)gdpa(dev, "vkGetMicromapBuildSizesEXT");
+    }
 
     // ---- VK_HUAWEI_cluster_culling_shader extension commands
-    table->CmdDrawClusterHUAWEI = (PFN_vkCmdDrawClusterHUAWEI)gdpa(dev, "vkCmdDrawClusterHUAWEI");
-    table->CmdDrawClusterIndirectHUAWEI = (PFN_vkCmdDrawClusterIndirectHUAWEI)gdpa(dev, "vkCmdDrawClusterIndirectHUAWEI");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_HUAWEI_cluster_culling_shader")) {
+        table->CmdDrawClusterHUAWEI = (PFN_vkCmdDrawClusterHUAWEI)gdpa(dev, "vkCmdDrawClusterHUAWEI");
+        table->CmdDrawClusterIndirectHUAWEI = (PFN_vkCmdDrawClusterIndirectHUAWEI)gdpa(dev, "vkCmdDrawClusterIndirectHUAWEI");
+    }
 
     // ---- VK_EXT_pageable_device_local_memory extension commands
-    table->SetDeviceMemoryPriorityEXT = (PFN_vkSetDeviceMemoryPriorityEXT)gdpa(dev, "vkSetDeviceMemoryPriorityEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_pageable_device_local_memory")) {
+        table->SetDeviceMemoryPriorityEXT = (PFN_vkSetDeviceMemoryPriorityEXT)gdpa(dev, "vkSetDeviceMemoryPriorityEXT");
+    }
 
     // ---- VK_VALVE_descriptor_set_host_mapping extension commands
-    table->GetDescriptorSetLayoutHostMappingInfoVALVE = (PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE)gdpa(dev, "vkGetDescriptorSetLayoutHostMappingInfoVALVE");
-    table->GetDescriptorSetHostMappingVALVE = (PFN_vkGetDescriptorSetHostMappingVALVE)gdpa(dev, "vkGetDescriptorSetHostMappingVALVE");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_VALVE_descriptor_set_host_mapping")) {
+        table->GetDescriptorSetLayoutHostMappingInfoVALVE = (PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE)gdpa(dev, "vkGetDescriptorSetLayoutHostMappingInfoVALVE");
+        table->GetDescriptorSetHostMappingVALVE = (PFN_vkGetDescriptorSetHostMappingVALVE)gdpa(dev, "vkGetDescriptorSetHostMappingVALVE");
+    }
 
     // ---- VK_NV_copy_memory_indirect extension commands
-    table->CmdCopyMemoryIndirectNV = (PFN_vkCmdCopyMemoryIndirectNV)gdpa(dev, "vkCmdCopyMemoryIndirectNV");
-    table->CmdCopyMemoryToImageIndirectNV = (PFN_vkCmdCopyMemoryToImageIndirectNV)gdpa(dev, "vkCmdCopyMemoryToImageIndirectNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_copy_memory_indirect")) {
+        table->CmdCopyMemoryIndirectNV = (PFN_vkCmdCopyMemoryIndirectNV)gdpa(dev, "vkCmdCopyMemoryIndirectNV");
+        table->CmdCopyMemoryToImageIndirectNV = (PFN_vkCmdCopyMemoryToImageIndirectNV)gdpa(dev, "vkCmdCopyMemoryToImageIndirectNV");
+    }
 
     // ---- VK_NV_memory_decompression extension commands
-    table->CmdDecompressMemoryNV = (PFN_vkCmdDecompressMemoryNV)gdpa(dev, "vkCmdDecompressMemoryNV");
-    table->CmdDecompressMemoryIndirectCountNV = (PFN_vkCmdDecompressMemoryIndirectCountNV)gdpa(dev, "vkCmdDecompressMemoryIndirectCountNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_memory_decompression")) {
+        table->CmdDecompressMemoryNV = (PFN_vkCmdDecompressMemoryNV)gdpa(dev, "vkCmdDecompressMemoryNV");
+        table->CmdDecompressMemoryIndirectCountNV = (PFN_vkCmdDecompressMemoryIndirectCountNV)gdpa(dev, "vkCmdDecompressMemoryIndirectCountNV");
+    }
 
     // ---- VK_NV_device_generated_commands_compute extension commands
-    table->GetPipelineIndirectMemoryRequirementsNV = (PFN_vkGetPipelineIndirectMemoryRequirementsNV)gdpa(dev, "vkGetPipelineIndirectMemoryRequirementsNV");
-    table->CmdUpdatePipelineIndirectBufferNV = (PFN_vkCmdUpdatePipelineIndirectBufferNV)gdpa(dev, "vkCmdUpdatePipelineIndirectBufferNV");
-    table->GetPipelineIndirectDeviceAddressNV = (PFN_vkGetPipelineIndirectDeviceAddressNV)gdpa(dev, "vkGetPipelineIndirectDeviceAddressNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_device_generated_commands_compute")) {
+        table->GetPipelineIndirectMemoryRequirementsNV = (PFN_vkGetPipelineIndirectMemoryRequirementsNV)gdpa(dev, "vkGetPipelineIndirectMemoryRequirementsNV");
+        table->CmdUpdatePipelineIndirectBufferNV = (PFN_vkCmdUpdatePipelineIndirectBufferNV)gdpa(dev, "vkCmdUpdatePipelineIndirectBufferNV");
+        table->GetPipelineIndirectDeviceAddressNV = (PFN_vkGetPipelineIndirectDeviceAddressNV)gdpa(dev, "vkGetPipelineIndirectDeviceAddressNV");
+    }
 
     // ---- VK_EXT_extended_dynamic_state3 extension commands
-    table->CmdSetDepthClampEnableEXT = (PFN_vkCmdSetDepthClampEnableEXT)gdpa(dev, "vkCmdSetDepthClampEnableEXT");
-    table->CmdSetPolygonModeEXT = (PFN_vkCmdSetPolygonModeEXT)gdpa(dev, "vkCmdSetPolygonModeEXT");
-    table->CmdSetRasterizationSamplesEXT = (PFN_vkCmdSetRasterizationSamplesEXT)gdpa(dev, "vkCmdSetRasterizationSamplesEXT");
-    table->CmdSetSampleMaskEXT = (PFN_vkCmdSetSampleMaskEXT)gdpa(dev, "vkCmdSetSampleMaskEXT");
-    table->CmdSetAlphaToCoverageEnableEXT = (PFN_vkCmdSetAlphaToCoverageEnableEXT)gdpa(dev, "vkCmdSetAlphaToCoverageEnableEXT");
-    table->CmdSetAlphaToOneEnableEXT = (PFN_vkCmdSetAlphaToOneEnableEXT)gdpa(dev, "vkCmdSetAlphaToOneEnableEXT");
-    table->CmdSetLogicOpEnableEXT = (PFN_vkCmdSetLogicOpEnableEXT)gdpa(dev, "vkCmdSetLogicOpEnableEXT");
-    table->CmdSetColorBlendEnableEXT = (PFN_vkCmdSetColorBlendEnableEXT)gdpa(dev, "vkCmdSetColorBlendEnableEXT");
-    table->CmdSetColorBlendEquationEXT = (PFN_vkCmdSetColorBlendEquationEXT)gdpa(dev, "vkCmdSetColorBlendEquationEXT");
-    table->CmdSetColorWriteMaskEXT = (PFN_vkCmdSetColorWriteMaskEXT)gdpa(dev, "vkCmdSetColorWriteMaskEXT");
-    table->CmdSetTessellationDomainOriginEXT = (PFN_vkCmdSetTessellationDomainOriginEXT)gdpa(dev, "vkCmdSetTessellationDomainOriginEXT");
-    table->CmdSetRasterizationStreamEXT = (PFN_vkCmdSetRasterizationStreamEXT)gdpa(dev, "vkCmdSetRasterizationStreamEXT");
-    table->CmdSetConservativeRasterizationModeEXT = (PFN_vkCmdSetConservativeRasterizationModeEXT)gdpa(dev, "vkCmdSetConservativeRasterizationModeEXT");
-    table->CmdSetExtraPrimitiveOverestimationSizeEXT = (PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT)gdpa(dev, "vkCmdSetExtraPrimitiveOverestimationSizeEXT");
-    table->CmdSetDepthClipEnableEXT = (PFN_vkCmdSetDepthClipEnableEXT)gdpa(dev, "vkCmdSetDepthClipEnableEXT");
-    table->CmdSetSampleLocationsEnableEXT = (PFN_vkCmdSetSampleLocationsEnableEXT)gdpa(dev, "vkCmdSetSampleLocationsEnableEXT");
-    table->CmdSetColorBlendAdvancedEXT = (PFN_vkCmdSetColorBlendAdvancedEXT)gdpa(dev, "vkCmdSetColorBlendAdvancedEXT");
-    table->CmdSetProvokingVertexModeEXT = (PFN_vkCmdSetProvokingVertexModeEXT)gdpa(dev, "vkCmdSetProvokingVertexModeEXT");
-    table->CmdSetLineRasterizationModeEXT = (PFN_vkCmdSetLineRasterizationModeEXT)gdpa(dev, "vkCmdSetLineRasterizationModeEXT");
-    table->CmdSetLineStippleEnableEXT = (PFN_vkCmdSetLineStippleEnableEXT)gdpa(dev, "vkCmdSetLineStippleEnableEXT");
-    table->CmdSetDepthClipNegativeOneToOneEXT = (PFN_vkCmdSetDepthClipNegativeOneToOneEXT)gdpa(dev, "vkCmdSetDepthClipNegativeOneToOneEXT");
-    table->CmdSetViewportWScalingEnableNV = (PFN_vkCmdSetViewportWScalingEnableNV)gdpa(dev, "vkCmdSetViewportWScalingEnableNV");
-    table->CmdSetViewportSwizzleNV = (PFN_vkCmdSetViewportSwizzleNV)gdpa(dev, "vkCmdSetViewportSwizzleNV");
-    table->CmdSetCoverageToColorEnableNV = (PFN_vkCmdSetCoverageToColorEnableNV)gdpa(dev, "vkCmdSetCoverageToColorEnableNV");
-    table->CmdSetCoverageToColorLocationNV = (PFN_vkCmdSetCoverageToColorLocationNV)gdpa(dev, "vkCmdSetCoverageToColorLocationNV");
-    table->CmdSetCoverageModulationModeNV = (PFN_vkCmdSetCoverageModulationModeNV)gdpa(dev, "vkCmdSetCoverageModulationModeNV");
-    table->CmdSetCoverageModulationTableEnableNV = (PFN_vkCmdSetCoverageModulationTableEnableNV)gdpa(dev, "vkCmdSetCoverageModulationTableEnableNV");
-    table->CmdSetCoverageModulationTableNV = (PFN_vkCmdSetCoverageModulationTableNV)gdpa(dev, "vkCmdSetCoverageModulationTableNV");
-    table->CmdSetShadingRateImageEnableNV = (PFN_vkCmdSetShadingRateImageEnableNV)gdpa(dev, "vkCmdSetShadingRateImageEnableNV");
-    table->CmdSetRepresentativeFragmentTestEnableNV = (PFN_vkCmdSetRepresentativeFragmentTestEnableNV)gdpa(dev, "vkCmdSetRepresentativeFragmentTestEnableNV");
-    table->CmdSetCoverageReductionModeNV = (PFN_vkCmdSetCoverageReductionModeNV)gdpa(dev, "vkCmdSetCoverageReductionModeNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_extended_dynamic_state3") || loader_device_extension_enabled(pCreateInfo, "VK_EXT_shader_object")) {
+        table->CmdSetDepthClampEnableEXT = (PFN_vkCmdSetDepthClampEnableEXT)gdpa(dev, "vkCmdSetDepthClampEnableEXT");
+        table->CmdSetPolygonModeEXT = (PFN_vkCmdSetPolygonModeEXT)gdpa(dev, "vkCmdSetPolygonModeEXT");
+        table->CmdSetRasterizationSamplesEXT = (PFN_vkCmdSetRasterizationSamplesEXT)gdpa(dev, "vkCmdSetRasterizationSamplesEXT");
+        table->CmdSetSampleMaskEXT = (PFN_vkCmdSetSampleMaskEXT)gdpa(dev, "vkCmdSetSampleMaskEXT");
+        table->CmdSetAlphaToCoverageEnableEXT = (PFN_vkCmdSetAlphaToCoverageEnableEXT)gdpa(dev, "vkCmdSetAlphaToCoverageEnableEXT");
+        table->CmdSetAlphaToOneEnableEXT = (PFN_vkCmdSetAlphaToOneEnableEXT)gdpa(dev, "vkCmdSetAlphaToOneEnableEXT");
+        table->CmdSetLogicOpEnableEXT = (PFN_vkCmdSetLogicOpEnableEXT)gdpa(dev, "vkCmdSetLogicOpEnableEXT");
+        table->CmdSetColorBlendEnableEXT = (PFN_vkCmdSetColorBlendEnableEXT)gdpa(dev, "vkCmdSetColorBlendEnableEXT");
+        table->CmdSetColorBlendEquationEXT = (PFN_vkCmdSetColorBlendEquationEXT)gdpa(dev, "vkCmdSetColorBlendEquationEXT");
+        table->CmdSetColorWriteMaskEXT = (PFN_vkCmdSetColorWriteMaskEXT)gdpa(dev, "vkCmdSetColorWriteMaskEXT");
+        table->CmdSetTessellationDomainOriginEXT = (PFN_vkCmdSetTessellationDomainOriginEXT)gdpa(dev, "vkCmdSetTessellationDomainOriginEXT");
+        table->CmdSetRasterizationStreamEXT = (PFN_vkCmdSetRasterizationStreamEXT)gdpa(dev, "vkCmdSetRasterizationStreamEXT");
+        table->CmdSetConservativeRasterizationModeEXT = (PFN_vkCmdSetConservativeRasterizationModeEXT)gdpa(dev, "vkCmdSetConservativeRasterizationModeEXT");
+        table->CmdSetExtraPrimitiveOverestimationSizeEXT = (PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT)gdpa(dev, "vkCmdSetExtraPrimitiveOverestimationSizeEXT");
+        table->CmdSetDepthClipEnableEXT = (PFN_vkCmdSetDepthClipEnableEXT)gdpa(dev, "vkCmdSetDepthClipEnableEXT");
+        table->CmdSetSampleLocationsEnableEXT = (PFN_vkCmdSetSampleLocationsEnableEXT)gdpa(dev, "vkCmdSetSampleLocationsEnableEXT");
+        table->CmdSetColorBlendAdvancedEXT = (PFN_vkCmdSetColorBlendAdvancedEXT)gdpa(dev, "vkCmdSetColorBlendAdvancedEXT");
+        table->CmdSetProvokingVertexModeEXT = (PFN_vkCmdSetProvokingVertexModeEXT)gdpa(dev, "vkCmdSetProvokingVertexModeEXT");
+        table->CmdSetLineRasterizationModeEXT = (PFN_vkCmdSetLineRasterizationModeEXT)gdpa(dev, "vkCmdSetLineRasterizationModeEXT");
+        table->CmdSetLineStippleEnableEXT = (PFN_vkCmdSetLineStippleEnableEXT)gdpa(dev, "vkCmdSetLineStippleEnableEXT");
+        table->CmdSetDepthClipNegativeOneToOneEXT = (PFN_vkCmdSetDepthClipNegativeOneToOneEXT)gdpa(dev, "vkCmdSetDepthClipNegativeOneToOneEXT");
+        table->CmdSetViewportWScalingEnableNV = (PFN_vkCmdSetViewportWScalingEnableNV)gdpa(dev, "vkCmdSetViewportWScalingEnableNV");
+        table->CmdSetViewportSwizzleNV = (PFN_vkCmdSetViewportSwizzleNV)gdpa(dev, "vkCmdSetViewportSwizzleNV");
+        table->CmdSetCoverageToColorEnableNV = (PFN_vkCmdSetCoverageToColorEnableNV)gdpa(dev, "vkCmdSetCoverageToColorEnableNV");
+        table->CmdSetCoverageToColorLocationNV = (PFN_vkCmdSetCoverageToColorLocationNV)gdpa(dev, "vkCmdSetCoverageToColorLocationNV");
+        table->CmdSetCoverageModulationModeNV = (PFN_vkCmdSetCoverageModulationModeNV)gdpa(dev, "vkCmdSetCoverageModulationModeNV");
+        table->CmdSetCoverageModulationTableEnableNV = (PFN_vkCmdSetCoverageModulationTableEnableNV)gdpa(dev, "vkCmdSetCoverageModulationTableEnableNV");
+        table->CmdSetCoverageModulationTableNV = (PFN_vkCmdSetCoverageModulationTableNV)gdpa(dev, "vkCmdSetCoverageModulationTableNV");
+        table->CmdSetShadingRateImageEnableNV = (PFN_vkCmdSetShadingRateImageEnableNV)gdpa(dev, "vkCmdSetShadingRateImageEnableNV");
+        table->CmdSetRepresentativeFragmentTestEnableNV = (PFN_vkCmdSetRepresentativeFragmentTestEnableNV)gdpa(dev, "vkCmdSetRepresentativeFragmentTestEnableNV");
+        table->CmdSetCoverageReductionModeNV = (PFN_vkCmdSetCoverageReductionModeNV)gdpa(dev, "vkCmdSetCoverageReductionModeNV");
+    }
 
     // ---- VK_EXT_shader_module_identifier extension commands
-    table->GetShaderModuleIdentifierEXT = (PFN_vkGetShaderModuleIdentifierEXT)gdpa(dev, "vkGetShaderModuleIdentifierEXT");
-    table->GetShaderModuleCreateInfoIdentifierEXT = (PFN_vkGetShaderModuleCreateInfoIdentifierEXT)gdpa(dev, "vkGetShaderModuleCreateInfoIdentifierEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_shader_module_identifier")) {
+        table->GetShaderModuleIdentifierEXT = (PFN_vkGetShaderModuleIdentifierEXT)gdpa(dev, "vkGetShaderModuleIdentifierEXT");
+        table->GetShaderModuleCreateInfoIdentifierEXT = (PFN_vkGetShaderModuleCreateInfoIdentifierEXT)gdpa(dev, "vkGetShaderModuleCreateInfoIdentifierEXT");
+    }
 
     // ---- VK_NV_optical_flow extension commands
-    table->CreateOpticalFlowSessionNV = (PFN_vkCreateOpticalFlowSessionNV)gdpa(dev, "vkCreateOpticalFlowSessionNV");
-    table->DestroyOpticalFlowSessionNV = (PFN_vkDestroyOpticalFlowSessionNV)gdpa(dev, "vkDestroyOpticalFlowSessionNV");
-    table->BindOpticalFlowSessionImageNV = (PFN_vkBindOpticalFlowSessionImageNV)gdpa(dev, "vkBindOpticalFlowSessionImageNV");
-    table->CmdOpticalFlowExecuteNV = (PFN_vkCmdOpticalFlowExecuteNV)gdpa(dev, "vkCmdOpticalFlowExecuteNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_optical_flow")) {
+        table->CreateOpticalFlowSessionNV = (PFN_vkCreateOpticalFlowSessionNV)gdpa(dev, "vkCreateOpticalFlowSessionNV");
+        table->DestroyOpticalFlowSessionNV = (PFN_vkDestroyOpticalFlowSessionNV)gdpa(dev, "vkDestroyOpticalFlowSessionNV");
+        table->BindOpticalFlowSessionImageNV = (PFN_vkBindOpticalFlowSessionImageNV)gdpa(dev, "vkBindOpticalFlowSessionImageNV");
+        table->CmdOpticalFlowExecuteNV = (PFN_vkCmdOpticalFlowExecuteNV)gdpa(dev, "vkCmdOpticalFlowExecuteNV");
+    }
 
     // ---- VK_AMD_anti_lag extension commands
-    table->AntiLagUpdateAMD = (PFN_vkAntiLagUpdateAMD)gdpa(dev, "vkAntiLagUpdateAMD");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_AMD_anti_lag")) {
+        table->AntiLagUpdateAMD = (PFN_vkAntiLagUpdateAMD)gdpa(dev, "vkAntiLagUpdateAMD");
+    }
 
     // ---- VK_EXT_shader_object extension commands
-    table->CreateShadersEXT = (PFN_vkCreateShadersEXT)gdpa(dev, "vkCreateShadersEXT");
-    table->DestroyShaderEXT = (PFN_vkDestroyShaderEXT)gdpa(dev, "vkDestroyShaderEXT");
-    table->GetShaderBinaryDataEXT = (PFN_vkGetShaderBinaryDataEXT)gdpa(dev, "vkGetShaderBinaryDataEXT");
-    table->CmdBindShadersEXT = (PFN_vkCmdBindShadersEXT)gdpa(dev, "vkCmdBindShadersEXT");
-    table->CmdSetDepthClampRangeEXT = (PFN_vkCmdSetDepthClampRangeEXT)gdpa(dev, "vkCmdSetDepthClampRangeEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_shader_object")) {
+        table->CreateShadersEXT = (PFN_vkCreateShadersEXT)gdpa(dev, "vkCreateShadersEXT");
+        table->DestroyShaderEXT = (PFN_vkDestroyShaderEXT)gdpa(dev, "vkDestroyShaderEXT");
+        table->GetShaderBinaryDataEXT = (PFN_vkGetShaderBinaryDataEXT)gdpa(dev, "vkGetShaderBinaryDataEXT");
+        table->CmdBindShadersEXT = (PFN_vkCmdBindShadersEXT)gdpa(dev, "vkCmdBindShadersEXT");
+    }
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_shader_object") || loader_device_extension_enabled(pCreateInfo, "VK_EXT_depth_clamp_control")) {
+        table->CmdSetDepthClampRangeEXT = (PFN_vkCmdSetDepthClampRangeEXT)gdpa(dev, "vkCmdSetDepthClampRangeEXT");
+    }
 
     // ---- VK_QCOM_tile_properties extension commands
-    table->GetFramebufferTilePropertiesQCOM = (PFN_vkGetFramebufferTilePropertiesQCOM)gdpa(dev, "vkGetFramebufferTilePropertiesQCOM");
-    table->GetDynamicRenderingTilePropertiesQCOM = (PFN_vkGetDynamicRenderingTilePropertiesQCOM)gdpa(dev, "vkGetDynamicRenderingTilePropertiesQCOM");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_QCOM_tile_properties")) {
+        table->GetFramebufferTilePropertiesQCOM = (PFN_vkGetFramebufferTilePropertiesQCOM)gdpa(dev, "vkGetFramebufferTilePropertiesQCOM");
+        table->GetDynamicRenderingTilePropertiesQCOM = (PFN_vkGetDynamicRenderingTilePropertiesQCOM)gdpa(dev, "vkGetDynamicRenderingTilePropertiesQCOM");
+    }
 
     // ---- VK_NV_cooperative_vector extension commands
-    table->ConvertCooperativeVectorMatrixNV = (PFN_vkConvertCooperativeVectorMatrixNV)gdpa(dev, "vkConvertCooperativeVectorMatrixNV");
-    table->CmdConvertCooperativeVectorMatrixNV = (PFN_vkCmdConvertCooperativeVectorMatrixNV)gdpa(dev, "vkCmdConvertCooperativeVectorMatrixNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_cooperative_vector")) {
+        table->ConvertCooperativeVectorMatrixNV = (PFN_vkConvertCooperativeVectorMatrixNV)gdpa(dev, "vkConvertCooperativeVectorMatrixNV");
+        table->CmdConvertCooperativeVectorMatrixNV = (PFN_vkCmdConvertCooperativeVectorMatrixNV)gdpa(dev, "vkCmdConvertCooperativeVectorMatrixNV");
+    }
 
     // ---- VK_NV_low_latency2 extension commands
-    table->SetLatencySleepModeNV = (PFN_vkSetLatencySleepModeNV)gdpa(dev, "vkSetLatencySleepModeNV");
-    table->LatencySleepNV = (PFN_vkLatencySleepNV)gdpa(dev, "vkLatencySleepNV");
-    table->SetLatencyMarkerNV = (PFN_vkSetLatencyMarkerNV)gdpa(dev, "vkSetLatencyMarkerNV");
-    table->GetLatencyTimingsNV = (PFN_vkGetLatencyTimingsNV)gdpa(dev, "vkGetLatencyTimingsNV");
-    table->QueueNotifyOutOfBandNV = (PFN_vkQueueNotifyOutOfBandNV)gdpa(dev, "vkQueueNotifyOutOfBandNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_low_latency2")) {
+        table->SetLatencySleepModeNV = (PFN_vkSetLatencySleepModeNV)gdpa(dev, "vkSetLatencySleepModeNV");
+        table->LatencySleepNV = (PFN_vkLatencySleepNV)gdpa(dev, "vkLatencySleepNV");
+        table->SetLatencyMarkerNV = (PFN_vkSetLatencyMarkerNV)gdpa(dev, "vkSetLatencyMarkerNV");
+        table->GetLatencyTimingsNV = (PFN_vkGetLatencyTimingsNV)gdpa(dev, "vkGetLatencyTimingsNV");
+        table->QueueNotifyOutOfBandNV = (PFN_vkQueueNotifyOutOfBandNV)gdpa(dev, "vkQueueNotifyOutOfBandNV");
+    }
 
     // ---- VK_EXT_attachment_feedback_loop_dynamic_state extension commands
-    table->CmdSetAttachmentFeedbackLoopEnableEXT = (PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT)gdpa(dev, "vkCmdSetAttachmentFeedbackLoopEnableEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_attachment_feedback_loop_dynamic_state")) {
+        table->CmdSetAttachmentFeedbackLoopEnableEXT = (PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT)gdpa(dev, "vkCmdSetAttachmentFeedbackLoopEnableEXT");
+    }
 
     // ---- VK_QNX_external_memory_screen_buffer extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_QNX_external_memory_screen_buffer")) {
 #if defined(VK_USE_PLATFORM_SCREEN_QNX)
-    table->GetScreenBufferPropertiesQNX = (PFN_vkGetScreenBufferPropertiesQNX)gdpa(dev, "vkGetScreenBufferPropertiesQNX");
+        table->GetScreenBufferPropertiesQNX = (PFN_vkGetScreenBufferPropertiesQNX)gdpa(dev, "vkGetScreenBufferPropertiesQNX");
 #endif // VK_USE_PLATFORM_SCREEN_QNX
+    }
 
     // ---- VK_NV_cluster_acceleration_structure extension commands
-    table->GetClusterAccelerationStructureBuildSizesNV = (PFN_vkGetClusterAccelerationStructureBuildSizesNV)gdpa(dev, "vkGetClusterAccelerationStructureBuildSizesNV");
-    table->CmdBuildClusterAccelerationStructureIndirectNV = (PFN_vkCmdBuildClusterAccelerationStructureIndirectNV)gdpa(dev, "vkCmdBuildClusterAccelerationStructureIndirectNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_cluster_acceleration_structure")) {
+        table->GetClusterAccelerationStructureBuildSizesNV = (PFN_vkGetClusterAccelerationStructureBuildSizesNV)gdpa(dev, "vkGetClusterAccelerationStructureBuildSizesNV");
+        table->CmdBuildClusterAccelerationStructureIndirectNV = (PFN_vkCmdBuildClusterAccelerationStructureIndirectNV)gdpa(dev, "vkCmdBuildClusterAccelerationStructureIndirectNV");
+    }
 
     // ---- VK_NV_partitioned_acceleration_structure extension commands
-    table->GetPartitionedAccelerationStructuresBuildSizesNV = (PFN_vkGetPartitionedAccelerationStructuresBuildSizesNV)gdpa(dev, "vkGetPartitionedAccelerationStructuresBuildSizesNV");
-    table->CmdBuildPartitionedAccelerationStructuresNV = (PFN_vkCmdBuildPartitionedAccelerationStructuresNV)gdpa(dev, "vkCmdBuildPartitionedAccelerationStructuresNV");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_NV_partitioned_acceleration_structure")) {
+        table->GetPartitionedAccelerationStructuresBuildSizesNV = (PFN_vkGetPartitionedAccelerationStructuresBuildSizesNV)gdpa(dev, "vkGetPartitionedAccelerationStructuresBuildSizesNV");
+        table->CmdBuildPartitionedAccelerationStructuresNV = (PFN_vkCmdBuildPartitionedAccelerationStructuresNV)gdpa(dev, "vkCmdBuildPartitionedAccelerationStructuresNV");
+    }
 
     // ---- VK_EXT_device_generated_commands extension commands
-    table->GetGeneratedCommandsMemoryRequirementsEXT = (PFN_vkGetGeneratedCommandsMemoryRequirementsEXT)gdpa(dev, "vkGetGeneratedCommandsMemoryRequirementsEXT");
-    table->CmdPreprocessGeneratedCommandsEXT = (PFN_vkCmdPreprocessGeneratedCommandsEXT)gdpa(dev, "vkCmdPreprocessGeneratedCommandsEXT");
-    table->CmdExecuteGeneratedCommandsEXT = (PFN_vkCmdExecuteGeneratedCommandsEXT)gdpa(dev, "vkCmdExecuteGeneratedCommandsEXT");
-    table->CreateIndirectCommandsLayoutEXT = (PFN_vkCreateIndirectCommandsLayoutEXT)gdpa(dev, "vkCreateIndirectCommandsLayoutEXT");
-    table->DestroyIndirectCommandsLayoutEXT = (PFN_vkDestroyIndirectCommandsLayoutEXT)gdpa(dev, "vkDestroyIndirectCommandsLayoutEXT");
-    table->CreateIndirectExecutionSetEXT = (PFN_vkCreateIndirectExecutionSetEXT)gdpa(dev, "vkCreateIndirectExecutionSetEXT");
-    table->DestroyIndirectExecutionSetEXT = (PFN_vkDestroyIndirectExecutionSetEXT)gdpa(dev, "vkDestroyIndirectExecutionSetEXT");
-    table->UpdateIndirectExecutionSetPipelineEXT = (PFN_vkUpdateIndirectExecutionSetPipelineEXT)gdpa(dev, "vkUpdateIndirectExecutionSetPipelineEXT");
-    table->UpdateIndirectExecutionSetShaderEXT = (PFN_vkUpdateIndirectExecutionSetShaderEXT)gdpa(dev, "vkUpdateIndirectExecutionSetShaderEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_device_generated_commands")) {
+        table->GetGeneratedCommandsMemoryRequirementsEXT = (PFN_vkGetGeneratedCommandsMemoryRequirementsEXT)gdpa(dev, "vkGetGeneratedCommandsMemoryRequirementsEXT");
+        table->CmdPreprocessGeneratedCommandsEXT = (PFN_vkCmdPreprocessGeneratedCommandsEXT)gdpa(dev, "vkCmdPreprocessGeneratedCommandsEXT");
+        table->CmdExecuteGeneratedCommandsEXT = (PFN_vkCmdExecuteGeneratedCommandsEXT)gdpa(dev, "vkCmdExecuteGeneratedCommandsEXT");
+        table->CreateIndirectCommandsLayoutEXT = (PFN_vkCreateIndirectCommandsLayoutEXT)gdpa(dev, "vkCreateIndirectCommandsLayoutEXT");
+        table->DestroyIndirectCommandsLayoutEXT = (PFN_vkDestroyIndirectCommandsLayoutEXT)gdpa(dev, "vkDestroyIndirectCommandsLayoutEXT");
+        table->CreateIndirectExecutionSetEXT = (PFN_vkCreateIndirectExecutionSetEXT)gdpa(dev, "vkCreateIndirectExecutionSetEXT");
+        table->DestroyIndirectExecutionSetEXT = (PFN_vkDestroyIndirectExecutionSetEXT)gdpa(dev, "vkDestroyIndirectExecutionSetEXT");
+        table->UpdateIndirectExecutionSetPipelineEXT = (PFN_vkUpdateIndirectExecutionSetPipelineEXT)gdpa(dev, "vkUpdateIndirectExecutionSetPipelineEXT");
+        table->UpdateIndirectExecutionSetShaderEXT = (PFN_vkUpdateIndirectExecutionSetShaderEXT)gdpa(dev, "vkUpdateIndirectExecutionSetShaderEXT");
+    }
 
     // ---- VK_EXT_external_memory_metal extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_external_memory_metal")) {
 #if defined(VK_USE_PLATFORM_METAL_EXT)
-    table->GetMemoryMetalHandleEXT = (PFN_vkGetMemoryMetalHandleEXT)gdpa(dev, "vkGetMemoryMetalHandleEXT");
+        table->GetMemoryMetalHandleEXT = (PFN_vkGetMemoryMetalHandleEXT)gdpa(dev, "vkGetMemoryMetalHandleEXT");
 #endif // VK_USE_PLATFORM_METAL_EXT
 #if defined(VK_USE_PLATFORM_METAL_EXT)
-    table->GetMemoryMetalHandlePropertiesEXT = (PFN_vkGetMemoryMetalHandlePropertiesEXT)gdpa(dev, "vkGetMemoryMetalHandlePropertiesEXT");
+        table->GetMemoryMetalHandlePropertiesEXT = (PFN_vkGetMemoryMetalHandlePropertiesEXT)gdpa(dev, "vkGetMemoryMetalHandlePropertiesEXT");
 #endif // VK_USE_PLATFORM_METAL_EXT
+    }
 
     // ---- VK_KHR_acceleration_structure extension commands
-    table->CreateAccelerationStructureKHR = (PFN_vkCreateAccelerationStructureKHR)gdpa(dev, "vkCreateAccelerationStructureKHR");
-    table->DestroyAccelerationStructureKHR = (PFN_vkDestroyAccelerationStructureKHR)gdpa(dev, "vkDestroyAccelerationStructureKHR");
-    table->CmdBuildAccelerationStructuresKHR = (PFN_vkCmdBuildAccelerationStructuresKHR)gdpa(dev, "vkCmdBuildAccelerationStructuresKHR");
-    table->CmdBuildAccelerationStructuresIndirectKHR = (PFN_vkCmdBuildAccelerationStructuresIndirectKHR)gdpa(dev, "vkCmdBuildAccelerationStructuresIndirectKHR");
-    table->BuildAccelerationStructuresKHR = (PFN_vkBuildAccelerationStructuresKHR)gdpa(dev, "vkBuildAccelerationStructuresKHR");
-    table->CopyAccelerationStructureKHR = (PFN_vkCopyAccelerationStructureKHR)gdpa(dev, "vkCopyAccelerationStructureKHR");
-    table->CopyAccelerationStructureToMemoryKHR = (PFN_vkCopyAccelerationStructureToMemoryKHR)gdpa(dev, "vkCopyAccelerationStructureToMemoryKHR");
-    table->CopyMemoryToAccelerationStructureKHR = (PFN_vkCopyMemoryToAccelerationStructureKHR)gdpa(dev, "vkCopyMemoryToAccelerationStructureKHR");
-    table->WriteAccelerationStructuresPropertiesKHR = (PFN_vkWriteAccelerationStructuresPropertiesKHR)gdpa(dev, "vkWriteAccelerationStructuresPropertiesKHR");
-    table->CmdCopyAccelerationStructureKHR = (PFN_vkCmdCopyAccelerationStructureKHR)gdpa(dev, "vkCmdCopyAccelerationStructureKHR");
-    table->CmdCopyAccelerationStructureToMemoryKHR = (PFN_vkCmdCopyAccelerationStructureToMemoryKHR)gdpa(dev, "vkCmdCopyAccelerationStructureToMemoryKHR");
-    table->CmdCopyMemoryToAccelerationStructureKHR = (PFN_vkCmdCopyMemoryToAccelerationStructureKHR)gdpa(dev, "vkCmdCopyMemoryToAccelerationStructureKHR");
-    table->GetAccelerationStructureDeviceAddressKHR = (PFN_vkGetAccelerationStructureDeviceAddressKHR)gdpa(dev, "vkGetAccelerationStructureDeviceAddressKHR");
-    table->CmdWriteAccelerationStructuresPropertiesKHR = (PFN_vkCmdWriteAccelerationStructuresPropertiesKHR)gdpa(dev, "vkCmdWriteAccelerationStructuresPropertiesKHR");
-    table->GetDeviceAccelerationStructureCompatibilityKHR = (PFN_vkGetDeviceAccelerationStructureCompatibilityKHR)gdpa(dev, "vkGetDeviceAccelerationStructureCompatibilityKHR");
-    table->GetAccelerationStructureBuildSizesKHR = (PFN_vkGetAccelerationStructureBuildSizesKHR)gdpa(dev, "vkGetAccelerationStructureBuildSizesKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_acceleration_structure")) {
+        table->CreateAccelerationStructureKHR = (PFN_vkCreateAccelerationStructureKHR)gdpa(dev, "vkCreateAccelerationStructureKHR");
+        table->DestroyAccelerationStructureKHR = (PFN_vkDestroyAccelerationStructureKHR)gdpa(dev, "vkDestroyAccelerationStructureKHR");
+        table->CmdBuildAccelerationStructuresKHR = (PFN_vkCmdBuildAccelerationStructuresKHR)gdpa(dev, "vkCmdBuildAccelerationStructuresKHR");
+        table->CmdBuildAccelerationStructuresIndirectKHR = (PFN_vkCmdBuildAccelerationStructuresIndirectKHR)gdpa(dev, "vkCmdBuildAccelerationStructuresIndirectKHR");
+        table->BuildAccelerationStructuresKHR = (PFN_vkBuildAccelerationStructuresKHR)gdpa(dev, "vkBuildAccelerationStructuresKHR");
+        table->CopyAccelerationStructureKHR = (PFN_vkCopyAccelerationStructureKHR)gdpa(dev, "vkCopyAccelerationStructureKHR");
+        table->CopyAccelerationStructureToMemoryKHR = (PFN_vkCopyAccelerationStructureToMemoryKHR)gdpa(dev, "vkCopyAccelerationStructureToMemoryKHR");
+        table->CopyMemoryToAccelerationStructureKHR = (PFN_vkCopyMemoryToAccelerationStructureKHR)gdpa(dev, "vkCopyMemoryToAccelerationStructureKHR");
+        table->WriteAccelerationStructuresPropertiesKHR = (PFN_vkWriteAccelerationStructuresPropertiesKHR)gdpa(dev, "vkWriteAccelerationStructuresPropertiesKHR");
+        table->CmdCopyAccelerationStructureKHR = (PFN_vkCmdCopyAccelerationStructureKHR)gdpa(dev, "vkCmdCopyAccelerationStructureKHR");
+        table->CmdCopyAccelerationStructureToMemoryKHR = (PFN_vkCmdCopyAccelerationStructureToMemoryKHR)gdpa(dev, "vkCmdCopyAccelerationStructureToMemoryKHR");
+        table->CmdCopyMemoryToAccelerationStructureKHR = (PFN_vkCmdCopyMemoryToAccelerationStructureKHR)gdpa(dev, "vkCmdCopyMemoryToAccelerationStructureKHR");
+        table->GetAccelerationStructureDeviceAddressKHR = (PFN_vkGetAccelerationStructureDeviceAddressKHR)gdpa(dev, "vkGetAccelerationStructureDeviceAddressKHR");
+        table->CmdWriteAccelerationStructuresPropertiesKHR = (PFN_vkCmdWriteAccelerationStructuresPropertiesKHR)gdpa(dev, "vkCmdWriteAccelerationStructuresPropertiesKHR");
+        table->GetDeviceAccelerationStructureCompatibilityKHR = (PFN_vkGetDeviceAccelerationStructureCompatibilityKHR)gdpa(dev, "vkGetDeviceAccelerationStructureCompatibilityKHR");
+        table->GetAccelerationStructureBuildSizesKHR = (PFN_vkGetAccelerationStructureBuildSizesKHR)gdpa(dev, "vkGetAccelerationStructureBuildSizesKHR");
+    }
 
     // ---- VK_KHR_ray_tracing_pipeline extension commands
-    table->CmdTraceRaysKHR = (PFN_vkCmdTraceRaysKHR)gdpa(dev, "vkCmdTraceRaysKHR");
-    table->CreateRayTracingPipelinesKHR = (PFN_vkCreateRayTracingPipelinesKHR)gdpa(dev, "vkCreateRayTracingPipelinesKHR");
-    table->GetRayTracingCaptureReplayShaderGroupHandlesKHR = (PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR)gdpa(dev, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
-    table->CmdTraceRaysIndirectKHR = (PFN_vkCmdTraceRaysIndirectKHR)gdpa(dev, "vkCmdTraceRaysIndirectKHR");
-    table->GetRayTracingShaderGroupStackSizeKHR = (PFN_vkGetRayTracingShaderGroupStackSizeKHR)gdpa(dev, "vkGetRayTracingShaderGroupStackSizeKHR");
-    table->CmdSetRayTracingPipelineStackSizeKHR = (PFN_vkCmdSetRayTracingPipelineStackSizeKHR)gdpa(dev, "vkCmdSetRayTracingPipelineStackSizeKHR");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_KHR_ray_tracing_pipeline")) {
+        table->CmdTraceRaysKHR = (PFN_vkCmdTraceRaysKHR)gdpa(dev, "vkCmdTraceRaysKHR");
+        table->CreateRayTracingPipelinesKHR = (PFN_vkCreateRayTracingPipelinesKHR)gdpa(dev, "vkCreateRayTracingPipelinesKHR");
+        table->GetRayTracingCaptureReplayShaderGroupHandlesKHR = (PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR)gdpa(dev, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
+        table->CmdTraceRaysIndirectKHR = (PFN_vkCmdTraceRaysIndirectKHR)gdpa(dev, "vkCmdTraceRaysIndirectKHR");
+        table->GetRayTracingShaderGroupStackSizeKHR = (PFN_vkGetRayTracingShaderGroupStackSizeKHR)gdpa(dev, "vkGetRayTracingShaderGroupStackSizeKHR");
+        table->CmdSetRayTracingPipelineStackSizeKHR = (PFN_vkCmdSetRayTracingPipelineStackSizeKHR)gdpa(dev, "vkCmdSetRayTracingPipelineStackSizeKHR");
+    }
 
     // ---- VK_EXT_mesh_shader extension commands
-    table->CmdDrawMeshTasksEXT = (PFN_vkCmdDrawMeshTasksEXT)gdpa(dev, "vkCmdDrawMeshTasksEXT");
-    table->CmdDrawMeshTasksIndirectEXT = (PFN_vkCmdDrawMeshTasksIndirectEXT)gdpa(dev, "vkCmdDrawMeshTasksIndirectEXT");
-    table->CmdDrawMeshTasksIndirectCountEXT = (PFN_vkCmdDrawMeshTasksIndirectCountEXT)gdpa(dev, "vkCmdDrawMeshTasksIndirectCountEXT");
+    if (loader_device_extension_enabled(pCreateInfo, "VK_EXT_mesh_shader")) {
+        table->CmdDrawMeshTasksEXT = (PFN_vkCmdDrawMeshTasksEXT)gdpa(dev, "vkCmdDrawMeshTasksEXT");
+        table->CmdDrawMeshTasksIndirectEXT = (PFN_vkCmdDrawMeshTasksIndirectEXT)gdpa(dev, "vkCmdDrawMeshTasksIndirectEXT");
+        table->CmdDrawMeshTasksIndirectCountEXT = (PFN_vkCmdDrawMeshTasksIndirectCountEXT)gdpa(dev, "vkCmdDrawMeshTasksIndirectCountEXT");
+    }
 
     // ---- VK_OHOS_native_buffer extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_OHOS_native_buffer")) {
 #if defined(VK_USE_PLATFORM_OHOS)
-    table->GetSwapchainGrallocUsageOHOS = (PFN_vkGetSwapchainGrallocUsageOHOS)gdpa(dev, "vkGetSwapchainGrallocUsageOHOS");
+        table->GetSwapchainGrallocUsageOHOS = (PFN_vkGetSwapchainGrallocUsageOHOS)gdpa(dev, "vkGetSwapchainGrallocUsageOHOS");
 #endif // VK_USE_PLATFORM_OHOS
 #if defined(VK_USE_PLATFORM_OHOS)
-    table->AcquireImageOHOS = (PFN_vkAcquireImageOHOS)gdpa(dev, "vkAcquireImageOHOS");
+        table->AcquireImageOHOS = (PFN_vkAcquireImageOHOS)gdpa(dev, "vkAcquireImageOHOS");
 #endif // VK_USE_PLATFORM_OHOS
 #if defined(VK_USE_PLATFORM_OHOS)
-    table->QueueSignalReleaseImageOHOS = (PFN_vkQueueSignalReleaseImageOHOS)gdpa(dev, "vkQueueSignalReleaseImageOHOS");
+        table->QueueSignalReleaseImageOHOS = (PFN_vkQueueSignalReleaseImageOHOS)gdpa(dev, "vkQueueSignalReleaseImageOHOS");
 #endif // VK_USE_PLATFORM_OHOS
+    }
 
     // ---- VK_OHOS_external_memory extension commands
+    if (loader_device_extension_enabled(pCreateInfo, "VK_OHOS_external_memory")) {
 #if defined(VK_USE_PLATFORM_OHOS)
-    table->GetNativeBufferPropertiesOHOS = (PFN_vkGetNativeBufferPropertiesOHOS)gdpa(dev, "vkGetNativeBufferPropertiesOHOS");
+        table->GetNativeBufferPropertiesOHOS = (PFN_vkGetNativeBufferPropertiesOHOS)gdpa(dev, "vkGetNativeBufferPropertiesOHOS");
 #endif // VK_USE_PLATFORM_OHOS
 #if defined(VK_USE_PLATFORM_OHOS)
-    table->GetMemoryNativeBufferOHOS = (PFN_vkGetMemoryNativeBufferOHOS)gdpa(dev, "vkGetMemoryNativeBufferOHOS");
+        table->GetMemoryNativeBufferOHOS = (PFN_vkGetMemoryNativeBufferOHOS)gdpa(dev, "vkGetMemoryNativeBufferOHOS");
 #endif // VK_USE_PLATFORM_OHOS
+    }
 }
 
 // Init Instance function pointer dispatch table with core commands
@@ -1473,101 +1755,6939 @@ VKAPI_ATTR void VKAPI_CALL loader_init_instance_extension_dispatch_table(VkLayer
     // ---- VK_EXT_display_surface_counter extension commands
     table->GetPhysicalDeviceSurfaceCapabilities2EXT = (PFN_vkGetPhysicalDeviceSurfaceCapabilities2EXT)gpa(inst, "vkGetPhysicalDeviceSurfaceCapabilities2EXT");
 
-    // ---- VK_MVK_ios_surface extension commands
-#if defined(VK_USE_PLATFORM_IOS_MVK)
-    table->CreateIOSSurfaceMVK = (PFN_vkCreateIOSSurfaceMVK)gpa(inst, "vkCreateIOSSurfaceMVK");
-#endif // VK_USE_PLATFORM_IOS_MVK
+    // ---- VK_MVK_ios_surface extension commands
+#if defined(VK_USE_PLATFORM_IOS_MVK)
+    table->CreateIOSSurfaceMVK = (PFN_vkCreateIOSSurfaceMVK)gpa(inst, "vkCreateIOSSurfaceMVK");
+#endif // VK_USE_PLATFORM_IOS_MVK
+
+    // ---- VK_MVK_macos_surface extension commands
+#if defined(VK_USE_PLATFORM_MACOS_MVK)
+    table->CreateMacOSSurfaceMVK = (PFN_vkCreateMacOSSurfaceMVK)gpa(inst, "vkCreateMacOSSurfaceMVK");
+#endif // VK_USE_PLATFORM_MACOS_MVK
+
+    // ---- VK_EXT_debug_utils extension commands
+    table->CreateDebugUtilsMessengerEXT = (PFN_vkCreateDebugUtilsMessengerEXT)gpa(inst, "vkCreateDebugUtilsMessengerEXT");
+    table->DestroyDebugUtilsMessengerEXT = (PFN_vkDestroyDebugUtilsMessengerEXT)gpa(inst, "vkDestroyDebugUtilsMessengerEXT");
+    table->SubmitDebugUtilsMessageEXT = (PFN_vkSubmitDebugUtilsMessageEXT)gpa(inst, "vkSubmitDebugUtilsMessageEXT");
+
+    // ---- VK_EXT_sample_locations extension commands
+    table->GetPhysicalDeviceMultisamplePropertiesEXT = (PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT)gpa(inst, "vkGetPhysicalDeviceMultisamplePropertiesEXT");
+
+    // ---- VK_EXT_calibrated_timestamps extension commands
+    table->GetPhysicalDeviceCalibrateableTimeDomainsEXT = (PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT)gpa(inst, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
+
+    // ---- VK_FUCHSIA_imagepipe_surface extension commands
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+    table->CreateImagePipeSurfaceFUCHSIA = (PFN_vkCreateImagePipeSurfaceFUCHSIA)gpa(inst, "vkCreateImagePipeSurfaceFUCHSIA");
+#endif // VK_USE_PLATFORM_FUCHSIA
+
+    // ---- VK_EXT_metal_surface extension commands
+#if defined(VK_USE_PLATFORM_METAL_EXT)
+    table->CreateMetalSurfaceEXT = (PFN_vkCreateMetalSurfaceEXT)gpa(inst, "vkCreateMetalSurfaceEXT");
+#endif // VK_USE_PLATFORM_METAL_EXT
+
+    // ---- VK_EXT_tooling_info extension commands
+    table->GetPhysicalDeviceToolPropertiesEXT = (PFN_vkGetPhysicalDeviceToolPropertiesEXT)gpa(inst, "vkGetPhysicalDeviceToolPropertiesEXT");
+
+    // ---- VK_NV_cooperative_matrix extension commands
+    table->GetPhysicalDeviceCooperativeMatrixPropertiesNV = (PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV)gpa(inst, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
+
+    // ---- VK_NV_coverage_reduction_mode extension commands
+    table->GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV = (PFN_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV)gpa(inst, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
+
+    // ---- VK_EXT_full_screen_exclusive extension commands
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    table->GetPhysicalDeviceSurfacePresentModes2EXT = (PFN_vkGetPhysicalDeviceSurfacePresentModes2EXT)gpa(inst, "vkGetPhysicalDeviceSurfacePresentModes2EXT");
+#endif // VK_USE_PLATFORM_WIN32_KHR
+
+    // ---- VK_EXT_headless_surface extension commands
+    table->CreateHeadlessSurfaceEXT = (PFN_vkCreateHeadlessSurfaceEXT)gpa(inst, "vkCreateHeadlessSurfaceEXT");
+
+    // ---- VK_EXT_acquire_drm_display extension commands
+    table->AcquireDrmDisplayEXT = (PFN_vkAcquireDrmDisplayEXT)gpa(inst, "vkAcquireDrmDisplayEXT");
+    table->GetDrmDisplayEXT = (PFN_vkGetDrmDisplayEXT)gpa(inst, "vkGetDrmDisplayEXT");
+
+    // ---- VK_NV_acquire_winrt_display extension commands
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    table->AcquireWinrtDisplayNV = (PFN_vkAcquireWinrtDisplayNV)gpa(inst, "vkAcquireWinrtDisplayNV");
+#endif // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    table->GetWinrtDisplayNV = (PFN_vkGetWinrtDisplayNV)gpa(inst, "vkGetWinrtDisplayNV");
+#endif // VK_USE_PLATFORM_WIN32_KHR
+
+    // ---- VK_EXT_directfb_surface extension commands
+#if defined(VK_USE_PLATFORM_DIRECTFB_EXT)
+    table->CreateDirectFBSurfaceEXT = (PFN_vkCreateDirectFBSurfaceEXT)gpa(inst, "vkCreateDirectFBSurfaceEXT");
+#endif // VK_USE_PLATFORM_DIRECTFB_EXT
+#if defined(VK_USE_PLATFORM_DIRECTFB_EXT)
+    table->GetPhysicalDeviceDirectFBPresentationSupportEXT = (PFN_vkGetPhysicalDeviceDirectFBPresentationSupportEXT)gpa(inst, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
+#endif // VK_USE_PLATFORM_DIRECTFB_EXT
+
+    // ---- VK_QNX_screen_surface extension commands
+#if defined(VK_USE_PLATFORM_SCREEN_QNX)
+    table->CreateScreenSurfaceQNX = (PFN_vkCreateScreenSurfaceQNX)gpa(inst, "vkCreateScreenSurfaceQNX");
+#endif // VK_USE_PLATFORM_SCREEN_QNX
+#if defined(VK_USE_PLATFORM_SCREEN_QNX)
+    table->GetPhysicalDeviceScreenPresentationSupportQNX = (PFN_vkGetPhysicalDeviceScreenPresentationSupportQNX)gpa(inst, "vkGetPhysicalDeviceScreenPresentationSupportQNX");
+#endif // VK_USE_PLATFORM_SCREEN_QNX
+
+    // ---- VK_NV_optical_flow extension commands
+    table->GetPhysicalDeviceOpticalFlowImageFormatsNV = (PFN_vkGetPhysicalDeviceOpticalFlowImageFormatsNV)gpa(inst, "vkGetPhysicalDeviceOpticalFlowImageFormatsNV");
+
+#if defined(VK_USE_PLATFORM_OHOS)
+    table->CreateSurfaceOHOS = (PFN_vkCreateSurfaceOHOS)gpa(inst, "vkCreateSurfaceOHOS");
+#endif // VK_USE_PLATFORM_OHOS
+
+    // ---- VK_NV_cooperative_vector extension commands
+    table->GetPhysicalDeviceCooperativeVectorPropertiesNV = (PFN_vkGetPhysicalDeviceCooperativeVectorPropertiesNV)gpa(inst, "vkGetPhysicalDeviceCooperativeVectorPropertiesNV");
+
+    // ---- VK_NV_cooperative_matrix2 extension commands
+    table->GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV = (PFN_vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV)gpa(inst, "vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV");
+}
+
+// Resolve-on-first-call stubs for the lazy device dispatch mode. Each one looks its command up through the top of the
+// device chain, stores it in the dispatch table and then calls it, so later calls go straight to the command.
+
+// ---- Core Vulkan 1.0 commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyDevice(
+    VkDevice                                    device,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyDevice fp = (PFN_vkDestroyDevice)loader_resolve_lazy_device_command(table, "vkDestroyDevice",
+        (PFN_vkVoidFunction *)&table->DestroyDevice);
+    fp(device, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceQueue(
+    VkDevice                                    device,
+    uint32_t                                    queueNodeIndex,
+    uint32_t                                    queueIndex,
+    VkQueue*                                    pQueue) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceQueue fp = (PFN_vkGetDeviceQueue)loader_resolve_lazy_device_command(table, "vkGetDeviceQueue",
+        (PFN_vkVoidFunction *)&table->GetDeviceQueue);
+    fp(device, queueNodeIndex, queueIndex, pQueue);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_QueueSubmit(
+    VkQueue                                     queue,
+    uint32_t                                    submitCount,
+    const VkSubmitInfo*                         pSubmits,
+    VkFence                                     fence) {
+    VkLayerDispatchTable *table = loader_get_dispatch(queue);
+    PFN_vkQueueSubmit fp = (PFN_vkQueueSubmit)loader_resolve_lazy_device_command(table, "vkQueueSubmit",
+        (PFN_vkVoidFunction *)&table->QueueSubmit);
+    return fp(queue, submitCount, pSubmits, fence);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_QueueWaitIdle(
+    VkQueue                                     queue) {
+    VkLayerDispatchTable *table = loader_get_dispatch(queue);
+    PFN_vkQueueWaitIdle fp = (PFN_vkQueueWaitIdle)loader_resolve_lazy_device_command(table, "vkQueueWaitIdle",
+        (PFN_vkVoidFunction *)&table->QueueWaitIdle);
+    return fp(queue);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_DeviceWaitIdle(
+    VkDevice                                    device) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDeviceWaitIdle fp = (PFN_vkDeviceWaitIdle)loader_resolve_lazy_device_command(table, "vkDeviceWaitIdle",
+        (PFN_vkVoidFunction *)&table->DeviceWaitIdle);
+    return fp(device);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_AllocateMemory(
+    VkDevice                                    device,
+    const VkMemoryAllocateInfo*                 pAllocateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkDeviceMemory*                             pMemory) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkAllocateMemory fp = (PFN_vkAllocateMemory)loader_resolve_lazy_device_command(table, "vkAllocateMemory",
+        (PFN_vkVoidFunction *)&table->AllocateMemory);
+    return fp(device, pAllocateInfo, pAllocator, pMemory);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_FreeMemory(
+    VkDevice                                    device,
+    VkDeviceMemory                              mem,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkFreeMemory fp = (PFN_vkFreeMemory)loader_resolve_lazy_device_command(table, "vkFreeMemory",
+        (PFN_vkVoidFunction *)&table->FreeMemory);
+    fp(device, mem, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_MapMemory(
+    VkDevice                                    device,
+    VkDeviceMemory                              mem,
+    VkDeviceSize                                offset,
+    VkDeviceSize                                size,
+    VkFlags                                     flags,
+    void**                                      ppData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkMapMemory fp = (PFN_vkMapMemory)loader_resolve_lazy_device_command(table, "vkMapMemory",
+        (PFN_vkVoidFunction *)&table->MapMemory);
+    return fp(device, mem, offset, size, flags, ppData);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_UnmapMemory(
+    VkDevice                                    device,
+    VkDeviceMemory                              mem) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkUnmapMemory fp = (PFN_vkUnmapMemory)loader_resolve_lazy_device_command(table, "vkUnmapMemory",
+        (PFN_vkVoidFunction *)&table->UnmapMemory);
+    fp(device, mem);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_FlushMappedMemoryRanges(
+    VkDevice                                    device,
+    uint32_t                                    memoryRangeCount,
+    const VkMappedMemoryRange*                  pMemoryRanges) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkFlushMappedMemoryRanges fp = (PFN_vkFlushMappedMemoryRanges)loader_resolve_lazy_device_command(table, "vkFlushMappedMemoryRanges",
+        (PFN_vkVoidFunction *)&table->FlushMappedMemoryRanges);
+    return fp(device, memoryRangeCount, pMemoryRanges);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_InvalidateMappedMemoryRanges(
+    VkDevice                                    device,
+    uint32_t                                    memoryRangeCount,
+    const VkMappedMemoryRange*                  pMemoryRanges) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkInvalidateMappedMemoryRanges fp = (PFN_vkInvalidateMappedMemoryRanges)loader_resolve_lazy_device_command(table, "vkInvalidateMappedMemoryRanges",
+        (PFN_vkVoidFunction *)&table->InvalidateMappedMemoryRanges);
+    return fp(device, memoryRangeCount, pMemoryRanges);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceMemoryCommitment(
+    VkDevice                                    device,
+    VkDeviceMemory                              memory,
+    VkDeviceSize*                               pCommittedMemoryInBytes) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceMemoryCommitment fp = (PFN_vkGetDeviceMemoryCommitment)loader_resolve_lazy_device_command(table, "vkGetDeviceMemoryCommitment",
+        (PFN_vkVoidFunction *)&table->GetDeviceMemoryCommitment);
+    fp(device, memory, pCommittedMemoryInBytes);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_BindBufferMemory(
+    VkDevice                                    device,
+    VkBuffer                                    buffer,
+    VkDeviceMemory                              mem,
+    VkDeviceSize                                offset) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkBindBufferMemory fp = (PFN_vkBindBufferMemory)loader_resolve_lazy_device_command(table, "vkBindBufferMemory",
+        (PFN_vkVoidFunction *)&table->BindBufferMemory);
+    return fp(device, buffer, mem, offset);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_BindImageMemory(
+    VkDevice                                    device,
+    VkImage                                     image,
+    VkDeviceMemory                              mem,
+    VkDeviceSize                                offset) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkBindImageMemory fp = (PFN_vkBindImageMemory)loader_resolve_lazy_device_command(table, "vkBindImageMemory",
+        (PFN_vkVoidFunction *)&table->BindImageMemory);
+    return fp(device, image, mem, offset);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetBufferMemoryRequirements(
+    VkDevice                                    device,
+    VkBuffer                                    buffer,
+    VkMemoryRequirements*                       pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetBufferMemoryRequirements fp = (PFN_vkGetBufferMemoryRequirements)loader_resolve_lazy_device_command(table, "vkGetBufferMemoryRequirements",
+        (PFN_vkVoidFunction *)&table->GetBufferMemoryRequirements);
+    fp(device, buffer, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetImageMemoryRequirements(
+    VkDevice                                    device,
+    VkImage                                     image,
+    VkMemoryRequirements*                       pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageMemoryRequirements fp = (PFN_vkGetImageMemoryRequirements)loader_resolve_lazy_device_command(table, "vkGetImageMemoryRequirements",
+        (PFN_vkVoidFunction *)&table->GetImageMemoryRequirements);
+    fp(device, image, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetImageSparseMemoryRequirements(
+    VkDevice                                    device,
+    VkImage                                     image,
+    uint32_t*                                   pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements*            pSparseMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageSparseMemoryRequirements fp = (PFN_vkGetImageSparseMemoryRequirements)loader_resolve_lazy_device_command(table, "vkGetImageSparseMemoryRequirements",
+        (PFN_vkVoidFunction *)&table->GetImageSparseMemoryRequirements);
+    fp(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_QueueBindSparse(
+    VkQueue                                     queue,
+    uint32_t                                    bindInfoCount,
+    const VkBindSparseInfo*                     pBindInfo,
+    VkFence                                     fence) {
+    VkLayerDispatchTable *table = loader_get_dispatch(queue);
+    PFN_vkQueueBindSparse fp = (PFN_vkQueueBindSparse)loader_resolve_lazy_device_command(table, "vkQueueBindSparse",
+        (PFN_vkVoidFunction *)&table->QueueBindSparse);
+    return fp(queue, bindInfoCount, pBindInfo, fence);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateFence(
+    VkDevice                                    device,
+    const VkFenceCreateInfo*                    pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkFence*                                    pFence) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateFence fp = (PFN_vkCreateFence)loader_resolve_lazy_device_command(table, "vkCreateFence",
+        (PFN_vkVoidFunction *)&table->CreateFence);
+    return fp(device, pCreateInfo, pAllocator, pFence);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyFence(
+    VkDevice                                    device,
+    VkFence                                     fence,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyFence fp = (PFN_vkDestroyFence)loader_resolve_lazy_device_command(table, "vkDestroyFence",
+        (PFN_vkVoidFunction *)&table->DestroyFence);
+    fp(device, fence, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ResetFences(
+    VkDevice                                    device,
+    uint32_t                                    fenceCount,
+    const VkFence*                              pFences) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkResetFences fp = (PFN_vkResetFences)loader_resolve_lazy_device_command(table, "vkResetFences",
+        (PFN_vkVoidFunction *)&table->ResetFences);
+    return fp(device, fenceCount, pFences);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetFenceStatus(
+    VkDevice                                    device,
+    VkFence                                     fence) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetFenceStatus fp = (PFN_vkGetFenceStatus)loader_resolve_lazy_device_command(table, "vkGetFenceStatus",
+        (PFN_vkVoidFunction *)&table->GetFenceStatus);
+    return fp(device, fence);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_WaitForFences(
+    VkDevice                                    device,
+    uint32_t                                    fenceCount,
+    const VkFence*                              pFences,
+    VkBool32                                    waitAll,
+    uint64_t                                    timeout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkWaitForFences fp = (PFN_vkWaitForFences)loader_resolve_lazy_device_command(table, "vkWaitForFences",
+        (PFN_vkVoidFunction *)&table->WaitForFences);
+    return fp(device, fenceCount, pFences, waitAll, timeout);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateSemaphore(
+    VkDevice                                    device,
+    const VkSemaphoreCreateInfo*                pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkSemaphore*                                pSemaphore) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateSemaphore fp = (PFN_vkCreateSemaphore)loader_resolve_lazy_device_command(table, "vkCreateSemaphore",
+        (PFN_vkVoidFunction *)&table->CreateSemaphore);
+    return fp(device, pCreateInfo, pAllocator, pSemaphore);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroySemaphore(
+    VkDevice                                    device,
+    VkSemaphore                                 semaphore,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroySemaphore fp = (PFN_vkDestroySemaphore)loader_resolve_lazy_device_command(table, "vkDestroySemaphore",
+        (PFN_vkVoidFunction *)&table->DestroySemaphore);
+    fp(device, semaphore, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateEvent(
+    VkDevice                                    device,
+    const VkEventCreateInfo*                    pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkEvent*                                    pEvent) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateEvent fp = (PFN_vkCreateEvent)loader_resolve_lazy_device_command(table, "vkCreateEvent",
+        (PFN_vkVoidFunction *)&table->CreateEvent);
+    return fp(device, pCreateInfo, pAllocator, pEvent);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyEvent(
+    VkDevice                                    device,
+    VkEvent                                     event,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyEvent fp = (PFN_vkDestroyEvent)loader_resolve_lazy_device_command(table, "vkDestroyEvent",
+        (PFN_vkVoidFunction *)&table->DestroyEvent);
+    fp(device, event, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetEventStatus(
+    VkDevice                                    device,
+    VkEvent                                     event) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetEventStatus fp = (PFN_vkGetEventStatus)loader_resolve_lazy_device_command(table, "vkGetEventStatus",
+        (PFN_vkVoidFunction *)&table->GetEventStatus);
+    return fp(device, event);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_SetEvent(
+    VkDevice                                    device,
+    VkEvent                                     event) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkSetEvent fp = (PFN_vkSetEvent)loader_resolve_lazy_device_command(table, "vkSetEvent",
+        (PFN_vkVoidFunction *)&table->SetEvent);
+    return fp(device, event);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ResetEvent(
+    VkDevice                                    device,
+    VkEvent                                     event) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkResetEvent fp = (PFN_vkResetEvent)loader_resolve_lazy_device_command(table, "vkResetEvent",
+        (PFN_vkVoidFunction *)&table->ResetEvent);
+    return fp(device, event);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateQueryPool(
+    VkDevice                                    device,
+    const VkQueryPoolCreateInfo*                pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkQueryPool*                                pQueryPool) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateQueryPool fp = (PFN_vkCreateQueryPool)loader_resolve_lazy_device_command(table, "vkCreateQueryPool",
+        (PFN_vkVoidFunction *)&table->CreateQueryPool);
+    return fp(device, pCreateInfo, pAllocator, pQueryPool);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyQueryPool(
+    VkDevice                                    device,
+    VkQueryPool                                 queryPool,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyQueryPool fp = (PFN_vkDestroyQueryPool)loader_resolve_lazy_device_command(table, "vkDestroyQueryPool",
+        (PFN_vkVoidFunction *)&table->DestroyQueryPool);
+    fp(device, queryPool, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetQueryPoolResults(
+    VkDevice                                    device,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    firstQuery,
+    uint32_t                                    queryCount,
+    size_t                                      dataSize,
+    void*                                       pData,
+    VkDeviceSize                                stride,
+    VkQueryResultFlags                          flags) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetQueryPoolResults fp = (PFN_vkGetQueryPoolResults)loader_resolve_lazy_device_command(table, "vkGetQueryPoolResults",
+        (PFN_vkVoidFunction *)&table->GetQueryPoolResults);
+    return fp(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateBuffer(
+    VkDevice                                    device,
+    const VkBufferCreateInfo*                   pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkBuffer*                                   pBuffer) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateBuffer fp = (PFN_vkCreateBuffer)loader_resolve_lazy_device_command(table, "vkCreateBuffer",
+        (PFN_vkVoidFunction *)&table->CreateBuffer);
+    return fp(device, pCreateInfo, pAllocator, pBuffer);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyBuffer(
+    VkDevice                                    device,
+    VkBuffer                                    buffer,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyBuffer fp = (PFN_vkDestroyBuffer)loader_resolve_lazy_device_command(table, "vkDestroyBuffer",
+        (PFN_vkVoidFunction *)&table->DestroyBuffer);
+    fp(device, buffer, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateBufferView(
+    VkDevice                                    device,
+    const VkBufferViewCreateInfo*               pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkBufferView*                               pView) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateBufferView fp = (PFN_vkCreateBufferView)loader_resolve_lazy_device_command(table, "vkCreateBufferView",
+        (PFN_vkVoidFunction *)&table->CreateBufferView);
+    return fp(device, pCreateInfo, pAllocator, pView);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyBufferView(
+    VkDevice                                    device,
+    VkBufferView                                bufferView,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyBufferView fp = (PFN_vkDestroyBufferView)loader_resolve_lazy_device_command(table, "vkDestroyBufferView",
+        (PFN_vkVoidFunction *)&table->DestroyBufferView);
+    fp(device, bufferView, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateImage(
+    VkDevice                                    device,
+    const VkImageCreateInfo*                    pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkImage*                                    pImage) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateImage fp = (PFN_vkCreateImage)loader_resolve_lazy_device_command(table, "vkCreateImage",
+        (PFN_vkVoidFunction *)&table->CreateImage);
+    return fp(device, pCreateInfo, pAllocator, pImage);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyImage(
+    VkDevice                                    device,
+    VkImage                                     image,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyImage fp = (PFN_vkDestroyImage)loader_resolve_lazy_device_command(table, "vkDestroyImage",
+        (PFN_vkVoidFunction *)&table->DestroyImage);
+    fp(device, image, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetImageSubresourceLayout(
+    VkDevice                                    device,
+    VkImage                                     image,
+    const VkImageSubresource*                   pSubresource,
+    VkSubresourceLayout*                        pLayout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageSubresourceLayout fp = (PFN_vkGetImageSubresourceLayout)loader_resolve_lazy_device_command(table, "vkGetImageSubresourceLayout",
+        (PFN_vkVoidFunction *)&table->GetImageSubresourceLayout);
+    fp(device, image, pSubresource, pLayout);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateImageView(
+    VkDevice                                    device,
+    const VkImageViewCreateInfo*                pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkImageView*                                pView) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateImageView fp = (PFN_vkCreateImageView)loader_resolve_lazy_device_command(table, "vkCreateImageView",
+        (PFN_vkVoidFunction *)&table->CreateImageView);
+    return fp(device, pCreateInfo, pAllocator, pView);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyImageView(
+    VkDevice                                    device,
+    VkImageView                                 imageView,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyImageView fp = (PFN_vkDestroyImageView)loader_resolve_lazy_device_command(table, "vkDestroyImageView",
+        (PFN_vkVoidFunction *)&table->DestroyImageView);
+    fp(device, imageView, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateShaderModule(
+    VkDevice                                    device,
+    const VkShaderModuleCreateInfo*             pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkShaderModule*                             pShader) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateShaderModule fp = (PFN_vkCreateShaderModule)loader_resolve_lazy_device_command(table, "vkCreateShaderModule",
+        (PFN_vkVoidFunction *)&table->CreateShaderModule);
+    return fp(device, pCreateInfo, pAllocator, pShader);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyShaderModule(
+    VkDevice                                    device,
+    VkShaderModule                              shaderModule,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyShaderModule fp = (PFN_vkDestroyShaderModule)loader_resolve_lazy_device_command(table, "vkDestroyShaderModule",
+        (PFN_vkVoidFunction *)&table->DestroyShaderModule);
+    fp(device, shaderModule, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreatePipelineCache(
+    VkDevice                                    device,
+    const VkPipelineCacheCreateInfo*            pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkPipelineCache*                            pPipelineCache) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreatePipelineCache fp = (PFN_vkCreatePipelineCache)loader_resolve_lazy_device_command(table, "vkCreatePipelineCache",
+        (PFN_vkVoidFunction *)&table->CreatePipelineCache);
+    return fp(device, pCreateInfo, pAllocator, pPipelineCache);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyPipelineCache(
+    VkDevice                                    device,
+    VkPipelineCache                             pipelineCache,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyPipelineCache fp = (PFN_vkDestroyPipelineCache)loader_resolve_lazy_device_command(table, "vkDestroyPipelineCache",
+        (PFN_vkVoidFunction *)&table->DestroyPipelineCache);
+    fp(device, pipelineCache, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetPipelineCacheData(
+    VkDevice                                    device,
+    VkPipelineCache                             pipelineCache,
+    size_t*                                     pDataSize,
+    void*                                       pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetPipelineCacheData fp = (PFN_vkGetPipelineCacheData)loader_resolve_lazy_device_command(table, "vkGetPipelineCacheData",
+        (PFN_vkVoidFunction *)&table->GetPipelineCacheData);
+    return fp(device, pipelineCache, pDataSize, pData);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_MergePipelineCaches(
+    VkDevice                                    device,
+    VkPipelineCache                             dstCache,
+    uint32_t                                    srcCacheCount,
+    const VkPipelineCache*                      pSrcCaches) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkMergePipelineCaches fp = (PFN_vkMergePipelineCaches)loader_resolve_lazy_device_command(table, "vkMergePipelineCaches",
+        (PFN_vkVoidFunction *)&table->MergePipelineCaches);
+    return fp(device, dstCache, srcCacheCount, pSrcCaches);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateGraphicsPipelines(
+    VkDevice                                    device,
+    VkPipelineCache                             pipelineCache,
+    uint32_t                                    createInfoCount,
+    const VkGraphicsPipelineCreateInfo*         pCreateInfos,
+    const VkAllocationCallbacks*                pAllocator,
+    VkPipeline*                                 pPipelines) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateGraphicsPipelines fp = (PFN_vkCreateGraphicsPipelines)loader_resolve_lazy_device_command(table, "vkCreateGraphicsPipelines",
+        (PFN_vkVoidFunction *)&table->CreateGraphicsPipelines);
+    return fp(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateComputePipelines(
+    VkDevice                                    device,
+    VkPipelineCache                             pipelineCache,
+    uint32_t                                    createInfoCount,
+    const VkComputePipelineCreateInfo*          pCreateInfos,
+    const VkAllocationCallbacks*                pAllocator,
+    VkPipeline*                                 pPipelines) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateComputePipelines fp = (PFN_vkCreateComputePipelines)loader_resolve_lazy_device_command(table, "vkCreateComputePipelines",
+        (PFN_vkVoidFunction *)&table->CreateComputePipelines);
+    return fp(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyPipeline(
+    VkDevice                                    device,
+    VkPipeline                                  pipeline,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyPipeline fp = (PFN_vkDestroyPipeline)loader_resolve_lazy_device_command(table, "vkDestroyPipeline",
+        (PFN_vkVoidFunction *)&table->DestroyPipeline);
+    fp(device, pipeline, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreatePipelineLayout(
+    VkDevice                                    device,
+    const VkPipelineLayoutCreateInfo*           pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkPipelineLayout*                           pPipelineLayout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreatePipelineLayout fp = (PFN_vkCreatePipelineLayout)loader_resolve_lazy_device_command(table, "vkCreatePipelineLayout",
+        (PFN_vkVoidFunction *)&table->CreatePipelineLayout);
+    return fp(device, pCreateInfo, pAllocator, pPipelineLayout);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyPipelineLayout(
+    VkDevice                                    device,
+    VkPipelineLayout                            pipelineLayout,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyPipelineLayout fp = (PFN_vkDestroyPipelineLayout)loader_resolve_lazy_device_command(table, "vkDestroyPipelineLayout",
+        (PFN_vkVoidFunction *)&table->DestroyPipelineLayout);
+    fp(device, pipelineLayout, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateSampler(
+    VkDevice                                    device,
+    const VkSamplerCreateInfo*                  pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkSampler*                                  pSampler) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateSampler fp = (PFN_vkCreateSampler)loader_resolve_lazy_device_command(table, "vkCreateSampler",
+        (PFN_vkVoidFunction *)&table->CreateSampler);
+    return fp(device, pCreateInfo, pAllocator, pSampler);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroySampler(
+    VkDevice                                    device,
+    VkSampler                                   sampler,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroySampler fp = (PFN_vkDestroySampler)loader_resolve_lazy_device_command(table, "vkDestroySampler",
+        (PFN_vkVoidFunction *)&table->DestroySampler);
+    fp(device, sampler, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateDescriptorSetLayout(
+    VkDevice                                    device,
+    const VkDescriptorSetLayoutCreateInfo*      pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkDescriptorSetLayout*                      pSetLayout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateDescriptorSetLayout fp = (PFN_vkCreateDescriptorSetLayout)loader_resolve_lazy_device_command(table, "vkCreateDescriptorSetLayout",
+        (PFN_vkVoidFunction *)&table->CreateDescriptorSetLayout);
+    return fp(device, pCreateInfo, pAllocator, pSetLayout);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyDescriptorSetLayout(
+    VkDevice                                    device,
+    VkDescriptorSetLayout                       descriptorSetLayout,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyDescriptorSetLayout fp = (PFN_vkDestroyDescriptorSetLayout)loader_resolve_lazy_device_command(table, "vkDestroyDescriptorSetLayout",
+        (PFN_vkVoidFunction *)&table->DestroyDescriptorSetLayout);
+    fp(device, descriptorSetLayout, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateDescriptorPool(
+    VkDevice                                    device,
+    const VkDescriptorPoolCreateInfo*           pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkDescriptorPool*                           pDescriptorPool) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateDescriptorPool fp = (PFN_vkCreateDescriptorPool)loader_resolve_lazy_device_command(table, "vkCreateDescriptorPool",
+        (PFN_vkVoidFunction *)&table->CreateDescriptorPool);
+    return fp(device, pCreateInfo, pAllocator, pDescriptorPool);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyDescriptorPool(
+    VkDevice                                    device,
+    VkDescriptorPool                            descriptorPool,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyDescriptorPool fp = (PFN_vkDestroyDescriptorPool)loader_resolve_lazy_device_command(table, "vkDestroyDescriptorPool",
+        (PFN_vkVoidFunction *)&table->DestroyDescriptorPool);
+    fp(device, descriptorPool, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ResetDescriptorPool(
+    VkDevice                                    device,
+    VkDescriptorPool                            descriptorPool,
+    VkDescriptorPoolResetFlags                  flags) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkResetDescriptorPool fp = (PFN_vkResetDescriptorPool)loader_resolve_lazy_device_command(table, "vkResetDescriptorPool",
+        (PFN_vkVoidFunction *)&table->ResetDescriptorPool);
+    return fp(device, descriptorPool, flags);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_AllocateDescriptorSets(
+    VkDevice                                    device,
+    const VkDescriptorSetAllocateInfo*          pAllocateInfo,
+    VkDescriptorSet*                            pDescriptorSets) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkAllocateDescriptorSets fp = (PFN_vkAllocateDescriptorSets)loader_resolve_lazy_device_command(table, "vkAllocateDescriptorSets",
+        (PFN_vkVoidFunction *)&table->AllocateDescriptorSets);
+    return fp(device, pAllocateInfo, pDescriptorSets);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_FreeDescriptorSets(
+    VkDevice                                    device,
+    VkDescriptorPool                            descriptorPool,
+    uint32_t                                    descriptorSetCount,
+    const VkDescriptorSet*                      pDescriptorSets) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkFreeDescriptorSets fp = (PFN_vkFreeDescriptorSets)loader_resolve_lazy_device_command(table, "vkFreeDescriptorSets",
+        (PFN_vkVoidFunction *)&table->FreeDescriptorSets);
+    return fp(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_UpdateDescriptorSets(
+    VkDevice                                    device,
+    uint32_t                                    descriptorWriteCount,
+    const VkWriteDescriptorSet*                 pDescriptorWrites,
+    uint32_t                                    descriptorCopyCount,
+    const VkCopyDescriptorSet*                  pDescriptorCopies) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkUpdateDescriptorSets fp = (PFN_vkUpdateDescriptorSets)loader_resolve_lazy_device_command(table, "vkUpdateDescriptorSets",
+        (PFN_vkVoidFunction *)&table->UpdateDescriptorSets);
+    fp(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateFramebuffer(
+    VkDevice                                    device,
+    const VkFramebufferCreateInfo*              pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkFramebuffer*                              pFramebuffer) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateFramebuffer fp = (PFN_vkCreateFramebuffer)loader_resolve_lazy_device_command(table, "vkCreateFramebuffer",
+        (PFN_vkVoidFunction *)&table->CreateFramebuffer);
+    return fp(device, pCreateInfo, pAllocator, pFramebuffer);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyFramebuffer(
+    VkDevice                                    device,
+    VkFramebuffer                               framebuffer,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyFramebuffer fp = (PFN_vkDestroyFramebuffer)loader_resolve_lazy_device_command(table, "vkDestroyFramebuffer",
+        (PFN_vkVoidFunction *)&table->DestroyFramebuffer);
+    fp(device, framebuffer, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateRenderPass(
+    VkDevice                                    device,
+    const VkRenderPassCreateInfo*               pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkRenderPass*                               pRenderPass) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateRenderPass fp = (PFN_vkCreateRenderPass)loader_resolve_lazy_device_command(table, "vkCreateRenderPass",
+        (PFN_vkVoidFunction *)&table->CreateRenderPass);
+    return fp(device, pCreateInfo, pAllocator, pRenderPass);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyRenderPass(
+    VkDevice                                    device,
+    VkRenderPass                                renderPass,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyRenderPass fp = (PFN_vkDestroyRenderPass)loader_resolve_lazy_device_command(table, "vkDestroyRenderPass",
+        (PFN_vkVoidFunction *)&table->DestroyRenderPass);
+    fp(device, renderPass, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetRenderAreaGranularity(
+    VkDevice                                    device,
+    VkRenderPass                                renderPass,
+    VkExtent2D*                                 pGranularity) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetRenderAreaGranularity fp = (PFN_vkGetRenderAreaGranularity)loader_resolve_lazy_device_command(table, "vkGetRenderAreaGranularity",
+        (PFN_vkVoidFunction *)&table->GetRenderAreaGranularity);
+    fp(device, renderPass, pGranularity);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateCommandPool(
+    VkDevice                                    device,
+    const VkCommandPoolCreateInfo*              pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkCommandPool*                              pCommandPool) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateCommandPool fp = (PFN_vkCreateCommandPool)loader_resolve_lazy_device_command(table, "vkCreateCommandPool",
+        (PFN_vkVoidFunction *)&table->CreateCommandPool);
+    return fp(device, pCreateInfo, pAllocator, pCommandPool);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyCommandPool(
+    VkDevice                                    device,
+    VkCommandPool                               commandPool,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyCommandPool fp = (PFN_vkDestroyCommandPool)loader_resolve_lazy_device_command(table, "vkDestroyCommandPool",
+        (PFN_vkVoidFunction *)&table->DestroyCommandPool);
+    fp(device, commandPool, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ResetCommandPool(
+    VkDevice                                    device,
+    VkCommandPool                               commandPool,
+    VkCommandPoolResetFlags                     flags) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkResetCommandPool fp = (PFN_vkResetCommandPool)loader_resolve_lazy_device_command(table, "vkResetCommandPool",
+        (PFN_vkVoidFunction *)&table->ResetCommandPool);
+    return fp(device, commandPool, flags);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_AllocateCommandBuffers(
+    VkDevice                                    device,
+    const VkCommandBufferAllocateInfo*          pAllocateInfo,
+    VkCommandBuffer*                            pCommandBuffers) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkAllocateCommandBuffers fp = (PFN_vkAllocateCommandBuffers)loader_resolve_lazy_device_command(table, "vkAllocateCommandBuffers",
+        (PFN_vkVoidFunction *)&table->AllocateCommandBuffers);
+    return fp(device, pAllocateInfo, pCommandBuffers);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_FreeCommandBuffers(
+    VkDevice                                    device,
+    VkCommandPool                               commandPool,
+    uint32_t                                    commandBufferCount,
+    const VkCommandBuffer*                      pCommandBuffers) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkFreeCommandBuffers fp = (PFN_vkFreeCommandBuffers)loader_resolve_lazy_device_command(table, "vkFreeCommandBuffers",
+        (PFN_vkVoidFunction *)&table->FreeCommandBuffers);
+    fp(device, commandPool, commandBufferCount, pCommandBuffers);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_BeginCommandBuffer(
+    VkCommandBuffer                             commandBuffer,
+    const VkCommandBufferBeginInfo*             pBeginInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkBeginCommandBuffer fp = (PFN_vkBeginCommandBuffer)loader_resolve_lazy_device_command(table, "vkBeginCommandBuffer",
+        (PFN_vkVoidFunction *)&table->BeginCommandBuffer);
+    return fp(commandBuffer, pBeginInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_EndCommandBuffer(
+    VkCommandBuffer                             commandBuffer) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkEndCommandBuffer fp = (PFN_vkEndCommandBuffer)loader_resolve_lazy_device_command(table, "vkEndCommandBuffer",
+        (PFN_vkVoidFunction *)&table->EndCommandBuffer);
+    return fp(commandBuffer);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ResetCommandBuffer(
+    VkCommandBuffer                             commandBuffer,
+    VkCommandBufferResetFlags                   flags) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkResetCommandBuffer fp = (PFN_vkResetCommandBuffer)loader_resolve_lazy_device_command(table, "vkResetCommandBuffer",
+        (PFN_vkVoidFunction *)&table->ResetCommandBuffer);
+    return fp(commandBuffer, flags);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindPipeline(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    VkPipeline                                  pipeline) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindPipeline fp = (PFN_vkCmdBindPipeline)loader_resolve_lazy_device_command(table, "vkCmdBindPipeline",
+        (PFN_vkVoidFunction *)&table->CmdBindPipeline);
+    fp(commandBuffer, pipelineBindPoint, pipeline);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetViewport(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstViewport,
+    uint32_t                                    viewportCount,
+    const VkViewport*                           pViewports) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetViewport fp = (PFN_vkCmdSetViewport)loader_resolve_lazy_device_command(table, "vkCmdSetViewport",
+        (PFN_vkVoidFunction *)&table->CmdSetViewport);
+    fp(commandBuffer, firstViewport, viewportCount, pViewports);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetScissor(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstScissor,
+    uint32_t                                    scissorCount,
+    const VkRect2D*                             pScissors) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetScissor fp = (PFN_vkCmdSetScissor)loader_resolve_lazy_device_command(table, "vkCmdSetScissor",
+        (PFN_vkVoidFunction *)&table->CmdSetScissor);
+    fp(commandBuffer, firstScissor, scissorCount, pScissors);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetLineWidth(
+    VkCommandBuffer                             commandBuffer,
+    float                                       lineWidth) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetLineWidth fp = (PFN_vkCmdSetLineWidth)loader_resolve_lazy_device_command(table, "vkCmdSetLineWidth",
+        (PFN_vkVoidFunction *)&table->CmdSetLineWidth);
+    fp(commandBuffer, lineWidth);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthBias(
+    VkCommandBuffer                             commandBuffer,
+    float                                       depthBiasConstantFactor,
+    float                                       depthBiasClamp,
+    float                                       depthBiasSlopeFactor) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthBias fp = (PFN_vkCmdSetDepthBias)loader_resolve_lazy_device_command(table, "vkCmdSetDepthBias",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthBias);
+    fp(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetBlendConstants(
+    VkCommandBuffer                             commandBuffer,
+    const float                                 blendConstants[4]) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetBlendConstants fp = (PFN_vkCmdSetBlendConstants)loader_resolve_lazy_device_command(table, "vkCmdSetBlendConstants",
+        (PFN_vkVoidFunction *)&table->CmdSetBlendConstants);
+    fp(commandBuffer, blendConstants);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthBounds(
+    VkCommandBuffer                             commandBuffer,
+    float                                       minDepthBounds,
+    float                                       maxDepthBounds) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthBounds fp = (PFN_vkCmdSetDepthBounds)loader_resolve_lazy_device_command(table, "vkCmdSetDepthBounds",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthBounds);
+    fp(commandBuffer, minDepthBounds, maxDepthBounds);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetStencilCompareMask(
+    VkCommandBuffer                             commandBuffer,
+    VkStencilFaceFlags                          faceMask,
+    uint32_t                                    compareMask) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetStencilCompareMask fp = (PFN_vkCmdSetStencilCompareMask)loader_resolve_lazy_device_command(table, "vkCmdSetStencilCompareMask",
+        (PFN_vkVoidFunction *)&table->CmdSetStencilCompareMask);
+    fp(commandBuffer, faceMask, compareMask);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetStencilWriteMask(
+    VkCommandBuffer                             commandBuffer,
+    VkStencilFaceFlags                          faceMask,
+    uint32_t                                    writeMask) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetStencilWriteMask fp = (PFN_vkCmdSetStencilWriteMask)loader_resolve_lazy_device_command(table, "vkCmdSetStencilWriteMask",
+        (PFN_vkVoidFunction *)&table->CmdSetStencilWriteMask);
+    fp(commandBuffer, faceMask, writeMask);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetStencilReference(
+    VkCommandBuffer                             commandBuffer,
+    VkStencilFaceFlags                          faceMask,
+    uint32_t                                    reference) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetStencilReference fp = (PFN_vkCmdSetStencilReference)loader_resolve_lazy_device_command(table, "vkCmdSetStencilReference",
+        (PFN_vkVoidFunction *)&table->CmdSetStencilReference);
+    fp(commandBuffer, faceMask, reference);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindDescriptorSets(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    VkPipelineLayout                            layout,
+    uint32_t                                    firstSet,
+    uint32_t                                    descriptorSetCount,
+    const VkDescriptorSet*                      pDescriptorSets,
+    uint32_t                                    dynamicOffsetCount,
+    const uint32_t*                             pDynamicOffsets) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindDescriptorSets fp = (PFN_vkCmdBindDescriptorSets)loader_resolve_lazy_device_command(table, "vkCmdBindDescriptorSets",
+        (PFN_vkVoidFunction *)&table->CmdBindDescriptorSets);
+    fp(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindIndexBuffer(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkIndexType                                 indexType) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindIndexBuffer fp = (PFN_vkCmdBindIndexBuffer)loader_resolve_lazy_device_command(table, "vkCmdBindIndexBuffer",
+        (PFN_vkVoidFunction *)&table->CmdBindIndexBuffer);
+    fp(commandBuffer, buffer, offset, indexType);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindVertexBuffers(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstBinding,
+    uint32_t                                    bindingCount,
+    const VkBuffer*                             pBuffers,
+    const VkDeviceSize*                         pOffsets) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindVertexBuffers fp = (PFN_vkCmdBindVertexBuffers)loader_resolve_lazy_device_command(table, "vkCmdBindVertexBuffers",
+        (PFN_vkVoidFunction *)&table->CmdBindVertexBuffers);
+    fp(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDraw(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    vertexCount,
+    uint32_t                                    instanceCount,
+    uint32_t                                    firstVertex,
+    uint32_t                                    firstInstance) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDraw fp = (PFN_vkCmdDraw)loader_resolve_lazy_device_command(table, "vkCmdDraw",
+        (PFN_vkVoidFunction *)&table->CmdDraw);
+    fp(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawIndexed(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    indexCount,
+    uint32_t                                    instanceCount,
+    uint32_t                                    firstIndex,
+    int32_t                                     vertexOffset,
+    uint32_t                                    firstInstance) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawIndexed fp = (PFN_vkCmdDrawIndexed)loader_resolve_lazy_device_command(table, "vkCmdDrawIndexed",
+        (PFN_vkVoidFunction *)&table->CmdDrawIndexed);
+    fp(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawIndirect(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    uint32_t                                    drawCount,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawIndirect fp = (PFN_vkCmdDrawIndirect)loader_resolve_lazy_device_command(table, "vkCmdDrawIndirect",
+        (PFN_vkVoidFunction *)&table->CmdDrawIndirect);
+    fp(commandBuffer, buffer, offset, drawCount, stride);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawIndexedIndirect(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    uint32_t                                    drawCount,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawIndexedIndirect fp = (PFN_vkCmdDrawIndexedIndirect)loader_resolve_lazy_device_command(table, "vkCmdDrawIndexedIndirect",
+        (PFN_vkVoidFunction *)&table->CmdDrawIndexedIndirect);
+    fp(commandBuffer, buffer, offset, drawCount, stride);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDispatch(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    x,
+    uint32_t                                    y,
+    uint32_t                                    z) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDispatch fp = (PFN_vkCmdDispatch)loader_resolve_lazy_device_command(table, "vkCmdDispatch",
+        (PFN_vkVoidFunction *)&table->CmdDispatch);
+    fp(commandBuffer, x, y, z);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDispatchIndirect(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDispatchIndirect fp = (PFN_vkCmdDispatchIndirect)loader_resolve_lazy_device_command(table, "vkCmdDispatchIndirect",
+        (PFN_vkVoidFunction *)&table->CmdDispatchIndirect);
+    fp(commandBuffer, buffer, offset);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyBuffer(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    srcBuffer,
+    VkBuffer                                    dstBuffer,
+    uint32_t                                    regionCount,
+    const VkBufferCopy*                         pRegions) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyBuffer fp = (PFN_vkCmdCopyBuffer)loader_resolve_lazy_device_command(table, "vkCmdCopyBuffer",
+        (PFN_vkVoidFunction *)&table->CmdCopyBuffer);
+    fp(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyImage(
+    VkCommandBuffer                             commandBuffer,
+    VkImage                                     srcImage,
+    VkImageLayout                               srcImageLayout,
+    VkImage                                     dstImage,
+    VkImageLayout                               dstImageLayout,
+    uint32_t                                    regionCount,
+    const VkImageCopy*                          pRegions) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyImage fp = (PFN_vkCmdCopyImage)loader_resolve_lazy_device_command(table, "vkCmdCopyImage",
+        (PFN_vkVoidFunction *)&table->CmdCopyImage);
+    fp(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBlitImage(
+    VkCommandBuffer                             commandBuffer,
+    VkImage                                     srcImage,
+    VkImageLayout                               srcImageLayout,
+    VkImage                                     dstImage,
+    VkImageLayout                               dstImageLayout,
+    uint32_t                                    regionCount,
+    const VkImageBlit*                          pRegions,
+    VkFilter                                    filter) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBlitImage fp = (PFN_vkCmdBlitImage)loader_resolve_lazy_device_command(table, "vkCmdBlitImage",
+        (PFN_vkVoidFunction *)&table->CmdBlitImage);
+    fp(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyBufferToImage(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    srcBuffer,
+    VkImage                                     dstImage,
+    VkImageLayout                               dstImageLayout,
+    uint32_t                                    regionCount,
+    const VkBufferImageCopy*                    pRegions) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyBufferToImage fp = (PFN_vkCmdCopyBufferToImage)loader_resolve_lazy_device_command(table, "vkCmdCopyBufferToImage",
+        (PFN_vkVoidFunction *)&table->CmdCopyBufferToImage);
+    fp(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyImageToBuffer(
+    VkCommandBuffer                             commandBuffer,
+    VkImage                                     srcImage,
+    VkImageLayout                               srcImageLayout,
+    VkBuffer                                    dstBuffer,
+    uint32_t                                    regionCount,
+    const VkBufferImageCopy*                    pRegions) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyImageToBuffer fp = (PFN_vkCmdCopyImageToBuffer)loader_resolve_lazy_device_command(table, "vkCmdCopyImageToBuffer",
+        (PFN_vkVoidFunction *)&table->CmdCopyImageToBuffer);
+    fp(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdUpdateBuffer(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    dstBuffer,
+    VkDeviceSize                                dstOffset,
+    VkDeviceSize                                dataSize,
+    const void*                                 pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdUpdateBuffer fp = (PFN_vkCmdUpdateBuffer)loader_resolve_lazy_device_command(table, "vkCmdUpdateBuffer",
+        (PFN_vkVoidFunction *)&table->CmdUpdateBuffer);
+    fp(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdFillBuffer(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    dstBuffer,
+    VkDeviceSize                                dstOffset,
+    VkDeviceSize                                size,
+    uint32_t                                    data) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdFillBuffer fp = (PFN_vkCmdFillBuffer)loader_resolve_lazy_device_command(table, "vkCmdFillBuffer",
+        (PFN_vkVoidFunction *)&table->CmdFillBuffer);
+    fp(commandBuffer, dstBuffer, dstOffset, size, data);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdClearColorImage(
+    VkCommandBuffer                             commandBuffer,
+    VkImage                                     image,
+    VkImageLayout                               imageLayout,
+    const VkClearColorValue*                    pColor,
+    uint32_t                                    rangeCount,
+    const VkImageSubresourceRange*              pRanges) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdClearColorImage fp = (PFN_vkCmdClearColorImage)loader_resolve_lazy_device_command(table, "vkCmdClearColorImage",
+        (PFN_vkVoidFunction *)&table->CmdClearColorImage);
+    fp(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdClearDepthStencilImage(
+    VkCommandBuffer                             commandBuffer,
+    VkImage                                     image,
+    VkImageLayout                               imageLayout,
+    const VkClearDepthStencilValue*             pDepthStencil,
+    uint32_t                                    rangeCount,
+    const VkImageSubresourceRange*              pRanges) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdClearDepthStencilImage fp = (PFN_vkCmdClearDepthStencilImage)loader_resolve_lazy_device_command(table, "vkCmdClearDepthStencilImage",
+        (PFN_vkVoidFunction *)&table->CmdClearDepthStencilImage);
+    fp(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdClearAttachments(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    attachmentCount,
+    const VkClearAttachment*                    pAttachments,
+    uint32_t                                    rectCount,
+    const VkClearRect*                          pRects) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdClearAttachments fp = (PFN_vkCmdClearAttachments)loader_resolve_lazy_device_command(table, "vkCmdClearAttachments",
+        (PFN_vkVoidFunction *)&table->CmdClearAttachments);
+    fp(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdResolveImage(
+    VkCommandBuffer                             commandBuffer,
+    VkImage                                     srcImage,
+    VkImageLayout                               srcImageLayout,
+    VkImage                                     dstImage,
+    VkImageLayout                               dstImageLayout,
+    uint32_t                                    regionCount,
+    const VkImageResolve*                       pRegions) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdResolveImage fp = (PFN_vkCmdResolveImage)loader_resolve_lazy_device_command(table, "vkCmdResolveImage",
+        (PFN_vkVoidFunction *)&table->CmdResolveImage);
+    fp(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetEvent(
+    VkCommandBuffer                             commandBuffer,
+    VkEvent                                     event,
+    VkPipelineStageFlags                        stageMask) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetEvent fp = (PFN_vkCmdSetEvent)loader_resolve_lazy_device_command(table, "vkCmdSetEvent",
+        (PFN_vkVoidFunction *)&table->CmdSetEvent);
+    fp(commandBuffer, event, stageMask);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdResetEvent(
+    VkCommandBuffer                             commandBuffer,
+    VkEvent                                     event,
+    VkPipelineStageFlags                        stageMask) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdResetEvent fp = (PFN_vkCmdResetEvent)loader_resolve_lazy_device_command(table, "vkCmdResetEvent",
+        (PFN_vkVoidFunction *)&table->CmdResetEvent);
+    fp(commandBuffer, event, stageMask);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdWaitEvents(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    eventCount,
+    const VkEvent*                              pEvents,
+    VkPipelineStageFlags                        sourceStageMask,
+    VkPipelineStageFlags                        dstStageMask,
+    uint32_t                                    memoryBarrierCount,
+    const VkMemoryBarrier*                      pMemoryBarriers,
+    uint32_t                                    bufferMemoryBarrierCount,
+    const VkBufferMemoryBarrier*                pBufferMemoryBarriers,
+    uint32_t                                    imageMemoryBarrierCount,
+    const VkImageMemoryBarrier*                 pImageMemoryBarriers) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdWaitEvents fp = (PFN_vkCmdWaitEvents)loader_resolve_lazy_device_command(table, "vkCmdWaitEvents",
+        (PFN_vkVoidFunction *)&table->CmdWaitEvents);
+    fp(commandBuffer, eventCount, pEvents, sourceStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPipelineBarrier(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineStageFlags                        srcStageMask,
+    VkPipelineStageFlags                        dstStageMask,
+    VkDependencyFlags                           dependencyFlags,
+    uint32_t                                    memoryBarrierCount,
+    const VkMemoryBarrier*                      pMemoryBarriers,
+    uint32_t                                    bufferMemoryBarrierCount,
+    const VkBufferMemoryBarrier*                pBufferMemoryBarriers,
+    uint32_t                                    imageMemoryBarrierCount,
+    const VkImageMemoryBarrier*                 pImageMemoryBarriers) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPipelineBarrier fp = (PFN_vkCmdPipelineBarrier)loader_resolve_lazy_device_command(table, "vkCmdPipelineBarrier",
+        (PFN_vkVoidFunction *)&table->CmdPipelineBarrier);
+    fp(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBeginQuery(
+    VkCommandBuffer                             commandBuffer,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    slot,
+    VkFlags                                     flags) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBeginQuery fp = (PFN_vkCmdBeginQuery)loader_resolve_lazy_device_command(table, "vkCmdBeginQuery",
+        (PFN_vkVoidFunction *)&table->CmdBeginQuery);
+    fp(commandBuffer, queryPool, slot, flags);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdEndQuery(
+    VkCommandBuffer                             commandBuffer,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    slot) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdEndQuery fp = (PFN_vkCmdEndQuery)loader_resolve_lazy_device_command(table, "vkCmdEndQuery",
+        (PFN_vkVoidFunction *)&table->CmdEndQuery);
+    fp(commandBuffer, queryPool, slot);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdResetQueryPool(
+    VkCommandBuffer                             commandBuffer,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    firstQuery,
+    uint32_t                                    queryCount) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdResetQueryPool fp = (PFN_vkCmdResetQueryPool)loader_resolve_lazy_device_command(table, "vkCmdResetQueryPool",
+        (PFN_vkVoidFunction *)&table->CmdResetQueryPool);
+    fp(commandBuffer, queryPool, firstQuery, queryCount);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdWriteTimestamp(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineStageFlagBits                     pipelineStage,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    slot) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdWriteTimestamp fp = (PFN_vkCmdWriteTimestamp)loader_resolve_lazy_device_command(table, "vkCmdWriteTimestamp",
+        (PFN_vkVoidFunction *)&table->CmdWriteTimestamp);
+    fp(commandBuffer, pipelineStage, queryPool, slot);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyQueryPoolResults(
+    VkCommandBuffer                             commandBuffer,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    firstQuery,
+    uint32_t                                    queryCount,
+    VkBuffer                                    dstBuffer,
+    VkDeviceSize                                dstOffset,
+    VkDeviceSize                                stride,
+    VkFlags                                     flags) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyQueryPoolResults fp = (PFN_vkCmdCopyQueryPoolResults)loader_resolve_lazy_device_command(table, "vkCmdCopyQueryPoolResults",
+        (PFN_vkVoidFunction *)&table->CmdCopyQueryPoolResults);
+    fp(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPushConstants(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineLayout                            layout,
+    VkShaderStageFlags                          stageFlags,
+    uint32_t                                    offset,
+    uint32_t                                    size,
+    const void*                                 pValues) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPushConstants fp = (PFN_vkCmdPushConstants)loader_resolve_lazy_device_command(table, "vkCmdPushConstants",
+        (PFN_vkVoidFunction *)&table->CmdPushConstants);
+    fp(commandBuffer, layout, stageFlags, offset, size, pValues);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBeginRenderPass(
+    VkCommandBuffer                             commandBuffer,
+    const VkRenderPassBeginInfo*                pRenderPassBegin,
+    VkSubpassContents                           contents) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBeginRenderPass fp = (PFN_vkCmdBeginRenderPass)loader_resolve_lazy_device_command(table, "vkCmdBeginRenderPass",
+        (PFN_vkVoidFunction *)&table->CmdBeginRenderPass);
+    fp(commandBuffer, pRenderPassBegin, contents);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdNextSubpass(
+    VkCommandBuffer                             commandBuffer,
+    VkSubpassContents                           contents) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdNextSubpass fp = (PFN_vkCmdNextSubpass)loader_resolve_lazy_device_command(table, "vkCmdNextSubpass",
+        (PFN_vkVoidFunction *)&table->CmdNextSubpass);
+    fp(commandBuffer, contents);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdEndRenderPass(
+    VkCommandBuffer                             commandBuffer) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdEndRenderPass fp = (PFN_vkCmdEndRenderPass)loader_resolve_lazy_device_command(table, "vkCmdEndRenderPass",
+        (PFN_vkVoidFunction *)&table->CmdEndRenderPass);
+    fp(commandBuffer);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdExecuteCommands(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    commandBuffersCount,
+    const VkCommandBuffer*                      pCommandBuffers) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdExecuteCommands fp = (PFN_vkCmdExecuteCommands)loader_resolve_lazy_device_command(table, "vkCmdExecuteCommands",
+        (PFN_vkVoidFunction *)&table->CmdExecuteCommands);
+    fp(commandBuffer, commandBuffersCount, pCommandBuffers);
+}
+
+// ---- Core Vulkan 1.1 commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_BindBufferMemory2(
+    VkDevice                                    device,
+    uint32_t                                    bindInfoCount,
+    const VkBindBufferMemoryInfo*               pBindInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkBindBufferMemory2 fp = (PFN_vkBindBufferMemory2)loader_resolve_lazy_device_command(table, "vkBindBufferMemory2",
+        (PFN_vkVoidFunction *)&table->BindBufferMemory2);
+    return fp(device, bindInfoCount, pBindInfos);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_BindImageMemory2(
+    VkDevice                                    device,
+    uint32_t                                    bindInfoCount,
+    const VkBindImageMemoryInfo*                pBindInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkBindImageMemory2 fp = (PFN_vkBindImageMemory2)loader_resolve_lazy_device_command(table, "vkBindImageMemory2",
+        (PFN_vkVoidFunction *)&table->BindImageMemory2);
+    return fp(device, bindInfoCount, pBindInfos);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceGroupPeerMemoryFeatures(
+    VkDevice                                    device,
+    uint32_t                                    heapIndex,
+    uint32_t                                    localDeviceIndex,
+    uint32_t                                    remoteDeviceIndex,
+    VkPeerMemoryFeatureFlags*                   pPeerMemoryFeatures) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceGroupPeerMemoryFeatures fp = (PFN_vkGetDeviceGroupPeerMemoryFeatures)loader_resolve_lazy_device_command(table, "vkGetDeviceGroupPeerMemoryFeatures",
+        (PFN_vkVoidFunction *)&table->GetDeviceGroupPeerMemoryFeatures);
+    fp(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDeviceMask(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    deviceMask) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDeviceMask fp = (PFN_vkCmdSetDeviceMask)loader_resolve_lazy_device_command(table, "vkCmdSetDeviceMask",
+        (PFN_vkVoidFunction *)&table->CmdSetDeviceMask);
+    fp(commandBuffer, deviceMask);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDispatchBase(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    baseGroupX,
+    uint32_t                                    baseGroupY,
+    uint32_t                                    baseGroupZ,
+    uint32_t                                    groupCountX,
+    uint32_t                                    groupCountY,
+    uint32_t                                    groupCountZ) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDispatchBase fp = (PFN_vkCmdDispatchBase)loader_resolve_lazy_device_command(table, "vkCmdDispatchBase",
+        (PFN_vkVoidFunction *)&table->CmdDispatchBase);
+    fp(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetImageMemoryRequirements2(
+    VkDevice                                    device,
+    const VkImageMemoryRequirementsInfo2*       pInfo,
+    VkMemoryRequirements2*                      pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageMemoryRequirements2 fp = (PFN_vkGetImageMemoryRequirements2)loader_resolve_lazy_device_command(table, "vkGetImageMemoryRequirements2",
+        (PFN_vkVoidFunction *)&table->GetImageMemoryRequirements2);
+    fp(device, pInfo, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetBufferMemoryRequirements2(
+    VkDevice                                    device,
+    const VkBufferMemoryRequirementsInfo2*      pInfo,
+    VkMemoryRequirements2*                      pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetBufferMemoryRequirements2 fp = (PFN_vkGetBufferMemoryRequirements2)loader_resolve_lazy_device_command(table, "vkGetBufferMemoryRequirements2",
+        (PFN_vkVoidFunction *)&table->GetBufferMemoryRequirements2);
+    fp(device, pInfo, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetImageSparseMemoryRequirements2(
+    VkDevice                                    device,
+    const VkImageSparseMemoryRequirementsInfo2* pInfo,
+    uint32_t*                                   pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements2*           pSparseMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageSparseMemoryRequirements2 fp = (PFN_vkGetImageSparseMemoryRequirements2)loader_resolve_lazy_device_command(table, "vkGetImageSparseMemoryRequirements2",
+        (PFN_vkVoidFunction *)&table->GetImageSparseMemoryRequirements2);
+    fp(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_TrimCommandPool(
+    VkDevice                                    device,
+    VkCommandPool                               commandPool,
+    VkCommandPoolTrimFlags                      flags) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkTrimCommandPool fp = (PFN_vkTrimCommandPool)loader_resolve_lazy_device_command(table, "vkTrimCommandPool",
+        (PFN_vkVoidFunction *)&table->TrimCommandPool);
+    fp(device, commandPool, flags);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceQueue2(
+    VkDevice                                    device,
+    const VkDeviceQueueInfo2*                   pQueueInfo,
+    VkQueue*                                    pQueue) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceQueue2 fp = (PFN_vkGetDeviceQueue2)loader_resolve_lazy_device_command(table, "vkGetDeviceQueue2",
+        (PFN_vkVoidFunction *)&table->GetDeviceQueue2);
+    fp(device, pQueueInfo, pQueue);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateSamplerYcbcrConversion(
+    VkDevice                                    device,
+    const VkSamplerYcbcrConversionCreateInfo*   pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkSamplerYcbcrConversion*                   pYcbcrConversion) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateSamplerYcbcrConversion fp = (PFN_vkCreateSamplerYcbcrConversion)loader_resolve_lazy_device_command(table, "vkCreateSamplerYcbcrConversion",
+        (PFN_vkVoidFunction *)&table->CreateSamplerYcbcrConversion);
+    return fp(device, pCreateInfo, pAllocator, pYcbcrConversion);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroySamplerYcbcrConversion(
+    VkDevice                                    device,
+    VkSamplerYcbcrConversion                    ycbcrConversion,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroySamplerYcbcrConversion fp = (PFN_vkDestroySamplerYcbcrConversion)loader_resolve_lazy_device_command(table, "vkDestroySamplerYcbcrConversion",
+        (PFN_vkVoidFunction *)&table->DestroySamplerYcbcrConversion);
+    fp(device, ycbcrConversion, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateDescriptorUpdateTemplate(
+    VkDevice                                    device,
+    const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkDescriptorUpdateTemplate*                 pDescriptorUpdateTemplate) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateDescriptorUpdateTemplate fp = (PFN_vkCreateDescriptorUpdateTemplate)loader_resolve_lazy_device_command(table, "vkCreateDescriptorUpdateTemplate",
+        (PFN_vkVoidFunction *)&table->CreateDescriptorUpdateTemplate);
+    return fp(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyDescriptorUpdateTemplate(
+    VkDevice                                    device,
+    VkDescriptorUpdateTemplate                  descriptorUpdateTemplate,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyDescriptorUpdateTemplate fp = (PFN_vkDestroyDescriptorUpdateTemplate)loader_resolve_lazy_device_command(table, "vkDestroyDescriptorUpdateTemplate",
+        (PFN_vkVoidFunction *)&table->DestroyDescriptorUpdateTemplate);
+    fp(device, descriptorUpdateTemplate, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_UpdateDescriptorSetWithTemplate(
+    VkDevice                                    device,
+    VkDescriptorSet                             descriptorSet,
+    VkDescriptorUpdateTemplate                  descriptorUpdateTemplate,
+    const void*                                 pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkUpdateDescriptorSetWithTemplate fp = (PFN_vkUpdateDescriptorSetWithTemplate)loader_resolve_lazy_device_command(table, "vkUpdateDescriptorSetWithTemplate",
+        (PFN_vkVoidFunction *)&table->UpdateDescriptorSetWithTemplate);
+    fp(device, descriptorSet, descriptorUpdateTemplate, pData);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDescriptorSetLayoutSupport(
+    VkDevice                                    device,
+    const VkDescriptorSetLayoutCreateInfo*      pCreateInfo,
+    VkDescriptorSetLayoutSupport*               pSupport) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDescriptorSetLayoutSupport fp = (PFN_vkGetDescriptorSetLayoutSupport)loader_resolve_lazy_device_command(table, "vkGetDescriptorSetLayoutSupport",
+        (PFN_vkVoidFunction *)&table->GetDescriptorSetLayoutSupport);
+    fp(device, pCreateInfo, pSupport);
+}
+
+// ---- Core Vulkan 1.2 commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawIndirectCount(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkBuffer                                    countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawIndirectCount fp = (PFN_vkCmdDrawIndirectCount)loader_resolve_lazy_device_command(table, "vkCmdDrawIndirectCount",
+        (PFN_vkVoidFunction *)&table->CmdDrawIndirectCount);
+    fp(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawIndexedIndirectCount(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkBuffer                                    countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawIndexedIndirectCount fp = (PFN_vkCmdDrawIndexedIndirectCount)loader_resolve_lazy_device_command(table, "vkCmdDrawIndexedIndirectCount",
+        (PFN_vkVoidFunction *)&table->CmdDrawIndexedIndirectCount);
+    fp(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateRenderPass2(
+    VkDevice                                    device,
+    const VkRenderPassCreateInfo2*              pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkRenderPass*                               pRenderPass) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateRenderPass2 fp = (PFN_vkCreateRenderPass2)loader_resolve_lazy_device_command(table, "vkCreateRenderPass2",
+        (PFN_vkVoidFunction *)&table->CreateRenderPass2);
+    return fp(device, pCreateInfo, pAllocator, pRenderPass);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBeginRenderPass2(
+    VkCommandBuffer                             commandBuffer,
+    const VkRenderPassBeginInfo*                pRenderPassBegin,
+    const VkSubpassBeginInfo*                   pSubpassBeginInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBeginRenderPass2 fp = (PFN_vkCmdBeginRenderPass2)loader_resolve_lazy_device_command(table, "vkCmdBeginRenderPass2",
+        (PFN_vkVoidFunction *)&table->CmdBeginRenderPass2);
+    fp(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdNextSubpass2(
+    VkCommandBuffer                             commandBuffer,
+    const VkSubpassBeginInfo*                   pSubpassBeginInfo,
+    const VkSubpassEndInfo*                     pSubpassEndInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdNextSubpass2 fp = (PFN_vkCmdNextSubpass2)loader_resolve_lazy_device_command(table, "vkCmdNextSubpass2",
+        (PFN_vkVoidFunction *)&table->CmdNextSubpass2);
+    fp(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdEndRenderPass2(
+    VkCommandBuffer                             commandBuffer,
+    const VkSubpassEndInfo*                     pSubpassEndInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdEndRenderPass2 fp = (PFN_vkCmdEndRenderPass2)loader_resolve_lazy_device_command(table, "vkCmdEndRenderPass2",
+        (PFN_vkVoidFunction *)&table->CmdEndRenderPass2);
+    fp(commandBuffer, pSubpassEndInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_ResetQueryPool(
+    VkDevice                                    device,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    firstQuery,
+    uint32_t                                    queryCount) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkResetQueryPool fp = (PFN_vkResetQueryPool)loader_resolve_lazy_device_command(table, "vkResetQueryPool",
+        (PFN_vkVoidFunction *)&table->ResetQueryPool);
+    fp(device, queryPool, firstQuery, queryCount);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetSemaphoreCounterValue(
+    VkDevice                                    device,
+    VkSemaphore                                 semaphore,
+    uint64_t*                                   pValue) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetSemaphoreCounterValue fp = (PFN_vkGetSemaphoreCounterValue)loader_resolve_lazy_device_command(table, "vkGetSemaphoreCounterValue",
+        (PFN_vkVoidFunction *)&table->GetSemaphoreCounterValue);
+    return fp(device, semaphore, pValue);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_WaitSemaphores(
+    VkDevice                                    device,
+    const VkSemaphoreWaitInfo*                  pWaitInfo,
+    uint64_t                                    timeout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkWaitSemaphores fp = (PFN_vkWaitSemaphores)loader_resolve_lazy_device_command(table, "vkWaitSemaphores",
+        (PFN_vkVoidFunction *)&table->WaitSemaphores);
+    return fp(device, pWaitInfo, timeout);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_SignalSemaphore(
+    VkDevice                                    device,
+    const VkSemaphoreSignalInfo*                pSignalInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkSignalSemaphore fp = (PFN_vkSignalSemaphore)loader_resolve_lazy_device_command(table, "vkSignalSemaphore",
+        (PFN_vkVoidFunction *)&table->SignalSemaphore);
+    return fp(device, pSignalInfo);
+}
+static VKAPI_ATTR VkDeviceAddress VKAPI_CALL loader_lazy_GetBufferDeviceAddress(
+    VkDevice                                    device,
+    const VkBufferDeviceAddressInfo*            pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetBufferDeviceAddress fp = (PFN_vkGetBufferDeviceAddress)loader_resolve_lazy_device_command(table, "vkGetBufferDeviceAddress",
+        (PFN_vkVoidFunction *)&table->GetBufferDeviceAddress);
+    return fp(device, pInfo);
+}
+static VKAPI_ATTR uint64_t VKAPI_CALL loader_lazy_GetBufferOpaqueCaptureAddress(
+    VkDevice                                    device,
+    const VkBufferDeviceAddressInfo*            pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetBufferOpaqueCaptureAddress fp = (PFN_vkGetBufferOpaqueCaptureAddress)loader_resolve_lazy_device_command(table, "vkGetBufferOpaqueCaptureAddress",
+        (PFN_vkVoidFunction *)&table->GetBufferOpaqueCaptureAddress);
+    return fp(device, pInfo);
+}
+static VKAPI_ATTR uint64_t VKAPI_CALL loader_lazy_GetDeviceMemoryOpaqueCaptureAddress(
+    VkDevice                                    device,
+    const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceMemoryOpaqueCaptureAddress fp = (PFN_vkGetDeviceMemoryOpaqueCaptureAddress)loader_resolve_lazy_device_command(table, "vkGetDeviceMemoryOpaqueCaptureAddress",
+        (PFN_vkVoidFunction *)&table->GetDeviceMemoryOpaqueCaptureAddress);
+    return fp(device, pInfo);
+}
+
+// ---- Core Vulkan 1.3 commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreatePrivateDataSlot(
+    VkDevice                                    device,
+    const VkPrivateDataSlotCreateInfo*          pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkPrivateDataSlot*                          pPrivateDataSlot) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreatePrivateDataSlot fp = (PFN_vkCreatePrivateDataSlot)loader_resolve_lazy_device_command(table, "vkCreatePrivateDataSlot",
+        (PFN_vkVoidFunction *)&table->CreatePrivateDataSlot);
+    return fp(device, pCreateInfo, pAllocator, pPrivateDataSlot);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyPrivateDataSlot(
+    VkDevice                                    device,
+    VkPrivateDataSlot                           privateDataSlot,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyPrivateDataSlot fp = (PFN_vkDestroyPrivateDataSlot)loader_resolve_lazy_device_command(table, "vkDestroyPrivateDataSlot",
+        (PFN_vkVoidFunction *)&table->DestroyPrivateDataSlot);
+    fp(device, privateDataSlot, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_SetPrivateData(
+    VkDevice                                    device,
+    VkObjectType                                objectType,
+    uint64_t                                    objectHandle,
+    VkPrivateDataSlot                           privateDataSlot,
+    uint64_t                                    data) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkSetPrivateData fp = (PFN_vkSetPrivateData)loader_resolve_lazy_device_command(table, "vkSetPrivateData",
+        (PFN_vkVoidFunction *)&table->SetPrivateData);
+    return fp(device, objectType, objectHandle, privateDataSlot, data);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetPrivateData(
+    VkDevice                                    device,
+    VkObjectType                                objectType,
+    uint64_t                                    objectHandle,
+    VkPrivateDataSlot                           privateDataSlot,
+    uint64_t*                                   pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetPrivateData fp = (PFN_vkGetPrivateData)loader_resolve_lazy_device_command(table, "vkGetPrivateData",
+        (PFN_vkVoidFunction *)&table->GetPrivateData);
+    fp(device, objectType, objectHandle, privateDataSlot, pData);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetEvent2(
+    VkCommandBuffer                             commandBuffer,
+    VkEvent                                     event,
+    const VkDependencyInfo*                     pDependencyInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetEvent2 fp = (PFN_vkCmdSetEvent2)loader_resolve_lazy_device_command(table, "vkCmdSetEvent2",
+        (PFN_vkVoidFunction *)&table->CmdSetEvent2);
+    fp(commandBuffer, event, pDependencyInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdResetEvent2(
+    VkCommandBuffer                             commandBuffer,
+    VkEvent                                     event,
+    VkPipelineStageFlags2                       stageMask) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdResetEvent2 fp = (PFN_vkCmdResetEvent2)loader_resolve_lazy_device_command(table, "vkCmdResetEvent2",
+        (PFN_vkVoidFunction *)&table->CmdResetEvent2);
+    fp(commandBuffer, event, stageMask);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdWaitEvents2(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    eventCount,
+    const VkEvent*                              pEvents,
+    const VkDependencyInfo*                     pDependencyInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdWaitEvents2 fp = (PFN_vkCmdWaitEvents2)loader_resolve_lazy_device_command(table, "vkCmdWaitEvents2",
+        (PFN_vkVoidFunction *)&table->CmdWaitEvents2);
+    fp(commandBuffer, eventCount, pEvents, pDependencyInfos);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPipelineBarrier2(
+    VkCommandBuffer                             commandBuffer,
+    const VkDependencyInfo*                     pDependencyInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPipelineBarrier2 fp = (PFN_vkCmdPipelineBarrier2)loader_resolve_lazy_device_command(table, "vkCmdPipelineBarrier2",
+        (PFN_vkVoidFunction *)&table->CmdPipelineBarrier2);
+    fp(commandBuffer, pDependencyInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdWriteTimestamp2(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineStageFlags2                       stage,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    query) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdWriteTimestamp2 fp = (PFN_vkCmdWriteTimestamp2)loader_resolve_lazy_device_command(table, "vkCmdWriteTimestamp2",
+        (PFN_vkVoidFunction *)&table->CmdWriteTimestamp2);
+    fp(commandBuffer, stage, queryPool, query);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_QueueSubmit2(
+    VkQueue                                     queue,
+    uint32_t                                    submitCount,
+    const VkSubmitInfo2*                        pSubmits,
+    VkFence                                     fence) {
+    VkLayerDispatchTable *table = loader_get_dispatch(queue);
+    PFN_vkQueueSubmit2 fp = (PFN_vkQueueSubmit2)loader_resolve_lazy_device_command(table, "vkQueueSubmit2",
+        (PFN_vkVoidFunction *)&table->QueueSubmit2);
+    return fp(queue, submitCount, pSubmits, fence);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyBuffer2(
+    VkCommandBuffer                             commandBuffer,
+    const VkCopyBufferInfo2*                    pCopyBufferInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyBuffer2 fp = (PFN_vkCmdCopyBuffer2)loader_resolve_lazy_device_command(table, "vkCmdCopyBuffer2",
+        (PFN_vkVoidFunction *)&table->CmdCopyBuffer2);
+    fp(commandBuffer, pCopyBufferInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyImage2(
+    VkCommandBuffer                             commandBuffer,
+    const VkCopyImageInfo2*                     pCopyImageInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyImage2 fp = (PFN_vkCmdCopyImage2)loader_resolve_lazy_device_command(table, "vkCmdCopyImage2",
+        (PFN_vkVoidFunction *)&table->CmdCopyImage2);
+    fp(commandBuffer, pCopyImageInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyBufferToImage2(
+    VkCommandBuffer                             commandBuffer,
+    const VkCopyBufferToImageInfo2*             pCopyBufferToImageInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyBufferToImage2 fp = (PFN_vkCmdCopyBufferToImage2)loader_resolve_lazy_device_command(table, "vkCmdCopyBufferToImage2",
+        (PFN_vkVoidFunction *)&table->CmdCopyBufferToImage2);
+    fp(commandBuffer, pCopyBufferToImageInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyImageToBuffer2(
+    VkCommandBuffer                             commandBuffer,
+    const VkCopyImageToBufferInfo2*             pCopyImageToBufferInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyImageToBuffer2 fp = (PFN_vkCmdCopyImageToBuffer2)loader_resolve_lazy_device_command(table, "vkCmdCopyImageToBuffer2",
+        (PFN_vkVoidFunction *)&table->CmdCopyImageToBuffer2);
+    fp(commandBuffer, pCopyImageToBufferInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBlitImage2(
+    VkCommandBuffer                             commandBuffer,
+    const VkBlitImageInfo2*                     pBlitImageInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBlitImage2 fp = (PFN_vkCmdBlitImage2)loader_resolve_lazy_device_command(table, "vkCmdBlitImage2",
+        (PFN_vkVoidFunction *)&table->CmdBlitImage2);
+    fp(commandBuffer, pBlitImageInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdResolveImage2(
+    VkCommandBuffer                             commandBuffer,
+    const VkResolveImageInfo2*                  pResolveImageInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdResolveImage2 fp = (PFN_vkCmdResolveImage2)loader_resolve_lazy_device_command(table, "vkCmdResolveImage2",
+        (PFN_vkVoidFunction *)&table->CmdResolveImage2);
+    fp(commandBuffer, pResolveImageInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBeginRendering(
+    VkCommandBuffer                             commandBuffer,
+    const VkRenderingInfo*                      pRenderingInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBeginRendering fp = (PFN_vkCmdBeginRendering)loader_resolve_lazy_device_command(table, "vkCmdBeginRendering",
+        (PFN_vkVoidFunction *)&table->CmdBeginRendering);
+    fp(commandBuffer, pRenderingInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdEndRendering(
+    VkCommandBuffer                             commandBuffer) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdEndRendering fp = (PFN_vkCmdEndRendering)loader_resolve_lazy_device_command(table, "vkCmdEndRendering",
+        (PFN_vkVoidFunction *)&table->CmdEndRendering);
+    fp(commandBuffer);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetCullMode(
+    VkCommandBuffer                             commandBuffer,
+    VkCullModeFlags                             cullMode) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetCullMode fp = (PFN_vkCmdSetCullMode)loader_resolve_lazy_device_command(table, "vkCmdSetCullMode",
+        (PFN_vkVoidFunction *)&table->CmdSetCullMode);
+    fp(commandBuffer, cullMode);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetFrontFace(
+    VkCommandBuffer                             commandBuffer,
+    VkFrontFace                                 frontFace) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetFrontFace fp = (PFN_vkCmdSetFrontFace)loader_resolve_lazy_device_command(table, "vkCmdSetFrontFace",
+        (PFN_vkVoidFunction *)&table->CmdSetFrontFace);
+    fp(commandBuffer, frontFace);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetPrimitiveTopology(
+    VkCommandBuffer                             commandBuffer,
+    VkPrimitiveTopology                         primitiveTopology) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetPrimitiveTopology fp = (PFN_vkCmdSetPrimitiveTopology)loader_resolve_lazy_device_command(table, "vkCmdSetPrimitiveTopology",
+        (PFN_vkVoidFunction *)&table->CmdSetPrimitiveTopology);
+    fp(commandBuffer, primitiveTopology);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetViewportWithCount(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    viewportCount,
+    const VkViewport*                           pViewports) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetViewportWithCount fp = (PFN_vkCmdSetViewportWithCount)loader_resolve_lazy_device_command(table, "vkCmdSetViewportWithCount",
+        (PFN_vkVoidFunction *)&table->CmdSetViewportWithCount);
+    fp(commandBuffer, viewportCount, pViewports);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetScissorWithCount(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    scissorCount,
+    const VkRect2D*                             pScissors) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetScissorWithCount fp = (PFN_vkCmdSetScissorWithCount)loader_resolve_lazy_device_command(table, "vkCmdSetScissorWithCount",
+        (PFN_vkVoidFunction *)&table->CmdSetScissorWithCount);
+    fp(commandBuffer, scissorCount, pScissors);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindVertexBuffers2(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstBinding,
+    uint32_t                                    bindingCount,
+    const VkBuffer*                             pBuffers,
+    const VkDeviceSize*                         pOffsets,
+    const VkDeviceSize*                         pSizes,
+    const VkDeviceSize*                         pStrides) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindVertexBuffers2 fp = (PFN_vkCmdBindVertexBuffers2)loader_resolve_lazy_device_command(table, "vkCmdBindVertexBuffers2",
+        (PFN_vkVoidFunction *)&table->CmdBindVertexBuffers2);
+    fp(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthTestEnable(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    depthTestEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthTestEnable fp = (PFN_vkCmdSetDepthTestEnable)loader_resolve_lazy_device_command(table, "vkCmdSetDepthTestEnable",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthTestEnable);
+    fp(commandBuffer, depthTestEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthWriteEnable(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    depthWriteEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthWriteEnable fp = (PFN_vkCmdSetDepthWriteEnable)loader_resolve_lazy_device_command(table, "vkCmdSetDepthWriteEnable",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthWriteEnable);
+    fp(commandBuffer, depthWriteEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthCompareOp(
+    VkCommandBuffer                             commandBuffer,
+    VkCompareOp                                 depthCompareOp) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthCompareOp fp = (PFN_vkCmdSetDepthCompareOp)loader_resolve_lazy_device_command(table, "vkCmdSetDepthCompareOp",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthCompareOp);
+    fp(commandBuffer, depthCompareOp);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthBoundsTestEnable(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    depthBoundsTestEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthBoundsTestEnable fp = (PFN_vkCmdSetDepthBoundsTestEnable)loader_resolve_lazy_device_command(table, "vkCmdSetDepthBoundsTestEnable",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthBoundsTestEnable);
+    fp(commandBuffer, depthBoundsTestEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetStencilTestEnable(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    stencilTestEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetStencilTestEnable fp = (PFN_vkCmdSetStencilTestEnable)loader_resolve_lazy_device_command(table, "vkCmdSetStencilTestEnable",
+        (PFN_vkVoidFunction *)&table->CmdSetStencilTestEnable);
+    fp(commandBuffer, stencilTestEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetStencilOp(
+    VkCommandBuffer                             commandBuffer,
+    VkStencilFaceFlags                          faceMask,
+    VkStencilOp                                 failOp,
+    VkStencilOp                                 passOp,
+    VkStencilOp                                 depthFailOp,
+    VkCompareOp                                 compareOp) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetStencilOp fp = (PFN_vkCmdSetStencilOp)loader_resolve_lazy_device_command(table, "vkCmdSetStencilOp",
+        (PFN_vkVoidFunction *)&table->CmdSetStencilOp);
+    fp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetRasterizerDiscardEnable(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    rasterizerDiscardEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetRasterizerDiscardEnable fp = (PFN_vkCmdSetRasterizerDiscardEnable)loader_resolve_lazy_device_command(table, "vkCmdSetRasterizerDiscardEnable",
+        (PFN_vkVoidFunction *)&table->CmdSetRasterizerDiscardEnable);
+    fp(commandBuffer, rasterizerDiscardEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthBiasEnable(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    depthBiasEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthBiasEnable fp = (PFN_vkCmdSetDepthBiasEnable)loader_resolve_lazy_device_command(table, "vkCmdSetDepthBiasEnable",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthBiasEnable);
+    fp(commandBuffer, depthBiasEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetPrimitiveRestartEnable(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    primitiveRestartEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetPrimitiveRestartEnable fp = (PFN_vkCmdSetPrimitiveRestartEnable)loader_resolve_lazy_device_command(table, "vkCmdSetPrimitiveRestartEnable",
+        (PFN_vkVoidFunction *)&table->CmdSetPrimitiveRestartEnable);
+    fp(commandBuffer, primitiveRestartEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceBufferMemoryRequirements(
+    VkDevice                                    device,
+    const VkDeviceBufferMemoryRequirements*     pInfo,
+    VkMemoryRequirements2*                      pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceBufferMemoryRequirements fp = (PFN_vkGetDeviceBufferMemoryRequirements)loader_resolve_lazy_device_command(table, "vkGetDeviceBufferMemoryRequirements",
+        (PFN_vkVoidFunction *)&table->GetDeviceBufferMemoryRequirements);
+    fp(device, pInfo, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceImageMemoryRequirements(
+    VkDevice                                    device,
+    const VkDeviceImageMemoryRequirements*      pInfo,
+    VkMemoryRequirements2*                      pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceImageMemoryRequirements fp = (PFN_vkGetDeviceImageMemoryRequirements)loader_resolve_lazy_device_command(table, "vkGetDeviceImageMemoryRequirements",
+        (PFN_vkVoidFunction *)&table->GetDeviceImageMemoryRequirements);
+    fp(device, pInfo, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceImageSparseMemoryRequirements(
+    VkDevice                                    device,
+    const VkDeviceImageMemoryRequirements*      pInfo,
+    uint32_t*                                   pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements2*           pSparseMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceImageSparseMemoryRequirements fp = (PFN_vkGetDeviceImageSparseMemoryRequirements)loader_resolve_lazy_device_command(table, "vkGetDeviceImageSparseMemoryRequirements",
+        (PFN_vkVoidFunction *)&table->GetDeviceImageSparseMemoryRequirements);
+    fp(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+
+// ---- Core Vulkan 1.4 commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetLineStipple(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    lineStippleFactor,
+    uint16_t                                    lineStipplePattern) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetLineStipple fp = (PFN_vkCmdSetLineStipple)loader_resolve_lazy_device_command(table, "vkCmdSetLineStipple",
+        (PFN_vkVoidFunction *)&table->CmdSetLineStipple);
+    fp(commandBuffer, lineStippleFactor, lineStipplePattern);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_MapMemory2(
+    VkDevice                                    device,
+    const VkMemoryMapInfo*                      pMemoryMapInfo,
+    void**                                      ppData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkMapMemory2 fp = (PFN_vkMapMemory2)loader_resolve_lazy_device_command(table, "vkMapMemory2",
+        (PFN_vkVoidFunction *)&table->MapMemory2);
+    return fp(device, pMemoryMapInfo, ppData);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_UnmapMemory2(
+    VkDevice                                    device,
+    const VkMemoryUnmapInfo*                    pMemoryUnmapInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkUnmapMemory2 fp = (PFN_vkUnmapMemory2)loader_resolve_lazy_device_command(table, "vkUnmapMemory2",
+        (PFN_vkVoidFunction *)&table->UnmapMemory2);
+    return fp(device, pMemoryUnmapInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindIndexBuffer2(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkDeviceSize                                size,
+    VkIndexType                                 indexType) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindIndexBuffer2 fp = (PFN_vkCmdBindIndexBuffer2)loader_resolve_lazy_device_command(table, "vkCmdBindIndexBuffer2",
+        (PFN_vkVoidFunction *)&table->CmdBindIndexBuffer2);
+    fp(commandBuffer, buffer, offset, size, indexType);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetRenderingAreaGranularity(
+    VkDevice                                    device,
+    const VkRenderingAreaInfo*                  pRenderingAreaInfo,
+    VkExtent2D*                                 pGranularity) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetRenderingAreaGranularity fp = (PFN_vkGetRenderingAreaGranularity)loader_resolve_lazy_device_command(table, "vkGetRenderingAreaGranularity",
+        (PFN_vkVoidFunction *)&table->GetRenderingAreaGranularity);
+    fp(device, pRenderingAreaInfo, pGranularity);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceImageSubresourceLayout(
+    VkDevice                                    device,
+    const VkDeviceImageSubresourceInfo*         pInfo,
+    VkSubresourceLayout2*                       pLayout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceImageSubresourceLayout fp = (PFN_vkGetDeviceImageSubresourceLayout)loader_resolve_lazy_device_command(table, "vkGetDeviceImageSubresourceLayout",
+        (PFN_vkVoidFunction *)&table->GetDeviceImageSubresourceLayout);
+    fp(device, pInfo, pLayout);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetImageSubresourceLayout2(
+    VkDevice                                    device,
+    VkImage                                     image,
+    const VkImageSubresource2*                  pSubresource,
+    VkSubresourceLayout2*                       pLayout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageSubresourceLayout2 fp = (PFN_vkGetImageSubresourceLayout2)loader_resolve_lazy_device_command(table, "vkGetImageSubresourceLayout2",
+        (PFN_vkVoidFunction *)&table->GetImageSubresourceLayout2);
+    fp(device, image, pSubresource, pLayout);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPushDescriptorSet(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    VkPipelineLayout                            layout,
+    uint32_t                                    set,
+    uint32_t                                    descriptorWriteCount,
+    const VkWriteDescriptorSet*                 pDescriptorWrites) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPushDescriptorSet fp = (PFN_vkCmdPushDescriptorSet)loader_resolve_lazy_device_command(table, "vkCmdPushDescriptorSet",
+        (PFN_vkVoidFunction *)&table->CmdPushDescriptorSet);
+    fp(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPushDescriptorSetWithTemplate(
+    VkCommandBuffer                             commandBuffer,
+    VkDescriptorUpdateTemplate                  descriptorUpdateTemplate,
+    VkPipelineLayout                            layout,
+    uint32_t                                    set,
+    const void*                                 pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPushDescriptorSetWithTemplate fp = (PFN_vkCmdPushDescriptorSetWithTemplate)loader_resolve_lazy_device_command(table, "vkCmdPushDescriptorSetWithTemplate",
+        (PFN_vkVoidFunction *)&table->CmdPushDescriptorSetWithTemplate);
+    fp(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetRenderingAttachmentLocations(
+    VkCommandBuffer                             commandBuffer,
+    const VkRenderingAttachmentLocationInfo*    pLocationInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetRenderingAttachmentLocations fp = (PFN_vkCmdSetRenderingAttachmentLocations)loader_resolve_lazy_device_command(table, "vkCmdSetRenderingAttachmentLocations",
+        (PFN_vkVoidFunction *)&table->CmdSetRenderingAttachmentLocations);
+    fp(commandBuffer, pLocationInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetRenderingInputAttachmentIndices(
+    VkCommandBuffer                             commandBuffer,
+    const VkRenderingInputAttachmentIndexInfo*  pInputAttachmentIndexInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetRenderingInputAttachmentIndices fp = (PFN_vkCmdSetRenderingInputAttachmentIndices)loader_resolve_lazy_device_command(table, "vkCmdSetRenderingInputAttachmentIndices",
+        (PFN_vkVoidFunction *)&table->CmdSetRenderingInputAttachmentIndices);
+    fp(commandBuffer, pInputAttachmentIndexInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindDescriptorSets2(
+    VkCommandBuffer                             commandBuffer,
+    const VkBindDescriptorSetsInfo*             pBindDescriptorSetsInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindDescriptorSets2 fp = (PFN_vkCmdBindDescriptorSets2)loader_resolve_lazy_device_command(table, "vkCmdBindDescriptorSets2",
+        (PFN_vkVoidFunction *)&table->CmdBindDescriptorSets2);
+    fp(commandBuffer, pBindDescriptorSetsInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPushConstants2(
+    VkCommandBuffer                             commandBuffer,
+    const VkPushConstantsInfo*                  pPushConstantsInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPushConstants2 fp = (PFN_vkCmdPushConstants2)loader_resolve_lazy_device_command(table, "vkCmdPushConstants2",
+        (PFN_vkVoidFunction *)&table->CmdPushConstants2);
+    fp(commandBuffer, pPushConstantsInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPushDescriptorSet2(
+    VkCommandBuffer                             commandBuffer,
+    const VkPushDescriptorSetInfo*              pPushDescriptorSetInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPushDescriptorSet2 fp = (PFN_vkCmdPushDescriptorSet2)loader_resolve_lazy_device_command(table, "vkCmdPushDescriptorSet2",
+        (PFN_vkVoidFunction *)&table->CmdPushDescriptorSet2);
+    fp(commandBuffer, pPushDescriptorSetInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPushDescriptorSetWithTemplate2(
+    VkCommandBuffer                             commandBuffer,
+    const VkPushDescriptorSetWithTemplateInfo*  pPushDescriptorSetWithTemplateInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPushDescriptorSetWithTemplate2 fp = (PFN_vkCmdPushDescriptorSetWithTemplate2)loader_resolve_lazy_device_command(table, "vkCmdPushDescriptorSetWithTemplate2",
+        (PFN_vkVoidFunction *)&table->CmdPushDescriptorSetWithTemplate2);
+    fp(commandBuffer, pPushDescriptorSetWithTemplateInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CopyMemoryToImage(
+    VkDevice                                    device,
+    const VkCopyMemoryToImageInfo*              pCopyMemoryToImageInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCopyMemoryToImage fp = (PFN_vkCopyMemoryToImage)loader_resolve_lazy_device_command(table, "vkCopyMemoryToImage",
+        (PFN_vkVoidFunction *)&table->CopyMemoryToImage);
+    return fp(device, pCopyMemoryToImageInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CopyImageToMemory(
+    VkDevice                                    device,
+    const VkCopyImageToMemoryInfo*              pCopyImageToMemoryInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCopyImageToMemory fp = (PFN_vkCopyImageToMemory)loader_resolve_lazy_device_command(table, "vkCopyImageToMemory",
+        (PFN_vkVoidFunction *)&table->CopyImageToMemory);
+    return fp(device, pCopyImageToMemoryInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CopyImageToImage(
+    VkDevice                                    device,
+    const VkCopyImageToImageInfo*               pCopyImageToImageInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCopyImageToImage fp = (PFN_vkCopyImageToImage)loader_resolve_lazy_device_command(table, "vkCopyImageToImage",
+        (PFN_vkVoidFunction *)&table->CopyImageToImage);
+    return fp(device, pCopyImageToImageInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_TransitionImageLayout(
+    VkDevice                                    device,
+    uint32_t                                    transitionCount,
+    const VkHostImageLayoutTransitionInfo*      pTransitions) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkTransitionImageLayout fp = (PFN_vkTransitionImageLayout)loader_resolve_lazy_device_command(table, "vkTransitionImageLayout",
+        (PFN_vkVoidFunction *)&table->TransitionImageLayout);
+    return fp(device, transitionCount, pTransitions);
+}
+
+// ---- VK_KHR_swapchain extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroySwapchainKHR(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroySwapchainKHR fp = (PFN_vkDestroySwapchainKHR)loader_resolve_lazy_device_command(table, "vkDestroySwapchainKHR",
+        (PFN_vkVoidFunction *)&table->DestroySwapchainKHR);
+    fp(device, swapchain, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetSwapchainImagesKHR(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain,
+    uint32_t*                                   pSwapchainImageCount,
+    VkImage*                                    pSwapchainImages) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetSwapchainImagesKHR fp = (PFN_vkGetSwapchainImagesKHR)loader_resolve_lazy_device_command(table, "vkGetSwapchainImagesKHR",
+        (PFN_vkVoidFunction *)&table->GetSwapchainImagesKHR);
+    return fp(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_AcquireNextImageKHR(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain,
+    uint64_t                                    timeout,
+    VkSemaphore                                 semaphore,
+    VkFence                                     fence,
+    uint32_t*                                   pImageIndex) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkAcquireNextImageKHR fp = (PFN_vkAcquireNextImageKHR)loader_resolve_lazy_device_command(table, "vkAcquireNextImageKHR",
+        (PFN_vkVoidFunction *)&table->AcquireNextImageKHR);
+    return fp(device, swapchain, timeout, semaphore, fence, pImageIndex);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_QueuePresentKHR(
+    VkQueue                                     queue,
+    const VkPresentInfoKHR*                     pPresentInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(queue);
+    PFN_vkQueuePresentKHR fp = (PFN_vkQueuePresentKHR)loader_resolve_lazy_device_command(table, "vkQueuePresentKHR",
+        (PFN_vkVoidFunction *)&table->QueuePresentKHR);
+    return fp(queue, pPresentInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetDeviceGroupPresentCapabilitiesKHR(
+    VkDevice                                    device,
+    VkDeviceGroupPresentCapabilitiesKHR*        pDeviceGroupPresentCapabilities) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceGroupPresentCapabilitiesKHR fp = (PFN_vkGetDeviceGroupPresentCapabilitiesKHR)loader_resolve_lazy_device_command(table, "vkGetDeviceGroupPresentCapabilitiesKHR",
+        (PFN_vkVoidFunction *)&table->GetDeviceGroupPresentCapabilitiesKHR);
+    return fp(device, pDeviceGroupPresentCapabilities);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetDeviceGroupSurfacePresentModesKHR(
+    VkDevice                                    device,
+    VkSurfaceKHR                                surface,
+    VkDeviceGroupPresentModeFlagsKHR*           pModes) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceGroupSurfacePresentModesKHR fp = (PFN_vkGetDeviceGroupSurfacePresentModesKHR)loader_resolve_lazy_device_command(table, "vkGetDeviceGroupSurfacePresentModesKHR",
+        (PFN_vkVoidFunction *)&table->GetDeviceGroupSurfacePresentModesKHR);
+    return fp(device, surface, pModes);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_AcquireNextImage2KHR(
+    VkDevice                                    device,
+    const VkAcquireNextImageInfoKHR*            pAcquireInfo,
+    uint32_t*                                   pImageIndex) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkAcquireNextImage2KHR fp = (PFN_vkAcquireNextImage2KHR)loader_resolve_lazy_device_command(table, "vkAcquireNextImage2KHR",
+        (PFN_vkVoidFunction *)&table->AcquireNextImage2KHR);
+    return fp(device, pAcquireInfo, pImageIndex);
+}
+
+// ---- VK_KHR_display_swapchain extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateSharedSwapchainsKHR(
+    VkDevice                                    device,
+    uint32_t                                    swapchainCount,
+    const VkSwapchainCreateInfoKHR*             pCreateInfos,
+    const VkAllocationCallbacks*                pAllocator,
+    VkSwapchainKHR*                             pSwapchains) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateSharedSwapchainsKHR fp = (PFN_vkCreateSharedSwapchainsKHR)loader_resolve_lazy_device_command(table, "vkCreateSharedSwapchainsKHR",
+        (PFN_vkVoidFunction *)&table->CreateSharedSwapchainsKHR);
+    return fp(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+}
+
+// ---- VK_KHR_video_queue extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateVideoSessionKHR(
+    VkDevice                                    device,
+    const VkVideoSessionCreateInfoKHR*          pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkVideoSessionKHR*                          pVideoSession) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateVideoSessionKHR fp = (PFN_vkCreateVideoSessionKHR)loader_resolve_lazy_device_command(table, "vkCreateVideoSessionKHR",
+        (PFN_vkVoidFunction *)&table->CreateVideoSessionKHR);
+    return fp(device, pCreateInfo, pAllocator, pVideoSession);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyVideoSessionKHR(
+    VkDevice                                    device,
+    VkVideoSessionKHR                           videoSession,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyVideoSessionKHR fp = (PFN_vkDestroyVideoSessionKHR)loader_resolve_lazy_device_command(table, "vkDestroyVideoSessionKHR",
+        (PFN_vkVoidFunction *)&table->DestroyVideoSessionKHR);
+    fp(device, videoSession, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetVideoSessionMemoryRequirementsKHR(
+    VkDevice                                    device,
+    VkVideoSessionKHR                           videoSession,
+    uint32_t*                                   pMemoryRequirementsCount,
+    VkVideoSessionMemoryRequirementsKHR*        pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetVideoSessionMemoryRequirementsKHR fp = (PFN_vkGetVideoSessionMemoryRequirementsKHR)loader_resolve_lazy_device_command(table, "vkGetVideoSessionMemoryRequirementsKHR",
+        (PFN_vkVoidFunction *)&table->GetVideoSessionMemoryRequirementsKHR);
+    return fp(device, videoSession, pMemoryRequirementsCount, pMemoryRequirements);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_BindVideoSessionMemoryKHR(
+    VkDevice                                    device,
+    VkVideoSessionKHR                           videoSession,
+    uint32_t                                    bindSessionMemoryInfoCount,
+    const VkBindVideoSessionMemoryInfoKHR*      pBindSessionMemoryInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkBindVideoSessionMemoryKHR fp = (PFN_vkBindVideoSessionMemoryKHR)loader_resolve_lazy_device_command(table, "vkBindVideoSessionMemoryKHR",
+        (PFN_vkVoidFunction *)&table->BindVideoSessionMemoryKHR);
+    return fp(device, videoSession, bindSessionMemoryInfoCount, pBindSessionMemoryInfos);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateVideoSessionParametersKHR(
+    VkDevice                                    device,
+    const VkVideoSessionParametersCreateInfoKHR* pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkVideoSessionParametersKHR*                pVideoSessionParameters) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateVideoSessionParametersKHR fp = (PFN_vkCreateVideoSessionParametersKHR)loader_resolve_lazy_device_command(table, "vkCreateVideoSessionParametersKHR",
+        (PFN_vkVoidFunction *)&table->CreateVideoSessionParametersKHR);
+    return fp(device, pCreateInfo, pAllocator, pVideoSessionParameters);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_UpdateVideoSessionParametersKHR(
+    VkDevice                                    device,
+    VkVideoSessionParametersKHR                 videoSessionParameters,
+    const VkVideoSessionParametersUpdateInfoKHR* pUpdateInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkUpdateVideoSessionParametersKHR fp = (PFN_vkUpdateVideoSessionParametersKHR)loader_resolve_lazy_device_command(table, "vkUpdateVideoSessionParametersKHR",
+        (PFN_vkVoidFunction *)&table->UpdateVideoSessionParametersKHR);
+    return fp(device, videoSessionParameters, pUpdateInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyVideoSessionParametersKHR(
+    VkDevice                                    device,
+    VkVideoSessionParametersKHR                 videoSessionParameters,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyVideoSessionParametersKHR fp = (PFN_vkDestroyVideoSessionParametersKHR)loader_resolve_lazy_device_command(table, "vkDestroyVideoSessionParametersKHR",
+        (PFN_vkVoidFunction *)&table->DestroyVideoSessionParametersKHR);
+    fp(device, videoSessionParameters, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBeginVideoCodingKHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkVideoBeginCodingInfoKHR*            pBeginInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBeginVideoCodingKHR fp = (PFN_vkCmdBeginVideoCodingKHR)loader_resolve_lazy_device_command(table, "vkCmdBeginVideoCodingKHR",
+        (PFN_vkVoidFunction *)&table->CmdBeginVideoCodingKHR);
+    fp(commandBuffer, pBeginInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdEndVideoCodingKHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkVideoEndCodingInfoKHR*              pEndCodingInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdEndVideoCodingKHR fp = (PFN_vkCmdEndVideoCodingKHR)loader_resolve_lazy_device_command(table, "vkCmdEndVideoCodingKHR",
+        (PFN_vkVoidFunction *)&table->CmdEndVideoCodingKHR);
+    fp(commandBuffer, pEndCodingInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdControlVideoCodingKHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkVideoCodingControlInfoKHR*          pCodingControlInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdControlVideoCodingKHR fp = (PFN_vkCmdControlVideoCodingKHR)loader_resolve_lazy_device_command(table, "vkCmdControlVideoCodingKHR",
+        (PFN_vkVoidFunction *)&table->CmdControlVideoCodingKHR);
+    fp(commandBuffer, pCodingControlInfo);
+}
+
+// ---- VK_KHR_video_decode_queue extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDecodeVideoKHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkVideoDecodeInfoKHR*                 pDecodeInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDecodeVideoKHR fp = (PFN_vkCmdDecodeVideoKHR)loader_resolve_lazy_device_command(table, "vkCmdDecodeVideoKHR",
+        (PFN_vkVoidFunction *)&table->CmdDecodeVideoKHR);
+    fp(commandBuffer, pDecodeInfo);
+}
+
+// ---- VK_KHR_dynamic_rendering extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBeginRenderingKHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkRenderingInfo*                      pRenderingInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBeginRenderingKHR fp = (PFN_vkCmdBeginRenderingKHR)loader_resolve_lazy_device_command(table, "vkCmdBeginRenderingKHR",
+        (PFN_vkVoidFunction *)&table->CmdBeginRenderingKHR);
+    fp(commandBuffer, pRenderingInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdEndRenderingKHR(
+    VkCommandBuffer                             commandBuffer) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdEndRenderingKHR fp = (PFN_vkCmdEndRenderingKHR)loader_resolve_lazy_device_command(table, "vkCmdEndRenderingKHR",
+        (PFN_vkVoidFunction *)&table->CmdEndRenderingKHR);
+    fp(commandBuffer);
+}
+
+// ---- VK_KHR_device_group extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceGroupPeerMemoryFeaturesKHR(
+    VkDevice                                    device,
+    uint32_t                                    heapIndex,
+    uint32_t                                    localDeviceIndex,
+    uint32_t                                    remoteDeviceIndex,
+    VkPeerMemoryFeatureFlags*                   pPeerMemoryFeatures) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR fp = (PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR)loader_resolve_lazy_device_command(table, "vkGetDeviceGroupPeerMemoryFeaturesKHR",
+        (PFN_vkVoidFunction *)&table->GetDeviceGroupPeerMemoryFeaturesKHR);
+    fp(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDeviceMaskKHR(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    deviceMask) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDeviceMaskKHR fp = (PFN_vkCmdSetDeviceMaskKHR)loader_resolve_lazy_device_command(table, "vkCmdSetDeviceMaskKHR",
+        (PFN_vkVoidFunction *)&table->CmdSetDeviceMaskKHR);
+    fp(commandBuffer, deviceMask);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDispatchBaseKHR(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    baseGroupX,
+    uint32_t                                    baseGroupY,
+    uint32_t                                    baseGroupZ,
+    uint32_t                                    groupCountX,
+    uint32_t                                    groupCountY,
+    uint32_t                                    groupCountZ) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDispatchBaseKHR fp = (PFN_vkCmdDispatchBaseKHR)loader_resolve_lazy_device_command(table, "vkCmdDispatchBaseKHR",
+        (PFN_vkVoidFunction *)&table->CmdDispatchBaseKHR);
+    fp(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+}
+
+// ---- VK_KHR_maintenance1 extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_TrimCommandPoolKHR(
+    VkDevice                                    device,
+    VkCommandPool                               commandPool,
+    VkCommandPoolTrimFlags                      flags) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkTrimCommandPoolKHR fp = (PFN_vkTrimCommandPoolKHR)loader_resolve_lazy_device_command(table, "vkTrimCommandPoolKHR",
+        (PFN_vkVoidFunction *)&table->TrimCommandPoolKHR);
+    fp(device, commandPool, flags);
+}
+
+// ---- VK_KHR_external_memory_win32 extension commands
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetMemoryWin32HandleKHR(
+    VkDevice                                    device,
+    const VkMemoryGetWin32HandleInfoKHR*        pGetWin32HandleInfo,
+    HANDLE*                                     pHandle) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetMemoryWin32HandleKHR fp = (PFN_vkGetMemoryWin32HandleKHR)loader_resolve_lazy_device_command(table, "vkGetMemoryWin32HandleKHR",
+        (PFN_vkVoidFunction *)&table->GetMemoryWin32HandleKHR);
+    return fp(device, pGetWin32HandleInfo, pHandle);
+}
+#endif // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetMemoryWin32HandlePropertiesKHR(
+    VkDevice                                    device,
+    VkExternalMemoryHandleTypeFlagBits          handleType,
+    HANDLE                                      handle,
+    VkMemoryWin32HandlePropertiesKHR*           pMemoryWin32HandleProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetMemoryWin32HandlePropertiesKHR fp = (PFN_vkGetMemoryWin32HandlePropertiesKHR)loader_resolve_lazy_device_command(table, "vkGetMemoryWin32HandlePropertiesKHR",
+        (PFN_vkVoidFunction *)&table->GetMemoryWin32HandlePropertiesKHR);
+    return fp(device, handleType, handle, pMemoryWin32HandleProperties);
+}
+#endif // VK_USE_PLATFORM_WIN32_KHR
+
+// ---- VK_KHR_external_memory_fd extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetMemoryFdKHR(
+    VkDevice                                    device,
+    const VkMemoryGetFdInfoKHR*                 pGetFdInfo,
+    int*                                        pFd) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetMemoryFdKHR fp = (PFN_vkGetMemoryFdKHR)loader_resolve_lazy_device_command(table, "vkGetMemoryFdKHR",
+        (PFN_vkVoidFunction *)&table->GetMemoryFdKHR);
+    return fp(device, pGetFdInfo, pFd);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetMemoryFdPropertiesKHR(
+    VkDevice                                    device,
+    VkExternalMemoryHandleTypeFlagBits          handleType,
+    int                                         fd,
+    VkMemoryFdPropertiesKHR*                    pMemoryFdProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetMemoryFdPropertiesKHR fp = (PFN_vkGetMemoryFdPropertiesKHR)loader_resolve_lazy_device_command(table, "vkGetMemoryFdPropertiesKHR",
+        (PFN_vkVoidFunction *)&table->GetMemoryFdPropertiesKHR);
+    return fp(device, handleType, fd, pMemoryFdProperties);
+}
+
+// ---- VK_KHR_external_semaphore_win32 extension commands
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ImportSemaphoreWin32HandleKHR(
+    VkDevice                                    device,
+    const VkImportSemaphoreWin32HandleInfoKHR*  pImportSemaphoreWin32HandleInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkImportSemaphoreWin32HandleKHR fp = (PFN_vkImportSemaphoreWin32HandleKHR)loader_resolve_lazy_device_command(table, "vkImportSemaphoreWin32HandleKHR",
+        (PFN_vkVoidFunction *)&table->ImportSemaphoreWin32HandleKHR);
+    return fp(device, pImportSemaphoreWin32HandleInfo);
+}
+#endif // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetSemaphoreWin32HandleKHR(
+    VkDevice                                    device,
+    const VkSemaphoreGetWin32HandleInfoKHR*     pGetWin32HandleInfo,
+    HANDLE*                                     pHandle) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetSemaphoreWin32HandleKHR fp = (PFN_vkGetSemaphoreWin32HandleKHR)loader_resolve_lazy_device_command(table, "vkGetSemaphoreWin32HandleKHR",
+        (PFN_vkVoidFunction *)&table->GetSemaphoreWin32HandleKHR);
+    return fp(device, pGetWin32HandleInfo, pHandle);
+}
+#endif // VK_USE_PLATFORM_WIN32_KHR
+
+// ---- VK_KHR_external_semaphore_fd extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ImportSemaphoreFdKHR(
+    VkDevice                                    device,
+    const VkImportSemaphoreFdInfoKHR*           pImportSemaphoreFdInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkImportSemaphoreFdKHR fp = (PFN_vkImportSemaphoreFdKHR)loader_resolve_lazy_device_command(table, "vkImportSemaphoreFdKHR",
+        (PFN_vkVoidFunction *)&table->ImportSemaphoreFdKHR);
+    return fp(device, pImportSemaphoreFdInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetSemaphoreFdKHR(
+    VkDevice                                    device,
+    const VkSemaphoreGetFdInfoKHR*              pGetFdInfo,
+    int*                                        pFd) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetSemaphoreFdKHR fp = (PFN_vkGetSemaphoreFdKHR)loader_resolve_lazy_device_command(table, "vkGetSemaphoreFdKHR",
+        (PFN_vkVoidFunction *)&table->GetSemaphoreFdKHR);
+    return fp(device, pGetFdInfo, pFd);
+}
+
+// ---- VK_KHR_push_descriptor extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPushDescriptorSetKHR(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    VkPipelineLayout                            layout,
+    uint32_t                                    set,
+    uint32_t                                    descriptorWriteCount,
+    const VkWriteDescriptorSet*                 pDescriptorWrites) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPushDescriptorSetKHR fp = (PFN_vkCmdPushDescriptorSetKHR)loader_resolve_lazy_device_command(table, "vkCmdPushDescriptorSetKHR",
+        (PFN_vkVoidFunction *)&table->CmdPushDescriptorSetKHR);
+    fp(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPushDescriptorSetWithTemplateKHR(
+    VkCommandBuffer                             commandBuffer,
+    VkDescriptorUpdateTemplate                  descriptorUpdateTemplate,
+    VkPipelineLayout                            layout,
+    uint32_t                                    set,
+    const void*                                 pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPushDescriptorSetWithTemplateKHR fp = (PFN_vkCmdPushDescriptorSetWithTemplateKHR)loader_resolve_lazy_device_command(table, "vkCmdPushDescriptorSetWithTemplateKHR",
+        (PFN_vkVoidFunction *)&table->CmdPushDescriptorSetWithTemplateKHR);
+    fp(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+}
+
+// ---- VK_KHR_descriptor_update_template extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateDescriptorUpdateTemplateKHR(
+    VkDevice                                    device,
+    const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkDescriptorUpdateTemplate*                 pDescriptorUpdateTemplate) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateDescriptorUpdateTemplateKHR fp = (PFN_vkCreateDescriptorUpdateTemplateKHR)loader_resolve_lazy_device_command(table, "vkCreateDescriptorUpdateTemplateKHR",
+        (PFN_vkVoidFunction *)&table->CreateDescriptorUpdateTemplateKHR);
+    return fp(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyDescriptorUpdateTemplateKHR(
+    VkDevice                                    device,
+    VkDescriptorUpdateTemplate                  descriptorUpdateTemplate,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyDescriptorUpdateTemplateKHR fp = (PFN_vkDestroyDescriptorUpdateTemplateKHR)loader_resolve_lazy_device_command(table, "vkDestroyDescriptorUpdateTemplateKHR",
+        (PFN_vkVoidFunction *)&table->DestroyDescriptorUpdateTemplateKHR);
+    fp(device, descriptorUpdateTemplate, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_UpdateDescriptorSetWithTemplateKHR(
+    VkDevice                                    device,
+    VkDescriptorSet                             descriptorSet,
+    VkDescriptorUpdateTemplate                  descriptorUpdateTemplate,
+    const void*                                 pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkUpdateDescriptorSetWithTemplateKHR fp = (PFN_vkUpdateDescriptorSetWithTemplateKHR)loader_resolve_lazy_device_command(table, "vkUpdateDescriptorSetWithTemplateKHR",
+        (PFN_vkVoidFunction *)&table->UpdateDescriptorSetWithTemplateKHR);
+    fp(device, descriptorSet, descriptorUpdateTemplate, pData);
+}
+
+// ---- VK_KHR_create_renderpass2 extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateRenderPass2KHR(
+    VkDevice                                    device,
+    const VkRenderPassCreateInfo2*              pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkRenderPass*                               pRenderPass) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateRenderPass2KHR fp = (PFN_vkCreateRenderPass2KHR)loader_resolve_lazy_device_command(table, "vkCreateRenderPass2KHR",
+        (PFN_vkVoidFunction *)&table->CreateRenderPass2KHR);
+    return fp(device, pCreateInfo, pAllocator, pRenderPass);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBeginRenderPass2KHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkRenderPassBeginInfo*                pRenderPassBegin,
+    const VkSubpassBeginInfo*                   pSubpassBeginInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBeginRenderPass2KHR fp = (PFN_vkCmdBeginRenderPass2KHR)loader_resolve_lazy_device_command(table, "vkCmdBeginRenderPass2KHR",
+        (PFN_vkVoidFunction *)&table->CmdBeginRenderPass2KHR);
+    fp(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdNextSubpass2KHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkSubpassBeginInfo*                   pSubpassBeginInfo,
+    const VkSubpassEndInfo*                     pSubpassEndInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdNextSubpass2KHR fp = (PFN_vkCmdNextSubpass2KHR)loader_resolve_lazy_device_command(table, "vkCmdNextSubpass2KHR",
+        (PFN_vkVoidFunction *)&table->CmdNextSubpass2KHR);
+    fp(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdEndRenderPass2KHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkSubpassEndInfo*                     pSubpassEndInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdEndRenderPass2KHR fp = (PFN_vkCmdEndRenderPass2KHR)loader_resolve_lazy_device_command(table, "vkCmdEndRenderPass2KHR",
+        (PFN_vkVoidFunction *)&table->CmdEndRenderPass2KHR);
+    fp(commandBuffer, pSubpassEndInfo);
+}
+
+// ---- VK_KHR_shared_presentable_image extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetSwapchainStatusKHR(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetSwapchainStatusKHR fp = (PFN_vkGetSwapchainStatusKHR)loader_resolve_lazy_device_command(table, "vkGetSwapchainStatusKHR",
+        (PFN_vkVoidFunction *)&table->GetSwapchainStatusKHR);
+    return fp(device, swapchain);
+}
+
+// ---- VK_KHR_external_fence_win32 extension commands
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ImportFenceWin32HandleKHR(
+    VkDevice                                    device,
+    const VkImportFenceWin32HandleInfoKHR*      pImportFenceWin32HandleInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkImportFenceWin32HandleKHR fp = (PFN_vkImportFenceWin32HandleKHR)loader_resolve_lazy_device_command(table, "vkImportFenceWin32HandleKHR",
+        (PFN_vkVoidFunction *)&table->ImportFenceWin32HandleKHR);
+    return fp(device, pImportFenceWin32HandleInfo);
+}
+#endif // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetFenceWin32HandleKHR(
+    VkDevice                                    device,
+    const VkFenceGetWin32HandleInfoKHR*         pGetWin32HandleInfo,
+    HANDLE*                                     pHandle) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetFenceWin32HandleKHR fp = (PFN_vkGetFenceWin32HandleKHR)loader_resolve_lazy_device_command(table, "vkGetFenceWin32HandleKHR",
+        (PFN_vkVoidFunction *)&table->GetFenceWin32HandleKHR);
+    return fp(device, pGetWin32HandleInfo, pHandle);
+}
+#endif // VK_USE_PLATFORM_WIN32_KHR
+
+// ---- VK_KHR_external_fence_fd extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ImportFenceFdKHR(
+    VkDevice                                    device,
+    const VkImportFenceFdInfoKHR*               pImportFenceFdInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkImportFenceFdKHR fp = (PFN_vkImportFenceFdKHR)loader_resolve_lazy_device_command(table, "vkImportFenceFdKHR",
+        (PFN_vkVoidFunction *)&table->ImportFenceFdKHR);
+    return fp(device, pImportFenceFdInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetFenceFdKHR(
+    VkDevice                                    device,
+    const VkFenceGetFdInfoKHR*                  pGetFdInfo,
+    int*                                        pFd) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetFenceFdKHR fp = (PFN_vkGetFenceFdKHR)loader_resolve_lazy_device_command(table, "vkGetFenceFdKHR",
+        (PFN_vkVoidFunction *)&table->GetFenceFdKHR);
+    return fp(device, pGetFdInfo, pFd);
+}
+
+// ---- VK_KHR_performance_query extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_AcquireProfilingLockKHR(
+    VkDevice                                    device,
+    const VkAcquireProfilingLockInfoKHR*        pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkAcquireProfilingLockKHR fp = (PFN_vkAcquireProfilingLockKHR)loader_resolve_lazy_device_command(table, "vkAcquireProfilingLockKHR",
+        (PFN_vkVoidFunction *)&table->AcquireProfilingLockKHR);
+    return fp(device, pInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_ReleaseProfilingLockKHR(
+    VkDevice                                    device) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkReleaseProfilingLockKHR fp = (PFN_vkReleaseProfilingLockKHR)loader_resolve_lazy_device_command(table, "vkReleaseProfilingLockKHR",
+        (PFN_vkVoidFunction *)&table->ReleaseProfilingLockKHR);
+    fp(device);
+}
+
+// ---- VK_KHR_get_memory_requirements2 extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetImageMemoryRequirements2KHR(
+    VkDevice                                    device,
+    const VkImageMemoryRequirementsInfo2*       pInfo,
+    VkMemoryRequirements2*                      pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageMemoryRequirements2KHR fp = (PFN_vkGetImageMemoryRequirements2KHR)loader_resolve_lazy_device_command(table, "vkGetImageMemoryRequirements2KHR",
+        (PFN_vkVoidFunction *)&table->GetImageMemoryRequirements2KHR);
+    fp(device, pInfo, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetBufferMemoryRequirements2KHR(
+    VkDevice                                    device,
+    const VkBufferMemoryRequirementsInfo2*      pInfo,
+    VkMemoryRequirements2*                      pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetBufferMemoryRequirements2KHR fp = (PFN_vkGetBufferMemoryRequirements2KHR)loader_resolve_lazy_device_command(table, "vkGetBufferMemoryRequirements2KHR",
+        (PFN_vkVoidFunction *)&table->GetBufferMemoryRequirements2KHR);
+    fp(device, pInfo, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetImageSparseMemoryRequirements2KHR(
+    VkDevice                                    device,
+    const VkImageSparseMemoryRequirementsInfo2* pInfo,
+    uint32_t*                                   pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements2*           pSparseMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageSparseMemoryRequirements2KHR fp = (PFN_vkGetImageSparseMemoryRequirements2KHR)loader_resolve_lazy_device_command(table, "vkGetImageSparseMemoryRequirements2KHR",
+        (PFN_vkVoidFunction *)&table->GetImageSparseMemoryRequirements2KHR);
+    fp(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+
+// ---- VK_KHR_sampler_ycbcr_conversion extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateSamplerYcbcrConversionKHR(
+    VkDevice                                    device,
+    const VkSamplerYcbcrConversionCreateInfo*   pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkSamplerYcbcrConversion*                   pYcbcrConversion) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateSamplerYcbcrConversionKHR fp = (PFN_vkCreateSamplerYcbcrConversionKHR)loader_resolve_lazy_device_command(table, "vkCreateSamplerYcbcrConversionKHR",
+        (PFN_vkVoidFunction *)&table->CreateSamplerYcbcrConversionKHR);
+    return fp(device, pCreateInfo, pAllocator, pYcbcrConversion);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroySamplerYcbcrConversionKHR(
+    VkDevice                                    device,
+    VkSamplerYcbcrConversion                    ycbcrConversion,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroySamplerYcbcrConversionKHR fp = (PFN_vkDestroySamplerYcbcrConversionKHR)loader_resolve_lazy_device_command(table, "vkDestroySamplerYcbcrConversionKHR",
+        (PFN_vkVoidFunction *)&table->DestroySamplerYcbcrConversionKHR);
+    fp(device, ycbcrConversion, pAllocator);
+}
+
+// ---- VK_KHR_bind_memory2 extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_BindBufferMemory2KHR(
+    VkDevice                                    device,
+    uint32_t                                    bindInfoCount,
+    const VkBindBufferMemoryInfo*               pBindInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkBindBufferMemory2KHR fp = (PFN_vkBindBufferMemory2KHR)loader_resolve_lazy_device_command(table, "vkBindBufferMemory2KHR",
+        (PFN_vkVoidFunction *)&table->BindBufferMemory2KHR);
+    return fp(device, bindInfoCount, pBindInfos);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_BindImageMemory2KHR(
+    VkDevice                                    device,
+    uint32_t                                    bindInfoCount,
+    const VkBindImageMemoryInfo*                pBindInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkBindImageMemory2KHR fp = (PFN_vkBindImageMemory2KHR)loader_resolve_lazy_device_command(table, "vkBindImageMemory2KHR",
+        (PFN_vkVoidFunction *)&table->BindImageMemory2KHR);
+    return fp(device, bindInfoCount, pBindInfos);
+}
+
+// ---- VK_KHR_maintenance3 extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDescriptorSetLayoutSupportKHR(
+    VkDevice                                    device,
+    const VkDescriptorSetLayoutCreateInfo*      pCreateInfo,
+    VkDescriptorSetLayoutSupport*               pSupport) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDescriptorSetLayoutSupportKHR fp = (PFN_vkGetDescriptorSetLayoutSupportKHR)loader_resolve_lazy_device_command(table, "vkGetDescriptorSetLayoutSupportKHR",
+        (PFN_vkVoidFunction *)&table->GetDescriptorSetLayoutSupportKHR);
+    fp(device, pCreateInfo, pSupport);
+}
+
+// ---- VK_KHR_draw_indirect_count extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawIndirectCountKHR(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkBuffer                                    countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawIndirectCountKHR fp = (PFN_vkCmdDrawIndirectCountKHR)loader_resolve_lazy_device_command(table, "vkCmdDrawIndirectCountKHR",
+        (PFN_vkVoidFunction *)&table->CmdDrawIndirectCountKHR);
+    fp(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawIndexedIndirectCountKHR(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkBuffer                                    countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawIndexedIndirectCountKHR fp = (PFN_vkCmdDrawIndexedIndirectCountKHR)loader_resolve_lazy_device_command(table, "vkCmdDrawIndexedIndirectCountKHR",
+        (PFN_vkVoidFunction *)&table->CmdDrawIndexedIndirectCountKHR);
+    fp(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+// ---- VK_KHR_timeline_semaphore extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetSemaphoreCounterValueKHR(
+    VkDevice                                    device,
+    VkSemaphore                                 semaphore,
+    uint64_t*                                   pValue) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetSemaphoreCounterValueKHR fp = (PFN_vkGetSemaphoreCounterValueKHR)loader_resolve_lazy_device_command(table, "vkGetSemaphoreCounterValueKHR",
+        (PFN_vkVoidFunction *)&table->GetSemaphoreCounterValueKHR);
+    return fp(device, semaphore, pValue);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_WaitSemaphoresKHR(
+    VkDevice                                    device,
+    const VkSemaphoreWaitInfo*                  pWaitInfo,
+    uint64_t                                    timeout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkWaitSemaphoresKHR fp = (PFN_vkWaitSemaphoresKHR)loader_resolve_lazy_device_command(table, "vkWaitSemaphoresKHR",
+        (PFN_vkVoidFunction *)&table->WaitSemaphoresKHR);
+    return fp(device, pWaitInfo, timeout);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_SignalSemaphoreKHR(
+    VkDevice                                    device,
+    const VkSemaphoreSignalInfo*                pSignalInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkSignalSemaphoreKHR fp = (PFN_vkSignalSemaphoreKHR)loader_resolve_lazy_device_command(table, "vkSignalSemaphoreKHR",
+        (PFN_vkVoidFunction *)&table->SignalSemaphoreKHR);
+    return fp(device, pSignalInfo);
+}
+
+// ---- VK_KHR_fragment_shading_rate extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetFragmentShadingRateKHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkExtent2D*                           pFragmentSize,
+    const VkFragmentShadingRateCombinerOpKHR    combinerOps[2]) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetFragmentShadingRateKHR fp = (PFN_vkCmdSetFragmentShadingRateKHR)loader_resolve_lazy_device_command(table, "vkCmdSetFragmentShadingRateKHR",
+        (PFN_vkVoidFunction *)&table->CmdSetFragmentShadingRateKHR);
+    fp(commandBuffer, pFragmentSize, combinerOps);
+}
+
+// ---- VK_KHR_dynamic_rendering_local_read extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetRenderingAttachmentLocationsKHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkRenderingAttachmentLocationInfo*    pLocationInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetRenderingAttachmentLocationsKHR fp = (PFN_vkCmdSetRenderingAttachmentLocationsKHR)loader_resolve_lazy_device_command(table, "vkCmdSetRenderingAttachmentLocationsKHR",
+        (PFN_vkVoidFunction *)&table->CmdSetRenderingAttachmentLocationsKHR);
+    fp(commandBuffer, pLocationInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetRenderingInputAttachmentIndicesKHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkRenderingInputAttachmentIndexInfo*  pInputAttachmentIndexInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetRenderingInputAttachmentIndicesKHR fp = (PFN_vkCmdSetRenderingInputAttachmentIndicesKHR)loader_resolve_lazy_device_command(table, "vkCmdSetRenderingInputAttachmentIndicesKHR",
+        (PFN_vkVoidFunction *)&table->CmdSetRenderingInputAttachmentIndicesKHR);
+    fp(commandBuffer, pInputAttachmentIndexInfo);
+}
+
+// ---- VK_KHR_present_wait extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_WaitForPresentKHR(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain,
+    uint64_t                                    presentId,
+    uint64_t                                    timeout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkWaitForPresentKHR fp = (PFN_vkWaitForPresentKHR)loader_resolve_lazy_device_command(table, "vkWaitForPresentKHR",
+        (PFN_vkVoidFunction *)&table->WaitForPresentKHR);
+    return fp(device, swapchain, presentId, timeout);
+}
+
+// ---- VK_KHR_buffer_device_address extension commands
+static VKAPI_ATTR VkDeviceAddress VKAPI_CALL loader_lazy_GetBufferDeviceAddressKHR(
+    VkDevice                                    device,
+    const VkBufferDeviceAddressInfo*            pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetBufferDeviceAddressKHR fp = (PFN_vkGetBufferDeviceAddressKHR)loader_resolve_lazy_device_command(table, "vkGetBufferDeviceAddressKHR",
+        (PFN_vkVoidFunction *)&table->GetBufferDeviceAddressKHR);
+    return fp(device, pInfo);
+}
+static VKAPI_ATTR uint64_t VKAPI_CALL loader_lazy_GetBufferOpaqueCaptureAddressKHR(
+    VkDevice                                    device,
+    const VkBufferDeviceAddressInfo*            pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetBufferOpaqueCaptureAddressKHR fp = (PFN_vkGetBufferOpaqueCaptureAddressKHR)loader_resolve_lazy_device_command(table, "vkGetBufferOpaqueCaptureAddressKHR",
+        (PFN_vkVoidFunction *)&table->GetBufferOpaqueCaptureAddressKHR);
+    return fp(device, pInfo);
+}
+static VKAPI_ATTR uint64_t VKAPI_CALL loader_lazy_GetDeviceMemoryOpaqueCaptureAddressKHR(
+    VkDevice                                    device,
+    const VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR fp = (PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR)loader_resolve_lazy_device_command(table, "vkGetDeviceMemoryOpaqueCaptureAddressKHR",
+        (PFN_vkVoidFunction *)&table->GetDeviceMemoryOpaqueCaptureAddressKHR);
+    return fp(device, pInfo);
+}
+
+// ---- VK_KHR_deferred_host_operations extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateDeferredOperationKHR(
+    VkDevice                                    device,
+    const VkAllocationCallbacks*                pAllocator,
+    VkDeferredOperationKHR*                     pDeferredOperation) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateDeferredOperationKHR fp = (PFN_vkCreateDeferredOperationKHR)loader_resolve_lazy_device_command(table, "vkCreateDeferredOperationKHR",
+        (PFN_vkVoidFunction *)&table->CreateDeferredOperationKHR);
+    return fp(device, pAllocator, pDeferredOperation);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyDeferredOperationKHR(
+    VkDevice                                    device,
+    VkDeferredOperationKHR                      operation,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyDeferredOperationKHR fp = (PFN_vkDestroyDeferredOperationKHR)loader_resolve_lazy_device_command(table, "vkDestroyDeferredOperationKHR",
+        (PFN_vkVoidFunction *)&table->DestroyDeferredOperationKHR);
+    fp(device, operation, pAllocator);
+}
+static VKAPI_ATTR uint32_t VKAPI_CALL loader_lazy_GetDeferredOperationMaxConcurrencyKHR(
+    VkDevice                                    device,
+    VkDeferredOperationKHR                      operation) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeferredOperationMaxConcurrencyKHR fp = (PFN_vkGetDeferredOperationMaxConcurrencyKHR)loader_resolve_lazy_device_command(table, "vkGetDeferredOperationMaxConcurrencyKHR",
+        (PFN_vkVoidFunction *)&table->GetDeferredOperationMaxConcurrencyKHR);
+    return fp(device, operation);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetDeferredOperationResultKHR(
+    VkDevice                                    device,
+    VkDeferredOperationKHR                      operation) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeferredOperationResultKHR fp = (PFN_vkGetDeferredOperationResultKHR)loader_resolve_lazy_device_command(table, "vkGetDeferredOperationResultKHR",
+        (PFN_vkVoidFunction *)&table->GetDeferredOperationResultKHR);
+    return fp(device, operation);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_DeferredOperationJoinKHR(
+    VkDevice                                    device,
+    VkDeferredOperationKHR                      operation) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDeferredOperationJoinKHR fp = (PFN_vkDeferredOperationJoinKHR)loader_resolve_lazy_device_command(table, "vkDeferredOperationJoinKHR",
+        (PFN_vkVoidFunction *)&table->DeferredOperationJoinKHR);
+    return fp(device, operation);
+}
+
+// ---- VK_KHR_pipeline_executable_properties extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetPipelineExecutablePropertiesKHR(
+    VkDevice                                    device,
+    const VkPipelineInfoKHR*                    pPipelineInfo,
+    uint32_t*                                   pExecutableCount,
+    VkPipelineExecutablePropertiesKHR*          pProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetPipelineExecutablePropertiesKHR fp = (PFN_vkGetPipelineExecutablePropertiesKHR)loader_resolve_lazy_device_command(table, "vkGetPipelineExecutablePropertiesKHR",
+        (PFN_vkVoidFunction *)&table->GetPipelineExecutablePropertiesKHR);
+    return fp(device, pPipelineInfo, pExecutableCount, pProperties);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetPipelineExecutableStatisticsKHR(
+    VkDevice                                    device,
+    const VkPipelineExecutableInfoKHR*          pExecutableInfo,
+    uint32_t*                                   pStatisticCount,
+    VkPipelineExecutableStatisticKHR*           pStatistics) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetPipelineExecutableStatisticsKHR fp = (PFN_vkGetPipelineExecutableStatisticsKHR)loader_resolve_lazy_device_command(table, "vkGetPipelineExecutableStatisticsKHR",
+        (PFN_vkVoidFunction *)&table->GetPipelineExecutableStatisticsKHR);
+    return fp(device, pExecutableInfo, pStatisticCount, pStatistics);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetPipelineExecutableInternalRepresentationsKHR(
+    VkDevice                                    device,
+    const VkPipelineExecutableInfoKHR*          pExecutableInfo,
+    uint32_t*                                   pInternalRepresentationCount,
+    VkPipelineExecutableInternalRepresentationKHR* pInternalRepresentations) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetPipelineExecutableInternalRepresentationsKHR fp = (PFN_vkGetPipelineExecutableInternalRepresentationsKHR)loader_resolve_lazy_device_command(table, "vkGetPipelineExecutableInternalRepresentationsKHR",
+        (PFN_vkVoidFunction *)&table->GetPipelineExecutableInternalRepresentationsKHR);
+    return fp(device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
+}
+
+// ---- VK_KHR_map_memory2 extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_MapMemory2KHR(
+    VkDevice                                    device,
+    const VkMemoryMapInfo*                      pMemoryMapInfo,
+    void**                                      ppData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkMapMemory2KHR fp = (PFN_vkMapMemory2KHR)loader_resolve_lazy_device_command(table, "vkMapMemory2KHR",
+        (PFN_vkVoidFunction *)&table->MapMemory2KHR);
+    return fp(device, pMemoryMapInfo, ppData);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_UnmapMemory2KHR(
+    VkDevice                                    device,
+    const VkMemoryUnmapInfo*                    pMemoryUnmapInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkUnmapMemory2KHR fp = (PFN_vkUnmapMemory2KHR)loader_resolve_lazy_device_command(table, "vkUnmapMemory2KHR",
+        (PFN_vkVoidFunction *)&table->UnmapMemory2KHR);
+    return fp(device, pMemoryUnmapInfo);
+}
+
+// ---- VK_KHR_video_encode_queue extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetEncodedVideoSessionParametersKHR(
+    VkDevice                                    device,
+    const VkVideoEncodeSessionParametersGetInfoKHR* pVideoSessionParametersInfo,
+    VkVideoEncodeSessionParametersFeedbackInfoKHR* pFeedbackInfo,
+    size_t*                                     pDataSize,
+    void*                                       pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetEncodedVideoSessionParametersKHR fp = (PFN_vkGetEncodedVideoSessionParametersKHR)loader_resolve_lazy_device_command(table, "vkGetEncodedVideoSessionParametersKHR",
+        (PFN_vkVoidFunction *)&table->GetEncodedVideoSessionParametersKHR);
+    return fp(device, pVideoSessionParametersInfo, pFeedbackInfo, pDataSize, pData);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdEncodeVideoKHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkVideoEncodeInfoKHR*                 pEncodeInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdEncodeVideoKHR fp = (PFN_vkCmdEncodeVideoKHR)loader_resolve_lazy_device_command(table, "vkCmdEncodeVideoKHR",
+        (PFN_vkVoidFunction *)&table->CmdEncodeVideoKHR);
+    fp(commandBuffer, pEncodeInfo);
+}
+
+// ---- VK_KHR_synchronization2 extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetEvent2KHR(
+    VkCommandBuffer                             commandBuffer,
+    VkEvent                                     event,
+    const VkDependencyInfo*                     pDependencyInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetEvent2KHR fp = (PFN_vkCmdSetEvent2KHR)loader_resolve_lazy_device_command(table, "vkCmdSetEvent2KHR",
+        (PFN_vkVoidFunction *)&table->CmdSetEvent2KHR);
+    fp(commandBuffer, event, pDependencyInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdResetEvent2KHR(
+    VkCommandBuffer                             commandBuffer,
+    VkEvent                                     event,
+    VkPipelineStageFlags2                       stageMask) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdResetEvent2KHR fp = (PFN_vkCmdResetEvent2KHR)loader_resolve_lazy_device_command(table, "vkCmdResetEvent2KHR",
+        (PFN_vkVoidFunction *)&table->CmdResetEvent2KHR);
+    fp(commandBuffer, event, stageMask);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdWaitEvents2KHR(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    eventCount,
+    const VkEvent*                              pEvents,
+    const VkDependencyInfo*                     pDependencyInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdWaitEvents2KHR fp = (PFN_vkCmdWaitEvents2KHR)loader_resolve_lazy_device_command(table, "vkCmdWaitEvents2KHR",
+        (PFN_vkVoidFunction *)&table->CmdWaitEvents2KHR);
+    fp(commandBuffer, eventCount, pEvents, pDependencyInfos);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPipelineBarrier2KHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkDependencyInfo*                     pDependencyInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPipelineBarrier2KHR fp = (PFN_vkCmdPipelineBarrier2KHR)loader_resolve_lazy_device_command(table, "vkCmdPipelineBarrier2KHR",
+        (PFN_vkVoidFunction *)&table->CmdPipelineBarrier2KHR);
+    fp(commandBuffer, pDependencyInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdWriteTimestamp2KHR(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineStageFlags2                       stage,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    query) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdWriteTimestamp2KHR fp = (PFN_vkCmdWriteTimestamp2KHR)loader_resolve_lazy_device_command(table, "vkCmdWriteTimestamp2KHR",
+        (PFN_vkVoidFunction *)&table->CmdWriteTimestamp2KHR);
+    fp(commandBuffer, stage, queryPool, query);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_QueueSubmit2KHR(
+    VkQueue                                     queue,
+    uint32_t                                    submitCount,
+    const VkSubmitInfo2*                        pSubmits,
+    VkFence                                     fence) {
+    VkLayerDispatchTable *table = loader_get_dispatch(queue);
+    PFN_vkQueueSubmit2KHR fp = (PFN_vkQueueSubmit2KHR)loader_resolve_lazy_device_command(table, "vkQueueSubmit2KHR",
+        (PFN_vkVoidFunction *)&table->QueueSubmit2KHR);
+    return fp(queue, submitCount, pSubmits, fence);
+}
+
+// ---- VK_KHR_copy_commands2 extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyBuffer2KHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkCopyBufferInfo2*                    pCopyBufferInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyBuffer2KHR fp = (PFN_vkCmdCopyBuffer2KHR)loader_resolve_lazy_device_command(table, "vkCmdCopyBuffer2KHR",
+        (PFN_vkVoidFunction *)&table->CmdCopyBuffer2KHR);
+    fp(commandBuffer, pCopyBufferInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyImage2KHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkCopyImageInfo2*                     pCopyImageInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyImage2KHR fp = (PFN_vkCmdCopyImage2KHR)loader_resolve_lazy_device_command(table, "vkCmdCopyImage2KHR",
+        (PFN_vkVoidFunction *)&table->CmdCopyImage2KHR);
+    fp(commandBuffer, pCopyImageInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyBufferToImage2KHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkCopyBufferToImageInfo2*             pCopyBufferToImageInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyBufferToImage2KHR fp = (PFN_vkCmdCopyBufferToImage2KHR)loader_resolve_lazy_device_command(table, "vkCmdCopyBufferToImage2KHR",
+        (PFN_vkVoidFunction *)&table->CmdCopyBufferToImage2KHR);
+    fp(commandBuffer, pCopyBufferToImageInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyImageToBuffer2KHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkCopyImageToBufferInfo2*             pCopyImageToBufferInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyImageToBuffer2KHR fp = (PFN_vkCmdCopyImageToBuffer2KHR)loader_resolve_lazy_device_command(table, "vkCmdCopyImageToBuffer2KHR",
+        (PFN_vkVoidFunction *)&table->CmdCopyImageToBuffer2KHR);
+    fp(commandBuffer, pCopyImageToBufferInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBlitImage2KHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkBlitImageInfo2*                     pBlitImageInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBlitImage2KHR fp = (PFN_vkCmdBlitImage2KHR)loader_resolve_lazy_device_command(table, "vkCmdBlitImage2KHR",
+        (PFN_vkVoidFunction *)&table->CmdBlitImage2KHR);
+    fp(commandBuffer, pBlitImageInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdResolveImage2KHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkResolveImageInfo2*                  pResolveImageInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdResolveImage2KHR fp = (PFN_vkCmdResolveImage2KHR)loader_resolve_lazy_device_command(table, "vkCmdResolveImage2KHR",
+        (PFN_vkVoidFunction *)&table->CmdResolveImage2KHR);
+    fp(commandBuffer, pResolveImageInfo);
+}
+
+// ---- VK_KHR_ray_tracing_maintenance1 extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdTraceRaysIndirect2KHR(
+    VkCommandBuffer                             commandBuffer,
+    VkDeviceAddress                             indirectDeviceAddress) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdTraceRaysIndirect2KHR fp = (PFN_vkCmdTraceRaysIndirect2KHR)loader_resolve_lazy_device_command(table, "vkCmdTraceRaysIndirect2KHR",
+        (PFN_vkVoidFunction *)&table->CmdTraceRaysIndirect2KHR);
+    fp(commandBuffer, indirectDeviceAddress);
+}
+
+// ---- VK_KHR_maintenance4 extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceBufferMemoryRequirementsKHR(
+    VkDevice                                    device,
+    const VkDeviceBufferMemoryRequirements*     pInfo,
+    VkMemoryRequirements2*                      pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceBufferMemoryRequirementsKHR fp = (PFN_vkGetDeviceBufferMemoryRequirementsKHR)loader_resolve_lazy_device_command(table, "vkGetDeviceBufferMemoryRequirementsKHR",
+        (PFN_vkVoidFunction *)&table->GetDeviceBufferMemoryRequirementsKHR);
+    fp(device, pInfo, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceImageMemoryRequirementsKHR(
+    VkDevice                                    device,
+    const VkDeviceImageMemoryRequirements*      pInfo,
+    VkMemoryRequirements2*                      pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceImageMemoryRequirementsKHR fp = (PFN_vkGetDeviceImageMemoryRequirementsKHR)loader_resolve_lazy_device_command(table, "vkGetDeviceImageMemoryRequirementsKHR",
+        (PFN_vkVoidFunction *)&table->GetDeviceImageMemoryRequirementsKHR);
+    fp(device, pInfo, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceImageSparseMemoryRequirementsKHR(
+    VkDevice                                    device,
+    const VkDeviceImageMemoryRequirements*      pInfo,
+    uint32_t*                                   pSparseMemoryRequirementCount,
+    VkSparseImageMemoryRequirements2*           pSparseMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceImageSparseMemoryRequirementsKHR fp = (PFN_vkGetDeviceImageSparseMemoryRequirementsKHR)loader_resolve_lazy_device_command(table, "vkGetDeviceImageSparseMemoryRequirementsKHR",
+        (PFN_vkVoidFunction *)&table->GetDeviceImageSparseMemoryRequirementsKHR);
+    fp(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+
+// ---- VK_KHR_maintenance5 extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindIndexBuffer2KHR(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkDeviceSize                                size,
+    VkIndexType                                 indexType) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindIndexBuffer2KHR fp = (PFN_vkCmdBindIndexBuffer2KHR)loader_resolve_lazy_device_command(table, "vkCmdBindIndexBuffer2KHR",
+        (PFN_vkVoidFunction *)&table->CmdBindIndexBuffer2KHR);
+    fp(commandBuffer, buffer, offset, size, indexType);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetRenderingAreaGranularityKHR(
+    VkDevice                                    device,
+    const VkRenderingAreaInfo*                  pRenderingAreaInfo,
+    VkExtent2D*                                 pGranularity) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetRenderingAreaGranularityKHR fp = (PFN_vkGetRenderingAreaGranularityKHR)loader_resolve_lazy_device_command(table, "vkGetRenderingAreaGranularityKHR",
+        (PFN_vkVoidFunction *)&table->GetRenderingAreaGranularityKHR);
+    fp(device, pRenderingAreaInfo, pGranularity);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceImageSubresourceLayoutKHR(
+    VkDevice                                    device,
+    const VkDeviceImageSubresourceInfo*         pInfo,
+    VkSubresourceLayout2*                       pLayout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceImageSubresourceLayoutKHR fp = (PFN_vkGetDeviceImageSubresourceLayoutKHR)loader_resolve_lazy_device_command(table, "vkGetDeviceImageSubresourceLayoutKHR",
+        (PFN_vkVoidFunction *)&table->GetDeviceImageSubresourceLayoutKHR);
+    fp(device, pInfo, pLayout);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetImageSubresourceLayout2KHR(
+    VkDevice                                    device,
+    VkImage                                     image,
+    const VkImageSubresource2*                  pSubresource,
+    VkSubresourceLayout2*                       pLayout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageSubresourceLayout2KHR fp = (PFN_vkGetImageSubresourceLayout2KHR)loader_resolve_lazy_device_command(table, "vkGetImageSubresourceLayout2KHR",
+        (PFN_vkVoidFunction *)&table->GetImageSubresourceLayout2KHR);
+    fp(device, image, pSubresource, pLayout);
+}
+
+// ---- VK_KHR_pipeline_binary extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreatePipelineBinariesKHR(
+    VkDevice                                    device,
+    const VkPipelineBinaryCreateInfoKHR*        pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkPipelineBinaryHandlesInfoKHR*             pBinaries) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreatePipelineBinariesKHR fp = (PFN_vkCreatePipelineBinariesKHR)loader_resolve_lazy_device_command(table, "vkCreatePipelineBinariesKHR",
+        (PFN_vkVoidFunction *)&table->CreatePipelineBinariesKHR);
+    return fp(device, pCreateInfo, pAllocator, pBinaries);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyPipelineBinaryKHR(
+    VkDevice                                    device,
+    VkPipelineBinaryKHR                         pipelineBinary,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyPipelineBinaryKHR fp = (PFN_vkDestroyPipelineBinaryKHR)loader_resolve_lazy_device_command(table, "vkDestroyPipelineBinaryKHR",
+        (PFN_vkVoidFunction *)&table->DestroyPipelineBinaryKHR);
+    fp(device, pipelineBinary, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetPipelineKeyKHR(
+    VkDevice                                    device,
+    const VkPipelineCreateInfoKHR*              pPipelineCreateInfo,
+    VkPipelineBinaryKeyKHR*                     pPipelineKey) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetPipelineKeyKHR fp = (PFN_vkGetPipelineKeyKHR)loader_resolve_lazy_device_command(table, "vkGetPipelineKeyKHR",
+        (PFN_vkVoidFunction *)&table->GetPipelineKeyKHR);
+    return fp(device, pPipelineCreateInfo, pPipelineKey);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetPipelineBinaryDataKHR(
+    VkDevice                                    device,
+    const VkPipelineBinaryDataInfoKHR*          pInfo,
+    VkPipelineBinaryKeyKHR*                     pPipelineBinaryKey,
+    size_t*                                     pPipelineBinaryDataSize,
+    void*                                       pPipelineBinaryData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetPipelineBinaryDataKHR fp = (PFN_vkGetPipelineBinaryDataKHR)loader_resolve_lazy_device_command(table, "vkGetPipelineBinaryDataKHR",
+        (PFN_vkVoidFunction *)&table->GetPipelineBinaryDataKHR);
+    return fp(device, pInfo, pPipelineBinaryKey, pPipelineBinaryDataSize, pPipelineBinaryData);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ReleaseCapturedPipelineDataKHR(
+    VkDevice                                    device,
+    const VkReleaseCapturedPipelineDataInfoKHR* pInfo,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkReleaseCapturedPipelineDataKHR fp = (PFN_vkReleaseCapturedPipelineDataKHR)loader_resolve_lazy_device_command(table, "vkReleaseCapturedPipelineDataKHR",
+        (PFN_vkVoidFunction *)&table->ReleaseCapturedPipelineDataKHR);
+    return fp(device, pInfo, pAllocator);
+}
+
+// ---- VK_KHR_line_rasterization extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetLineStippleKHR(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    lineStippleFactor,
+    uint16_t                                    lineStipplePattern) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetLineStippleKHR fp = (PFN_vkCmdSetLineStippleKHR)loader_resolve_lazy_device_command(table, "vkCmdSetLineStippleKHR",
+        (PFN_vkVoidFunction *)&table->CmdSetLineStippleKHR);
+    fp(commandBuffer, lineStippleFactor, lineStipplePattern);
+}
+
+// ---- VK_KHR_calibrated_timestamps extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetCalibratedTimestampsKHR(
+    VkDevice                                    device,
+    uint32_t                                    timestampCount,
+    const VkCalibratedTimestampInfoKHR*         pTimestampInfos,
+    uint64_t*                                   pTimestamps,
+    uint64_t*                                   pMaxDeviation) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetCalibratedTimestampsKHR fp = (PFN_vkGetCalibratedTimestampsKHR)loader_resolve_lazy_device_command(table, "vkGetCalibratedTimestampsKHR",
+        (PFN_vkVoidFunction *)&table->GetCalibratedTimestampsKHR);
+    return fp(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
+}
+
+// ---- VK_KHR_maintenance6 extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindDescriptorSets2KHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkBindDescriptorSetsInfo*             pBindDescriptorSetsInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindDescriptorSets2KHR fp = (PFN_vkCmdBindDescriptorSets2KHR)loader_resolve_lazy_device_command(table, "vkCmdBindDescriptorSets2KHR",
+        (PFN_vkVoidFunction *)&table->CmdBindDescriptorSets2KHR);
+    fp(commandBuffer, pBindDescriptorSetsInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPushConstants2KHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkPushConstantsInfo*                  pPushConstantsInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPushConstants2KHR fp = (PFN_vkCmdPushConstants2KHR)loader_resolve_lazy_device_command(table, "vkCmdPushConstants2KHR",
+        (PFN_vkVoidFunction *)&table->CmdPushConstants2KHR);
+    fp(commandBuffer, pPushConstantsInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPushDescriptorSet2KHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkPushDescriptorSetInfo*              pPushDescriptorSetInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPushDescriptorSet2KHR fp = (PFN_vkCmdPushDescriptorSet2KHR)loader_resolve_lazy_device_command(table, "vkCmdPushDescriptorSet2KHR",
+        (PFN_vkVoidFunction *)&table->CmdPushDescriptorSet2KHR);
+    fp(commandBuffer, pPushDescriptorSetInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPushDescriptorSetWithTemplate2KHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkPushDescriptorSetWithTemplateInfo*  pPushDescriptorSetWithTemplateInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPushDescriptorSetWithTemplate2KHR fp = (PFN_vkCmdPushDescriptorSetWithTemplate2KHR)loader_resolve_lazy_device_command(table, "vkCmdPushDescriptorSetWithTemplate2KHR",
+        (PFN_vkVoidFunction *)&table->CmdPushDescriptorSetWithTemplate2KHR);
+    fp(commandBuffer, pPushDescriptorSetWithTemplateInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDescriptorBufferOffsets2EXT(
+    VkCommandBuffer                             commandBuffer,
+    const VkSetDescriptorBufferOffsetsInfoEXT*  pSetDescriptorBufferOffsetsInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDescriptorBufferOffsets2EXT fp = (PFN_vkCmdSetDescriptorBufferOffsets2EXT)loader_resolve_lazy_device_command(table, "vkCmdSetDescriptorBufferOffsets2EXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDescriptorBufferOffsets2EXT);
+    fp(commandBuffer, pSetDescriptorBufferOffsetsInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindDescriptorBufferEmbeddedSamplers2EXT(
+    VkCommandBuffer                             commandBuffer,
+    const VkBindDescriptorBufferEmbeddedSamplersInfoEXT* pBindDescriptorBufferEmbeddedSamplersInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT fp = (PFN_vkCmdBindDescriptorBufferEmbeddedSamplers2EXT)loader_resolve_lazy_device_command(table, "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT",
+        (PFN_vkVoidFunction *)&table->CmdBindDescriptorBufferEmbeddedSamplers2EXT);
+    fp(commandBuffer, pBindDescriptorBufferEmbeddedSamplersInfo);
+}
+
+// ---- VK_EXT_debug_marker extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_DebugMarkerSetObjectTagEXT(
+    VkDevice                                    device,
+    const VkDebugMarkerObjectTagInfoEXT*        pTagInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDebugMarkerSetObjectTagEXT fp = (PFN_vkDebugMarkerSetObjectTagEXT)loader_resolve_lazy_device_command(table, "vkDebugMarkerSetObjectTagEXT",
+        (PFN_vkVoidFunction *)&table->DebugMarkerSetObjectTagEXT);
+    return fp(device, pTagInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_DebugMarkerSetObjectNameEXT(
+    VkDevice                                    device,
+    const VkDebugMarkerObjectNameInfoEXT*       pNameInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDebugMarkerSetObjectNameEXT fp = (PFN_vkDebugMarkerSetObjectNameEXT)loader_resolve_lazy_device_command(table, "vkDebugMarkerSetObjectNameEXT",
+        (PFN_vkVoidFunction *)&table->DebugMarkerSetObjectNameEXT);
+    return fp(device, pNameInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDebugMarkerBeginEXT(
+    VkCommandBuffer                             commandBuffer,
+    const VkDebugMarkerMarkerInfoEXT*           pMarkerInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDebugMarkerBeginEXT fp = (PFN_vkCmdDebugMarkerBeginEXT)loader_resolve_lazy_device_command(table, "vkCmdDebugMarkerBeginEXT",
+        (PFN_vkVoidFunction *)&table->CmdDebugMarkerBeginEXT);
+    fp(commandBuffer, pMarkerInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDebugMarkerEndEXT(
+    VkCommandBuffer                             commandBuffer) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDebugMarkerEndEXT fp = (PFN_vkCmdDebugMarkerEndEXT)loader_resolve_lazy_device_command(table, "vkCmdDebugMarkerEndEXT",
+        (PFN_vkVoidFunction *)&table->CmdDebugMarkerEndEXT);
+    fp(commandBuffer);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDebugMarkerInsertEXT(
+    VkCommandBuffer                             commandBuffer,
+    const VkDebugMarkerMarkerInfoEXT*           pMarkerInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDebugMarkerInsertEXT fp = (PFN_vkCmdDebugMarkerInsertEXT)loader_resolve_lazy_device_command(table, "vkCmdDebugMarkerInsertEXT",
+        (PFN_vkVoidFunction *)&table->CmdDebugMarkerInsertEXT);
+    fp(commandBuffer, pMarkerInfo);
+}
+
+// ---- VK_EXT_transform_feedback extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindTransformFeedbackBuffersEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstBinding,
+    uint32_t                                    bindingCount,
+    const VkBuffer*                             pBuffers,
+    const VkDeviceSize*                         pOffsets,
+    const VkDeviceSize*                         pSizes) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindTransformFeedbackBuffersEXT fp = (PFN_vkCmdBindTransformFeedbackBuffersEXT)loader_resolve_lazy_device_command(table, "vkCmdBindTransformFeedbackBuffersEXT",
+        (PFN_vkVoidFunction *)&table->CmdBindTransformFeedbackBuffersEXT);
+    fp(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBeginTransformFeedbackEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstCounterBuffer,
+    uint32_t                                    counterBufferCount,
+    const VkBuffer*                             pCounterBuffers,
+    const VkDeviceSize*                         pCounterBufferOffsets) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBeginTransformFeedbackEXT fp = (PFN_vkCmdBeginTransformFeedbackEXT)loader_resolve_lazy_device_command(table, "vkCmdBeginTransformFeedbackEXT",
+        (PFN_vkVoidFunction *)&table->CmdBeginTransformFeedbackEXT);
+    fp(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdEndTransformFeedbackEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstCounterBuffer,
+    uint32_t                                    counterBufferCount,
+    const VkBuffer*                             pCounterBuffers,
+    const VkDeviceSize*                         pCounterBufferOffsets) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdEndTransformFeedbackEXT fp = (PFN_vkCmdEndTransformFeedbackEXT)loader_resolve_lazy_device_command(table, "vkCmdEndTransformFeedbackEXT",
+        (PFN_vkVoidFunction *)&table->CmdEndTransformFeedbackEXT);
+    fp(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBeginQueryIndexedEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    query,
+    VkQueryControlFlags                         flags,
+    uint32_t                                    index) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBeginQueryIndexedEXT fp = (PFN_vkCmdBeginQueryIndexedEXT)loader_resolve_lazy_device_command(table, "vkCmdBeginQueryIndexedEXT",
+        (PFN_vkVoidFunction *)&table->CmdBeginQueryIndexedEXT);
+    fp(commandBuffer, queryPool, query, flags, index);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdEndQueryIndexedEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    query,
+    uint32_t                                    index) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdEndQueryIndexedEXT fp = (PFN_vkCmdEndQueryIndexedEXT)loader_resolve_lazy_device_command(table, "vkCmdEndQueryIndexedEXT",
+        (PFN_vkVoidFunction *)&table->CmdEndQueryIndexedEXT);
+    fp(commandBuffer, queryPool, query, index);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawIndirectByteCountEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    instanceCount,
+    uint32_t                                    firstInstance,
+    VkBuffer                                    counterBuffer,
+    VkDeviceSize                                counterBufferOffset,
+    uint32_t                                    counterOffset,
+    uint32_t                                    vertexStride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawIndirectByteCountEXT fp = (PFN_vkCmdDrawIndirectByteCountEXT)loader_resolve_lazy_device_command(table, "vkCmdDrawIndirectByteCountEXT",
+        (PFN_vkVoidFunction *)&table->CmdDrawIndirectByteCountEXT);
+    fp(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
+}
+
+// ---- VK_NVX_binary_import extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateCuModuleNVX(
+    VkDevice                                    device,
+    const VkCuModuleCreateInfoNVX*              pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkCuModuleNVX*                              pModule) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateCuModuleNVX fp = (PFN_vkCreateCuModuleNVX)loader_resolve_lazy_device_command(table, "vkCreateCuModuleNVX",
+        (PFN_vkVoidFunction *)&table->CreateCuModuleNVX);
+    return fp(device, pCreateInfo, pAllocator, pModule);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateCuFunctionNVX(
+    VkDevice                                    device,
+    const VkCuFunctionCreateInfoNVX*            pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkCuFunctionNVX*                            pFunction) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateCuFunctionNVX fp = (PFN_vkCreateCuFunctionNVX)loader_resolve_lazy_device_command(table, "vkCreateCuFunctionNVX",
+        (PFN_vkVoidFunction *)&table->CreateCuFunctionNVX);
+    return fp(device, pCreateInfo, pAllocator, pFunction);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyCuModuleNVX(
+    VkDevice                                    device,
+    VkCuModuleNVX                               module,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyCuModuleNVX fp = (PFN_vkDestroyCuModuleNVX)loader_resolve_lazy_device_command(table, "vkDestroyCuModuleNVX",
+        (PFN_vkVoidFunction *)&table->DestroyCuModuleNVX);
+    fp(device, module, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyCuFunctionNVX(
+    VkDevice                                    device,
+    VkCuFunctionNVX                             function,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyCuFunctionNVX fp = (PFN_vkDestroyCuFunctionNVX)loader_resolve_lazy_device_command(table, "vkDestroyCuFunctionNVX",
+        (PFN_vkVoidFunction *)&table->DestroyCuFunctionNVX);
+    fp(device, function, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCuLaunchKernelNVX(
+    VkCommandBuffer                             commandBuffer,
+    const VkCuLaunchInfoNVX*                    pLaunchInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCuLaunchKernelNVX fp = (PFN_vkCmdCuLaunchKernelNVX)loader_resolve_lazy_device_command(table, "vkCmdCuLaunchKernelNVX",
+        (PFN_vkVoidFunction *)&table->CmdCuLaunchKernelNVX);
+    fp(commandBuffer, pLaunchInfo);
+}
+
+// ---- VK_NVX_image_view_handle extension commands
+static VKAPI_ATTR uint32_t VKAPI_CALL loader_lazy_GetImageViewHandleNVX(
+    VkDevice                                    device,
+    const VkImageViewHandleInfoNVX*             pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageViewHandleNVX fp = (PFN_vkGetImageViewHandleNVX)loader_resolve_lazy_device_command(table, "vkGetImageViewHandleNVX",
+        (PFN_vkVoidFunction *)&table->GetImageViewHandleNVX);
+    return fp(device, pInfo);
+}
+static VKAPI_ATTR uint64_t VKAPI_CALL loader_lazy_GetImageViewHandle64NVX(
+    VkDevice                                    device,
+    const VkImageViewHandleInfoNVX*             pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageViewHandle64NVX fp = (PFN_vkGetImageViewHandle64NVX)loader_resolve_lazy_device_command(table, "vkGetImageViewHandle64NVX",
+        (PFN_vkVoidFunction *)&table->GetImageViewHandle64NVX);
+    return fp(device, pInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetImageViewAddressNVX(
+    VkDevice                                    device,
+    VkImageView                                 imageView,
+    VkImageViewAddressPropertiesNVX*            pProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageViewAddressNVX fp = (PFN_vkGetImageViewAddressNVX)loader_resolve_lazy_device_command(table, "vkGetImageViewAddressNVX",
+        (PFN_vkVoidFunction *)&table->GetImageViewAddressNVX);
+    return fp(device, imageView, pProperties);
+}
+
+// ---- VK_AMD_draw_indirect_count extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawIndirectCountAMD(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkBuffer                                    countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawIndirectCountAMD fp = (PFN_vkCmdDrawIndirectCountAMD)loader_resolve_lazy_device_command(table, "vkCmdDrawIndirectCountAMD",
+        (PFN_vkVoidFunction *)&table->CmdDrawIndirectCountAMD);
+    fp(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawIndexedIndirectCountAMD(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkBuffer                                    countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawIndexedIndirectCountAMD fp = (PFN_vkCmdDrawIndexedIndirectCountAMD)loader_resolve_lazy_device_command(table, "vkCmdDrawIndexedIndirectCountAMD",
+        (PFN_vkVoidFunction *)&table->CmdDrawIndexedIndirectCountAMD);
+    fp(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+// ---- VK_AMD_shader_info extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetShaderInfoAMD(
+    VkDevice                                    device,
+    VkPipeline                                  pipeline,
+    VkShaderStageFlagBits                       shaderStage,
+    VkShaderInfoTypeAMD                         infoType,
+    size_t*                                     pInfoSize,
+    void*                                       pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetShaderInfoAMD fp = (PFN_vkGetShaderInfoAMD)loader_resolve_lazy_device_command(table, "vkGetShaderInfoAMD",
+        (PFN_vkVoidFunction *)&table->GetShaderInfoAMD);
+    return fp(device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
+}
+
+// ---- VK_NV_external_memory_win32 extension commands
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetMemoryWin32HandleNV(
+    VkDevice                                    device,
+    VkDeviceMemory                              memory,
+    VkExternalMemoryHandleTypeFlagsNV           handleType,
+    HANDLE*                                     pHandle) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetMemoryWin32HandleNV fp = (PFN_vkGetMemoryWin32HandleNV)loader_resolve_lazy_device_command(table, "vkGetMemoryWin32HandleNV",
+        (PFN_vkVoidFunction *)&table->GetMemoryWin32HandleNV);
+    return fp(device, memory, handleType, pHandle);
+}
+#endif // VK_USE_PLATFORM_WIN32_KHR
+
+// ---- VK_EXT_conditional_rendering extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBeginConditionalRenderingEXT(
+    VkCommandBuffer                             commandBuffer,
+    const VkConditionalRenderingBeginInfoEXT*   pConditionalRenderingBegin) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBeginConditionalRenderingEXT fp = (PFN_vkCmdBeginConditionalRenderingEXT)loader_resolve_lazy_device_command(table, "vkCmdBeginConditionalRenderingEXT",
+        (PFN_vkVoidFunction *)&table->CmdBeginConditionalRenderingEXT);
+    fp(commandBuffer, pConditionalRenderingBegin);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdEndConditionalRenderingEXT(
+    VkCommandBuffer                             commandBuffer) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdEndConditionalRenderingEXT fp = (PFN_vkCmdEndConditionalRenderingEXT)loader_resolve_lazy_device_command(table, "vkCmdEndConditionalRenderingEXT",
+        (PFN_vkVoidFunction *)&table->CmdEndConditionalRenderingEXT);
+    fp(commandBuffer);
+}
+
+// ---- VK_NV_clip_space_w_scaling extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetViewportWScalingNV(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstViewport,
+    uint32_t                                    viewportCount,
+    const VkViewportWScalingNV*                 pViewportWScalings) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetViewportWScalingNV fp = (PFN_vkCmdSetViewportWScalingNV)loader_resolve_lazy_device_command(table, "vkCmdSetViewportWScalingNV",
+        (PFN_vkVoidFunction *)&table->CmdSetViewportWScalingNV);
+    fp(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+}
+
+// ---- VK_EXT_display_control extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_DisplayPowerControlEXT(
+    VkDevice                                    device,
+    VkDisplayKHR                                display,
+    const VkDisplayPowerInfoEXT*                pDisplayPowerInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDisplayPowerControlEXT fp = (PFN_vkDisplayPowerControlEXT)loader_resolve_lazy_device_command(table, "vkDisplayPowerControlEXT",
+        (PFN_vkVoidFunction *)&table->DisplayPowerControlEXT);
+    return fp(device, display, pDisplayPowerInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_RegisterDeviceEventEXT(
+    VkDevice                                    device,
+    const VkDeviceEventInfoEXT*                 pDeviceEventInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkFence*                                    pFence) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkRegisterDeviceEventEXT fp = (PFN_vkRegisterDeviceEventEXT)loader_resolve_lazy_device_command(table, "vkRegisterDeviceEventEXT",
+        (PFN_vkVoidFunction *)&table->RegisterDeviceEventEXT);
+    return fp(device, pDeviceEventInfo, pAllocator, pFence);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_RegisterDisplayEventEXT(
+    VkDevice                                    device,
+    VkDisplayKHR                                display,
+    const VkDisplayEventInfoEXT*                pDisplayEventInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkFence*                                    pFence) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkRegisterDisplayEventEXT fp = (PFN_vkRegisterDisplayEventEXT)loader_resolve_lazy_device_command(table, "vkRegisterDisplayEventEXT",
+        (PFN_vkVoidFunction *)&table->RegisterDisplayEventEXT);
+    return fp(device, display, pDisplayEventInfo, pAllocator, pFence);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetSwapchainCounterEXT(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain,
+    VkSurfaceCounterFlagBitsEXT                 counter,
+    uint64_t*                                   pCounterValue) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetSwapchainCounterEXT fp = (PFN_vkGetSwapchainCounterEXT)loader_resolve_lazy_device_command(table, "vkGetSwapchainCounterEXT",
+        (PFN_vkVoidFunction *)&table->GetSwapchainCounterEXT);
+    return fp(device, swapchain, counter, pCounterValue);
+}
+
+// ---- VK_GOOGLE_display_timing extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetRefreshCycleDurationGOOGLE(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain,
+    VkRefreshCycleDurationGOOGLE*               pDisplayTimingProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetRefreshCycleDurationGOOGLE fp = (PFN_vkGetRefreshCycleDurationGOOGLE)loader_resolve_lazy_device_command(table, "vkGetRefreshCycleDurationGOOGLE",
+        (PFN_vkVoidFunction *)&table->GetRefreshCycleDurationGOOGLE);
+    return fp(device, swapchain, pDisplayTimingProperties);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetPastPresentationTimingGOOGLE(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain,
+    uint32_t*                                   pPresentationTimingCount,
+    VkPastPresentationTimingGOOGLE*             pPresentationTimings) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetPastPresentationTimingGOOGLE fp = (PFN_vkGetPastPresentationTimingGOOGLE)loader_resolve_lazy_device_command(table, "vkGetPastPresentationTimingGOOGLE",
+        (PFN_vkVoidFunction *)&table->GetPastPresentationTimingGOOGLE);
+    return fp(device, swapchain, pPresentationTimingCount, pPresentationTimings);
+}
+
+// ---- VK_EXT_discard_rectangles extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDiscardRectangleEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstDiscardRectangle,
+    uint32_t                                    discardRectangleCount,
+    const VkRect2D*                             pDiscardRectangles) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDiscardRectangleEXT fp = (PFN_vkCmdSetDiscardRectangleEXT)loader_resolve_lazy_device_command(table, "vkCmdSetDiscardRectangleEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDiscardRectangleEXT);
+    fp(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDiscardRectangleEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    discardRectangleEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDiscardRectangleEnableEXT fp = (PFN_vkCmdSetDiscardRectangleEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetDiscardRectangleEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDiscardRectangleEnableEXT);
+    fp(commandBuffer, discardRectangleEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDiscardRectangleModeEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkDiscardRectangleModeEXT                   discardRectangleMode) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDiscardRectangleModeEXT fp = (PFN_vkCmdSetDiscardRectangleModeEXT)loader_resolve_lazy_device_command(table, "vkCmdSetDiscardRectangleModeEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDiscardRectangleModeEXT);
+    fp(commandBuffer, discardRectangleMode);
+}
+
+// ---- VK_EXT_hdr_metadata extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_SetHdrMetadataEXT(
+    VkDevice                                    device,
+    uint32_t                                    swapchainCount,
+    const VkSwapchainKHR*                       pSwapchains,
+    const VkHdrMetadataEXT*                     pMetadata) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkSetHdrMetadataEXT fp = (PFN_vkSetHdrMetadataEXT)loader_resolve_lazy_device_command(table, "vkSetHdrMetadataEXT",
+        (PFN_vkVoidFunction *)&table->SetHdrMetadataEXT);
+    fp(device, swapchainCount, pSwapchains, pMetadata);
+}
+
+// ---- VK_ANDROID_external_memory_android_hardware_buffer extension commands
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetAndroidHardwareBufferPropertiesANDROID(
+    VkDevice                                    device,
+    const struct AHardwareBuffer*               buffer,
+    VkAndroidHardwareBufferPropertiesANDROID*   pProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetAndroidHardwareBufferPropertiesANDROID fp = (PFN_vkGetAndroidHardwareBufferPropertiesANDROID)loader_resolve_lazy_device_command(table, "vkGetAndroidHardwareBufferPropertiesANDROID",
+        (PFN_vkVoidFunction *)&table->GetAndroidHardwareBufferPropertiesANDROID);
+    return fp(device, buffer, pProperties);
+}
+#endif // VK_USE_PLATFORM_ANDROID_KHR
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetMemoryAndroidHardwareBufferANDROID(
+    VkDevice                                    device,
+    const VkMemoryGetAndroidHardwareBufferInfoANDROID* pInfo,
+    struct AHardwareBuffer**                    pBuffer) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetMemoryAndroidHardwareBufferANDROID fp = (PFN_vkGetMemoryAndroidHardwareBufferANDROID)loader_resolve_lazy_device_command(table, "vkGetMemoryAndroidHardwareBufferANDROID",
+        (PFN_vkVoidFunction *)&table->GetMemoryAndroidHardwareBufferANDROID);
+    return fp(device, pInfo, pBuffer);
+}
+#endif // VK_USE_PLATFORM_ANDROID_KHR
+
+// ---- VK_AMDX_shader_enqueue extension commands
+#if defined(VK_ENABLE_BETA_EXTENSIONS)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateExecutionGraphPipelinesAMDX(
+    VkDevice                                    device,
+    VkPipelineCache                             pipelineCache,
+    uint32_t                                    createInfoCount,
+    const VkExecutionGraphPipelineCreateInfoAMDX* pCreateInfos,
+    const VkAllocationCallbacks*                pAllocator,
+    VkPipeline*                                 pPipelines) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateExecutionGraphPipelinesAMDX fp = (PFN_vkCreateExecutionGraphPipelinesAMDX)loader_resolve_lazy_device_command(table, "vkCreateExecutionGraphPipelinesAMDX",
+        (PFN_vkVoidFunction *)&table->CreateExecutionGraphPipelinesAMDX);
+    return fp(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#if defined(VK_ENABLE_BETA_EXTENSIONS)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetExecutionGraphPipelineScratchSizeAMDX(
+    VkDevice                                    device,
+    VkPipeline                                  executionGraph,
+    VkExecutionGraphPipelineScratchSizeAMDX*    pSizeInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetExecutionGraphPipelineScratchSizeAMDX fp = (PFN_vkGetExecutionGraphPipelineScratchSizeAMDX)loader_resolve_lazy_device_command(table, "vkGetExecutionGraphPipelineScratchSizeAMDX",
+        (PFN_vkVoidFunction *)&table->GetExecutionGraphPipelineScratchSizeAMDX);
+    return fp(device, executionGraph, pSizeInfo);
+}
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#if defined(VK_ENABLE_BETA_EXTENSIONS)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetExecutionGraphPipelineNodeIndexAMDX(
+    VkDevice                                    device,
+    VkPipeline                                  executionGraph,
+    const VkPipelineShaderStageNodeCreateInfoAMDX* pNodeInfo,
+    uint32_t*                                   pNodeIndex) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetExecutionGraphPipelineNodeIndexAMDX fp = (PFN_vkGetExecutionGraphPipelineNodeIndexAMDX)loader_resolve_lazy_device_command(table, "vkGetExecutionGraphPipelineNodeIndexAMDX",
+        (PFN_vkVoidFunction *)&table->GetExecutionGraphPipelineNodeIndexAMDX);
+    return fp(device, executionGraph, pNodeInfo, pNodeIndex);
+}
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#if defined(VK_ENABLE_BETA_EXTENSIONS)
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdInitializeGraphScratchMemoryAMDX(
+    VkCommandBuffer                             commandBuffer,
+    VkPipeline                                  executionGraph,
+    VkDeviceAddress                             scratch,
+    VkDeviceSize                                scratchSize) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdInitializeGraphScratchMemoryAMDX fp = (PFN_vkCmdInitializeGraphScratchMemoryAMDX)loader_resolve_lazy_device_command(table, "vkCmdInitializeGraphScratchMemoryAMDX",
+        (PFN_vkVoidFunction *)&table->CmdInitializeGraphScratchMemoryAMDX);
+    fp(commandBuffer, executionGraph, scratch, scratchSize);
+}
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#if defined(VK_ENABLE_BETA_EXTENSIONS)
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDispatchGraphAMDX(
+    VkCommandBuffer                             commandBuffer,
+    VkDeviceAddress                             scratch,
+    VkDeviceSize                                scratchSize,
+    const VkDispatchGraphCountInfoAMDX*         pCountInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDispatchGraphAMDX fp = (PFN_vkCmdDispatchGraphAMDX)loader_resolve_lazy_device_command(table, "vkCmdDispatchGraphAMDX",
+        (PFN_vkVoidFunction *)&table->CmdDispatchGraphAMDX);
+    fp(commandBuffer, scratch, scratchSize, pCountInfo);
+}
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#if defined(VK_ENABLE_BETA_EXTENSIONS)
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDispatchGraphIndirectAMDX(
+    VkCommandBuffer                             commandBuffer,
+    VkDeviceAddress                             scratch,
+    VkDeviceSize                                scratchSize,
+    const VkDispatchGraphCountInfoAMDX*         pCountInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDispatchGraphIndirectAMDX fp = (PFN_vkCmdDispatchGraphIndirectAMDX)loader_resolve_lazy_device_command(table, "vkCmdDispatchGraphIndirectAMDX",
+        (PFN_vkVoidFunction *)&table->CmdDispatchGraphIndirectAMDX);
+    fp(commandBuffer, scratch, scratchSize, pCountInfo);
+}
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#if defined(VK_ENABLE_BETA_EXTENSIONS)
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDispatchGraphIndirectCountAMDX(
+    VkCommandBuffer                             commandBuffer,
+    VkDeviceAddress                             scratch,
+    VkDeviceSize                                scratchSize,
+    VkDeviceAddress                             countInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDispatchGraphIndirectCountAMDX fp = (PFN_vkCmdDispatchGraphIndirectCountAMDX)loader_resolve_lazy_device_command(table, "vkCmdDispatchGraphIndirectCountAMDX",
+        (PFN_vkVoidFunction *)&table->CmdDispatchGraphIndirectCountAMDX);
+    fp(commandBuffer, scratch, scratchSize, countInfo);
+}
+#endif // VK_ENABLE_BETA_EXTENSIONS
+
+// ---- VK_EXT_sample_locations extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetSampleLocationsEXT(
+    VkCommandBuffer                             commandBuffer,
+    const VkSampleLocationsInfoEXT*             pSampleLocationsInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetSampleLocationsEXT fp = (PFN_vkCmdSetSampleLocationsEXT)loader_resolve_lazy_device_command(table, "vkCmdSetSampleLocationsEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetSampleLocationsEXT);
+    fp(commandBuffer, pSampleLocationsInfo);
+}
+
+// ---- VK_EXT_image_drm_format_modifier extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetImageDrmFormatModifierPropertiesEXT(
+    VkDevice                                    device,
+    VkImage                                     image,
+    VkImageDrmFormatModifierPropertiesEXT*      pProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageDrmFormatModifierPropertiesEXT fp = (PFN_vkGetImageDrmFormatModifierPropertiesEXT)loader_resolve_lazy_device_command(table, "vkGetImageDrmFormatModifierPropertiesEXT",
+        (PFN_vkVoidFunction *)&table->GetImageDrmFormatModifierPropertiesEXT);
+    return fp(device, image, pProperties);
+}
+
+// ---- VK_EXT_validation_cache extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateValidationCacheEXT(
+    VkDevice                                    device,
+    const VkValidationCacheCreateInfoEXT*       pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkValidationCacheEXT*                       pValidationCache) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateValidationCacheEXT fp = (PFN_vkCreateValidationCacheEXT)loader_resolve_lazy_device_command(table, "vkCreateValidationCacheEXT",
+        (PFN_vkVoidFunction *)&table->CreateValidationCacheEXT);
+    return fp(device, pCreateInfo, pAllocator, pValidationCache);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyValidationCacheEXT(
+    VkDevice                                    device,
+    VkValidationCacheEXT                        validationCache,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyValidationCacheEXT fp = (PFN_vkDestroyValidationCacheEXT)loader_resolve_lazy_device_command(table, "vkDestroyValidationCacheEXT",
+        (PFN_vkVoidFunction *)&table->DestroyValidationCacheEXT);
+    fp(device, validationCache, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_MergeValidationCachesEXT(
+    VkDevice                                    device,
+    VkValidationCacheEXT                        dstCache,
+    uint32_t                                    srcCacheCount,
+    const VkValidationCacheEXT*                 pSrcCaches) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkMergeValidationCachesEXT fp = (PFN_vkMergeValidationCachesEXT)loader_resolve_lazy_device_command(table, "vkMergeValidationCachesEXT",
+        (PFN_vkVoidFunction *)&table->MergeValidationCachesEXT);
+    return fp(device, dstCache, srcCacheCount, pSrcCaches);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetValidationCacheDataEXT(
+    VkDevice                                    device,
+    VkValidationCacheEXT                        validationCache,
+    size_t*                                     pDataSize,
+    void*                                       pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetValidationCacheDataEXT fp = (PFN_vkGetValidationCacheDataEXT)loader_resolve_lazy_device_command(table, "vkGetValidationCacheDataEXT",
+        (PFN_vkVoidFunction *)&table->GetValidationCacheDataEXT);
+    return fp(device, validationCache, pDataSize, pData);
+}
+
+// ---- VK_NV_shading_rate_image extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindShadingRateImageNV(
+    VkCommandBuffer                             commandBuffer,
+    VkImageView                                 imageView,
+    VkImageLayout                               imageLayout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindShadingRateImageNV fp = (PFN_vkCmdBindShadingRateImageNV)loader_resolve_lazy_device_command(table, "vkCmdBindShadingRateImageNV",
+        (PFN_vkVoidFunction *)&table->CmdBindShadingRateImageNV);
+    fp(commandBuffer, imageView, imageLayout);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetViewportShadingRatePaletteNV(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstViewport,
+    uint32_t                                    viewportCount,
+    const VkShadingRatePaletteNV*               pShadingRatePalettes) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetViewportShadingRatePaletteNV fp = (PFN_vkCmdSetViewportShadingRatePaletteNV)loader_resolve_lazy_device_command(table, "vkCmdSetViewportShadingRatePaletteNV",
+        (PFN_vkVoidFunction *)&table->CmdSetViewportShadingRatePaletteNV);
+    fp(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetCoarseSampleOrderNV(
+    VkCommandBuffer                             commandBuffer,
+    VkCoarseSampleOrderTypeNV                   sampleOrderType,
+    uint32_t                                    customSampleOrderCount,
+    const VkCoarseSampleOrderCustomNV*          pCustomSampleOrders) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetCoarseSampleOrderNV fp = (PFN_vkCmdSetCoarseSampleOrderNV)loader_resolve_lazy_device_command(table, "vkCmdSetCoarseSampleOrderNV",
+        (PFN_vkVoidFunction *)&table->CmdSetCoarseSampleOrderNV);
+    fp(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
+}
+
+// ---- VK_NV_ray_tracing extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateAccelerationStructureNV(
+    VkDevice                                    device,
+    const VkAccelerationStructureCreateInfoNV*  pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkAccelerationStructureNV*                  pAccelerationStructure) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateAccelerationStructureNV fp = (PFN_vkCreateAccelerationStructureNV)loader_resolve_lazy_device_command(table, "vkCreateAccelerationStructureNV",
+        (PFN_vkVoidFunction *)&table->CreateAccelerationStructureNV);
+    return fp(device, pCreateInfo, pAllocator, pAccelerationStructure);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyAccelerationStructureNV(
+    VkDevice                                    device,
+    VkAccelerationStructureNV                   accelerationStructure,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyAccelerationStructureNV fp = (PFN_vkDestroyAccelerationStructureNV)loader_resolve_lazy_device_command(table, "vkDestroyAccelerationStructureNV",
+        (PFN_vkVoidFunction *)&table->DestroyAccelerationStructureNV);
+    fp(device, accelerationStructure, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetAccelerationStructureMemoryRequirementsNV(
+    VkDevice                                    device,
+    const VkAccelerationStructureMemoryRequirementsInfoNV* pInfo,
+    VkMemoryRequirements2KHR*                   pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetAccelerationStructureMemoryRequirementsNV fp = (PFN_vkGetAccelerationStructureMemoryRequirementsNV)loader_resolve_lazy_device_command(table, "vkGetAccelerationStructureMemoryRequirementsNV",
+        (PFN_vkVoidFunction *)&table->GetAccelerationStructureMemoryRequirementsNV);
+    fp(device, pInfo, pMemoryRequirements);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_BindAccelerationStructureMemoryNV(
+    VkDevice                                    device,
+    uint32_t                                    bindInfoCount,
+    const VkBindAccelerationStructureMemoryInfoNV* pBindInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkBindAccelerationStructureMemoryNV fp = (PFN_vkBindAccelerationStructureMemoryNV)loader_resolve_lazy_device_command(table, "vkBindAccelerationStructureMemoryNV",
+        (PFN_vkVoidFunction *)&table->BindAccelerationStructureMemoryNV);
+    return fp(device, bindInfoCount, pBindInfos);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBuildAccelerationStructureNV(
+    VkCommandBuffer                             commandBuffer,
+    const VkAccelerationStructureInfoNV*        pInfo,
+    VkBuffer                                    instanceData,
+    VkDeviceSize                                instanceOffset,
+    VkBool32                                    update,
+    VkAccelerationStructureNV                   dst,
+    VkAccelerationStructureNV                   src,
+    VkBuffer                                    scratch,
+    VkDeviceSize                                scratchOffset) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBuildAccelerationStructureNV fp = (PFN_vkCmdBuildAccelerationStructureNV)loader_resolve_lazy_device_command(table, "vkCmdBuildAccelerationStructureNV",
+        (PFN_vkVoidFunction *)&table->CmdBuildAccelerationStructureNV);
+    fp(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyAccelerationStructureNV(
+    VkCommandBuffer                             commandBuffer,
+    VkAccelerationStructureNV                   dst,
+    VkAccelerationStructureNV                   src,
+    VkCopyAccelerationStructureModeKHR          mode) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyAccelerationStructureNV fp = (PFN_vkCmdCopyAccelerationStructureNV)loader_resolve_lazy_device_command(table, "vkCmdCopyAccelerationStructureNV",
+        (PFN_vkVoidFunction *)&table->CmdCopyAccelerationStructureNV);
+    fp(commandBuffer, dst, src, mode);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdTraceRaysNV(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    raygenShaderBindingTableBuffer,
+    VkDeviceSize                                raygenShaderBindingOffset,
+    VkBuffer                                    missShaderBindingTableBuffer,
+    VkDeviceSize                                missShaderBindingOffset,
+    VkDeviceSize                                missShaderBindingStride,
+    VkBuffer                                    hitShaderBindingTableBuffer,
+    VkDeviceSize                                hitShaderBindingOffset,
+    VkDeviceSize                                hitShaderBindingStride,
+    VkBuffer                                    callableShaderBindingTableBuffer,
+    VkDeviceSize                                callableShaderBindingOffset,
+    VkDeviceSize                                callableShaderBindingStride,
+    uint32_t                                    width,
+    uint32_t                                    height,
+    uint32_t                                    depth) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdTraceRaysNV fp = (PFN_vkCmdTraceRaysNV)loader_resolve_lazy_device_command(table, "vkCmdTraceRaysNV",
+        (PFN_vkVoidFunction *)&table->CmdTraceRaysNV);
+    fp(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateRayTracingPipelinesNV(
+    VkDevice                                    device,
+    VkPipelineCache                             pipelineCache,
+    uint32_t                                    createInfoCount,
+    const VkRayTracingPipelineCreateInfoNV*     pCreateInfos,
+    const VkAllocationCallbacks*                pAllocator,
+    VkPipeline*                                 pPipelines) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateRayTracingPipelinesNV fp = (PFN_vkCreateRayTracingPipelinesNV)loader_resolve_lazy_device_command(table, "vkCreateRayTracingPipelinesNV",
+        (PFN_vkVoidFunction *)&table->CreateRayTracingPipelinesNV);
+    return fp(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetRayTracingShaderGroupHandlesKHR(
+    VkDevice                                    device,
+    VkPipeline                                  pipeline,
+    uint32_t                                    firstGroup,
+    uint32_t                                    groupCount,
+    size_t                                      dataSize,
+    void*                                       pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetRayTracingShaderGroupHandlesKHR fp = (PFN_vkGetRayTracingShaderGroupHandlesKHR)loader_resolve_lazy_device_command(table, "vkGetRayTracingShaderGroupHandlesKHR",
+        (PFN_vkVoidFunction *)&table->GetRayTracingShaderGroupHandlesKHR);
+    return fp(device, pipeline, firstGroup, groupCount, dataSize, pData);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetRayTracingShaderGroupHandlesNV(
+    VkDevice                                    device,
+    VkPipeline                                  pipeline,
+    uint32_t                                    firstGroup,
+    uint32_t                                    groupCount,
+    size_t                                      dataSize,
+    void*                                       pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetRayTracingShaderGroupHandlesNV fp = (PFN_vkGetRayTracingShaderGroupHandlesNV)loader_resolve_lazy_device_command(table, "vkGetRayTracingShaderGroupHandlesNV",
+        (PFN_vkVoidFunction *)&table->GetRayTracingShaderGroupHandlesNV);
+    return fp(device, pipeline, firstGroup, groupCount, dataSize, pData);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetAccelerationStructureHandleNV(
+    VkDevice                                    device,
+    VkAccelerationStructureNV                   accelerationStructure,
+    size_t                                      dataSize,
+    void*                                       pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetAccelerationStructureHandleNV fp = (PFN_vkGetAccelerationStructureHandleNV)loader_resolve_lazy_device_command(table, "vkGetAccelerationStructureHandleNV",
+        (PFN_vkVoidFunction *)&table->GetAccelerationStructureHandleNV);
+    return fp(device, accelerationStructure, dataSize, pData);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdWriteAccelerationStructuresPropertiesNV(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    accelerationStructureCount,
+    const VkAccelerationStructureNV*            pAccelerationStructures,
+    VkQueryType                                 queryType,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    firstQuery) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdWriteAccelerationStructuresPropertiesNV fp = (PFN_vkCmdWriteAccelerationStructuresPropertiesNV)loader_resolve_lazy_device_command(table, "vkCmdWriteAccelerationStructuresPropertiesNV",
+        (PFN_vkVoidFunction *)&table->CmdWriteAccelerationStructuresPropertiesNV);
+    fp(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CompileDeferredNV(
+    VkDevice                                    device,
+    VkPipeline                                  pipeline,
+    uint32_t                                    shader) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCompileDeferredNV fp = (PFN_vkCompileDeferredNV)loader_resolve_lazy_device_command(table, "vkCompileDeferredNV",
+        (PFN_vkVoidFunction *)&table->CompileDeferredNV);
+    return fp(device, pipeline, shader);
+}
+
+// ---- VK_EXT_external_memory_host extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetMemoryHostPointerPropertiesEXT(
+    VkDevice                                    device,
+    VkExternalMemoryHandleTypeFlagBits          handleType,
+    const void*                                 pHostPointer,
+    VkMemoryHostPointerPropertiesEXT*           pMemoryHostPointerProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetMemoryHostPointerPropertiesEXT fp = (PFN_vkGetMemoryHostPointerPropertiesEXT)loader_resolve_lazy_device_command(table, "vkGetMemoryHostPointerPropertiesEXT",
+        (PFN_vkVoidFunction *)&table->GetMemoryHostPointerPropertiesEXT);
+    return fp(device, handleType, pHostPointer, pMemoryHostPointerProperties);
+}
+
+// ---- VK_AMD_buffer_marker extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdWriteBufferMarkerAMD(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineStageFlagBits                     pipelineStage,
+    VkBuffer                                    dstBuffer,
+    VkDeviceSize                                dstOffset,
+    uint32_t                                    marker) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdWriteBufferMarkerAMD fp = (PFN_vkCmdWriteBufferMarkerAMD)loader_resolve_lazy_device_command(table, "vkCmdWriteBufferMarkerAMD",
+        (PFN_vkVoidFunction *)&table->CmdWriteBufferMarkerAMD);
+    fp(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdWriteBufferMarker2AMD(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineStageFlags2                       stage,
+    VkBuffer                                    dstBuffer,
+    VkDeviceSize                                dstOffset,
+    uint32_t                                    marker) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdWriteBufferMarker2AMD fp = (PFN_vkCmdWriteBufferMarker2AMD)loader_resolve_lazy_device_command(table, "vkCmdWriteBufferMarker2AMD",
+        (PFN_vkVoidFunction *)&table->CmdWriteBufferMarker2AMD);
+    fp(commandBuffer, stage, dstBuffer, dstOffset, marker);
+}
+
+// ---- VK_EXT_calibrated_timestamps extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetCalibratedTimestampsEXT(
+    VkDevice                                    device,
+    uint32_t                                    timestampCount,
+    const VkCalibratedTimestampInfoKHR*         pTimestampInfos,
+    uint64_t*                                   pTimestamps,
+    uint64_t*                                   pMaxDeviation) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetCalibratedTimestampsEXT fp = (PFN_vkGetCalibratedTimestampsEXT)loader_resolve_lazy_device_command(table, "vkGetCalibratedTimestampsEXT",
+        (PFN_vkVoidFunction *)&table->GetCalibratedTimestampsEXT);
+    return fp(device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
+}
+
+// ---- VK_NV_mesh_shader extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawMeshTasksNV(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    taskCount,
+    uint32_t                                    firstTask) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawMeshTasksNV fp = (PFN_vkCmdDrawMeshTasksNV)loader_resolve_lazy_device_command(table, "vkCmdDrawMeshTasksNV",
+        (PFN_vkVoidFunction *)&table->CmdDrawMeshTasksNV);
+    fp(commandBuffer, taskCount, firstTask);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawMeshTasksIndirectNV(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    uint32_t                                    drawCount,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawMeshTasksIndirectNV fp = (PFN_vkCmdDrawMeshTasksIndirectNV)loader_resolve_lazy_device_command(table, "vkCmdDrawMeshTasksIndirectNV",
+        (PFN_vkVoidFunction *)&table->CmdDrawMeshTasksIndirectNV);
+    fp(commandBuffer, buffer, offset, drawCount, stride);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawMeshTasksIndirectCountNV(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkBuffer                                    countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawMeshTasksIndirectCountNV fp = (PFN_vkCmdDrawMeshTasksIndirectCountNV)loader_resolve_lazy_device_command(table, "vkCmdDrawMeshTasksIndirectCountNV",
+        (PFN_vkVoidFunction *)&table->CmdDrawMeshTasksIndirectCountNV);
+    fp(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
+
+// ---- VK_NV_scissor_exclusive extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetExclusiveScissorEnableNV(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstExclusiveScissor,
+    uint32_t                                    exclusiveScissorCount,
+    const VkBool32*                             pExclusiveScissorEnables) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetExclusiveScissorEnableNV fp = (PFN_vkCmdSetExclusiveScissorEnableNV)loader_resolve_lazy_device_command(table, "vkCmdSetExclusiveScissorEnableNV",
+        (PFN_vkVoidFunction *)&table->CmdSetExclusiveScissorEnableNV);
+    fp(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissorEnables);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetExclusiveScissorNV(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstExclusiveScissor,
+    uint32_t                                    exclusiveScissorCount,
+    const VkRect2D*                             pExclusiveScissors) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetExclusiveScissorNV fp = (PFN_vkCmdSetExclusiveScissorNV)loader_resolve_lazy_device_command(table, "vkCmdSetExclusiveScissorNV",
+        (PFN_vkVoidFunction *)&table->CmdSetExclusiveScissorNV);
+    fp(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
+}
+
+// ---- VK_NV_device_diagnostic_checkpoints extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetCheckpointNV(
+    VkCommandBuffer                             commandBuffer,
+    const void*                                 pCheckpointMarker) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetCheckpointNV fp = (PFN_vkCmdSetCheckpointNV)loader_resolve_lazy_device_command(table, "vkCmdSetCheckpointNV",
+        (PFN_vkVoidFunction *)&table->CmdSetCheckpointNV);
+    fp(commandBuffer, pCheckpointMarker);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetQueueCheckpointDataNV(
+    VkQueue                                     queue,
+    uint32_t*                                   pCheckpointDataCount,
+    VkCheckpointDataNV*                         pCheckpointData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(queue);
+    PFN_vkGetQueueCheckpointDataNV fp = (PFN_vkGetQueueCheckpointDataNV)loader_resolve_lazy_device_command(table, "vkGetQueueCheckpointDataNV",
+        (PFN_vkVoidFunction *)&table->GetQueueCheckpointDataNV);
+    fp(queue, pCheckpointDataCount, pCheckpointData);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetQueueCheckpointData2NV(
+    VkQueue                                     queue,
+    uint32_t*                                   pCheckpointDataCount,
+    VkCheckpointData2NV*                        pCheckpointData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(queue);
+    PFN_vkGetQueueCheckpointData2NV fp = (PFN_vkGetQueueCheckpointData2NV)loader_resolve_lazy_device_command(table, "vkGetQueueCheckpointData2NV",
+        (PFN_vkVoidFunction *)&table->GetQueueCheckpointData2NV);
+    fp(queue, pCheckpointDataCount, pCheckpointData);
+}
+
+// ---- VK_INTEL_performance_query extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_InitializePerformanceApiINTEL(
+    VkDevice                                    device,
+    const VkInitializePerformanceApiInfoINTEL*  pInitializeInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkInitializePerformanceApiINTEL fp = (PFN_vkInitializePerformanceApiINTEL)loader_resolve_lazy_device_command(table, "vkInitializePerformanceApiINTEL",
+        (PFN_vkVoidFunction *)&table->InitializePerformanceApiINTEL);
+    return fp(device, pInitializeInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_UninitializePerformanceApiINTEL(
+    VkDevice                                    device) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkUninitializePerformanceApiINTEL fp = (PFN_vkUninitializePerformanceApiINTEL)loader_resolve_lazy_device_command(table, "vkUninitializePerformanceApiINTEL",
+        (PFN_vkVoidFunction *)&table->UninitializePerformanceApiINTEL);
+    fp(device);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CmdSetPerformanceMarkerINTEL(
+    VkCommandBuffer                             commandBuffer,
+    const VkPerformanceMarkerInfoINTEL*         pMarkerInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetPerformanceMarkerINTEL fp = (PFN_vkCmdSetPerformanceMarkerINTEL)loader_resolve_lazy_device_command(table, "vkCmdSetPerformanceMarkerINTEL",
+        (PFN_vkVoidFunction *)&table->CmdSetPerformanceMarkerINTEL);
+    return fp(commandBuffer, pMarkerInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CmdSetPerformanceStreamMarkerINTEL(
+    VkCommandBuffer                             commandBuffer,
+    const VkPerformanceStreamMarkerInfoINTEL*   pMarkerInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetPerformanceStreamMarkerINTEL fp = (PFN_vkCmdSetPerformanceStreamMarkerINTEL)loader_resolve_lazy_device_command(table, "vkCmdSetPerformanceStreamMarkerINTEL",
+        (PFN_vkVoidFunction *)&table->CmdSetPerformanceStreamMarkerINTEL);
+    return fp(commandBuffer, pMarkerInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CmdSetPerformanceOverrideINTEL(
+    VkCommandBuffer                             commandBuffer,
+    const VkPerformanceOverrideInfoINTEL*       pOverrideInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetPerformanceOverrideINTEL fp = (PFN_vkCmdSetPerformanceOverrideINTEL)loader_resolve_lazy_device_command(table, "vkCmdSetPerformanceOverrideINTEL",
+        (PFN_vkVoidFunction *)&table->CmdSetPerformanceOverrideINTEL);
+    return fp(commandBuffer, pOverrideInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_AcquirePerformanceConfigurationINTEL(
+    VkDevice                                    device,
+    const VkPerformanceConfigurationAcquireInfoINTEL* pAcquireInfo,
+    VkPerformanceConfigurationINTEL*            pConfiguration) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkAcquirePerformanceConfigurationINTEL fp = (PFN_vkAcquirePerformanceConfigurationINTEL)loader_resolve_lazy_device_command(table, "vkAcquirePerformanceConfigurationINTEL",
+        (PFN_vkVoidFunction *)&table->AcquirePerformanceConfigurationINTEL);
+    return fp(device, pAcquireInfo, pConfiguration);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ReleasePerformanceConfigurationINTEL(
+    VkDevice                                    device,
+    VkPerformanceConfigurationINTEL             configuration) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkReleasePerformanceConfigurationINTEL fp = (PFN_vkReleasePerformanceConfigurationINTEL)loader_resolve_lazy_device_command(table, "vkReleasePerformanceConfigurationINTEL",
+        (PFN_vkVoidFunction *)&table->ReleasePerformanceConfigurationINTEL);
+    return fp(device, configuration);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_QueueSetPerformanceConfigurationINTEL(
+    VkQueue                                     queue,
+    VkPerformanceConfigurationINTEL             configuration) {
+    VkLayerDispatchTable *table = loader_get_dispatch(queue);
+    PFN_vkQueueSetPerformanceConfigurationINTEL fp = (PFN_vkQueueSetPerformanceConfigurationINTEL)loader_resolve_lazy_device_command(table, "vkQueueSetPerformanceConfigurationINTEL",
+        (PFN_vkVoidFunction *)&table->QueueSetPerformanceConfigurationINTEL);
+    return fp(queue, configuration);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetPerformanceParameterINTEL(
+    VkDevice                                    device,
+    VkPerformanceParameterTypeINTEL             parameter,
+    VkPerformanceValueINTEL*                    pValue) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetPerformanceParameterINTEL fp = (PFN_vkGetPerformanceParameterINTEL)loader_resolve_lazy_device_command(table, "vkGetPerformanceParameterINTEL",
+        (PFN_vkVoidFunction *)&table->GetPerformanceParameterINTEL);
+    return fp(device, parameter, pValue);
+}
+
+// ---- VK_AMD_display_native_hdr extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_SetLocalDimmingAMD(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapChain,
+    VkBool32                                    localDimmingEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkSetLocalDimmingAMD fp = (PFN_vkSetLocalDimmingAMD)loader_resolve_lazy_device_command(table, "vkSetLocalDimmingAMD",
+        (PFN_vkVoidFunction *)&table->SetLocalDimmingAMD);
+    fp(device, swapChain, localDimmingEnable);
+}
+
+// ---- VK_EXT_buffer_device_address extension commands
+static VKAPI_ATTR VkDeviceAddress VKAPI_CALL loader_lazy_GetBufferDeviceAddressEXT(
+    VkDevice                                    device,
+    const VkBufferDeviceAddressInfo*            pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetBufferDeviceAddressEXT fp = (PFN_vkGetBufferDeviceAddressEXT)loader_resolve_lazy_device_command(table, "vkGetBufferDeviceAddressEXT",
+        (PFN_vkVoidFunction *)&table->GetBufferDeviceAddressEXT);
+    return fp(device, pInfo);
+}
+
+// ---- VK_EXT_full_screen_exclusive extension commands
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_AcquireFullScreenExclusiveModeEXT(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkAcquireFullScreenExclusiveModeEXT fp = (PFN_vkAcquireFullScreenExclusiveModeEXT)loader_resolve_lazy_device_command(table, "vkAcquireFullScreenExclusiveModeEXT",
+        (PFN_vkVoidFunction *)&table->AcquireFullScreenExclusiveModeEXT);
+    return fp(device, swapchain);
+}
+#endif // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ReleaseFullScreenExclusiveModeEXT(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkReleaseFullScreenExclusiveModeEXT fp = (PFN_vkReleaseFullScreenExclusiveModeEXT)loader_resolve_lazy_device_command(table, "vkReleaseFullScreenExclusiveModeEXT",
+        (PFN_vkVoidFunction *)&table->ReleaseFullScreenExclusiveModeEXT);
+    return fp(device, swapchain);
+}
+#endif // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetDeviceGroupSurfacePresentModes2EXT(
+    VkDevice                                    device,
+    const VkPhysicalDeviceSurfaceInfo2KHR*      pSurfaceInfo,
+    VkDeviceGroupPresentModeFlagsKHR*           pModes) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceGroupSurfacePresentModes2EXT fp = (PFN_vkGetDeviceGroupSurfacePresentModes2EXT)loader_resolve_lazy_device_command(table, "vkGetDeviceGroupSurfacePresentModes2EXT",
+        (PFN_vkVoidFunction *)&table->GetDeviceGroupSurfacePresentModes2EXT);
+    return fp(device, pSurfaceInfo, pModes);
+}
+#endif // VK_USE_PLATFORM_WIN32_KHR
+
+// ---- VK_EXT_line_rasterization extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetLineStippleEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    lineStippleFactor,
+    uint16_t                                    lineStipplePattern) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetLineStippleEXT fp = (PFN_vkCmdSetLineStippleEXT)loader_resolve_lazy_device_command(table, "vkCmdSetLineStippleEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetLineStippleEXT);
+    fp(commandBuffer, lineStippleFactor, lineStipplePattern);
+}
+
+// ---- VK_EXT_host_query_reset extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_ResetQueryPoolEXT(
+    VkDevice                                    device,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    firstQuery,
+    uint32_t                                    queryCount) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkResetQueryPoolEXT fp = (PFN_vkResetQueryPoolEXT)loader_resolve_lazy_device_command(table, "vkResetQueryPoolEXT",
+        (PFN_vkVoidFunction *)&table->ResetQueryPoolEXT);
+    fp(device, queryPool, firstQuery, queryCount);
+}
+
+// ---- VK_EXT_extended_dynamic_state extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetCullModeEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkCullModeFlags                             cullMode) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetCullModeEXT fp = (PFN_vkCmdSetCullModeEXT)loader_resolve_lazy_device_command(table, "vkCmdSetCullModeEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetCullModeEXT);
+    fp(commandBuffer, cullMode);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetFrontFaceEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkFrontFace                                 frontFace) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetFrontFaceEXT fp = (PFN_vkCmdSetFrontFaceEXT)loader_resolve_lazy_device_command(table, "vkCmdSetFrontFaceEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetFrontFaceEXT);
+    fp(commandBuffer, frontFace);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetPrimitiveTopologyEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkPrimitiveTopology                         primitiveTopology) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetPrimitiveTopologyEXT fp = (PFN_vkCmdSetPrimitiveTopologyEXT)loader_resolve_lazy_device_command(table, "vkCmdSetPrimitiveTopologyEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetPrimitiveTopologyEXT);
+    fp(commandBuffer, primitiveTopology);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetViewportWithCountEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    viewportCount,
+    const VkViewport*                           pViewports) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetViewportWithCountEXT fp = (PFN_vkCmdSetViewportWithCountEXT)loader_resolve_lazy_device_command(table, "vkCmdSetViewportWithCountEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetViewportWithCountEXT);
+    fp(commandBuffer, viewportCount, pViewports);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetScissorWithCountEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    scissorCount,
+    const VkRect2D*                             pScissors) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetScissorWithCountEXT fp = (PFN_vkCmdSetScissorWithCountEXT)loader_resolve_lazy_device_command(table, "vkCmdSetScissorWithCountEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetScissorWithCountEXT);
+    fp(commandBuffer, scissorCount, pScissors);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindVertexBuffers2EXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstBinding,
+    uint32_t                                    bindingCount,
+    const VkBuffer*                             pBuffers,
+    const VkDeviceSize*                         pOffsets,
+    const VkDeviceSize*                         pSizes,
+    const VkDeviceSize*                         pStrides) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindVertexBuffers2EXT fp = (PFN_vkCmdBindVertexBuffers2EXT)loader_resolve_lazy_device_command(table, "vkCmdBindVertexBuffers2EXT",
+        (PFN_vkVoidFunction *)&table->CmdBindVertexBuffers2EXT);
+    fp(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthTestEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    depthTestEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthTestEnableEXT fp = (PFN_vkCmdSetDepthTestEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetDepthTestEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthTestEnableEXT);
+    fp(commandBuffer, depthTestEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthWriteEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    depthWriteEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthWriteEnableEXT fp = (PFN_vkCmdSetDepthWriteEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetDepthWriteEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthWriteEnableEXT);
+    fp(commandBuffer, depthWriteEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthCompareOpEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkCompareOp                                 depthCompareOp) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthCompareOpEXT fp = (PFN_vkCmdSetDepthCompareOpEXT)loader_resolve_lazy_device_command(table, "vkCmdSetDepthCompareOpEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthCompareOpEXT);
+    fp(commandBuffer, depthCompareOp);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthBoundsTestEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    depthBoundsTestEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthBoundsTestEnableEXT fp = (PFN_vkCmdSetDepthBoundsTestEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetDepthBoundsTestEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthBoundsTestEnableEXT);
+    fp(commandBuffer, depthBoundsTestEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetStencilTestEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    stencilTestEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetStencilTestEnableEXT fp = (PFN_vkCmdSetStencilTestEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetStencilTestEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetStencilTestEnableEXT);
+    fp(commandBuffer, stencilTestEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetStencilOpEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkStencilFaceFlags                          faceMask,
+    VkStencilOp                                 failOp,
+    VkStencilOp                                 passOp,
+    VkStencilOp                                 depthFailOp,
+    VkCompareOp                                 compareOp) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetStencilOpEXT fp = (PFN_vkCmdSetStencilOpEXT)loader_resolve_lazy_device_command(table, "vkCmdSetStencilOpEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetStencilOpEXT);
+    fp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+}
+
+// ---- VK_EXT_host_image_copy extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CopyMemoryToImageEXT(
+    VkDevice                                    device,
+    const VkCopyMemoryToImageInfo*              pCopyMemoryToImageInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCopyMemoryToImageEXT fp = (PFN_vkCopyMemoryToImageEXT)loader_resolve_lazy_device_command(table, "vkCopyMemoryToImageEXT",
+        (PFN_vkVoidFunction *)&table->CopyMemoryToImageEXT);
+    return fp(device, pCopyMemoryToImageInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CopyImageToMemoryEXT(
+    VkDevice                                    device,
+    const VkCopyImageToMemoryInfo*              pCopyImageToMemoryInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCopyImageToMemoryEXT fp = (PFN_vkCopyImageToMemoryEXT)loader_resolve_lazy_device_command(table, "vkCopyImageToMemoryEXT",
+        (PFN_vkVoidFunction *)&table->CopyImageToMemoryEXT);
+    return fp(device, pCopyImageToMemoryInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CopyImageToImageEXT(
+    VkDevice                                    device,
+    const VkCopyImageToImageInfo*               pCopyImageToImageInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCopyImageToImageEXT fp = (PFN_vkCopyImageToImageEXT)loader_resolve_lazy_device_command(table, "vkCopyImageToImageEXT",
+        (PFN_vkVoidFunction *)&table->CopyImageToImageEXT);
+    return fp(device, pCopyImageToImageInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_TransitionImageLayoutEXT(
+    VkDevice                                    device,
+    uint32_t                                    transitionCount,
+    const VkHostImageLayoutTransitionInfo*      pTransitions) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkTransitionImageLayoutEXT fp = (PFN_vkTransitionImageLayoutEXT)loader_resolve_lazy_device_command(table, "vkTransitionImageLayoutEXT",
+        (PFN_vkVoidFunction *)&table->TransitionImageLayoutEXT);
+    return fp(device, transitionCount, pTransitions);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetImageSubresourceLayout2EXT(
+    VkDevice                                    device,
+    VkImage                                     image,
+    const VkImageSubresource2*                  pSubresource,
+    VkSubresourceLayout2*                       pLayout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageSubresourceLayout2EXT fp = (PFN_vkGetImageSubresourceLayout2EXT)loader_resolve_lazy_device_command(table, "vkGetImageSubresourceLayout2EXT",
+        (PFN_vkVoidFunction *)&table->GetImageSubresourceLayout2EXT);
+    fp(device, image, pSubresource, pLayout);
+}
+
+// ---- VK_EXT_swapchain_maintenance1 extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ReleaseSwapchainImagesEXT(
+    VkDevice                                    device,
+    const VkReleaseSwapchainImagesInfoEXT*      pReleaseInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkReleaseSwapchainImagesEXT fp = (PFN_vkReleaseSwapchainImagesEXT)loader_resolve_lazy_device_command(table, "vkReleaseSwapchainImagesEXT",
+        (PFN_vkVoidFunction *)&table->ReleaseSwapchainImagesEXT);
+    return fp(device, pReleaseInfo);
+}
+
+// ---- VK_NV_device_generated_commands extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetGeneratedCommandsMemoryRequirementsNV(
+    VkDevice                                    device,
+    const VkGeneratedCommandsMemoryRequirementsInfoNV* pInfo,
+    VkMemoryRequirements2*                      pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetGeneratedCommandsMemoryRequirementsNV fp = (PFN_vkGetGeneratedCommandsMemoryRequirementsNV)loader_resolve_lazy_device_command(table, "vkGetGeneratedCommandsMemoryRequirementsNV",
+        (PFN_vkVoidFunction *)&table->GetGeneratedCommandsMemoryRequirementsNV);
+    fp(device, pInfo, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPreprocessGeneratedCommandsNV(
+    VkCommandBuffer                             commandBuffer,
+    const VkGeneratedCommandsInfoNV*            pGeneratedCommandsInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPreprocessGeneratedCommandsNV fp = (PFN_vkCmdPreprocessGeneratedCommandsNV)loader_resolve_lazy_device_command(table, "vkCmdPreprocessGeneratedCommandsNV",
+        (PFN_vkVoidFunction *)&table->CmdPreprocessGeneratedCommandsNV);
+    fp(commandBuffer, pGeneratedCommandsInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdExecuteGeneratedCommandsNV(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    isPreprocessed,
+    const VkGeneratedCommandsInfoNV*            pGeneratedCommandsInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdExecuteGeneratedCommandsNV fp = (PFN_vkCmdExecuteGeneratedCommandsNV)loader_resolve_lazy_device_command(table, "vkCmdExecuteGeneratedCommandsNV",
+        (PFN_vkVoidFunction *)&table->CmdExecuteGeneratedCommandsNV);
+    fp(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindPipelineShaderGroupNV(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    VkPipeline                                  pipeline,
+    uint32_t                                    groupIndex) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindPipelineShaderGroupNV fp = (PFN_vkCmdBindPipelineShaderGroupNV)loader_resolve_lazy_device_command(table, "vkCmdBindPipelineShaderGroupNV",
+        (PFN_vkVoidFunction *)&table->CmdBindPipelineShaderGroupNV);
+    fp(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateIndirectCommandsLayoutNV(
+    VkDevice                                    device,
+    const VkIndirectCommandsLayoutCreateInfoNV* pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkIndirectCommandsLayoutNV*                 pIndirectCommandsLayout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateIndirectCommandsLayoutNV fp = (PFN_vkCreateIndirectCommandsLayoutNV)loader_resolve_lazy_device_command(table, "vkCreateIndirectCommandsLayoutNV",
+        (PFN_vkVoidFunction *)&table->CreateIndirectCommandsLayoutNV);
+    return fp(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyIndirectCommandsLayoutNV(
+    VkDevice                                    device,
+    VkIndirectCommandsLayoutNV                  indirectCommandsLayout,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyIndirectCommandsLayoutNV fp = (PFN_vkDestroyIndirectCommandsLayoutNV)loader_resolve_lazy_device_command(table, "vkDestroyIndirectCommandsLayoutNV",
+        (PFN_vkVoidFunction *)&table->DestroyIndirectCommandsLayoutNV);
+    fp(device, indirectCommandsLayout, pAllocator);
+}
+
+// ---- VK_EXT_depth_bias_control extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthBias2EXT(
+    VkCommandBuffer                             commandBuffer,
+    const VkDepthBiasInfoEXT*                   pDepthBiasInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthBias2EXT fp = (PFN_vkCmdSetDepthBias2EXT)loader_resolve_lazy_device_command(table, "vkCmdSetDepthBias2EXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthBias2EXT);
+    fp(commandBuffer, pDepthBiasInfo);
+}
+
+// ---- VK_EXT_private_data extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreatePrivateDataSlotEXT(
+    VkDevice                                    device,
+    const VkPrivateDataSlotCreateInfo*          pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkPrivateDataSlot*                          pPrivateDataSlot) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreatePrivateDataSlotEXT fp = (PFN_vkCreatePrivateDataSlotEXT)loader_resolve_lazy_device_command(table, "vkCreatePrivateDataSlotEXT",
+        (PFN_vkVoidFunction *)&table->CreatePrivateDataSlotEXT);
+    return fp(device, pCreateInfo, pAllocator, pPrivateDataSlot);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyPrivateDataSlotEXT(
+    VkDevice                                    device,
+    VkPrivateDataSlot                           privateDataSlot,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyPrivateDataSlotEXT fp = (PFN_vkDestroyPrivateDataSlotEXT)loader_resolve_lazy_device_command(table, "vkDestroyPrivateDataSlotEXT",
+        (PFN_vkVoidFunction *)&table->DestroyPrivateDataSlotEXT);
+    fp(device, privateDataSlot, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_SetPrivateDataEXT(
+    VkDevice                                    device,
+    VkObjectType                                objectType,
+    uint64_t                                    objectHandle,
+    VkPrivateDataSlot                           privateDataSlot,
+    uint64_t                                    data) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkSetPrivateDataEXT fp = (PFN_vkSetPrivateDataEXT)loader_resolve_lazy_device_command(table, "vkSetPrivateDataEXT",
+        (PFN_vkVoidFunction *)&table->SetPrivateDataEXT);
+    return fp(device, objectType, objectHandle, privateDataSlot, data);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetPrivateDataEXT(
+    VkDevice                                    device,
+    VkObjectType                                objectType,
+    uint64_t                                    objectHandle,
+    VkPrivateDataSlot                           privateDataSlot,
+    uint64_t*                                   pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetPrivateDataEXT fp = (PFN_vkGetPrivateDataEXT)loader_resolve_lazy_device_command(table, "vkGetPrivateDataEXT",
+        (PFN_vkVoidFunction *)&table->GetPrivateDataEXT);
+    fp(device, objectType, objectHandle, privateDataSlot, pData);
+}
+
+// ---- VK_NV_cuda_kernel_launch extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateCudaModuleNV(
+    VkDevice                                    device,
+    const VkCudaModuleCreateInfoNV*             pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkCudaModuleNV*                             pModule) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateCudaModuleNV fp = (PFN_vkCreateCudaModuleNV)loader_resolve_lazy_device_command(table, "vkCreateCudaModuleNV",
+        (PFN_vkVoidFunction *)&table->CreateCudaModuleNV);
+    return fp(device, pCreateInfo, pAllocator, pModule);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetCudaModuleCacheNV(
+    VkDevice                                    device,
+    VkCudaModuleNV                              module,
+    size_t*                                     pCacheSize,
+    void*                                       pCacheData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetCudaModuleCacheNV fp = (PFN_vkGetCudaModuleCacheNV)loader_resolve_lazy_device_command(table, "vkGetCudaModuleCacheNV",
+        (PFN_vkVoidFunction *)&table->GetCudaModuleCacheNV);
+    return fp(device, module, pCacheSize, pCacheData);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateCudaFunctionNV(
+    VkDevice                                    device,
+    const VkCudaFunctionCreateInfoNV*           pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkCudaFunctionNV*                           pFunction) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateCudaFunctionNV fp = (PFN_vkCreateCudaFunctionNV)loader_resolve_lazy_device_command(table, "vkCreateCudaFunctionNV",
+        (PFN_vkVoidFunction *)&table->CreateCudaFunctionNV);
+    return fp(device, pCreateInfo, pAllocator, pFunction);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyCudaModuleNV(
+    VkDevice                                    device,
+    VkCudaModuleNV                              module,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyCudaModuleNV fp = (PFN_vkDestroyCudaModuleNV)loader_resolve_lazy_device_command(table, "vkDestroyCudaModuleNV",
+        (PFN_vkVoidFunction *)&table->DestroyCudaModuleNV);
+    fp(device, module, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyCudaFunctionNV(
+    VkDevice                                    device,
+    VkCudaFunctionNV                            function,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyCudaFunctionNV fp = (PFN_vkDestroyCudaFunctionNV)loader_resolve_lazy_device_command(table, "vkDestroyCudaFunctionNV",
+        (PFN_vkVoidFunction *)&table->DestroyCudaFunctionNV);
+    fp(device, function, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCudaLaunchKernelNV(
+    VkCommandBuffer                             commandBuffer,
+    const VkCudaLaunchInfoNV*                   pLaunchInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCudaLaunchKernelNV fp = (PFN_vkCmdCudaLaunchKernelNV)loader_resolve_lazy_device_command(table, "vkCmdCudaLaunchKernelNV",
+        (PFN_vkVoidFunction *)&table->CmdCudaLaunchKernelNV);
+    fp(commandBuffer, pLaunchInfo);
+}
+
+// ---- VK_EXT_metal_objects extension commands
+#if defined(VK_USE_PLATFORM_METAL_EXT)
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_ExportMetalObjectsEXT(
+    VkDevice                                    device,
+    VkExportMetalObjectsInfoEXT*                pMetalObjectsInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkExportMetalObjectsEXT fp = (PFN_vkExportMetalObjectsEXT)loader_resolve_lazy_device_command(table, "vkExportMetalObjectsEXT",
+        (PFN_vkVoidFunction *)&table->ExportMetalObjectsEXT);
+    fp(device, pMetalObjectsInfo);
+}
+#endif // VK_USE_PLATFORM_METAL_EXT
+
+// ---- VK_EXT_descriptor_buffer extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDescriptorSetLayoutSizeEXT(
+    VkDevice                                    device,
+    VkDescriptorSetLayout                       layout,
+    VkDeviceSize*                               pLayoutSizeInBytes) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDescriptorSetLayoutSizeEXT fp = (PFN_vkGetDescriptorSetLayoutSizeEXT)loader_resolve_lazy_device_command(table, "vkGetDescriptorSetLayoutSizeEXT",
+        (PFN_vkVoidFunction *)&table->GetDescriptorSetLayoutSizeEXT);
+    fp(device, layout, pLayoutSizeInBytes);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDescriptorSetLayoutBindingOffsetEXT(
+    VkDevice                                    device,
+    VkDescriptorSetLayout                       layout,
+    uint32_t                                    binding,
+    VkDeviceSize*                               pOffset) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDescriptorSetLayoutBindingOffsetEXT fp = (PFN_vkGetDescriptorSetLayoutBindingOffsetEXT)loader_resolve_lazy_device_command(table, "vkGetDescriptorSetLayoutBindingOffsetEXT",
+        (PFN_vkVoidFunction *)&table->GetDescriptorSetLayoutBindingOffsetEXT);
+    fp(device, layout, binding, pOffset);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDescriptorEXT(
+    VkDevice                                    device,
+    const VkDescriptorGetInfoEXT*               pDescriptorInfo,
+    size_t                                      dataSize,
+    void*                                       pDescriptor) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDescriptorEXT fp = (PFN_vkGetDescriptorEXT)loader_resolve_lazy_device_command(table, "vkGetDescriptorEXT",
+        (PFN_vkVoidFunction *)&table->GetDescriptorEXT);
+    fp(device, pDescriptorInfo, dataSize, pDescriptor);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindDescriptorBuffersEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    bufferCount,
+    const VkDescriptorBufferBindingInfoEXT*     pBindingInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindDescriptorBuffersEXT fp = (PFN_vkCmdBindDescriptorBuffersEXT)loader_resolve_lazy_device_command(table, "vkCmdBindDescriptorBuffersEXT",
+        (PFN_vkVoidFunction *)&table->CmdBindDescriptorBuffersEXT);
+    fp(commandBuffer, bufferCount, pBindingInfos);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDescriptorBufferOffsetsEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    VkPipelineLayout                            layout,
+    uint32_t                                    firstSet,
+    uint32_t                                    setCount,
+    const uint32_t*                             pBufferIndices,
+    const VkDeviceSize*                         pOffsets) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDescriptorBufferOffsetsEXT fp = (PFN_vkCmdSetDescriptorBufferOffsetsEXT)loader_resolve_lazy_device_command(table, "vkCmdSetDescriptorBufferOffsetsEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDescriptorBufferOffsetsEXT);
+    fp(commandBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindDescriptorBufferEmbeddedSamplersEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    VkPipelineLayout                            layout,
+    uint32_t                                    set) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT fp = (PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT)loader_resolve_lazy_device_command(table, "vkCmdBindDescriptorBufferEmbeddedSamplersEXT",
+        (PFN_vkVoidFunction *)&table->CmdBindDescriptorBufferEmbeddedSamplersEXT);
+    fp(commandBuffer, pipelineBindPoint, layout, set);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetBufferOpaqueCaptureDescriptorDataEXT(
+    VkDevice                                    device,
+    const VkBufferCaptureDescriptorDataInfoEXT* pInfo,
+    void*                                       pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetBufferOpaqueCaptureDescriptorDataEXT fp = (PFN_vkGetBufferOpaqueCaptureDescriptorDataEXT)loader_resolve_lazy_device_command(table, "vkGetBufferOpaqueCaptureDescriptorDataEXT",
+        (PFN_vkVoidFunction *)&table->GetBufferOpaqueCaptureDescriptorDataEXT);
+    return fp(device, pInfo, pData);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetImageOpaqueCaptureDescriptorDataEXT(
+    VkDevice                                    device,
+    const VkImageCaptureDescriptorDataInfoEXT*  pInfo,
+    void*                                       pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageOpaqueCaptureDescriptorDataEXT fp = (PFN_vkGetImageOpaqueCaptureDescriptorDataEXT)loader_resolve_lazy_device_command(table, "vkGetImageOpaqueCaptureDescriptorDataEXT",
+        (PFN_vkVoidFunction *)&table->GetImageOpaqueCaptureDescriptorDataEXT);
+    return fp(device, pInfo, pData);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetImageViewOpaqueCaptureDescriptorDataEXT(
+    VkDevice                                    device,
+    const VkImageViewCaptureDescriptorDataInfoEXT* pInfo,
+    void*                                       pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetImageViewOpaqueCaptureDescriptorDataEXT fp = (PFN_vkGetImageViewOpaqueCaptureDescriptorDataEXT)loader_resolve_lazy_device_command(table, "vkGetImageViewOpaqueCaptureDescriptorDataEXT",
+        (PFN_vkVoidFunction *)&table->GetImageViewOpaqueCaptureDescriptorDataEXT);
+    return fp(device, pInfo, pData);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetSamplerOpaqueCaptureDescriptorDataEXT(
+    VkDevice                                    device,
+    const VkSamplerCaptureDescriptorDataInfoEXT* pInfo,
+    void*                                       pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetSamplerOpaqueCaptureDescriptorDataEXT fp = (PFN_vkGetSamplerOpaqueCaptureDescriptorDataEXT)loader_resolve_lazy_device_command(table, "vkGetSamplerOpaqueCaptureDescriptorDataEXT",
+        (PFN_vkVoidFunction *)&table->GetSamplerOpaqueCaptureDescriptorDataEXT);
+    return fp(device, pInfo, pData);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetAccelerationStructureOpaqueCaptureDescriptorDataEXT(
+    VkDevice                                    device,
+    const VkAccelerationStructureCaptureDescriptorDataInfoEXT* pInfo,
+    void*                                       pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT fp = (PFN_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT)loader_resolve_lazy_device_command(table, "vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT",
+        (PFN_vkVoidFunction *)&table->GetAccelerationStructureOpaqueCaptureDescriptorDataEXT);
+    return fp(device, pInfo, pData);
+}
+
+// ---- VK_NV_fragment_shading_rate_enums extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetFragmentShadingRateEnumNV(
+    VkCommandBuffer                             commandBuffer,
+    VkFragmentShadingRateNV                     shadingRate,
+    const VkFragmentShadingRateCombinerOpKHR    combinerOps[2]) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetFragmentShadingRateEnumNV fp = (PFN_vkCmdSetFragmentShadingRateEnumNV)loader_resolve_lazy_device_command(table, "vkCmdSetFragmentShadingRateEnumNV",
+        (PFN_vkVoidFunction *)&table->CmdSetFragmentShadingRateEnumNV);
+    fp(commandBuffer, shadingRate, combinerOps);
+}
+
+// ---- VK_EXT_device_fault extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetDeviceFaultInfoEXT(
+    VkDevice                                    device,
+    VkDeviceFaultCountsEXT*                     pFaultCounts,
+    VkDeviceFaultInfoEXT*                       pFaultInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceFaultInfoEXT fp = (PFN_vkGetDeviceFaultInfoEXT)loader_resolve_lazy_device_command(table, "vkGetDeviceFaultInfoEXT",
+        (PFN_vkVoidFunction *)&table->GetDeviceFaultInfoEXT);
+    return fp(device, pFaultCounts, pFaultInfo);
+}
+
+// ---- VK_EXT_vertex_input_dynamic_state extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetVertexInputEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    vertexBindingDescriptionCount,
+    const VkVertexInputBindingDescription2EXT*  pVertexBindingDescriptions,
+    uint32_t                                    vertexAttributeDescriptionCount,
+    const VkVertexInputAttributeDescription2EXT* pVertexAttributeDescriptions) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetVertexInputEXT fp = (PFN_vkCmdSetVertexInputEXT)loader_resolve_lazy_device_command(table, "vkCmdSetVertexInputEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetVertexInputEXT);
+    fp(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
+}
+
+// ---- VK_FUCHSIA_external_memory extension commands
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetMemoryZirconHandleFUCHSIA(
+    VkDevice                                    device,
+    const VkMemoryGetZirconHandleInfoFUCHSIA*   pGetZirconHandleInfo,
+    zx_handle_t*                                pZirconHandle) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetMemoryZirconHandleFUCHSIA fp = (PFN_vkGetMemoryZirconHandleFUCHSIA)loader_resolve_lazy_device_command(table, "vkGetMemoryZirconHandleFUCHSIA",
+        (PFN_vkVoidFunction *)&table->GetMemoryZirconHandleFUCHSIA);
+    return fp(device, pGetZirconHandleInfo, pZirconHandle);
+}
+#endif // VK_USE_PLATFORM_FUCHSIA
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetMemoryZirconHandlePropertiesFUCHSIA(
+    VkDevice                                    device,
+    VkExternalMemoryHandleTypeFlagBits          handleType,
+    zx_handle_t                                 zirconHandle,
+    VkMemoryZirconHandlePropertiesFUCHSIA*      pMemoryZirconHandleProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA fp = (PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA)loader_resolve_lazy_device_command(table, "vkGetMemoryZirconHandlePropertiesFUCHSIA",
+        (PFN_vkVoidFunction *)&table->GetMemoryZirconHandlePropertiesFUCHSIA);
+    return fp(device, handleType, zirconHandle, pMemoryZirconHandleProperties);
+}
+#endif // VK_USE_PLATFORM_FUCHSIA
+
+// ---- VK_FUCHSIA_external_semaphore extension commands
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ImportSemaphoreZirconHandleFUCHSIA(
+    VkDevice                                    device,
+    const VkImportSemaphoreZirconHandleInfoFUCHSIA* pImportSemaphoreZirconHandleInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkImportSemaphoreZirconHandleFUCHSIA fp = (PFN_vkImportSemaphoreZirconHandleFUCHSIA)loader_resolve_lazy_device_command(table, "vkImportSemaphoreZirconHandleFUCHSIA",
+        (PFN_vkVoidFunction *)&table->ImportSemaphoreZirconHandleFUCHSIA);
+    return fp(device, pImportSemaphoreZirconHandleInfo);
+}
+#endif // VK_USE_PLATFORM_FUCHSIA
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetSemaphoreZirconHandleFUCHSIA(
+    VkDevice                                    device,
+    const VkSemaphoreGetZirconHandleInfoFUCHSIA* pGetZirconHandleInfo,
+    zx_handle_t*                                pZirconHandle) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetSemaphoreZirconHandleFUCHSIA fp = (PFN_vkGetSemaphoreZirconHandleFUCHSIA)loader_resolve_lazy_device_command(table, "vkGetSemaphoreZirconHandleFUCHSIA",
+        (PFN_vkVoidFunction *)&table->GetSemaphoreZirconHandleFUCHSIA);
+    return fp(device, pGetZirconHandleInfo, pZirconHandle);
+}
+#endif // VK_USE_PLATFORM_FUCHSIA
+
+// ---- VK_FUCHSIA_buffer_collection extension commands
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateBufferCollectionFUCHSIA(
+    VkDevice                                    device,
+    const VkBufferCollectionCreateInfoFUCHSIA*  pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkBufferCollectionFUCHSIA*                  pCollection) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateBufferCollectionFUCHSIA fp = (PFN_vkCreateBufferCollectionFUCHSIA)loader_resolve_lazy_device_command(table, "vkCreateBufferCollectionFUCHSIA",
+        (PFN_vkVoidFunction *)&table->CreateBufferCollectionFUCHSIA);
+    return fp(device, pCreateInfo, pAllocator, pCollection);
+}
+#endif // VK_USE_PLATFORM_FUCHSIA
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_SetBufferCollectionImageConstraintsFUCHSIA(
+    VkDevice                                    device,
+    VkBufferCollectionFUCHSIA                   collection,
+    const VkImageConstraintsInfoFUCHSIA*        pImageConstraintsInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkSetBufferCollectionImageConstraintsFUCHSIA fp = (PFN_vkSetBufferCollectionImageConstraintsFUCHSIA)loader_resolve_lazy_device_command(table, "vkSetBufferCollectionImageConstraintsFUCHSIA",
+        (PFN_vkVoidFunction *)&table->SetBufferCollectionImageConstraintsFUCHSIA);
+    return fp(device, collection, pImageConstraintsInfo);
+}
+#endif // VK_USE_PLATFORM_FUCHSIA
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_SetBufferCollectionBufferConstraintsFUCHSIA(
+    VkDevice                                    device,
+    VkBufferCollectionFUCHSIA                   collection,
+    const VkBufferConstraintsInfoFUCHSIA*       pBufferConstraintsInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA fp = (PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA)loader_resolve_lazy_device_command(table, "vkSetBufferCollectionBufferConstraintsFUCHSIA",
+        (PFN_vkVoidFunction *)&table->SetBufferCollectionBufferConstraintsFUCHSIA);
+    return fp(device, collection, pBufferConstraintsInfo);
+}
+#endif // VK_USE_PLATFORM_FUCHSIA
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyBufferCollectionFUCHSIA(
+    VkDevice                                    device,
+    VkBufferCollectionFUCHSIA                   collection,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyBufferCollectionFUCHSIA fp = (PFN_vkDestroyBufferCollectionFUCHSIA)loader_resolve_lazy_device_command(table, "vkDestroyBufferCollectionFUCHSIA",
+        (PFN_vkVoidFunction *)&table->DestroyBufferCollectionFUCHSIA);
+    fp(device, collection, pAllocator);
+}
+#endif // VK_USE_PLATFORM_FUCHSIA
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetBufferCollectionPropertiesFUCHSIA(
+    VkDevice                                    device,
+    VkBufferCollectionFUCHSIA                   collection,
+    VkBufferCollectionPropertiesFUCHSIA*        pProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetBufferCollectionPropertiesFUCHSIA fp = (PFN_vkGetBufferCollectionPropertiesFUCHSIA)loader_resolve_lazy_device_command(table, "vkGetBufferCollectionPropertiesFUCHSIA",
+        (PFN_vkVoidFunction *)&table->GetBufferCollectionPropertiesFUCHSIA);
+    return fp(device, collection, pProperties);
+}
+#endif // VK_USE_PLATFORM_FUCHSIA
+
+// ---- VK_HUAWEI_subpass_shading extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(
+    VkDevice                                    device,
+    VkRenderPass                                renderpass,
+    VkExtent2D*                                 pMaxWorkgroupSize) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI fp = (PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI)loader_resolve_lazy_device_command(table, "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI",
+        (PFN_vkVoidFunction *)&table->GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI);
+    return fp(device, renderpass, pMaxWorkgroupSize);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSubpassShadingHUAWEI(
+    VkCommandBuffer                             commandBuffer) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSubpassShadingHUAWEI fp = (PFN_vkCmdSubpassShadingHUAWEI)loader_resolve_lazy_device_command(table, "vkCmdSubpassShadingHUAWEI",
+        (PFN_vkVoidFunction *)&table->CmdSubpassShadingHUAWEI);
+    fp(commandBuffer);
+}
+
+// ---- VK_HUAWEI_invocation_mask extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindInvocationMaskHUAWEI(
+    VkCommandBuffer                             commandBuffer,
+    VkImageView                                 imageView,
+    VkImageLayout                               imageLayout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindInvocationMaskHUAWEI fp = (PFN_vkCmdBindInvocationMaskHUAWEI)loader_resolve_lazy_device_command(table, "vkCmdBindInvocationMaskHUAWEI",
+        (PFN_vkVoidFunction *)&table->CmdBindInvocationMaskHUAWEI);
+    fp(commandBuffer, imageView, imageLayout);
+}
+
+// ---- VK_NV_external_memory_rdma extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetMemoryRemoteAddressNV(
+    VkDevice                                    device,
+    const VkMemoryGetRemoteAddressInfoNV*       pMemoryGetRemoteAddressInfo,
+    VkRemoteAddressNV*                          pAddress) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetMemoryRemoteAddressNV fp = (PFN_vkGetMemoryRemoteAddressNV)loader_resolve_lazy_device_command(table, "vkGetMemoryRemoteAddressNV",
+        (PFN_vkVoidFunction *)&table->GetMemoryRemoteAddressNV);
+    return fp(device, pMemoryGetRemoteAddressInfo, pAddress);
+}
+
+// ---- VK_EXT_pipeline_properties extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetPipelinePropertiesEXT(
+    VkDevice                                    device,
+    const VkPipelineInfoEXT*                    pPipelineInfo,
+    VkBaseOutStructure*                         pPipelineProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetPipelinePropertiesEXT fp = (PFN_vkGetPipelinePropertiesEXT)loader_resolve_lazy_device_command(table, "vkGetPipelinePropertiesEXT",
+        (PFN_vkVoidFunction *)&table->GetPipelinePropertiesEXT);
+    return fp(device, pPipelineInfo, pPipelineProperties);
+}
+
+// ---- VK_EXT_extended_dynamic_state2 extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetPatchControlPointsEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    patchControlPoints) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetPatchControlPointsEXT fp = (PFN_vkCmdSetPatchControlPointsEXT)loader_resolve_lazy_device_command(table, "vkCmdSetPatchControlPointsEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetPatchControlPointsEXT);
+    fp(commandBuffer, patchControlPoints);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetRasterizerDiscardEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    rasterizerDiscardEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetRasterizerDiscardEnableEXT fp = (PFN_vkCmdSetRasterizerDiscardEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetRasterizerDiscardEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetRasterizerDiscardEnableEXT);
+    fp(commandBuffer, rasterizerDiscardEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthBiasEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    depthBiasEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthBiasEnableEXT fp = (PFN_vkCmdSetDepthBiasEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetDepthBiasEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthBiasEnableEXT);
+    fp(commandBuffer, depthBiasEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetLogicOpEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkLogicOp                                   logicOp) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetLogicOpEXT fp = (PFN_vkCmdSetLogicOpEXT)loader_resolve_lazy_device_command(table, "vkCmdSetLogicOpEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetLogicOpEXT);
+    fp(commandBuffer, logicOp);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetPrimitiveRestartEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    primitiveRestartEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetPrimitiveRestartEnableEXT fp = (PFN_vkCmdSetPrimitiveRestartEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetPrimitiveRestartEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetPrimitiveRestartEnableEXT);
+    fp(commandBuffer, primitiveRestartEnable);
+}
+
+// ---- VK_EXT_color_write_enable extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetColorWriteEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    attachmentCount,
+    const VkBool32*                             pColorWriteEnables) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetColorWriteEnableEXT fp = (PFN_vkCmdSetColorWriteEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetColorWriteEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetColorWriteEnableEXT);
+    fp(commandBuffer, attachmentCount, pColorWriteEnables);
+}
+
+// ---- VK_EXT_multi_draw extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawMultiEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    drawCount,
+    const VkMultiDrawInfoEXT*                   pVertexInfo,
+    uint32_t                                    instanceCount,
+    uint32_t                                    firstInstance,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawMultiEXT fp = (PFN_vkCmdDrawMultiEXT)loader_resolve_lazy_device_command(table, "vkCmdDrawMultiEXT",
+        (PFN_vkVoidFunction *)&table->CmdDrawMultiEXT);
+    fp(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawMultiIndexedEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    drawCount,
+    const VkMultiDrawIndexedInfoEXT*            pIndexInfo,
+    uint32_t                                    instanceCount,
+    uint32_t                                    firstInstance,
+    uint32_t                                    stride,
+    const int32_t*                              pVertexOffset) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawMultiIndexedEXT fp = (PFN_vkCmdDrawMultiIndexedEXT)loader_resolve_lazy_device_command(table, "vkCmdDrawMultiIndexedEXT",
+        (PFN_vkVoidFunction *)&table->CmdDrawMultiIndexedEXT);
+    fp(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
+}
+
+// ---- VK_EXT_opacity_micromap extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateMicromapEXT(
+    VkDevice                                    device,
+    const VkMicromapCreateInfoEXT*              pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkMicromapEXT*                              pMicromap) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateMicromapEXT fp = (PFN_vkCreateMicromapEXT)loader_resolve_lazy_device_command(table, "vkCreateMicromapEXT",
+        (PFN_vkVoidFunction *)&table->CreateMicromapEXT);
+    return fp(device, pCreateInfo, pAllocator, pMicromap);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyMicromapEXT(
+    VkDevice                                    device,
+    VkMicromapEXT                               micromap,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyMicromapEXT fp = (PFN_vkDestroyMicromapEXT)loader_resolve_lazy_device_command(table, "vkDestroyMicromapEXT",
+        (PFN_vkVoidFunction *)&table->DestroyMicromapEXT);
+    fp(device, micromap, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBuildMicromapsEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    infoCount,
+    const VkMicromapBuildInfoEXT*               pInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBuildMicromapsEXT fp = (PFN_vkCmdBuildMicromapsEXT)loader_resolve_lazy_device_command(table, "vkCmdBuildMicromapsEXT",
+        (PFN_vkVoidFunction *)&table->CmdBuildMicromapsEXT);
+    fp(commandBuffer, infoCount, pInfos);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_BuildMicromapsEXT(
+    VkDevice                                    device,
+    VkDeferredOperationKHR                      deferredOperation,
+    uint32_t                                    infoCount,
+    const VkMicromapBuildInfoEXT*               pInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkBuildMicromapsEXT fp = (PFN_vkBuildMicromapsEXT)loader_resolve_lazy_device_command(table, "vkBuildMicromapsEXT",
+        (PFN_vkVoidFunction *)&table->BuildMicromapsEXT);
+    return fp(device, deferredOperation, infoCount, pInfos);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CopyMicromapEXT(
+    VkDevice                                    device,
+    VkDeferredOperationKHR                      deferredOperation,
+    const VkCopyMicromapInfoEXT*                pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCopyMicromapEXT fp = (PFN_vkCopyMicromapEXT)loader_resolve_lazy_device_command(table, "vkCopyMicromapEXT",
+        (PFN_vkVoidFunction *)&table->CopyMicromapEXT);
+    return fp(device, deferredOperation, pInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CopyMicromapToMemoryEXT(
+    VkDevice                                    device,
+    VkDeferredOperationKHR                      deferredOperation,
+    const VkCopyMicromapToMemoryInfoEXT*        pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCopyMicromapToMemoryEXT fp = (PFN_vkCopyMicromapToMemoryEXT)loader_resolve_lazy_device_command(table, "vkCopyMicromapToMemoryEXT",
+        (PFN_vkVoidFunction *)&table->CopyMicromapToMemoryEXT);
+    return fp(device, deferredOperation, pInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CopyMemoryToMicromapEXT(
+    VkDevice                                    device,
+    VkDeferredOperationKHR                      deferredOperation,
+    const VkCopyMemoryToMicromapInfoEXT*        pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCopyMemoryToMicromapEXT fp = (PFN_vkCopyMemoryToMicromapEXT)loader_resolve_lazy_device_command(table, "vkCopyMemoryToMicromapEXT",
+        (PFN_vkVoidFunction *)&table->CopyMemoryToMicromapEXT);
+    return fp(device, deferredOperation, pInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_WriteMicromapsPropertiesEXT(
+    VkDevice                                    device,
+    uint32_t                                    micromapCount,
+    const VkMicromapEXT*                        pMicromaps,
+    VkQueryType                                 queryType,
+    size_t                                      dataSize,
+    void*                                       pData,
+    size_t                                      stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkWriteMicromapsPropertiesEXT fp = (PFN_vkWriteMicromapsPropertiesEXT)loader_resolve_lazy_device_command(table, "vkWriteMicromapsPropertiesEXT",
+        (PFN_vkVoidFunction *)&table->WriteMicromapsPropertiesEXT);
+    return fp(device, micromapCount, pMicromaps, queryType, dataSize, pData, stride);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyMicromapEXT(
+    VkCommandBuffer                             commandBuffer,
+    const VkCopyMicromapInfoEXT*                pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyMicromapEXT fp = (PFN_vkCmdCopyMicromapEXT)loader_resolve_lazy_device_command(table, "vkCmdCopyMicromapEXT",
+        (PFN_vkVoidFunction *)&table->CmdCopyMicromapEXT);
+    fp(commandBuffer, pInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyMicromapToMemoryEXT(
+    VkCommandBuffer                             commandBuffer,
+    const VkCopyMicromapToMemoryInfoEXT*        pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyMicromapToMemoryEXT fp = (PFN_vkCmdCopyMicromapToMemoryEXT)loader_resolve_lazy_device_command(table, "vkCmdCopyMicromapToMemoryEXT",
+        (PFN_vkVoidFunction *)&table->CmdCopyMicromapToMemoryEXT);
+    fp(commandBuffer, pInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyMemoryToMicromapEXT(
+    VkCommandBuffer                             commandBuffer,
+    const VkCopyMemoryToMicromapInfoEXT*        pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyMemoryToMicromapEXT fp = (PFN_vkCmdCopyMemoryToMicromapEXT)loader_resolve_lazy_device_command(table, "vkCmdCopyMemoryToMicromapEXT",
+        (PFN_vkVoidFunction *)&table->CmdCopyMemoryToMicromapEXT);
+    fp(commandBuffer, pInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdWriteMicromapsPropertiesEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    micromapCount,
+    const VkMicromapEXT*                        pMicromaps,
+    VkQueryType                                 queryType,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    firstQuery) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdWriteMicromapsPropertiesEXT fp = (PFN_vkCmdWriteMicromapsPropertiesEXT)loader_resolve_lazy_device_command(table, "vkCmdWriteMicromapsPropertiesEXT",
+        (PFN_vkVoidFunction *)&table->CmdWriteMicromapsPropertiesEXT);
+    fp(commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceMicromapCompatibilityEXT(
+    VkDevice                                    device,
+    const VkMicromapVersionInfoEXT*             pVersionInfo,
+    VkAccelerationStructureCompatibilityKHR*    pCompatibility) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceMicromapCompatibilityEXT fp = (PFN_vkGetDeviceMicromapCompatibilityEXT)loader_resolve_lazy_device_command(table, "vkGetDeviceMicromapCompatibilityEXT",
+        (PFN_vkVoidFunction *)&table->GetDeviceMicromapCompatibilityEXT);
+    fp(device, pVersionInfo, pCompatibility);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetMicromapBuildSizesEXT(
+    VkDevice                                    device,
+    VkAccelerationStructureBuildTypeKHR         buildType,
+    const VkMicromapBuildInfoEXT*               pBuildInfo,
+    VkMicromapBuildSizesInfoEXT*                pSizeInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetMicromapBuildSizesEXT fp = (PFN_vkGetMicromapBuildSizesEXT)loader_resolve_lazy_device_command(table, "vkGetMicromapBuildSizesEXT",
+        (PFN_vkVoidFunction *)&table->GetMicromapBuildSizesEXT);
+    fp(device, buildType, pBuildInfo, pSizeInfo);
+}
+
+// ---- VK_HUAWEI_cluster_culling_shader extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawClusterHUAWEI(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    groupCountX,
+    uint32_t                                    groupCountY,
+    uint32_t                                    groupCountZ) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawClusterHUAWEI fp = (PFN_vkCmdDrawClusterHUAWEI)loader_resolve_lazy_device_command(table, "vkCmdDrawClusterHUAWEI",
+        (PFN_vkVoidFunction *)&table->CmdDrawClusterHUAWEI);
+    fp(commandBuffer, groupCountX, groupCountY, groupCountZ);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawClusterIndirectHUAWEI(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawClusterIndirectHUAWEI fp = (PFN_vkCmdDrawClusterIndirectHUAWEI)loader_resolve_lazy_device_command(table, "vkCmdDrawClusterIndirectHUAWEI",
+        (PFN_vkVoidFunction *)&table->CmdDrawClusterIndirectHUAWEI);
+    fp(commandBuffer, buffer, offset);
+}
+
+// ---- VK_EXT_pageable_device_local_memory extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_SetDeviceMemoryPriorityEXT(
+    VkDevice                                    device,
+    VkDeviceMemory                              memory,
+    float                                       priority) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkSetDeviceMemoryPriorityEXT fp = (PFN_vkSetDeviceMemoryPriorityEXT)loader_resolve_lazy_device_command(table, "vkSetDeviceMemoryPriorityEXT",
+        (PFN_vkVoidFunction *)&table->SetDeviceMemoryPriorityEXT);
+    fp(device, memory, priority);
+}
+
+// ---- VK_VALVE_descriptor_set_host_mapping extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDescriptorSetLayoutHostMappingInfoVALVE(
+    VkDevice                                    device,
+    const VkDescriptorSetBindingReferenceVALVE* pBindingReference,
+    VkDescriptorSetLayoutHostMappingInfoVALVE*  pHostMapping) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE fp = (PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE)loader_resolve_lazy_device_command(table, "vkGetDescriptorSetLayoutHostMappingInfoVALVE",
+        (PFN_vkVoidFunction *)&table->GetDescriptorSetLayoutHostMappingInfoVALVE);
+    fp(device, pBindingReference, pHostMapping);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDescriptorSetHostMappingVALVE(
+    VkDevice                                    device,
+    VkDescriptorSet                             descriptorSet,
+    void**                                      ppData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDescriptorSetHostMappingVALVE fp = (PFN_vkGetDescriptorSetHostMappingVALVE)loader_resolve_lazy_device_command(table, "vkGetDescriptorSetHostMappingVALVE",
+        (PFN_vkVoidFunction *)&table->GetDescriptorSetHostMappingVALVE);
+    fp(device, descriptorSet, ppData);
+}
+
+// ---- VK_NV_copy_memory_indirect extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyMemoryIndirectNV(
+    VkCommandBuffer                             commandBuffer,
+    VkDeviceAddress                             copyBufferAddress,
+    uint32_t                                    copyCount,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyMemoryIndirectNV fp = (PFN_vkCmdCopyMemoryIndirectNV)loader_resolve_lazy_device_command(table, "vkCmdCopyMemoryIndirectNV",
+        (PFN_vkVoidFunction *)&table->CmdCopyMemoryIndirectNV);
+    fp(commandBuffer, copyBufferAddress, copyCount, stride);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyMemoryToImageIndirectNV(
+    VkCommandBuffer                             commandBuffer,
+    VkDeviceAddress                             copyBufferAddress,
+    uint32_t                                    copyCount,
+    uint32_t                                    stride,
+    VkImage                                     dstImage,
+    VkImageLayout                               dstImageLayout,
+    const VkImageSubresourceLayers*             pImageSubresources) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyMemoryToImageIndirectNV fp = (PFN_vkCmdCopyMemoryToImageIndirectNV)loader_resolve_lazy_device_command(table, "vkCmdCopyMemoryToImageIndirectNV",
+        (PFN_vkVoidFunction *)&table->CmdCopyMemoryToImageIndirectNV);
+    fp(commandBuffer, copyBufferAddress, copyCount, stride, dstImage, dstImageLayout, pImageSubresources);
+}
+
+// ---- VK_NV_memory_decompression extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDecompressMemoryNV(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    decompressRegionCount,
+    const VkDecompressMemoryRegionNV*           pDecompressMemoryRegions) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDecompressMemoryNV fp = (PFN_vkCmdDecompressMemoryNV)loader_resolve_lazy_device_command(table, "vkCmdDecompressMemoryNV",
+        (PFN_vkVoidFunction *)&table->CmdDecompressMemoryNV);
+    fp(commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDecompressMemoryIndirectCountNV(
+    VkCommandBuffer                             commandBuffer,
+    VkDeviceAddress                             indirectCommandsAddress,
+    VkDeviceAddress                             indirectCommandsCountAddress,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDecompressMemoryIndirectCountNV fp = (PFN_vkCmdDecompressMemoryIndirectCountNV)loader_resolve_lazy_device_command(table, "vkCmdDecompressMemoryIndirectCountNV",
+        (PFN_vkVoidFunction *)&table->CmdDecompressMemoryIndirectCountNV);
+    fp(commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress, stride);
+}
+
+// ---- VK_NV_device_generated_commands_compute extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetPipelineIndirectMemoryRequirementsNV(
+    VkDevice                                    device,
+    const VkComputePipelineCreateInfo*          pCreateInfo,
+    VkMemoryRequirements2*                      pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetPipelineIndirectMemoryRequirementsNV fp = (PFN_vkGetPipelineIndirectMemoryRequirementsNV)loader_resolve_lazy_device_command(table, "vkGetPipelineIndirectMemoryRequirementsNV",
+        (PFN_vkVoidFunction *)&table->GetPipelineIndirectMemoryRequirementsNV);
+    fp(device, pCreateInfo, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdUpdatePipelineIndirectBufferNV(
+    VkCommandBuffer                             commandBuffer,
+    VkPipelineBindPoint                         pipelineBindPoint,
+    VkPipeline                                  pipeline) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdUpdatePipelineIndirectBufferNV fp = (PFN_vkCmdUpdatePipelineIndirectBufferNV)loader_resolve_lazy_device_command(table, "vkCmdUpdatePipelineIndirectBufferNV",
+        (PFN_vkVoidFunction *)&table->CmdUpdatePipelineIndirectBufferNV);
+    fp(commandBuffer, pipelineBindPoint, pipeline);
+}
+static VKAPI_ATTR VkDeviceAddress VKAPI_CALL loader_lazy_GetPipelineIndirectDeviceAddressNV(
+    VkDevice                                    device,
+    const VkPipelineIndirectDeviceAddressInfoNV* pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetPipelineIndirectDeviceAddressNV fp = (PFN_vkGetPipelineIndirectDeviceAddressNV)loader_resolve_lazy_device_command(table, "vkGetPipelineIndirectDeviceAddressNV",
+        (PFN_vkVoidFunction *)&table->GetPipelineIndirectDeviceAddressNV);
+    return fp(device, pInfo);
+}
+
+// ---- VK_EXT_extended_dynamic_state3 extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthClampEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    depthClampEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthClampEnableEXT fp = (PFN_vkCmdSetDepthClampEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetDepthClampEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthClampEnableEXT);
+    fp(commandBuffer, depthClampEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetPolygonModeEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkPolygonMode                               polygonMode) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetPolygonModeEXT fp = (PFN_vkCmdSetPolygonModeEXT)loader_resolve_lazy_device_command(table, "vkCmdSetPolygonModeEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetPolygonModeEXT);
+    fp(commandBuffer, polygonMode);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetRasterizationSamplesEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkSampleCountFlagBits                       rasterizationSamples) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetRasterizationSamplesEXT fp = (PFN_vkCmdSetRasterizationSamplesEXT)loader_resolve_lazy_device_command(table, "vkCmdSetRasterizationSamplesEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetRasterizationSamplesEXT);
+    fp(commandBuffer, rasterizationSamples);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetSampleMaskEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkSampleCountFlagBits                       samples,
+    const VkSampleMask*                         pSampleMask) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetSampleMaskEXT fp = (PFN_vkCmdSetSampleMaskEXT)loader_resolve_lazy_device_command(table, "vkCmdSetSampleMaskEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetSampleMaskEXT);
+    fp(commandBuffer, samples, pSampleMask);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetAlphaToCoverageEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    alphaToCoverageEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetAlphaToCoverageEnableEXT fp = (PFN_vkCmdSetAlphaToCoverageEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetAlphaToCoverageEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetAlphaToCoverageEnableEXT);
+    fp(commandBuffer, alphaToCoverageEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetAlphaToOneEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    alphaToOneEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetAlphaToOneEnableEXT fp = (PFN_vkCmdSetAlphaToOneEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetAlphaToOneEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetAlphaToOneEnableEXT);
+    fp(commandBuffer, alphaToOneEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetLogicOpEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    logicOpEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetLogicOpEnableEXT fp = (PFN_vkCmdSetLogicOpEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetLogicOpEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetLogicOpEnableEXT);
+    fp(commandBuffer, logicOpEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetColorBlendEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstAttachment,
+    uint32_t                                    attachmentCount,
+    const VkBool32*                             pColorBlendEnables) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetColorBlendEnableEXT fp = (PFN_vkCmdSetColorBlendEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetColorBlendEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetColorBlendEnableEXT);
+    fp(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetColorBlendEquationEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstAttachment,
+    uint32_t                                    attachmentCount,
+    const VkColorBlendEquationEXT*              pColorBlendEquations) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetColorBlendEquationEXT fp = (PFN_vkCmdSetColorBlendEquationEXT)loader_resolve_lazy_device_command(table, "vkCmdSetColorBlendEquationEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetColorBlendEquationEXT);
+    fp(commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetColorWriteMaskEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstAttachment,
+    uint32_t                                    attachmentCount,
+    const VkColorComponentFlags*                pColorWriteMasks) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetColorWriteMaskEXT fp = (PFN_vkCmdSetColorWriteMaskEXT)loader_resolve_lazy_device_command(table, "vkCmdSetColorWriteMaskEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetColorWriteMaskEXT);
+    fp(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetTessellationDomainOriginEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkTessellationDomainOrigin                  domainOrigin) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetTessellationDomainOriginEXT fp = (PFN_vkCmdSetTessellationDomainOriginEXT)loader_resolve_lazy_device_command(table, "vkCmdSetTessellationDomainOriginEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetTessellationDomainOriginEXT);
+    fp(commandBuffer, domainOrigin);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetRasterizationStreamEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    rasterizationStream) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetRasterizationStreamEXT fp = (PFN_vkCmdSetRasterizationStreamEXT)loader_resolve_lazy_device_command(table, "vkCmdSetRasterizationStreamEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetRasterizationStreamEXT);
+    fp(commandBuffer, rasterizationStream);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetConservativeRasterizationModeEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkConservativeRasterizationModeEXT          conservativeRasterizationMode) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetConservativeRasterizationModeEXT fp = (PFN_vkCmdSetConservativeRasterizationModeEXT)loader_resolve_lazy_device_command(table, "vkCmdSetConservativeRasterizationModeEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetConservativeRasterizationModeEXT);
+    fp(commandBuffer, conservativeRasterizationMode);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetExtraPrimitiveOverestimationSizeEXT(
+    VkCommandBuffer                             commandBuffer,
+    float                                       extraPrimitiveOverestimationSize) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT fp = (PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT)loader_resolve_lazy_device_command(table, "vkCmdSetExtraPrimitiveOverestimationSizeEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetExtraPrimitiveOverestimationSizeEXT);
+    fp(commandBuffer, extraPrimitiveOverestimationSize);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthClipEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    depthClipEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthClipEnableEXT fp = (PFN_vkCmdSetDepthClipEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetDepthClipEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthClipEnableEXT);
+    fp(commandBuffer, depthClipEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetSampleLocationsEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    sampleLocationsEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetSampleLocationsEnableEXT fp = (PFN_vkCmdSetSampleLocationsEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetSampleLocationsEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetSampleLocationsEnableEXT);
+    fp(commandBuffer, sampleLocationsEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetColorBlendAdvancedEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstAttachment,
+    uint32_t                                    attachmentCount,
+    const VkColorBlendAdvancedEXT*              pColorBlendAdvanced) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetColorBlendAdvancedEXT fp = (PFN_vkCmdSetColorBlendAdvancedEXT)loader_resolve_lazy_device_command(table, "vkCmdSetColorBlendAdvancedEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetColorBlendAdvancedEXT);
+    fp(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetProvokingVertexModeEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkProvokingVertexModeEXT                    provokingVertexMode) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetProvokingVertexModeEXT fp = (PFN_vkCmdSetProvokingVertexModeEXT)loader_resolve_lazy_device_command(table, "vkCmdSetProvokingVertexModeEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetProvokingVertexModeEXT);
+    fp(commandBuffer, provokingVertexMode);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetLineRasterizationModeEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkLineRasterizationModeEXT                  lineRasterizationMode) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetLineRasterizationModeEXT fp = (PFN_vkCmdSetLineRasterizationModeEXT)loader_resolve_lazy_device_command(table, "vkCmdSetLineRasterizationModeEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetLineRasterizationModeEXT);
+    fp(commandBuffer, lineRasterizationMode);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetLineStippleEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    stippledLineEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetLineStippleEnableEXT fp = (PFN_vkCmdSetLineStippleEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetLineStippleEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetLineStippleEnableEXT);
+    fp(commandBuffer, stippledLineEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthClipNegativeOneToOneEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    negativeOneToOne) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthClipNegativeOneToOneEXT fp = (PFN_vkCmdSetDepthClipNegativeOneToOneEXT)loader_resolve_lazy_device_command(table, "vkCmdSetDepthClipNegativeOneToOneEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthClipNegativeOneToOneEXT);
+    fp(commandBuffer, negativeOneToOne);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetViewportWScalingEnableNV(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    viewportWScalingEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetViewportWScalingEnableNV fp = (PFN_vkCmdSetViewportWScalingEnableNV)loader_resolve_lazy_device_command(table, "vkCmdSetViewportWScalingEnableNV",
+        (PFN_vkVoidFunction *)&table->CmdSetViewportWScalingEnableNV);
+    fp(commandBuffer, viewportWScalingEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetViewportSwizzleNV(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    firstViewport,
+    uint32_t                                    viewportCount,
+    const VkViewportSwizzleNV*                  pViewportSwizzles) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetViewportSwizzleNV fp = (PFN_vkCmdSetViewportSwizzleNV)loader_resolve_lazy_device_command(table, "vkCmdSetViewportSwizzleNV",
+        (PFN_vkVoidFunction *)&table->CmdSetViewportSwizzleNV);
+    fp(commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetCoverageToColorEnableNV(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    coverageToColorEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetCoverageToColorEnableNV fp = (PFN_vkCmdSetCoverageToColorEnableNV)loader_resolve_lazy_device_command(table, "vkCmdSetCoverageToColorEnableNV",
+        (PFN_vkVoidFunction *)&table->CmdSetCoverageToColorEnableNV);
+    fp(commandBuffer, coverageToColorEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetCoverageToColorLocationNV(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    coverageToColorLocation) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetCoverageToColorLocationNV fp = (PFN_vkCmdSetCoverageToColorLocationNV)loader_resolve_lazy_device_command(table, "vkCmdSetCoverageToColorLocationNV",
+        (PFN_vkVoidFunction *)&table->CmdSetCoverageToColorLocationNV);
+    fp(commandBuffer, coverageToColorLocation);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetCoverageModulationModeNV(
+    VkCommandBuffer                             commandBuffer,
+    VkCoverageModulationModeNV                  coverageModulationMode) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetCoverageModulationModeNV fp = (PFN_vkCmdSetCoverageModulationModeNV)loader_resolve_lazy_device_command(table, "vkCmdSetCoverageModulationModeNV",
+        (PFN_vkVoidFunction *)&table->CmdSetCoverageModulationModeNV);
+    fp(commandBuffer, coverageModulationMode);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetCoverageModulationTableEnableNV(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    coverageModulationTableEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetCoverageModulationTableEnableNV fp = (PFN_vkCmdSetCoverageModulationTableEnableNV)loader_resolve_lazy_device_command(table, "vkCmdSetCoverageModulationTableEnableNV",
+        (PFN_vkVoidFunction *)&table->CmdSetCoverageModulationTableEnableNV);
+    fp(commandBuffer, coverageModulationTableEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetCoverageModulationTableNV(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    coverageModulationTableCount,
+    const float*                                pCoverageModulationTable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetCoverageModulationTableNV fp = (PFN_vkCmdSetCoverageModulationTableNV)loader_resolve_lazy_device_command(table, "vkCmdSetCoverageModulationTableNV",
+        (PFN_vkVoidFunction *)&table->CmdSetCoverageModulationTableNV);
+    fp(commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetShadingRateImageEnableNV(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    shadingRateImageEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetShadingRateImageEnableNV fp = (PFN_vkCmdSetShadingRateImageEnableNV)loader_resolve_lazy_device_command(table, "vkCmdSetShadingRateImageEnableNV",
+        (PFN_vkVoidFunction *)&table->CmdSetShadingRateImageEnableNV);
+    fp(commandBuffer, shadingRateImageEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetRepresentativeFragmentTestEnableNV(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    representativeFragmentTestEnable) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetRepresentativeFragmentTestEnableNV fp = (PFN_vkCmdSetRepresentativeFragmentTestEnableNV)loader_resolve_lazy_device_command(table, "vkCmdSetRepresentativeFragmentTestEnableNV",
+        (PFN_vkVoidFunction *)&table->CmdSetRepresentativeFragmentTestEnableNV);
+    fp(commandBuffer, representativeFragmentTestEnable);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetCoverageReductionModeNV(
+    VkCommandBuffer                             commandBuffer,
+    VkCoverageReductionModeNV                   coverageReductionMode) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetCoverageReductionModeNV fp = (PFN_vkCmdSetCoverageReductionModeNV)loader_resolve_lazy_device_command(table, "vkCmdSetCoverageReductionModeNV",
+        (PFN_vkVoidFunction *)&table->CmdSetCoverageReductionModeNV);
+    fp(commandBuffer, coverageReductionMode);
+}
+
+// ---- VK_EXT_shader_module_identifier extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetShaderModuleIdentifierEXT(
+    VkDevice                                    device,
+    VkShaderModule                              shaderModule,
+    VkShaderModuleIdentifierEXT*                pIdentifier) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetShaderModuleIdentifierEXT fp = (PFN_vkGetShaderModuleIdentifierEXT)loader_resolve_lazy_device_command(table, "vkGetShaderModuleIdentifierEXT",
+        (PFN_vkVoidFunction *)&table->GetShaderModuleIdentifierEXT);
+    fp(device, shaderModule, pIdentifier);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetShaderModuleCreateInfoIdentifierEXT(
+    VkDevice                                    device,
+    const VkShaderModuleCreateInfo*             pCreateInfo,
+    VkShaderModuleIdentifierEXT*                pIdentifier) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetShaderModuleCreateInfoIdentifierEXT fp = (PFN_vkGetShaderModuleCreateInfoIdentifierEXT)loader_resolve_lazy_device_command(table, "vkGetShaderModuleCreateInfoIdentifierEXT",
+        (PFN_vkVoidFunction *)&table->GetShaderModuleCreateInfoIdentifierEXT);
+    fp(device, pCreateInfo, pIdentifier);
+}
+
+// ---- VK_NV_optical_flow extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateOpticalFlowSessionNV(
+    VkDevice                                    device,
+    const VkOpticalFlowSessionCreateInfoNV*     pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkOpticalFlowSessionNV*                     pSession) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateOpticalFlowSessionNV fp = (PFN_vkCreateOpticalFlowSessionNV)loader_resolve_lazy_device_command(table, "vkCreateOpticalFlowSessionNV",
+        (PFN_vkVoidFunction *)&table->CreateOpticalFlowSessionNV);
+    return fp(device, pCreateInfo, pAllocator, pSession);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyOpticalFlowSessionNV(
+    VkDevice                                    device,
+    VkOpticalFlowSessionNV                      session,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyOpticalFlowSessionNV fp = (PFN_vkDestroyOpticalFlowSessionNV)loader_resolve_lazy_device_command(table, "vkDestroyOpticalFlowSessionNV",
+        (PFN_vkVoidFunction *)&table->DestroyOpticalFlowSessionNV);
+    fp(device, session, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_BindOpticalFlowSessionImageNV(
+    VkDevice                                    device,
+    VkOpticalFlowSessionNV                      session,
+    VkOpticalFlowSessionBindingPointNV          bindingPoint,
+    VkImageView                                 view,
+    VkImageLayout                               layout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkBindOpticalFlowSessionImageNV fp = (PFN_vkBindOpticalFlowSessionImageNV)loader_resolve_lazy_device_command(table, "vkBindOpticalFlowSessionImageNV",
+        (PFN_vkVoidFunction *)&table->BindOpticalFlowSessionImageNV);
+    return fp(device, session, bindingPoint, view, layout);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdOpticalFlowExecuteNV(
+    VkCommandBuffer                             commandBuffer,
+    VkOpticalFlowSessionNV                      session,
+    const VkOpticalFlowExecuteInfoNV*           pExecuteInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdOpticalFlowExecuteNV fp = (PFN_vkCmdOpticalFlowExecuteNV)loader_resolve_lazy_device_command(table, "vkCmdOpticalFlowExecuteNV",
+        (PFN_vkVoidFunction *)&table->CmdOpticalFlowExecuteNV);
+    fp(commandBuffer, session, pExecuteInfo);
+}
+
+// ---- VK_AMD_anti_lag extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_AntiLagUpdateAMD(
+    VkDevice                                    device,
+    const VkAntiLagDataAMD*                     pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkAntiLagUpdateAMD fp = (PFN_vkAntiLagUpdateAMD)loader_resolve_lazy_device_command(table, "vkAntiLagUpdateAMD",
+        (PFN_vkVoidFunction *)&table->AntiLagUpdateAMD);
+    fp(device, pData);
+}
+
+// ---- VK_EXT_shader_object extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateShadersEXT(
+    VkDevice                                    device,
+    uint32_t                                    createInfoCount,
+    const VkShaderCreateInfoEXT*                pCreateInfos,
+    const VkAllocationCallbacks*                pAllocator,
+    VkShaderEXT*                                pShaders) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateShadersEXT fp = (PFN_vkCreateShadersEXT)loader_resolve_lazy_device_command(table, "vkCreateShadersEXT",
+        (PFN_vkVoidFunction *)&table->CreateShadersEXT);
+    return fp(device, createInfoCount, pCreateInfos, pAllocator, pShaders);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyShaderEXT(
+    VkDevice                                    device,
+    VkShaderEXT                                 shader,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyShaderEXT fp = (PFN_vkDestroyShaderEXT)loader_resolve_lazy_device_command(table, "vkDestroyShaderEXT",
+        (PFN_vkVoidFunction *)&table->DestroyShaderEXT);
+    fp(device, shader, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetShaderBinaryDataEXT(
+    VkDevice                                    device,
+    VkShaderEXT                                 shader,
+    size_t*                                     pDataSize,
+    void*                                       pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetShaderBinaryDataEXT fp = (PFN_vkGetShaderBinaryDataEXT)loader_resolve_lazy_device_command(table, "vkGetShaderBinaryDataEXT",
+        (PFN_vkVoidFunction *)&table->GetShaderBinaryDataEXT);
+    return fp(device, shader, pDataSize, pData);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBindShadersEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    stageCount,
+    const VkShaderStageFlagBits*                pStages,
+    const VkShaderEXT*                          pShaders) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBindShadersEXT fp = (PFN_vkCmdBindShadersEXT)loader_resolve_lazy_device_command(table, "vkCmdBindShadersEXT",
+        (PFN_vkVoidFunction *)&table->CmdBindShadersEXT);
+    fp(commandBuffer, stageCount, pStages, pShaders);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetDepthClampRangeEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkDepthClampModeEXT                         depthClampMode,
+    const VkDepthClampRangeEXT*                 pDepthClampRange) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetDepthClampRangeEXT fp = (PFN_vkCmdSetDepthClampRangeEXT)loader_resolve_lazy_device_command(table, "vkCmdSetDepthClampRangeEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetDepthClampRangeEXT);
+    fp(commandBuffer, depthClampMode, pDepthClampRange);
+}
+
+// ---- VK_QCOM_tile_properties extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetFramebufferTilePropertiesQCOM(
+    VkDevice                                    device,
+    VkFramebuffer                               framebuffer,
+    uint32_t*                                   pPropertiesCount,
+    VkTilePropertiesQCOM*                       pProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetFramebufferTilePropertiesQCOM fp = (PFN_vkGetFramebufferTilePropertiesQCOM)loader_resolve_lazy_device_command(table, "vkGetFramebufferTilePropertiesQCOM",
+        (PFN_vkVoidFunction *)&table->GetFramebufferTilePropertiesQCOM);
+    return fp(device, framebuffer, pPropertiesCount, pProperties);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetDynamicRenderingTilePropertiesQCOM(
+    VkDevice                                    device,
+    const VkRenderingInfo*                      pRenderingInfo,
+    VkTilePropertiesQCOM*                       pProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDynamicRenderingTilePropertiesQCOM fp = (PFN_vkGetDynamicRenderingTilePropertiesQCOM)loader_resolve_lazy_device_command(table, "vkGetDynamicRenderingTilePropertiesQCOM",
+        (PFN_vkVoidFunction *)&table->GetDynamicRenderingTilePropertiesQCOM);
+    return fp(device, pRenderingInfo, pProperties);
+}
+
+// ---- VK_NV_cooperative_vector extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_ConvertCooperativeVectorMatrixNV(
+    VkDevice                                    device,
+    const VkConvertCooperativeVectorMatrixInfoNV* pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkConvertCooperativeVectorMatrixNV fp = (PFN_vkConvertCooperativeVectorMatrixNV)loader_resolve_lazy_device_command(table, "vkConvertCooperativeVectorMatrixNV",
+        (PFN_vkVoidFunction *)&table->ConvertCooperativeVectorMatrixNV);
+    return fp(device, pInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdConvertCooperativeVectorMatrixNV(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    infoCount,
+    const VkConvertCooperativeVectorMatrixInfoNV* pInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdConvertCooperativeVectorMatrixNV fp = (PFN_vkCmdConvertCooperativeVectorMatrixNV)loader_resolve_lazy_device_command(table, "vkCmdConvertCooperativeVectorMatrixNV",
+        (PFN_vkVoidFunction *)&table->CmdConvertCooperativeVectorMatrixNV);
+    fp(commandBuffer, infoCount, pInfos);
+}
+
+// ---- VK_NV_low_latency2 extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_SetLatencySleepModeNV(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain,
+    const VkLatencySleepModeInfoNV*             pSleepModeInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkSetLatencySleepModeNV fp = (PFN_vkSetLatencySleepModeNV)loader_resolve_lazy_device_command(table, "vkSetLatencySleepModeNV",
+        (PFN_vkVoidFunction *)&table->SetLatencySleepModeNV);
+    return fp(device, swapchain, pSleepModeInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_LatencySleepNV(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain,
+    const VkLatencySleepInfoNV*                 pSleepInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkLatencySleepNV fp = (PFN_vkLatencySleepNV)loader_resolve_lazy_device_command(table, "vkLatencySleepNV",
+        (PFN_vkVoidFunction *)&table->LatencySleepNV);
+    return fp(device, swapchain, pSleepInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_SetLatencyMarkerNV(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain,
+    const VkSetLatencyMarkerInfoNV*             pLatencyMarkerInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkSetLatencyMarkerNV fp = (PFN_vkSetLatencyMarkerNV)loader_resolve_lazy_device_command(table, "vkSetLatencyMarkerNV",
+        (PFN_vkVoidFunction *)&table->SetLatencyMarkerNV);
+    fp(device, swapchain, pLatencyMarkerInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetLatencyTimingsNV(
+    VkDevice                                    device,
+    VkSwapchainKHR                              swapchain,
+    VkGetLatencyMarkerInfoNV*                   pLatencyMarkerInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetLatencyTimingsNV fp = (PFN_vkGetLatencyTimingsNV)loader_resolve_lazy_device_command(table, "vkGetLatencyTimingsNV",
+        (PFN_vkVoidFunction *)&table->GetLatencyTimingsNV);
+    fp(device, swapchain, pLatencyMarkerInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_QueueNotifyOutOfBandNV(
+    VkQueue                                     queue,
+    const VkOutOfBandQueueTypeInfoNV*           pQueueTypeInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(queue);
+    PFN_vkQueueNotifyOutOfBandNV fp = (PFN_vkQueueNotifyOutOfBandNV)loader_resolve_lazy_device_command(table, "vkQueueNotifyOutOfBandNV",
+        (PFN_vkVoidFunction *)&table->QueueNotifyOutOfBandNV);
+    fp(queue, pQueueTypeInfo);
+}
+
+// ---- VK_EXT_attachment_feedback_loop_dynamic_state extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetAttachmentFeedbackLoopEnableEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkImageAspectFlags                          aspectMask) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT fp = (PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT)loader_resolve_lazy_device_command(table, "vkCmdSetAttachmentFeedbackLoopEnableEXT",
+        (PFN_vkVoidFunction *)&table->CmdSetAttachmentFeedbackLoopEnableEXT);
+    fp(commandBuffer, aspectMask);
+}
+
+// ---- VK_QNX_external_memory_screen_buffer extension commands
+#if defined(VK_USE_PLATFORM_SCREEN_QNX)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetScreenBufferPropertiesQNX(
+    VkDevice                                    device,
+    const struct _screen_buffer*                buffer,
+    VkScreenBufferPropertiesQNX*                pProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetScreenBufferPropertiesQNX fp = (PFN_vkGetScreenBufferPropertiesQNX)loader_resolve_lazy_device_command(table, "vkGetScreenBufferPropertiesQNX",
+        (PFN_vkVoidFunction *)&table->GetScreenBufferPropertiesQNX);
+    return fp(device, buffer, pProperties);
+}
+#endif // VK_USE_PLATFORM_SCREEN_QNX
+
+// ---- VK_NV_cluster_acceleration_structure extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetClusterAccelerationStructureBuildSizesNV(
+    VkDevice                                    device,
+    const VkClusterAccelerationStructureInputInfoNV* pInfo,
+    VkAccelerationStructureBuildSizesInfoKHR*   pSizeInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetClusterAccelerationStructureBuildSizesNV fp = (PFN_vkGetClusterAccelerationStructureBuildSizesNV)loader_resolve_lazy_device_command(table, "vkGetClusterAccelerationStructureBuildSizesNV",
+        (PFN_vkVoidFunction *)&table->GetClusterAccelerationStructureBuildSizesNV);
+    fp(device, pInfo, pSizeInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBuildClusterAccelerationStructureIndirectNV(
+    VkCommandBuffer                             commandBuffer,
+    const VkClusterAccelerationStructureCommandsInfoNV* pCommandInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBuildClusterAccelerationStructureIndirectNV fp = (PFN_vkCmdBuildClusterAccelerationStructureIndirectNV)loader_resolve_lazy_device_command(table, "vkCmdBuildClusterAccelerationStructureIndirectNV",
+        (PFN_vkVoidFunction *)&table->CmdBuildClusterAccelerationStructureIndirectNV);
+    fp(commandBuffer, pCommandInfos);
+}
+
+// ---- VK_NV_partitioned_acceleration_structure extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetPartitionedAccelerationStructuresBuildSizesNV(
+    VkDevice                                    device,
+    const VkPartitionedAccelerationStructureInstancesInputNV* pInfo,
+    VkAccelerationStructureBuildSizesInfoKHR*   pSizeInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetPartitionedAccelerationStructuresBuildSizesNV fp = (PFN_vkGetPartitionedAccelerationStructuresBuildSizesNV)loader_resolve_lazy_device_command(table, "vkGetPartitionedAccelerationStructuresBuildSizesNV",
+        (PFN_vkVoidFunction *)&table->GetPartitionedAccelerationStructuresBuildSizesNV);
+    fp(device, pInfo, pSizeInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBuildPartitionedAccelerationStructuresNV(
+    VkCommandBuffer                             commandBuffer,
+    const VkBuildPartitionedAccelerationStructureInfoNV* pBuildInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBuildPartitionedAccelerationStructuresNV fp = (PFN_vkCmdBuildPartitionedAccelerationStructuresNV)loader_resolve_lazy_device_command(table, "vkCmdBuildPartitionedAccelerationStructuresNV",
+        (PFN_vkVoidFunction *)&table->CmdBuildPartitionedAccelerationStructuresNV);
+    fp(commandBuffer, pBuildInfo);
+}
+
+// ---- VK_EXT_device_generated_commands extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetGeneratedCommandsMemoryRequirementsEXT(
+    VkDevice                                    device,
+    const VkGeneratedCommandsMemoryRequirementsInfoEXT* pInfo,
+    VkMemoryRequirements2*                      pMemoryRequirements) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetGeneratedCommandsMemoryRequirementsEXT fp = (PFN_vkGetGeneratedCommandsMemoryRequirementsEXT)loader_resolve_lazy_device_command(table, "vkGetGeneratedCommandsMemoryRequirementsEXT",
+        (PFN_vkVoidFunction *)&table->GetGeneratedCommandsMemoryRequirementsEXT);
+    fp(device, pInfo, pMemoryRequirements);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdPreprocessGeneratedCommandsEXT(
+    VkCommandBuffer                             commandBuffer,
+    const VkGeneratedCommandsInfoEXT*           pGeneratedCommandsInfo,
+    VkCommandBuffer                             stateCommandBuffer) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdPreprocessGeneratedCommandsEXT fp = (PFN_vkCmdPreprocessGeneratedCommandsEXT)loader_resolve_lazy_device_command(table, "vkCmdPreprocessGeneratedCommandsEXT",
+        (PFN_vkVoidFunction *)&table->CmdPreprocessGeneratedCommandsEXT);
+    fp(commandBuffer, pGeneratedCommandsInfo, stateCommandBuffer);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdExecuteGeneratedCommandsEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBool32                                    isPreprocessed,
+    const VkGeneratedCommandsInfoEXT*           pGeneratedCommandsInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdExecuteGeneratedCommandsEXT fp = (PFN_vkCmdExecuteGeneratedCommandsEXT)loader_resolve_lazy_device_command(table, "vkCmdExecuteGeneratedCommandsEXT",
+        (PFN_vkVoidFunction *)&table->CmdExecuteGeneratedCommandsEXT);
+    fp(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateIndirectCommandsLayoutEXT(
+    VkDevice                                    device,
+    const VkIndirectCommandsLayoutCreateInfoEXT* pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkIndirectCommandsLayoutEXT*                pIndirectCommandsLayout) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateIndirectCommandsLayoutEXT fp = (PFN_vkCreateIndirectCommandsLayoutEXT)loader_resolve_lazy_device_command(table, "vkCreateIndirectCommandsLayoutEXT",
+        (PFN_vkVoidFunction *)&table->CreateIndirectCommandsLayoutEXT);
+    return fp(device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyIndirectCommandsLayoutEXT(
+    VkDevice                                    device,
+    VkIndirectCommandsLayoutEXT                 indirectCommandsLayout,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyIndirectCommandsLayoutEXT fp = (PFN_vkDestroyIndirectCommandsLayoutEXT)loader_resolve_lazy_device_command(table, "vkDestroyIndirectCommandsLayoutEXT",
+        (PFN_vkVoidFunction *)&table->DestroyIndirectCommandsLayoutEXT);
+    fp(device, indirectCommandsLayout, pAllocator);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateIndirectExecutionSetEXT(
+    VkDevice                                    device,
+    const VkIndirectExecutionSetCreateInfoEXT*  pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkIndirectExecutionSetEXT*                  pIndirectExecutionSet) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateIndirectExecutionSetEXT fp = (PFN_vkCreateIndirectExecutionSetEXT)loader_resolve_lazy_device_command(table, "vkCreateIndirectExecutionSetEXT",
+        (PFN_vkVoidFunction *)&table->CreateIndirectExecutionSetEXT);
+    return fp(device, pCreateInfo, pAllocator, pIndirectExecutionSet);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyIndirectExecutionSetEXT(
+    VkDevice                                    device,
+    VkIndirectExecutionSetEXT                   indirectExecutionSet,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyIndirectExecutionSetEXT fp = (PFN_vkDestroyIndirectExecutionSetEXT)loader_resolve_lazy_device_command(table, "vkDestroyIndirectExecutionSetEXT",
+        (PFN_vkVoidFunction *)&table->DestroyIndirectExecutionSetEXT);
+    fp(device, indirectExecutionSet, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_UpdateIndirectExecutionSetPipelineEXT(
+    VkDevice                                    device,
+    VkIndirectExecutionSetEXT                   indirectExecutionSet,
+    uint32_t                                    executionSetWriteCount,
+    const VkWriteIndirectExecutionSetPipelineEXT* pExecutionSetWrites) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkUpdateIndirectExecutionSetPipelineEXT fp = (PFN_vkUpdateIndirectExecutionSetPipelineEXT)loader_resolve_lazy_device_command(table, "vkUpdateIndirectExecutionSetPipelineEXT",
+        (PFN_vkVoidFunction *)&table->UpdateIndirectExecutionSetPipelineEXT);
+    fp(device, indirectExecutionSet, executionSetWriteCount, pExecutionSetWrites);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_UpdateIndirectExecutionSetShaderEXT(
+    VkDevice                                    device,
+    VkIndirectExecutionSetEXT                   indirectExecutionSet,
+    uint32_t                                    executionSetWriteCount,
+    const VkWriteIndirectExecutionSetShaderEXT* pExecutionSetWrites) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkUpdateIndirectExecutionSetShaderEXT fp = (PFN_vkUpdateIndirectExecutionSetShaderEXT)loader_resolve_lazy_device_command(table, "vkUpdateIndirectExecutionSetShaderEXT",
+        (PFN_vkVoidFunction *)&table->UpdateIndirectExecutionSetShaderEXT);
+    fp(device, indirectExecutionSet, executionSetWriteCount, pExecutionSetWrites);
+}
+
+// ---- VK_EXT_external_memory_metal extension commands
+#if defined(VK_USE_PLATFORM_METAL_EXT)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetMemoryMetalHandleEXT(
+    VkDevice                                    device,
+    const VkMemoryGetMetalHandleInfoEXT*        pGetMetalHandleInfo,
+    void**                                      pHandle) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetMemoryMetalHandleEXT fp = (PFN_vkGetMemoryMetalHandleEXT)loader_resolve_lazy_device_command(table, "vkGetMemoryMetalHandleEXT",
+        (PFN_vkVoidFunction *)&table->GetMemoryMetalHandleEXT);
+    return fp(device, pGetMetalHandleInfo, pHandle);
+}
+#endif // VK_USE_PLATFORM_METAL_EXT
+#if defined(VK_USE_PLATFORM_METAL_EXT)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetMemoryMetalHandlePropertiesEXT(
+    VkDevice                                    device,
+    VkExternalMemoryHandleTypeFlagBits          handleType,
+    const void*                                 pHandle,
+    VkMemoryMetalHandlePropertiesEXT*           pMemoryMetalHandleProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetMemoryMetalHandlePropertiesEXT fp = (PFN_vkGetMemoryMetalHandlePropertiesEXT)loader_resolve_lazy_device_command(table, "vkGetMemoryMetalHandlePropertiesEXT",
+        (PFN_vkVoidFunction *)&table->GetMemoryMetalHandlePropertiesEXT);
+    return fp(device, handleType, pHandle, pMemoryMetalHandleProperties);
+}
+#endif // VK_USE_PLATFORM_METAL_EXT
+
+// ---- VK_KHR_acceleration_structure extension commands
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateAccelerationStructureKHR(
+    VkDevice                                    device,
+    const VkAccelerationStructureCreateInfoKHR* pCreateInfo,
+    const VkAllocationCallbacks*                pAllocator,
+    VkAccelerationStructureKHR*                 pAccelerationStructure) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateAccelerationStructureKHR fp = (PFN_vkCreateAccelerationStructureKHR)loader_resolve_lazy_device_command(table, "vkCreateAccelerationStructureKHR",
+        (PFN_vkVoidFunction *)&table->CreateAccelerationStructureKHR);
+    return fp(device, pCreateInfo, pAllocator, pAccelerationStructure);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_DestroyAccelerationStructureKHR(
+    VkDevice                                    device,
+    VkAccelerationStructureKHR                  accelerationStructure,
+    const VkAllocationCallbacks*                pAllocator) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkDestroyAccelerationStructureKHR fp = (PFN_vkDestroyAccelerationStructureKHR)loader_resolve_lazy_device_command(table, "vkDestroyAccelerationStructureKHR",
+        (PFN_vkVoidFunction *)&table->DestroyAccelerationStructureKHR);
+    fp(device, accelerationStructure, pAllocator);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBuildAccelerationStructuresKHR(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    infoCount,
+    const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
+    const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBuildAccelerationStructuresKHR fp = (PFN_vkCmdBuildAccelerationStructuresKHR)loader_resolve_lazy_device_command(table, "vkCmdBuildAccelerationStructuresKHR",
+        (PFN_vkVoidFunction *)&table->CmdBuildAccelerationStructuresKHR);
+    fp(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdBuildAccelerationStructuresIndirectKHR(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    infoCount,
+    const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
+    const VkDeviceAddress*                      pIndirectDeviceAddresses,
+    const uint32_t*                             pIndirectStrides,
+    const uint32_t* const*                      ppMaxPrimitiveCounts) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdBuildAccelerationStructuresIndirectKHR fp = (PFN_vkCmdBuildAccelerationStructuresIndirectKHR)loader_resolve_lazy_device_command(table, "vkCmdBuildAccelerationStructuresIndirectKHR",
+        (PFN_vkVoidFunction *)&table->CmdBuildAccelerationStructuresIndirectKHR);
+    fp(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_BuildAccelerationStructuresKHR(
+    VkDevice                                    device,
+    VkDeferredOperationKHR                      deferredOperation,
+    uint32_t                                    infoCount,
+    const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
+    const VkAccelerationStructureBuildRangeInfoKHR* const* ppBuildRangeInfos) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkBuildAccelerationStructuresKHR fp = (PFN_vkBuildAccelerationStructuresKHR)loader_resolve_lazy_device_command(table, "vkBuildAccelerationStructuresKHR",
+        (PFN_vkVoidFunction *)&table->BuildAccelerationStructuresKHR);
+    return fp(device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CopyAccelerationStructureKHR(
+    VkDevice                                    device,
+    VkDeferredOperationKHR                      deferredOperation,
+    const VkCopyAccelerationStructureInfoKHR*   pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCopyAccelerationStructureKHR fp = (PFN_vkCopyAccelerationStructureKHR)loader_resolve_lazy_device_command(table, "vkCopyAccelerationStructureKHR",
+        (PFN_vkVoidFunction *)&table->CopyAccelerationStructureKHR);
+    return fp(device, deferredOperation, pInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CopyAccelerationStructureToMemoryKHR(
+    VkDevice                                    device,
+    VkDeferredOperationKHR                      deferredOperation,
+    const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCopyAccelerationStructureToMemoryKHR fp = (PFN_vkCopyAccelerationStructureToMemoryKHR)loader_resolve_lazy_device_command(table, "vkCopyAccelerationStructureToMemoryKHR",
+        (PFN_vkVoidFunction *)&table->CopyAccelerationStructureToMemoryKHR);
+    return fp(device, deferredOperation, pInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CopyMemoryToAccelerationStructureKHR(
+    VkDevice                                    device,
+    VkDeferredOperationKHR                      deferredOperation,
+    const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCopyMemoryToAccelerationStructureKHR fp = (PFN_vkCopyMemoryToAccelerationStructureKHR)loader_resolve_lazy_device_command(table, "vkCopyMemoryToAccelerationStructureKHR",
+        (PFN_vkVoidFunction *)&table->CopyMemoryToAccelerationStructureKHR);
+    return fp(device, deferredOperation, pInfo);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_WriteAccelerationStructuresPropertiesKHR(
+    VkDevice                                    device,
+    uint32_t                                    accelerationStructureCount,
+    const VkAccelerationStructureKHR*           pAccelerationStructures,
+    VkQueryType                                 queryType,
+    size_t                                      dataSize,
+    void*                                       pData,
+    size_t                                      stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkWriteAccelerationStructuresPropertiesKHR fp = (PFN_vkWriteAccelerationStructuresPropertiesKHR)loader_resolve_lazy_device_command(table, "vkWriteAccelerationStructuresPropertiesKHR",
+        (PFN_vkVoidFunction *)&table->WriteAccelerationStructuresPropertiesKHR);
+    return fp(device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyAccelerationStructureKHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkCopyAccelerationStructureInfoKHR*   pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyAccelerationStructureKHR fp = (PFN_vkCmdCopyAccelerationStructureKHR)loader_resolve_lazy_device_command(table, "vkCmdCopyAccelerationStructureKHR",
+        (PFN_vkVoidFunction *)&table->CmdCopyAccelerationStructureKHR);
+    fp(commandBuffer, pInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyAccelerationStructureToMemoryKHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkCopyAccelerationStructureToMemoryInfoKHR* pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyAccelerationStructureToMemoryKHR fp = (PFN_vkCmdCopyAccelerationStructureToMemoryKHR)loader_resolve_lazy_device_command(table, "vkCmdCopyAccelerationStructureToMemoryKHR",
+        (PFN_vkVoidFunction *)&table->CmdCopyAccelerationStructureToMemoryKHR);
+    fp(commandBuffer, pInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdCopyMemoryToAccelerationStructureKHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkCopyMemoryToAccelerationStructureInfoKHR* pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdCopyMemoryToAccelerationStructureKHR fp = (PFN_vkCmdCopyMemoryToAccelerationStructureKHR)loader_resolve_lazy_device_command(table, "vkCmdCopyMemoryToAccelerationStructureKHR",
+        (PFN_vkVoidFunction *)&table->CmdCopyMemoryToAccelerationStructureKHR);
+    fp(commandBuffer, pInfo);
+}
+static VKAPI_ATTR VkDeviceAddress VKAPI_CALL loader_lazy_GetAccelerationStructureDeviceAddressKHR(
+    VkDevice                                    device,
+    const VkAccelerationStructureDeviceAddressInfoKHR* pInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetAccelerationStructureDeviceAddressKHR fp = (PFN_vkGetAccelerationStructureDeviceAddressKHR)loader_resolve_lazy_device_command(table, "vkGetAccelerationStructureDeviceAddressKHR",
+        (PFN_vkVoidFunction *)&table->GetAccelerationStructureDeviceAddressKHR);
+    return fp(device, pInfo);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdWriteAccelerationStructuresPropertiesKHR(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    accelerationStructureCount,
+    const VkAccelerationStructureKHR*           pAccelerationStructures,
+    VkQueryType                                 queryType,
+    VkQueryPool                                 queryPool,
+    uint32_t                                    firstQuery) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdWriteAccelerationStructuresPropertiesKHR fp = (PFN_vkCmdWriteAccelerationStructuresPropertiesKHR)loader_resolve_lazy_device_command(table, "vkCmdWriteAccelerationStructuresPropertiesKHR",
+        (PFN_vkVoidFunction *)&table->CmdWriteAccelerationStructuresPropertiesKHR);
+    fp(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetDeviceAccelerationStructureCompatibilityKHR(
+    VkDevice                                    device,
+    const VkAccelerationStructureVersionInfoKHR* pVersionInfo,
+    VkAccelerationStructureCompatibilityKHR*    pCompatibility) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetDeviceAccelerationStructureCompatibilityKHR fp = (PFN_vkGetDeviceAccelerationStructureCompatibilityKHR)loader_resolve_lazy_device_command(table, "vkGetDeviceAccelerationStructureCompatibilityKHR",
+        (PFN_vkVoidFunction *)&table->GetDeviceAccelerationStructureCompatibilityKHR);
+    fp(device, pVersionInfo, pCompatibility);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_GetAccelerationStructureBuildSizesKHR(
+    VkDevice                                    device,
+    VkAccelerationStructureBuildTypeKHR         buildType,
+    const VkAccelerationStructureBuildGeometryInfoKHR* pBuildInfo,
+    const uint32_t*                             pMaxPrimitiveCounts,
+    VkAccelerationStructureBuildSizesInfoKHR*   pSizeInfo) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetAccelerationStructureBuildSizesKHR fp = (PFN_vkGetAccelerationStructureBuildSizesKHR)loader_resolve_lazy_device_command(table, "vkGetAccelerationStructureBuildSizesKHR",
+        (PFN_vkVoidFunction *)&table->GetAccelerationStructureBuildSizesKHR);
+    fp(device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
+}
+
+// ---- VK_KHR_ray_tracing_pipeline extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdTraceRaysKHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkStridedDeviceAddressRegionKHR*      pRaygenShaderBindingTable,
+    const VkStridedDeviceAddressRegionKHR*      pMissShaderBindingTable,
+    const VkStridedDeviceAddressRegionKHR*      pHitShaderBindingTable,
+    const VkStridedDeviceAddressRegionKHR*      pCallableShaderBindingTable,
+    uint32_t                                    width,
+    uint32_t                                    height,
+    uint32_t                                    depth) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdTraceRaysKHR fp = (PFN_vkCmdTraceRaysKHR)loader_resolve_lazy_device_command(table, "vkCmdTraceRaysKHR",
+        (PFN_vkVoidFunction *)&table->CmdTraceRaysKHR);
+    fp(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_CreateRayTracingPipelinesKHR(
+    VkDevice                                    device,
+    VkDeferredOperationKHR                      deferredOperation,
+    VkPipelineCache                             pipelineCache,
+    uint32_t                                    createInfoCount,
+    const VkRayTracingPipelineCreateInfoKHR*    pCreateInfos,
+    const VkAllocationCallbacks*                pAllocator,
+    VkPipeline*                                 pPipelines) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkCreateRayTracingPipelinesKHR fp = (PFN_vkCreateRayTracingPipelinesKHR)loader_resolve_lazy_device_command(table, "vkCreateRayTracingPipelinesKHR",
+        (PFN_vkVoidFunction *)&table->CreateRayTracingPipelinesKHR);
+    return fp(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetRayTracingCaptureReplayShaderGroupHandlesKHR(
+    VkDevice                                    device,
+    VkPipeline                                  pipeline,
+    uint32_t                                    firstGroup,
+    uint32_t                                    groupCount,
+    size_t                                      dataSize,
+    void*                                       pData) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR fp = (PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR)loader_resolve_lazy_device_command(table, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR",
+        (PFN_vkVoidFunction *)&table->GetRayTracingCaptureReplayShaderGroupHandlesKHR);
+    return fp(device, pipeline, firstGroup, groupCount, dataSize, pData);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdTraceRaysIndirectKHR(
+    VkCommandBuffer                             commandBuffer,
+    const VkStridedDeviceAddressRegionKHR*      pRaygenShaderBindingTable,
+    const VkStridedDeviceAddressRegionKHR*      pMissShaderBindingTable,
+    const VkStridedDeviceAddressRegionKHR*      pHitShaderBindingTable,
+    const VkStridedDeviceAddressRegionKHR*      pCallableShaderBindingTable,
+    VkDeviceAddress                             indirectDeviceAddress) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdTraceRaysIndirectKHR fp = (PFN_vkCmdTraceRaysIndirectKHR)loader_resolve_lazy_device_command(table, "vkCmdTraceRaysIndirectKHR",
+        (PFN_vkVoidFunction *)&table->CmdTraceRaysIndirectKHR);
+    fp(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
+}
+static VKAPI_ATTR VkDeviceSize VKAPI_CALL loader_lazy_GetRayTracingShaderGroupStackSizeKHR(
+    VkDevice                                    device,
+    VkPipeline                                  pipeline,
+    uint32_t                                    group,
+    VkShaderGroupShaderKHR                      groupShader) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetRayTracingShaderGroupStackSizeKHR fp = (PFN_vkGetRayTracingShaderGroupStackSizeKHR)loader_resolve_lazy_device_command(table, "vkGetRayTracingShaderGroupStackSizeKHR",
+        (PFN_vkVoidFunction *)&table->GetRayTracingShaderGroupStackSizeKHR);
+    return fp(device, pipeline, group, groupShader);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdSetRayTracingPipelineStackSizeKHR(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    pipelineStackSize) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdSetRayTracingPipelineStackSizeKHR fp = (PFN_vkCmdSetRayTracingPipelineStackSizeKHR)loader_resolve_lazy_device_command(table, "vkCmdSetRayTracingPipelineStackSizeKHR",
+        (PFN_vkVoidFunction *)&table->CmdSetRayTracingPipelineStackSizeKHR);
+    fp(commandBuffer, pipelineStackSize);
+}
+
+// ---- VK_EXT_mesh_shader extension commands
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawMeshTasksEXT(
+    VkCommandBuffer                             commandBuffer,
+    uint32_t                                    groupCountX,
+    uint32_t                                    groupCountY,
+    uint32_t                                    groupCountZ) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawMeshTasksEXT fp = (PFN_vkCmdDrawMeshTasksEXT)loader_resolve_lazy_device_command(table, "vkCmdDrawMeshTasksEXT",
+        (PFN_vkVoidFunction *)&table->CmdDrawMeshTasksEXT);
+    fp(commandBuffer, groupCountX, groupCountY, groupCountZ);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawMeshTasksIndirectEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    uint32_t                                    drawCount,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawMeshTasksIndirectEXT fp = (PFN_vkCmdDrawMeshTasksIndirectEXT)loader_resolve_lazy_device_command(table, "vkCmdDrawMeshTasksIndirectEXT",
+        (PFN_vkVoidFunction *)&table->CmdDrawMeshTasksIndirectEXT);
+    fp(commandBuffer, buffer, offset, drawCount, stride);
+}
+static VKAPI_ATTR void VKAPI_CALL loader_lazy_CmdDrawMeshTasksIndirectCountEXT(
+    VkCommandBuffer                             commandBuffer,
+    VkBuffer                                    buffer,
+    VkDeviceSize                                offset,
+    VkBuffer                                    countBuffer,
+    VkDeviceSize                                countBufferOffset,
+    uint32_t                                    maxDrawCount,
+    uint32_t                                    stride) {
+    VkLayerDispatchTable *table = loader_get_dispatch(commandBuffer);
+    PFN_vkCmdDrawMeshTasksIndirectCountEXT fp = (PFN_vkCmdDrawMeshTasksIndirectCountEXT)loader_resolve_lazy_device_command(table, "vkCmdDrawMeshTasksIndirectCountEXT",
+        (PFN_vkVoidFunction *)&table->CmdDrawMeshTasksIndirectCountEXT);
+    fp(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+}
 
-    // ---- VK_MVK_macos_surface extension commands
-#if defined(VK_USE_PLATFORM_MACOS_MVK)
-    table->CreateMacOSSurfaceMVK = (PFN_vkCreateMacOSSurfaceMVK)gpa(inst, "vkCreateMacOSSurfaceMVK");
-#endif // VK_USE_PLATFORM_MACOS_MVK
+// ---- VK_OHOS_native_buffer extension commands
+#if defined(VK_USE_PLATFORM_OHOS)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetSwapchainGrallocUsageOHOS(
+    VkDevice                                    device,
+    VkFormat                                    format,
+    VkImageUsageFlags                           imageUsage,
+    uint64_t*                                   grallocUsage) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetSwapchainGrallocUsageOHOS fp = (PFN_vkGetSwapchainGrallocUsageOHOS)loader_resolve_lazy_device_command(table, "vkGetSwapchainGrallocUsageOHOS",
+        (PFN_vkVoidFunction *)&table->GetSwapchainGrallocUsageOHOS);
+    return fp(device, format, imageUsage, grallocUsage);
+}
+#endif // VK_USE_PLATFORM_OHOS
+#if defined(VK_USE_PLATFORM_OHOS)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_AcquireImageOHOS(
+    VkDevice                                    device,
+    VkImage                                     image,
+    int32_t                                     nativeFenceFd,
+    VkSemaphore                                 semaphore,
+    VkFence                                     fence) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkAcquireImageOHOS fp = (PFN_vkAcquireImageOHOS)loader_resolve_lazy_device_command(table, "vkAcquireImageOHOS",
+        (PFN_vkVoidFunction *)&table->AcquireImageOHOS);
+    return fp(device, image, nativeFenceFd, semaphore, fence);
+}
+#endif // VK_USE_PLATFORM_OHOS
+#if defined(VK_USE_PLATFORM_OHOS)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_QueueSignalReleaseImageOHOS(
+    VkQueue                                     queue,
+    uint32_t                                    waitSemaphoreCount,
+    const VkSemaphore*                          pWaitSemaphores,
+    VkImage                                     image,
+    int32_t*                                    pNativeFenceFd) {
+    VkLayerDispatchTable *table = loader_get_dispatch(queue);
+    PFN_vkQueueSignalReleaseImageOHOS fp = (PFN_vkQueueSignalReleaseImageOHOS)loader_resolve_lazy_device_command(table, "vkQueueSignalReleaseImageOHOS",
+        (PFN_vkVoidFunction *)&table->QueueSignalReleaseImageOHOS);
+    return fp(queue, waitSemaphoreCount, pWaitSemaphores, image, pNativeFenceFd);
+}
+#endif // VK_USE_PLATFORM_OHOS
 
-    // ---- VK_EXT_debug_utils extension commands
-    table->CreateDebugUtilsMessengerEXT = (PFN_vkCreateDebugUtilsMessengerEXT)gpa(inst, "vkCreateDebugUtilsMessengerEXT");
-    table->DestroyDebugUtilsMessengerEXT = (PFN_vkDestroyDebugUtilsMessengerEXT)gpa(inst, "vkDestroyDebugUtilsMessengerEXT");
-    table->SubmitDebugUtilsMessageEXT = (PFN_vkSubmitDebugUtilsMessageEXT)gpa(inst, "vkSubmitDebugUtilsMessageEXT");
+// ---- VK_OHOS_external_memory extension commands
+#if defined(VK_USE_PLATFORM_OHOS)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetNativeBufferPropertiesOHOS(
+    VkDevice                                    device,
+    const struct OH_NativeBuffer*               buffer,
+    VkNativeBufferPropertiesOHOS*               pProperties) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetNativeBufferPropertiesOHOS fp = (PFN_vkGetNativeBufferPropertiesOHOS)loader_resolve_lazy_device_command(table, "vkGetNativeBufferPropertiesOHOS",
+        (PFN_vkVoidFunction *)&table->GetNativeBufferPropertiesOHOS);
+    return fp(device, buffer, pProperties);
+}
+#endif // VK_USE_PLATFORM_OHOS
+#if defined(VK_USE_PLATFORM_OHOS)
+static VKAPI_ATTR VkResult VKAPI_CALL loader_lazy_GetMemoryNativeBufferOHOS(
+    VkDevice                                    device,
+    const VkMemoryGetNativeBufferInfoOHOS*      pInfo,
+    struct OH_NativeBuffer**                    pBuffer) {
+    VkLayerDispatchTable *table = loader_get_dispatch(device);
+    PFN_vkGetMemoryNativeBufferOHOS fp = (PFN_vkGetMemoryNativeBufferOHOS)loader_resolve_lazy_device_command(table, "vkGetMemoryNativeBufferOHOS",
+        (PFN_vkVoidFunction *)&table->GetMemoryNativeBufferOHOS);
+    return fp(device, pInfo, pBuffer);
+}
+#endif // VK_USE_PLATFORM_OHOS
 
-    // ---- VK_EXT_sample_locations extension commands
-    table->GetPhysicalDeviceMultisamplePropertiesEXT = (PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT)gpa(inst, "vkGetPhysicalDeviceMultisamplePropertiesEXT");
+struct loader_lazy_device_command {
+    const char *name;
+    size_t offset;  // Offset of the command in VkLayerDispatchTable
+    PFN_vkVoidFunction stub;
+};
 
-    // ---- VK_EXT_calibrated_timestamps extension commands
-    table->GetPhysicalDeviceCalibrateableTimeDomainsEXT = (PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT)gpa(inst, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
+static const struct loader_lazy_device_command loader_lazy_device_core_commands[] = {
+    {"vkDestroyDevice", offsetof(VkLayerDispatchTable, DestroyDevice), (PFN_vkVoidFunction)loader_lazy_DestroyDevice},
+    {"vkGetDeviceQueue", offsetof(VkLayerDispatchTable, GetDeviceQueue), (PFN_vkVoidFunction)loader_lazy_GetDeviceQueue},
+    {"vkQueueSubmit", offsetof(VkLayerDispatchTable, QueueSubmit), (PFN_vkVoidFunction)loader_lazy_QueueSubmit},
+    {"vkQueueWaitIdle", offsetof(VkLayerDispatchTable, QueueWaitIdle), (PFN_vkVoidFunction)loader_lazy_QueueWaitIdle},
+    {"vkDeviceWaitIdle", offsetof(VkLayerDispatchTable, DeviceWaitIdle), (PFN_vkVoidFunction)loader_lazy_DeviceWaitIdle},
+    {"vkAllocateMemory", offsetof(VkLayerDispatchTable, AllocateMemory), (PFN_vkVoidFunction)loader_lazy_AllocateMemory},
+    {"vkFreeMemory", offsetof(VkLayerDispatchTable, FreeMemory), (PFN_vkVoidFunction)loader_lazy_FreeMemory},
+    {"vkMapMemory", offsetof(VkLayerDispatchTable, MapMemory), (PFN_vkVoidFunction)loader_lazy_MapMemory},
+    {"vkUnmapMemory", offsetof(VkLayerDispatchTable, UnmapMemory), (PFN_vkVoidFunction)loader_lazy_UnmapMemory},
+    {"vkFlushMappedMemoryRanges", offsetof(VkLayerDispatchTable, FlushMappedMemoryRanges), (PFN_vkVoidFunction)loader_lazy_FlushMappedMemoryRanges},
+    {"vkInvalidateMappedMemoryRanges", offsetof(VkLayerDispatchTable, InvalidateMappedMemoryRanges), (PFN_vkVoidFunction)loader_lazy_InvalidateMappedMemoryRanges},
+    {"vkGetDeviceMemoryCommitment", offsetof(VkLayerDispatchTable, GetDeviceMemoryCommitment), (PFN_vkVoidFunction)loader_lazy_GetDeviceMemoryCommitment},
+    {"vkBindBufferMemory", offsetof(VkLayerDispatchTable, BindBufferMemory), (PFN_vkVoidFunction)loader_lazy_BindBufferMemory},
+    {"vkBindImageMemory", offsetof(VkLayerDispatchTable, BindImageMemory), (PFN_vkVoidFunction)loader_lazy_BindImageMemory},
+    {"vkGetBufferMemoryRequirements", offsetof(VkLayerDispatchTable, GetBufferMemoryRequirements), (PFN_vkVoidFunction)loader_lazy_GetBufferMemoryRequirements},
+    {"vkGetImageMemoryRequirements", offsetof(VkLayerDispatchTable, GetImageMemoryRequirements), (PFN_vkVoidFunction)loader_lazy_GetImageMemoryRequirements},
+    {"vkGetImageSparseMemoryRequirements", offsetof(VkLayerDispatchTable, GetImageSparseMemoryRequirements), (PFN_vkVoidFunction)loader_lazy_GetImageSparseMemoryRequirements},
+    {"vkQueueBindSparse", offsetof(VkLayerDispatchTable, QueueBindSparse), (PFN_vkVoidFunction)loader_lazy_QueueBindSparse},
+    {"vkCreateFence", offsetof(VkLayerDispatchTable, CreateFence), (PFN_vkVoidFunction)loader_lazy_CreateFence},
+    {"vkDestroyFence", offsetof(VkLayerDispatchTable, DestroyFence), (PFN_vkVoidFunction)loader_lazy_DestroyFence},
+    {"vkResetFences", offsetof(VkLayerDispatchTable, ResetFences), (PFN_vkVoidFunction)loader_lazy_ResetFences},
+    {"vkGetFenceStatus", offsetof(VkLayerDispatchTable, GetFenceStatus), (PFN_vkVoidFunction)loader_lazy_GetFenceStatus},
+    {"vkWaitForFences", offsetof(VkLayerDispatchTable, WaitForFences), (PFN_vkVoidFunction)loader_lazy_WaitForFences},
+    {"vkCreateSemaphore", offsetof(VkLayerDispatchTable, CreateSemaphore), (PFN_vkVoidFunction)loader_lazy_CreateSemaphore},
+    {"vkDestroySemaphore", offsetof(VkLayerDispatchTable, DestroySemaphore), (PFN_vkVoidFunction)loader_lazy_DestroySemaphore},
+    {"vkCreateEvent", offsetof(VkLayerDispatchTable, CreateEvent), (PFN_vkVoidFunction)loader_lazy_CreateEvent},
+    {"vkDestroyEvent", offsetof(VkLayerDispatchTable, DestroyEvent), (PFN_vkVoidFunction)loader_lazy_DestroyEvent},
+    {"vkGetEventStatus", offsetof(VkLayerDispatchTable, GetEventStatus), (PFN_vkVoidFunction)loader_lazy_GetEventStatus},
+    {"vkSetEvent", offsetof(VkLayerDispatchTable, SetEvent), (PFN_vkVoidFunction)loader_lazy_SetEvent},
+    {"vkResetEvent", offsetof(VkLayerDispatchTable, ResetEvent), (PFN_vkVoidFunction)loader_lazy_ResetEvent},
+    {"vkCreateQueryPool", offsetof(VkLayerDispatchTable, CreateQueryPool), (PFN_vkVoidFunction)loader_lazy_CreateQueryPool},
+    {"vkDestroyQueryPool", offsetof(VkLayerDispatchTable, DestroyQueryPool), (PFN_vkVoidFunction)loader_lazy_DestroyQueryPool},
+    {"vkGetQueryPoolResults", offsetof(VkLayerDispatchTable, GetQueryPoolResults), (PFN_vkVoidFunction)loader_lazy_GetQueryPoolResults},
+    {"vkCreateBuffer", offsetof(VkLayerDispatchTable, CreateBuffer), (PFN_vkVoidFunction)loader_lazy_CreateBuffer},
+    {"vkDestroyBuffer", offsetof(VkLayerDispatchTable, DestroyBuffer), (PFN_vkVoidFunction)loader_lazy_DestroyBuffer},
+    {"vkCreateBufferView", offsetof(VkLayerDispatchTable, CreateBufferView), (PFN_vkVoidFunction)loader_lazy_CreateBufferView},
+    {"vkDestroyBufferView", offsetof(VkLayerDispatchTable, DestroyBufferView), (PFN_vkVoidFunction)loader_lazy_DestroyBufferView},
+    {"vkCreateImage", offsetof(VkLayerDispatchTable, CreateImage), (PFN_vkVoidFunction)loader_lazy_CreateImage},
+    {"vkDestroyImage", offsetof(VkLayerDispatchTable, DestroyImage), (PFN_vkVoidFunction)loader_lazy_DestroyImage},
+    {"vkGetImageSubresourceLayout", offsetof(VkLayerDispatchTable, GetImageSubresourceLayout), (PFN_vkVoidFunction)loader_lazy_GetImageSubresourceLayout},
+    {"vkCreateImageView", offsetof(VkLayerDispatchTable, CreateImageView), (PFN_vkVoidFunction)loader_lazy_CreateImageView},
+    {"vkDestroyImageView", offsetof(VkLayerDispatchTable, DestroyImageView), (PFN_vkVoidFunction)loader_lazy_DestroyImageView},
+    {"vkCreateShaderModule", offsetof(VkLayerDispatchTable, CreateShaderModule), (PFN_vkVoidFunction)loader_lazy_CreateShaderModule},
+    {"vkDestroyShaderModule", offsetof(VkLayerDispatchTable, DestroyShaderModule), (PFN_vkVoidFunction)loader_lazy_DestroyShaderModule},
+    {"vkCreatePipelineCache", offsetof(VkLayerDispatchTable, CreatePipelineCache), (PFN_vkVoidFunction)loader_lazy_CreatePipelineCache},
+    {"vkDestroyPipelineCache", offsetof(VkLayerDispatchTable, DestroyPipelineCache), (PFN_vkVoidFunction)loader_lazy_DestroyPipelineCache},
+    {"vkGetPipelineCacheData", offsetof(VkLayerDispatchTable, GetPipelineCacheData), (PFN_vkVoidFunction)loader_lazy_GetPipelineCacheData},
+    {"vkMergePipelineCaches", offsetof(VkLayerDispatchTable, MergePipelineCaches), (PFN_vkVoidFunction)loader_lazy_MergePipelineCaches},
+    {"vkCreateGraphicsPipelines", offsetof(VkLayerDispatchTable, CreateGraphicsPipelines), (PFN_vkVoidFunction)loader_lazy_CreateGraphicsPipelines},
+    {"vkCreateComputePipelines", offsetof(VkLayerDispatchTable, CreateComputePipelines), (PFN_vkVoidFunction)loader_lazy_CreateComputePipelines},
+    {"vkDestroyPipeline", offsetof(VkLayerDispatchTable, DestroyPipeline), (PFN_vkVoidFunction)loader_lazy_DestroyPipeline},
+    {"vkCreatePipelineLayout", offsetof(VkLayerDispatchTable, CreatePipelineLayout), (PFN_vkVoidFunction)loader_lazy_CreatePipelineLayout},
+    {"vkDestroyPipelineLayout", offsetof(VkLayerDispatchTable, DestroyPipelineLayout), (PFN_vkVoidFunction)loader_lazy_DestroyPipelineLayout},
+    {"vkCreateSampler", offsetof(VkLayerDispatchTable, CreateSampler), (PFN_vkVoidFunction)loader_lazy_CreateSampler},
+    {"vkDestroySampler", offsetof(VkLayerDispatchTable, DestroySampler), (PFN_vkVoidFunction)loader_lazy_DestroySampler},
+    {"vkCreateDescriptorSetLayout", offsetof(VkLayerDispatchTable, CreateDescriptorSetLayout), (PFN_vkVoidFunction)loader_lazy_CreateDescriptorSetLayout},
+    {"vkDestroyDescriptorSetLayout", offsetof(VkLayerDispatchTable, DestroyDescriptorSetLayout), (PFN_vkVoidFunction)loader_lazy_DestroyDescriptorSetLayout},
+    {"vkCreateDescriptorPool", offsetof(VkLayerDispatchTable, CreateDescriptorPool), (PFN_vkVoidFunction)loader_lazy_CreateDescriptorPool},
+    {"vkDestroyDescriptorPool", offsetof(VkLayerDispatchTable, DestroyDescriptorPool), (PFN_vkVoidFunction)loader_lazy_DestroyDescriptorPool},
+    {"vkResetDescriptorPool", offsetof(VkLayerDispatchTable, ResetDescriptorPool), (PFN_vkVoidFunction)loader_lazy_ResetDescriptorPool},
+    {"vkAllocateDescriptorSets", offsetof(VkLayerDispatchTable, AllocateDescriptorSets), (PFN_vkVoidFunction)loader_lazy_AllocateDescriptorSets},
+    {"vkFreeDescriptorSets", offsetof(VkLayerDispatchTable, FreeDescriptorSets), (PFN_vkVoidFunction)loader_lazy_FreeDescriptorSets},
+    {"vkUpdateDescriptorSets", offsetof(VkLayerDispatchTable, UpdateDescriptorSets), (PFN_vkVoidFunction)loader_lazy_UpdateDescriptorSets},
+    {"vkCreateFramebuffer", offsetof(VkLayerDispatchTable, CreateFramebuffer), (PFN_vkVoidFunction)loader_lazy_CreateFramebuffer},
+    {"vkDestroyFramebuffer", offsetof(VkLayerDispatchTable, DestroyFramebuffer), (PFN_vkVoidFunction)loader_lazy_DestroyFramebuffer},
+    {"vkCreateRenderPass", offsetof(VkLayerDispatchTable, CreateRenderPass), (PFN_vkVoidFunction)loader_lazy_CreateRenderPass},
+    {"vkDestroyRenderPass", offsetof(VkLayerDispatchTable, DestroyRenderPass), (PFN_vkVoidFunction)loader_lazy_DestroyRenderPass},
+    {"vkGetRenderAreaGranularity", offsetof(VkLayerDispatchTable, GetRenderAreaGranularity), (PFN_vkVoidFunction)loader_lazy_GetRenderAreaGranularity},
+    {"vkCreateCommandPool", offsetof(VkLayerDispatchTable, CreateCommandPool), (PFN_vkVoidFunction)loader_lazy_CreateCommandPool},
+    {"vkDestroyCommandPool", offsetof(VkLayerDispatchTable, DestroyCommandPool), (PFN_vkVoidFunction)loader_lazy_DestroyCommandPool},
+    {"vkResetCommandPool", offsetof(VkLayerDispatchTable, ResetCommandPool), (PFN_vkVoidFunction)loader_lazy_ResetCommandPool},
+    {"vkAllocateCommandBuffers", offsetof(VkLayerDispatchTable, AllocateCommandBuffers), (PFN_vkVoidFunction)loader_lazy_AllocateCommandBuffers},
+    {"vkFreeCommandBuffers", offsetof(VkLayerDispatchTable, FreeCommandBuffers), (PFN_vkVoidFunction)loader_lazy_FreeCommandBuffers},
+    {"vkBeginCommandBuffer", offsetof(VkLayerDispatchTable, BeginCommandBuffer), (PFN_vkVoidFunction)loader_lazy_BeginCommandBuffer},
+    {"vkEndCommandBuffer", offsetof(VkLayerDispatchTable, EndCommandBuffer), (PFN_vkVoidFunction)loader_lazy_EndCommandBuffer},
+    {"vkResetCommandBuffer", offsetof(VkLayerDispatchTable, ResetCommandBuffer), (PFN_vkVoidFunction)loader_lazy_ResetCommandBuffer},
+    {"vkCmdBindPipeline", offsetof(VkLayerDispatchTable, CmdBindPipeline), (PFN_vkVoidFunction)loader_lazy_CmdBindPipeline},
+    {"vkCmdSetViewport", offsetof(VkLayerDispatchTable, CmdSetViewport), (PFN_vkVoidFunction)loader_lazy_CmdSetViewport},
+    {"vkCmdSetScissor", offsetof(VkLayerDispatchTable, CmdSetScissor), (PFN_vkVoidFunction)loader_lazy_CmdSetScissor},
+    {"vkCmdSetLineWidth", offsetof(VkLayerDispatchTable, CmdSetLineWidth), (PFN_vkVoidFunction)loader_lazy_CmdSetLineWidth},
+    {"vkCmdSetDepthBias", offsetof(VkLayerDispatchTable, CmdSetDepthBias), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthBias},
+    {"vkCmdSetBlendConstants", offsetof(VkLayerDispatchTable, CmdSetBlendConstants), (PFN_vkVoidFunction)loader_lazy_CmdSetBlendConstants},
+    {"vkCmdSetDepthBounds", offsetof(VkLayerDispatchTable, CmdSetDepthBounds), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthBounds},
+    {"vkCmdSetStencilCompareMask", offsetof(VkLayerDispatchTable, CmdSetStencilCompareMask), (PFN_vkVoidFunction)loader_lazy_CmdSetStencilCompareMask},
+    {"vkCmdSetStencilWriteMask", offsetof(VkLayerDispatchTable, CmdSetStencilWriteMask), (PFN_vkVoidFunction)loader_lazy_CmdSetStencilWriteMask},
+    {"vkCmdSetStencilReference", offsetof(VkLayerDispatchTable, CmdSetStencilReference), (PFN_vkVoidFunction)loader_lazy_CmdSetStencilReference},
+    {"vkCmdBindDescriptorSets", offsetof(VkLayerDispatchTable, CmdBindDescriptorSets), (PFN_vkVoidFunction)loader_lazy_CmdBindDescriptorSets},
+    {"vkCmdBindIndexBuffer", offsetof(VkLayerDispatchTable, CmdBindIndexBuffer), (PFN_vkVoidFunction)loader_lazy_CmdBindIndexBuffer},
+    {"vkCmdBindVertexBuffers", offsetof(VkLayerDispatchTable, CmdBindVertexBuffers), (PFN_vkVoidFunction)loader_lazy_CmdBindVertexBuffers},
+    {"vkCmdDraw", offsetof(VkLayerDispatchTable, CmdDraw), (PFN_vkVoidFunction)loader_lazy_CmdDraw},
+    {"vkCmdDrawIndexed", offsetof(VkLayerDispatchTable, CmdDrawIndexed), (PFN_vkVoidFunction)loader_lazy_CmdDrawIndexed},
+    {"vkCmdDrawIndirect", offsetof(VkLayerDispatchTable, CmdDrawIndirect), (PFN_vkVoidFunction)loader_lazy_CmdDrawIndirect},
+    {"vkCmdDrawIndexedIndirect", offsetof(VkLayerDispatchTable, CmdDrawIndexedIndirect), (PFN_vkVoidFunction)loader_lazy_CmdDrawIndexedIndirect},
+    {"vkCmdDispatch", offsetof(VkLayerDispatchTable, CmdDispatch), (PFN_vkVoidFunction)loader_lazy_CmdDispatch},
+    {"vkCmdDispatchIndirect", offsetof(VkLayerDispatchTable, CmdDispatchIndirect), (PFN_vkVoidFunction)loader_lazy_CmdDispatchIndirect},
+    {"vkCmdCopyBuffer", offsetof(VkLayerDispatchTable, CmdCopyBuffer), (PFN_vkVoidFunction)loader_lazy_CmdCopyBuffer},
+    {"vkCmdCopyImage", offsetof(VkLayerDispatchTable, CmdCopyImage), (PFN_vkVoidFunction)loader_lazy_CmdCopyImage},
+    {"vkCmdBlitImage", offsetof(VkLayerDispatchTable, CmdBlitImage), (PFN_vkVoidFunction)loader_lazy_CmdBlitImage},
+    {"vkCmdCopyBufferToImage", offsetof(VkLayerDispatchTable, CmdCopyBufferToImage), (PFN_vkVoidFunction)loader_lazy_CmdCopyBufferToImage},
+    {"vkCmdCopyImageToBuffer", offsetof(VkLayerDispatchTable, CmdCopyImageToBuffer), (PFN_vkVoidFunction)loader_lazy_CmdCopyImageToBuffer},
+    {"vkCmdUpdateBuffer", offsetof(VkLayerDispatchTable, CmdUpdateBuffer), (PFN_vkVoidFunction)loader_lazy_CmdUpdateBuffer},
+    {"vkCmdFillBuffer", offsetof(VkLayerDispatchTable, CmdFillBuffer), (PFN_vkVoidFunction)loader_lazy_CmdFillBuffer},
+    {"vkCmdClearColorImage", offsetof(VkLayerDispatchTable, CmdClearColorImage), (PFN_vkVoidFunction)loader_lazy_CmdClearColorImage},
+    {"vkCmdClearDepthStencilImage", offsetof(VkLayerDispatchTable, CmdClearDepthStencilImage), (PFN_vkVoidFunction)loader_lazy_CmdClearDepthStencilImage},
+    {"vkCmdClearAttachments", offsetof(VkLayerDispatchTable, CmdClearAttachments), (PFN_vkVoidFunction)loader_lazy_CmdClearAttachments},
+    {"vkCmdResolveImage", offsetof(VkLayerDispatchTable, CmdResolveImage), (PFN_vkVoidFunction)loader_lazy_CmdResolveImage},
+    {"vkCmdSetEvent", offsetof(VkLayerDispatchTable, CmdSetEvent), (PFN_vkVoidFunction)loader_lazy_CmdSetEvent},
+    {"vkCmdResetEvent", offsetof(VkLayerDispatchTable, CmdResetEvent), (PFN_vkVoidFunction)loader_lazy_CmdResetEvent},
+    {"vkCmdWaitEvents", offsetof(VkLayerDispatchTable, CmdWaitEvents), (PFN_vkVoidFunction)loader_lazy_CmdWaitEvents},
+    {"vkCmdPipelineBarrier", offsetof(VkLayerDispatchTable, CmdPipelineBarrier), (PFN_vkVoidFunction)loader_lazy_CmdPipelineBarrier},
+    {"vkCmdBeginQuery", offsetof(VkLayerDispatchTable, CmdBeginQuery), (PFN_vkVoidFunction)loader_lazy_CmdBeginQuery},
+    {"vkCmdEndQuery", offsetof(VkLayerDispatchTable, CmdEndQuery), (PFN_vkVoidFunction)loader_lazy_CmdEndQuery},
+    {"vkCmdResetQueryPool", offsetof(VkLayerDispatchTable, CmdResetQueryPool), (PFN_vkVoidFunction)loader_lazy_CmdResetQueryPool},
+    {"vkCmdWriteTimestamp", offsetof(VkLayerDispatchTable, CmdWriteTimestamp), (PFN_vkVoidFunction)loader_lazy_CmdWriteTimestamp},
+    {"vkCmdCopyQueryPoolResults", offsetof(VkLayerDispatchTable, CmdCopyQueryPoolResults), (PFN_vkVoidFunction)loader_lazy_CmdCopyQueryPoolResults},
+    {"vkCmdPushConstants", offsetof(VkLayerDispatchTable, CmdPushConstants), (PFN_vkVoidFunction)loader_lazy_CmdPushConstants},
+    {"vkCmdBeginRenderPass", offsetof(VkLayerDispatchTable, CmdBeginRenderPass), (PFN_vkVoidFunction)loader_lazy_CmdBeginRenderPass},
+    {"vkCmdNextSubpass", offsetof(VkLayerDispatchTable, CmdNextSubpass), (PFN_vkVoidFunction)loader_lazy_CmdNextSubpass},
+    {"vkCmdEndRenderPass", offsetof(VkLayerDispatchTable, CmdEndRenderPass), (PFN_vkVoidFunction)loader_lazy_CmdEndRenderPass},
+    {"vkCmdExecuteCommands", offsetof(VkLayerDispatchTable, CmdExecuteCommands), (PFN_vkVoidFunction)loader_lazy_CmdExecuteCommands},
+    {"vkBindBufferMemory2", offsetof(VkLayerDispatchTable, BindBufferMemory2), (PFN_vkVoidFunction)loader_lazy_BindBufferMemory2},
+    {"vkBindImageMemory2", offsetof(VkLayerDispatchTable, BindImageMemory2), (PFN_vkVoidFunction)loader_lazy_BindImageMemory2},
+    {"vkGetDeviceGroupPeerMemoryFeatures", offsetof(VkLayerDispatchTable, GetDeviceGroupPeerMemoryFeatures), (PFN_vkVoidFunction)loader_lazy_GetDeviceGroupPeerMemoryFeatures},
+    {"vkCmdSetDeviceMask", offsetof(VkLayerDispatchTable, CmdSetDeviceMask), (PFN_vkVoidFunction)loader_lazy_CmdSetDeviceMask},
+    {"vkCmdDispatchBase", offsetof(VkLayerDispatchTable, CmdDispatchBase), (PFN_vkVoidFunction)loader_lazy_CmdDispatchBase},
+    {"vkGetImageMemoryRequirements2", offsetof(VkLayerDispatchTable, GetImageMemoryRequirements2), (PFN_vkVoidFunction)loader_lazy_GetImageMemoryRequirements2},
+    {"vkGetBufferMemoryRequirements2", offsetof(VkLayerDispatchTable, GetBufferMemoryRequirements2), (PFN_vkVoidFunction)loader_lazy_GetBufferMemoryRequirements2},
+    {"vkGetImageSparseMemoryRequirements2", offsetof(VkLayerDispatchTable, GetImageSparseMemoryRequirements2), (PFN_vkVoidFunction)loader_lazy_GetImageSparseMemoryRequirements2},
+    {"vkTrimCommandPool", offsetof(VkLayerDispatchTable, TrimCommandPool), (PFN_vkVoidFunction)loader_lazy_TrimCommandPool},
+    {"vkGetDeviceQueue2", offsetof(VkLayerDispatchTable, GetDeviceQueue2), (PFN_vkVoidFunction)loader_lazy_GetDeviceQueue2},
+    {"vkCreateSamplerYcbcrConversion", offsetof(VkLayerDispatchTable, CreateSamplerYcbcrConversion), (PFN_vkVoidFunction)loader_lazy_CreateSamplerYcbcrConversion},
+    {"vkDestroySamplerYcbcrConversion", offsetof(VkLayerDispatchTable, DestroySamplerYcbcrConversion), (PFN_vkVoidFunction)loader_lazy_DestroySamplerYcbcrConversion},
+    {"vkCreateDescriptorUpdateTemplate", offsetof(VkLayerDispatchTable, CreateDescriptorUpdateTemplate), (PFN_vkVoidFunction)loader_lazy_CreateDescriptorUpdateTemplate},
+    {"vkDestroyDescriptorUpdateTemplate", offsetof(VkLayerDispatchTable, DestroyDescriptorUpdateTemplate), (PFN_vkVoidFunction)loader_lazy_DestroyDescriptorUpdateTemplate},
+    {"vkUpdateDescriptorSetWithTemplate", offsetof(VkLayerDispatchTable, UpdateDescriptorSetWithTemplate), (PFN_vkVoidFunction)loader_lazy_UpdateDescriptorSetWithTemplate},
+    {"vkGetDescriptorSetLayoutSupport", offsetof(VkLayerDispatchTable, GetDescriptorSetLayoutSupport), (PFN_vkVoidFunction)loader_lazy_GetDescriptorSetLayoutSupport},
+    {"vkCmdDrawIndirectCount", offsetof(VkLayerDispatchTable, CmdDrawIndirectCount), (PFN_vkVoidFunction)loader_lazy_CmdDrawIndirectCount},
+    {"vkCmdDrawIndexedIndirectCount", offsetof(VkLayerDispatchTable, CmdDrawIndexedIndirectCount), (PFN_vkVoidFunction)loader_lazy_CmdDrawIndexedIndirectCount},
+    {"vkCreateRenderPass2", offsetof(VkLayerDispatchTable, CreateRenderPass2), (PFN_vkVoidFunction)loader_lazy_CreateRenderPass2},
+    {"vkCmdBeginRenderPass2", offsetof(VkLayerDispatchTable, CmdBeginRenderPass2), (PFN_vkVoidFunction)loader_lazy_CmdBeginRenderPass2},
+    {"vkCmdNextSubpass2", offsetof(VkLayerDispatchTable, CmdNextSubpass2), (PFN_vkVoidFunction)loader_lazy_CmdNextSubpass2},
+    {"vkCmdEndRenderPass2", offsetof(VkLayerDispatchTable, CmdEndRenderPass2), (PFN_vkVoidFunction)loader_lazy_CmdEndRenderPass2},
+    {"vkResetQueryPool", offsetof(VkLayerDispatchTable, ResetQueryPool), (PFN_vkVoidFunction)loader_lazy_ResetQueryPool},
+    {"vkGetSemaphoreCounterValue", offsetof(VkLayerDispatchTable, GetSemaphoreCounterValue), (PFN_vkVoidFunction)loader_lazy_GetSemaphoreCounterValue},
+    {"vkWaitSemaphores", offsetof(VkLayerDispatchTable, WaitSemaphores), (PFN_vkVoidFunction)loader_lazy_WaitSemaphores},
+    {"vkSignalSemaphore", offsetof(VkLayerDispatchTable, SignalSemaphore), (PFN_vkVoidFunction)loader_lazy_SignalSemaphore},
+    {"vkGetBufferDeviceAddress", offsetof(VkLayerDispatchTable, GetBufferDeviceAddress), (PFN_vkVoidFunction)loader_lazy_GetBufferDeviceAddress},
+    {"vkGetBufferOpaqueCaptureAddress", offsetof(VkLayerDispatchTable, GetBufferOpaqueCaptureAddress), (PFN_vkVoidFunction)loader_lazy_GetBufferOpaqueCaptureAddress},
+    {"vkGetDeviceMemoryOpaqueCaptureAddress", offsetof(VkLayerDispatchTable, GetDeviceMemoryOpaqueCaptureAddress), (PFN_vkVoidFunction)loader_lazy_GetDeviceMemoryOpaqueCaptureAddress},
+    {"vkCreatePrivateDataSlot", offsetof(VkLayerDispatchTable, CreatePrivateDataSlot), (PFN_vkVoidFunction)loader_lazy_CreatePrivateDataSlot},
+    {"vkDestroyPrivateDataSlot", offsetof(VkLayerDispatchTable, DestroyPrivateDataSlot), (PFN_vkVoidFunction)loader_lazy_DestroyPrivateDataSlot},
+    {"vkSetPrivateData", offsetof(VkLayerDispatchTable, SetPrivateData), (PFN_vkVoidFunction)loader_lazy_SetPrivateData},
+    {"vkGetPrivateData", offsetof(VkLayerDispatchTable, GetPrivateData), (PFN_vkVoidFunction)loader_lazy_GetPrivateData},
+    {"vkCmdSetEvent2", offsetof(VkLayerDispatchTable, CmdSetEvent2), (PFN_vkVoidFunction)loader_lazy_CmdSetEvent2},
+    {"vkCmdResetEvent2", offsetof(VkLayerDispatchTable, CmdResetEvent2), (PFN_vkVoidFunction)loader_lazy_CmdResetEvent2},
+    {"vkCmdWaitEvents2", offsetof(VkLayerDispatchTable, CmdWaitEvents2), (PFN_vkVoidFunction)loader_lazy_CmdWaitEvents2},
+    {"vkCmdPipelineBarrier2", offsetof(VkLayerDispatchTable, CmdPipelineBarrier2), (PFN_vkVoidFunction)loader_lazy_CmdPipelineBarrier2},
+    {"vkCmdWriteTimestamp2", offsetof(VkLayerDispatchTable, CmdWriteTimestamp2), (PFN_vkVoidFunction)loader_lazy_CmdWriteTimestamp2},
+    {"vkQueueSubmit2", offsetof(VkLayerDispatchTable, QueueSubmit2), (PFN_vkVoidFunction)loader_lazy_QueueSubmit2},
+    {"vkCmdCopyBuffer2", offsetof(VkLayerDispatchTable, CmdCopyBuffer2), (PFN_vkVoidFunction)loader_lazy_CmdCopyBuffer2},
+    {"vkCmdCopyImage2", offsetof(VkLayerDispatchTable, CmdCopyImage2), (PFN_vkVoidFunction)loader_lazy_CmdCopyImage2},
+    {"vkCmdCopyBufferToImage2", offsetof(VkLayerDispatchTable, CmdCopyBufferToImage2), (PFN_vkVoidFunction)loader_lazy_CmdCopyBufferToImage2},
+    {"vkCmdCopyImageToBuffer2", offsetof(VkLayerDispatchTable, CmdCopyImageToBuffer2), (PFN_vkVoidFunction)loader_lazy_CmdCopyImageToBuffer2},
+    {"vkCmdBlitImage2", offsetof(VkLayerDispatchTable, CmdBlitImage2), (PFN_vkVoidFunction)loader_lazy_CmdBlitImage2},
+    {"vkCmdResolveImage2", offsetof(VkLayerDispatchTable, CmdResolveImage2), (PFN_vkVoidFunction)loader_lazy_CmdResolveImage2},
+    {"vkCmdBeginRendering", offsetof(VkLayerDispatchTable, CmdBeginRendering), (PFN_vkVoidFunction)loader_lazy_CmdBeginRendering},
+    {"vkCmdEndRendering", offsetof(VkLayerDispatchTable, CmdEndRendering), (PFN_vkVoidFunction)loader_lazy_CmdEndRendering},
+    {"vkCmdSetCullMode", offsetof(VkLayerDispatchTable, CmdSetCullMode), (PFN_vkVoidFunction)loader_lazy_CmdSetCullMode},
+    {"vkCmdSetFrontFace", offsetof(VkLayerDispatchTable, CmdSetFrontFace), (PFN_vkVoidFunction)loader_lazy_CmdSetFrontFace},
+    {"vkCmdSetPrimitiveTopology", offsetof(VkLayerDispatchTable, CmdSetPrimitiveTopology), (PFN_vkVoidFunction)loader_lazy_CmdSetPrimitiveTopology},
+    {"vkCmdSetViewportWithCount", offsetof(VkLayerDispatchTable, CmdSetViewportWithCount), (PFN_vkVoidFunction)loader_lazy_CmdSetViewportWithCount},
+    {"vkCmdSetScissorWithCount", offsetof(VkLayerDispatchTable, CmdSetScissorWithCount), (PFN_vkVoidFunction)loader_lazy_CmdSetScissorWithCount},
+    {"vkCmdBindVertexBuffers2", offsetof(VkLayerDispatchTable, CmdBindVertexBuffers2), (PFN_vkVoidFunction)loader_lazy_CmdBindVertexBuffers2},
+    {"vkCmdSetDepthTestEnable", offsetof(VkLayerDispatchTable, CmdSetDepthTestEnable), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthTestEnable},
+    {"vkCmdSetDepthWriteEnable", offsetof(VkLayerDispatchTable, CmdSetDepthWriteEnable), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthWriteEnable},
+    {"vkCmdSetDepthCompareOp", offsetof(VkLayerDispatchTable, CmdSetDepthCompareOp), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthCompareOp},
+    {"vkCmdSetDepthBoundsTestEnable", offsetof(VkLayerDispatchTable, CmdSetDepthBoundsTestEnable), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthBoundsTestEnable},
+    {"vkCmdSetStencilTestEnable", offsetof(VkLayerDispatchTable, CmdSetStencilTestEnable), (PFN_vkVoidFunction)loader_lazy_CmdSetStencilTestEnable},
+    {"vkCmdSetStencilOp", offsetof(VkLayerDispatchTable, CmdSetStencilOp), (PFN_vkVoidFunction)loader_lazy_CmdSetStencilOp},
+    {"vkCmdSetRasterizerDiscardEnable", offsetof(VkLayerDispatchTable, CmdSetRasterizerDiscardEnable), (PFN_vkVoidFunction)loader_lazy_CmdSetRasterizerDiscardEnable},
+    {"vkCmdSetDepthBiasEnable", offsetof(VkLayerDispatchTable, CmdSetDepthBiasEnable), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthBiasEnable},
+    {"vkCmdSetPrimitiveRestartEnable", offsetof(VkLayerDispatchTable, CmdSetPrimitiveRestartEnable), (PFN_vkVoidFunction)loader_lazy_CmdSetPrimitiveRestartEnable},
+    {"vkGetDeviceBufferMemoryRequirements", offsetof(VkLayerDispatchTable, GetDeviceBufferMemoryRequirements), (PFN_vkVoidFunction)loader_lazy_GetDeviceBufferMemoryRequirements},
+    {"vkGetDeviceImageMemoryRequirements", offsetof(VkLayerDispatchTable, GetDeviceImageMemoryRequirements), (PFN_vkVoidFunction)loader_lazy_GetDeviceImageMemoryRequirements},
+    {"vkGetDeviceImageSparseMemoryRequirements", offsetof(VkLayerDispatchTable, GetDeviceImageSparseMemoryRequirements), (PFN_vkVoidFunction)loader_lazy_GetDeviceImageSparseMemoryRequirements},
+    {"vkCmdSetLineStipple", offsetof(VkLayerDispatchTable, CmdSetLineStipple), (PFN_vkVoidFunction)loader_lazy_CmdSetLineStipple},
+    {"vkMapMemory2", offsetof(VkLayerDispatchTable, MapMemory2), (PFN_vkVoidFunction)loader_lazy_MapMemory2},
+    {"vkUnmapMemory2", offsetof(VkLayerDispatchTable, UnmapMemory2), (PFN_vkVoidFunction)loader_lazy_UnmapMemory2},
+    {"vkCmdBindIndexBuffer2", offsetof(VkLayerDispatchTable, CmdBindIndexBuffer2), (PFN_vkVoidFunction)loader_lazy_CmdBindIndexBuffer2},
+    {"vkGetRenderingAreaGranularity", offsetof(VkLayerDispatchTable, GetRenderingAreaGranularity), (PFN_vkVoidFunction)loader_lazy_GetRenderingAreaGranularity},
+    {"vkGetDeviceImageSubresourceLayout", offsetof(VkLayerDispatchTable, GetDeviceImageSubresourceLayout), (PFN_vkVoidFunction)loader_lazy_GetDeviceImageSubresourceLayout},
+    {"vkGetImageSubresourceLayout2", offsetof(VkLayerDispatchTable, GetImageSubresourceLayout2), (PFN_vkVoidFunction)loader_lazy_GetImageSubresourceLayout2},
+    {"vkCmdPushDescriptorSet", offsetof(VkLayerDispatchTable, CmdPushDescriptorSet), (PFN_vkVoidFunction)loader_lazy_CmdPushDescriptorSet},
+    {"vkCmdPushDescriptorSetWithTemplate", offsetof(VkLayerDispatchTable, CmdPushDescriptorSetWithTemplate), (PFN_vkVoidFunction)loader_lazy_CmdPushDescriptorSetWithTemplate},
+    {"vkCmdSetRenderingAttachmentLocations", offsetof(VkLayerDispatchTable, CmdSetRenderingAttachmentLocations), (PFN_vkVoidFunction)loader_lazy_CmdSetRenderingAttachmentLocations},
+    {"vkCmdSetRenderingInputAttachmentIndices", offsetof(VkLayerDispatchTable, CmdSetRenderingInputAttachmentIndices), (PFN_vkVoidFunction)loader_lazy_CmdSetRenderingInputAttachmentIndices},
+    {"vkCmdBindDescriptorSets2", offsetof(VkLayerDispatchTable, CmdBindDescriptorSets2), (PFN_vkVoidFunction)loader_lazy_CmdBindDescriptorSets2},
+    {"vkCmdPushConstants2", offsetof(VkLayerDispatchTable, CmdPushConstants2), (PFN_vkVoidFunction)loader_lazy_CmdPushConstants2},
+    {"vkCmdPushDescriptorSet2", offsetof(VkLayerDispatchTable, CmdPushDescriptorSet2), (PFN_vkVoidFunction)loader_lazy_CmdPushDescriptorSet2},
+    {"vkCmdPushDescriptorSetWithTemplate2", offsetof(VkLayerDispatchTable, CmdPushDescriptorSetWithTemplate2), (PFN_vkVoidFunction)loader_lazy_CmdPushDescriptorSetWithTemplate2},
+    {"vkCopyMemoryToImage", offsetof(VkLayerDispatchTable, CopyMemoryToImage), (PFN_vkVoidFunction)loader_lazy_CopyMemoryToImage},
+    {"vkCopyImageToMemory", offsetof(VkLayerDispatchTable, CopyImageToMemory), (PFN_vkVoidFunction)loader_lazy_CopyImageToMemory},
+    {"vkCopyImageToImage", offsetof(VkLayerDispatchTable, CopyImageToImage), (PFN_vkVoidFunction)loader_lazy_CopyImageToImage},
+    {"vkTransitionImageLayout", offsetof(VkLayerDispatchTable, TransitionImageLayout), (PFN_vkVoidFunction)loader_lazy_TransitionImageLayout},
+};
 
-    // ---- VK_FUCHSIA_imagepipe_surface extension commands
+static const struct loader_lazy_device_command loader_lazy_device_extension_commands[] = {
+    {"vkDestroySwapchainKHR", offsetof(VkLayerDispatchTable, DestroySwapchainKHR), (PFN_vkVoidFunction)loader_lazy_DestroySwapchainKHR},
+    {"vkGetSwapchainImagesKHR", offsetof(VkLayerDispatchTable, GetSwapchainImagesKHR), (PFN_vkVoidFunction)loader_lazy_GetSwapchainImagesKHR},
+    {"vkAcquireNextImageKHR", offsetof(VkLayerDispatchTable, AcquireNextImageKHR), (PFN_vkVoidFunction)loader_lazy_AcquireNextImageKHR},
+    {"vkQueuePresentKHR", offsetof(VkLayerDispatchTable, QueuePresentKHR), (PFN_vkVoidFunction)loader_lazy_QueuePresentKHR},
+    {"vkGetDeviceGroupPresentCapabilitiesKHR", offsetof(VkLayerDispatchTable, GetDeviceGroupPresentCapabilitiesKHR), (PFN_vkVoidFunction)loader_lazy_GetDeviceGroupPresentCapabilitiesKHR},
+    {"vkGetDeviceGroupSurfacePresentModesKHR", offsetof(VkLayerDispatchTable, GetDeviceGroupSurfacePresentModesKHR), (PFN_vkVoidFunction)loader_lazy_GetDeviceGroupSurfacePresentModesKHR},
+    {"vkAcquireNextImage2KHR", offsetof(VkLayerDispatchTable, AcquireNextImage2KHR), (PFN_vkVoidFunction)loader_lazy_AcquireNextImage2KHR},
+    {"vkCreateSharedSwapchainsKHR", offsetof(VkLayerDispatchTable, CreateSharedSwapchainsKHR), (PFN_vkVoidFunction)loader_lazy_CreateSharedSwapchainsKHR},
+    {"vkCreateVideoSessionKHR", offsetof(VkLayerDispatchTable, CreateVideoSessionKHR), (PFN_vkVoidFunction)loader_lazy_CreateVideoSessionKHR},
+    {"vkDestroyVideoSessionKHR", offsetof(VkLayerDispatchTable, DestroyVideoSessionKHR), (PFN_vkVoidFunction)loader_lazy_DestroyVideoSessionKHR},
+    {"vkGetVideoSessionMemoryRequirementsKHR", offsetof(VkLayerDispatchTable, GetVideoSessionMemoryRequirementsKHR), (PFN_vkVoidFunction)loader_lazy_GetVideoSessionMemoryRequirementsKHR},
+    {"vkBindVideoSessionMemoryKHR", offsetof(VkLayerDispatchTable, BindVideoSessionMemoryKHR), (PFN_vkVoidFunction)loader_lazy_BindVideoSessionMemoryKHR},
+    {"vkCreateVideoSessionParametersKHR", offsetof(VkLayerDispatchTable, CreateVideoSessionParametersKHR), (PFN_vkVoidFunction)loader_lazy_CreateVideoSessionParametersKHR},
+    {"vkUpdateVideoSessionParametersKHR", offsetof(VkLayerDispatchTable, UpdateVideoSessionParametersKHR), (PFN_vkVoidFunction)loader_lazy_UpdateVideoSessionParametersKHR},
+    {"vkDestroyVideoSessionParametersKHR", offsetof(VkLayerDispatchTable, DestroyVideoSessionParametersKHR), (PFN_vkVoidFunction)loader_lazy_DestroyVideoSessionParametersKHR},
+    {"vkCmdBeginVideoCodingKHR", offsetof(VkLayerDispatchTable, CmdBeginVideoCodingKHR), (PFN_vkVoidFunction)loader_lazy_CmdBeginVideoCodingKHR},
+    {"vkCmdEndVideoCodingKHR", offsetof(VkLayerDispatchTable, CmdEndVideoCodingKHR), (PFN_vkVoidFunction)loader_lazy_CmdEndVideoCodingKHR},
+    {"vkCmdControlVideoCodingKHR", offsetof(VkLayerDispatchTable, CmdControlVideoCodingKHR), (PFN_vkVoidFunction)loader_lazy_CmdControlVideoCodingKHR},
+    {"vkCmdDecodeVideoKHR", offsetof(VkLayerDispatchTable, CmdDecodeVideoKHR), (PFN_vkVoidFunction)loader_lazy_CmdDecodeVideoKHR},
+    {"vkCmdBeginRenderingKHR", offsetof(VkLayerDispatchTable, CmdBeginRenderingKHR), (PFN_vkVoidFunction)loader_lazy_CmdBeginRenderingKHR},
+    {"vkCmdEndRenderingKHR", offsetof(VkLayerDispatchTable, CmdEndRenderingKHR), (PFN_vkVoidFunction)loader_lazy_CmdEndRenderingKHR},
+    {"vkGetDeviceGroupPeerMemoryFeaturesKHR", offsetof(VkLayerDispatchTable, GetDeviceGroupPeerMemoryFeaturesKHR), (PFN_vkVoidFunction)loader_lazy_GetDeviceGroupPeerMemoryFeaturesKHR},
+    {"vkCmdSetDeviceMaskKHR", offsetof(VkLayerDispatchTable, CmdSetDeviceMaskKHR), (PFN_vkVoidFunction)loader_lazy_CmdSetDeviceMaskKHR},
+    {"vkCmdDispatchBaseKHR", offsetof(VkLayerDispatchTable, CmdDispatchBaseKHR), (PFN_vkVoidFunction)loader_lazy_CmdDispatchBaseKHR},
+    {"vkTrimCommandPoolKHR", offsetof(VkLayerDispatchTable, TrimCommandPoolKHR), (PFN_vkVoidFunction)loader_lazy_TrimCommandPoolKHR},
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    {"vkGetMemoryWin32HandleKHR", offsetof(VkLayerDispatchTable, GetMemoryWin32HandleKHR), (PFN_vkVoidFunction)loader_lazy_GetMemoryWin32HandleKHR},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    {"vkGetMemoryWin32HandlePropertiesKHR", offsetof(VkLayerDispatchTable, GetMemoryWin32HandlePropertiesKHR), (PFN_vkVoidFunction)loader_lazy_GetMemoryWin32HandlePropertiesKHR},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    {"vkGetMemoryFdKHR", offsetof(VkLayerDispatchTable, GetMemoryFdKHR), (PFN_vkVoidFunction)loader_lazy_GetMemoryFdKHR},
+    {"vkGetMemoryFdPropertiesKHR", offsetof(VkLayerDispatchTable, GetMemoryFdPropertiesKHR), (PFN_vkVoidFunction)loader_lazy_GetMemoryFdPropertiesKHR},
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    {"vkImportSemaphoreWin32HandleKHR", offsetof(VkLayerDispatchTable, ImportSemaphoreWin32HandleKHR), (PFN_vkVoidFunction)loader_lazy_ImportSemaphoreWin32HandleKHR},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    {"vkGetSemaphoreWin32HandleKHR", offsetof(VkLayerDispatchTable, GetSemaphoreWin32HandleKHR), (PFN_vkVoidFunction)loader_lazy_GetSemaphoreWin32HandleKHR},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    {"vkImportSemaphoreFdKHR", offsetof(VkLayerDispatchTable, ImportSemaphoreFdKHR), (PFN_vkVoidFunction)loader_lazy_ImportSemaphoreFdKHR},
+    {"vkGetSemaphoreFdKHR", offsetof(VkLayerDispatchTable, GetSemaphoreFdKHR), (PFN_vkVoidFunction)loader_lazy_GetSemaphoreFdKHR},
+    {"vkCmdPushDescriptorSetKHR", offsetof(VkLayerDispatchTable, CmdPushDescriptorSetKHR), (PFN_vkVoidFunction)loader_lazy_CmdPushDescriptorSetKHR},
+    {"vkCmdPushDescriptorSetWithTemplateKHR", offsetof(VkLayerDispatchTable, CmdPushDescriptorSetWithTemplateKHR), (PFN_vkVoidFunction)loader_lazy_CmdPushDescriptorSetWithTemplateKHR},
+    {"vkCreateDescriptorUpdateTemplateKHR", offsetof(VkLayerDispatchTable, CreateDescriptorUpdateTemplateKHR), (PFN_vkVoidFunction)loader_lazy_CreateDescriptorUpdateTemplateKHR},
+    {"vkDestroyDescriptorUpdateTemplateKHR", offsetof(VkLayerDispatchTable, DestroyDescriptorUpdateTemplateKHR), (PFN_vkVoidFunction)loader_lazy_DestroyDescriptorUpdateTemplateKHR},
+    {"vkUpdateDescriptorSetWithTemplateKHR", offsetof(VkLayerDispatchTable, UpdateDescriptorSetWithTemplateKHR), (PFN_vkVoidFunction)loader_lazy_UpdateDescriptorSetWithTemplateKHR},
+    {"vkCreateRenderPass2KHR", offsetof(VkLayerDispatchTable, CreateRenderPass2KHR), (PFN_vkVoidFunction)loader_lazy_CreateRenderPass2KHR},
+    {"vkCmdBeginRenderPass2KHR", offsetof(VkLayerDispatchTable, CmdBeginRenderPass2KHR), (PFN_vkVoidFunction)loader_lazy_CmdBeginRenderPass2KHR},
+    {"vkCmdNextSubpass2KHR", offsetof(VkLayerDispatchTable, CmdNextSubpass2KHR), (PFN_vkVoidFunction)loader_lazy_CmdNextSubpass2KHR},
+    {"vkCmdEndRenderPass2KHR", offsetof(VkLayerDispatchTable, CmdEndRenderPass2KHR), (PFN_vkVoidFunction)loader_lazy_CmdEndRenderPass2KHR},
+    {"vkGetSwapchainStatusKHR", offsetof(VkLayerDispatchTable, GetSwapchainStatusKHR), (PFN_vkVoidFunction)loader_lazy_GetSwapchainStatusKHR},
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    {"vkImportFenceWin32HandleKHR", offsetof(VkLayerDispatchTable, ImportFenceWin32HandleKHR), (PFN_vkVoidFunction)loader_lazy_ImportFenceWin32HandleKHR},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    {"vkGetFenceWin32HandleKHR", offsetof(VkLayerDispatchTable, GetFenceWin32HandleKHR), (PFN_vkVoidFunction)loader_lazy_GetFenceWin32HandleKHR},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    {"vkImportFenceFdKHR", offsetof(VkLayerDispatchTable, ImportFenceFdKHR), (PFN_vkVoidFunction)loader_lazy_ImportFenceFdKHR},
+    {"vkGetFenceFdKHR", offsetof(VkLayerDispatchTable, GetFenceFdKHR), (PFN_vkVoidFunction)loader_lazy_GetFenceFdKHR},
+    {"vkAcquireProfilingLockKHR", offsetof(VkLayerDispatchTable, AcquireProfilingLockKHR), (PFN_vkVoidFunction)loader_lazy_AcquireProfilingLockKHR},
+    {"vkReleaseProfilingLockKHR", offsetof(VkLayerDispatchTable, ReleaseProfilingLockKHR), (PFN_vkVoidFunction)loader_lazy_ReleaseProfilingLockKHR},
+    {"vkGetImageMemoryRequirements2KHR", offsetof(VkLayerDispatchTable, GetImageMemoryRequirements2KHR), (PFN_vkVoidFunction)loader_lazy_GetImageMemoryRequirements2KHR},
+    {"vkGetBufferMemoryRequirements2KHR", offsetof(VkLayerDispatchTable, GetBufferMemoryRequirements2KHR), (PFN_vkVoidFunction)loader_lazy_GetBufferMemoryRequirements2KHR},
+    {"vkGetImageSparseMemoryRequirements2KHR", offsetof(VkLayerDispatchTable, GetImageSparseMemoryRequirements2KHR), (PFN_vkVoidFunction)loader_lazy_GetImageSparseMemoryRequirements2KHR},
+    {"vkCreateSamplerYcbcrConversionKHR", offsetof(VkLayerDispatchTable, CreateSamplerYcbcrConversionKHR), (PFN_vkVoidFunction)loader_lazy_CreateSamplerYcbcrConversionKHR},
+    {"vkDestroySamplerYcbcrConversionKHR", offsetof(VkLayerDispatchTable, DestroySamplerYcbcrConversionKHR), (PFN_vkVoidFunction)loader_lazy_DestroySamplerYcbcrConversionKHR},
+    {"vkBindBufferMemory2KHR", offsetof(VkLayerDispatchTable, BindBufferMemory2KHR), (PFN_vkVoidFunction)loader_lazy_BindBufferMemory2KHR},
+    {"vkBindImageMemory2KHR", offsetof(VkLayerDispatchTable, BindImageMemory2KHR), (PFN_vkVoidFunction)loader_lazy_BindImageMemory2KHR},
+    {"vkGetDescriptorSetLayoutSupportKHR", offsetof(VkLayerDispatchTable, GetDescriptorSetLayoutSupportKHR), (PFN_vkVoidFunction)loader_lazy_GetDescriptorSetLayoutSupportKHR},
+    {"vkCmdDrawIndirectCountKHR", offsetof(VkLayerDispatchTable, CmdDrawIndirectCountKHR), (PFN_vkVoidFunction)loader_lazy_CmdDrawIndirectCountKHR},
+    {"vkCmdDrawIndexedIndirectCountKHR", offsetof(VkLayerDispatchTable, CmdDrawIndexedIndirectCountKHR), (PFN_vkVoidFunction)loader_lazy_CmdDrawIndexedIndirectCountKHR},
+    {"vkGetSemaphoreCounterValueKHR", offsetof(VkLayerDispatchTable, GetSemaphoreCounterValueKHR), (PFN_vkVoidFunction)loader_lazy_GetSemaphoreCounterValueKHR},
+    {"vkWaitSemaphoresKHR", offsetof(VkLayerDispatchTable, WaitSemaphoresKHR), (PFN_vkVoidFunction)loader_lazy_WaitSemaphoresKHR},
+    {"vkSignalSemaphoreKHR", offsetof(VkLayerDispatchTable, SignalSemaphoreKHR), (PFN_vkVoidFunction)loader_lazy_SignalSemaphoreKHR},
+    {"vkCmdSetFragmentShadingRateKHR", offsetof(VkLayerDispatchTable, CmdSetFragmentShadingRateKHR), (PFN_vkVoidFunction)loader_lazy_CmdSetFragmentShadingRateKHR},
+    {"vkCmdSetRenderingAttachmentLocationsKHR", offsetof(VkLayerDispatchTable, CmdSetRenderingAttachmentLocationsKHR), (PFN_vkVoidFunction)loader_lazy_CmdSetRenderingAttachmentLocationsKHR},
+    {"vkCmdSetRenderingInputAttachmentIndicesKHR", offsetof(VkLayerDispatchTable, CmdSetRenderingInputAttachmentIndicesKHR), (PFN_vkVoidFunction)loader_lazy_CmdSetRenderingInputAttachmentIndicesKHR},
+    {"vkWaitForPresentKHR", offsetof(VkLayerDispatchTable, WaitForPresentKHR), (PFN_vkVoidFunction)loader_lazy_WaitForPresentKHR},
+    {"vkGetBufferDeviceAddressKHR", offsetof(VkLayerDispatchTable, GetBufferDeviceAddressKHR), (PFN_vkVoidFunction)loader_lazy_GetBufferDeviceAddressKHR},
+    {"vkGetBufferOpaqueCaptureAddressKHR", offsetof(VkLayerDispatchTable, GetBufferOpaqueCaptureAddressKHR), (PFN_vkVoidFunction)loader_lazy_GetBufferOpaqueCaptureAddressKHR},
+    {"vkGetDeviceMemoryOpaqueCaptureAddressKHR", offsetof(VkLayerDispatchTable, GetDeviceMemoryOpaqueCaptureAddressKHR), (PFN_vkVoidFunction)loader_lazy_GetDeviceMemoryOpaqueCaptureAddressKHR},
+    {"vkCreateDeferredOperationKHR", offsetof(VkLayerDispatchTable, CreateDeferredOperationKHR), (PFN_vkVoidFunction)loader_lazy_CreateDeferredOperationKHR},
+    {"vkDestroyDeferredOperationKHR", offsetof(VkLayerDispatchTable, DestroyDeferredOperationKHR), (PFN_vkVoidFunction)loader_lazy_DestroyDeferredOperationKHR},
+    {"vkGetDeferredOperationMaxConcurrencyKHR", offsetof(VkLayerDispatchTable, GetDeferredOperationMaxConcurrencyKHR), (PFN_vkVoidFunction)loader_lazy_GetDeferredOperationMaxConcurrencyKHR},
+    {"vkGetDeferredOperationResultKHR", offsetof(VkLayerDispatchTable, GetDeferredOperationResultKHR), (PFN_vkVoidFunction)loader_lazy_GetDeferredOperationResultKHR},
+    {"vkDeferredOperationJoinKHR", offsetof(VkLayerDispatchTable, DeferredOperationJoinKHR), (PFN_vkVoidFunction)loader_lazy_DeferredOperationJoinKHR},
+    {"vkGetPipelineExecutablePropertiesKHR", offsetof(VkLayerDispatchTable, GetPipelineExecutablePropertiesKHR), (PFN_vkVoidFunction)loader_lazy_GetPipelineExecutablePropertiesKHR},
+    {"vkGetPipelineExecutableStatisticsKHR", offsetof(VkLayerDispatchTable, GetPipelineExecutableStatisticsKHR), (PFN_vkVoidFunction)loader_lazy_GetPipelineExecutableStatisticsKHR},
+    {"vkGetPipelineExecutableInternalRepresentationsKHR", offsetof(VkLayerDispatchTable, GetPipelineExecutableInternalRepresentationsKHR), (PFN_vkVoidFunction)loader_lazy_GetPipelineExecutableInternalRepresentationsKHR},
+    {"vkMapMemory2KHR", offsetof(VkLayerDispatchTable, MapMemory2KHR), (PFN_vkVoidFunction)loader_lazy_MapMemory2KHR},
+    {"vkUnmapMemory2KHR", offsetof(VkLayerDispatchTable, UnmapMemory2KHR), (PFN_vkVoidFunction)loader_lazy_UnmapMemory2KHR},
+    {"vkGetEncodedVideoSessionParametersKHR", offsetof(VkLayerDispatchTable, GetEncodedVideoSessionParametersKHR), (PFN_vkVoidFunction)loader_lazy_GetEncodedVideoSessionParametersKHR},
+    {"vkCmdEncodeVideoKHR", offsetof(VkLayerDispatchTable, CmdEncodeVideoKHR), (PFN_vkVoidFunction)loader_lazy_CmdEncodeVideoKHR},
+    {"vkCmdSetEvent2KHR", offsetof(VkLayerDispatchTable, CmdSetEvent2KHR), (PFN_vkVoidFunction)loader_lazy_CmdSetEvent2KHR},
+    {"vkCmdResetEvent2KHR", offsetof(VkLayerDispatchTable, CmdResetEvent2KHR), (PFN_vkVoidFunction)loader_lazy_CmdResetEvent2KHR},
+    {"vkCmdWaitEvents2KHR", offsetof(VkLayerDispatchTable, CmdWaitEvents2KHR), (PFN_vkVoidFunction)loader_lazy_CmdWaitEvents2KHR},
+    {"vkCmdPipelineBarrier2KHR", offsetof(VkLayerDispatchTable, CmdPipelineBarrier2KHR), (PFN_vkVoidFunction)loader_lazy_CmdPipelineBarrier2KHR},
+    {"vkCmdWriteTimestamp2KHR", offsetof(VkLayerDispatchTable, CmdWriteTimestamp2KHR), (PFN_vkVoidFunction)loader_lazy_CmdWriteTimestamp2KHR},
+    {"vkQueueSubmit2KHR", offsetof(VkLayerDispatchTable, QueueSubmit2KHR), (PFN_vkVoidFunction)loader_lazy_QueueSubmit2KHR},
+    {"vkCmdCopyBuffer2KHR", offsetof(VkLayerDispatchTable, CmdCopyBuffer2KHR), (PFN_vkVoidFunction)loader_lazy_CmdCopyBuffer2KHR},
+    {"vkCmdCopyImage2KHR", offsetof(VkLayerDispatchTable, CmdCopyImage2KHR), (PFN_vkVoidFunction)loader_lazy_CmdCopyImage2KHR},
+    {"vkCmdCopyBufferToImage2KHR", offsetof(VkLayerDispatchTable, CmdCopyBufferToImage2KHR), (PFN_vkVoidFunction)loader_lazy_CmdCopyBufferToImage2KHR},
+    {"vkCmdCopyImageToBuffer2KHR", offsetof(VkLayerDispatchTable, CmdCopyImageToBuffer2KHR), (PFN_vkVoidFunction)loader_lazy_CmdCopyImageToBuffer2KHR},
+    {"vkCmdBlitImage2KHR", offsetof(VkLayerDispatchTable, CmdBlitImage2KHR), (PFN_vkVoidFunction)loader_lazy_CmdBlitImage2KHR},
+    {"vkCmdResolveImage2KHR", offsetof(VkLayerDispatchTable, CmdResolveImage2KHR), (PFN_vkVoidFunction)loader_lazy_CmdResolveImage2KHR},
+    {"vkCmdTraceRaysIndirect2KHR", offsetof(VkLayerDispatchTable, CmdTraceRaysIndirect2KHR), (PFN_vkVoidFunction)loader_lazy_CmdTraceRaysIndirect2KHR},
+    {"vkGetDeviceBufferMemoryRequirementsKHR", offsetof(VkLayerDispatchTable, GetDeviceBufferMemoryRequirementsKHR), (PFN_vkVoidFunction)loader_lazy_GetDeviceBufferMemoryRequirementsKHR},
+    {"vkGetDeviceImageMemoryRequirementsKHR", offsetof(VkLayerDispatchTable, GetDeviceImageMemoryRequirementsKHR), (PFN_vkVoidFunction)loader_lazy_GetDeviceImageMemoryRequirementsKHR},
+    {"vkGetDeviceImageSparseMemoryRequirementsKHR", offsetof(VkLayerDispatchTable, GetDeviceImageSparseMemoryRequirementsKHR), (PFN_vkVoidFunction)loader_lazy_GetDeviceImageSparseMemoryRequirementsKHR},
+    {"vkCmdBindIndexBuffer2KHR", offsetof(VkLayerDispatchTable, CmdBindIndexBuffer2KHR), (PFN_vkVoidFunction)loader_lazy_CmdBindIndexBuffer2KHR},
+    {"vkGetRenderingAreaGranularityKHR", offsetof(VkLayerDispatchTable, GetRenderingAreaGranularityKHR), (PFN_vkVoidFunction)loader_lazy_GetRenderingAreaGranularityKHR},
+    {"vkGetDeviceImageSubresourceLayoutKHR", offsetof(VkLayerDispatchTable, GetDeviceImageSubresourceLayoutKHR), (PFN_vkVoidFunction)loader_lazy_GetDeviceImageSubresourceLayoutKHR},
+    {"vkGetImageSubresourceLayout2KHR", offsetof(VkLayerDispatchTable, GetImageSubresourceLayout2KHR), (PFN_vkVoidFunction)loader_lazy_GetImageSubresourceLayout2KHR},
+    {"vkCreatePipelineBinariesKHR", offsetof(VkLayerDispatchTable, CreatePipelineBinariesKHR), (PFN_vkVoidFunction)loader_lazy_CreatePipelineBinariesKHR},
+    {"vkDestroyPipelineBinaryKHR", offsetof(VkLayerDispatchTable, DestroyPipelineBinaryKHR), (PFN_vkVoidFunction)loader_lazy_DestroyPipelineBinaryKHR},
+    {"vkGetPipelineKeyKHR", offsetof(VkLayerDispatchTable, GetPipelineKeyKHR), (PFN_vkVoidFunction)loader_lazy_GetPipelineKeyKHR},
+    {"vkGetPipelineBinaryDataKHR", offsetof(VkLayerDispatchTable, GetPipelineBinaryDataKHR), (PFN_vkVoidFunction)loader_lazy_GetPipelineBinaryDataKHR},
+    {"vkReleaseCapturedPipelineDataKHR", offsetof(VkLayerDispatchTable, ReleaseCapturedPipelineDataKHR), (PFN_vkVoidFunction)loader_lazy_ReleaseCapturedPipelineDataKHR},
+    {"vkCmdSetLineStippleKHR", offsetof(VkLayerDispatchTable, CmdSetLineStippleKHR), (PFN_vkVoidFunction)loader_lazy_CmdSetLineStippleKHR},
+    {"vkGetCalibratedTimestampsKHR", offsetof(VkLayerDispatchTable, GetCalibratedTimestampsKHR), (PFN_vkVoidFunction)loader_lazy_GetCalibratedTimestampsKHR},
+    {"vkCmdBindDescriptorSets2KHR", offsetof(VkLayerDispatchTable, CmdBindDescriptorSets2KHR), (PFN_vkVoidFunction)loader_lazy_CmdBindDescriptorSets2KHR},
+    {"vkCmdPushConstants2KHR", offsetof(VkLayerDispatchTable, CmdPushConstants2KHR), (PFN_vkVoidFunction)loader_lazy_CmdPushConstants2KHR},
+    {"vkCmdPushDescriptorSet2KHR", offsetof(VkLayerDispatchTable, CmdPushDescriptorSet2KHR), (PFN_vkVoidFunction)loader_lazy_CmdPushDescriptorSet2KHR},
+    {"vkCmdPushDescriptorSetWithTemplate2KHR", offsetof(VkLayerDispatchTable, CmdPushDescriptorSetWithTemplate2KHR), (PFN_vkVoidFunction)loader_lazy_CmdPushDescriptorSetWithTemplate2KHR},
+    {"vkCmdSetDescriptorBufferOffsets2EXT", offsetof(VkLayerDispatchTable, CmdSetDescriptorBufferOffsets2EXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDescriptorBufferOffsets2EXT},
+    {"vkCmdBindDescriptorBufferEmbeddedSamplers2EXT", offsetof(VkLayerDispatchTable, CmdBindDescriptorBufferEmbeddedSamplers2EXT), (PFN_vkVoidFunction)loader_lazy_CmdBindDescriptorBufferEmbeddedSamplers2EXT},
+    {"vkDebugMarkerSetObjectTagEXT", offsetof(VkLayerDispatchTable, DebugMarkerSetObjectTagEXT), (PFN_vkVoidFunction)loader_lazy_DebugMarkerSetObjectTagEXT},
+    {"vkDebugMarkerSetObjectNameEXT", offsetof(VkLayerDispatchTable, DebugMarkerSetObjectNameEXT), (PFN_vkVoidFunction)loader_lazy_DebugMarkerSetObjectNameEXT},
+    {"vkCmdDebugMarkerBeginEXT", offsetof(VkLayerDispatchTable, CmdDebugMarkerBeginEXT), (PFN_vkVoidFunction)loader_lazy_CmdDebugMarkerBeginEXT},
+    {"vkCmdDebugMarkerEndEXT", offsetof(VkLayerDispatchTable, CmdDebugMarkerEndEXT), (PFN_vkVoidFunction)loader_lazy_CmdDebugMarkerEndEXT},
+    {"vkCmdDebugMarkerInsertEXT", offsetof(VkLayerDispatchTable, CmdDebugMarkerInsertEXT), (PFN_vkVoidFunction)loader_lazy_CmdDebugMarkerInsertEXT},
+    {"vkCmdBindTransformFeedbackBuffersEXT", offsetof(VkLayerDispatchTable, CmdBindTransformFeedbackBuffersEXT), (PFN_vkVoidFunction)loader_lazy_CmdBindTransformFeedbackBuffersEXT},
+    {"vkCmdBeginTransformFeedbackEXT", offsetof(VkLayerDispatchTable, CmdBeginTransformFeedbackEXT), (PFN_vkVoidFunction)loader_lazy_CmdBeginTransformFeedbackEXT},
+    {"vkCmdEndTransformFeedbackEXT", offsetof(VkLayerDispatchTable, CmdEndTransformFeedbackEXT), (PFN_vkVoidFunction)loader_lazy_CmdEndTransformFeedbackEXT},
+    {"vkCmdBeginQueryIndexedEXT", offsetof(VkLayerDispatchTable, CmdBeginQueryIndexedEXT), (PFN_vkVoidFunction)loader_lazy_CmdBeginQueryIndexedEXT},
+    {"vkCmdEndQueryIndexedEXT", offsetof(VkLayerDispatchTable, CmdEndQueryIndexedEXT), (PFN_vkVoidFunction)loader_lazy_CmdEndQueryIndexedEXT},
+    {"vkCmdDrawIndirectByteCountEXT", offsetof(VkLayerDispatchTable, CmdDrawIndirectByteCountEXT), (PFN_vkVoidFunction)loader_lazy_CmdDrawIndirectByteCountEXT},
+    {"vkCreateCuModuleNVX", offsetof(VkLayerDispatchTable, CreateCuModuleNVX), (PFN_vkVoidFunction)loader_lazy_CreateCuModuleNVX},
+    {"vkCreateCuFunctionNVX", offsetof(VkLayerDispatchTable, CreateCuFunctionNVX), (PFN_vkVoidFunction)loader_lazy_CreateCuFunctionNVX},
+    {"vkDestroyCuModuleNVX", offsetof(VkLayerDispatchTable, DestroyCuModuleNVX), (PFN_vkVoidFunction)loader_lazy_DestroyCuModuleNVX},
+    {"vkDestroyCuFunctionNVX", offsetof(VkLayerDispatchTable, DestroyCuFunctionNVX), (PFN_vkVoidFunction)loader_lazy_DestroyCuFunctionNVX},
+    {"vkCmdCuLaunchKernelNVX", offsetof(VkLayerDispatchTable, CmdCuLaunchKernelNVX), (PFN_vkVoidFunction)loader_lazy_CmdCuLaunchKernelNVX},
+    {"vkGetImageViewHandleNVX", offsetof(VkLayerDispatchTable, GetImageViewHandleNVX), (PFN_vkVoidFunction)loader_lazy_GetImageViewHandleNVX},
+    {"vkGetImageViewHandle64NVX", offsetof(VkLayerDispatchTable, GetImageViewHandle64NVX), (PFN_vkVoidFunction)loader_lazy_GetImageViewHandle64NVX},
+    {"vkGetImageViewAddressNVX", offsetof(VkLayerDispatchTable, GetImageViewAddressNVX), (PFN_vkVoidFunction)loader_lazy_GetImageViewAddressNVX},
+    {"vkCmdDrawIndirectCountAMD", offsetof(VkLayerDispatchTable, CmdDrawIndirectCountAMD), (PFN_vkVoidFunction)loader_lazy_CmdDrawIndirectCountAMD},
+    {"vkCmdDrawIndexedIndirectCountAMD", offsetof(VkLayerDispatchTable, CmdDrawIndexedIndirectCountAMD), (PFN_vkVoidFunction)loader_lazy_CmdDrawIndexedIndirectCountAMD},
+    {"vkGetShaderInfoAMD", offsetof(VkLayerDispatchTable, GetShaderInfoAMD), (PFN_vkVoidFunction)loader_lazy_GetShaderInfoAMD},
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    {"vkGetMemoryWin32HandleNV", offsetof(VkLayerDispatchTable, GetMemoryWin32HandleNV), (PFN_vkVoidFunction)loader_lazy_GetMemoryWin32HandleNV},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    {"vkCmdBeginConditionalRenderingEXT", offsetof(VkLayerDispatchTable, CmdBeginConditionalRenderingEXT), (PFN_vkVoidFunction)loader_lazy_CmdBeginConditionalRenderingEXT},
+    {"vkCmdEndConditionalRenderingEXT", offsetof(VkLayerDispatchTable, CmdEndConditionalRenderingEXT), (PFN_vkVoidFunction)loader_lazy_CmdEndConditionalRenderingEXT},
+    {"vkCmdSetViewportWScalingNV", offsetof(VkLayerDispatchTable, CmdSetViewportWScalingNV), (PFN_vkVoidFunction)loader_lazy_CmdSetViewportWScalingNV},
+    {"vkDisplayPowerControlEXT", offsetof(VkLayerDispatchTable, DisplayPowerControlEXT), (PFN_vkVoidFunction)loader_lazy_DisplayPowerControlEXT},
+    {"vkRegisterDeviceEventEXT", offsetof(VkLayerDispatchTable, RegisterDeviceEventEXT), (PFN_vkVoidFunction)loader_lazy_RegisterDeviceEventEXT},
+    {"vkRegisterDisplayEventEXT", offsetof(VkLayerDispatchTable, RegisterDisplayEventEXT), (PFN_vkVoidFunction)loader_lazy_RegisterDisplayEventEXT},
+    {"vkGetSwapchainCounterEXT", offsetof(VkLayerDispatchTable, GetSwapchainCounterEXT), (PFN_vkVoidFunction)loader_lazy_GetSwapchainCounterEXT},
+    {"vkGetRefreshCycleDurationGOOGLE", offsetof(VkLayerDispatchTable, GetRefreshCycleDurationGOOGLE), (PFN_vkVoidFunction)loader_lazy_GetRefreshCycleDurationGOOGLE},
+    {"vkGetPastPresentationTimingGOOGLE", offsetof(VkLayerDispatchTable, GetPastPresentationTimingGOOGLE), (PFN_vkVoidFunction)loader_lazy_GetPastPresentationTimingGOOGLE},
+    {"vkCmdSetDiscardRectangleEXT", offsetof(VkLayerDispatchTable, CmdSetDiscardRectangleEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDiscardRectangleEXT},
+    {"vkCmdSetDiscardRectangleEnableEXT", offsetof(VkLayerDispatchTable, CmdSetDiscardRectangleEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDiscardRectangleEnableEXT},
+    {"vkCmdSetDiscardRectangleModeEXT", offsetof(VkLayerDispatchTable, CmdSetDiscardRectangleModeEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDiscardRectangleModeEXT},
+    {"vkSetHdrMetadataEXT", offsetof(VkLayerDispatchTable, SetHdrMetadataEXT), (PFN_vkVoidFunction)loader_lazy_SetHdrMetadataEXT},
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+    {"vkGetAndroidHardwareBufferPropertiesANDROID", offsetof(VkLayerDispatchTable, GetAndroidHardwareBufferPropertiesANDROID), (PFN_vkVoidFunction)loader_lazy_GetAndroidHardwareBufferPropertiesANDROID},
+#endif // VK_USE_PLATFORM_ANDROID_KHR
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+    {"vkGetMemoryAndroidHardwareBufferANDROID", offsetof(VkLayerDispatchTable, GetMemoryAndroidHardwareBufferANDROID), (PFN_vkVoidFunction)loader_lazy_GetMemoryAndroidHardwareBufferANDROID},
+#endif // VK_USE_PLATFORM_ANDROID_KHR
+#if defined(VK_ENABLE_BETA_EXTENSIONS)
+    {"vkCreateExecutionGraphPipelinesAMDX", offsetof(VkLayerDispatchTable, CreateExecutionGraphPipelinesAMDX), (PFN_vkVoidFunction)loader_lazy_CreateExecutionGraphPipelinesAMDX},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#if defined(VK_ENABLE_BETA_EXTENSIONS)
+    {"vkGetExecutionGraphPipelineScratchSizeAMDX", offsetof(VkLayerDispatchTable, GetExecutionGraphPipelineScratchSizeAMDX), (PFN_vkVoidFunction)loader_lazy_GetExecutionGraphPipelineScratchSizeAMDX},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#if defined(VK_ENABLE_BETA_EXTENSIONS)
+    {"vkGetExecutionGraphPipelineNodeIndexAMDX", offsetof(VkLayerDispatchTable, GetExecutionGraphPipelineNodeIndexAMDX), (PFN_vkVoidFunction)loader_lazy_GetExecutionGraphPipelineNodeIndexAMDX},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#if defined(VK_ENABLE_BETA_EXTENSIONS)
+    {"vkCmdInitializeGraphScratchMemoryAMDX", offsetof(VkLayerDispatchTable, CmdInitializeGraphScratchMemoryAMDX), (PFN_vkVoidFunction)loader_lazy_CmdInitializeGraphScratchMemoryAMDX},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#if defined(VK_ENABLE_BETA_EXTENSIONS)
+    {"vkCmdDispatchGraphAMDX", offsetof(VkLayerDispatchTable, CmdDispatchGraphAMDX), (PFN_vkVoidFunction)loader_lazy_CmdDispatchGraphAMDX},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#if defined(VK_ENABLE_BETA_EXTENSIONS)
+    {"vkCmdDispatchGraphIndirectAMDX", offsetof(VkLayerDispatchTable, CmdDispatchGraphIndirectAMDX), (PFN_vkVoidFunction)loader_lazy_CmdDispatchGraphIndirectAMDX},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+#if defined(VK_ENABLE_BETA_EXTENSIONS)
+    {"vkCmdDispatchGraphIndirectCountAMDX", offsetof(VkLayerDispatchTable, CmdDispatchGraphIndirectCountAMDX), (PFN_vkVoidFunction)loader_lazy_CmdDispatchGraphIndirectCountAMDX},
+#endif // VK_ENABLE_BETA_EXTENSIONS
+    {"vkCmdSetSampleLocationsEXT", offsetof(VkLayerDispatchTable, CmdSetSampleLocationsEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetSampleLocationsEXT},
+    {"vkGetImageDrmFormatModifierPropertiesEXT", offsetof(VkLayerDispatchTable, GetImageDrmFormatModifierPropertiesEXT), (PFN_vkVoidFunction)loader_lazy_GetImageDrmFormatModifierPropertiesEXT},
+    {"vkCreateValidationCacheEXT", offsetof(VkLayerDispatchTable, CreateValidationCacheEXT), (PFN_vkVoidFunction)loader_lazy_CreateValidationCacheEXT},
+    {"vkDestroyValidationCacheEXT", offsetof(VkLayerDispatchTable, DestroyValidationCacheEXT), (PFN_vkVoidFunction)loader_lazy_DestroyValidationCacheEXT},
+    {"vkMergeValidationCachesEXT", offsetof(VkLayerDispatchTable, MergeValidationCachesEXT), (PFN_vkVoidFunction)loader_lazy_MergeValidationCachesEXT},
+    {"vkGetValidationCacheDataEXT", offsetof(VkLayerDispatchTable, GetValidationCacheDataEXT), (PFN_vkVoidFunction)loader_lazy_GetValidationCacheDataEXT},
+    {"vkCmdBindShadingRateImageNV", offsetof(VkLayerDispatchTable, CmdBindShadingRateImageNV), (PFN_vkVoidFunction)loader_lazy_CmdBindShadingRateImageNV},
+    {"vkCmdSetViewportShadingRatePaletteNV", offsetof(VkLayerDispatchTable, CmdSetViewportShadingRatePaletteNV), (PFN_vkVoidFunction)loader_lazy_CmdSetViewportShadingRatePaletteNV},
+    {"vkCmdSetCoarseSampleOrderNV", offsetof(VkLayerDispatchTable, CmdSetCoarseSampleOrderNV), (PFN_vkVoidFunction)loader_lazy_CmdSetCoarseSampleOrderNV},
+    {"vkCreateAccelerationStructureNV", offsetof(VkLayerDispatchTable, CreateAccelerationStructureNV), (PFN_vkVoidFunction)loader_lazy_CreateAccelerationStructureNV},
+    {"vkDestroyAccelerationStructureNV", offsetof(VkLayerDispatchTable, DestroyAccelerationStructureNV), (PFN_vkVoidFunction)loader_lazy_DestroyAccelerationStructureNV},
+    {"vkGetAccelerationStructureMemoryRequirementsNV", offsetof(VkLayerDispatchTable, GetAccelerationStructureMemoryRequirementsNV), (PFN_vkVoidFunction)loader_lazy_GetAccelerationStructureMemoryRequirementsNV},
+    {"vkBindAccelerationStructureMemoryNV", offsetof(VkLayerDispatchTable, BindAccelerationStructureMemoryNV), (PFN_vkVoidFunction)loader_lazy_BindAccelerationStructureMemoryNV},
+    {"vkCmdBuildAccelerationStructureNV", offsetof(VkLayerDispatchTable, CmdBuildAccelerationStructureNV), (PFN_vkVoidFunction)loader_lazy_CmdBuildAccelerationStructureNV},
+    {"vkCmdCopyAccelerationStructureNV", offsetof(VkLayerDispatchTable, CmdCopyAccelerationStructureNV), (PFN_vkVoidFunction)loader_lazy_CmdCopyAccelerationStructureNV},
+    {"vkCmdTraceRaysNV", offsetof(VkLayerDispatchTable, CmdTraceRaysNV), (PFN_vkVoidFunction)loader_lazy_CmdTraceRaysNV},
+    {"vkCreateRayTracingPipelinesNV", offsetof(VkLayerDispatchTable, CreateRayTracingPipelinesNV), (PFN_vkVoidFunction)loader_lazy_CreateRayTracingPipelinesNV},
+    {"vkGetRayTracingShaderGroupHandlesKHR", offsetof(VkLayerDispatchTable, GetRayTracingShaderGroupHandlesKHR), (PFN_vkVoidFunction)loader_lazy_GetRayTracingShaderGroupHandlesKHR},
+    {"vkGetRayTracingShaderGroupHandlesNV", offsetof(VkLayerDispatchTable, GetRayTracingShaderGroupHandlesNV), (PFN_vkVoidFunction)loader_lazy_GetRayTracingShaderGroupHandlesNV},
+    {"vkGetAccelerationStructureHandleNV", offsetof(VkLayerDispatchTable, GetAccelerationStructureHandleNV), (PFN_vkVoidFunction)loader_lazy_GetAccelerationStructureHandleNV},
+    {"vkCmdWriteAccelerationStructuresPropertiesNV", offsetof(VkLayerDispatchTable, CmdWriteAccelerationStructuresPropertiesNV), (PFN_vkVoidFunction)loader_lazy_CmdWriteAccelerationStructuresPropertiesNV},
+    {"vkCompileDeferredNV", offsetof(VkLayerDispatchTable, CompileDeferredNV), (PFN_vkVoidFunction)loader_lazy_CompileDeferredNV},
+    {"vkGetMemoryHostPointerPropertiesEXT", offsetof(VkLayerDispatchTable, GetMemoryHostPointerPropertiesEXT), (PFN_vkVoidFunction)loader_lazy_GetMemoryHostPointerPropertiesEXT},
+    {"vkCmdWriteBufferMarkerAMD", offsetof(VkLayerDispatchTable, CmdWriteBufferMarkerAMD), (PFN_vkVoidFunction)loader_lazy_CmdWriteBufferMarkerAMD},
+    {"vkCmdWriteBufferMarker2AMD", offsetof(VkLayerDispatchTable, CmdWriteBufferMarker2AMD), (PFN_vkVoidFunction)loader_lazy_CmdWriteBufferMarker2AMD},
+    {"vkGetCalibratedTimestampsEXT", offsetof(VkLayerDispatchTable, GetCalibratedTimestampsEXT), (PFN_vkVoidFunction)loader_lazy_GetCalibratedTimestampsEXT},
+    {"vkCmdDrawMeshTasksNV", offsetof(VkLayerDispatchTable, CmdDrawMeshTasksNV), (PFN_vkVoidFunction)loader_lazy_CmdDrawMeshTasksNV},
+    {"vkCmdDrawMeshTasksIndirectNV", offsetof(VkLayerDispatchTable, CmdDrawMeshTasksIndirectNV), (PFN_vkVoidFunction)loader_lazy_CmdDrawMeshTasksIndirectNV},
+    {"vkCmdDrawMeshTasksIndirectCountNV", offsetof(VkLayerDispatchTable, CmdDrawMeshTasksIndirectCountNV), (PFN_vkVoidFunction)loader_lazy_CmdDrawMeshTasksIndirectCountNV},
+    {"vkCmdSetExclusiveScissorEnableNV", offsetof(VkLayerDispatchTable, CmdSetExclusiveScissorEnableNV), (PFN_vkVoidFunction)loader_lazy_CmdSetExclusiveScissorEnableNV},
+    {"vkCmdSetExclusiveScissorNV", offsetof(VkLayerDispatchTable, CmdSetExclusiveScissorNV), (PFN_vkVoidFunction)loader_lazy_CmdSetExclusiveScissorNV},
+    {"vkCmdSetCheckpointNV", offsetof(VkLayerDispatchTable, CmdSetCheckpointNV), (PFN_vkVoidFunction)loader_lazy_CmdSetCheckpointNV},
+    {"vkGetQueueCheckpointDataNV", offsetof(VkLayerDispatchTable, GetQueueCheckpointDataNV), (PFN_vkVoidFunction)loader_lazy_GetQueueCheckpointDataNV},
+    {"vkGetQueueCheckpointData2NV", offsetof(VkLayerDispatchTable, GetQueueCheckpointData2NV), (PFN_vkVoidFunction)loader_lazy_GetQueueCheckpointData2NV},
+    {"vkInitializePerformanceApiINTEL", offsetof(VkLayerDispatchTable, InitializePerformanceApiINTEL), (PFN_vkVoidFunction)loader_lazy_InitializePerformanceApiINTEL},
+    {"vkUninitializePerformanceApiINTEL", offsetof(VkLayerDispatchTable, UninitializePerformanceApiINTEL), (PFN_vkVoidFunction)loader_lazy_UninitializePerformanceApiINTEL},
+    {"vkCmdSetPerformanceMarkerINTEL", offsetof(VkLayerDispatchTable, CmdSetPerformanceMarkerINTEL), (PFN_vkVoidFunction)loader_lazy_CmdSetPerformanceMarkerINTEL},
+    {"vkCmdSetPerformanceStreamMarkerINTEL", offsetof(VkLayerDispatchTable, CmdSetPerformanceStreamMarkerINTEL), (PFN_vkVoidFunction)loader_lazy_CmdSetPerformanceStreamMarkerINTEL},
+    {"vkCmdSetPerformanceOverrideINTEL", offsetof(VkLayerDispatchTable, CmdSetPerformanceOverrideINTEL), (PFN_vkVoidFunction)loader_lazy_CmdSetPerformanceOverrideINTEL},
+    {"vkAcquirePerformanceConfigurationINTEL", offsetof(VkLayerDispatchTable, AcquirePerformanceConfigurationINTEL), (PFN_vkVoidFunction)loader_lazy_AcquirePerformanceConfigurationINTEL},
+    {"vkReleasePerformanceConfigurationINTEL", offsetof(VkLayerDispatchTable, ReleasePerformanceConfigurationINTEL), (PFN_vkVoidFunction)loader_lazy_ReleasePerformanceConfigurationINTEL},
+    {"vkQueueSetPerformanceConfigurationINTEL", offsetof(VkLayerDispatchTable, QueueSetPerformanceConfigurationINTEL), (PFN_vkVoidFunction)loader_lazy_QueueSetPerformanceConfigurationINTEL},
+    {"vkGetPerformanceParameterINTEL", offsetof(VkLayerDispatchTable, GetPerformanceParameterINTEL), (PFN_vkVoidFunction)loader_lazy_GetPerformanceParameterINTEL},
+    {"vkSetLocalDimmingAMD", offsetof(VkLayerDispatchTable, SetLocalDimmingAMD), (PFN_vkVoidFunction)loader_lazy_SetLocalDimmingAMD},
+    {"vkGetBufferDeviceAddressEXT", offsetof(VkLayerDispatchTable, GetBufferDeviceAddressEXT), (PFN_vkVoidFunction)loader_lazy_GetBufferDeviceAddressEXT},
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    {"vkAcquireFullScreenExclusiveModeEXT", offsetof(VkLayerDispatchTable, AcquireFullScreenExclusiveModeEXT), (PFN_vkVoidFunction)loader_lazy_AcquireFullScreenExclusiveModeEXT},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    {"vkReleaseFullScreenExclusiveModeEXT", offsetof(VkLayerDispatchTable, ReleaseFullScreenExclusiveModeEXT), (PFN_vkVoidFunction)loader_lazy_ReleaseFullScreenExclusiveModeEXT},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+    {"vkGetDeviceGroupSurfacePresentModes2EXT", offsetof(VkLayerDispatchTable, GetDeviceGroupSurfacePresentModes2EXT), (PFN_vkVoidFunction)loader_lazy_GetDeviceGroupSurfacePresentModes2EXT},
+#endif // VK_USE_PLATFORM_WIN32_KHR
+    {"vkCmdSetLineStippleEXT", offsetof(VkLayerDispatchTable, CmdSetLineStippleEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetLineStippleEXT},
+    {"vkResetQueryPoolEXT", offsetof(VkLayerDispatchTable, ResetQueryPoolEXT), (PFN_vkVoidFunction)loader_lazy_ResetQueryPoolEXT},
+    {"vkCmdSetCullModeEXT", offsetof(VkLayerDispatchTable, CmdSetCullModeEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetCullModeEXT},
+    {"vkCmdSetFrontFaceEXT", offsetof(VkLayerDispatchTable, CmdSetFrontFaceEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetFrontFaceEXT},
+    {"vkCmdSetPrimitiveTopologyEXT", offsetof(VkLayerDispatchTable, CmdSetPrimitiveTopologyEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetPrimitiveTopologyEXT},
+    {"vkCmdSetViewportWithCountEXT", offsetof(VkLayerDispatchTable, CmdSetViewportWithCountEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetViewportWithCountEXT},
+    {"vkCmdSetScissorWithCountEXT", offsetof(VkLayerDispatchTable, CmdSetScissorWithCountEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetScissorWithCountEXT},
+    {"vkCmdBindVertexBuffers2EXT", offsetof(VkLayerDispatchTable, CmdBindVertexBuffers2EXT), (PFN_vkVoidFunction)loader_lazy_CmdBindVertexBuffers2EXT},
+    {"vkCmdSetDepthTestEnableEXT", offsetof(VkLayerDispatchTable, CmdSetDepthTestEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthTestEnableEXT},
+    {"vkCmdSetDepthWriteEnableEXT", offsetof(VkLayerDispatchTable, CmdSetDepthWriteEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthWriteEnableEXT},
+    {"vkCmdSetDepthCompareOpEXT", offsetof(VkLayerDispatchTable, CmdSetDepthCompareOpEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthCompareOpEXT},
+    {"vkCmdSetDepthBoundsTestEnableEXT", offsetof(VkLayerDispatchTable, CmdSetDepthBoundsTestEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthBoundsTestEnableEXT},
+    {"vkCmdSetStencilTestEnableEXT", offsetof(VkLayerDispatchTable, CmdSetStencilTestEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetStencilTestEnableEXT},
+    {"vkCmdSetStencilOpEXT", offsetof(VkLayerDispatchTable, CmdSetStencilOpEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetStencilOpEXT},
+    {"vkCopyMemoryToImageEXT", offsetof(VkLayerDispatchTable, CopyMemoryToImageEXT), (PFN_vkVoidFunction)loader_lazy_CopyMemoryToImageEXT},
+    {"vkCopyImageToMemoryEXT", offsetof(VkLayerDispatchTable, CopyImageToMemoryEXT), (PFN_vkVoidFunction)loader_lazy_CopyImageToMemoryEXT},
+    {"vkCopyImageToImageEXT", offsetof(VkLayerDispatchTable, CopyImageToImageEXT), (PFN_vkVoidFunction)loader_lazy_CopyImageToImageEXT},
+    {"vkTransitionImageLayoutEXT", offsetof(VkLayerDispatchTable, TransitionImageLayoutEXT), (PFN_vkVoidFunction)loader_lazy_TransitionImageLayoutEXT},
+    {"vkGetImageSubresourceLayout2EXT", offsetof(VkLayerDispatchTable, GetImageSubresourceLayout2EXT), (PFN_vkVoidFunction)loader_lazy_GetImageSubresourceLayout2EXT},
+    {"vkReleaseSwapchainImagesEXT", offsetof(VkLayerDispatchTable, ReleaseSwapchainImagesEXT), (PFN_vkVoidFunction)loader_lazy_ReleaseSwapchainImagesEXT},
+    {"vkGetGeneratedCommandsMemoryRequirementsNV", offsetof(VkLayerDispatchTable, GetGeneratedCommandsMemoryRequirementsNV), (PFN_vkVoidFunction)loader_lazy_GetGeneratedCommandsMemoryRequirementsNV},
+    {"vkCmdPreprocessGeneratedCommandsNV", offsetof(VkLayerDispatchTable, CmdPreprocessGeneratedCommandsNV), (PFN_vkVoidFunction)loader_lazy_CmdPreprocessGeneratedCommandsNV},
+    {"vkCmdExecuteGeneratedCommandsNV", offsetof(VkLayerDispatchTable, CmdExecuteGeneratedCommandsNV), (PFN_vkVoidFunction)loader_lazy_CmdExecuteGeneratedCommandsNV},
+    {"vkCmdBindPipelineShaderGroupNV", offsetof(VkLayerDispatchTable, CmdBindPipelineShaderGroupNV), (PFN_vkVoidFunction)loader_lazy_CmdBindPipelineShaderGroupNV},
+    {"vkCreateIndirectCommandsLayoutNV", offsetof(VkLayerDispatchTable, CreateIndirectCommandsLayoutNV), (PFN_vkVoidFunction)loader_lazy_CreateIndirectCommandsLayoutNV},
+    {"vkDestroyIndirectCommandsLayoutNV", offsetof(VkLayerDispatchTable, DestroyIndirectCommandsLayoutNV), (PFN_vkVoidFunction)loader_lazy_DestroyIndirectCommandsLayoutNV},
+    {"vkCmdSetDepthBias2EXT", offsetof(VkLayerDispatchTable, CmdSetDepthBias2EXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthBias2EXT},
+    {"vkCreatePrivateDataSlotEXT", offsetof(VkLayerDispatchTable, CreatePrivateDataSlotEXT), (PFN_vkVoidFunction)loader_lazy_CreatePrivateDataSlotEXT},
+    {"vkDestroyPrivateDataSlotEXT", offsetof(VkLayerDispatchTable, DestroyPrivateDataSlotEXT), (PFN_vkVoidFunction)loader_lazy_DestroyPrivateDataSlotEXT},
+    {"vkSetPrivateDataEXT", offsetof(VkLayerDispatchTable, SetPrivateDataEXT), (PFN_vkVoidFunction)loader_lazy_SetPrivateDataEXT},
+    {"vkGetPrivateDataEXT", offsetof(VkLayerDispatchTable, GetPrivateDataEXT), (PFN_vkVoidFunction)loader_lazy_GetPrivateDataEXT},
+    {"vkCreateCudaModuleNV", offsetof(VkLayerDispatchTable, CreateCudaModuleNV), (PFN_vkVoidFunction)loader_lazy_CreateCudaModuleNV},
+    {"vkGetCudaModuleCacheNV", offsetof(VkLayerDispatchTable, GetCudaModuleCacheNV), (PFN_vkVoidFunction)loader_lazy_GetCudaModuleCacheNV},
+    {"vkCreateCudaFunctionNV", offsetof(VkLayerDispatchTable, CreateCudaFunctionNV), (PFN_vkVoidFunction)loader_lazy_CreateCudaFunctionNV},
+    {"vkDestroyCudaModuleNV", offsetof(VkLayerDispatchTable, DestroyCudaModuleNV), (PFN_vkVoidFunction)loader_lazy_DestroyCudaModuleNV},
+    {"vkDestroyCudaFunctionNV", offsetof(VkLayerDispatchTable, DestroyCudaFunctionNV), (PFN_vkVoidFunction)loader_lazy_DestroyCudaFunctionNV},
+    {"vkCmdCudaLaunchKernelNV", offsetof(VkLayerDispatchTable, CmdCudaLaunchKernelNV), (PFN_vkVoidFunction)loader_lazy_CmdCudaLaunchKernelNV},
+#if defined(VK_USE_PLATFORM_METAL_EXT)
+    {"vkExportMetalObjectsEXT", offsetof(VkLayerDispatchTable, ExportMetalObjectsEXT), (PFN_vkVoidFunction)loader_lazy_ExportMetalObjectsEXT},
+#endif // VK_USE_PLATFORM_METAL_EXT
+    {"vkGetDescriptorSetLayoutSizeEXT", offsetof(VkLayerDispatchTable, GetDescriptorSetLayoutSizeEXT), (PFN_vkVoidFunction)loader_lazy_GetDescriptorSetLayoutSizeEXT},
+    {"vkGetDescriptorSetLayoutBindingOffsetEXT", offsetof(VkLayerDispatchTable, GetDescriptorSetLayoutBindingOffsetEXT), (PFN_vkVoidFunction)loader_lazy_GetDescriptorSetLayoutBindingOffsetEXT},
+    {"vkGetDescriptorEXT", offsetof(VkLayerDispatchTable, GetDescriptorEXT), (PFN_vkVoidFunction)loader_lazy_GetDescriptorEXT},
+    {"vkCmdBindDescriptorBuffersEXT", offsetof(VkLayerDispatchTable, CmdBindDescriptorBuffersEXT), (PFN_vkVoidFunction)loader_lazy_CmdBindDescriptorBuffersEXT},
+    {"vkCmdSetDescriptorBufferOffsetsEXT", offsetof(VkLayerDispatchTable, CmdSetDescriptorBufferOffsetsEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDescriptorBufferOffsetsEXT},
+    {"vkCmdBindDescriptorBufferEmbeddedSamplersEXT", offsetof(VkLayerDispatchTable, CmdBindDescriptorBufferEmbeddedSamplersEXT), (PFN_vkVoidFunction)loader_lazy_CmdBindDescriptorBufferEmbeddedSamplersEXT},
+    {"vkGetBufferOpaqueCaptureDescriptorDataEXT", offsetof(VkLayerDispatchTable, GetBufferOpaqueCaptureDescriptorDataEXT), (PFN_vkVoidFunction)loader_lazy_GetBufferOpaqueCaptureDescriptorDataEXT},
+    {"vkGetImageOpaqueCaptureDescriptorDataEXT", offsetof(VkLayerDispatchTable, GetImageOpaqueCaptureDescriptorDataEXT), (PFN_vkVoidFunction)loader_lazy_GetImageOpaqueCaptureDescriptorDataEXT},
+    {"vkGetImageViewOpaqueCaptureDescriptorDataEXT", offsetof(VkLayerDispatchTable, GetImageViewOpaqueCaptureDescriptorDataEXT), (PFN_vkVoidFunction)loader_lazy_GetImageViewOpaqueCaptureDescriptorDataEXT},
+    {"vkGetSamplerOpaqueCaptureDescriptorDataEXT", offsetof(VkLayerDispatchTable, GetSamplerOpaqueCaptureDescriptorDataEXT), (PFN_vkVoidFunction)loader_lazy_GetSamplerOpaqueCaptureDescriptorDataEXT},
+    {"vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT", offsetof(VkLayerDispatchTable, GetAccelerationStructureOpaqueCaptureDescriptorDataEXT), (PFN_vkVoidFunction)loader_lazy_GetAccelerationStructureOpaqueCaptureDescriptorDataEXT},
+    {"vkCmdSetFragmentShadingRateEnumNV", offsetof(VkLayerDispatchTable, CmdSetFragmentShadingRateEnumNV), (PFN_vkVoidFunction)loader_lazy_CmdSetFragmentShadingRateEnumNV},
+    {"vkGetDeviceFaultInfoEXT", offsetof(VkLayerDispatchTable, GetDeviceFaultInfoEXT), (PFN_vkVoidFunction)loader_lazy_GetDeviceFaultInfoEXT},
+    {"vkCmdSetVertexInputEXT", offsetof(VkLayerDispatchTable, CmdSetVertexInputEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetVertexInputEXT},
 #if defined(VK_USE_PLATFORM_FUCHSIA)
-    table->CreateImagePipeSurfaceFUCHSIA = (PFN_vkCreateImagePipeSurfaceFUCHSIA)gpa(inst, "vkCreateImagePipeSurfaceFUCHSIA");
+    {"vkGetMemoryZirconHandleFUCHSIA", offsetof(VkLayerDispatchTable, GetMemoryZirconHandleFUCHSIA), (PFN_vkVoidFunction)loader_lazy_GetMemoryZirconHandleFUCHSIA},
 #endif // VK_USE_PLATFORM_FUCHSIA
-
-    // ---- VK_EXT_metal_surface extension commands
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+    {"vkGetMemoryZirconHandlePropertiesFUCHSIA", offsetof(VkLayerDispatchTable, GetMemoryZirconHandlePropertiesFUCHSIA), (PFN_vkVoidFunction)loader_lazy_GetMemoryZirconHandlePropertiesFUCHSIA},
+#endif // VK_USE_PLATFORM_FUCHSIA
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+    {"vkImportSemaphoreZirconHandleFUCHSIA", offsetof(VkLayerDispatchTable, ImportSemaphoreZirconHandleFUCHSIA), (PFN_vkVoidFunction)loader_lazy_ImportSemaphoreZirconHandleFUCHSIA},
+#endif // VK_USE_PLATFORM_FUCHSIA
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+    {"vkGetSemaphoreZirconHandleFUCHSIA", offsetof(VkLayerDispatchTable, GetSemaphoreZirconHandleFUCHSIA), (PFN_vkVoidFunction)loader_lazy_GetSemaphoreZirconHandleFUCHSIA},
+#endif // VK_USE_PLATFORM_FUCHSIA
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+    {"vkCreateBufferCollectionFUCHSIA", offsetof(VkLayerDispatchTable, CreateBufferCollectionFUCHSIA), (PFN_vkVoidFunction)loader_lazy_CreateBufferCollectionFUCHSIA},
+#endif // VK_USE_PLATFORM_FUCHSIA
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+    {"vkSetBufferCollectionImageConstraintsFUCHSIA", offsetof(VkLayerDispatchTable, SetBufferCollectionImageConstraintsFUCHSIA), (PFN_vkVoidFunction)loader_lazy_SetBufferCollectionImageConstraintsFUCHSIA},
+#endif // VK_USE_PLATFORM_FUCHSIA
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+    {"vkSetBufferCollectionBufferConstraintsFUCHSIA", offsetof(VkLayerDispatchTable, SetBufferCollectionBufferConstraintsFUCHSIA), (PFN_vkVoidFunction)loader_lazy_SetBufferCollectionBufferConstraintsFUCHSIA},
+#endif // VK_USE_PLATFORM_FUCHSIA
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+    {"vkDestroyBufferCollectionFUCHSIA", offsetof(VkLayerDispatchTable, DestroyBufferCollectionFUCHSIA), (PFN_vkVoidFunction)loader_lazy_DestroyBufferCollectionFUCHSIA},
+#endif // VK_USE_PLATFORM_FUCHSIA
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+    {"vkGetBufferCollectionPropertiesFUCHSIA", offsetof(VkLayerDispatchTable, GetBufferCollectionPropertiesFUCHSIA), (PFN_vkVoidFunction)loader_lazy_GetBufferCollectionPropertiesFUCHSIA},
+#endif // VK_USE_PLATFORM_FUCHSIA
+    {"vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI", offsetof(VkLayerDispatchTable, GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI), (PFN_vkVoidFunction)loader_lazy_GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI},
+    {"vkCmdSubpassShadingHUAWEI", offsetof(VkLayerDispatchTable, CmdSubpassShadingHUAWEI), (PFN_vkVoidFunction)loader_lazy_CmdSubpassShadingHUAWEI},
+    {"vkCmdBindInvocationMaskHUAWEI", offsetof(VkLayerDispatchTable, CmdBindInvocationMaskHUAWEI), (PFN_vkVoidFunction)loader_lazy_CmdBindInvocationMaskHUAWEI},
+    {"vkGetMemoryRemoteAddressNV", offsetof(VkLayerDispatchTable, GetMemoryRemoteAddressNV), (PFN_vkVoidFunction)loader_lazy_GetMemoryRemoteAddressNV},
+    {"vkGetPipelinePropertiesEXT", offsetof(VkLayerDispatchTable, GetPipelinePropertiesEXT), (PFN_vkVoidFunction)loader_lazy_GetPipelinePropertiesEXT},
+    {"vkCmdSetPatchControlPointsEXT", offsetof(VkLayerDispatchTable, CmdSetPatchControlPointsEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetPatchControlPointsEXT},
+    {"vkCmdSetRasterizerDiscardEnableEXT", offsetof(VkLayerDispatchTable, CmdSetRasterizerDiscardEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetRasterizerDiscardEnableEXT},
+    {"vkCmdSetDepthBiasEnableEXT", offsetof(VkLayerDispatchTable, CmdSetDepthBiasEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthBiasEnableEXT},
+    {"vkCmdSetLogicOpEXT", offsetof(VkLayerDispatchTable, CmdSetLogicOpEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetLogicOpEXT},
+    {"vkCmdSetPrimitiveRestartEnableEXT", offsetof(VkLayerDispatchTable, CmdSetPrimitiveRestartEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetPrimitiveRestartEnableEXT},
+    {"vkCmdSetColorWriteEnableEXT", offsetof(VkLayerDispatchTable, CmdSetColorWriteEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetColorWriteEnableEXT},
+    {"vkCmdDrawMultiEXT", offsetof(VkLayerDispatchTable, CmdDrawMultiEXT), (PFN_vkVoidFunction)loader_lazy_CmdDrawMultiEXT},
+    {"vkCmdDrawMultiIndexedEXT", offsetof(VkLayerDispatchTable, CmdDrawMultiIndexedEXT), (PFN_vkVoidFunction)loader_lazy_CmdDrawMultiIndexedEXT},
+    {"vkCreateMicromapEXT", offsetof(VkLayerDispatchTable, CreateMicromapEXT), (PFN_vkVoidFunction)loader_lazy_CreateMicromapEXT},
+    {"vkDestroyMicromapEXT", offsetof(VkLayerDispatchTable, DestroyMicromapEXT), (PFN_vkVoidFunction)loader_lazy_DestroyMicromapEXT},
+    {"vkCmdBuildMicromapsEXT", offsetof(VkLayerDispatchTable, CmdBuildMicromapsEXT), (PFN_vkVoidFunction)loader_lazy_CmdBuildMicromapsEXT},
+    {"vkBuildMicromapsEXT", offsetof(VkLayerDispatchTable, BuildMicromapsEXT), (PFN_vkVoidFunction)loader_lazy_BuildMicromapsEXT},
+    {"vkCopyMicromapEXT", offsetof(VkLayerDispatchTable, CopyMicromapEXT), (PFN_vkVoidFunction)loader_lazy_CopyMicromapEXT},
+    {"vkCopyMicromapToMemoryEXT", offsetof(VkLayerDispatchTable, CopyMicromapToMemoryEXT), (PFN_vkVoidFunction)loader_lazy_CopyMicromapToMemoryEXT},
+    {"vkCopyMemoryToMicromapEXT", offsetof(VkLayerDispatchTable, CopyMemoryToMicromapEXT), (PFN_vkVoidFunction)loader_lazy_CopyMemoryToMicromapEXT},
+    {"vkWriteMicromapsPropertiesEXT", offsetof(VkLayerDispatchTable, WriteMicromapsPropertiesEXT), (PFN_vkVoidFunction)loader_lazy_WriteMicromapsPropertiesEXT},
+    {"vkCmdCopyMicromapEXT", offsetof(VkLayerDispatchTable, CmdCopyMicromapEXT), (PFN_vkVoidFunction)loader_lazy_CmdCopyMicromapEXT},
+    {"vkCmdCopyMicromapToMemoryEXT", offsetof(VkLayerDispatchTable, CmdCopyMicromapToMemoryEXT), (PFN_vkVoidFunction)loader_lazy_CmdCopyMicromapToMemoryEXT},
+    {"vkCmdCopyMemoryToMicromapEXT", offsetof(VkLayerDispatchTable, CmdCopyMemoryToMicromapEXT), (PFN_vkVoidFunction)loader_lazy_CmdCopyMemoryToMicromapEXT},
+    {"vkCmdWriteMicromapsPropertiesEXT", offsetof(VkLayerDispatchTable, CmdWriteMicromapsPropertiesEXT), (PFN_vkVoidFunction)loader_lazy_CmdWriteMicromapsPropertiesEXT},
+    {"vkGetDeviceMicromapCompatibilityEXT", offsetof(VkLayerDispatchTable, GetDeviceMicromapCompatibilityEXT), (PFN_vkVoidFunction)loader_lazy_GetDeviceMicromapCompatibilityEXT},
+    {"vkGetMicromapBuildSizesEXT", offsetof(VkLayerDispatchTable, GetMicromapBuildSizesEXT), (PFN_vkVoidFunction)loader_lazy_GetMicromapBuildSizesEXT},
+    {"vkCmdDrawClusterHUAWEI", offsetof(VkLayerDispatchTable, CmdDrawClusterHUAWEI), (PFN_vkVoidFunction)loader_lazy_CmdDrawClusterHUAWEI},
+    {"vkCmdDrawClusterIndirectHUAWEI", offsetof(VkLayerDispatchTable, CmdDrawClusterIndirectHUAWEI), (PFN_vkVoidFunction)loader_lazy_CmdDrawClusterIndirectHUAWEI},
+    {"vkSetDeviceMemoryPriorityEXT", offsetof(VkLayerDispatchTable, SetDeviceMemoryPriorityEXT), (PFN_vkVoidFunction)loader_lazy_SetDeviceMemoryPriorityEXT},
+    {"vkGetDescriptorSetLayoutHostMappingInfoVALVE", offsetof(VkLayerDispatchTable, GetDescriptorSetLayoutHostMappingInfoVALVE), (PFN_vkVoidFunction)loader_lazy_GetDescriptorSetLayoutHostMappingInfoVALVE},
+    {"vkGetDescriptorSetHostMappingVALVE", offsetof(VkLayerDispatchTable, GetDescriptorSetHostMappingVALVE), (PFN_vkVoidFunction)loader_lazy_GetDescriptorSetHostMappingVALVE},
+    {"vkCmdCopyMemoryIndirectNV", offsetof(VkLayerDispatchTable, CmdCopyMemoryIndirectNV), (PFN_vkVoidFunction)loader_lazy_CmdCopyMemoryIndirectNV},
+    {"vkCmdCopyMemoryToImageIndirectNV", offsetof(VkLayerDispatchTable, CmdCopyMemoryToImageIndirectNV), (PFN_vkVoidFunction)loader_lazy_CmdCopyMemoryToImageIndirectNV},
+    {"vkCmdDecompressMemoryNV", offsetof(VkLayerDispatchTable, CmdDecompressMemoryNV), (PFN_vkVoidFunction)loader_lazy_CmdDecompressMemoryNV},
+    {"vkCmdDecompressMemoryIndirectCountNV", offsetof(VkLayerDispatchTable, CmdDecompressMemoryIndirectCountNV), (PFN_vkVoidFunction)loader_lazy_CmdDecompressMemoryIndirectCountNV},
+    {"vkGetPipelineIndirectMemoryRequirementsNV", offsetof(VkLayerDispatchTable, GetPipelineIndirectMemoryRequirementsNV), (PFN_vkVoidFunction)loader_lazy_GetPipelineIndirectMemoryRequirementsNV},
+    {"vkCmdUpdatePipelineIndirectBufferNV", offsetof(VkLayerDispatchTable, CmdUpdatePipelineIndirectBufferNV), (PFN_vkVoidFunction)loader_lazy_CmdUpdatePipelineIndirectBufferNV},
+    {"vkGetPipelineIndirectDeviceAddressNV", offsetof(VkLayerDispatchTable, GetPipelineIndirectDeviceAddressNV), (PFN_vkVoidFunction)loader_lazy_GetPipelineIndirectDeviceAddressNV},
+    {"vkCmdSetDepthClampEnableEXT", offsetof(VkLayerDispatchTable, CmdSetDepthClampEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthClampEnableEXT},
+    {"vkCmdSetPolygonModeEXT", offsetof(VkLayerDispatchTable, CmdSetPolygonModeEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetPolygonModeEXT},
+    {"vkCmdSetRasterizationSamplesEXT", offsetof(VkLayerDispatchTable, CmdSetRasterizationSamplesEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetRasterizationSamplesEXT},
+    {"vkCmdSetSampleMaskEXT", offsetof(VkLayerDispatchTable, CmdSetSampleMaskEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetSampleMaskEXT},
+    {"vkCmdSetAlphaToCoverageEnableEXT", offsetof(VkLayerDispatchTable, CmdSetAlphaToCoverageEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetAlphaToCoverageEnableEXT},
+    {"vkCmdSetAlphaToOneEnableEXT", offsetof(VkLayerDispatchTable, CmdSetAlphaToOneEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetAlphaToOneEnableEXT},
+    {"vkCmdSetLogicOpEnableEXT", offsetof(VkLayerDispatchTable, CmdSetLogicOpEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetLogicOpEnableEXT},
+    {"vkCmdSetColorBlendEnableEXT", offsetof(VkLayerDispatchTable, CmdSetColorBlendEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetColorBlendEnableEXT},
+    {"vkCmdSetColorBlendEquationEXT", offsetof(VkLayerDispatchTable, CmdSetColorBlendEquationEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetColorBlendEquationEXT},
+    {"vkCmdSetColorWriteMaskEXT", offsetof(VkLayerDispatchTable, CmdSetColorWriteMaskEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetColorWriteMaskEXT},
+    {"vkCmdSetTessellationDomainOriginEXT", offsetof(VkLayerDispatchTable, CmdSetTessellationDomainOriginEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetTessellationDomainOriginEXT},
+    {"vkCmdSetRasterizationStreamEXT", offsetof(VkLayerDispatchTable, CmdSetRasterizationStreamEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetRasterizationStreamEXT},
+    {"vkCmdSetConservativeRasterizationModeEXT", offsetof(VkLayerDispatchTable, CmdSetConservativeRasterizationModeEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetConservativeRasterizationModeEXT},
+    {"vkCmdSetExtraPrimitiveOverestimationSizeEXT", offsetof(VkLayerDispatchTable, CmdSetExtraPrimitiveOverestimationSizeEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetExtraPrimitiveOverestimationSizeEXT},
+    {"vkCmdSetDepthClipEnableEXT", offsetof(VkLayerDispatchTable, CmdSetDepthClipEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthClipEnableEXT},
+    {"vkCmdSetSampleLocationsEnableEXT", offsetof(VkLayerDispatchTable, CmdSetSampleLocationsEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetSampleLocationsEnableEXT},
+    {"vkCmdSetColorBlendAdvancedEXT", offsetof(VkLayerDispatchTable, CmdSetColorBlendAdvancedEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetColorBlendAdvancedEXT},
+    {"vkCmdSetProvokingVertexModeEXT", offsetof(VkLayerDispatchTable, CmdSetProvokingVertexModeEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetProvokingVertexModeEXT},
+    {"vkCmdSetLineRasterizationModeEXT", offsetof(VkLayerDispatchTable, CmdSetLineRasterizationModeEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetLineRasterizationModeEXT},
+    {"vkCmdSetLineStippleEnableEXT", offsetof(VkLayerDispatchTable, CmdSetLineStippleEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetLineStippleEnableEXT},
+    {"vkCmdSetDepthClipNegativeOneToOneEXT", offsetof(VkLayerDispatchTable, CmdSetDepthClipNegativeOneToOneEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthClipNegativeOneToOneEXT},
+    {"vkCmdSetViewportWScalingEnableNV", offsetof(VkLayerDispatchTable, CmdSetViewportWScalingEnableNV), (PFN_vkVoidFunction)loader_lazy_CmdSetViewportWScalingEnableNV},
+    {"vkCmdSetViewportSwizzleNV", offsetof(VkLayerDispatchTable, CmdSetViewportSwizzleNV), (PFN_vkVoidFunction)loader_lazy_CmdSetViewportSwizzleNV},
+    {"vkCmdSetCoverageToColorEnableNV", offsetof(VkLayerDispatchTable, CmdSetCoverageToColorEnableNV), (PFN_vkVoidFunction)loader_lazy_CmdSetCoverageToColorEnableNV},
+    {"vkCmdSetCoverageToColorLocationNV", offsetof(VkLayerDispatchTable, CmdSetCoverageToColorLocationNV), (PFN_vkVoidFunction)loader_lazy_CmdSetCoverageToColorLocationNV},
+    {"vkCmdSetCoverageModulationModeNV", offsetof(VkLayerDispatchTable, CmdSetCoverageModulationModeNV), (PFN_vkVoidFunction)loader_lazy_CmdSetCoverageModulationModeNV},
+    {"vkCmdSetCoverageModulationTableEnableNV", offsetof(VkLayerDispatchTable, CmdSetCoverageModulationTableEnableNV), (PFN_vkVoidFunction)loader_lazy_CmdSetCoverageModulationTableEnableNV},
+    {"vkCmdSetCoverageModulationTableNV", offsetof(VkLayerDispatchTable, CmdSetCoverageModulationTableNV), (PFN_vkVoidFunction)loader_lazy_CmdSetCoverageModulationTableNV},
+    {"vkCmdSetShadingRateImageEnableNV", offsetof(VkLayerDispatchTable, CmdSetShadingRateImageEnableNV), (PFN_vkVoidFunction)loader_lazy_CmdSetShadingRateImageEnableNV},
+    {"vkCmdSetRepresentativeFragmentTestEnableNV", offsetof(VkLayerDispatchTable, CmdSetRepresentativeFragmentTestEnableNV), (PFN_vkVoidFunction)loader_lazy_CmdSetRepresentativeFragmentTestEnableNV},
+    {"vkCmdSetCoverageReductionModeNV", offsetof(VkLayerDispatchTable, CmdSetCoverageReductionModeNV), (PFN_vkVoidFunction)loader_lazy_CmdSetCoverageReductionModeNV},
+    {"vkGetShaderModuleIdentifierEXT", offsetof(VkLayerDispatchTable, GetShaderModuleIdentifierEXT), (PFN_vkVoidFunction)loader_lazy_GetShaderModuleIdentifierEXT},
+    {"vkGetShaderModuleCreateInfoIdentifierEXT", offsetof(VkLayerDispatchTable, GetShaderModuleCreateInfoIdentifierEXT), (PFN_vkVoidFunction)loader_lazy_GetShaderModuleCreateInfoIdentifierEXT},
+    {"vkCreateOpticalFlowSessionNV", offsetof(VkLayerDispatchTable, CreateOpticalFlowSessionNV), (PFN_vkVoidFunction)loader_lazy_CreateOpticalFlowSessionNV},
+    {"vkDestroyOpticalFlowSessionNV", offsetof(VkLayerDispatchTable, DestroyOpticalFlowSessionNV), (PFN_vkVoidFunction)loader_lazy_DestroyOpticalFlowSessionNV},
+    {"vkBindOpticalFlowSessionImageNV", offsetof(VkLayerDispatchTable, BindOpticalFlowSessionImageNV), (PFN_vkVoidFunction)loader_lazy_BindOpticalFlowSessionImageNV},
+    {"vkCmdOpticalFlowExecuteNV", offsetof(VkLayerDispatchTable, CmdOpticalFlowExecuteNV), (PFN_vkVoidFunction)loader_lazy_CmdOpticalFlowExecuteNV},
+    {"vkAntiLagUpdateAMD", offsetof(VkLayerDispatchTable, AntiLagUpdateAMD), (PFN_vkVoidFunction)loader_lazy_AntiLagUpdateAMD},
+    {"vkCreateShadersEXT", offsetof(VkLayerDispatchTable, CreateShadersEXT), (PFN_vkVoidFunction)loader_lazy_CreateShadersEXT},
+    {"vkDestroyShaderEXT", offsetof(VkLayerDispatchTable, DestroyShaderEXT), (PFN_vkVoidFunction)loader_lazy_DestroyShaderEXT},
+    {"vkGetShaderBinaryDataEXT", offsetof(VkLayerDispatchTable, GetShaderBinaryDataEXT), (PFN_vkVoidFunction)loader_lazy_GetShaderBinaryDataEXT},
+    {"vkCmdBindShadersEXT", offsetof(VkLayerDispatchTable, CmdBindShadersEXT), (PFN_vkVoidFunction)loader_lazy_CmdBindShadersEXT},
+    {"vkCmdSetDepthClampRangeEXT", offsetof(VkLayerDispatchTable, CmdSetDepthClampRangeEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetDepthClampRangeEXT},
+    {"vkGetFramebufferTilePropertiesQCOM", offsetof(VkLayerDispatchTable, GetFramebufferTilePropertiesQCOM), (PFN_vkVoidFunction)loader_lazy_GetFramebufferTilePropertiesQCOM},
+    {"vkGetDynamicRenderingTilePropertiesQCOM", offsetof(VkLayerDispatchTable, GetDynamicRenderingTilePropertiesQCOM), (PFN_vkVoidFunction)loader_lazy_GetDynamicRenderingTilePropertiesQCOM},
+    {"vkConvertCooperativeVectorMatrixNV", offsetof(VkLayerDispatchTable, ConvertCooperativeVectorMatrixNV), (PFN_vkVoidFunction)loader_lazy_ConvertCooperativeVectorMatrixNV},
+    {"vkCmdConvertCooperativeVectorMatrixNV", offsetof(VkLayerDispatchTable, CmdConvertCooperativeVectorMatrixNV), (PFN_vkVoidFunction)loader_lazy_CmdConvertCooperativeVectorMatrixNV},
+    {"vkSetLatencySleepModeNV", offsetof(VkLayerDispatchTable, SetLatencySleepModeNV), (PFN_vkVoidFunction)loader_lazy_SetLatencySleepModeNV},
+    {"vkLatencySleepNV", offsetof(VkLayerDispatchTable, LatencySleepNV), (PFN_vkVoidFunction)loader_lazy_LatencySleepNV},
+    {"vkSetLatencyMarkerNV", offsetof(VkLayerDispatchTable, SetLatencyMarkerNV), (PFN_vkVoidFunction)loader_lazy_SetLatencyMarkerNV},
+    {"vkGetLatencyTimingsNV", offsetof(VkLayerDispatchTable, GetLatencyTimingsNV), (PFN_vkVoidFunction)loader_lazy_GetLatencyTimingsNV},
+    {"vkQueueNotifyOutOfBandNV", offsetof(VkLayerDispatchTable, QueueNotifyOutOfBandNV), (PFN_vkVoidFunction)loader_lazy_QueueNotifyOutOfBandNV},
+    {"vkCmdSetAttachmentFeedbackLoopEnableEXT", offsetof(VkLayerDispatchTable, CmdSetAttachmentFeedbackLoopEnableEXT), (PFN_vkVoidFunction)loader_lazy_CmdSetAttachmentFeedbackLoopEnableEXT},
+#if defined(VK_USE_PLATFORM_SCREEN_QNX)
+    {"vkGetScreenBufferPropertiesQNX", offsetof(VkLayerDispatchTable, GetScreenBufferPropertiesQNX), (PFN_vkVoidFunction)loader_lazy_GetScreenBufferPropertiesQNX},
+#endif // VK_USE_PLATFORM_SCREEN_QNX
+    {"vkGetClusterAccelerationStructureBuildSizesNV", offsetof(VkLayerDispatchTable, GetClusterAccelerationStructureBuildSizesNV), (PFN_vkVoidFunction)loader_lazy_GetClusterAccelerationStructureBuildSizesNV},
+    {"vkCmdBuildClusterAccelerationStructureIndirectNV", offsetof(VkLayerDispatchTable, CmdBuildClusterAccelerationStructureIndirectNV), (PFN_vkVoidFunction)loader_lazy_CmdBuildClusterAccelerationStructureIndirectNV},
+    {"vkGetPartitionedAccelerationStructuresBuildSizesNV", offsetof(VkLayerDispatchTable, GetPartitionedAccelerationStructuresBuildSizesNV), (PFN_vkVoidFunction)loader_lazy_GetPartitionedAccelerationStructuresBuildSizesNV},
+    {"vkCmdBuildPartitionedAccelerationStructuresNV", offsetof(VkLayerDispatchTable, CmdBuildPartitionedAccelerationStructuresNV), (PFN_vkVoidFunction)loader_lazy_CmdBuildPartitionedAccelerationStructuresNV},
+    {"vkGetGeneratedCommandsMemoryRequirementsEXT", offsetof(VkLayerDispatchTable, GetGeneratedCommandsMemoryRequirementsEXT), (PFN_vkVoidFunction)loader_lazy_GetGeneratedCommandsMemoryRequirementsEXT},
+    {"vkCmdPreprocessGeneratedCommandsEXT", offsetof(VkLayerDispatchTable, CmdPreprocessGeneratedCommandsEXT), (PFN_vkVoidFunction)loader_lazy_CmdPreprocessGeneratedCommandsEXT},
+    {"vkCmdExecuteGeneratedCommandsEXT", offsetof(VkLayerDispatchTable, CmdExecuteGeneratedCommandsEXT), (PFN_vkVoidFunction)loader_lazy_CmdExecuteGeneratedCommandsEXT},
+    {"vkCreateIndirectCommandsLayoutEXT", offsetof(VkLayerDispatchTable, CreateIndirectCommandsLayoutEXT), (PFN_vkVoidFunction)loader_lazy_CreateIndirectCommandsLayoutEXT},
+    {"vkDestroyIndirectCommandsLayoutEXT", offsetof(VkLayerDispatchTable, DestroyIndirectCommandsLayoutEXT), (PFN_vkVoidFunction)loader_lazy_DestroyIndirectCommandsLayoutEXT},
+    {"vkCreateIndirectExecutionSetEXT", offsetof(VkLayerDispatchTable, CreateIndirectExecutionSetEXT), (PFN_vkVoidFunction)loader_lazy_CreateIndirectExecutionSetEXT},
+    {"vkDestroyIndirectExecutionSetEXT", offsetof(VkLayerDispatchTable, DestroyIndirectExecutionSetEXT), (PFN_vkVoidFunction)loader_lazy_DestroyIndirectExecutionSetEXT},
+    {"vkUpdateIndirectExecutionSetPipelineEXT", offsetof(VkLayerDispatchTable, UpdateIndirectExecutionSetPipelineEXT), (PFN_vkVoidFunction)loader_lazy_UpdateIndirectExecutionSetPipelineEXT},
+    {"vkUpdateIndirectExecutionSetShaderEXT", offsetof(VkLayerDispatchTable, UpdateIndirectExecutionSetShaderEXT), (PFN_vkVoidFunction)loader_lazy_UpdateIndirectExecutionSetShaderEXT},
 #if defined(VK_USE_PLATFORM_METAL_EXT)
-    table->CreateMetalSurfaceEXT = (PFN_vkCreateMetalSurfaceEXT)gpa(inst, "vkCreateMetalSurfaceEXT");
+    {"vkGetMemoryMetalHandleEXT", offsetof(VkLayerDispatchTable, GetMemoryMetalHandleEXT), (PFN_vkVoidFunction)loader_lazy_GetMemoryMetalHandleEXT},
 #endif // VK_USE_PLATFORM_METAL_EXT
+#if defined(VK_USE_PLATFORM_METAL_EXT)
+    {"vkGetMemoryMetalHandlePropertiesEXT", offsetof(VkLayerDispatchTable, GetMemoryMetalHandlePropertiesEXT), (PFN_vkVoidFunction)loader_lazy_GetMemoryMetalHandlePropertiesEXT},
+#endif // VK_USE_PLATFORM_METAL_EXT
+    {"vkCreateAccelerationStructureKHR", offsetof(VkLayerDispatchTable, CreateAccelerationStructureKHR), (PFN_vkVoidFunction)loader_lazy_CreateAccelerationStructureKHR},
+    {"vkDestroyAccelerationStructureKHR", offsetof(VkLayerDispatchTable, DestroyAccelerationStructureKHR), (PFN_vkVoidFunction)loader_lazy_DestroyAccelerationStructureKHR},
+    {"vkCmdBuildAccelerationStructuresKHR", offsetof(VkLayerDispatchTable, CmdBuildAccelerationStructuresKHR), (PFN_vkVoidFunction)loader_lazy_CmdBuildAccelerationStructuresKHR},
+    {"vkCmdBuildAccelerationStructuresIndirectKHR", offsetof(VkLayerDispatchTable, CmdBuildAccelerationStructuresIndirectKHR), (PFN_vkVoidFunction)loader_lazy_CmdBuildAccelerationStructuresIndirectKHR},
+    {"vkBuildAccelerationStructuresKHR", offsetof(VkLayerDispatchTable, BuildAccelerationStructuresKHR), (PFN_vkVoidFunction)loader_lazy_BuildAccelerationStructuresKHR},
+    {"vkCopyAccelerationStructureKHR", offsetof(VkLayerDispatchTable, CopyAccelerationStructureKHR), (PFN_vkVoidFunction)loader_lazy_CopyAccelerationStructureKHR},
+    {"vkCopyAccelerationStructureToMemoryKHR", offsetof(VkLayerDispatchTable, CopyAccelerationStructureToMemoryKHR), (PFN_vkVoidFunction)loader_lazy_CopyAccelerationStructureToMemoryKHR},
+    {"vkCopyMemoryToAccelerationStructureKHR", offsetof(VkLayerDispatchTable, CopyMemoryToAccelerationStructureKHR), (PFN_vkVoidFunction)loader_lazy_CopyMemoryToAccelerationStructureKHR},
+    {"vkWriteAccelerationStructuresPropertiesKHR", offsetof(VkLayerDispatchTable, WriteAccelerationStructuresPropertiesKHR), (PFN_vkVoidFunction)loader_lazy_WriteAccelerationStructuresPropertiesKHR},
+    {"vkCmdCopyAccelerationStructureKHR", offsetof(VkLayerDispatchTable, CmdCopyAccelerationStructureKHR), (PFN_vkVoidFunction)loader_lazy_CmdCopyAccelerationStructureKHR},
+    {"vkCmdCopyAccelerationStructureToMemoryKHR", offsetof(VkLayerDispatchTable, CmdCopyAccelerationStructureToMemoryKHR), (PFN_vkVoidFunction)loader_lazy_CmdCopyAccelerationStructureToMemoryKHR},
+    {"vkCmdCopyMemoryToAccelerationStructureKHR", offsetof(VkLayerDispatchTable, CmdCopyMemoryToAccelerationStructureKHR), (PFN_vkVoidFunction)loader_lazy_CmdCopyMemoryToAccelerationStructureKHR},
+    {"vkGetAccelerationStructureDeviceAddressKHR", offsetof(VkLayerDispatchTable, GetAccelerationStructureDeviceAddressKHR), (PFN_vkVoidFunction)loader_lazy_GetAccelerationStructureDeviceAddressKHR},
+    {"vkCmdWriteAccelerationStructuresPropertiesKHR", offsetof(VkLayerDispatchTable, CmdWriteAccelerationStructuresPropertiesKHR), (PFN_vkVoidFunction)loader_lazy_CmdWriteAccelerationStructuresPropertiesKHR},
+    {"vkGetDeviceAccelerationStructureCompatibilityKHR", offsetof(VkLayerDispatchTable, GetDeviceAccelerationStructureCompatibilityKHR), (PFN_vkVoidFunction)loader_lazy_GetDeviceAccelerationStructureCompatibilityKHR},
+    {"vkGetAccelerationStructureBuildSizesKHR", offsetof(VkLayerDispatchTable, GetAccelerationStructureBuildSizesKHR), (PFN_vkVoidFunction)loader_lazy_GetAccelerationStructureBuildSizesKHR},
+    {"vkCmdTraceRaysKHR", offsetof(VkLayerDispatchTable, CmdTraceRaysKHR), (PFN_vkVoidFunction)loader_lazy_CmdTraceRaysKHR},
+    {"vkCreateRayTracingPipelinesKHR", offsetof(VkLayerDispatchTable, CreateRayTracingPipelinesKHR), (PFN_vkVoidFunction)loader_lazy_CreateRayTracingPipelinesKHR},
+    {"vkGetRayTracingCaptureReplayShaderGroupHandlesKHR", offsetof(VkLayerDispatchTable, GetRayTracingCaptureReplayShaderGroupHandlesKHR), (PFN_vkVoidFunction)loader_lazy_GetRayTracingCaptureReplayShaderGroupHandlesKHR},
+    {"vkCmdTraceRaysIndirectKHR", offsetof(VkLayerDispatchTable, CmdTraceRaysIndirectKHR), (PFN_vkVoidFunction)loader_lazy_CmdTraceRaysIndirectKHR},
+    {"vkGetRayTracingShaderGroupStackSizeKHR", offsetof(VkLayerDispatchTable, GetRayTracingShaderGroupStackSizeKHR), (PFN_vkVoidFunction)loader_lazy_GetRayTracingShaderGroupStackSizeKHR},
+    {"vkCmdSetRayTracingPipelineStackSizeKHR", offsetof(VkLayerDispatchTable, CmdSetRayTracingPipelineStackSizeKHR), (PFN_vkVoidFunction)loader_lazy_CmdSetRayTracingPipelineStackSizeKHR},
+    {"vkCmdDrawMeshTasksEXT", offsetof(VkLayerDispatchTable, CmdDrawMeshTasksEXT), (PFN_vkVoidFunction)loader_lazy_CmdDrawMeshTasksEXT},
+    {"vkCmdDrawMeshTasksIndirectEXT", offsetof(VkLayerDispatchTable, CmdDrawMeshTasksIndirectEXT), (PFN_vkVoidFunction)loader_lazy_CmdDrawMeshTasksIndirectEXT},
+    {"vkCmdDrawMeshTasksIndirectCountEXT", offsetof(VkLayerDispatchTable, CmdDrawMeshTasksIndirectCountEXT), (PFN_vkVoidFunction)loader_lazy_CmdDrawMeshTasksIndirectCountEXT},
+#if defined(VK_USE_PLATFORM_OHOS)
+    {"vkGetSwapchainGrallocUsageOHOS", offsetof(VkLayerDispatchTable, GetSwapchainGrallocUsageOHOS), (PFN_vkVoidFunction)loader_lazy_GetSwapchainGrallocUsageOHOS},
+#endif // VK_USE_PLATFORM_OHOS
+#if defined(VK_USE_PLATFORM_OHOS)
+    {"vkAcquireImageOHOS", offsetof(VkLayerDispatchTable, AcquireImageOHOS), (PFN_vkVoidFunction)loader_lazy_AcquireImageOHOS},
+#endif // VK_USE_PLATFORM_OHOS
+#if defined(VK_USE_PLATFORM_OHOS)
+    {"vkQueueSignalReleaseImageOHOS", offsetof(VkLayerDispatchTable, QueueSignalReleaseImageOHOS), (PFN_vkVoidFunction)loader_lazy_QueueSignalReleaseImageOHOS},
+#endif // VK_USE_PLATFORM_OHOS
+#if defined(VK_USE_PLATFORM_OHOS)
+    {"vkGetNativeBufferPropertiesOHOS", offsetof(VkLayerDispatchTable, GetNativeBufferPropertiesOHOS), (PFN_vkVoidFunction)loader_lazy_GetNativeBufferPropertiesOHOS},
+#endif // VK_USE_PLATFORM_OHOS
+#if defined(VK_USE_PLATFORM_OHOS)
+    {"vkGetMemoryNativeBufferOHOS", offsetof(VkLayerDispatchTable, GetMemoryNativeBufferOHOS), (PFN_vkVoidFunction)loader_lazy_GetMemoryNativeBufferOHOS},
+#endif // VK_USE_PLATFORM_OHOS
+};
 
-    // ---- VK_EXT_tooling_info extension commands
-    table->GetPhysicalDeviceToolPropertiesEXT = (PFN_vkGetPhysicalDeviceToolPropertiesEXT)gpa(inst, "vkGetPhysicalDeviceToolPropertiesEXT");
-
-    // ---- VK_NV_cooperative_matrix extension commands
-    table->GetPhysicalDeviceCooperativeMatrixPropertiesNV = (PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV)gpa(inst, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
-
-    // ---- VK_NV_coverage_reduction_mode extension commands
-    table->GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV = (PFN_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV)gpa(inst, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
-
-    // ---- VK_EXT_full_screen_exclusive extension commands
-#if defined(VK_USE_PLATFORM_WIN32_KHR)
-    table->GetPhysicalDeviceSurfacePresentModes2EXT = (PFN_vkGetPhysicalDeviceSurfacePresentModes2EXT)gpa(inst, "vkGetPhysicalDeviceSurfacePresentModes2EXT");
-#endif // VK_USE_PLATFORM_WIN32_KHR
+static void loader_set_lazy_device_stubs(VkLayerDispatchTable *table, const struct loader_lazy_device_command *commands, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        *(PFN_vkVoidFunction *)((uint8_t *)table + commands[i].offset) = commands[i].stub;
+    }
+}
 
-    // ---- VK_EXT_headless_surface extension commands
-    table->CreateHeadlessSurfaceEXT = (PFN_vkCreateHeadlessSurfaceEXT)gpa(inst, "vkCreateHeadlessSurfaceEXT");
+// Init Device function pointer dispatch table with resolve-on-first-call stubs for the core commands
+VKAPI_ATTR void VKAPI_CALL loader_init_lazy_device_dispatch_table(struct loader_dev_dispatch_table *dev_table, PFN_vkGetDeviceProcAddr gpa) {
+    VkLayerDispatchTable *table = &dev_table->core_dispatch;
+    if (table->magic != DEVICE_DISP_TABLE_MAGIC_NUMBER) { abort(); }
+    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) dev_table->ext_dispatch[i] = (PFN_vkDevExt)vkDevExtError;
 
-    // ---- VK_EXT_acquire_drm_display extension commands
-    table->AcquireDrmDisplayEXT = (PFN_vkAcquireDrmDisplayEXT)gpa(inst, "vkAcquireDrmDisplayEXT");
-    table->GetDrmDisplayEXT = (PFN_vkGetDrmDisplayEXT)gpa(inst, "vkGetDrmDisplayEXT");
+    table->GetDeviceProcAddr = gpa;
+    loader_set_lazy_device_stubs(table, loader_lazy_device_core_commands,
+                                 sizeof(loader_lazy_device_core_commands) / sizeof(loader_lazy_device_core_commands[0]));
+}
 
-    // ---- VK_NV_acquire_winrt_display extension commands
-#if defined(VK_USE_PLATFORM_WIN32_KHR)
-    table->AcquireWinrtDisplayNV = (PFN_vkAcquireWinrtDisplayNV)gpa(inst, "vkAcquireWinrtDisplayNV");
-#endif // VK_USE_PLATFORM_WIN32_KHR
-#if defined(VK_USE_PLATFORM_WIN32_KHR)
-    table->GetWinrtDisplayNV = (PFN_vkGetWinrtDisplayNV)gpa(inst, "vkGetWinrtDisplayNV");
-#endif // VK_USE_PLATFORM_WIN32_KHR
+// Init Device function pointer dispatch table with resolve-on-first-call stubs for the extension commands
+VKAPI_ATTR void VKAPI_CALL loader_init_lazy_device_extension_dispatch_table(struct loader_dev_dispatch_table *dev_table,
+                                                                            PFN_vkGetInstanceProcAddr gipa,
+                                                                            PFN_vkGetDeviceProcAddr gdpa,
+                                                                            VkInstance inst,
+                                                                            VkDevice dev) {
+    VkLayerDispatchTable *table = &dev_table->core_dispatch;
+    table->magic = DEVICE_DISP_TABLE_MAGIC_NUMBER;
 
-    // ---- VK_EXT_directfb_surface extension commands
-#if defined(VK_USE_PLATFORM_DIRECTFB_EXT)
-    table->CreateDirectFBSurfaceEXT = (PFN_vkCreateDirectFBSurfaceEXT)gpa(inst, "vkCreateDirectFBSurfaceEXT");
-#endif // VK_USE_PLATFORM_DIRECTFB_EXT
-#if defined(VK_USE_PLATFORM_DIRECTFB_EXT)
-    table->GetPhysicalDeviceDirectFBPresentationSupportEXT = (PFN_vkGetPhysicalDeviceDirectFBPresentationSupportEXT)gpa(inst, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
-#endif // VK_USE_PLATFORM_DIRECTFB_EXT
+    loader_set_lazy_device_stubs(table, loader_lazy_device_extension_commands,
+                                 sizeof(loader_lazy_device_extension_commands) / sizeof(loader_lazy_device_extension_commands[0]));
 
-    // ---- VK_QNX_screen_surface extension commands
-#if defined(VK_USE_PLATFORM_SCREEN_QNX)
-    table->CreateScreenSurfaceQNX = (PFN_vkCreateScreenSurfaceQNX)gpa(inst, "vkCreateScreenSurfaceQNX");
-#endif // VK_USE_PLATFORM_SCREEN_QNX
-#if defined(VK_USE_PLATFORM_SCREEN_QNX)
-    table->GetPhysicalDeviceScreenPresentationSupportQNX = (PFN_vkGetPhysicalDeviceScreenPresentationSupportQNX)gpa(inst, "vkGetPhysicalDeviceScreenPresentationSupportQNX");
-#endif // VK_USE_PLATFORM_SCREEN_QNX
+    // Commands which are not resolved lazily
+    table->CreateSwapchainKHR = (PFN_vkCreateSwapchainKHR)gdpa(dev, "vkCreateSwapchainKHR");
+    table->SetDebugUtilsObjectNameEXT = (PFN_vkSetDebugUtilsObjectNameEXT)gipa(inst, "vkSetDebugUtilsObjectNameEXT");
+    table->SetDebugUtilsObjectTagEXT = (PFN_vkSetDebugUtilsObjectTagEXT)gipa(inst, "vkSetDebugUtilsObjectTagEXT");
+    table->QueueBeginDebugUtilsLabelEXT = (PFN_vkQueueBeginDebugUtilsLabelEXT)gipa(inst, "vkQueueBeginDebugUtilsLabelEXT");
+    table->QueueEndDebugUtilsLabelEXT = (PFN_vkQueueEndDebugUtilsLabelEXT)gipa(inst, "vkQueueEndDebugUtilsLabelEXT");
+    table->QueueInsertDebugUtilsLabelEXT = (PFN_vkQueueInsertDebugUtilsLabelEXT)gipa(inst, "vkQueueInsertDebugUtilsLabelEXT");
+    table->CmdBeginDebugUtilsLabelEXT = (PFN_vkCmdBeginDebugUtilsLabelEXT)gipa(inst, "vkCmdBeginDebugUtilsLabelEXT");
+    table->CmdEndDebugUtilsLabelEXT = (PFN_vkCmdEndDebugUtilsLabelEXT)gipa(inst, "vkCmdEndDebugUtilsLabelEXT");
+    table->CmdInsertDebugUtilsLabelEXT = (PFN_vkCmdInsertDebugUtilsLabelEXT)gipa(inst, "vkCmdInsertDebugUtilsLabelEXT");
+}
 
-    // ---- VK_NV_optical_flow extension commands
-    table->GetPhysicalDeviceOpticalFlowImageFormatsNV = (PFN_vkGetPhysicalDeviceOpticalFlowImageFormatsNV)gpa(inst, "vkGetPhysicalDeviceOpticalFlowImageFormatsNV");
+// Maps each stub to its entry in the command lists above. Only written in loader_initialize and loader_release.
+static struct loader_handle_map loader_lazy_device_stub_map;
 
-#if defined(VK_USE_PLATFORM_OHOS)
-    table->CreateSurfaceOHOS = (PFN_vkCreateSurfaceOHOS)gpa(inst, "vkCreateSurfaceOHOS");
-#endif // VK_USE_PLATFORM_OHOS
+VKAPI_ATTR VkResult VKAPI_CALL loader_init_lazy_device_stub_map(void) {
+    const struct loader_lazy_device_command *lists[2] = {loader_lazy_device_core_commands, loader_lazy_device_extension_commands};
+    size_t counts[2] = {sizeof(loader_lazy_device_core_commands) / sizeof(loader_lazy_device_core_commands[0]),
+                        sizeof(loader_lazy_device_extension_commands) / sizeof(loader_lazy_device_extension_commands[0])};
+    VkResult res = loader_init_handle_map(NULL, &loader_lazy_device_stub_map, (uint32_t)(counts[0] + counts[1]));
+    for (uint32_t list = 0; list < 2 && VK_SUCCESS == res; list++) {
+        for (size_t i = 0; i < counts[list] && VK_SUCCESS == res; i++) {
+            res = loader_handle_map_insert(NULL, &loader_lazy_device_stub_map, (const void *)lists[list][i].stub,
+                                           (void *)&lists[list][i]);
+        }
+    }
+    if (VK_SUCCESS != res) {
+        loader_destroy_handle_map(NULL, &loader_lazy_device_stub_map);
+    }
+    return res;
+}
 
-    // ---- VK_NV_cooperative_vector extension commands
-    table->GetPhysicalDeviceCooperativeVectorPropertiesNV = (PFN_vkGetPhysicalDeviceCooperativeVectorPropertiesNV)gpa(inst, "vkGetPhysicalDeviceCooperativeVectorPropertiesNV");
+VKAPI_ATTR void VKAPI_CALL loader_destroy_lazy_device_stub_map(void) {
+    loader_destroy_handle_map(NULL, &loader_lazy_device_stub_map);
+}
 
-    // ---- VK_NV_cooperative_matrix2 extension commands
-    table->GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV = (PFN_vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV)gpa(inst, "vkGetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV");
+// If addr is one of the stubs, resolves its command and returns that instead
+VKAPI_ATTR void* VKAPI_CALL loader_resolve_lazy_device_stub(VkLayerDispatchTable *table, void *addr) {
+    const struct loader_lazy_device_command *command = loader_handle_map_find(&loader_lazy_device_stub_map, addr);
+    if (NULL == command) {
+        return addr;
+    }
+    return (void *)loader_resolve_lazy_device_command(table, command->name,
+                                                      (PFN_vkVoidFunction *)((uint8_t *)table + command->offset));
 }
 
 // Functions that required a terminator need to have a separate dispatch table which contains their corresponding
 // device function. This is used in the terminators themselves.
 void init_extension_device_proc_terminator_dispatch(struct loader_device *dev) {
     struct loader_device_terminator_dispatch* dispatch = &dev->loader_dispatch.extension_terminator_dispatch;
-    PFN_vkGetDeviceProcAddr gpda = (PFN_vkGetDeviceProcAddr)dev->phys_dev_term->this_icd_term->dispatch.GetDeviceProcAddr;
+    PFN_vkGetDeviceProcAddr gpda = (PFN_vkGetDeviceProcAddr)ICD_DISPATCH(dev->phys_dev_term->this_icd_term, GetDeviceProcAddr);
     // ---- VK_KHR_swapchain extension commands
     if (dev->driver_extensions.khr_swapchain_enabled)
        dispatch->CreateSwapchainKHR = (PFN_vkCreateSwapchainKHR)gpda(dev->icd_device, "vkCreateSwapchainKHR");
@@ -3502,12 +10622,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceVideoCapabilitiesKHR(
     VkVideoCapabilitiesKHR*                     pCapabilities) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceVideoCapabilitiesKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceVideoCapabilitiesKHR)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDeviceVideoCapabilitiesKHR");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.GetPhysicalDeviceVideoCapabilitiesKHR(phys_dev_term->phys_dev, pVideoProfile, pCapabilities);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceVideoCapabilitiesKHR)(phys_dev_term->phys_dev, pVideoProfile, pCapabilities);
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceVideoFormatPropertiesKHR(
@@ -3534,12 +10654,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceVideoFormatProperties
     VkVideoFormatPropertiesKHR*                 pVideoFormatProperties) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceVideoFormatPropertiesKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceVideoFormatPropertiesKHR)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDeviceVideoFormatPropertiesKHR");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.GetPhysicalDeviceVideoFormatPropertiesKHR(phys_dev_term->phys_dev, pVideoFormatInfo, pVideoFormatPropertyCount, pVideoFormatProperties);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceVideoFormatPropertiesKHR)(phys_dev_term->phys_dev, pVideoFormatInfo, pVideoFormatPropertyCount, pVideoFormatProperties);
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionKHR(
@@ -4177,12 +11297,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumeratePhysicalDeviceQueueFamilyPerf
     VkPerformanceCounterDescriptionKHR*         pCounterDescriptions) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(phys_dev_term->phys_dev, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
+    return ICD_DISPATCH(icd_term, EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR)(phys_dev_term->phys_dev, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
 }
 
 VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(
@@ -4207,12 +11327,12 @@ VKAPI_ATTR void VKAPI_CALL terminator_GetPhysicalDeviceQueueFamilyPerformanceQue
     uint32_t*                                   pNumPasses) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    icd_term->dispatch.GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(phys_dev_term->phys_dev, pPerformanceQueryCreateInfo, pNumPasses);
+    ICD_DISPATCH(icd_term, GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR)(phys_dev_term->phys_dev, pPerformanceQueryCreateInfo, pNumPasses);
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL AcquireProfilingLockKHR(
@@ -4474,12 +11594,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceFragmentShadingRatesK
     VkPhysicalDeviceFragmentShadingRateKHR*     pFragmentShadingRates) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceFragmentShadingRatesKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceFragmentShadingRatesKHR)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDeviceFragmentShadingRatesKHR");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.GetPhysicalDeviceFragmentShadingRatesKHR(phys_dev_term->phys_dev, pFragmentShadingRateCount, pFragmentShadingRates);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceFragmentShadingRatesKHR)(phys_dev_term->phys_dev, pFragmentShadingRateCount, pFragmentShadingRates);
 }
 
 VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateKHR(
@@ -4758,12 +11878,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceVideoEncodeQualityLev
     VkVideoEncodeQualityLevelPropertiesKHR*     pQualityLevelProperties) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR(phys_dev_term->phys_dev, pQualityLevelInfo, pQualityLevelProperties);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR)(phys_dev_term->phys_dev, pQualityLevelInfo, pQualityLevelProperties);
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL GetEncodedVideoSessionParametersKHR(
@@ -5190,12 +12310,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceCooperativeMatrixProp
     VkCooperativeMatrixPropertiesKHR*           pProperties) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceCooperativeMatrixPropertiesKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceCooperativeMatrixPropertiesKHR)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDeviceCooperativeMatrixPropertiesKHR");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.GetPhysicalDeviceCooperativeMatrixPropertiesKHR(phys_dev_term->phys_dev, pPropertyCount, pProperties);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceCooperativeMatrixPropertiesKHR)(phys_dev_term->phys_dev, pPropertyCount, pProperties);
 }
 
 
@@ -5240,12 +12360,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceCalibrateableTimeDoma
     VkTimeDomainKHR*                            pTimeDomains) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceCalibrateableTimeDomainsKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceCalibrateableTimeDomainsKHR)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDeviceCalibrateableTimeDomainsKHR");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.GetPhysicalDeviceCalibrateableTimeDomainsKHR(phys_dev_term->phys_dev, pTimeDomainCount, pTimeDomains);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceCalibrateableTimeDomainsKHR)(phys_dev_term->phys_dev, pTimeDomainCount, pTimeDomains);
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsKHR(
@@ -5390,10 +12510,17 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_DebugMarkerSetObjectTagEXT(
     // If this is a KHR_surface, and the ICD has created its own, we have to replace it with the proper one for the next call.
     } else if (pTagInfo->objectType == VK_DEBUG_REPORT_OBJECT_TYPE_SURFACE_KHR_EXT) {
         if (NULL != dev && NULL != dev->loader_dispatch.core_dispatch.CreateSwapchainKHR) {
-            VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)pTagInfo->object;
-            if (NULL != icd_term->surface_list.list && icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR)
-                && icd_term->surface_list.list[icd_surface->surface_index]) {
-                local_tag_info.object = (uint64_t)icd_term->surface_list.list[icd_surface->surface_index];
+            VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;
+            VkResult res = wsi_unwrap_icd_surface(icd_term, (VkSurfaceKHR)(uintptr_t)pTagInfo->object, &unwrapped_surface);
+            // The driver has no surface to name if it failed to make one
+            if (VK_ERROR_SURFACE_LOST_KHR == res) {
+                return VK_SUCCESS;
+            }
+            if (VK_SUCCESS != res) {
+                return res;
+            }
+            if (VK_NULL_HANDLE != unwrapped_surface) {
+                local_tag_info.object = (uint64_t)unwrapped_surface;
             }
         }
     // If this is an instance we have to replace it with the proper one for the next call.
@@ -5449,10 +12576,17 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_DebugMarkerSetObjectNameEXT(
     // If this is a KHR_surface, and the ICD has created its own, we have to replace it with the proper one for the next call.
     } else if (pNameInfo->objectType == VK_DEBUG_REPORT_OBJECT_TYPE_SURFACE_KHR_EXT) {
         if (NULL != dev && NULL != dev->loader_dispatch.core_dispatch.CreateSwapchainKHR) {
-            VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)pNameInfo->object;
-            if (NULL != icd_term->surface_list.list && icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR)
-                && icd_term->surface_list.list[icd_surface->surface_index]) {
-                local_name_info.object = (uint64_t)icd_term->surface_list.list[icd_surface->surface_index];
+            VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;
+            VkResult res = wsi_unwrap_icd_surface(icd_term, (VkSurfaceKHR)(uintptr_t)pNameInfo->object, &unwrapped_surface);
+            // The driver has no surface to name if it failed to make one
+            if (VK_ERROR_SURFACE_LOST_KHR == res) {
+                return VK_SUCCESS;
+            }
+            if (VK_SUCCESS != res) {
+                return res;
+            }
+            if (VK_NULL_HANDLE != unwrapped_surface) {
+                local_name_info.object = (uint64_t)unwrapped_surface;
             }
         }
     // If this is an instance we have to replace it with the proper one for the next call.
@@ -6053,10 +13187,17 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_SetDebugUtilsObjectNameEXT(
     // If this is a KHR_surface, and the ICD has created its own, we have to replace it with the proper one for the next call.
     } else if (pNameInfo->objectType == VK_OBJECT_TYPE_SURFACE_KHR) {
         if (NULL != dev && NULL != dev->loader_dispatch.core_dispatch.CreateSwapchainKHR) {
-            VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)pNameInfo->objectHandle;
-            if (NULL != icd_term->surface_list.list && icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR)
-                && icd_term->surface_list.list[icd_surface->surface_index]) {
-                local_name_info.objectHandle = (uint64_t)icd_term->surface_list.list[icd_surface->surface_index];
+            VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;
+            VkResult res = wsi_unwrap_icd_surface(icd_term, (VkSurfaceKHR)(uintptr_t)pNameInfo->objectHandle, &unwrapped_surface);
+            // The driver has no surface to name if it failed to make one
+            if (VK_ERROR_SURFACE_LOST_KHR == res) {
+                return VK_SUCCESS;
+            }
+            if (VK_SUCCESS != res) {
+                return res;
+            }
+            if (VK_NULL_HANDLE != unwrapped_surface) {
+                local_name_info.objectHandle = (uint64_t)unwrapped_surface;
             }
         }
     // If this is an instance we have to replace it with the proper one for the next call.
@@ -6116,10 +13257,17 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_SetDebugUtilsObjectTagEXT(
     // If this is a KHR_surface, and the ICD has created its own, we have to replace it with the proper one for the next call.
     } else if (pTagInfo->objectType == VK_OBJECT_TYPE_SURFACE_KHR) {
         if (NULL != dev && NULL != dev->loader_dispatch.core_dispatch.CreateSwapchainKHR) {
-            VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)pTagInfo->objectHandle;
-            if (NULL != icd_term->surface_list.list && icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR)
-                && icd_term->surface_list.list[icd_surface->surface_index]) {
-                local_tag_info.objectHandle = (uint64_t)icd_term->surface_list.list[icd_surface->surface_index];
+            VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;
+            VkResult res = wsi_unwrap_icd_surface(icd_term, (VkSurfaceKHR)(uintptr_t)pTagInfo->objectHandle, &unwrapped_surface);
+            // The driver has no surface to name if it failed to make one
+            if (VK_ERROR_SURFACE_LOST_KHR == res) {
+                return VK_SUCCESS;
+            }
+            if (VK_SUCCESS != res) {
+                return res;
+            }
+            if (VK_NULL_HANDLE != unwrapped_surface) {
+                local_tag_info.objectHandle = (uint64_t)unwrapped_surface;
             }
         }
     // If this is an instance we have to replace it with the proper one for the next call.
@@ -6493,12 +13641,12 @@ VKAPI_ATTR void VKAPI_CALL terminator_GetPhysicalDeviceMultisamplePropertiesEXT(
     VkMultisamplePropertiesEXT*                 pMultisampleProperties) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceMultisamplePropertiesEXT) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceMultisamplePropertiesEXT)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDeviceMultisamplePropertiesEXT");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    icd_term->dispatch.GetPhysicalDeviceMultisamplePropertiesEXT(phys_dev_term->phys_dev, samples, pMultisampleProperties);
+    ICD_DISPATCH(icd_term, GetPhysicalDeviceMultisamplePropertiesEXT)(phys_dev_term->phys_dev, samples, pMultisampleProperties);
 }
 
 
@@ -6923,12 +14071,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceCalibrateableTimeDoma
     VkTimeDomainKHR*                            pTimeDomains) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceCalibrateableTimeDomainsEXT) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceCalibrateableTimeDomainsEXT)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDeviceCalibrateableTimeDomainsEXT");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.GetPhysicalDeviceCalibrateableTimeDomainsEXT(phys_dev_term->phys_dev, pTimeDomainCount, pTimeDomains);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceCalibrateableTimeDomainsEXT)(phys_dev_term->phys_dev, pTimeDomainCount, pTimeDomains);
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsEXT(
@@ -7254,12 +14402,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceCooperativeMatrixProp
     VkCooperativeMatrixPropertiesNV*            pProperties) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceCooperativeMatrixPropertiesNV) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceCooperativeMatrixPropertiesNV)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDeviceCooperativeMatrixPropertiesNV");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.GetPhysicalDeviceCooperativeMatrixPropertiesNV(phys_dev_term->phys_dev, pPropertyCount, pProperties);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceCooperativeMatrixPropertiesNV)(phys_dev_term->phys_dev, pPropertyCount, pProperties);
 }
 
 
@@ -7287,12 +14435,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSupportedFramebufferM
     VkFramebufferMixedSamplesCombinationNV*     pCombinations) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(phys_dev_term->phys_dev, pCombinationCount, pCombinations);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV)(phys_dev_term->phys_dev, pCombinationCount, pCombinations);
 }
 
 
@@ -7749,12 +14897,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_AcquireDrmDisplayEXT(
     VkDisplayKHR                                display) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.AcquireDrmDisplayEXT) {
+    if (NULL == ICD_DISPATCH(icd_term, AcquireDrmDisplayEXT)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support AcquireDrmDisplayEXT");
         return VK_ERROR_EXTENSION_NOT_PRESENT;
     }
-    return icd_term->dispatch.AcquireDrmDisplayEXT(phys_dev_term->phys_dev, drmFd, display);
+    return ICD_DISPATCH(icd_term, AcquireDrmDisplayEXT)(phys_dev_term->phys_dev, drmFd, display);
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL GetDrmDisplayEXT(
@@ -7781,12 +14929,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetDrmDisplayEXT(
     VkDisplayKHR*                               display) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetDrmDisplayEXT) {
+    if (NULL == ICD_DISPATCH(icd_term, GetDrmDisplayEXT)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetDrmDisplayEXT");
         return VK_ERROR_EXTENSION_NOT_PRESENT;
     }
-    return icd_term->dispatch.GetDrmDisplayEXT(phys_dev_term->phys_dev, drmFd, connectorId, display);
+    return ICD_DISPATCH(icd_term, GetDrmDisplayEXT)(phys_dev_term->phys_dev, drmFd, connectorId, display);
 }
 
 
@@ -8182,12 +15330,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_AcquireWinrtDisplayNV(
     VkDisplayKHR                                display) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.AcquireWinrtDisplayNV) {
+    if (NULL == ICD_DISPATCH(icd_term, AcquireWinrtDisplayNV)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support AcquireWinrtDisplayNV");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.AcquireWinrtDisplayNV(phys_dev_term->phys_dev, display);
+    return ICD_DISPATCH(icd_term, AcquireWinrtDisplayNV)(phys_dev_term->phys_dev, display);
 }
 
 #endif // VK_USE_PLATFORM_WIN32_KHR
@@ -8214,12 +15362,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetWinrtDisplayNV(
     VkDisplayKHR*                               pDisplay) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetWinrtDisplayNV) {
+    if (NULL == ICD_DISPATCH(icd_term, GetWinrtDisplayNV)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetWinrtDisplayNV");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.GetWinrtDisplayNV(phys_dev_term->phys_dev, deviceRelativeId, pDisplay);
+    return ICD_DISPATCH(icd_term, GetWinrtDisplayNV)(phys_dev_term->phys_dev, deviceRelativeId, pDisplay);
 }
 
 #endif // VK_USE_PLATFORM_WIN32_KHR
@@ -9473,12 +16621,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceOpticalFlowImageForma
     VkOpticalFlowImageFormatPropertiesNV*       pImageFormatProperties) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceOpticalFlowImageFormatsNV) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceOpticalFlowImageFormatsNV)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDeviceOpticalFlowImageFormatsNV");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.GetPhysicalDeviceOpticalFlowImageFormatsNV(phys_dev_term->phys_dev, pOpticalFlowImageFormatInfo, pFormatCount, pImageFormatProperties);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceOpticalFlowImageFormatsNV)(phys_dev_term->phys_dev, pOpticalFlowImageFormatInfo, pFormatCount, pImageFormatProperties);
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL CreateOpticalFlowSessionNV(
@@ -9690,12 +16838,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceCooperativeVectorProp
     VkCooperativeVectorPropertiesNV*            pProperties) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceCooperativeVectorPropertiesNV) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceCooperativeVectorPropertiesNV)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDeviceCooperativeVectorPropertiesNV");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.GetPhysicalDeviceCooperativeVectorPropertiesNV(phys_dev_term->phys_dev, pPropertyCount, pProperties);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceCooperativeVectorPropertiesNV)(phys_dev_term->phys_dev, pPropertyCount, pProperties);
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL ConvertCooperativeVectorMatrixNV(
@@ -10050,12 +17198,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceCooperativeMatrixFlex
     VkCooperativeMatrixFlexibleDimensionsPropertiesNV* pProperties) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_FATAL_ERROR_BIT | VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    return icd_term->dispatch.GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV(phys_dev_term->phys_dev, pPropertyCount, pProperties);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceCooperativeMatrixFlexibleDimensionsPropertiesNV)(phys_dev_term->phys_dev, pPropertyCount, pProperties);
 }
 
 
@@ -67,14 +67,32 @@ VKAPI_ATTR bool VKAPI_CALL loader_icd_init_entries(struct loader_instance* inst,
 
 // Init Device function pointer dispatch table with core commands
 VKAPI_ATTR void VKAPI_CALL loader_init_device_dispatch_table(struct loader_dev_dispatch_table *dev_table, PFN_vkGetDeviceProcAddr gpa,
-                                                             VkDevice dev);
+                                                             VkDevice dev, uint32_t api_version);
 
 // Init Device function pointer dispatch table with extension commands
 VKAPI_ATTR void VKAPI_CALL loader_init_device_extension_dispatch_table(struct loader_dev_dispatch_table *dev_table,
                                                                        PFN_vkGetInstanceProcAddr gipa,
                                                                        PFN_vkGetDeviceProcAddr gdpa,
                                                                        VkInstance inst,
-                                                                       VkDevice dev);
+                                                                       VkDevice dev,
+                                                                       const VkDeviceCreateInfo *pCreateInfo);
+
+// Init Device function pointer dispatch table with resolve-on-first-call stubs for the core commands
+VKAPI_ATTR void VKAPI_CALL loader_init_lazy_device_dispatch_table(struct loader_dev_dispatch_table *dev_table, PFN_vkGetDeviceProcAddr gpa);
+
+// Init Device function pointer dispatch table with resolve-on-first-call stubs for the extension commands
+VKAPI_ATTR void VKAPI_CALL loader_init_lazy_device_extension_dispatch_table(struct loader_dev_dispatch_table *dev_table,
+                                                                            PFN_vkGetInstanceProcAddr gipa,
+                                                                            PFN_vkGetDeviceProcAddr gdpa,
+                                                                            VkInstance inst,
+                                                                            VkDevice dev);
+
+// Builds and destroys the map from each lazy device dispatch stub to its command, used by loader_resolve_lazy_device_stub
+VKAPI_ATTR VkResult VKAPI_CALL loader_init_lazy_device_stub_map(void);
+VKAPI_ATTR void VKAPI_CALL loader_destroy_lazy_device_stub_map(void);
+
+// If addr is one of the lazy device dispatch stubs, resolves its command and returns that instead
+VKAPI_ATTR void* VKAPI_CALL loader_resolve_lazy_device_stub(VkLayerDispatchTable *table, void *addr);
 
 // Init Instance function pointer dispatch table with core commands
 VKAPI_ATTR void VKAPI_CALL loader_init_instance_core_dispatch_table(VkLayerInstanceDispatchTable *table, PFN_vkGetInstanceProcAddr gpa,
@@ -98,6 +98,7 @@ struct activated_layer_info {
 loader_platform_thread_mutex loader_lock;
 loader_platform_thread_mutex loader_preload_icd_lock;
 loader_platform_thread_mutex loader_global_instance_list_lock;
+loader_platform_thread_mutex loader_pre_instance_chain_lock;
 
 // A list of ICDs that gets initialized when the loader does its global initialization. This list should never be used by anything
 // other than EnumerateInstanceExtensionProperties(), vkDestroyInstance, and loader_release(). This list does not change
@@ -110,6 +111,62 @@ struct loader_icd_tramp_list preloaded_icds;
 // variables - this is just the definition of the variable, usage is in vk_loader_platform.h
 bool loader_disable_dynamic_library_unloading;
 
+// Layer libraries kept resident across instance lifetimes. When VK_LOADER_CACHE_LAYER_LIBRARIES is set to "1", vkDestroyInstance
+// does not close layer libraries and the next vkCreateInstance reuses the already loaded library along with the interface version
+// and entrypoints negotiated the first time around. The libraries are released once the last instance is destroyed, unless the
+// variable is set to "pin", in which case they are only released when the loader itself is unloaded. Otherwise the cache only
+// holds the libraries used by the cached pre-instance chains, which are closed as soon as nothing references them anymore.
+struct loader_cached_layer_library {
+    char *lib_name;
+    char layer_name[VK_MAX_EXTENSION_NAME_SIZE];
+    loader_platform_dl_handle lib_handle;
+    uint32_t ref_count;
+
+    // Only filled in once the layer has negotiated an interface version of 2 or greater
+    bool functions_resolved;
+    uint32_t interface_version;
+    PFN_vkNegotiateLoaderLayerInterfaceVersion negotiate_layer_interface;
+    PFN_vkGetInstanceProcAddr get_instance_proc_addr;
+    PFN_vkGetDeviceProcAddr get_device_proc_addr;
+    PFN_GetPhysicalDeviceProcAddr get_physical_device_proc_addr;
+};
+
+struct loader_cached_layer_library_list {
+    size_t capacity;
+    uint32_t count;
+    struct loader_cached_layer_library *list;
+};
+
+bool loader_cache_layer_libraries;
+bool loader_pin_layer_libraries;
+loader_platform_thread_mutex loader_layer_library_cache_lock;
+struct loader_cached_layer_library_list cached_layer_libraries;
+uint32_t avoided_layer_library_opens;
+
+// When VK_LOADER_LAZY_DEVICE_DISPATCH is set to "1", device dispatch tables are filled with stubs which look their command up
+// through the device chain the first time they are called, rather than querying every command in vkCreateDevice.
+bool loader_lazy_device_dispatch;
+
+// When VK_LOADER_CACHE_PHYSICAL_DEVICES is set to "1", vkEnumeratePhysicalDevices returns the physical devices found by the
+// previous call without querying the drivers, until loader_physical_device_generation changes.
+bool loader_cache_physical_devices;
+
+// When VK_LOADER_CACHE_PHYSICAL_DEVICE_PROPERTIES is set to "1", the terminators of vkGetPhysicalDeviceProperties,
+// vkGetPhysicalDeviceMemoryProperties, vkGetPhysicalDeviceQueueFamilyProperties, vkGetPhysicalDeviceFormatProperties and
+// vkEnumerateDeviceExtensionProperties only query the driver once per physical device and answer later calls from
+// loader_physical_device_term::property_cache.
+bool loader_cache_physical_device_properties;
+loader_platform_thread_mutex loader_physical_device_property_cache_lock;
+
+// Incremented whenever physical devices may have been added to or removed from the system. Only accessed with loader_lock held.
+uint32_t loader_physical_device_generation;
+
+#if defined(__linux__)
+// Hot-plugging a GPU adds or removes its nodes in /dev/dri, which changes the modification time of the directory
+bool loader_dri_directory_info_valid;
+loader_platform_file_info loader_dri_directory_info;
+#endif
+
 LOADER_PLATFORM_THREAD_ONCE_DECLARATION(once_init);
 
 // Creates loader_api_version struct that contains the major and minor fields, setting patch to 0
@@ -298,6 +355,16 @@ VkResult loader_copy_to_new_str(const struct loader_instance *inst, const char *
     return VK_SUCCESS;
 }
 
+VkResult loader_copy_to_new_long_lived_str(const struct loader_instance *inst, const char *source_str, char **dest_str) {
+    assert(source_str && dest_str);
+    size_t str_len = strlen(source_str) + 1;
+    *dest_str = loader_instance_heap_calloc_long_lived(inst, str_len);
+    if (NULL == *dest_str) return VK_ERROR_OUT_OF_HOST_MEMORY;
+    loader_strncpy(*dest_str, str_len, source_str, str_len);
+    (*dest_str)[str_len - 1] = 0;
+    return VK_SUCCESS;
+}
+
 VkResult create_string_list(const struct loader_instance *inst, uint32_t allocated_count, struct loader_string_list *string_list) {
     assert(string_list);
     string_list->list = loader_instance_heap_calloc(inst, sizeof(char *) * allocated_count, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
@@ -357,6 +424,175 @@ void free_string_list(const struct loader_instance *inst, struct loader_string_l
     memset(string_list, 0, sizeof(struct loader_string_list));
 }
 
+uint32_t loader_hash_string(const char *str) {
+    uint32_t hash = 2166136261U;
+    while (*str) {
+        hash ^= (uint8_t)*str++;
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+VkResult loader_init_string_map(const struct loader_instance *inst, struct loader_string_map *map, uint32_t expected_count) {
+    assert(map);
+    memset(map, 0, sizeof(struct loader_string_map));
+    // Keep the load factor at or below 3/4
+    uint32_t capacity = 16;
+    while (capacity * 3 < expected_count * 4) {
+        capacity *= 2;
+    }
+    map->entries =
+        loader_instance_heap_calloc(inst, sizeof(struct loader_string_map_entry) * capacity, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == map->entries) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    map->capacity = capacity;
+    return VK_SUCCESS;
+}
+
+// Returns the slot key occupies, or the empty slot it would be placed in
+struct loader_string_map_entry *loader_string_map_find_slot(struct loader_string_map_entry *entries, uint32_t capacity,
+                                                            const char *key, uint32_t hash) {
+    uint32_t index = hash & (capacity - 1);
+    while (NULL != entries[index].key && (entries[index].hash != hash || 0 != strcmp(entries[index].key, key))) {
+        index = (index + 1) & (capacity - 1);
+    }
+    return &entries[index];
+}
+
+VkResult loader_string_map_insert(const struct loader_instance *inst, struct loader_string_map *map, const char *key, void *value) {
+    assert(map && key);
+    if (0 == map->capacity) {
+        VkResult res = loader_init_string_map(inst, map, 0);
+        if (VK_SUCCESS != res) {
+            return res;
+        }
+    }
+    if ((map->count + 1) * 4 > map->capacity * 3) {
+        uint32_t new_capacity = map->capacity * 2;
+        struct loader_string_map_entry *new_entries = loader_instance_heap_calloc(
+            inst, sizeof(struct loader_string_map_entry) * new_capacity, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == new_entries) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        for (uint32_t i = 0; i < map->capacity; i++) {
+            if (NULL != map->entries[i].key) {
+                *loader_string_map_find_slot(new_entries, new_capacity, map->entries[i].key, map->entries[i].hash) =
+                    map->entries[i];
+            }
+        }
+        loader_instance_heap_free(inst, map->entries);
+        map->entries = new_entries;
+        map->capacity = new_capacity;
+    }
+    uint32_t hash = loader_hash_string(key);
+    struct loader_string_map_entry *entry = loader_string_map_find_slot(map->entries, map->capacity, key, hash);
+    if (NULL == entry->key) {
+        entry->key = key;
+        entry->hash = hash;
+        entry->value = value;
+        map->count++;
+    }
+    return VK_SUCCESS;
+}
+
+void *loader_string_map_find(const struct loader_string_map *map, const char *key) {
+    assert(map && key);
+    if (0 == map->count) {
+        return NULL;
+    }
+    return loader_string_map_find_slot(map->entries, map->capacity, key, loader_hash_string(key))->value;
+}
+
+void loader_destroy_string_map(const struct loader_instance *inst, struct loader_string_map *map) {
+    assert(map);
+    loader_instance_heap_free(inst, map->entries);
+    memset(map, 0, sizeof(struct loader_string_map));
+}
+
+VkResult loader_init_handle_map(const struct loader_instance *inst, struct loader_handle_map *map, uint32_t expected_count) {
+    assert(map);
+    memset(map, 0, sizeof(struct loader_handle_map));
+    // Keep the load factor at or below 3/4
+    uint32_t capacity = 16;
+    while (capacity * 3 < expected_count * 4) {
+        capacity *= 2;
+    }
+    map->entries =
+        loader_instance_heap_calloc(inst, sizeof(struct loader_handle_map_entry) * capacity, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == map->entries) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    map->capacity = capacity;
+    return VK_SUCCESS;
+}
+
+// Handles are usually aligned heap pointers, so mix the upper bits into the low bits used to pick the slot
+uint32_t loader_hash_handle(const void *key) {
+    uint64_t hash = (uint64_t)(uintptr_t)key;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return (uint32_t)hash;
+}
+
+// Returns the slot key occupies, or the empty slot it would be placed in
+struct loader_handle_map_entry *loader_handle_map_find_slot(struct loader_handle_map_entry *entries, uint32_t capacity,
+                                                            const void *key) {
+    uint32_t index = loader_hash_handle(key) & (capacity - 1);
+    while (NULL != entries[index].key && entries[index].key != key) {
+        index = (index + 1) & (capacity - 1);
+    }
+    return &entries[index];
+}
+
+VkResult loader_handle_map_insert(const struct loader_instance *inst, struct loader_handle_map *map, const void *key, void *value) {
+    assert(map && key);
+    if (0 == map->capacity) {
+        VkResult res = loader_init_handle_map(inst, map, 0);
+        if (VK_SUCCESS != res) {
+            return res;
+        }
+    }
+    if ((map->count + 1) * 4 > map->capacity * 3) {
+        uint32_t new_capacity = map->capacity * 2;
+        struct loader_handle_map_entry *new_entries = loader_instance_heap_calloc(
+            inst, sizeof(struct loader_handle_map_entry) * new_capacity, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == new_entries) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        for (uint32_t i = 0; i < map->capacity; i++) {
+            if (NULL != map->entries[i].key) {
+                *loader_handle_map_find_slot(new_entries, new_capacity, map->entries[i].key) = map->entries[i];
+            }
+        }
+        loader_instance_heap_free(inst, map->entries);
+        map->entries = new_entries;
+        map->capacity = new_capacity;
+    }
+    struct loader_handle_map_entry *entry = loader_handle_map_find_slot(map->entries, map->capacity, key);
+    if (NULL == entry->key) {
+        entry->key = key;
+        entry->value = value;
+        map->count++;
+    }
+    return VK_SUCCESS;
+}
+
+void *loader_handle_map_find(const struct loader_handle_map *map, const void *key) {
+    assert(map);
+    if (0 == map->count || NULL == key) {
+        return NULL;
+    }
+    return loader_handle_map_find_slot(map->entries, map->capacity, key)->value;
+}
+
+void loader_destroy_handle_map(const struct loader_instance *inst, struct loader_handle_map *map) {
+    assert(map);
+    loader_instance_heap_free(inst, map->entries);
+    memset(map, 0, sizeof(struct loader_handle_map));
+}
+
 // Given string of three part form "maj.min.pat" convert to a vulkan version number.
 // Also can understand four part form "variant.major.minor.patch" if provided.
 uint32_t loader_parse_version_string(char *vers_str) {
@@ -515,12 +751,7 @@ TEST_FUNCTION_EXPORT void loader_delete_layer_list_and_properties(const struct l
     if (!layer_list) return;
 
     for (i = 0; i < layer_list->count; i++) {
-        if (layer_list->list[i].lib_handle) {
-            loader_platform_close_library(layer_list->list[i].lib_handle);
-            loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_LAYER_BIT, 0, "Unloading layer library %s",
-                       layer_list->list[i].lib_name);
-            layer_list->list[i].lib_handle = NULL;
-        }
+        loader_close_layer_file(inst, &(layer_list->list[i]));
         loader_free_layer_properties(inst, &(layer_list->list[i]));
     }
     layer_list->count = 0;
@@ -752,11 +983,33 @@ VkResult loader_resize_generic_list(const struct loader_instance *inst, struct l
     return VK_SUCCESS;
 }
 
+// Grows list_info until it has room for an element at index, zeroing any newly added entries
+VkResult loader_reserve_generic_list_index(const struct loader_instance *inst, struct loader_generic_list *list_info,
+                                           size_t element_size, uint32_t index) {
+    if (NULL == list_info->list) {
+        VkResult res = loader_init_generic_list(inst, list_info, element_size);
+        if (VK_SUCCESS != res) {
+            return res;
+        }
+    }
+    while (list_info->capacity <= index * element_size) {
+        size_t old_capacity = list_info->capacity;
+        VkResult res = loader_resize_generic_list(inst, list_info);
+        if (VK_SUCCESS != res) {
+            return res;
+        }
+        memset((uint8_t *)list_info->list + old_capacity, 0, old_capacity);
+    }
+    return VK_SUCCESS;
+}
+
 void loader_destroy_generic_list(const struct loader_instance *inst, struct loader_generic_list *list) {
     loader_instance_heap_free(inst, list->list);
     memset(list, 0, sizeof(struct loader_generic_list));
 }
 
+// Released entries are reused most recently released first, otherwise the next never used entry is handed out.
+// Both cases are constant time, the list only grows once every entry below capacity is in use.
 VkResult loader_get_next_available_entry(const struct loader_instance *inst, struct loader_used_object_list *list_info,
                                          uint32_t *free_index, const VkAllocationCallbacks *pAllocator) {
     if (NULL == list_info->list) {
@@ -765,43 +1018,41 @@ VkResult loader_get_next_available_entry(const struct loader_instance *inst, str
         if (VK_SUCCESS != res) {
             return res;
         }
+        list_info->free_head = 0;
+        list_info->high_water = 0;
     }
-    for (uint32_t i = 0; i < list_info->capacity / sizeof(struct loader_used_object_status); i++) {
-        if (list_info->list[i].status == VK_FALSE) {
-            list_info->list[i].status = VK_TRUE;
-            if (pAllocator) {
-                list_info->list[i].allocation_callbacks = *pAllocator;
-            } else {
-                memset(&list_info->list[i].allocation_callbacks, 0, sizeof(VkAllocationCallbacks));
-            }
-            *free_index = i;
-            return VK_SUCCESS;
+
+    uint32_t index = 0;
+    if (0 != list_info->free_head) {
+        index = list_info->free_head - 1;
+        list_info->free_head = list_info->list[index].next_free;
+    } else {
+        VkResult res = loader_reserve_generic_list_index(inst, (struct loader_generic_list *)list_info,
+                                                         sizeof(struct loader_used_object_status), list_info->high_water);
+        if (VK_SUCCESS != res) {
+            return res;
         }
+        index = list_info->high_water++;
     }
-    // No free space, must resize
 
-    size_t old_capacity = list_info->capacity;
-    VkResult res = loader_resize_generic_list(inst, (struct loader_generic_list *)list_info);
-    if (VK_SUCCESS != res) {
-        return res;
-    }
-    uint32_t new_index = (uint32_t)(old_capacity / sizeof(struct loader_used_object_status));
-    // Zero out the newly allocated back half of list.
-    memset(&list_info->list[new_index], 0, old_capacity);
-    list_info->list[new_index].status = VK_TRUE;
+    list_info->list[index].status = VK_TRUE;
+    list_info->list[index].next_free = 0;
     if (pAllocator) {
-        list_info->list[new_index].allocation_callbacks = *pAllocator;
+        list_info->list[index].allocation_callbacks = *pAllocator;
     } else {
-        memset(&list_info->list[new_index].allocation_callbacks, 0, sizeof(VkAllocationCallbacks));
+        memset(&list_info->list[index].allocation_callbacks, 0, sizeof(VkAllocationCallbacks));
     }
-    *free_index = new_index;
+    *free_index = index;
     return VK_SUCCESS;
 }
 
 void loader_release_object_from_list(struct loader_used_object_list *list_info, uint32_t index_to_free) {
-    if (list_info->list && list_info->capacity > index_to_free * sizeof(struct loader_used_object_status)) {
+    if (list_info->list && list_info->capacity > index_to_free * sizeof(struct loader_used_object_status) &&
+        list_info->list[index_to_free].status == VK_TRUE) {
         list_info->list[index_to_free].status = VK_FALSE;
         memset(&list_info->list[index_to_free].allocation_callbacks, 0, sizeof(VkAllocationCallbacks));
+        list_info->list[index_to_free].next_free = list_info->free_head;
+        list_info->free_head = index_to_free + 1;
     }
 }
 
@@ -1019,6 +1270,50 @@ VkResult loader_add_layer_names_to_list(const struct loader_instance *inst, cons
     return err;
 }
 
+// Check whether layer_name is one of the component layers of the override layer in the instance's layer list.
+// The override layer and a set of its component layer names are kept in the environment snapshot of filters, so they are only
+// looked up again after loader_invalidate_override_layer_cache() is called for a rebuilt instance layer list.
+bool loader_layer_is_in_override_layer(const struct loader_instance *inst, const struct loader_envvar_all_filters *filters,
+                                       const char *layer_name) {
+    struct loader_environment_snapshot *snapshot = filters->environment_snapshot;
+    const struct loader_layer_properties *override = NULL;
+    if (NULL == snapshot) {
+        override = loader_find_layer_property(VK_OVERRIDE_LAYER_NAME, &inst->instance_layer_list);
+    } else {
+        if (!snapshot->override_layer_cached) {
+            loader_destroy_string_map(inst, &snapshot->override_component_layers);
+            snapshot->override_layer_cached = true;
+            snapshot->override_layer = loader_find_layer_property(VK_OVERRIDE_LAYER_NAME, &inst->instance_layer_list);
+            if (NULL != snapshot->override_layer) {
+                const struct loader_string_list *names = &snapshot->override_layer->component_layer_names;
+                // If the set can't be built, fall back to searching the list of names
+                if (VK_SUCCESS != loader_init_string_map(inst, &snapshot->override_component_layers, names->count)) {
+                    loader_destroy_string_map(inst, &snapshot->override_component_layers);
+                }
+                for (uint32_t i = 0; i < names->count && 0 != snapshot->override_component_layers.capacity; ++i) {
+                    if (VK_SUCCESS !=
+                        loader_string_map_insert(inst, &snapshot->override_component_layers, names->list[i], names->list[i])) {
+                        loader_destroy_string_map(inst, &snapshot->override_component_layers);
+                    }
+                }
+            }
+        }
+        override = snapshot->override_layer;
+        if (NULL != override && 0 != snapshot->override_component_layers.capacity) {
+            return NULL != loader_string_map_find(&snapshot->override_component_layers, layer_name);
+        }
+    }
+
+    if (override != NULL) {
+        for (uint32_t i = 0; i < override->component_layer_names.count; ++i) {
+            if (strcmp(override->component_layer_names.list[i], layer_name) == 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 // Determine if the provided implicit layer should be enabled by querying the appropriate environmental variables.
 // For an implicit layer, at least a disable environment variable is required.
 bool loader_implicit_layer_is_enabled(const struct loader_instance *inst, const struct loader_envvar_all_filters *filters,
@@ -1039,14 +1334,9 @@ bool loader_implicit_layer_is_enabled(const struct loader_instance *inst, const
     // If no enable_environment variable is specified, this implicit layer is always be enabled by default.
     if (NULL == prop->enable_env_var.name) {
         enable = true;
-    } else {
-        char *env_value = loader_getenv(prop->enable_env_var.name, inst);
-        if (env_value && !strcmp(prop->enable_env_var.value, env_value)) {
-            enable = true;
-        }
-
+    } else if (check_layer_environment_var(inst, filters, prop->enable_env_var.name, prop->enable_env_var.value)) {
         // Otherwise, only enable this layer if the enable environment variable is defined
-        loader_free_getenv(env_value, inst);
+        enable = true;
     }
 
     if (forced_enabled) {
@@ -1070,33 +1360,17 @@ bool loader_implicit_layer_is_enabled(const struct loader_instance *inst, const
     // The disable_environment has priority over everything else.  If it is defined, the layer is always
     // disabled.
     if (NULL != prop->disable_env_var.name) {
-        char *env_value = loader_getenv(prop->disable_env_var.name, inst);
-        if (NULL != env_value) {
+        if (check_layer_environment_var(inst, filters, prop->disable_env_var.name, NULL)) {
             enable = false;
         }
-        loader_free_getenv(env_value, inst);
     } else if ((prop->type_flags & VK_LAYER_TYPE_FLAG_EXPLICIT_LAYER) == 0) {
         loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_LAYER_BIT, 0,
                    "Implicit layer \"%s\" missing disabled environment variable!", prop->info.layerName);
     }
 
     // Enable this layer if it is included in the override layer
-    if (inst != NULL && inst->override_layer_present) {
-        struct loader_layer_properties *override = NULL;
-        for (uint32_t i = 0; i < inst->instance_layer_list.count; ++i) {
-            if (strcmp(inst->instance_layer_list.list[i].info.layerName, VK_OVERRIDE_LAYER_NAME) == 0) {
-                override = &inst->instance_layer_list.list[i];
-                break;
-            }
-        }
-        if (override != NULL) {
-            for (uint32_t i = 0; i < override->component_layer_names.count; ++i) {
-                if (strcmp(override->component_layer_names.list[i], prop->info.layerName) == 0) {
-                    enable = true;
-                    break;
-                }
-            }
-        }
+    if (inst != NULL && inst->override_layer_present && loader_layer_is_in_override_layer(inst, filters, prop->info.layerName)) {
+        enable = true;
     }
 
     return enable;
@@ -1407,17 +1681,18 @@ void loader_icd_close_objects(struct loader_instance *ptr_inst, struct loader_ic
     for (uint32_t i = 0; i < icd_term->surface_list.capacity / sizeof(VkSurfaceKHR); i++) {
         if (ptr_inst->surfaces_list.capacity > i * sizeof(struct loader_used_object_status) &&
             ptr_inst->surfaces_list.list[i].status == VK_TRUE && NULL != icd_term->surface_list.list &&
-            icd_term->surface_list.list[i] && NULL != icd_term->dispatch.DestroySurfaceKHR) {
-            icd_term->dispatch.DestroySurfaceKHR(icd_term->instance, icd_term->surface_list.list[i],
-                                                 ignore_null_callback(&(ptr_inst->surfaces_list.list[i].allocation_callbacks)));
+            icd_term->surface_list.list[i] && NULL != ICD_DISPATCH(icd_term, DestroySurfaceKHR)) {
+            ICD_DISPATCH(icd_term, DestroySurfaceKHR)(
+                icd_term->instance, icd_term->surface_list.list[i],
+                ignore_null_callback(&(ptr_inst->surfaces_list.list[i].allocation_callbacks)));
             icd_term->surface_list.list[i] = (VkSurfaceKHR)(uintptr_t)NULL;
         }
     }
     for (uint32_t i = 0; i < icd_term->debug_utils_messenger_list.capacity / sizeof(VkDebugUtilsMessengerEXT); i++) {
         if (ptr_inst->debug_utils_messengers_list.capacity > i * sizeof(struct loader_used_object_status) &&
             ptr_inst->debug_utils_messengers_list.list[i].status == VK_TRUE && NULL != icd_term->debug_utils_messenger_list.list &&
-            icd_term->debug_utils_messenger_list.list[i] && NULL != icd_term->dispatch.DestroyDebugUtilsMessengerEXT) {
-            icd_term->dispatch.DestroyDebugUtilsMessengerEXT(
+            icd_term->debug_utils_messenger_list.list[i] && NULL != ICD_DISPATCH(icd_term, DestroyDebugUtilsMessengerEXT)) {
+            ICD_DISPATCH(icd_term, DestroyDebugUtilsMessengerEXT)(
                 icd_term->instance, icd_term->debug_utils_messenger_list.list[i],
                 ignore_null_callback(&(ptr_inst->debug_utils_messengers_list.list[i].allocation_callbacks)));
             icd_term->debug_utils_messenger_list.list[i] = (VkDebugUtilsMessengerEXT)(uintptr_t)NULL;
@@ -1426,18 +1701,38 @@ void loader_icd_close_objects(struct loader_instance *ptr_inst, struct loader_ic
     for (uint32_t i = 0; i < icd_term->debug_report_callback_list.capacity / sizeof(VkDebugReportCallbackEXT); i++) {
         if (ptr_inst->debug_report_callbacks_list.capacity > i * sizeof(struct loader_used_object_status) &&
             ptr_inst->debug_report_callbacks_list.list[i].status == VK_TRUE && NULL != icd_term->debug_report_callback_list.list &&
-            icd_term->debug_report_callback_list.list[i] && NULL != icd_term->dispatch.DestroyDebugReportCallbackEXT) {
-            icd_term->dispatch.DestroyDebugReportCallbackEXT(
+            icd_term->debug_report_callback_list.list[i] && NULL != ICD_DISPATCH(icd_term, DestroyDebugReportCallbackEXT)) {
+            ICD_DISPATCH(icd_term, DestroyDebugReportCallbackEXT)(
                 icd_term->instance, icd_term->debug_report_callback_list.list[i],
                 ignore_null_callback(&(ptr_inst->debug_report_callbacks_list.list[i].allocation_callbacks)));
             icd_term->debug_report_callback_list.list[i] = (VkDebugReportCallbackEXT)(uintptr_t)NULL;
         }
     }
 }
+VKAPI_ATTR void VKAPI_CALL loader_icd_unresolved_entry(void) {}
+
+// Threads racing on the same entry all store the same value, which is a single pointer sized write
+PFN_vkVoidFunction loader_icd_resolve_entry(const struct loader_icd_term *icd_term, PFN_vkVoidFunction *slot, const char *name) {
+    PFN_vkVoidFunction addr = icd_term->scanned_icd->GetInstanceProcAddr(icd_term->instance, name);
+    *slot = addr;
+    return addr;
+}
+
 // Free resources allocated inside the loader_icd_term
 void loader_icd_destroy(struct loader_instance *ptr_inst, struct loader_icd_term *icd_term,
                         const VkAllocationCallbacks *pAllocator) {
     ptr_inst->icd_terms_count--;
+    if (icd_term->lazy_dispatch_entry_count > 0) {
+        // Entries still holding the placeholder were never needed
+        uint32_t unresolved_count = 0;
+        const PFN_vkVoidFunction *entries = (const PFN_vkVoidFunction *)&icd_term->dispatch;
+        for (size_t i = 0; i < sizeof(icd_term->dispatch) / sizeof(PFN_vkVoidFunction); i++) {
+            if (entries[i] == (PFN_vkVoidFunction)loader_icd_unresolved_entry) unresolved_count++;
+        }
+        loader_log(ptr_inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "Avoided %u of %u vkGetInstanceProcAddr calls into driver %s by looking commands up on first use",
+                   unresolved_count, icd_term->lazy_dispatch_entry_count, icd_term->scanned_icd->lib_name);
+    }
     for (struct loader_device *dev = icd_term->logical_device_list; dev;) {
         struct loader_device *next_dev = dev->next;
         loader_destroy_logical_device(dev, pAllocator);
@@ -1974,11 +2269,17 @@ void loader_initialize(void) {
     loader_platform_thread_create_mutex(&loader_lock);
     loader_platform_thread_create_mutex(&loader_preload_icd_lock);
     loader_platform_thread_create_mutex(&loader_global_instance_list_lock);
+    loader_platform_thread_create_mutex(&loader_layer_library_cache_lock);
+    loader_platform_thread_create_mutex(&loader_pre_instance_chain_lock);
+    loader_platform_thread_create_mutex(&loader_envvar_filter_cache_lock);
+    loader_platform_thread_create_mutex(&loader_physical_device_property_cache_lock);
     init_global_loader_settings();
 #endif
 
     // initialize logging
     loader_init_global_debug_level();
+    loader_init_async_log_output();
+    loader_init_log_file_output();
 #if defined(_WIN32)
     windows_initialization();
 #endif
@@ -1999,6 +2300,57 @@ void loader_initialize(void) {
         loader_disable_dynamic_library_unloading = false;
     }
     loader_free_getenv(loader_disable_dynamic_library_unloading_env_var, NULL);
+
+    char *loader_cache_layer_libraries_env_var = loader_getenv("VK_LOADER_CACHE_LAYER_LIBRARIES", NULL);
+    if (loader_cache_layer_libraries_env_var && 0 == strncmp(loader_cache_layer_libraries_env_var, "1", 2)) {
+        loader_cache_layer_libraries = true;
+        loader_pin_layer_libraries = false;
+        loader_log(NULL, VULKAN_LOADER_INFO_BIT, 0,
+                   "Vulkan Loader: layer libraries are kept loaded across instances until the last instance is destroyed");
+    } else if (loader_cache_layer_libraries_env_var && 0 == strncmp(loader_cache_layer_libraries_env_var, "pin", 4)) {
+        loader_cache_layer_libraries = true;
+        loader_pin_layer_libraries = true;
+        loader_log(NULL, VULKAN_LOADER_INFO_BIT, 0, "Vulkan Loader: layer libraries are kept loaded until the loader is unloaded");
+    } else {
+        loader_cache_layer_libraries = false;
+        loader_pin_layer_libraries = false;
+    }
+    loader_free_getenv(loader_cache_layer_libraries_env_var, NULL);
+
+    char *loader_lazy_device_dispatch_env_var = loader_getenv("VK_LOADER_LAZY_DEVICE_DISPATCH", NULL);
+    if (loader_lazy_device_dispatch_env_var && 0 == strncmp(loader_lazy_device_dispatch_env_var, "1", 2)) {
+        loader_lazy_device_dispatch = true;
+        loader_log(NULL, VULKAN_LOADER_INFO_BIT, 0, "Vulkan Loader: device commands are resolved on first use");
+        if (VK_SUCCESS != loader_init_lazy_device_stub_map()) {
+            loader_lazy_device_dispatch = false;
+            loader_log(NULL, VULKAN_LOADER_WARN_BIT, 0,
+                       "Vulkan Loader: out of memory building the lazy device dispatch stub map, device commands are resolved "
+                       "up front");
+        }
+    } else {
+        loader_lazy_device_dispatch = false;
+    }
+    loader_free_getenv(loader_lazy_device_dispatch_env_var, NULL);
+
+    char *loader_cache_physical_devices_env_var = loader_getenv("VK_LOADER_CACHE_PHYSICAL_DEVICES", NULL);
+    if (loader_cache_physical_devices_env_var && 0 == strncmp(loader_cache_physical_devices_env_var, "1", 2)) {
+        loader_cache_physical_devices = true;
+        loader_log(NULL, VULKAN_LOADER_INFO_BIT, 0,
+                   "Vulkan Loader: vkEnumeratePhysicalDevices reuses the physical devices it found until they may have changed");
+    } else {
+        loader_cache_physical_devices = false;
+    }
+    loader_free_getenv(loader_cache_physical_devices_env_var, NULL);
+
+    char *loader_cache_physical_device_properties_env_var = loader_getenv("VK_LOADER_CACHE_PHYSICAL_DEVICE_PROPERTIES", NULL);
+    if (loader_cache_physical_device_properties_env_var &&
+        0 == strncmp(loader_cache_physical_device_properties_env_var, "1", 2)) {
+        loader_cache_physical_device_properties = true;
+        loader_log(NULL, VULKAN_LOADER_INFO_BIT, 0, "Vulkan Loader: physical device properties are only queried once per device");
+    } else {
+        loader_cache_physical_device_properties = false;
+    }
+    loader_free_getenv(loader_cache_physical_device_properties_env_var, NULL);
 #if defined(LOADER_USE_UNSAFE_FILE_SEARCH)
     loader_log(NULL, VULKAN_LOADER_WARN_BIT, 0, "Vulkan Loader: unsafe searching is enabled");
 #endif
@@ -2011,11 +2363,25 @@ void loader_release(void) {
     // Guarantee release of the preloaded ICD libraries. This may have already been called in vkDestroyInstance.
     loader_unload_preloaded_icds();
 
+    // Any layer library still in the cache at this point has no instance left which could be using it.
+    loader_clear_pre_instance_chains();
+    loader_unload_cached_layer_libraries();
+    loader_clear_compiled_envvar_filters();
+    loader_destroy_lazy_device_stub_map();
+
+    // Write out any queued log messages before the loader goes away
+    loader_release_async_log_output();
+    loader_release_log_file_output();
+
     // release mutexes
     teardown_global_loader_settings();
     loader_platform_thread_delete_mutex(&loader_lock);
     loader_platform_thread_delete_mutex(&loader_preload_icd_lock);
     loader_platform_thread_delete_mutex(&loader_global_instance_list_lock);
+    loader_platform_thread_delete_mutex(&loader_layer_library_cache_lock);
+    loader_platform_thread_delete_mutex(&loader_pre_instance_chain_lock);
+    loader_platform_thread_delete_mutex(&loader_envvar_filter_cache_lock);
+    loader_platform_thread_delete_mutex(&loader_physical_device_property_cache_lock);
 }
 
 // Preload the ICD libraries that are likely to be needed so we don't repeatedly load/unload them later
@@ -2042,6 +2408,43 @@ void loader_unload_preloaded_icds(void) {
     loader_platform_thread_unlock_mutex(&loader_preload_icd_lock);
 }
 
+// Close every cached layer library which isn't currently in use by an instance and drop it from the cache. Called from
+// loader_release() and when the last instance is destroyed, and exported so that tests can empty a pinned cache.
+TEST_FUNCTION_EXPORT void loader_unload_cached_layer_libraries(void) {
+    loader_platform_thread_lock_mutex(&loader_layer_library_cache_lock);
+    uint32_t kept_count = 0;
+    for (uint32_t i = 0; i < cached_layer_libraries.count; i++) {
+        struct loader_cached_layer_library *cached = &cached_layer_libraries.list[i];
+        if (cached->ref_count > 0) {
+            cached_layer_libraries.list[kept_count++] = *cached;
+            continue;
+        }
+        loader_log(NULL, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_LAYER_BIT, 0, "Unloading cached layer library %s",
+                   cached->lib_name);
+        loader_platform_close_library(cached->lib_handle);
+        loader_free(NULL, cached->lib_name);
+    }
+    cached_layer_libraries.count = kept_count;
+    if (kept_count == 0 && NULL != cached_layer_libraries.list) {
+        loader_destroy_generic_list(NULL, (struct loader_generic_list *)&cached_layer_libraries);
+    }
+    loader_platform_thread_unlock_mutex(&loader_layer_library_cache_lock);
+}
+
+// Called from vkDestroyInstance, releases the layer library cache once no instance is left unless it was pinned
+void loader_unload_unpinned_layer_libraries(void) {
+    if (!loader_cache_layer_libraries || loader_pin_layer_libraries) {
+        return;
+    }
+    loader_platform_thread_lock_mutex(&loader_global_instance_list_lock);
+    bool last_instance_destroyed = NULL == loader.instances;
+    loader_platform_thread_unlock_mutex(&loader_global_instance_list_lock);
+    // An instance created after the check takes its own references, which keeps its libraries out of the unload
+    if (last_instance_destroyed) {
+        loader_unload_cached_layer_libraries();
+    }
+}
+
 #if !defined(_WIN32)
 __attribute__((constructor)) void loader_init_library(void) { loader_initialize(); }
 
@@ -2423,7 +2826,7 @@ VkResult loader_read_layer_json(const struct loader_instance *inst, struct loade
     VkResult result = VK_SUCCESS;
     struct loader_layer_properties props = {0};
 
-    result = loader_copy_to_new_str(inst, filename, &props.manifest_file_name);
+    result = loader_copy_to_new_long_lived_str(inst, filename, &props.manifest_file_name);
     if (result == VK_ERROR_OUT_OF_HOST_MEMORY) {
         goto out;
     }
@@ -2618,9 +3021,9 @@ VkResult loader_read_layer_json(const struct loader_instance *inst, struct loade
             result = VK_ERROR_INITIALIZATION_FAILED;
             goto out;
         }
-        result = loader_copy_to_new_str(inst, disable_environment->child->string, &(props.disable_env_var.name));
+        result = loader_copy_to_new_long_lived_str(inst, disable_environment->child->string, &(props.disable_env_var.name));
         if (VK_SUCCESS != result) goto out;
-        result = loader_copy_to_new_str(inst, disable_environment->child->valuestring, &(props.disable_env_var.value));
+        result = loader_copy_to_new_long_lived_str(inst, disable_environment->child->valuestring, &(props.disable_env_var.value));
         if (VK_SUCCESS != result) goto out;
     }
 
@@ -2748,9 +3151,9 @@ VkResult loader_read_layer_json(const struct loader_instance *inst, struct loade
         // enable_environment is optional
         if (enable_environment && enable_environment->child && enable_environment->child->type == cJSON_String &&
             enable_environment->child->string && enable_environment->child->valuestring) {
-            result = loader_copy_to_new_str(inst, enable_environment->child->string, &(props.enable_env_var.name));
+            result = loader_copy_to_new_long_lived_str(inst, enable_environment->child->string, &(props.enable_env_var.name));
             if (VK_SUCCESS != result) goto out;
-            result = loader_copy_to_new_str(inst, enable_environment->child->valuestring, &(props.enable_env_var.value));
+            result = loader_copy_to_new_long_lived_str(inst, enable_environment->child->valuestring, &(props.enable_env_var.value));
             if (VK_SUCCESS != result) goto out;
         }
     }
@@ -4079,6 +4482,8 @@ VkResult loader_scan_for_layers(struct loader_instance *inst, struct loader_laye
     res = combine_settings_layers_with_regular_layers(inst, &settings_layers, &regular_instance_layers, instance_layers);
 
 out:
+    // instance_layers was rebuilt, so any override layer looked up while scanning is stale
+    loader_invalidate_override_layer_cache(inst, filters);
     loader_delete_layer_list_and_properties(inst, &settings_layers);
     loader_delete_layer_list_and_properties(inst, &regular_instance_layers);
 
@@ -4357,7 +4762,7 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL loader_gpa_device_terminator(VkDevice d
         return NULL;
     }
 
-    return icd_term->dispatch.GetDeviceProcAddr(device, pName);
+    return ICD_DISPATCH(icd_term, GetDeviceProcAddr)(device, pName);
 }
 
 struct loader_instance *loader_get_instance(const VkInstance instance) {
@@ -4382,7 +4787,7 @@ struct loader_instance *loader_get_instance(const VkInstance instance) {
     return ptr_instance;
 }
 
-loader_platform_dl_handle loader_open_layer_file(const struct loader_instance *inst, struct loader_layer_properties *prop) {
+loader_platform_dl_handle loader_open_layer_library(const struct loader_instance *inst, struct loader_layer_properties *prop) {
     char* libPath = prop->lib_name;
     loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_LAYER_BIT, 0, "try to open json libPath: %s", libPath);
     if ((prop->lib_handle = loader_platform_open_library(libPath)) == NULL) {
@@ -4459,6 +4864,178 @@ mallocErr:
     return prop->lib_handle;
 }
 
+// Looks for prop's library in the layer library cache, and if found takes a reference to it and restores any previously negotiated
+// entrypoints into prop. Returns false if the library hasn't been cached yet.
+bool loader_acquire_cached_layer_library(const struct loader_instance *inst, struct loader_layer_properties *prop) {
+    bool found = false;
+    uint32_t avoided_opens = 0;
+    loader_platform_thread_lock_mutex(&loader_layer_library_cache_lock);
+    for (uint32_t i = 0; i < cached_layer_libraries.count; i++) {
+        struct loader_cached_layer_library *cached = &cached_layer_libraries.list[i];
+        if (strcmp(cached->lib_name, prop->lib_name) != 0) {
+            continue;
+        }
+        cached->ref_count++;
+        prop->lib_handle = cached->lib_handle;
+        prop->lib_status = LOADER_LAYER_LIB_SUCCESS_LOADED;
+        // Different manifests may point at the same library, only reuse the entrypoints if they came from the same layer
+        if (cached->functions_resolved && strcmp(cached->layer_name, prop->info.layerName) == 0) {
+            prop->interface_version = cached->interface_version;
+            prop->functions.negotiate_layer_interface = cached->negotiate_layer_interface;
+            prop->functions.get_instance_proc_addr = cached->get_instance_proc_addr;
+            prop->functions.get_device_proc_addr = cached->get_device_proc_addr;
+            prop->functions.get_physical_device_proc_addr = cached->get_physical_device_proc_addr;
+        }
+        avoided_opens = ++avoided_layer_library_opens;
+        found = true;
+        break;
+    }
+    loader_platform_thread_unlock_mutex(&loader_layer_library_cache_lock);
+    if (found) {
+        loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_LAYER_BIT, 0,
+                   "Using cached layer library %s (%u layer library opens avoided so far)", prop->lib_name, avoided_opens);
+    }
+    return found;
+}
+
+// Adds the freshly opened library of prop to the layer library cache. If another thread cached the same library in the meantime,
+// the extra reference prop->lib_handle holds is dropped and the cached one is used instead.
+void loader_add_cached_layer_library(const struct loader_instance *inst, struct loader_layer_properties *prop) {
+    bool already_cached = false;
+    bool out_of_memory = false;
+    loader_platform_thread_lock_mutex(&loader_layer_library_cache_lock);
+    for (uint32_t i = 0; i < cached_layer_libraries.count; i++) {
+        if (strcmp(cached_layer_libraries.list[i].lib_name, prop->lib_name) == 0) {
+            cached_layer_libraries.list[i].ref_count++;
+            already_cached = true;
+            break;
+        }
+    }
+    if (!already_cached) {
+        if (NULL == cached_layer_libraries.list) {
+            out_of_memory = VK_SUCCESS != loader_init_generic_list(NULL, (struct loader_generic_list *)&cached_layer_libraries,
+                                                                   sizeof(struct loader_cached_layer_library));
+        } else if (cached_layer_libraries.capacity <= cached_layer_libraries.count * sizeof(struct loader_cached_layer_library)) {
+            out_of_memory = VK_SUCCESS != loader_resize_generic_list(NULL, (struct loader_generic_list *)&cached_layer_libraries);
+        }
+        char *lib_name = NULL;
+        if (!out_of_memory) {
+            out_of_memory = VK_SUCCESS != loader_copy_to_new_str(NULL, prop->lib_name, &lib_name);
+        }
+        if (!out_of_memory) {
+            struct loader_cached_layer_library *cached = &cached_layer_libraries.list[cached_layer_libraries.count++];
+            memset(cached, 0, sizeof(struct loader_cached_layer_library));
+            cached->lib_name = lib_name;
+            loader_strncpy(cached->layer_name, VK_MAX_EXTENSION_NAME_SIZE, prop->info.layerName, VK_MAX_EXTENSION_NAME_SIZE);
+            cached->lib_handle = prop->lib_handle;
+            cached->ref_count = 1;
+        }
+    }
+    loader_platform_thread_unlock_mutex(&loader_layer_library_cache_lock);
+
+    if (already_cached) {
+        // dlopen handed back the same handle with its own reference count, which the cache doesn't need
+        loader_platform_close_library(prop->lib_handle);
+    } else if (out_of_memory) {
+        loader_log(inst, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_LAYER_BIT, 0,
+                   "loader_add_cached_layer_library: Failed to allocate space to cache layer library %s, it will be unloaded "
+                   "normally",
+                   prop->lib_name);
+    }
+}
+
+// Stores the interface version and entrypoints negotiated with the layer so the next instance doesn't need to query them again.
+void loader_cache_layer_library_functions(const struct loader_layer_properties *prop) {
+    if (!loader_cache_layer_libraries || prop->interface_version < 2 || NULL == prop->functions.get_instance_proc_addr) {
+        return;
+    }
+    loader_platform_thread_lock_mutex(&loader_layer_library_cache_lock);
+    for (uint32_t i = 0; i < cached_layer_libraries.count; i++) {
+        struct loader_cached_layer_library *cached = &cached_layer_libraries.list[i];
+        if (cached->lib_handle == prop->lib_handle && strcmp(cached->layer_name, prop->info.layerName) == 0) {
+            cached->interface_version = prop->interface_version;
+            cached->negotiate_layer_interface = prop->functions.negotiate_layer_interface;
+            cached->get_instance_proc_addr = prop->functions.get_instance_proc_addr;
+            cached->get_device_proc_addr = prop->functions.get_device_proc_addr;
+            cached->get_physical_device_proc_addr = prop->functions.get_physical_device_proc_addr;
+            cached->functions_resolved = true;
+            break;
+        }
+    }
+    loader_platform_thread_unlock_mutex(&loader_layer_library_cache_lock);
+}
+
+// Drops a reference to a cached layer library. Returns false if lib_handle isn't in the cache, in which case the caller is
+// responsible for closing it. Libraries no longer referenced by anything are only kept loaded if layer library caching is enabled.
+bool loader_release_cached_layer_library(loader_platform_dl_handle lib_handle) {
+    bool found = false;
+    bool close_library = false;
+    loader_platform_thread_lock_mutex(&loader_layer_library_cache_lock);
+    for (uint32_t i = 0; i < cached_layer_libraries.count; i++) {
+        struct loader_cached_layer_library *cached = &cached_layer_libraries.list[i];
+        if (cached->lib_handle != lib_handle || cached->ref_count == 0) {
+            continue;
+        }
+        cached->ref_count--;
+        if (cached->ref_count == 0 && !loader_cache_layer_libraries) {
+            loader_free(NULL, cached->lib_name);
+            cached_layer_libraries.list[i] = cached_layer_libraries.list[cached_layer_libraries.count - 1];
+            cached_layer_libraries.count--;
+            close_library = true;
+        }
+        found = true;
+        break;
+    }
+    loader_platform_thread_unlock_mutex(&loader_layer_library_cache_lock);
+    if (close_library) {
+        loader_platform_close_library(lib_handle);
+    }
+    return found;
+}
+
+// Opens the library of prop through the layer library cache, regardless of whether layer library caching is enabled.
+loader_platform_dl_handle loader_open_cached_layer_file(const struct loader_instance *inst, struct loader_layer_properties *prop) {
+    if (loader_acquire_cached_layer_library(inst, prop)) {
+        return prop->lib_handle;
+    }
+    if (NULL != loader_open_layer_library(inst, prop)) {
+        loader_add_cached_layer_library(inst, prop);
+    }
+    return prop->lib_handle;
+}
+
+loader_platform_dl_handle loader_open_layer_file(const struct loader_instance *inst, struct loader_layer_properties *prop) {
+    if (loader_cache_layer_libraries) {
+        return loader_open_cached_layer_file(inst, prop);
+    }
+    // Libraries held by pre-instance chains which are in use on another thread are reused even when layer library caching is
+    // disabled
+    if (loader_acquire_cached_layer_library(inst, prop)) {
+        return prop->lib_handle;
+    }
+    return loader_open_layer_library(inst, prop);
+}
+
+void loader_close_layer_file(const struct loader_instance *inst, struct loader_layer_properties *prop) {
+    if (NULL == prop->lib_handle) {
+        return;
+    }
+    if (!loader_release_cached_layer_library(prop->lib_handle)) {
+        loader_platform_close_library(prop->lib_handle);
+        loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_LAYER_BIT, 0, "Unloading layer library %s", prop->lib_name);
+    }
+    prop->lib_handle = NULL;
+}
+
+// Records layer library opens which were avoided by reusing an already loaded library, returning the running total.
+uint32_t loader_add_avoided_layer_library_opens(uint32_t count) {
+    loader_platform_thread_lock_mutex(&loader_layer_library_cache_lock);
+    avoided_layer_library_opens += count;
+    uint32_t total = avoided_layer_library_opens;
+    loader_platform_thread_unlock_mutex(&loader_layer_library_cache_lock);
+    return total;
+}
+
 // Go through the search_list and find any layers which match type. If layer
 // type match is found in then add it to ext_list.
 VkResult loader_add_implicit_layers(const struct loader_instance *inst, const struct loader_envvar_all_filters *filters,
@@ -4674,8 +5251,15 @@ VKAPI_ATTR VkResult VKAPI_CALL loader_layer_create_device(VkInstance instance, V
 
     // Initialize WSI device extensions as part of core dispatch since loader
     // has dedicated trampoline code for these
-    loader_init_device_extension_dispatch_table(&dev->loader_dispatch, inst->disp->layer_inst_disp.GetInstanceProcAddr,
-                                                dev->loader_dispatch.core_dispatch.GetDeviceProcAddr, inst->instance, *pDevice);
+    if (loader_lazy_device_dispatch) {
+        loader_init_lazy_device_extension_dispatch_table(&dev->loader_dispatch, inst->disp->layer_inst_disp.GetInstanceProcAddr,
+                                                         dev->loader_dispatch.core_dispatch.GetDeviceProcAddr, inst->instance,
+                                                         *pDevice);
+    } else {
+        loader_init_device_extension_dispatch_table(&dev->loader_dispatch, inst->disp->layer_inst_disp.GetInstanceProcAddr,
+                                                    dev->loader_dispatch.core_dispatch.GetDeviceProcAddr, inst->instance, *pDevice,
+                                                    pCreateInfo);
+    }
 
 out:
 
@@ -4876,6 +5460,11 @@ VkResult loader_create_instance_chain(const VkInstanceCreateInfo *pCreateInfo, c
                         }
                     }
                 }
+            } else {
+                // The layer library came out of the layer library cache with its entrypoints already negotiated
+                cur_gipa = layer_prop->functions.get_instance_proc_addr;
+                cur_gdpa = layer_prop->functions.get_device_proc_addr;
+                cur_gpdpa = layer_prop->functions.get_physical_device_proc_addr;
             }
 
             layer_instance_link_info[num_activated_layers].pNext = chain_info.u.pLayerInfo;
@@ -4892,6 +5481,7 @@ VkResult loader_create_instance_chain(const VkInstanceCreateInfo *pCreateInfo, c
             if (layer_prop->interface_version > 1 && cur_gdpa != NULL) {
                 layer_prop->functions.get_device_proc_addr = cur_gdpa;
             }
+            loader_cache_layer_library_functions(layer_prop);
 
             chain_info.u.pLayerInfo = &layer_instance_link_info[num_activated_layers];
 
@@ -5330,7 +5920,16 @@ VkResult loader_create_device_chain(const VkPhysicalDevice pd, const VkDeviceCre
     }
 
     // Initialize device dispatch table
-    loader_init_device_dispatch_table(&dev->loader_dispatch, nextGDPA, dev->chain_device);
+    if (loader_lazy_device_dispatch) {
+        loader_init_lazy_device_dispatch_table(&dev->loader_dispatch, nextGDPA);
+    } else {
+        // Core commands are only queried for the API versions that either the physical device or the application use
+        uint32_t api_version = VK_MAKE_API_VERSION(0, inst->app_api_version.major, inst->app_api_version.minor, 0);
+        if (dev->physical_device_api_version > api_version) {
+            api_version = dev->physical_device_api_version;
+        }
+        loader_init_device_dispatch_table(&dev->loader_dispatch, nextGDPA, dev->chain_device, api_version);
+    }
     // Initialize the dispatch table to functions which need terminators
     // These functions point directly to the driver, not the terminator functions
     init_extension_device_proc_terminator_dispatch(dev);
@@ -5338,6 +5937,16 @@ VkResult loader_create_device_chain(const VkPhysicalDevice pd, const VkDeviceCre
     return res;
 }
 
+// Looks up a device command through the top of the device chain and stores it in the slot of the dispatch table, so that the
+// stub which called this is only ever hit once. Threads racing on the same slot all write the same value.
+PFN_vkVoidFunction loader_resolve_lazy_device_command(VkLayerDispatchTable *table, const char *name, PFN_vkVoidFunction *slot) {
+    // The core dispatch table is the first member of loader_device
+    struct loader_device *dev = (struct loader_device *)table;
+    PFN_vkVoidFunction addr = table->GetDeviceProcAddr(dev->chain_device, name);
+    *slot = addr;
+    return addr;
+}
+
 VkResult loader_validate_layers(const struct loader_instance *inst, const uint32_t layer_count,
                                 const char *const *ppEnabledLayerNames, const struct loader_layer_list *list) {
     struct loader_layer_properties *prop;
@@ -5803,24 +6412,24 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateInstance(const VkInstanceCreateI
         if (ptr_instance->icd_tramp_list.scanned_list[i].interface_version < 3 &&
             (
 #if defined(VK_USE_PLATFORM_XLIB_KHR)
-                NULL != icd_term->dispatch.CreateXlibSurfaceKHR ||
+                NULL != ICD_DISPATCH(icd_term, CreateXlibSurfaceKHR) ||
 #endif  // VK_USE_PLATFORM_XLIB_KHR
 #if defined(VK_USE_PLATFORM_XCB_KHR)
-                NULL != icd_term->dispatch.CreateXcbSurfaceKHR ||
+                NULL != ICD_DISPATCH(icd_term, CreateXcbSurfaceKHR) ||
 #endif  // VK_USE_PLATFORM_XCB_KHR
 #if defined(VK_USE_PLATFORM_WAYLAND_KHR)
-                NULL != icd_term->dispatch.CreateWaylandSurfaceKHR ||
+                NULL != ICD_DISPATCH(icd_term, CreateWaylandSurfaceKHR) ||
 #endif  // VK_USE_PLATFORM_WAYLAND_KHR
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
-                NULL != icd_term->dispatch.CreateAndroidSurfaceKHR ||
+                NULL != ICD_DISPATCH(icd_term, CreateAndroidSurfaceKHR) ||
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
 #if defined(VK_USE_PLATFORM_OHOS)
-                NULL != icd_term->dispatch.CreateSurfaceOHOS ||
+                NULL != ICD_DISPATCH(icd_term, CreateSurfaceOHOS) ||
 #endif  // VK_USE_PLATFORM_OHOS
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
-                NULL != icd_term->dispatch.CreateWin32SurfaceKHR ||
+                NULL != ICD_DISPATCH(icd_term, CreateWin32SurfaceKHR) ||
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-                NULL != icd_term->dispatch.DestroySurfaceKHR)) {
+                NULL != ICD_DISPATCH(icd_term, DestroySurfaceKHR))) {
             loader_log(ptr_instance, VULKAN_LOADER_WARN_BIT, 0,
                        "terminator_CreateInstance: Driver %s supports interface version %u but still exposes VkSurfaceKHR"
                        " create/destroy entrypoints (Policy #LDP_DRIVER_8)",
@@ -5871,7 +6480,7 @@ out:
             ptr_instance->icd_terms = icd_term->next;
             if (NULL != icd_term->instance) {
                 loader_icd_close_objects(ptr_instance, icd_term);
-                icd_term->dispatch.DestroyInstance(icd_term->instance, pAllocator);
+                ICD_DISPATCH(icd_term, DestroyInstance)(icd_term->instance, pAllocator);
             }
             loader_icd_destroy(ptr_instance, icd_term, pAllocator);
         }
@@ -5919,7 +6528,7 @@ VKAPI_ATTR void VKAPI_CALL terminator_DestroyInstance(VkInstance instance, const
     while (NULL != icd_terms) {
         if (icd_terms->instance) {
             loader_icd_close_objects(ptr_instance, icd_terms);
-            icd_terms->dispatch.DestroyInstance(icd_terms->instance, pAllocator);
+            ICD_DISPATCH(icd_terms, DestroyInstance)(icd_terms->instance, pAllocator);
         }
         struct loader_icd_term *next_icd_term = icd_terms->next;
         icd_terms->instance = VK_NULL_HANDLE;
@@ -5939,7 +6548,7 @@ VKAPI_ATTR void VKAPI_CALL terminator_DestroyInstance(VkInstance instance, const
             }
         }
         for (uint32_t i = 0; i < ptr_instance->phys_dev_count_term; i++) {
-            loader_instance_heap_free(ptr_instance, ptr_instance->phys_devs_term[i]);
+            loader_free_physical_device_term(ptr_instance, ptr_instance->phys_devs_term[i]);
         }
         loader_instance_heap_free(ptr_instance, ptr_instance->phys_devs_term);
     }
@@ -5963,7 +6572,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDevice(VkPhysicalDevice physical
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
 
     struct loader_device *dev = (struct loader_device *)*pDevice;
-    PFN_vkCreateDevice fpCreateDevice = icd_term->dispatch.CreateDevice;
+    PFN_vkCreateDevice fpCreateDevice = ICD_DISPATCH(icd_term, CreateDevice);
     struct loader_extension_list icd_exts;
 
     VkBaseOutStructure *caller_dgci_container = NULL;
@@ -6016,16 +6625,19 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDevice(VkPhysicalDevice physical
     localCreateInfo.enabledExtensionCount = 0;
     localCreateInfo.ppEnabledExtensionNames = (const char *const *)filtered_extension_names;
 
-    // Get the physical device (ICD) extensions
+    // Get the physical device (ICD) extensions, unless they are already cached
     res = loader_init_generic_list(icd_term->this_instance, (struct loader_generic_list *)&icd_exts, sizeof(VkExtensionProperties));
     if (VK_SUCCESS != res) {
         goto out;
     }
 
-    res = loader_add_device_extensions(icd_term->this_instance, icd_term->dispatch.EnumerateDeviceExtensionProperties,
-                                       phys_dev_term->phys_dev, icd_term->scanned_icd->lib_name, &icd_exts);
-    if (res != VK_SUCCESS) {
-        goto out;
+    struct loader_physical_device_property_cache *cache = loader_get_device_extension_cache(phys_dev_term);
+    if (NULL == cache) {
+        res = loader_add_device_extensions(icd_term->this_instance, ICD_DISPATCH(icd_term, EnumerateDeviceExtensionProperties),
+                                           phys_dev_term->phys_dev, icd_term->scanned_icd->lib_name, &icd_exts);
+        if (res != VK_SUCCESS) {
+            goto out;
+        }
     }
 
     for (uint32_t i = 0; i < pCreateInfo->enabledExtensionCount; i++) {
@@ -6036,7 +6648,16 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDevice(VkPhysicalDevice physical
         if (extension_name == NULL) {
             continue;
         }
-        VkExtensionProperties *prop = get_extension_property(extension_name, &icd_exts);
+        VkExtensionProperties *prop = NULL;
+        if (NULL != cache) {
+            // Only the first driver_device_extension_count entries of the cache come from the driver
+            prop = loader_string_map_find(&cache->device_extension_map, extension_name);
+            if (NULL != prop && (uint32_t)(prop - cache->device_extensions.list) >= cache->driver_device_extension_count) {
+                prop = NULL;
+            }
+        } else {
+            prop = get_extension_property(extension_name, &icd_exts);
+        }
         if (prop) {
             filtered_extension_names[localCreateInfo.enabledExtensionCount] = (char *)extension_name;
             localCreateInfo.enabledExtensionCount++;
@@ -6108,8 +6729,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDevice(VkPhysicalDevice physical
                 case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2: {
                     const VkPhysicalDeviceFeatures2KHR *features = pNext;
 
-                    if (icd_term->dispatch.GetPhysicalDeviceFeatures2 == NULL &&
-                        icd_term->dispatch.GetPhysicalDeviceFeatures2KHR == NULL) {
+                    if (ICD_DISPATCH(icd_term, GetPhysicalDeviceFeatures2) == NULL &&
+                        ICD_DISPATCH(icd_term, GetPhysicalDeviceFeatures2KHR) == NULL) {
                         loader_log(icd_term->this_instance, VULKAN_LOADER_INFO_BIT, 0,
                                    "vkCreateDevice: Emulating handling of VkPhysicalDeviceFeatures2 in pNext chain for ICD \"%s\"",
                                    icd_term->scanned_icd->lib_name);
@@ -6129,8 +6750,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDevice(VkPhysicalDevice physical
                 case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO: {
                     const VkDeviceGroupDeviceCreateInfo *group_info = pNext;
 
-                    if (icd_term->dispatch.EnumeratePhysicalDeviceGroups == NULL &&
-                        icd_term->dispatch.EnumeratePhysicalDeviceGroupsKHR == NULL) {
+                    if (ICD_DISPATCH(icd_term, EnumeratePhysicalDeviceGroups) == NULL &&
+                        ICD_DISPATCH(icd_term, EnumeratePhysicalDeviceGroupsKHR) == NULL) {
                         loader_log(icd_term->this_instance, VULKAN_LOADER_INFO_BIT, 0,
                                    "vkCreateDevice: Emulating handling of VkPhysicalDeviceGroupProperties in pNext chain for "
                                    "ICD \"%s\"",
@@ -6211,8 +6832,9 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDevice(VkPhysicalDevice physical
     dev->layer_extensions.ext_debug_utils_enabled = icd_term->this_instance->enabled_known_extensions.ext_debug_utils;
     dev->driver_extensions.ext_debug_utils_enabled = icd_term->this_instance->enabled_known_extensions.ext_debug_utils;
 
-    VkPhysicalDeviceProperties properties;
-    icd_term->dispatch.GetPhysicalDeviceProperties(phys_dev_term->phys_dev, &properties);
+    VkPhysicalDeviceProperties properties = {0};
+    terminator_GetPhysicalDeviceProperties(physicalDevice, &properties);
+    dev->physical_device_api_version = properties.apiVersion;
     if (properties.apiVersion >= VK_API_VERSION_1_1) {
         dev->driver_extensions.version_1_1_enabled = true;
     }
@@ -6226,10 +6848,22 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDevice(VkPhysicalDevice physical
     loader_log(icd_term->this_instance, VULKAN_LOADER_LAYER_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
                "       Using \"%s\" with driver: \"%s\"", properties.deviceName, icd_term->scanned_icd->lib_name);
 
+    // The ICD is now in use, so give it the debug messengers and report callbacks it skipped until now
+    res = util_ActivateDriverDebugCallbacks(icd_term);
+    if (res != VK_SUCCESS) {
+        loader_log(icd_term->this_instance, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                   "terminator_CreateDevice: Failed to create the debug callbacks of ICD %s", icd_term->scanned_icd->lib_name);
+        goto out;
+    }
+
     res = fpCreateDevice(phys_dev_term->phys_dev, &localCreateInfo, pAllocator, &dev->icd_device);
     if (res != VK_SUCCESS) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
                    "terminator_CreateDevice: Failed in ICD %s vkCreateDevice call", icd_term->scanned_icd->lib_name);
+        // The physical device may have been unplugged, make sure vkEnumeratePhysicalDevices asks the drivers again
+        if (VK_ERROR_DEVICE_LOST == res || VK_ERROR_INITIALIZATION_FAILED == res) {
+            loader_physical_device_generation++;
+        }
         goto out;
     }
 
@@ -6253,6 +6887,22 @@ out:
     return res;
 }
 
+void loader_check_for_physical_device_changes(void) {
+#if defined(__linux__)
+    loader_platform_file_info dri_directory_info = {0};
+    bool dri_directory_info_valid = loader_platform_get_file_info("/dev/dri", &dri_directory_info);
+    if (dri_directory_info_valid != loader_dri_directory_info_valid ||
+        (dri_directory_info_valid &&
+         (dri_directory_info.modification_time_sec != loader_dri_directory_info.modification_time_sec ||
+          dri_directory_info.modification_time_nsec != loader_dri_directory_info.modification_time_nsec ||
+          dri_directory_info.file_id != loader_dri_directory_info.file_id))) {
+        loader_physical_device_generation++;
+    }
+    loader_dri_directory_info_valid = dri_directory_info_valid;
+    loader_dri_directory_info = dri_directory_info;
+#endif
+}
+
 // Update the trampoline physical devices with the wrapped version.
 // We always want to re-use previous physical device pointers since they may be used by an application
 // after returning previously.
@@ -6262,6 +6912,7 @@ VkResult setup_loader_tramp_phys_devs(struct loader_instance *inst, uint32_t phy
     uint32_t old_count = inst->phys_dev_count_tramp;
     uint32_t new_count = inst->total_gpu_count;
     struct loader_physical_device_tramp **new_phys_devs = NULL;
+    struct loader_handle_map old_phys_devs_map = {0};
 
     if (0 == phys_dev_count) {
         return VK_SUCCESS;
@@ -6270,6 +6921,21 @@ VkResult setup_loader_tramp_phys_devs(struct loader_instance *inst, uint32_t phy
         new_count = phys_dev_count;
     }
 
+    // Nothing changed since the last call, which is always the case when the terminator returned its cached physical devices, so
+    // all that is left to do is to hand out the same trampoline physical devices again
+    if (0 != old_count && old_count == new_count) {
+        uint32_t same_count = 0;
+        while (same_count < phys_dev_count && inst->phys_devs_tramp[same_count]->phys_dev == phys_devs[same_count]) {
+            same_count++;
+        }
+        if (same_count == phys_dev_count) {
+            for (uint32_t new_idx = 0; new_idx < phys_dev_count; ++new_idx) {
+                phys_devs[new_idx] = (VkPhysicalDevice)inst->phys_devs_tramp[new_idx];
+            }
+            return VK_SUCCESS;
+        }
+    }
+
     // We want an old to new index array and a new to old index array
     int32_t *old_to_new_index = (int32_t *)loader_stack_alloc(sizeof(int32_t) * old_count);
     int32_t *new_to_old_index = (int32_t *)loader_stack_alloc(sizeof(int32_t) * new_count);
@@ -6285,15 +6951,32 @@ VkResult setup_loader_tramp_phys_devs(struct loader_instance *inst, uint32_t phy
         new_to_old_index[cur_idx] = -1;
     }
 
-    // Figure out the old->new and new->old indices
+    // Map the driver's handle of each old physical device to its slot in phys_devs_tramp, so that matching up the old and new
+    // physical devices takes time proportional to their count rather than to the product of both counts
+    res = loader_init_handle_map(inst, &old_phys_devs_map, old_count);
+    if (VK_SUCCESS != res) {
+        goto out;
+    }
     for (uint32_t cur_idx = 0; cur_idx < old_count; ++cur_idx) {
-        for (uint32_t new_idx = 0; new_idx < phys_dev_count; ++new_idx) {
-            if (inst->phys_devs_tramp[cur_idx]->phys_dev == phys_devs[new_idx]) {
-                old_to_new_index[cur_idx] = (int32_t)new_idx;
-                new_to_old_index[new_idx] = (int32_t)cur_idx;
-                found_count++;
-                break;
-            }
+        res = loader_handle_map_insert(inst, &old_phys_devs_map, inst->phys_devs_tramp[cur_idx]->phys_dev,
+                                       &inst->phys_devs_tramp[cur_idx]);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+    }
+
+    // Figure out the old->new and new->old indices
+    for (uint32_t new_idx = 0; new_idx < phys_dev_count; ++new_idx) {
+        struct loader_physical_device_tramp **old_slot = loader_handle_map_find(&old_phys_devs_map, phys_devs[new_idx]);
+        if (NULL == old_slot) {
+            continue;
+        }
+        uint32_t cur_idx = (uint32_t)(old_slot - inst->phys_devs_tramp);
+        // An old device only matches the first time it shows up in phys_devs
+        if (old_to_new_index[cur_idx] == -1) {
+            old_to_new_index[cur_idx] = (int32_t)new_idx;
+            new_to_old_index[new_idx] = (int32_t)cur_idx;
+            found_count++;
         }
     }
 
@@ -6302,12 +6985,7 @@ VkResult setup_loader_tramp_phys_devs(struct loader_instance *inst, uint32_t phy
     // the loader values.
     if (found_count == phys_dev_count && 0 != old_count && old_count == new_count) {
         for (uint32_t new_idx = 0; new_idx < phys_dev_count; ++new_idx) {
-            for (uint32_t cur_idx = 0; cur_idx < old_count; ++cur_idx) {
-                if (old_to_new_index[cur_idx] == (int32_t)new_idx) {
-                    phys_devs[new_idx] = (VkPhysicalDevice)inst->phys_devs_tramp[cur_idx];
-                    break;
-                }
-            }
+            phys_devs[new_idx] = (VkPhysicalDevice)inst->phys_devs_tramp[new_to_old_index[new_idx]];
         }
         // Nothing else to do for this path
         res = VK_SUCCESS;
@@ -6332,17 +7010,11 @@ VkResult setup_loader_tramp_phys_devs(struct loader_instance *inst, uint32_t phy
 
         // First try to see if an old item exists that matches the new item.  If so, just copy it over.
         for (uint32_t new_idx = 0; new_idx < found_count; ++new_idx) {
-            bool old_item_found = false;
-            for (uint32_t cur_idx = 0; cur_idx < old_count; ++cur_idx) {
-                if (old_to_new_index[cur_idx] == (int32_t)new_idx) {
-                    // Copy over old item to correct spot in the new array
-                    new_phys_devs[new_idx] = inst->phys_devs_tramp[cur_idx];
-                    old_item_found = true;
-                    break;
-                }
-            }
-            // Something wasn't found, so it's new so add it to the new list
-            if (!old_item_found) {
+            if (new_to_old_index[new_idx] != -1) {
+                // Copy over old item to correct spot in the new array
+                new_phys_devs[new_idx] = inst->phys_devs_tramp[new_to_old_index[new_idx]];
+            } else {
+                // Something wasn't found, so it's new so add it to the new list
                 new_phys_devs[new_idx] = loader_instance_heap_alloc(inst, sizeof(struct loader_physical_device_tramp),
                                                                     VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
                 if (NULL == new_phys_devs[new_idx]) {
@@ -6365,15 +7037,17 @@ VkResult setup_loader_tramp_phys_devs(struct loader_instance *inst, uint32_t phy
         // We usually get here if the user array is smaller than the total number of devices, so copy the
         // remaining devices we have over to the new array.
         uint32_t start = found_count;
+        uint32_t unused_old_idx = 0;
         for (uint32_t new_idx = start; new_idx < new_count; ++new_idx) {
-            for (uint32_t cur_idx = 0; cur_idx < old_count; ++cur_idx) {
-                if (old_to_new_index[cur_idx] == -1) {
-                    new_phys_devs[new_idx] = inst->phys_devs_tramp[cur_idx];
-                    old_to_new_index[cur_idx] = new_idx;
-                    found_count++;
-                    break;
-                }
+            while (unused_old_idx < old_count && old_to_new_index[unused_old_idx] != -1) {
+                unused_old_idx++;
             }
+            if (unused_old_idx == old_count) {
+                break;
+            }
+            new_phys_devs[new_idx] = inst->phys_devs_tramp[unused_old_idx];
+            old_to_new_index[unused_old_idx] = (int32_t)new_idx;
+            found_count++;
         }
     }
 
@@ -6386,14 +7060,7 @@ out:
                 // will leave some of the old physical devices in the array which may have been copied into
                 // the new array, leading to them being freed twice. To avoid this we just make sure to not
                 // delete physical devices which were copied.
-                bool found = false;
-                for (uint32_t cur_idx = 0; cur_idx < inst->phys_dev_count_tramp; cur_idx++) {
-                    if (new_phys_devs[new_idx] == inst->phys_devs_tramp[cur_idx]) {
-                        found = true;
-                        break;
-                    }
-                }
-                if (!found) {
+                if (new_to_old_index[new_idx] == -1) {
                     loader_instance_heap_free(inst, new_phys_devs[new_idx]);
                 }
             }
@@ -6408,14 +7075,7 @@ out:
             // in memory leaking.
             if (NULL != inst->phys_devs_tramp) {
                 for (uint32_t i = 0; i < inst->phys_dev_count_tramp; i++) {
-                    bool found = false;
-                    for (uint32_t j = 0; j < inst->total_gpu_count; j++) {
-                        if (inst->phys_devs_tramp[i] == new_phys_devs[j]) {
-                            found = true;
-                            break;
-                        }
-                    }
-                    if (!found) {
+                    if (old_to_new_index[i] == -1) {
                         loader_instance_heap_free(inst, inst->phys_devs_tramp[i]);
                     }
                 }
@@ -6425,6 +7085,7 @@ out:
             inst->phys_dev_count_tramp = found_count;
         }
     }
+    loader_destroy_handle_map(inst, &old_phys_devs_map);
     if (VK_SUCCESS != res) {
         inst->total_gpu_count = 0;
     }
@@ -6447,55 +7108,178 @@ bool is_linux_sort_enabled(struct loader_instance *inst) {
 }
 #endif  // LOADER_ENABLE_LINUX_SORT
 
-// Look for physical_device in the provided phys_devs list, return true if found and put the index into out_idx, otherwise
-// return false
-bool find_phys_dev(VkPhysicalDevice physical_device, uint32_t phys_devs_count, struct loader_physical_device_term **phys_devs,
-                   uint32_t *out_idx) {
-    if (NULL == phys_devs) return false;
-    for (uint32_t idx = 0; idx < phys_devs_count; idx++) {
-        if (NULL != phys_devs[idx] && physical_device == phys_devs[idx]->phys_dev) {
-            *out_idx = idx;
-            return true;
+struct loader_physical_device_property_cache *loader_get_physical_device_property_cache(
+    struct loader_physical_device_term *phys_dev_term) {
+    if (!loader_cache_physical_device_properties) {
+        return NULL;
+    }
+    if (NULL == phys_dev_term->property_cache) {
+        phys_dev_term->property_cache =
+            loader_instance_heap_calloc(phys_dev_term->this_icd_term->this_instance,
+                                        sizeof(struct loader_physical_device_property_cache), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    }
+    return phys_dev_term->property_cache;
+}
+
+// Fill in the device extensions of cache, asking the driver for its extensions with loader_physical_device_property_cache_lock
+// released and publishing the list with it held
+VkResult loader_read_cached_device_extensions(struct loader_physical_device_term *phys_dev_term,
+                                              struct loader_physical_device_property_cache *cache) {
+    struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
+    const struct loader_instance *inst = icd_term->this_instance;
+    const struct loader_pointer_layer_list *activated_layers = &inst->expanded_activated_layer_list;
+    struct loader_extension_list exts = {0};
+    struct loader_string_map ext_map = {0};
+    uint32_t driver_count = 0;
+    bool published = false;
+
+    VkResult res = ICD_DISPATCH(icd_term, EnumerateDeviceExtensionProperties)(phys_dev_term->phys_dev, NULL, &driver_count, NULL);
+    if (res != VK_SUCCESS) {
+        goto out;
+    }
+
+    // Allocate room for every extension up front, the map points into the list so it must never be reallocated
+    uint32_t max_count = driver_count;
+    for (uint32_t i = 0; i < activated_layers->count; i++) {
+        if (0 == (activated_layers->list[i]->type_flags & VK_LAYER_TYPE_FLAG_EXPLICIT_LAYER)) {
+            max_count += activated_layers->list[i]->device_extension_list.count;
         }
     }
-    return false;
+    exts.capacity = sizeof(VkExtensionProperties) * (max_count > 0 ? max_count : 1);
+    exts.list = loader_instance_heap_calloc(inst, exts.capacity, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == exts.list) {
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
+    }
+    res = ICD_DISPATCH(icd_term, EnumerateDeviceExtensionProperties)(phys_dev_term->phys_dev, NULL, &driver_count, exts.list);
+    if (res != VK_SUCCESS) {
+        goto out;
+    }
+    exts.count = driver_count;
+
+    res = loader_init_string_map(inst, &ext_map, max_count);
+    if (res != VK_SUCCESS) {
+        goto out;
+    }
+    for (uint32_t i = 0; i < exts.count; i++) {
+        res = loader_string_map_insert(inst, &ext_map, exts.list[i].extensionName, &exts.list[i]);
+        if (res != VK_SUCCESS) {
+            goto out;
+        }
+    }
+
+    // Add the device extensions of active implicit layers which the driver doesn't already provide
+    for (uint32_t i = 0; i < activated_layers->count; i++) {
+        if (0 != (activated_layers->list[i]->type_flags & VK_LAYER_TYPE_FLAG_EXPLICIT_LAYER)) {
+            continue;
+        }
+        const struct loader_device_extension_list *layer_ext_list = &activated_layers->list[i]->device_extension_list;
+        for (uint32_t j = 0; j < layer_ext_list->count; j++) {
+            if (NULL != loader_string_map_find(&ext_map, layer_ext_list->list[j].props.extensionName)) {
+                continue;
+            }
+            exts.list[exts.count] = layer_ext_list->list[j].props;
+            res = loader_string_map_insert(inst, &ext_map, exts.list[exts.count].extensionName, &exts.list[exts.count]);
+            if (res != VK_SUCCESS) {
+                goto out;
+            }
+            exts.count++;
+        }
+    }
+
+    loader_platform_thread_lock_mutex(&loader_physical_device_property_cache_lock);
+    published = !cache->has_device_extensions;
+    if (published) {
+        cache->driver_device_extension_count = driver_count;
+        cache->device_extensions = exts;
+        cache->device_extension_map = ext_map;
+        cache->has_device_extensions = true;
+    }
+    loader_platform_thread_unlock_mutex(&loader_physical_device_property_cache_lock);
+
+out:
+    // Another thread publishing its list first leaves this one unused
+    if (res != VK_SUCCESS || !published) {
+        loader_destroy_generic_list(inst, (struct loader_generic_list *)&exts);
+        loader_destroy_string_map(inst, &ext_map);
+    }
+    return res;
+}
+
+struct loader_physical_device_property_cache *loader_get_device_extension_cache(struct loader_physical_device_term *phys_dev_term) {
+    if (!loader_cache_physical_device_properties) {
+        return NULL;
+    }
+    loader_platform_thread_lock_mutex(&loader_physical_device_property_cache_lock);
+    struct loader_physical_device_property_cache *cache = loader_get_physical_device_property_cache(phys_dev_term);
+    bool cached = NULL != cache && cache->has_device_extensions;
+    loader_platform_thread_unlock_mutex(&loader_physical_device_property_cache_lock);
+    if (NULL == cache || cached) {
+        return cache;
+    }
+    // The list is published at most once, so a successful read or another thread's list both leave it filled in
+    if (VK_SUCCESS != loader_read_cached_device_extensions(phys_dev_term, cache)) {
+        return NULL;
+    }
+    return cache;
 }
 
-// Add physical_device to new_phys_devs
+void loader_free_physical_device_term(const struct loader_instance *inst, struct loader_physical_device_term *phys_dev_term) {
+    if (NULL == phys_dev_term) {
+        return;
+    }
+    if (NULL != phys_dev_term->property_cache) {
+        loader_instance_heap_free(inst, phys_dev_term->property_cache->queue_family_properties);
+        loader_destroy_generic_list(inst, (struct loader_generic_list *)&phys_dev_term->property_cache->device_extensions);
+        loader_destroy_string_map(inst, &phys_dev_term->property_cache->device_extension_map);
+        loader_instance_heap_free(inst, phys_dev_term->property_cache);
+    }
+    loader_instance_heap_free(inst, phys_dev_term);
+}
+
+// Add physical_device to new_phys_devs, unless it is already in it. old_phys_devs_map and new_phys_devs_map map the driver's
+// handles to the slots of inst->phys_devs_term and to the entries of new_phys_devs respectively, old_to_new_index records where
+// each physical device carried over from inst->phys_devs_term ended up.
 VkResult check_and_add_to_new_phys_devs(struct loader_instance *inst, VkPhysicalDevice physical_device,
                                         struct loader_icd_physical_devices *dev_array, uint32_t *cur_new_phys_dev_count,
-                                        struct loader_physical_device_term **new_phys_devs) {
-    uint32_t out_idx = 0;
+                                        struct loader_physical_device_term **new_phys_devs,
+                                        const struct loader_handle_map *old_phys_devs_map,
+                                        struct loader_handle_map *new_phys_devs_map, int32_t *old_to_new_index) {
     uint32_t idx = *cur_new_phys_dev_count;
     // Check if the physical_device already exists in the new_phys_devs buffer, that means it was found from both
     // EnumerateAdapterPhysicalDevices and EnumeratePhysicalDevices and we need to skip it.
-    if (find_phys_dev(physical_device, idx, new_phys_devs, &out_idx)) {
+    if (NULL != loader_handle_map_find(new_phys_devs_map, physical_device)) {
         return VK_SUCCESS;
     }
     // Check if it was found in a previous call to vkEnumeratePhysicalDevices, we can just copy over the old data.
-    if (find_phys_dev(physical_device, inst->phys_dev_count_term, inst->phys_devs_term, &out_idx)) {
-        new_phys_devs[idx] = inst->phys_devs_term[out_idx];
-        (*cur_new_phys_dev_count)++;
-        return VK_SUCCESS;
-    }
+    struct loader_physical_device_term **old_slot = loader_handle_map_find(old_phys_devs_map, physical_device);
+    if (NULL != old_slot) {
+        new_phys_devs[idx] = *old_slot;
+        old_to_new_index[old_slot - inst->phys_devs_term] = (int32_t)idx;
+    } else {
+        // Exit in case something is already present - this shouldn't happen but better to be safe than overwrite existing data
+        // since this code has been refactored a half dozen times.
+        if (NULL != new_phys_devs[idx]) {
+            return VK_SUCCESS;
+        }
+        // If this physical device is new, we need to allocate space for it.
+        new_phys_devs[idx] =
+            loader_instance_heap_calloc(inst, sizeof(struct loader_physical_device_term), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        if (NULL == new_phys_devs[idx]) {
+            loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
+                       "check_and_add_to_new_phys_devs:  Failed to allocate physical device terminator object %d", idx);
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
 
-    // Exit in case something is already present - this shouldn't happen but better to be safe than overwrite existing data
-    // since this code has been refactored a half dozen times.
-    if (NULL != new_phys_devs[idx]) {
-        return VK_SUCCESS;
-    }
-    // If this physical device is new, we need to allocate space for it.
-    new_phys_devs[idx] =
-        loader_instance_heap_alloc(inst, sizeof(struct loader_physical_device_term), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
-    if (NULL == new_phys_devs[idx]) {
-        loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
-                   "check_and_add_to_new_phys_devs:  Failed to allocate physical device terminator object %d", idx);
-        return VK_ERROR_OUT_OF_HOST_MEMORY;
+        loader_set_dispatch((void *)new_phys_devs[idx], inst->disp);
+        new_phys_devs[idx]->this_icd_term = dev_array->icd_term;
+        new_phys_devs[idx]->phys_dev = physical_device;
     }
 
-    loader_set_dispatch((void *)new_phys_devs[idx], inst->disp);
-    new_phys_devs[idx]->this_icd_term = dev_array->icd_term;
-    new_phys_devs[idx]->phys_dev = physical_device;
+    VkResult res = loader_handle_map_insert(inst, new_phys_devs_map, physical_device, new_phys_devs[idx]);
+    if (VK_SUCCESS != res) {
+        return res;
+    }
 
     // Increment the count of new physical devices
     (*cur_new_phys_dev_count)++;
@@ -6523,6 +7307,9 @@ VkResult setup_loader_term_phys_devs(struct loader_instance *inst) {
     uint32_t new_phys_devs_capacity = 0;
     uint32_t new_phys_devs_count = 0;
     struct loader_physical_device_term **new_phys_devs = NULL;
+    struct loader_handle_map old_phys_devs_map = {0};
+    struct loader_handle_map new_phys_devs_map = {0};
+    int32_t *old_to_new_index = NULL;
 
 #if defined(_WIN32)
     // Get the physical devices supported by platform sorting mechanism into a separate list
@@ -6551,7 +7338,7 @@ VkResult setup_loader_term_phys_devs(struct loader_instance *inst) {
     icd_term = inst->icd_terms;
     uint32_t icd_idx = 0;
     while (NULL != icd_term) {
-        res = icd_term->dispatch.EnumeratePhysicalDevices(icd_term->instance, &icd_phys_dev_array[icd_idx].device_count, NULL);
+        res = ICD_DISPATCH(icd_term, EnumeratePhysicalDevices)(icd_term->instance, &icd_phys_dev_array[icd_idx].device_count, NULL);
         if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
             loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
                        "setup_loader_term_phys_devs: Call to \'vkEnumeratePhysicalDevices\' in ICD %s failed with error code "
@@ -6570,8 +7357,8 @@ VkResult setup_loader_term_phys_devs(struct loader_instance *inst) {
                 goto out;
             }
 
-            res = icd_term->dispatch.EnumeratePhysicalDevices(icd_term->instance, &(icd_phys_dev_array[icd_idx].device_count),
-                                                              icd_phys_dev_array[icd_idx].physical_devices);
+            res = ICD_DISPATCH(icd_term, EnumeratePhysicalDevices)(icd_term->instance, &(icd_phys_dev_array[icd_idx].device_count),
+                                                                   icd_phys_dev_array[icd_idx].physical_devices);
             if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
                 loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
                            "setup_loader_term_phys_devs: Call to \'vkEnumeratePhysicalDevices\' in ICD %s failed with error code "
@@ -6616,6 +7403,16 @@ VkResult setup_loader_term_phys_devs(struct loader_instance *inst) {
         goto out;
     }
 
+    // Records which entry of new_phys_devs each physical device from a previous call to vkEnumeratePhysicalDevices was copied to
+    old_to_new_index = (int32_t *)loader_stack_alloc(sizeof(int32_t) * inst->phys_dev_count_term);
+    if (NULL == old_to_new_index) {
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
+    }
+    for (uint32_t old_idx = 0; old_idx < inst->phys_dev_count_term; old_idx++) {
+        old_to_new_index[old_idx] = -1;
+    }
+
     // Create an allocation large enough to hold both the windows sorting enumeration and non-windows physical device
     // enumeration
     new_phys_devs = loader_instance_heap_calloc(inst, sizeof(struct loader_physical_device_term *) * new_phys_devs_capacity,
@@ -6627,11 +7424,31 @@ VkResult setup_loader_term_phys_devs(struct loader_instance *inst) {
         goto out;
     }
 
+    // Look up the physical devices from previous calls and the ones already added by the driver's handle, rather than searching
+    // through both arrays for every physical device
+    res = loader_init_handle_map(inst, &old_phys_devs_map, inst->phys_dev_count_term);
+    if (VK_SUCCESS != res) {
+        goto out;
+    }
+    for (uint32_t old_idx = 0; old_idx < inst->phys_dev_count_term; old_idx++) {
+        if (NULL == inst->phys_devs_term[old_idx]) continue;
+        res = loader_handle_map_insert(inst, &old_phys_devs_map, inst->phys_devs_term[old_idx]->phys_dev,
+                                       &inst->phys_devs_term[old_idx]);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+    }
+    res = loader_init_handle_map(inst, &new_phys_devs_map, new_phys_devs_capacity);
+    if (VK_SUCCESS != res) {
+        goto out;
+    }
+
     // Copy over everything found through sorted enumeration
     for (uint32_t i = 0; i < windows_sorted_devices_count; ++i) {
         for (uint32_t j = 0; j < windows_sorted_devices_array[i].device_count; ++j) {
             res = check_and_add_to_new_phys_devs(inst, windows_sorted_devices_array[i].physical_devices[j],
-                                                 &windows_sorted_devices_array[i], &new_phys_devs_count, new_phys_devs);
+                                                 &windows_sorted_devices_array[i], &new_phys_devs_count, new_phys_devs,
+                                                 &old_phys_devs_map, &new_phys_devs_map, old_to_new_index);
             if (res == VK_ERROR_OUT_OF_HOST_MEMORY) {
                 goto out;
             }
@@ -6644,7 +7461,7 @@ VkResult setup_loader_term_phys_devs(struct loader_instance *inst) {
     if (is_linux_sort_enabled(inst)) {
         for (uint32_t dev = new_phys_devs_count; dev < new_phys_devs_capacity; ++dev) {
             new_phys_devs[dev] =
-                loader_instance_heap_alloc(inst, sizeof(struct loader_physical_device_term), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+                loader_instance_heap_calloc(inst, sizeof(struct loader_physical_device_term), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
             if (NULL == new_phys_devs[dev]) {
                 loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
                            "setup_loader_term_phys_devs:  Failed to allocate physical device terminator object %d", dev);
@@ -6656,22 +7473,28 @@ VkResult setup_loader_term_phys_devs(struct loader_instance *inst) {
         // Get the physical devices supported by platform sorting mechanism into a separate list
         // Pass in a sublist to the function so it only operates on the correct elements. This means passing in a pointer to the
         // current next element in new_phys_devs and passing in a `count` of currently unwritten elements
-        res = linux_read_sorted_physical_devices(inst, icd_count, icd_phys_dev_array, new_phys_devs_capacity - new_phys_devs_count,
-                                                 &new_phys_devs[new_phys_devs_count]);
+        res = linux_read_sorted_physical_devices(inst, icd_count, icd_phys_dev_array, &old_phys_devs_map,
+                                                 new_phys_devs_capacity - new_phys_devs_count, &new_phys_devs[new_phys_devs_count]);
         if (res == VK_ERROR_OUT_OF_HOST_MEMORY) {
             goto out;
         }
         // Keep previously allocated physical device info since apps may already be using that!
         for (uint32_t new_idx = new_phys_devs_count; new_idx < new_phys_devs_capacity; new_idx++) {
-            for (uint32_t old_idx = 0; old_idx < inst->phys_dev_count_term; old_idx++) {
-                if (new_phys_devs[new_idx]->phys_dev == inst->phys_devs_term[old_idx]->phys_dev) {
-                    loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
-                               "Copying old device %u into new device %u", old_idx, new_idx);
-                    // Free the old new_phys_devs info since we're not using it before we assign the new info
-                    loader_instance_heap_free(inst, new_phys_devs[new_idx]);
-                    new_phys_devs[new_idx] = inst->phys_devs_term[old_idx];
-                    break;
+            struct loader_physical_device_term **old_slot =
+                loader_handle_map_find(&old_phys_devs_map, new_phys_devs[new_idx]->phys_dev);
+            if (NULL != old_slot) {
+                uint32_t old_idx = (uint32_t)(old_slot - inst->phys_devs_term);
+                loader_log(inst, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_DRIVER_BIT, 0, "Copying old device %u into new device %u",
+                           old_idx, new_idx);
+                // Keep the sorting information if the old device was found while sorting was disabled
+                if (!(*old_slot)->has_sort_info) {
+                    (*old_slot)->has_sort_info = true;
+                    (*old_slot)->sort_info = new_phys_devs[new_idx]->sort_info;
                 }
+                // Free the old new_phys_devs info since we're not using it before we assign the new info
+                loader_free_physical_device_term(inst, new_phys_devs[new_idx]);
+                new_phys_devs[new_idx] = *old_slot;
+                old_to_new_index[old_idx] = (int32_t)new_idx;
             }
         }
         // now set the count to the capacity, as now the list is filled in
@@ -6684,7 +7507,8 @@ VkResult setup_loader_term_phys_devs(struct loader_instance *inst) {
         for (uint32_t i = 0; i < icd_count; ++i) {
             for (uint32_t j = 0; j < icd_phys_dev_array[i].device_count; ++j) {
                 res = check_and_add_to_new_phys_devs(inst, icd_phys_dev_array[i].physical_devices[j], &icd_phys_dev_array[i],
-                                                     &new_phys_devs_count, new_phys_devs);
+                                                     &new_phys_devs_count, new_phys_devs, &old_phys_devs_map,
+                                                     &new_phys_devs_map, old_to_new_index);
                 if (res == VK_ERROR_OUT_OF_HOST_MEMORY) {
                     goto out;
                 }
@@ -6698,26 +7522,19 @@ out:
     if (VK_SUCCESS != res) {
         if (NULL != new_phys_devs) {
             // We've encountered an error, so we should free the new buffers.
+            // If an OOM occurred inside the copying of the new physical devices into the existing array
+            // will leave some of the old physical devices in the array which may have been copied into
+            // the new array, leading to them being freed twice. To avoid this we just make sure to not
+            // delete physical devices which were copied.
+            for (uint32_t old_idx = 0; old_idx < inst->phys_dev_count_term; old_idx++) {
+                if (old_to_new_index[old_idx] != -1) {
+                    new_phys_devs[old_to_new_index[old_idx]] = NULL;
+                }
+            }
             for (uint32_t i = 0; i < new_phys_devs_capacity; i++) {
                 // May not have allocated this far, skip it if we hadn't.
                 if (new_phys_devs[i] == NULL) continue;
-
-                // If an OOM occurred inside the copying of the new physical devices into the existing array
-                // will leave some of the old physical devices in the array which may have been copied into
-                // the new array, leading to them being freed twice. To avoid this we just make sure to not
-                // delete physical devices which were copied.
-                bool found = false;
-                if (NULL != inst->phys_devs_term) {
-                    for (uint32_t old_idx = 0; old_idx < inst->phys_dev_count_term; old_idx++) {
-                        if (new_phys_devs[i] == inst->phys_devs_term[old_idx]) {
-                            found = true;
-                            break;
-                        }
-                    }
-                }
-                if (!found) {
-                    loader_instance_heap_free(inst, new_phys_devs[i]);
-                }
+                loader_free_physical_device_term(inst, new_phys_devs[i]);
             }
             loader_instance_heap_free(inst, new_phys_devs);
         }
@@ -6729,15 +7546,8 @@ out:
             // looking before the "out:" label may hit an out of memory condition resulting
             // in memory leaking.
             for (uint32_t i = 0; i < inst->phys_dev_count_term; i++) {
-                bool found = false;
-                for (uint32_t j = 0; j < new_phys_devs_count; j++) {
-                    if (new_phys_devs != NULL && inst->phys_devs_term[i] == new_phys_devs[j]) {
-                        found = true;
-                        break;
-                    }
-                }
-                if (!found) {
-                    loader_instance_heap_free(inst, inst->phys_devs_term[i]);
+                if (old_to_new_index[i] == -1) {
+                    loader_free_physical_device_term(inst, inst->phys_devs_term[i]);
                 }
             }
             loader_instance_heap_free(inst, inst->phys_devs_term);
@@ -6749,6 +7559,9 @@ out:
         inst->total_gpu_count = new_phys_devs_count;
     }
 
+    loader_destroy_handle_map(inst, &old_phys_devs_map);
+    loader_destroy_handle_map(inst, &new_phys_devs_map);
+
     if (windows_sorted_devices_array != NULL) {
         for (uint32_t i = 0; i < windows_sorted_devices_count; ++i) {
             if (windows_sorted_devices_array[i].device_count > 0 && windows_sorted_devices_array[i].physical_devices != NULL) {
@@ -6788,7 +7601,7 @@ void unload_drivers_without_physical_devices(struct loader_instance *inst) {
                 const VkAllocationCallbacks *allocation_callbacks = ignore_null_callback(&(inst->alloc_callbacks));
                 if (cur_icd_term->instance) {
                     loader_icd_close_objects(inst, cur_icd_term);
-                    cur_icd_term->dispatch.DestroyInstance(cur_icd_term->instance, allocation_callbacks);
+                    ICD_DISPATCH(cur_icd_term, DestroyInstance)(cur_icd_term->instance, allocation_callbacks);
                 }
                 cur_icd_term->instance = VK_NULL_HANDLE;
                 loader_icd_destroy(inst, cur_icd_term, allocation_callbacks);
@@ -6884,10 +7697,20 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumeratePhysicalDevices(VkInstance in
     VkResult res = VK_SUCCESS;
 
     // Always call the setup loader terminator physical devices because they may
-    // have changed at any point.
-    res = setup_loader_term_phys_devs(inst);
-    if (VK_SUCCESS != res) {
-        goto out;
+    // have changed at any point, unless the previous result is cached and nothing
+    // indicates that the physical devices changed since.
+    if (loader_cache_physical_devices) {
+        loader_check_for_physical_device_changes();
+    }
+    if (!loader_cache_physical_devices || !inst->phys_devs_term_cache_valid ||
+        inst->phys_devs_term_generation != loader_physical_device_generation) {
+        inst->phys_devs_term_cache_valid = false;
+        res = setup_loader_term_phys_devs(inst);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+        inst->phys_devs_term_cache_valid = loader_cache_physical_devices;
+        inst->phys_devs_term_generation = loader_physical_device_generation;
     }
 
     uint32_t copy_count = inst->phys_dev_count_term;
@@ -6968,12 +7791,26 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumerateDeviceExtensionProperties(VkP
         return VK_SUCCESS;
     }
 
+    // The extensions never change, so with cached properties both the count and the contents come from the cache
+    struct loader_physical_device_property_cache *cache = loader_get_device_extension_cache(phys_dev_term);
+    if (NULL != cache) {
+        uint32_t count = cache->device_extensions.count;
+        if (NULL == pProperties) {
+            *pPropertyCount = count;
+            return VK_SUCCESS;
+        }
+        uint32_t copy_size = *pPropertyCount < count ? *pPropertyCount : count;
+        memcpy(pProperties, cache->device_extensions.list, copy_size * sizeof(VkExtensionProperties));
+        *pPropertyCount = copy_size;
+        return copy_size < count ? VK_INCOMPLETE : VK_SUCCESS;
+    }
+
     // user is querying driver extensions and has supplied their own storage - just fill it out
-    else if (pProperties) {
+    if (pProperties) {
         struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
         uint32_t written_count = *pPropertyCount;
         VkResult res =
-            icd_term->dispatch.EnumerateDeviceExtensionProperties(phys_dev_term->phys_dev, NULL, &written_count, pProperties);
+            ICD_DISPATCH(icd_term, EnumerateDeviceExtensionProperties)(phys_dev_term->phys_dev, NULL, &written_count, pProperties);
         if (res != VK_SUCCESS) {
             return res;
         }
@@ -7013,7 +7850,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumerateDeviceExtensionProperties(VkP
     VkResult res;
 
     // We need to find the count without duplicates. This requires querying the driver for the names of the extensions.
-    res = icd_term->dispatch.EnumerateDeviceExtensionProperties(phys_dev_term->phys_dev, NULL, &all_exts.count, NULL);
+    res = ICD_DISPATCH(icd_term, EnumerateDeviceExtensionProperties)(phys_dev_term->phys_dev, NULL, &all_exts.count, NULL);
     if (res != VK_SUCCESS) {
         goto out;
     }
@@ -7027,7 +7864,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumerateDeviceExtensionProperties(VkP
     }
 
     // Get the available device extensions and put them in all_exts.list
-    res = icd_term->dispatch.EnumerateDeviceExtensionProperties(phys_dev_term->phys_dev, NULL, &all_exts.count, all_exts.list);
+    res = ICD_DISPATCH(icd_term, EnumerateDeviceExtensionProperties)(phys_dev_term->phys_dev, NULL, &all_exts.count, all_exts.list);
     if (res != VK_SUCCESS) {
         goto out;
     }
@@ -7241,6 +8078,7 @@ out:
     loader_destroy_generic_list(NULL, (struct loader_generic_list *)&icd_tramp_list);
     loader_destroy_generic_list(NULL, (struct loader_generic_list *)&local_ext_list);
     loader_delete_layer_list_and_properties(NULL, &instance_layers);
+    free_layer_environment_var_filters(NULL, &layer_filters);
     return res;
 }
 
@@ -7303,6 +8141,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumerateInstanceLayerProperties(uint3
 out:
 
     loader_delete_layer_list_and_properties(NULL, &instance_layer_list);
+    free_layer_environment_var_filters(NULL, &layer_filters);
     return result;
 }
 
@@ -7336,14 +8175,14 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumeratePhysicalDeviceGroups(
 
         // Get the function pointer to use to call into the ICD. This could be the core or KHR version
         if (inst->enabled_known_extensions.khr_device_group_creation) {
-            fpEnumeratePhysicalDeviceGroups = icd_term->dispatch.EnumeratePhysicalDeviceGroupsKHR;
+            fpEnumeratePhysicalDeviceGroups = ICD_DISPATCH(icd_term, EnumeratePhysicalDeviceGroupsKHR);
         } else {
-            fpEnumeratePhysicalDeviceGroups = icd_term->dispatch.EnumeratePhysicalDeviceGroups;
+            fpEnumeratePhysicalDeviceGroups = ICD_DISPATCH(icd_term, EnumeratePhysicalDeviceGroups);
         }
 
         if (NULL == fpEnumeratePhysicalDeviceGroups) {
             // Treat each ICD's GPU as it's own group if the extension isn't supported
-            res = icd_term->dispatch.EnumeratePhysicalDevices(icd_term->instance, &cur_icd_group_count, NULL);
+            res = ICD_DISPATCH(icd_term, EnumeratePhysicalDevices)(icd_term->instance, &cur_icd_group_count, NULL);
             if (res != VK_SUCCESS) {
                 loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
                            "terminator_EnumeratePhysicalDeviceGroups:  Failed during dispatch call of \'EnumeratePhysicalDevices\' "
@@ -7408,13 +8247,13 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumeratePhysicalDeviceGroups(
 
             // Get the function pointer to use to call into the ICD. This could be the core or KHR version
             if (inst->enabled_known_extensions.khr_device_group_creation) {
-                fpEnumeratePhysicalDeviceGroups = icd_term->dispatch.EnumeratePhysicalDeviceGroupsKHR;
+                fpEnumeratePhysicalDeviceGroups = ICD_DISPATCH(icd_term, EnumeratePhysicalDeviceGroupsKHR);
             } else {
-                fpEnumeratePhysicalDeviceGroups = icd_term->dispatch.EnumeratePhysicalDeviceGroups;
+                fpEnumeratePhysicalDeviceGroups = ICD_DISPATCH(icd_term, EnumeratePhysicalDeviceGroups);
             }
 
             if (NULL == fpEnumeratePhysicalDeviceGroups) {
-                icd_term->dispatch.EnumeratePhysicalDevices(icd_term->instance, &count_this_time, NULL);
+                ICD_DISPATCH(icd_term, EnumeratePhysicalDevices)(icd_term->instance, &count_this_time, NULL);
 
                 VkPhysicalDevice *phys_dev_array = loader_stack_alloc(sizeof(VkPhysicalDevice) * count_this_time);
                 if (NULL == phys_dev_array) {
@@ -7426,7 +8265,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_EnumeratePhysicalDeviceGroups(
                     goto out;
                 }
 
-                res = icd_term->dispatch.EnumeratePhysicalDevices(icd_term->instance, &count_this_time, phys_dev_array);
+                res = ICD_DISPATCH(icd_term, EnumeratePhysicalDevices)(icd_term->instance, &count_this_time, phys_dev_array);
                 if (res != VK_SUCCESS) {
                     loader_log(inst, VULKAN_LOADER_ERROR_BIT, 0,
                                "terminator_EnumeratePhysicalDeviceGroups:  Failed during dispatch call of "
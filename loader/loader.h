@@ -84,6 +84,14 @@ extern struct loader_struct loader;
 extern loader_platform_thread_mutex loader_lock;
 extern loader_platform_thread_mutex loader_preload_icd_lock;
 extern loader_platform_thread_mutex loader_global_instance_list_lock;
+extern loader_platform_thread_mutex loader_layer_library_cache_lock;
+extern loader_platform_thread_mutex loader_pre_instance_chain_lock;
+extern bool loader_cache_layer_libraries;
+extern bool loader_lazy_device_dispatch;
+extern bool loader_cache_physical_devices;
+extern bool loader_cache_physical_device_properties;
+extern loader_platform_thread_mutex loader_physical_device_property_cache_lock;
+extern uint32_t loader_physical_device_generation;
 
 bool compare_vk_extension_properties(const VkExtensionProperties *op1, const VkExtensionProperties *op2);
 
@@ -103,10 +111,15 @@ void loader_initialize(void);
 void loader_release(void);
 void loader_preload_icds(void);
 void loader_unload_preloaded_icds(void);
+TEST_FUNCTION_EXPORT void loader_unload_cached_layer_libraries(void);
+void loader_unload_unpinned_layer_libraries(void);
+void loader_clear_pre_instance_chains(void);
 VkResult loader_init_library_list(struct loader_layer_list *instance_layers, loader_platform_dl_handle **libs);
 
 // Allocate a new string able to hold source_str and place it in dest_str
 VkResult loader_copy_to_new_str(const struct loader_instance *inst, const char *source_str, char **dest_str);
+// Same as loader_copy_to_new_str, for strings which are only freed along with the instance
+VkResult loader_copy_to_new_long_lived_str(const struct loader_instance *inst, const char *source_str, char **dest_str);
 
 // Allocate a loader_string_list with enough space for allocated_count strings inside of it
 VkResult create_string_list(const struct loader_instance *inst, uint32_t allocated_count, struct loader_string_list *string_list);
@@ -123,8 +136,30 @@ VkResult copy_str_to_string_list(const struct loader_instance *inst, struct load
 // Free any string inside of loader_string_list and then free the list itself
 void free_string_list(const struct loader_instance *inst, struct loader_string_list *string_list);
 
+// FNV-1a hash of a null terminated string
+uint32_t loader_hash_string(const char *str);
+// Allocate a loader_string_map with enough space for expected_count keys before it needs to grow
+VkResult loader_init_string_map(const struct loader_instance *inst, struct loader_string_map *map, uint32_t expected_count);
+// Add key to the map, growing it if needed. If key is already present its existing value is kept.
+VkResult loader_string_map_insert(const struct loader_instance *inst, struct loader_string_map *map, const char *key, void *value);
+// Returns the value key maps to, or NULL if key isn't in the map
+void *loader_string_map_find(const struct loader_string_map *map, const char *key);
+void loader_destroy_string_map(const struct loader_instance *inst, struct loader_string_map *map);
+
+// Hash of a handle's value, suitable for picking a slot in a power of two sized table
+uint32_t loader_hash_handle(const void *key);
+// Allocate a loader_handle_map with enough space for expected_count keys before it needs to grow
+VkResult loader_init_handle_map(const struct loader_instance *inst, struct loader_handle_map *map, uint32_t expected_count);
+// Add key to the map, growing it if needed. If key is already present its existing value is kept.
+VkResult loader_handle_map_insert(const struct loader_instance *inst, struct loader_handle_map *map, const void *key, void *value);
+// Returns the value key maps to, or NULL if key isn't in the map
+void *loader_handle_map_find(const struct loader_handle_map *map, const void *key);
+void loader_destroy_handle_map(const struct loader_instance *inst, struct loader_handle_map *map);
+
 VkResult loader_init_generic_list(const struct loader_instance *inst, struct loader_generic_list *list_info, size_t element_size);
 VkResult loader_resize_generic_list(const struct loader_instance *inst, struct loader_generic_list *list_info);
+VkResult loader_reserve_generic_list_index(const struct loader_instance *inst, struct loader_generic_list *list_info,
+                                           size_t element_size, uint32_t index);
 VkResult loader_get_next_available_entry(const struct loader_instance *inst, struct loader_used_object_list *list_info,
                                          uint32_t *free_index, const VkAllocationCallbacks *pAllocator);
 void loader_release_object_from_list(struct loader_used_object_list *list_info, uint32_t index_to_free);
@@ -140,6 +175,8 @@ bool loader_find_layer_name_in_list(const char *name, const struct loader_pointe
 VkResult loader_add_layer_properties_to_list(const struct loader_instance *inst, struct loader_pointer_layer_list *list,
                                              struct loader_layer_properties *props);
 void loader_free_layer_properties(const struct loader_instance *inst, struct loader_layer_properties *layer_properties);
+bool loader_layer_is_in_override_layer(const struct loader_instance *inst, const struct loader_envvar_all_filters *filters,
+                                       const char *layer_name);
 bool loader_implicit_layer_is_enabled(const struct loader_instance *inst, const struct loader_envvar_all_filters *filters,
                                       const struct loader_layer_properties *prop);
 VkResult loader_add_meta_layer(const struct loader_instance *inst, const struct loader_envvar_all_filters *filters,
@@ -163,9 +200,23 @@ VkResult loader_init_scanned_icd_list(const struct loader_instance *inst, struct
 void loader_clear_scanned_icd_list(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list);
 VkResult loader_icd_scan(const struct loader_instance *inst, struct loader_icd_tramp_list *icd_tramp_list,
                          const VkInstanceCreateInfo *pCreateInfo, bool *skipped_portability_drivers);
+// Returns callbacks if it holds a complete set of allocation callbacks, NULL otherwise
+const VkAllocationCallbacks *ignore_null_callback(const VkAllocationCallbacks *callbacks);
 void loader_icd_close_objects(struct loader_instance *ptr_inst, struct loader_icd_term *icd_term);
 void loader_icd_destroy(struct loader_instance *ptr_inst, struct loader_icd_term *icd_term,
                         const VkAllocationCallbacks *pAllocator);
+
+// Stored by loader_icd_init_entries in the ICD dispatch table entries which are looked up on first use, never called
+VKAPI_ATTR void VKAPI_CALL loader_icd_unresolved_entry(void);
+// Looks up name from the driver of icd_term and stores it in slot, returns what was stored
+PFN_vkVoidFunction loader_icd_resolve_entry(const struct loader_icd_term *icd_term, PFN_vkVoidFunction *slot, const char *name);
+
+// Reads an entry of the ICD dispatch table, looking it up from the driver the first time. Every read of icd_term->dispatch
+// outside of loader_icd_init_entries must go through this, as entries which weren't looked up yet aren't NULL.
+#define ICD_DISPATCH(icd_term, func)                                                        \
+    ((icd_term)->dispatch.func != (PFN_vk##func)loader_icd_unresolved_entry                 \
+         ? (icd_term)->dispatch.func                                                        \
+         : (PFN_vk##func)loader_icd_resolve_entry((icd_term), (PFN_vkVoidFunction *)&(icd_term)->dispatch.func, "vk" #func))
 VkResult loader_scan_for_layers(struct loader_instance *inst, struct loader_layer_list *instance_layers,
                                 const struct loader_envvar_all_filters *layer_filters);
 VkResult loader_scan_for_implicit_layers(struct loader_instance *inst, struct loader_layer_list *instance_layers,
@@ -175,6 +226,11 @@ VkResult loader_get_icd_loader_instance_extensions(const struct loader_instance
 struct loader_icd_term *loader_get_icd_and_device(const void *device, struct loader_device **found_dev);
 struct loader_instance *loader_get_instance(const VkInstance instance);
 loader_platform_dl_handle loader_open_layer_file(const struct loader_instance *inst, struct loader_layer_properties *prop);
+loader_platform_dl_handle loader_open_cached_layer_file(const struct loader_instance *inst, struct loader_layer_properties *prop);
+void loader_close_layer_file(const struct loader_instance *inst, struct loader_layer_properties *prop);
+bool loader_release_cached_layer_library(loader_platform_dl_handle lib_handle);
+void loader_cache_layer_library_functions(const struct loader_layer_properties *prop);
+uint32_t loader_add_avoided_layer_library_opens(uint32_t count);
 struct loader_device *loader_create_logical_device(const struct loader_instance *inst, const VkAllocationCallbacks *pAllocator);
 void loader_add_logical_device(struct loader_icd_term *icd_term, struct loader_device *found_dev);
 void loader_remove_logical_device(struct loader_icd_term *icd_term, struct loader_device *found_dev,
@@ -204,10 +260,22 @@ VkResult loader_create_device_chain(const VkPhysicalDevice pd, const VkDeviceCre
                                     struct loader_device *dev, PFN_vkGetInstanceProcAddr callingLayer,
                                     PFN_vkGetDeviceProcAddr *layerNextGDPA);
 
+// Resolves a device command for the lazy device dispatch stubs, storing the result in slot
+PFN_vkVoidFunction loader_resolve_lazy_device_command(VkLayerDispatchTable *table, const char *name, PFN_vkVoidFunction *slot);
+
 VkResult loader_validate_device_extensions(struct loader_instance *this_instance,
                                            const struct loader_pointer_layer_list *activated_device_layers,
                                            const struct loader_extension_list *icd_exts, const VkDeviceCreateInfo *pCreateInfo);
 
+// Invalidates the physical devices cached by every instance if there is any sign that physical devices were added or removed
+void loader_check_for_physical_device_changes(void);
+// Returns the property cache of phys_dev_term, allocating it if needed, or NULL when properties aren't cached.
+// Must be called with loader_physical_device_property_cache_lock held.
+struct loader_physical_device_property_cache *loader_get_physical_device_property_cache(
+    struct loader_physical_device_term *phys_dev_term);
+// Returns the property cache of phys_dev_term once its device extensions are filled in, or NULL when they can't be cached
+struct loader_physical_device_property_cache *loader_get_device_extension_cache(struct loader_physical_device_term *phys_dev_term);
+void loader_free_physical_device_term(const struct loader_instance *inst, struct loader_physical_device_term *phys_dev_term);
 VkResult setup_loader_tramp_phys_devs(struct loader_instance *inst, uint32_t phys_dev_count, VkPhysicalDevice *phys_devs);
 VkResult setup_loader_tramp_phys_dev_groups(struct loader_instance *inst, uint32_t group_count,
                                             VkPhysicalDeviceGroupProperties *groups);
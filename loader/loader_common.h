@@ -73,6 +73,31 @@ struct loader_string_list {
     char **list;
 };
 
+// Open addressed hash table which maps strings to pointers. Keys are not copied, so they must outlive the map.
+struct loader_string_map_entry {
+    const char *key;
+    uint32_t hash;
+    void *value;
+};
+
+struct loader_string_map {
+    uint32_t capacity;  // zero or a power of two
+    uint32_t count;
+    struct loader_string_map_entry *entries;
+};
+
+// Open addressed hash table which maps handles (or any other non-NULL pointer) to pointers
+struct loader_handle_map_entry {
+    const void *key;
+    void *value;
+};
+
+struct loader_handle_map {
+    uint32_t capacity;  // zero or a power of two
+    uint32_t count;
+    struct loader_handle_map_entry *entries;
+};
+
 struct loader_extension_list {
     size_t capacity;
     uint32_t count;
@@ -92,13 +117,17 @@ struct loader_device_extension_list {
 
 struct loader_used_object_status {
     VkBool32 status;
+    uint32_t next_free;  // One past the index of the next released entry, 0 ends the free list
     VkAllocationCallbacks allocation_callbacks;
 };
 
+// The first three members must match loader_generic_list
 struct loader_used_object_list {
     size_t capacity;
     uint32_t padding;  // count variable isn't used
     struct loader_used_object_status *list;
+    uint32_t free_head;   // One past the index of the most recently released entry, 0 when none are released
+    uint32_t high_water;  // Entries at or above this index have never been handed out
 };
 
 struct loader_surface_allocation {
@@ -260,6 +289,13 @@ struct loader_device {
     // Makes vkGetDeviceProcAddr check if core functions are supported by the current app_api_version.
     // Only set to true if VK_KHR_maintenance5 is enabled.
     bool should_ignore_device_commands_from_newer_version;
+
+    // apiVersion of the physical device, the core commands of newer versions than this and the app_api_version aren't queried
+    // when filling in the dispatch table
+    uint32_t physical_device_api_version;
+
+    // Number of the instance's unknown device function names (dev_ext_disp_functions) that have been looked up for ext_dispatch
+    uint32_t dev_ext_generation;
 };
 
 // Per ICD information
@@ -272,6 +308,8 @@ struct loader_icd_term {
     struct loader_device *logical_device_list;
     VkInstance instance;  // instance object from the icd
     struct loader_icd_term_dispatch dispatch;
+    // Number of entries in dispatch which loader_icd_init_entries left to be looked up on first use
+    uint32_t lazy_dispatch_entry_count;
 
     struct loader_icd_term *next;
 
@@ -284,6 +322,10 @@ struct loader_icd_term {
     struct loader_surface_list surface_list;
     struct loader_debug_utils_messenger_list debug_utils_messenger_list;
     struct loader_debug_report_callback_list debug_report_callback_list;
+
+    // Debug messengers and report callbacks are only created in the ICD once it is in use (has a logical device or was sent a
+    // debug report message), see util_ActivateDriverDebugCallbacks
+    bool debug_callbacks_active;
 };
 
 // Per ICD library structure
@@ -323,6 +365,11 @@ struct loader_instance {
     uint32_t phys_dev_count_tramp;
     struct loader_physical_device_tramp **phys_devs_tramp;
 
+    // With VK_LOADER_CACHE_PHYSICAL_DEVICES, phys_devs_term is reused without querying the drivers again as long as it is valid
+    // and was filled in while loader_physical_device_generation had the value phys_devs_term_generation.
+    bool phys_devs_term_cache_valid;
+    uint32_t phys_devs_term_generation;
+
     // We also need to manually track physical device groups, but we don't need
     // loader specific structures since we have that content in the physical
     // device stored internal to the public structures.
@@ -367,12 +414,29 @@ struct loader_instance {
     struct loader_used_object_list debug_utils_messengers_list;
     struct loader_used_object_list debug_report_callbacks_list;
 
+    // Guards surfaces_list and the per driver surface lists, which wsi_unwrap_icd_surface fills in the first time a driver is asked
+    // about a surface
+    loader_platform_thread_mutex surfaces_lock;
+
+    // Guards the debug callbacks below, debug_utils_messengers_list, debug_report_callbacks_list and the per driver debug objects.
+    // Callbacks are made while holding it, and the create and destroy paths may log messages, so it is recursive.
+    loader_platform_thread_mutex debug_callbacks_lock;
+
     // Stores debug callbacks - used in the log.
     VkLayerDbgFunctionNode *current_dbg_function_head;        // Current head
     VkLayerDbgFunctionNode *instance_only_dbg_function_head;  // Only used for instance create/destroy
 
+    // Union of the masks of every debug function in current_dbg_function_head, kept up to date by util_UpdateDebugCallbackMasks.
+    // Lets messages which no callback would receive be discarded without walking the list.
+    VkDebugUtilsMessageSeverityFlagsEXT dbg_messenger_severities;
+    VkDebugUtilsMessageTypeFlagsEXT dbg_messenger_types;
+    VkDebugReportFlagsEXT dbg_report_flags;
+
     VkAllocationCallbacks alloc_callbacks;
 
+    // Instance scoped allocations made during vkCreateInstance come from here and are released in one go by vkDestroyInstance
+    struct loader_instance_arena *arena;
+
     // Set to true after vkCreateInstance has returned - necessary for loader_gpa_instance_terminator()
     bool instance_finished_creation;
 
@@ -456,13 +520,6 @@ struct loader_physical_device_tramp {
     VkPhysicalDevice phys_dev;  // object from layers/loader terminator
 };
 
-// Per enumerated PhysicalDevice structure, used to wrap in terminator code
-struct loader_physical_device_term {
-    struct loader_instance_dispatch_table *disp;  // must be first entry in structure
-    struct loader_icd_term *this_icd_term;
-    VkPhysicalDevice phys_dev;  // object from ICD
-};
-
 #if defined(LOADER_ENABLE_LINUX_SORT)
 // Structure for storing the relevant device information for selecting a device.
 // NOTE: Needs to be defined here so we can store this content in the term structure
@@ -487,8 +544,52 @@ struct LinuxSortedDeviceInfo {
     uint32_t pci_bus;
     uint32_t pci_device;
     uint32_t pci_function;
+
+    // Everything above packed into a key which sorts the same way, sort_key[0] being the more significant half
+    uint64_t sort_key[2];
+};
+#endif  // LOADER_ENABLE_LINUX_SORT
+
+// Only the formats of Vulkan 1.0, which are numbered contiguously from zero, have their properties cached
+#define LOADER_CACHED_FORMAT_COUNT (VK_FORMAT_ASTC_12x12_SRGB_BLOCK + 1)
+
+// Properties of a physical device which never change, each filled in the first time it is queried.
+// The driver is queried without loader_physical_device_property_cache_lock held, the result is then published with it held.
+struct loader_physical_device_property_cache {
+    bool has_properties;
+    VkPhysicalDeviceProperties properties;
+
+    bool has_memory_properties;
+    VkPhysicalDeviceMemoryProperties memory_properties;
+
+    bool has_queue_family_properties;
+    uint32_t queue_family_property_count;
+    VkQueueFamilyProperties *queue_family_properties;
+
+    bool has_format_properties[LOADER_CACHED_FORMAT_COUNT];
+    VkFormatProperties format_properties[LOADER_CACHED_FORMAT_COUNT];
+
+    // The driver's device extensions followed by those only provided by active implicit layers, which is what
+    // vkEnumerateDeviceExtensionProperties reports. device_extension_map maps their names to their entries in device_extensions.
+    bool has_device_extensions;
+    uint32_t driver_device_extension_count;
+    struct loader_extension_list device_extensions;
+    struct loader_string_map device_extension_map;
 };
+
+// Per enumerated PhysicalDevice structure, used to wrap in terminator code
+struct loader_physical_device_term {
+    struct loader_instance_dispatch_table *disp;  // must be first entry in structure
+    struct loader_icd_term *this_icd_term;
+    VkPhysicalDevice phys_dev;  // object from ICD
+#if defined(LOADER_ENABLE_LINUX_SORT)
+    // Properties used for sorting, read from the driver the first time this physical device was sorted
+    bool has_sort_info;
+    struct LinuxSortedDeviceInfo sort_info;
 #endif  // LOADER_ENABLE_LINUX_SORT
+    // Allocated on first use when VK_LOADER_CACHE_PHYSICAL_DEVICE_PROPERTIES is set
+    struct loader_physical_device_property_cache *property_cache;
+};
 
 // Per enumerated PhysicalDeviceGroup structure, used to wrap in terminator code
 struct loader_physical_device_group_term {
@@ -553,9 +654,12 @@ struct loader_envvar_filter_value {
 };
 
 #define MAX_ADDITIONAL_FILTERS 16
+struct loader_envvar_filter_matcher;
 struct loader_envvar_filter {
     uint32_t count;
     struct loader_envvar_filter_value filters[MAX_ADDITIONAL_FILTERS];
+    // Compiled form of filters which checks a name against all of them at once, NULL if the filters weren't compiled
+    const struct loader_envvar_filter_matcher *matcher;
 };
 struct loader_envvar_disable_layers_filter {
     struct loader_envvar_filter additional_filters;
@@ -564,8 +668,25 @@ struct loader_envvar_disable_layers_filter {
     bool disable_all_explicit;
 };
 
+// Captures the environment once so every implicit layer's enable and disable environment variables can be looked up
+// without walking the whole environment each time. Filled in on the first lookup and lives as long as the filters.
+struct loader_environment_snapshot {
+    bool populated;
+    bool owns_entries;       // Whether the keys in variables are individual allocations which need to be freed
+    char *environment_copy;  // Copy of the environment strings which the keys & values of variables point into
+    struct loader_string_map variables;
+
+    // The override layer found in the instance layer list, which is only searched for again after the list is rebuilt and
+    // loader_invalidate_override_layer_cache() cleared override_layer_cached
+    bool override_layer_cached;
+    const struct loader_layer_properties *override_layer;
+    struct loader_string_map override_component_layers;
+};
+
 struct loader_envvar_all_filters {
     struct loader_envvar_filter enable_filter;
     struct loader_envvar_disable_layers_filter disable_filter;
     struct loader_envvar_filter allow_filter;
+    // Freed by free_layer_environment_var_filters()
+    struct loader_environment_snapshot *environment_snapshot;
 };
@@ -36,6 +36,16 @@
 #include <ctype.h>
 #include "param/sys_param.h"
 
+#if COMMON_UNIX_PLATFORMS && !defined(__OHOS__)
+#if defined(__APPLE__)
+#include <crt_externs.h>
+#define LOADER_PLATFORM_ENVIRON (*_NSGetEnviron())
+#else
+extern char **environ;
+#define LOADER_PLATFORM_ENVIRON environ
+#endif
+#endif
+
 // Environment variables
 #if COMMON_UNIX_PLATFORMS
 
@@ -193,6 +203,151 @@ void loader_free_getenv(char *val, const struct loader_instance *inst) {
 
 #endif
 
+#if defined(LOADER_PLATFORM_ENVIRON)
+
+// Copy every "NAME=value" string out of the environment in a single pass and index them by name. If a name is present more
+// than once the first one is used, which is what getenv() does.
+VkResult loader_populate_environment_snapshot(const struct loader_instance *inst, struct loader_environment_snapshot *snapshot) {
+    char **environment = LOADER_PLATFORM_ENVIRON;
+    size_t total_size = 0;
+    uint32_t variable_count = 0;
+    for (uint32_t i = 0; NULL != environment && NULL != environment[i]; i++) {
+        total_size += strlen(environment[i]) + 1;
+        variable_count++;
+    }
+    if (0 == variable_count) {
+        return VK_SUCCESS;
+    }
+
+    snapshot->environment_copy = loader_instance_heap_alloc(inst, total_size, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == snapshot->environment_copy) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    VkResult res = loader_init_string_map(inst, &snapshot->variables, variable_count);
+    if (VK_SUCCESS != res) {
+        return res;
+    }
+
+    char *write_pos = snapshot->environment_copy;
+    for (uint32_t i = 0; i < variable_count && NULL != environment[i]; i++) {
+        size_t size = strlen(environment[i]) + 1;
+        if (size > total_size - (size_t)(write_pos - snapshot->environment_copy)) {
+            break;
+        }
+        memcpy(write_pos, environment[i], size);
+        char *separator = strchr(write_pos, '=');
+        if (NULL != separator) {
+            *separator = '\0';
+            res = loader_string_map_insert(inst, &snapshot->variables, write_pos, separator + 1);
+            if (VK_SUCCESS != res) {
+                return res;
+            }
+        }
+        write_pos += size;
+    }
+    return VK_SUCCESS;
+}
+
+#else
+
+// Value stored in an environment snapshot for a variable which was looked up but isn't set
+const char loader_environment_snapshot_unset_value[] = "";
+
+// The environment can't be walked directly, so remember each variable the first time it is looked up instead
+VkResult loader_add_to_environment_snapshot(const struct loader_instance *inst, struct loader_environment_snapshot *snapshot,
+                                            const char *name, const char **out_value) {
+    char *env_value = loader_getenv(name, inst);
+    size_t name_size = strlen(name) + 1;
+    size_t value_size = NULL == env_value ? 0 : strlen(env_value) + 1;
+
+    // The name and value share one allocation, which is freed through the key
+    char *entry = loader_instance_heap_alloc(inst, name_size + value_size, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == entry) {
+        loader_free_getenv(env_value, inst);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    memcpy(entry, name, name_size);
+    const char *value = loader_environment_snapshot_unset_value;
+    if (NULL != env_value) {
+        memcpy(entry + name_size, env_value, value_size);
+        value = entry + name_size;
+    }
+    loader_free_getenv(env_value, inst);
+
+    VkResult res = loader_string_map_insert(inst, &snapshot->variables, entry, (void *)value);
+    if (VK_SUCCESS != res) {
+        loader_instance_heap_free(inst, entry);
+        return res;
+    }
+    snapshot->owns_entries = true;
+    *out_value = value;
+    return VK_SUCCESS;
+}
+
+#endif
+
+void loader_clear_environment_snapshot(const struct loader_instance *inst, struct loader_environment_snapshot *snapshot) {
+    if (snapshot->owns_entries) {
+        for (uint32_t i = 0; i < snapshot->variables.capacity; i++) {
+            loader_instance_heap_free(inst, (void *)snapshot->variables.entries[i].key);
+        }
+    }
+    loader_destroy_string_map(inst, &snapshot->variables);
+    loader_instance_heap_free(inst, snapshot->environment_copy);
+    loader_destroy_string_map(inst, &snapshot->override_component_layers);
+    memset(snapshot, 0, sizeof(struct loader_environment_snapshot));
+}
+
+void loader_invalidate_override_layer_cache(const struct loader_instance *inst, const struct loader_envvar_all_filters *filters) {
+    struct loader_environment_snapshot *snapshot = filters->environment_snapshot;
+    if (NULL == snapshot) {
+        return;
+    }
+    loader_destroy_string_map(inst, &snapshot->override_component_layers);
+    snapshot->override_layer = NULL;
+    snapshot->override_layer_cached = false;
+}
+
+// Look up name in the environment snapshot of filters, setting value to NULL if the variable isn't set.
+// Returns false if there is no usable snapshot, in which case the environment has to be queried directly.
+bool loader_environment_snapshot_getenv(const struct loader_instance *inst, const struct loader_envvar_all_filters *filters,
+                                        const char *name, const char **value) {
+    struct loader_environment_snapshot *snapshot = filters->environment_snapshot;
+    if (NULL == snapshot) {
+        return false;
+    }
+#if defined(LOADER_PLATFORM_ENVIRON)
+    if (!snapshot->populated) {
+        if (VK_SUCCESS != loader_populate_environment_snapshot(inst, snapshot)) {
+            loader_clear_environment_snapshot(inst, snapshot);
+            return false;
+        }
+        snapshot->populated = true;
+    }
+    *value = loader_string_map_find(&snapshot->variables, name);
+#else
+    const char *found = loader_string_map_find(&snapshot->variables, name);
+    if (NULL == found && VK_SUCCESS != loader_add_to_environment_snapshot(inst, snapshot, name, &found)) {
+        return false;
+    }
+    *value = found == loader_environment_snapshot_unset_value ? NULL : found;
+#endif
+    return true;
+}
+
+bool check_layer_environment_var(const struct loader_instance *inst, const struct loader_envvar_all_filters *filters,
+                                 const char *name, const char *value) {
+    const char *env_value = NULL;
+    if (loader_environment_snapshot_getenv(inst, filters, name, &env_value)) {
+        return NULL != env_value && (NULL == value || 0 == strcmp(value, env_value));
+    }
+
+    char *direct_env_value = loader_getenv(name, inst);
+    bool matches = NULL != direct_env_value && (NULL == value || 0 == strcmp(value, direct_env_value));
+    loader_free_getenv(direct_env_value, inst);
+    return matches;
+}
+
 // Determine the type of filter string based on the contents of it.
 // This will properly check against:
 //  - substrings "*string*"
@@ -251,6 +406,236 @@ void determine_filter_type(const char *filter_string, enum loader_filter_string_
     }
 }
 
+// Filters are compiled into an Aho-Corasick automaton of their lowercased strings, so that a name can be checked against every
+// filter in a single pass over it. Compiled filters are kept for each environment variable value they were parsed from and are
+// only freed when the loader is unloaded, which bounds how many are kept.
+#define MAX_COMPILED_ENVVAR_FILTERS 64
+
+struct loader_envvar_filter_matcher_edge {
+    uint16_t target;
+    uint16_t next_sibling;  // zero if this is the last edge out of the node
+    char character;
+};
+
+struct loader_envvar_filter_matcher_node {
+    uint16_t first_edge;  // zero if there are no edges out of the node
+    uint16_t fail;
+    uint32_t outputs;  // bitmask of the filters whose strings end at this node or at any node along its fail links
+};
+
+struct loader_envvar_filter_matcher {
+    struct loader_envvar_filter_matcher_node *nodes;
+    struct loader_envvar_filter_matcher_edge *edges;
+    // Names at least this long match one of the special filters which match everything, SIZE_MAX if there are none
+    size_t match_all_min_length;
+};
+
+struct loader_compiled_envvar_filter {
+    char *env_var_value;
+    bool is_disable_filter;
+    struct loader_envvar_disable_layers_filter filter;
+};
+
+loader_platform_thread_mutex loader_envvar_filter_cache_lock;
+struct loader_compiled_envvar_filter compiled_envvar_filters[MAX_COMPILED_ENVVAR_FILTERS];
+uint32_t compiled_envvar_filter_count;
+
+uint16_t loader_envvar_filter_matcher_find_edge(const struct loader_envvar_filter_matcher *matcher, uint16_t node, char character) {
+    for (uint16_t edge = matcher->nodes[node].first_edge; edge != 0; edge = matcher->edges[edge].next_sibling) {
+        if (matcher->edges[edge].character == character) {
+            return matcher->edges[edge].target;
+        }
+    }
+    return 0;
+}
+
+// Returns NULL if out of memory
+struct loader_envvar_filter_matcher *loader_compile_envvar_filter(const struct loader_envvar_filter *filter_struct) {
+    // Filters at least VK_MAX_EXTENSION_NAME_SIZE long were truncated when parsed and are not added to the automaton
+    size_t max_node_count = 1;
+    for (uint32_t filt = 0; filt < filter_struct->count; ++filt) {
+        if (filter_struct->filters[filt].type != FILTER_STRING_SPECIAL &&
+            filter_struct->filters[filt].length < VK_MAX_EXTENSION_NAME_SIZE) {
+            max_node_count += filter_struct->filters[filt].length;
+        }
+    }
+    struct loader_envvar_filter_matcher *matcher =
+        loader_calloc(NULL,
+                      sizeof(struct loader_envvar_filter_matcher) +
+                          max_node_count * (sizeof(struct loader_envvar_filter_matcher_node) +
+                                            sizeof(struct loader_envvar_filter_matcher_edge)),
+                      VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    uint16_t *queue = loader_calloc(NULL, max_node_count * sizeof(uint16_t), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+    if (NULL == matcher || NULL == queue) {
+        loader_free(NULL, matcher);
+        loader_free(NULL, queue);
+        return NULL;
+    }
+    matcher->nodes = (struct loader_envvar_filter_matcher_node *)(matcher + 1);
+    matcher->edges = (struct loader_envvar_filter_matcher_edge *)(matcher->nodes + max_node_count);
+    matcher->match_all_min_length = SIZE_MAX;
+
+    // Build the trie of all the filter strings. Node 0 is the root and edge 0 is unused so that zero can mean 'none'
+    uint16_t node_count = 1;
+    uint16_t edge_count = 1;
+    for (uint32_t filt = 0; filt < filter_struct->count; ++filt) {
+        const struct loader_envvar_filter_value *filter = &filter_struct->filters[filt];
+        if (filter->type == FILTER_STRING_SPECIAL) {
+            if ((!strcmp(VK_LOADER_DISABLE_ALL_LAYERS_VAR_1, filter->value) ||
+                 !strcmp(VK_LOADER_DISABLE_ALL_LAYERS_VAR_2, filter->value) ||
+                 !strcmp(VK_LOADER_DISABLE_ALL_LAYERS_VAR_3, filter->value)) &&
+                filter->length < matcher->match_all_min_length) {
+                matcher->match_all_min_length = filter->length;
+            }
+            continue;
+        }
+        if (filter->length == 0) {
+            // A lone '*' is parsed as an empty prefix, and an empty prefix, suffix, or substring matches every name
+            if (filter->type != FILTER_STRING_FULLNAME) {
+                matcher->match_all_min_length = 0;
+            }
+            continue;
+        }
+        if (filter->length >= VK_MAX_EXTENSION_NAME_SIZE) {
+            continue;
+        }
+        uint16_t node = 0;
+        for (size_t i = 0; i < filter->length; ++i) {
+            uint16_t next = loader_envvar_filter_matcher_find_edge(matcher, node, filter->value[i]);
+            if (0 == next) {
+                matcher->edges[edge_count].target = node_count;
+                matcher->edges[edge_count].next_sibling = matcher->nodes[node].first_edge;
+                matcher->edges[edge_count].character = filter->value[i];
+                matcher->nodes[node].first_edge = edge_count++;
+                next = node_count++;
+            }
+            node = next;
+        }
+        matcher->nodes[node].outputs |= 1U << filt;
+    }
+
+    // Breadth first traversal to link each node to the node of its longest proper suffix which is also in the trie
+    uint32_t queue_start = 0;
+    uint32_t queue_end = 0;
+    for (uint16_t edge = matcher->nodes[0].first_edge; edge != 0; edge = matcher->edges[edge].next_sibling) {
+        queue[queue_end++] = matcher->edges[edge].target;
+    }
+    while (queue_start < queue_end) {
+        uint16_t node = queue[queue_start++];
+        for (uint16_t edge = matcher->nodes[node].first_edge; edge != 0; edge = matcher->edges[edge].next_sibling) {
+            uint16_t child = matcher->edges[edge].target;
+            uint16_t fail = matcher->nodes[node].fail;
+            while (fail != 0 && 0 == loader_envvar_filter_matcher_find_edge(matcher, fail, matcher->edges[edge].character)) {
+                fail = matcher->nodes[fail].fail;
+            }
+            matcher->nodes[child].fail = loader_envvar_filter_matcher_find_edge(matcher, fail, matcher->edges[edge].character);
+            matcher->nodes[child].outputs |= matcher->nodes[matcher->nodes[child].fail].outputs;
+            queue[queue_end++] = child;
+        }
+    }
+    loader_free(NULL, queue);
+    return matcher;
+}
+
+bool loader_envvar_filter_matcher_matches(const struct loader_envvar_filter *filter_struct, const char *name) {
+    const struct loader_envvar_filter_matcher *matcher = filter_struct->matcher;
+    const size_t name_len = strlen(name);
+    if (name_len >= matcher->match_all_min_length) {
+        return true;
+    }
+    uint16_t node = 0;
+    for (size_t i = 0; i < name_len; ++i) {
+        char character = (char)tolower(name[i]);
+        uint16_t next = loader_envvar_filter_matcher_find_edge(matcher, node, character);
+        while (0 == next && node != 0) {
+            node = matcher->nodes[node].fail;
+            next = loader_envvar_filter_matcher_find_edge(matcher, node, character);
+        }
+        node = next;
+
+        // Every filter string ending at position i - check whether the filter allows it to be found at this position
+        uint32_t outputs = matcher->nodes[node].outputs;
+        for (uint32_t filt = 0; outputs != 0; ++filt, outputs >>= 1) {
+            if (0 == (outputs & 1)) {
+                continue;
+            }
+            bool at_start = i + 1 == filter_struct->filters[filt].length;
+            bool at_end = i + 1 == name_len;
+            switch (filter_struct->filters[filt].type) {
+                case FILTER_STRING_SUBSTRING:
+                    return true;
+                case FILTER_STRING_PREFIX:
+                    if (at_start) return true;
+                    break;
+                case FILTER_STRING_SUFFIX:
+                    if (at_end) return true;
+                    break;
+                case FILTER_STRING_FULLNAME:
+                    if (at_start && at_end) return true;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+    return false;
+}
+
+// Look for filters which were already parsed & compiled from the same environment variable value. disable_struct is NULL for
+// generic filters, and filter_struct must point to disable_struct->additional_filters for disable filters.
+bool loader_find_compiled_envvar_filter(const char *env_var_value, struct loader_envvar_disable_layers_filter *disable_struct,
+                                        struct loader_envvar_filter *filter_struct) {
+    bool found = false;
+    loader_platform_thread_lock_mutex(&loader_envvar_filter_cache_lock);
+    for (uint32_t i = 0; i < compiled_envvar_filter_count; ++i) {
+        if (compiled_envvar_filters[i].is_disable_filter == (NULL != disable_struct) &&
+            0 == strcmp(compiled_envvar_filters[i].env_var_value, env_var_value)) {
+            if (NULL != disable_struct) {
+                *disable_struct = compiled_envvar_filters[i].filter;
+            } else {
+                *filter_struct = compiled_envvar_filters[i].filter.additional_filters;
+            }
+            found = true;
+            break;
+        }
+    }
+    loader_platform_thread_unlock_mutex(&loader_envvar_filter_cache_lock);
+    return found;
+}
+
+// Compile the just parsed filter_struct & remember it for later parses of the same environment variable value. Leaves
+// filter_struct->matcher as NULL if there is no room left or no memory, in which case each filter is checked one by one.
+void loader_add_compiled_envvar_filter(const char *env_var_value, struct loader_envvar_disable_layers_filter *disable_struct,
+                                       struct loader_envvar_filter *filter_struct) {
+    loader_platform_thread_lock_mutex(&loader_envvar_filter_cache_lock);
+    if (compiled_envvar_filter_count < MAX_COMPILED_ENVVAR_FILTERS) {
+        struct loader_compiled_envvar_filter *compiled = &compiled_envvar_filters[compiled_envvar_filter_count];
+        struct loader_envvar_filter_matcher *matcher = loader_compile_envvar_filter(filter_struct);
+        if (NULL != matcher && VK_SUCCESS == loader_copy_to_new_str(NULL, env_var_value, &compiled->env_var_value)) {
+            filter_struct->matcher = matcher;
+            compiled->is_disable_filter = NULL != disable_struct;
+            if (NULL != disable_struct) {
+                compiled->filter = *disable_struct;
+            } else {
+                compiled->filter.additional_filters = *filter_struct;
+            }
+            compiled_envvar_filter_count++;
+        } else {
+            loader_free(NULL, matcher);
+        }
+    }
+    loader_platform_thread_unlock_mutex(&loader_envvar_filter_cache_lock);
+}
+
+void loader_clear_compiled_envvar_filters(void) {
+    for (uint32_t i = 0; i < compiled_envvar_filter_count; ++i) {
+        loader_free(NULL, compiled_envvar_filters[i].env_var_value);
+        loader_free(NULL, (void *)compiled_envvar_filters[i].filter.additional_filters.matcher);
+    }
+    memset(compiled_envvar_filters, 0, sizeof(compiled_envvar_filters));
+    compiled_envvar_filter_count = 0;
+}
+
 // Parse the provided filter string provided by the envrionment variable into the appropriate filter
 // struct variable.
 VkResult parse_generic_filter_environment_var(const struct loader_instance *inst, const char *env_var_name,
@@ -266,6 +651,9 @@ VkResult parse_generic_filter_environment_var(const struct loader_instance *inst
     if (env_var_len == 0) {
         goto out;
     }
+    if (loader_find_compiled_envvar_filter(env_var_value, NULL, filter_struct)) {
+        goto out;
+    }
     // Allocate a separate string since scan_for_next_comma modifies the original string
     parsing_string = loader_instance_heap_calloc(inst, env_var_len + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
     if (NULL == parsing_string) {
@@ -301,6 +689,7 @@ VkResult parse_generic_filter_environment_var(const struct loader_instance *inst
         }
         token = thread_safe_strtok(NULL, ",", &context);
     }
+    loader_add_compiled_envvar_filter(env_var_value, NULL, filter_struct);
 
 out:
 
@@ -325,6 +714,9 @@ VkResult parse_layers_disable_filter_environment_var(const struct loader_instanc
     if (env_var_len == 0) {
         goto out;
     }
+    if (loader_find_compiled_envvar_filter(env_var_value, disable_struct, &disable_struct->additional_filters)) {
+        goto out;
+    }
     // Allocate a separate string since scan_for_next_comma modifies the original string
     parsing_string = loader_instance_heap_calloc(inst, env_var_len + 1, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
     if (NULL == parsing_string) {
@@ -374,6 +766,7 @@ VkResult parse_layers_disable_filter_environment_var(const struct loader_instanc
         }
         token = thread_safe_strtok(NULL, ",", &context);
     }
+    loader_add_compiled_envvar_filter(env_var_value, disable_struct, &disable_struct->additional_filters);
 out:
     loader_instance_heap_free(inst, parsing_string);
     loader_free_getenv(env_var_value, inst);
@@ -394,9 +787,20 @@ VkResult parse_layer_environment_var_filters(const struct loader_instance *inst,
     if (VK_SUCCESS != res) {
         return res;
     }
+    // Without a snapshot the environment is queried directly, so failing to allocate one isn't an error
+    layer_filters->environment_snapshot =
+        loader_instance_heap_calloc(inst, sizeof(struct loader_environment_snapshot), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
     return res;
 }
 
+void free_layer_environment_var_filters(const struct loader_instance *inst, struct loader_envvar_all_filters *layer_filters) {
+    if (NULL != layer_filters->environment_snapshot) {
+        loader_clear_environment_snapshot(inst, layer_filters->environment_snapshot);
+        loader_instance_heap_free(inst, layer_filters->environment_snapshot);
+        layer_filters->environment_snapshot = NULL;
+    }
+}
+
 // Check to see if the provided layer name matches any of the filter strings.
 // This will properly check against:
 //  - substrings "*string*"
@@ -404,6 +808,9 @@ VkResult parse_layer_environment_var_filters(const struct loader_instance *inst,
 //  - suffixes "*string"
 //  - full string names "string"
 bool check_name_matches_filter_environment_var(const char *name, const struct loader_envvar_filter *filter_struct) {
+    if (NULL != filter_struct->matcher) {
+        return loader_envvar_filter_matcher_matches(filter_struct, name);
+    }
     bool ret_value = false;
     const size_t name_len = strlen(name);
     char lower_name[VK_MAX_EXTENSION_NAME_SIZE];
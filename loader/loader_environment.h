@@ -43,11 +43,23 @@ char *loader_secure_getenv(const char *name, const struct loader_instance *inst)
 
 #endif
 
+// Guards the filters compiled from environment variable values, which are freed by loader_clear_compiled_envvar_filters()
+extern loader_platform_thread_mutex loader_envvar_filter_cache_lock;
+void loader_clear_compiled_envvar_filters(void);
+
 VkResult parse_generic_filter_environment_var(const struct loader_instance *inst, const char *env_var_name,
                                               struct loader_envvar_filter *filter_struct);
 VkResult parse_layers_disable_filter_environment_var(const struct loader_instance *inst,
                                                      struct loader_envvar_disable_layers_filter *disable_struct);
+// Caller is responsible for cleaning up by calling free_layer_environment_var_filters()
 VkResult parse_layer_environment_var_filters(const struct loader_instance *inst, struct loader_envvar_all_filters *layer_filters);
+void free_layer_environment_var_filters(const struct loader_instance *inst, struct loader_envvar_all_filters *layer_filters);
+// Must be called whenever the instance layer list is rebuilt, as the override layer cached in the snapshot points into it
+void loader_invalidate_override_layer_cache(const struct loader_instance *inst, const struct loader_envvar_all_filters *filters);
+// Returns true if the environment variable name is set, and if value isn't NULL, that it is set to value.
+// Uses the environment snapshot held by filters so that checking many layers only walks the environment once.
+bool check_layer_environment_var(const struct loader_instance *inst, const struct loader_envvar_all_filters *filters,
+                                 const char *name, const char *value);
 bool check_name_matches_filter_environment_var(const char *name, const struct loader_envvar_filter *filter_struct);
 VkResult loader_add_environment_layers(struct loader_instance *inst, const enum layer_type_flags type_flags,
                                        const struct loader_envvar_all_filters *filters,
@@ -54,154 +54,107 @@ uint32_t determine_priority_type_value(VkPhysicalDeviceType type) {
     return 0;
 }
 
-// Compare the two device types.
-// This behaves similar to a qsort compare.
-int32_t device_type_compare(VkPhysicalDeviceType a, VkPhysicalDeviceType b) {
-    uint32_t a_value = determine_priority_type_value(a);
-    uint32_t b_value = determine_priority_type_value(b);
-    if (a_value > b_value) {
-        return -1;
-    } else if (b_value > a_value) {
-        return 1;
-    }
-    return 0;
-}
-
-// Used to compare two devices and determine which one should have priority.  The criteria is
-// simple:
+// Pack everything compare_devices looks at into device_info->sort_key, so that comparing keys as unsigned integers gives the
+// order below. PCI bus, device and function numbers are clamped to 16 bits, which is more than any real PCI address uses.
 //   1) Default device ALWAYS wins
 //   2) Sort by type
-//   3) Sort by PCI bus ID
+//   3) Sort by PCI bus ID, devices with PCI bus info come before those without
 //   4) Ties broken by device_ID XOR vendor_ID comparison
-int32_t compare_devices(const void *a, const void *b) {
-    struct LinuxSortedDeviceInfo *left = (struct LinuxSortedDeviceInfo *)a;
-    struct LinuxSortedDeviceInfo *right = (struct LinuxSortedDeviceInfo *)b;
-
-    // Default device always gets priority
-    if (left->default_device) {
-        return -1;
-    } else if (right->default_device) {
-        return 1;
-    }
-
-    // Order by device type next
-    int32_t dev_type_comp = device_type_compare(left->device_type, right->device_type);
-    if (0 != dev_type_comp) {
-        return dev_type_comp;
-    }
-
-    // Sort by PCI info (prioritize devices that have info over those that don't)
-    if (left->has_pci_bus_info && !right->has_pci_bus_info) {
-        return -1;
-    } else if (!left->has_pci_bus_info && right->has_pci_bus_info) {
-        return 1;
-    } else if (left->has_pci_bus_info && right->has_pci_bus_info) {
-        // Sort low to high PCI domain
-        if (left->pci_domain < right->pci_domain) {
-            return -1;
-        } else if (left->pci_domain > right->pci_domain) {
-            return 1;
-        }
-        // Sort low to high PCI bus
-        if (left->pci_bus < right->pci_bus) {
-            return -1;
-        } else if (left->pci_bus > right->pci_bus) {
-            return 1;
-        }
-        // Sort low to high PCI device
-        if (left->pci_device < right->pci_device) {
-            return -1;
-        } else if (left->pci_device > right->pci_device) {
-            return 1;
-        }
-        // Sort low to high PCI function
-        if (left->pci_function < right->pci_function) {
-            return -1;
-        } else if (left->pci_function > right->pci_function) {
-            return 1;
-        }
+void linux_compute_sort_key(struct LinuxSortedDeviceInfo *device_info) {
+    uint64_t pci_domain = 0, pci_bus = 0, pci_device = 0, pci_function = 0;
+    if (device_info->has_pci_bus_info) {
+        pci_domain = device_info->pci_domain;
+        pci_bus = device_info->pci_bus > 0xFFFF ? 0xFFFF : device_info->pci_bus;
+        pci_device = device_info->pci_device > 0xFFFF ? 0xFFFF : device_info->pci_device;
+        pci_function = device_info->pci_function > 0xFFFF ? 0xFFFF : device_info->pci_function;
     }
+    // Smaller keys sort first, so store the inverse of each "higher wins" criteria
+    device_info->sort_key[0] = (uint64_t)(device_info->default_device ? 0 : 1) << 53 |
+                               (uint64_t)(15 - determine_priority_type_value(device_info->device_type)) << 49 |
+                               (uint64_t)(device_info->has_pci_bus_info ? 0 : 1) << 48 | pci_domain << 16 | pci_bus;
+    device_info->sort_key[1] =
+        pci_device << 48 | pci_function << 32 | (uint64_t)(device_info->device_id ^ device_info->vendor_id);
+}
 
-    // Somehow we have a tie above, so XOR vendorID and deviceID and compare
-    uint32_t left_xord_dev_vend = left->device_id ^ left->vendor_id;
-    uint32_t right_xord_dev_vend = right->device_id ^ right->vendor_id;
-    if (left_xord_dev_vend < right_xord_dev_vend) {
-        return -1;
-    } else if (right_xord_dev_vend < left_xord_dev_vend) {
-        return 1;
-    }
-    return 0;
+// Used to compare two devices and determine which one should have priority, using the keys from linux_compute_sort_key.
+// This behaves similar to a qsort compare.
+int32_t compare_devices(const void *a, const void *b) {
+    const struct LinuxSortedDeviceInfo *left = (const struct LinuxSortedDeviceInfo *)a;
+    const struct LinuxSortedDeviceInfo *right = (const struct LinuxSortedDeviceInfo *)b;
+    int32_t high = (left->sort_key[0] > right->sort_key[0]) - (left->sort_key[0] < right->sort_key[0]);
+    int32_t low = (left->sort_key[1] > right->sort_key[1]) - (left->sort_key[1] < right->sort_key[1]);
+    // The low half only matters when the high halves are equal
+    return high * 2 + low;
 }
 
 // Used to compare two device groups and determine which one should have priority.
 // NOTE: This assumes that devices in each group have already been sorted.
-// The group sort criteria is simple:
-//   1) Group with the default device ALWAYS wins
-//   2) Group with the best device type for device 0 wins
-//   3) Group with best PCI bus ID for device 0 wins
-//   4) Ties broken by group device 0 device_ID XOR vendor_ID comparison
+// The group sort criteria is the same as for devices, applied to device 0 of each group.
 int32_t compare_device_groups(const void *a, const void *b) {
-    struct loader_physical_device_group_term *grp_a = (struct loader_physical_device_group_term *)a;
-    struct loader_physical_device_group_term *grp_b = (struct loader_physical_device_group_term *)b;
+    const struct loader_physical_device_group_term *grp_a = (const struct loader_physical_device_group_term *)a;
+    const struct loader_physical_device_group_term *grp_b = (const struct loader_physical_device_group_term *)b;
 
     // Use the first GPU's info from each group to sort the groups by
-    struct LinuxSortedDeviceInfo *left = &grp_a->internal_device_info[0];
-    struct LinuxSortedDeviceInfo *right = &grp_b->internal_device_info[0];
-
-    // Default device always gets priority
-    if (left->default_device) {
-        return -1;
-    } else if (right->default_device) {
-        return 1;
-    }
-
-    // Order by device type next
-    int32_t dev_type_comp = device_type_compare(left->device_type, right->device_type);
-    if (0 != dev_type_comp) {
-        return dev_type_comp;
-    }
+    return compare_devices(&grp_a->internal_device_info[0], &grp_b->internal_device_info[0]);
+}
 
-    // Sort by PCI info (prioritize devices that have info over those that don't)
-    if (left->has_pci_bus_info && !right->has_pci_bus_info) {
-        return -1;
-    } else if (!left->has_pci_bus_info && right->has_pci_bus_info) {
-        return 1;
-    } else if (left->has_pci_bus_info && right->has_pci_bus_info) {
-        // Sort low to high PCI domain
-        if (left->pci_domain < right->pci_domain) {
-            return -1;
-        } else if (left->pci_domain > right->pci_domain) {
-            return 1;
-        }
-        // Sort low to high PCI bus
-        if (left->pci_bus < right->pci_bus) {
-            return -1;
-        } else if (left->pci_bus > right->pci_bus) {
-            return 1;
-        }
-        // Sort low to high PCI device
-        if (left->pci_device < right->pci_device) {
-            return -1;
-        } else if (left->pci_device > right->pci_device) {
-            return 1;
+// Fill in device_info with the properties of physical_device which decide its place in the sorted order
+VkResult linux_read_device_sort_info(struct loader_instance *inst, struct loader_icd_term *icd_term,
+                                     VkPhysicalDevice physical_device, struct LinuxSortedDeviceInfo *device_info) {
+    bool app_is_vulkan_1_1 = loader_check_version_meets_required(LOADER_VERSION_1_1_0, inst->app_api_version);
+    VkPhysicalDeviceProperties dev_props = {};
+
+    device_info->physical_device = physical_device;
+    device_info->icd_term = icd_term;
+    device_info->has_pci_bus_info = false;
+
+    ICD_DISPATCH(icd_term, GetPhysicalDeviceProperties)(physical_device, &dev_props);
+    device_info->device_type = dev_props.deviceType;
+    strncpy(device_info->device_name, dev_props.deviceName, VK_MAX_PHYSICAL_DEVICE_NAME_SIZE);
+    device_info->vendor_id = dev_props.vendorID;
+    device_info->device_id = dev_props.deviceID;
+
+    bool device_is_1_1_capable =
+        loader_check_version_meets_required(LOADER_VERSION_1_1_0, loader_make_version(dev_props.apiVersion));
+    uint32_t ext_count = 0;
+    ICD_DISPATCH(icd_term, EnumerateDeviceExtensionProperties)(physical_device, NULL, &ext_count, NULL);
+    if (ext_count > 0) {
+        VkExtensionProperties *ext_props = (VkExtensionProperties *)loader_stack_alloc(sizeof(VkExtensionProperties) * ext_count);
+        if (NULL == ext_props) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
         }
-        // Sort low to high PCI function
-        if (left->pci_function < right->pci_function) {
-            return -1;
-        } else if (left->pci_function > right->pci_function) {
-            return 1;
+        ICD_DISPATCH(icd_term, EnumerateDeviceExtensionProperties)(physical_device, NULL, &ext_count, ext_props);
+        for (uint32_t ext = 0; ext < ext_count; ++ext) {
+            if (!strcmp(ext_props[ext].extensionName, VK_EXT_PCI_BUS_INFO_EXTENSION_NAME)) {
+                device_info->has_pci_bus_info = true;
+                break;
+            }
         }
     }
 
-    // Somehow we have a tie above, so XOR vendorID and deviceID and compare
-    uint32_t left_xord_dev_vend = left->device_id ^ left->vendor_id;
-    uint32_t right_xord_dev_vend = right->device_id ^ right->vendor_id;
-    if (left_xord_dev_vend < right_xord_dev_vend) {
-        return -1;
-    } else if (right_xord_dev_vend < left_xord_dev_vend) {
-        return 1;
+    if (device_info->has_pci_bus_info) {
+        VkPhysicalDevicePCIBusInfoPropertiesEXT pci_props =
+            (VkPhysicalDevicePCIBusInfoPropertiesEXT){.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT};
+        VkPhysicalDeviceProperties2 dev_props2 =
+            (VkPhysicalDeviceProperties2){.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, .pNext = &pci_props};
+
+        PFN_vkGetPhysicalDeviceProperties2 GetPhysDevProps2 = NULL;
+        if (app_is_vulkan_1_1 && device_is_1_1_capable) {
+            GetPhysDevProps2 = ICD_DISPATCH(icd_term, GetPhysicalDeviceProperties2);
+        } else {
+            GetPhysDevProps2 = (PFN_vkGetPhysicalDeviceProperties2)ICD_DISPATCH(icd_term, GetPhysicalDeviceProperties2KHR);
+        }
+        if (NULL != GetPhysDevProps2) {
+            GetPhysDevProps2(physical_device, &dev_props2);
+            device_info->pci_domain = pci_props.pciDomain;
+            device_info->pci_bus = pci_props.pciBus;
+            device_info->pci_device = pci_props.pciDevice;
+            device_info->pci_function = pci_props.pciFunction;
+        } else {
+            device_info->has_pci_bus_info = false;
+        }
     }
-    return 0;
+    return VK_SUCCESS;
 }
 
 // Search for the default device using the loader environment variable.
@@ -234,10 +187,10 @@ void linux_env_var_default_device(struct loader_instance *inst, uint32_t device_
 
 // This function allocates an array in sorted_devices which must be freed by the caller if not null
 VkResult linux_read_sorted_physical_devices(struct loader_instance *inst, uint32_t icd_count,
-                                            struct loader_icd_physical_devices *icd_devices, uint32_t phys_dev_count,
+                                            struct loader_icd_physical_devices *icd_devices,
+                                            const struct loader_handle_map *old_phys_devs_map, uint32_t phys_dev_count,
                                             struct loader_physical_device_term **sorted_device_term) {
     VkResult res = VK_SUCCESS;
-    bool app_is_vulkan_1_1 = loader_check_version_meets_required(LOADER_VERSION_1_1_0, inst->app_api_version);
 
     struct LinuxSortedDeviceInfo *sorted_device_info = loader_instance_heap_calloc(
         inst, phys_dev_count * sizeof(struct LinuxSortedDeviceInfo), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
@@ -249,67 +202,19 @@ VkResult linux_read_sorted_physical_devices(struct loader_instance *inst, uint32
     loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0, "linux_read_sorted_physical_devices:");
     loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0, "     Original order:");
 
-    // Grab all the necessary info we can about each device
+    // Grab all the necessary info we can about each device, physical devices which were sorted before already have it
     uint32_t index = 0;
     for (uint32_t icd_idx = 0; icd_idx < icd_count; ++icd_idx) {
         for (uint32_t phys_dev = 0; phys_dev < icd_devices[icd_idx].device_count; ++phys_dev) {
-            struct loader_icd_term *icd_term = icd_devices[icd_idx].icd_term;
-            VkPhysicalDeviceProperties dev_props = {};
-
-            sorted_device_info[index].physical_device = icd_devices[icd_idx].physical_devices[phys_dev];
-            sorted_device_info[index].icd_term = icd_term;
-            sorted_device_info[index].has_pci_bus_info = false;
-
-            icd_term->dispatch.GetPhysicalDeviceProperties(sorted_device_info[index].physical_device, &dev_props);
-            sorted_device_info[index].device_type = dev_props.deviceType;
-            strncpy(sorted_device_info[index].device_name, dev_props.deviceName, VK_MAX_PHYSICAL_DEVICE_NAME_SIZE);
-            sorted_device_info[index].vendor_id = dev_props.vendorID;
-            sorted_device_info[index].device_id = dev_props.deviceID;
-
-            bool device_is_1_1_capable =
-                loader_check_version_meets_required(LOADER_VERSION_1_1_0, loader_make_version(dev_props.apiVersion));
-            if (!sorted_device_info[index].has_pci_bus_info) {
-                uint32_t ext_count = 0;
-                icd_term->dispatch.EnumerateDeviceExtensionProperties(sorted_device_info[index].physical_device, NULL, &ext_count,
-                                                                      NULL);
-                if (ext_count > 0) {
-                    VkExtensionProperties *ext_props =
-                        (VkExtensionProperties *)loader_stack_alloc(sizeof(VkExtensionProperties) * ext_count);
-                    if (NULL == ext_props) {
-                        res = VK_ERROR_OUT_OF_HOST_MEMORY;
-                        goto out;
-                    }
-                    icd_term->dispatch.EnumerateDeviceExtensionProperties(sorted_device_info[index].physical_device, NULL,
-                                                                          &ext_count, ext_props);
-                    for (uint32_t ext = 0; ext < ext_count; ++ext) {
-                        if (!strcmp(ext_props[ext].extensionName, VK_EXT_PCI_BUS_INFO_EXTENSION_NAME)) {
-                            sorted_device_info[index].has_pci_bus_info = true;
-                            break;
-                        }
-                    }
-                }
-            }
-
-            if (sorted_device_info[index].has_pci_bus_info) {
-                VkPhysicalDevicePCIBusInfoPropertiesEXT pci_props = (VkPhysicalDevicePCIBusInfoPropertiesEXT){
-                    .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT};
-                VkPhysicalDeviceProperties2 dev_props2 =
-                    (VkPhysicalDeviceProperties2){.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, .pNext = &pci_props};
-
-                PFN_vkGetPhysicalDeviceProperties2 GetPhysDevProps2 = NULL;
-                if (app_is_vulkan_1_1 && device_is_1_1_capable) {
-                    GetPhysDevProps2 = icd_term->dispatch.GetPhysicalDeviceProperties2;
-                } else {
-                    GetPhysDevProps2 = (PFN_vkGetPhysicalDeviceProperties2)icd_term->dispatch.GetPhysicalDeviceProperties2KHR;
-                }
-                if (NULL != GetPhysDevProps2) {
-                    GetPhysDevProps2(sorted_device_info[index].physical_device, &dev_props2);
-                    sorted_device_info[index].pci_domain = pci_props.pciDomain;
-                    sorted_device_info[index].pci_bus = pci_props.pciBus;
-                    sorted_device_info[index].pci_device = pci_props.pciDevice;
-                    sorted_device_info[index].pci_function = pci_props.pciFunction;
-                } else {
-                    sorted_device_info[index].has_pci_bus_info = false;
+            VkPhysicalDevice physical_device = icd_devices[icd_idx].physical_devices[phys_dev];
+            struct loader_physical_device_term **old_slot = loader_handle_map_find(old_phys_devs_map, physical_device);
+            if (NULL != old_slot && (*old_slot)->has_sort_info) {
+                sorted_device_info[index] = (*old_slot)->sort_info;
+                sorted_device_info[index].default_device = false;
+            } else {
+                res = linux_read_device_sort_info(inst, icd_devices[icd_idx].icd_term, physical_device, &sorted_device_info[index]);
+                if (VK_SUCCESS != res) {
+                    goto out;
                 }
             }
             loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0, "           [%u] %s", index,
@@ -322,6 +227,9 @@ VkResult linux_read_sorted_physical_devices(struct loader_instance *inst, uint32
     linux_env_var_default_device(inst, phys_dev_count, sorted_device_info);
 
     // Sort devices by PCI info
+    for (uint32_t dev = 0; dev < phys_dev_count; ++dev) {
+        linux_compute_sort_key(&sorted_device_info[dev]);
+    }
     qsort(sorted_device_info, phys_dev_count, sizeof(struct LinuxSortedDeviceInfo), compare_devices);
 
     // If we have a selected index, add that first.
@@ -331,6 +239,8 @@ VkResult linux_read_sorted_physical_devices(struct loader_instance *inst, uint32
     for (uint32_t dev = 0; dev < phys_dev_count; ++dev) {
         sorted_device_term[dev]->this_icd_term = sorted_device_info[dev].icd_term;
         sorted_device_term[dev]->phys_dev = sorted_device_info[dev].physical_device;
+        sorted_device_term[dev]->has_sort_info = true;
+        sorted_device_term[dev]->sort_info = sorted_device_info[dev];
         loader_set_dispatch((void *)sorted_device_term[dev], inst->disp);
         loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0, "           [%u] %s  %s", dev,
                    sorted_device_info[dev].device_name, (sorted_device_info[dev].default_device ? "[default]" : ""));
@@ -346,7 +256,20 @@ out:
 VkResult linux_sort_physical_device_groups(struct loader_instance *inst, uint32_t group_count,
                                            struct loader_physical_device_group_term *sorted_group_term) {
     VkResult res = VK_SUCCESS;
-    bool app_is_vulkan_1_1 = loader_check_version_meets_required(LOADER_VERSION_1_1_0, inst->app_api_version);
+
+    // The physical devices of the groups are usually already known from vkEnumeratePhysicalDevices, along with their properties
+    struct loader_handle_map phys_devs_map = {0};
+    res = loader_init_handle_map(inst, &phys_devs_map, inst->phys_dev_count_term);
+    if (VK_SUCCESS != res) {
+        return res;
+    }
+    for (uint32_t i = 0; i < inst->phys_dev_count_term; i++) {
+        if (NULL == inst->phys_devs_term[i]) continue;
+        res = loader_handle_map_insert(inst, &phys_devs_map, inst->phys_devs_term[i]->phys_dev, inst->phys_devs_term[i]);
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+    }
 
     loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0, "linux_sort_physical_device_groups:  Original order:");
 
@@ -355,67 +278,24 @@ VkResult linux_sort_physical_device_groups(struct loader_instance *inst, uint32_
 
         struct loader_icd_term *icd_term = sorted_group_term[group].this_icd_term;
         for (uint32_t gpu = 0; gpu < sorted_group_term[group].group_props.physicalDeviceCount; ++gpu) {
-            VkPhysicalDeviceProperties dev_props = {};
-
-            sorted_group_term[group].internal_device_info[gpu].physical_device =
-                sorted_group_term[group].group_props.physicalDevices[gpu];
-            sorted_group_term[group].internal_device_info[gpu].has_pci_bus_info = false;
-
-            icd_term->dispatch.GetPhysicalDeviceProperties(sorted_group_term[group].internal_device_info[gpu].physical_device,
-                                                           &dev_props);
-            sorted_group_term[group].internal_device_info[gpu].device_type = dev_props.deviceType;
-            strncpy(sorted_group_term[group].internal_device_info[gpu].device_name, dev_props.deviceName,
-                    VK_MAX_PHYSICAL_DEVICE_NAME_SIZE);
-            sorted_group_term[group].internal_device_info[gpu].vendor_id = dev_props.vendorID;
-            sorted_group_term[group].internal_device_info[gpu].device_id = dev_props.deviceID;
-
-            bool device_is_1_1_capable =
-                loader_check_version_meets_required(LOADER_VERSION_1_1_0, loader_make_version(dev_props.apiVersion));
-            if (!sorted_group_term[group].internal_device_info[gpu].has_pci_bus_info) {
-                uint32_t ext_count;
-                icd_term->dispatch.EnumerateDeviceExtensionProperties(
-                    sorted_group_term[group].internal_device_info[gpu].physical_device, NULL, &ext_count, NULL);
-                if (ext_count > 0) {
-                    VkExtensionProperties *ext_props =
-                        (VkExtensionProperties *)loader_stack_alloc(sizeof(VkExtensionProperties) * ext_count);
-                    if (NULL == ext_props) {
-                        return VK_ERROR_OUT_OF_HOST_MEMORY;
-                    }
-                    icd_term->dispatch.EnumerateDeviceExtensionProperties(
-                        sorted_group_term[group].internal_device_info[gpu].physical_device, NULL, &ext_count, ext_props);
-                    for (uint32_t ext = 0; ext < ext_count; ++ext) {
-                        if (!strcmp(ext_props[ext].extensionName, VK_EXT_PCI_BUS_INFO_EXTENSION_NAME)) {
-                            sorted_group_term[group].internal_device_info[gpu].has_pci_bus_info = true;
-                            break;
-                        }
-                    }
+            struct LinuxSortedDeviceInfo *device_info = &sorted_group_term[group].internal_device_info[gpu];
+            VkPhysicalDevice physical_device = sorted_group_term[group].group_props.physicalDevices[gpu];
+            struct loader_physical_device_term *phys_dev_term = loader_handle_map_find(&phys_devs_map, physical_device);
+            if (NULL != phys_dev_term && phys_dev_term->has_sort_info) {
+                *device_info = phys_dev_term->sort_info;
+                device_info->default_device = false;
+            } else {
+                res = linux_read_device_sort_info(inst, icd_term, physical_device, device_info);
+                if (VK_SUCCESS != res) {
+                    goto out;
                 }
-            }
-
-            if (sorted_group_term[group].internal_device_info[gpu].has_pci_bus_info) {
-                VkPhysicalDevicePCIBusInfoPropertiesEXT pci_props = (VkPhysicalDevicePCIBusInfoPropertiesEXT){
-                    .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT};
-                VkPhysicalDeviceProperties2 dev_props2 =
-                    (VkPhysicalDeviceProperties2){.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2, .pNext = &pci_props};
-
-                PFN_vkGetPhysicalDeviceProperties2 GetPhysDevProps2 = NULL;
-                if (app_is_vulkan_1_1 && device_is_1_1_capable) {
-                    GetPhysDevProps2 = icd_term->dispatch.GetPhysicalDeviceProperties2;
-                } else {
-                    GetPhysDevProps2 = (PFN_vkGetPhysicalDeviceProperties2)icd_term->dispatch.GetPhysicalDeviceProperties2KHR;
-                }
-                if (NULL != GetPhysDevProps2) {
-                    GetPhysDevProps2(sorted_group_term[group].internal_device_info[gpu].physical_device, &dev_props2);
-                    sorted_group_term[group].internal_device_info[gpu].pci_domain = pci_props.pciDomain;
-                    sorted_group_term[group].internal_device_info[gpu].pci_bus = pci_props.pciBus;
-                    sorted_group_term[group].internal_device_info[gpu].pci_device = pci_props.pciDevice;
-                    sorted_group_term[group].internal_device_info[gpu].pci_function = pci_props.pciFunction;
-                } else {
-                    sorted_group_term[group].internal_device_info[gpu].has_pci_bus_info = false;
+                if (NULL != phys_dev_term) {
+                    phys_dev_term->has_sort_info = true;
+                    phys_dev_term->sort_info = *device_info;
                 }
             }
             loader_log(inst, VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DRIVER_BIT, 0, "               [%u] %s", gpu,
-                       sorted_group_term[group].internal_device_info[gpu].device_name);
+                       device_info->device_name);
         }
 
         // Select default device if set in the environment variable
@@ -423,6 +303,9 @@ VkResult linux_sort_physical_device_groups(struct loader_instance *inst, uint32_
                                      sorted_group_term[group].internal_device_info);
 
         // Sort GPUs in each group
+        for (uint32_t gpu = 0; gpu < sorted_group_term[group].group_props.physicalDeviceCount; ++gpu) {
+            linux_compute_sort_key(&sorted_group_term[group].internal_device_info[gpu]);
+        }
         qsort(sorted_group_term[group].internal_device_info, sorted_group_term[group].group_props.physicalDeviceCount,
               sizeof(struct LinuxSortedDeviceInfo), compare_devices);
 
@@ -447,6 +330,9 @@ VkResult linux_sort_physical_device_groups(struct loader_instance *inst, uint32_
         }
     }
 
+out:
+    loader_destroy_handle_map(inst, &phys_devs_map);
+
     return res;
 }
 
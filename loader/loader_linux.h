@@ -27,8 +27,11 @@
 #include "loader_common.h"
 
 // This function allocates an array in sorted_devices which must be freed by the caller if not null
+// Sorting information is reused from the physical devices in old_phys_devs_map, which maps the driver's handles to slots in
+// inst->phys_devs_term
 VkResult linux_read_sorted_physical_devices(struct loader_instance *inst, uint32_t icd_count,
-                                            struct loader_icd_physical_devices *icd_devices, uint32_t phys_dev_count,
+                                            struct loader_icd_physical_devices *icd_devices,
+                                            const struct loader_handle_map *old_phys_devs_map, uint32_t phys_dev_count,
                                             struct loader_physical_device_term **sorted_device_term);
 
 // This function sorts an array in physical device groups
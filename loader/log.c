@@ -31,7 +31,9 @@
 #include <stdio.h>
 #include <stdarg.h>
 
+#include "allocation.h"
 #include "debug_utils.h"
+#include "loader.h"
 #include "loader_common.h"
 #include "loader_environment.h"
 #include "settings.h"
@@ -39,20 +41,17 @@
 #ifdef VK_USE_PLATFORM_OHOS
 #include "loader_hilog.h"
 #endif
+#if COMMON_UNIX_PLATFORMS
+#include <signal.h>
+#endif
 
 uint32_t g_loader_debug = ~0u;
 
-void loader_init_global_debug_level(void) {
-    char *env, *orig;
-
-    if (g_loader_debug > 0) return;
-
-    g_loader_debug = 0;
-
-    // Parse comma-separated debug options
-    orig = env = loader_getenv("VK_LOADER_DEBUG", NULL);
+// Parses the comma-separated debug options of VK_LOADER_DEBUG and VK_LOADER_LOG_FILE_LEVEL into enum vulkan_loader_debug_flags
+uint32_t loader_parse_debug_filter_string(const char *env) {
+    uint32_t filter = 0;
     while (env) {
-        char *p = strchr(env, ',');
+        const char *p = strchr(env, ',');
         size_t len;
 
         if (p) {
@@ -63,21 +62,21 @@ void loader_init_global_debug_level(void) {
 
         if (len > 0) {
             if (strncmp(env, "all", len) == 0) {
-                g_loader_debug = ~0u;
+                filter = ~0u;
             } else if (strncmp(env, "warn", len) == 0) {
-                g_loader_debug |= VULKAN_LOADER_WARN_BIT;
+                filter |= VULKAN_LOADER_WARN_BIT;
             } else if (strncmp(env, "info", len) == 0) {
-                g_loader_debug |= VULKAN_LOADER_INFO_BIT;
+                filter |= VULKAN_LOADER_INFO_BIT;
             } else if (strncmp(env, "perf", len) == 0) {
-                g_loader_debug |= VULKAN_LOADER_PERF_BIT;
+                filter |= VULKAN_LOADER_PERF_BIT;
             } else if (strncmp(env, "error", len) == 0) {
-                g_loader_debug |= VULKAN_LOADER_ERROR_BIT;
+                filter |= VULKAN_LOADER_ERROR_BIT;
             } else if (strncmp(env, "debug", len) == 0) {
-                g_loader_debug |= VULKAN_LOADER_DEBUG_BIT;
+                filter |= VULKAN_LOADER_DEBUG_BIT;
             } else if (strncmp(env, "layer", len) == 0) {
-                g_loader_debug |= VULKAN_LOADER_LAYER_BIT;
+                filter |= VULKAN_LOADER_LAYER_BIT;
             } else if (strncmp(env, "driver", len) == 0 || strncmp(env, "implem", len) == 0 || strncmp(env, "icd", len) == 0) {
-                g_loader_debug |= VULKAN_LOADER_DRIVER_BIT;
+                filter |= VULKAN_LOADER_DRIVER_BIT;
             }
         }
 
@@ -85,8 +84,15 @@ void loader_init_global_debug_level(void) {
 
         env = p + 1;
     }
+    return filter;
+}
 
-    loader_free_getenv(orig, NULL);
+void loader_init_global_debug_level(void) {
+    if (g_loader_debug > 0) return;
+
+    char *env = loader_getenv("VK_LOADER_DEBUG", NULL);
+    g_loader_debug = loader_parse_debug_filter_string(env);
+    loader_free_getenv(env, NULL);
 }
 
 void loader_set_global_debug_level(uint32_t new_loader_debug) { g_loader_debug = new_loader_debug; }
@@ -137,86 +143,9 @@ void generate_debug_flag_str(VkFlags msg_type, size_t cmd_line_size, char *cmd_l
 #undef STRNCAT_TO_BUFFER
 }
 
-void DECORATE_PRINTF(4, 5)
-    loader_log(const struct loader_instance *inst, VkFlags msg_type, int32_t msg_code, const char *format, ...) {
-    (void)msg_code;
-    char msg[512] = {0};
-
-    va_list ap;
-    va_start(ap, format);
-    int ret = vsnprintf(msg, sizeof(msg), format, ap);
-    if ((ret >= (int)sizeof(msg)) || ret < 0) {
-        msg[sizeof(msg) - 1] = '\0';
-    }
-    va_end(ap);
-
-    if (inst) {
-        VkDebugUtilsMessageSeverityFlagBitsEXT severity = 0;
-        VkDebugUtilsMessageTypeFlagsEXT type = 0;
-        VkDebugUtilsMessengerCallbackDataEXT callback_data = {0};
-        VkDebugUtilsObjectNameInfoEXT object_name = {0};
-
-        if ((msg_type & VULKAN_LOADER_INFO_BIT) != 0) {
-            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
-        } else if ((msg_type & VULKAN_LOADER_WARN_BIT) != 0) {
-            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT;
-        } else if ((msg_type & VULKAN_LOADER_ERROR_BIT) != 0) {
-            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
-        } else if ((msg_type & VULKAN_LOADER_DEBUG_BIT) != 0) {
-            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT;
-        } else if ((msg_type & VULKAN_LOADER_LAYER_BIT) != 0 || (msg_type & VULKAN_LOADER_DRIVER_BIT) != 0) {
-            // Just driver or just layer bit should be treated as an info message in debug utils.
-            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
-        }
-
-        if ((msg_type & VULKAN_LOADER_PERF_BIT) != 0) {
-            type = VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
-        } else if ((msg_type & VULKAN_LOADER_VALIDATION_BIT) != 0) {
-            // For loader logging, if it's a validation message, we still want to also keep the general flag as well
-            // so messages of type validation can still be triggered for general message callbacks.
-            type = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
-        } else {
-            type = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT;
-        }
-
-        callback_data.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT;
-        callback_data.pMessageIdName = "Loader Message";
-        callback_data.pMessage = msg;
-        callback_data.objectCount = 1;
-        callback_data.pObjects = &object_name;
-        object_name.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT;
-        object_name.objectType = VK_OBJECT_TYPE_INSTANCE;
-        object_name.objectHandle = (uint64_t)(uintptr_t)inst;
-
-        util_SubmitDebugUtilsMessageEXT(inst, severity, type, &callback_data);
-    }
-
-    // Always log to stderr if this is a fatal error
-    if (0 == (msg_type & VULKAN_LOADER_FATAL_ERROR_BIT)) {
-        if (inst && inst->settings.settings_active && inst->settings.debug_level > 0) {
-            // Exit early if the current instance settings have some debugging options but do match the current msg_type
-            if (0 == (msg_type & inst->settings.debug_level)) {
-                return;
-            }
-            // Check the global settings and if that doesn't say to skip, check the environment variable
-        } else if (0 == (msg_type & g_loader_debug)) {
-            return;
-        }
-    }
-
-#if defined(DEBUG)
-    int debug_flag_mask =
-        msg_type & (VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DEBUG_BIT);
-    assert((debug_flag_mask == 0 || debug_flag_mask == VULKAN_LOADER_ERROR_BIT || debug_flag_mask == VULKAN_LOADER_WARN_BIT ||
-            debug_flag_mask == VULKAN_LOADER_INFO_BIT || debug_flag_mask == VULKAN_LOADER_DEBUG_BIT) &&
-           "This log has more than one exclusive debug flags (error, warn, info, debug) set");
-#endif
-
-    // Only need enough space to create the filter description header for log messages
-    // Also use the same header for all output
-    char cmd_line_msg[64] = {0};
-    size_t cmd_line_size = sizeof(cmd_line_msg);
-
+// Fills cmd_line_msg with the header which precedes every message written to the console
+void generate_log_header(VkFlags msg_type, size_t cmd_line_size, char *cmd_line_msg) {
+    cmd_line_msg[0] = '\0';
     loader_strncat(cmd_line_msg, cmd_line_size, "[Vulkan Loader] ", sizeof("[Vulkan Loader] "));
 
     bool need_separator = false;
@@ -262,7 +191,11 @@ void DECORATE_PRINTF(4, 5)
     }
     // Assert that we didn't write more than what is available in cmd_line_msg
     assert(cmd_line_size > num_used);
+}
 
+// Write a message and its header to the console
+void loader_log_output(VkFlags msg_type, const char *cmd_line_msg, const char *msg) {
+    (void)msg_type;
 #if !defined (__OHOS__)
     fputs(cmd_line_msg, stderr);
     fputs(msg, stderr);
@@ -282,6 +215,597 @@ void DECORATE_PRINTF(4, 5)
 #endif
 }
 
+#if COMMON_UNIX_PLATFORMS
+
+// Asynchronous console output, enabled by VK_LOADER_LOG_ASYNC.
+// Messages are copied into a fixed size ring buffer which a background thread writes to the console, so that logging with every
+// message type enabled doesn't slow down the thread making Vulkan calls. When the ring is full, new messages are dropped and a count
+// of them is written once there is space again. Fatal errors are never dropped, they are written immediately after everything
+// queued before them.
+
+#define LOADER_LOG_RING_CAPACITY 1024
+#define LOADER_LOG_WRITE_BATCH_SIZE 32
+
+struct loader_log_record {
+    VkFlags msg_type;
+    char cmd_line_msg[64];
+    char msg[512];
+};
+
+struct loader_async_log_output {
+    bool enabled;
+    bool writer_running;
+    bool stop_writer;
+    loader_platform_thread writer_thread;
+    // Guards every member other than batch
+    loader_platform_thread_mutex lock;
+    loader_platform_thread_cond records_available;
+    // Held while taking records out of the ring and writing them, which keeps the output in order when both the writer thread and
+    // a flush are writing. Also guards batch.
+    loader_platform_thread_mutex output_lock;
+    struct loader_log_record *records;
+    uint32_t first_record;
+    uint32_t record_count;
+    uint64_t dropped_count;
+    struct loader_log_record *batch;
+};
+
+struct loader_async_log_output async_log_output;
+
+void loader_init_async_log_output(void) {
+    loader_platform_thread_create_mutex(&async_log_output.lock);
+    loader_platform_thread_create_mutex(&async_log_output.output_lock);
+    loader_platform_thread_create_cond(&async_log_output.records_available);
+
+    char *async_env_var = loader_getenv("VK_LOADER_LOG_ASYNC", NULL);
+    if (async_env_var && 0 == strncmp(async_env_var, "1", 2)) {
+        // The ring is shared by all instances and lives until the loader is unloaded, so it doesn't use any allocation callbacks
+        async_log_output.records = loader_calloc(NULL, sizeof(struct loader_log_record) * LOADER_LOG_RING_CAPACITY,
+                                                 VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        async_log_output.batch = loader_calloc(NULL, sizeof(struct loader_log_record) * LOADER_LOG_WRITE_BATCH_SIZE,
+                                               VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+        async_log_output.enabled = NULL != async_log_output.records && NULL != async_log_output.batch;
+    }
+    loader_free_getenv(async_env_var, NULL);
+}
+
+// Moves up to LOADER_LOG_WRITE_BATCH_SIZE records out of the ring and writes them, returning how many were written.
+// Must be called with output_lock held.
+uint32_t loader_write_async_log_batch(void) {
+    loader_platform_thread_lock_mutex(&async_log_output.lock);
+    uint32_t count = async_log_output.record_count < LOADER_LOG_WRITE_BATCH_SIZE ? async_log_output.record_count
+                                                                                 : LOADER_LOG_WRITE_BATCH_SIZE;
+    for (uint32_t i = 0; i < count; i++) {
+        async_log_output.batch[i] = async_log_output.records[(async_log_output.first_record + i) % LOADER_LOG_RING_CAPACITY];
+    }
+    async_log_output.first_record = (async_log_output.first_record + count) % LOADER_LOG_RING_CAPACITY;
+    async_log_output.record_count -= count;
+    uint64_t dropped_count = async_log_output.dropped_count;
+    async_log_output.dropped_count = 0;
+    loader_platform_thread_unlock_mutex(&async_log_output.lock);
+
+    for (uint32_t i = 0; i < count; i++) {
+        loader_log_output(async_log_output.batch[i].msg_type, async_log_output.batch[i].cmd_line_msg, async_log_output.batch[i].msg);
+    }
+    if (dropped_count > 0) {
+        char cmd_line_msg[64] = {0};
+        char msg[128] = {0};
+        generate_log_header(VULKAN_LOADER_WARN_BIT, sizeof(cmd_line_msg), cmd_line_msg);
+        (void)snprintf(msg, sizeof(msg), "%llu log messages were dropped because the asynchronous log output fell behind",
+                       (unsigned long long)dropped_count);
+        loader_log_output(VULKAN_LOADER_WARN_BIT, cmd_line_msg, msg);
+    }
+    return count;
+}
+
+void *loader_async_log_writer(void *arg) {
+    (void)arg;
+    while (true) {
+        loader_platform_thread_lock_mutex(&async_log_output.lock);
+        while (0 == async_log_output.record_count && 0 == async_log_output.dropped_count && !async_log_output.stop_writer) {
+            loader_platform_thread_cond_wait(&async_log_output.records_available, &async_log_output.lock);
+        }
+        bool stop = async_log_output.stop_writer && 0 == async_log_output.record_count && 0 == async_log_output.dropped_count;
+        loader_platform_thread_unlock_mutex(&async_log_output.lock);
+        if (stop) {
+            break;
+        }
+
+        loader_platform_thread_lock_mutex(&async_log_output.output_lock);
+        loader_write_async_log_batch();
+        loader_platform_thread_unlock_mutex(&async_log_output.output_lock);
+    }
+    return NULL;
+}
+
+// Must be called with async_log_output.lock held
+bool loader_start_async_log_writer(void) {
+    // Keep signals from being delivered to the writer thread, the application may not expect them on a thread it doesn't know
+    sigset_t all_signals;
+    sigset_t previous_signals;
+    sigfillset(&all_signals);
+    pthread_sigmask(SIG_SETMASK, &all_signals, &previous_signals);
+    async_log_output.writer_running = loader_platform_thread_create(&async_log_output.writer_thread, loader_async_log_writer, NULL);
+    pthread_sigmask(SIG_SETMASK, &previous_signals, NULL);
+    return async_log_output.writer_running;
+}
+
+void loader_flush_async_log_output(void) {
+    if (!async_log_output.enabled) {
+        return;
+    }
+    loader_platform_thread_lock_mutex(&async_log_output.output_lock);
+    while (loader_write_async_log_batch() > 0) {
+    }
+    loader_platform_thread_unlock_mutex(&async_log_output.output_lock);
+}
+
+// Returns false if the message wasn't queued and needs to be written out directly
+bool loader_enqueue_async_log_output(VkFlags msg_type, const char *cmd_line_msg, const char *msg) {
+    // Only changes during loader initialization and release, so it is safe to check without the lock first
+    if (!async_log_output.enabled) {
+        return false;
+    }
+
+    if (0 != (msg_type & VULKAN_LOADER_FATAL_ERROR_BIT)) {
+        loader_platform_thread_lock_mutex(&async_log_output.output_lock);
+        while (loader_write_async_log_batch() > 0) {
+        }
+        loader_log_output(msg_type, cmd_line_msg, msg);
+        loader_platform_thread_unlock_mutex(&async_log_output.output_lock);
+        return true;
+    }
+
+    loader_platform_thread_lock_mutex(&async_log_output.lock);
+    if (!async_log_output.enabled || (!async_log_output.writer_running && !loader_start_async_log_writer())) {
+        loader_platform_thread_unlock_mutex(&async_log_output.lock);
+        return false;
+    }
+    if (async_log_output.record_count == LOADER_LOG_RING_CAPACITY) {
+        async_log_output.dropped_count++;
+    } else {
+        struct loader_log_record *record =
+            &async_log_output.records[(async_log_output.first_record + async_log_output.record_count) % LOADER_LOG_RING_CAPACITY];
+        record->msg_type = msg_type;
+        loader_strncpy(record->cmd_line_msg, sizeof(record->cmd_line_msg), cmd_line_msg, sizeof(record->cmd_line_msg) - 1);
+        record->cmd_line_msg[sizeof(record->cmd_line_msg) - 1] = '\0';
+        loader_strncpy(record->msg, sizeof(record->msg), msg, sizeof(record->msg) - 1);
+        record->msg[sizeof(record->msg) - 1] = '\0';
+        async_log_output.record_count++;
+    }
+    loader_platform_thread_cond_broadcast(&async_log_output.records_available);
+    loader_platform_thread_unlock_mutex(&async_log_output.lock);
+    return true;
+}
+
+void loader_release_async_log_output(void) {
+    loader_platform_thread_lock_mutex(&async_log_output.lock);
+    bool writer_running = async_log_output.writer_running;
+    // Anything logged from now on is written directly
+    async_log_output.enabled = false;
+    async_log_output.stop_writer = true;
+    loader_platform_thread_cond_broadcast(&async_log_output.records_available);
+    loader_platform_thread_unlock_mutex(&async_log_output.lock);
+
+    // The writer thread empties the ring before exiting
+    if (writer_running) {
+        loader_platform_thread_join(async_log_output.writer_thread);
+    }
+
+    loader_free(NULL, async_log_output.records);
+    loader_free(NULL, async_log_output.batch);
+    loader_platform_thread_delete_cond(&async_log_output.records_available);
+    loader_platform_thread_delete_mutex(&async_log_output.output_lock);
+    loader_platform_thread_delete_mutex(&async_log_output.lock);
+    memset(&async_log_output, 0, sizeof(async_log_output));
+}
+
+#else
+
+// Asynchronous console output requires a background thread, which the loader only creates on platforms where it can reliably
+// shut the thread down when it is unloaded.
+void loader_init_async_log_output(void) {}
+void loader_release_async_log_output(void) {}
+void loader_flush_async_log_output(void) {}
+bool loader_enqueue_async_log_output(VkFlags msg_type, const char *cmd_line_msg, const char *msg) {
+    (void)msg_type;
+    (void)cmd_line_msg;
+    (void)msg;
+    return false;
+}
+
+#endif
+
+// Structured log file output, enabled by VK_LOADER_LOG_FILE or the "log_file" element of the loader settings file.
+// Every message written to the console is also appended to the file as a single line JSON object, so that logs can be collected
+// without parsing the console format. Records are gathered in a buffer which is written out when it is full, when an instance is
+// destroyed, when a fatal error is logged, and when the loader is unloaded.
+
+#define LOADER_LOG_FILE_BUFFER_SIZE (64 * 1024)
+// Every byte of a message may need to be escaped as \u00XX or replaced by \ufffd, the rest is for the other fields of the record
+#define LOADER_LOG_FILE_MAX_RECORD_SIZE (512 * 6 + 256)
+// Without VK_LOADER_LOG_FILE_LEVEL or the "log_file_level" element of the settings file, every message is written
+#define LOADER_LOG_FILE_DEFAULT_LEVEL (~0u)
+
+struct loader_log_file_output {
+    bool initialized;
+    // Guards every other member
+    loader_platform_thread_mutex lock;
+    // The environment variables take precedence over the settings file
+    bool path_from_env_var;
+    bool level_from_env_var;
+    // Message types which are written to the file, independent of the console's filter. Zero while no file is open, and read
+    // without the lock in loader_log() to skip formatting messages nothing wants, the same way g_loader_debug is.
+    uint32_t active_level;
+    uint32_t level;
+    char *path;
+    FILE *file;
+    char *buffer;
+    size_t buffer_used;
+};
+
+struct loader_log_file_output log_file_output;
+
+// Must be called with log_file_output.lock held
+void loader_write_log_file_buffer(void) {
+    if (NULL != log_file_output.file && log_file_output.buffer_used > 0) {
+        (void)fwrite(log_file_output.buffer, 1, log_file_output.buffer_used, log_file_output.file);
+        (void)fflush(log_file_output.file);
+    }
+    log_file_output.buffer_used = 0;
+}
+
+// Must be called with log_file_output.lock held
+void loader_close_log_file(void) {
+    loader_write_log_file_buffer();
+    if (NULL != log_file_output.file) {
+        (void)fclose(log_file_output.file);
+    }
+    loader_free(NULL, log_file_output.path);
+    loader_free(NULL, log_file_output.buffer);
+    log_file_output.path = NULL;
+    log_file_output.file = NULL;
+    log_file_output.buffer = NULL;
+    log_file_output.buffer_used = 0;
+    log_file_output.active_level = 0;
+}
+
+// Must be called with log_file_output.lock held. Returns false if the file couldn't be opened.
+bool loader_open_log_file(const char *path) {
+    loader_close_log_file();
+    // The file is shared by all instances and lives until the loader is unloaded, so it doesn't use any allocation callbacks
+    if (VK_SUCCESS != loader_copy_to_new_str(NULL, path, &log_file_output.path)) {
+        return false;
+    }
+    log_file_output.buffer = loader_calloc(NULL, LOADER_LOG_FILE_BUFFER_SIZE, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    log_file_output.file = loader_fopen(path, "a");
+    if (NULL == log_file_output.buffer || NULL == log_file_output.file) {
+        loader_close_log_file();
+        return false;
+    }
+    log_file_output.active_level = log_file_output.level;
+    return true;
+}
+
+void loader_init_log_file_output(void) {
+    loader_platform_thread_create_mutex(&log_file_output.lock);
+    log_file_output.initialized = true;
+    log_file_output.level = LOADER_LOG_FILE_DEFAULT_LEVEL;
+
+    char *log_file_level_env_var = loader_secure_getenv("VK_LOADER_LOG_FILE_LEVEL", NULL);
+    if (NULL != log_file_level_env_var && '\0' != log_file_level_env_var[0]) {
+        log_file_output.level_from_env_var = true;
+        log_file_output.level = loader_parse_debug_filter_string(log_file_level_env_var);
+    }
+    loader_free_getenv(log_file_level_env_var, NULL);
+
+    char *log_file_env_var = loader_secure_getenv("VK_LOADER_LOG_FILE", NULL);
+    if (NULL != log_file_env_var && '\0' != log_file_env_var[0]) {
+        log_file_output.path_from_env_var = true;
+        if (!loader_open_log_file(log_file_env_var)) {
+            loader_log(NULL, VULKAN_LOADER_WARN_BIT, 0, "Unable to open the log file \"%s\" given by VK_LOADER_LOG_FILE",
+                       log_file_env_var);
+        }
+    }
+    loader_free_getenv(log_file_env_var, NULL);
+}
+
+void loader_set_log_file_from_settings(const char *path, uint32_t level) {
+    if (!log_file_output.initialized) {
+        return;
+    }
+    loader_platform_thread_lock_mutex(&log_file_output.lock);
+    if (!log_file_output.level_from_env_var) {
+        log_file_output.level = 0 != level ? level : LOADER_LOG_FILE_DEFAULT_LEVEL;
+        if (NULL != log_file_output.file) {
+            log_file_output.active_level = log_file_output.level;
+        }
+    }
+    bool unchanged = log_file_output.path_from_env_var ||
+                     (NULL == path && NULL == log_file_output.path) ||
+                     (NULL != path && NULL != log_file_output.path && 0 == strcmp(path, log_file_output.path));
+    bool opened = true;
+    if (!unchanged) {
+        if (NULL == path) {
+            loader_close_log_file();
+        } else {
+            opened = loader_open_log_file(path);
+        }
+    }
+    loader_platform_thread_unlock_mutex(&log_file_output.lock);
+
+    if (!opened) {
+        loader_log(NULL, VULKAN_LOADER_WARN_BIT, 0, "Unable to open the log file \"%s\" given by the loader settings file", path);
+    }
+}
+
+void loader_flush_log_file_output(void) {
+    if (!log_file_output.initialized) {
+        return;
+    }
+    loader_platform_thread_lock_mutex(&log_file_output.lock);
+    loader_write_log_file_buffer();
+    loader_platform_thread_unlock_mutex(&log_file_output.lock);
+}
+
+void loader_release_log_file_output(void) {
+    // The loader may be unloaded without ever having been initialized
+    if (!log_file_output.initialized) {
+        return;
+    }
+    loader_platform_thread_lock_mutex(&log_file_output.lock);
+    loader_close_log_file();
+    loader_platform_thread_unlock_mutex(&log_file_output.lock);
+    loader_platform_thread_delete_mutex(&log_file_output.lock);
+    memset(&log_file_output, 0, sizeof(log_file_output));
+}
+
+// Returns the length of the UTF-8 sequence starting at c, or 0 if the bytes there aren't a valid sequence
+size_t loader_utf8_sequence_length(const unsigned char *c) {
+    size_t length = 0;
+    // The second byte of some sequences is restricted further, to rule out overlong encodings, surrogates and values past U+10FFFF
+    unsigned char second_min = 0x80;
+    unsigned char second_max = 0xBF;
+    if (c[0] < 0x80) {
+        return 1;
+    } else if (c[0] >= 0xC2 && c[0] <= 0xDF) {
+        length = 2;
+    } else if (c[0] >= 0xE0 && c[0] <= 0xEF) {
+        length = 3;
+        if (c[0] == 0xE0) second_min = 0xA0;
+        if (c[0] == 0xED) second_max = 0x9F;
+    } else if (c[0] >= 0xF0 && c[0] <= 0xF4) {
+        length = 4;
+        if (c[0] == 0xF0) second_min = 0x90;
+        if (c[0] == 0xF4) second_max = 0x8F;
+    } else {
+        return 0;
+    }
+    if (c[1] < second_min || c[1] > second_max) {
+        return 0;
+    }
+    for (size_t i = 2; i < length; i++) {
+        if (c[i] < 0x80 || c[i] > 0xBF) {
+            return 0;
+        }
+    }
+    return length;
+}
+
+// Writes msg into record as the contents of a JSON string, returning the number of characters written.
+// Bytes which aren't part of a valid UTF-8 sequence are replaced with U+FFFD, except for a sequence cut short by the end of the
+// message, which is what truncating a long message leaves behind, and is dropped.
+size_t loader_escape_json_string(const char *msg, char *record) {
+    static const char hex_digits[] = "0123456789abcdef";
+    size_t used = 0;
+    for (const char *c = msg; *c != '\0'; c++) {
+        switch (*c) {
+            case '"':
+            case '\\':
+                record[used++] = '\\';
+                record[used++] = *c;
+                break;
+            case '\n':
+                record[used++] = '\\';
+                record[used++] = 'n';
+                break;
+            case '\r':
+                record[used++] = '\\';
+                record[used++] = 'r';
+                break;
+            case '\t':
+                record[used++] = '\\';
+                record[used++] = 't';
+                break;
+            default:
+                if ((unsigned char)*c < 0x20) {
+                    record[used++] = '\\';
+                    record[used++] = 'u';
+                    record[used++] = '0';
+                    record[used++] = '0';
+                    record[used++] = hex_digits[((unsigned char)*c >> 4) & 0xF];
+                    record[used++] = hex_digits[(unsigned char)*c & 0xF];
+                } else if ((unsigned char)*c < 0x80) {
+                    record[used++] = *c;
+                } else {
+                    size_t length = loader_utf8_sequence_length((const unsigned char *)c);
+                    if (0 == length) {
+                        // A lead byte followed by fewer continuation bytes than it needs before the end of the message
+                        unsigned char lead = (unsigned char)*c;
+                        size_t needed = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : 2;
+                        size_t present = 1;
+                        while (present < needed && (unsigned char)c[present] >= 0x80 && (unsigned char)c[present] <= 0xBF) {
+                            present++;
+                        }
+                        bool cut_short = lead >= 0xC2 && lead <= 0xF4 && present < needed && c[present] == '\0';
+                        if (cut_short) {
+                            return used;
+                        }
+                        // Only the lead byte is replaced, the bytes after it are checked again on their own
+                        memcpy(record + used, "\\ufffd", 6);
+                        used += 6;
+                    } else {
+                        memcpy(record + used, c, length);
+                        used += length;
+                        c += length - 1;
+                    }
+                }
+                break;
+        }
+    }
+    return used;
+}
+
+// Fatal errors are always written, like they are always written to the console
+bool loader_log_file_accepts(uint32_t level, VkFlags msg_type) {
+    return 0 != (msg_type & (level | VULKAN_LOADER_FATAL_ERROR_BIT));
+}
+
+void loader_write_log_file_record(const struct loader_instance *inst, VkFlags msg_type, const char *msg) {
+    if (!log_file_output.initialized) {
+        return;
+    }
+    // Take the timestamp before waiting on the lock so it reflects when the message was logged
+    uint64_t timestamp = loader_platform_get_monotonic_time_ns();
+    uint64_t thread_id = loader_platform_get_thread_id();
+
+    loader_platform_thread_lock_mutex(&log_file_output.lock);
+    if (NULL == log_file_output.file || !loader_log_file_accepts(log_file_output.level, msg_type)) {
+        loader_platform_thread_unlock_mutex(&log_file_output.lock);
+        return;
+    }
+    if (LOADER_LOG_FILE_BUFFER_SIZE - log_file_output.buffer_used < LOADER_LOG_FILE_MAX_RECORD_SIZE) {
+        loader_write_log_file_buffer();
+    }
+
+    char *record = log_file_output.buffer + log_file_output.buffer_used;
+    int header_size = snprintf(record, LOADER_LOG_FILE_MAX_RECORD_SIZE,
+                               "{\"timestamp_ns\":%llu,\"thread_id\":%llu,\"instance\":\"0x%llx\",\"message_type\":%u,\"message\":\"",
+                               (unsigned long long)timestamp, (unsigned long long)thread_id,
+                               (unsigned long long)(uintptr_t)inst, (unsigned)msg_type);
+    if (header_size > 0) {
+        size_t used = (size_t)header_size;
+        used += loader_escape_json_string(msg, record + used);
+        record[used++] = '"';
+        record[used++] = '}';
+        record[used++] = '\n';
+        log_file_output.buffer_used += used;
+    }
+
+    // The process may not survive a fatal error, so don't leave its record in the buffer
+    if (0 != (msg_type & VULKAN_LOADER_FATAL_ERROR_BIT)) {
+        loader_write_log_file_buffer();
+    }
+    loader_platform_thread_unlock_mutex(&log_file_output.lock);
+}
+
+void DECORATE_PRINTF(4, 5)
+    loader_log(const struct loader_instance *inst, VkFlags msg_type, int32_t msg_code, const char *format, ...) {
+    (void)msg_code;
+
+    // Always log to stderr if this is a fatal error
+    bool output_to_console = true;
+    if (0 == (msg_type & VULKAN_LOADER_FATAL_ERROR_BIT)) {
+        if (inst && inst->settings.settings_active && inst->settings.debug_level > 0) {
+            // Don't output if the current instance settings have some debugging options but do match the current msg_type
+            output_to_console = 0 != (msg_type & inst->settings.debug_level);
+            // Check the global settings and if that doesn't say to skip, check the environment variable
+        } else {
+            output_to_console = 0 != (msg_type & g_loader_debug);
+        }
+    }
+
+    VkDebugUtilsMessageSeverityFlagBitsEXT severity = 0;
+    VkDebugUtilsMessageTypeFlagsEXT type = 0;
+    bool output_to_callbacks = false;
+    if (inst) {
+        if ((msg_type & VULKAN_LOADER_INFO_BIT) != 0) {
+            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
+        } else if ((msg_type & VULKAN_LOADER_WARN_BIT) != 0) {
+            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT;
+        } else if ((msg_type & VULKAN_LOADER_ERROR_BIT) != 0) {
+            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+        } else if ((msg_type & VULKAN_LOADER_DEBUG_BIT) != 0) {
+            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT;
+        } else if ((msg_type & VULKAN_LOADER_LAYER_BIT) != 0 || (msg_type & VULKAN_LOADER_DRIVER_BIT) != 0) {
+            // Just driver or just layer bit should be treated as an info message in debug utils.
+            severity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
+        }
+
+        if ((msg_type & VULKAN_LOADER_PERF_BIT) != 0) {
+            type = VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+        } else if ((msg_type & VULKAN_LOADER_VALIDATION_BIT) != 0) {
+            // For loader logging, if it's a validation message, we still want to also keep the general flag as well
+            // so messages of type validation can still be triggered for general message callbacks.
+            type = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT;
+        } else {
+            type = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT;
+        }
+
+        output_to_callbacks = util_DebugUtilsMessageHasCallbacks(inst, severity, type);
+    }
+
+    // The structured log file has its own filter, so it may want messages which the console doesn't
+    bool output_to_log_file = 0 != log_file_output.active_level && loader_log_file_accepts(log_file_output.active_level, msg_type);
+
+    // Most messages are filtered out, so don't pay for formatting them unless something will consume the result
+    if (!output_to_console && !output_to_callbacks && !output_to_log_file) {
+        return;
+    }
+
+    char msg[512] = {0};
+
+    va_list ap;
+    va_start(ap, format);
+    int ret = vsnprintf(msg, sizeof(msg), format, ap);
+    if ((ret >= (int)sizeof(msg)) || ret < 0) {
+        msg[sizeof(msg) - 1] = '\0';
+    }
+    va_end(ap);
+
+    if (output_to_callbacks) {
+        VkDebugUtilsMessengerCallbackDataEXT callback_data = {0};
+        VkDebugUtilsObjectNameInfoEXT object_name = {0};
+
+        callback_data.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT;
+        callback_data.pMessageIdName = "Loader Message";
+        callback_data.pMessage = msg;
+        callback_data.objectCount = 1;
+        callback_data.pObjects = &object_name;
+        object_name.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT;
+        object_name.objectType = VK_OBJECT_TYPE_INSTANCE;
+        object_name.objectHandle = (uint64_t)(uintptr_t)inst;
+
+        util_SubmitDebugUtilsMessageEXT(inst, severity, type, &callback_data);
+    }
+
+    if (output_to_log_file) {
+        loader_write_log_file_record(inst, msg_type, msg);
+    }
+
+    if (!output_to_console) {
+        return;
+    }
+
+#if defined(DEBUG)
+    int debug_flag_mask =
+        msg_type & (VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_INFO_BIT | VULKAN_LOADER_DEBUG_BIT);
+    assert((debug_flag_mask == 0 || debug_flag_mask == VULKAN_LOADER_ERROR_BIT || debug_flag_mask == VULKAN_LOADER_WARN_BIT ||
+            debug_flag_mask == VULKAN_LOADER_INFO_BIT || debug_flag_mask == VULKAN_LOADER_DEBUG_BIT) &&
+           "This log has more than one exclusive debug flags (error, warn, info, debug) set");
+#endif
+
+    // Only need enough space to create the filter description header for log messages
+    // Also use the same header for all output
+    char cmd_line_msg[64] = {0};
+    generate_log_header(msg_type, sizeof(cmd_line_msg), cmd_line_msg);
+
+    if (loader_enqueue_async_log_output(msg_type, cmd_line_msg, msg)) {
+        return;
+    }
+    loader_log_output(msg_type, cmd_line_msg, msg);
+}
+
 void loader_log_asm_function_not_supported(const struct loader_instance *inst, VkFlags msg_type, int32_t msg_code,
                                            const char *func_name) {
     loader_log(inst, msg_type, msg_code, "Function %s not supported for this physical device", func_name);
@@ -51,9 +51,34 @@ enum vulkan_loader_debug_flags {
 // This should be called before any Vulkan API calls, eg in the initialization of the .dll or .so
 void loader_init_global_debug_level(void);
 
+// Parses a comma-separated list of debug options, as used by VK_LOADER_DEBUG, into enum vulkan_loader_debug_flags
+uint32_t loader_parse_debug_filter_string(const char *env);
+
 // Sets the global debug level - used by global settings files
 void loader_set_global_debug_level(uint32_t new_loader_debug);
 
+// Starts queueing console output for a background thread to write if VK_LOADER_LOG_ASYNC is set.
+// Release writes out everything still queued and stops the thread.
+void loader_init_async_log_output(void);
+void loader_release_async_log_output(void);
+
+// Writes out all messages queued by the asynchronous console output, if it is enabled
+void loader_flush_async_log_output(void);
+
+// Opens the structured log file given by VK_LOADER_LOG_FILE, if it is set, writing the messages VK_LOADER_LOG_FILE_LEVEL selects.
+// Release writes out everything still buffered and closes the file.
+void loader_init_log_file_output(void);
+void loader_release_log_file_output(void);
+
+// Switches the structured log file to the one given by the loader settings file, or closes it if path is NULL, and sets the
+// message types written to it to level, or to every message type if level is zero.
+// The path and the level are each left alone if VK_LOADER_LOG_FILE or VK_LOADER_LOG_FILE_LEVEL is set, as the environment
+// variables take precedence.
+void loader_set_log_file_from_settings(const char *path, uint32_t level);
+
+// Writes out all buffered records of the structured log file
+void loader_flush_log_file_output(void);
+
 // Writes a stringified version of enum vulkan_loader_debug_flags into a char array cmd_line_msg of length cmd_line_size
 void generate_debug_flag_str(VkFlags msg_type, size_t cmd_line_size, char *cmd_line_msg);
 
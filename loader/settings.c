@@ -35,6 +35,8 @@
 #include "stack_allocation.h"
 #include "vk_loader_platform.h"
 
+#include <time.h>
+
 loader_platform_thread_mutex global_loader_settings_lock;
 loader_settings global_loader_settings;
 
@@ -52,6 +54,7 @@ void free_loader_settings(const struct loader_instance* inst, loader_settings* s
     }
     loader_instance_heap_free(inst, settings->layer_configurations);
     loader_instance_heap_free(inst, settings->settings_file_path);
+    loader_instance_heap_free(inst, settings->log_file_path);
     memset(settings, 0, sizeof(loader_settings));
 }
 
@@ -208,7 +211,7 @@ out:
 }
 
 VkResult check_if_settings_path_exists(const struct loader_instance* inst, const char* base, const char* suffix,
-                                       char** settings_file_path) {
+                                       char** settings_file_path, loader_platform_file_info* file_info) {
     if (NULL == base || NULL == suffix) {
         return VK_ERROR_INITIALIZATION_FAILED;
     }
@@ -222,30 +225,56 @@ VkResult check_if_settings_path_exists(const struct loader_instance* inst, const
     loader_strncpy(*settings_file_path, path_len, base, base_len);
     loader_strncat(*settings_file_path, path_len, suffix, suffix_len);
 
-    if (!loader_platform_file_exists(*settings_file_path)) {
+    // The file info is what lets an unchanged settings file be skipped, but only a file which can be accessed is used
+    if (!loader_platform_file_exists(*settings_file_path) || !loader_platform_get_file_info(*settings_file_path, file_info)) {
         loader_instance_heap_free(inst, *settings_file_path);
         *settings_file_path = NULL;
         return VK_ERROR_INITIALIZATION_FAILED;
     }
     return VK_SUCCESS;
 }
-VkResult get_unix_settings_path(const struct loader_instance* inst, char** settings_file_path) {
-    VkResult res =
-        check_if_settings_path_exists(inst, loader_secure_getenv("HOME", inst),
-                                      "/.local/share/vulkan/loader_settings.d/" VK_LOADER_SETTINGS_FILENAME, settings_file_path);
+VkResult get_unix_settings_path(const struct loader_instance* inst, char** settings_file_path,
+                                loader_platform_file_info* file_info) {
+    VkResult res = check_if_settings_path_exists(inst, loader_secure_getenv("HOME", inst),
+                                                 "/.local/share/vulkan/loader_settings.d/" VK_LOADER_SETTINGS_FILENAME,
+                                                 settings_file_path, file_info);
     if (res == VK_SUCCESS) {
         return res;
     }
     // If HOME isn't set, fallback to XDG_DATA_HOME
     res = check_if_settings_path_exists(inst, loader_secure_getenv("XDG_DATA_HOME", inst),
-                                        "/vulkan/loader_settings.d/" VK_LOADER_SETTINGS_FILENAME, settings_file_path);
+                                        "/vulkan/loader_settings.d/" VK_LOADER_SETTINGS_FILENAME, settings_file_path, file_info);
     if (res == VK_SUCCESS) {
         return res;
     }
     // if XDG_DATA_HOME isn't set, fallback to /etc.
     // note that the settings_fil_path_suffix stays the same since its the same layout as for XDG_DATA_HOME
     return check_if_settings_path_exists(inst, "/etc", "/vulkan/loader_settings.d/" VK_LOADER_SETTINGS_FILENAME,
-                                         settings_file_path);
+                                         settings_file_path, file_info);
+}
+
+// Finds the location of the vk_loader_settings.json file and fills out file_info with its size, modification time, & id
+VkResult get_loader_settings_file_path(const struct loader_instance* inst, char** settings_file_path,
+                                       loader_platform_file_info* file_info) {
+    VkResult res = VK_SUCCESS;
+#if defined(WIN32)
+    res = windows_get_loader_settings_file_path(inst, settings_file_path);
+    if (res == VK_SUCCESS &&
+        (!loader_platform_file_exists(*settings_file_path) || !loader_platform_get_file_info(*settings_file_path, file_info))) {
+        loader_instance_heap_free(inst, *settings_file_path);
+        *settings_file_path = NULL;
+        res = VK_ERROR_INITIALIZATION_FAILED;
+    }
+#elif COMMON_UNIX_PLATFORMS
+    res = get_unix_settings_path(inst, settings_file_path, file_info);
+#else
+#warning "Unsupported platform - must specify platform specific location for vk_loader_settings.json"
+#endif
+    if (res != VK_SUCCESS) {
+        loader_log(inst, VULKAN_LOADER_INFO_BIT, 0,
+                   "No valid vk_loader_settings.json file found, no loader settings will be active");
+    }
+    return res;
 }
 
 bool check_if_settings_are_equal(loader_settings* a, loader_settings* b) {
@@ -256,6 +285,12 @@ bool check_if_settings_are_equal(loader_settings* a, loader_settings* b) {
     are_equal &= a->has_unordered_layer_location == b->has_unordered_layer_location;
     are_equal &= a->debug_level == b->debug_level;
     are_equal &= a->layer_configuration_count == b->layer_configuration_count;
+    if (a->log_file_path && b->log_file_path) {
+        are_equal &= 0 == strcmp(a->log_file_path, b->log_file_path);
+    } else {
+        are_equal &= a->log_file_path == b->log_file_path;
+    }
+    are_equal &= a->log_file_level == b->log_file_level;
     if (!are_equal) return false;
     for (uint32_t i = 0; i < a->layer_configuration_count && i < b->layer_configuration_count; i++) {
         if (a->layer_configurations[i].name && b->layer_configurations[i].name) {
@@ -289,6 +324,14 @@ void log_settings(const struct loader_instance* inst, loader_settings* settings)
     if (strlen(cmd_line_msg)) {
         loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "Loader Settings Filters for Logging to Standard Error: %s", cmd_line_msg);
     }
+    if (settings->log_file_path) {
+        loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "Loader Settings Log File: %s", settings->log_file_path);
+    }
+    cmd_line_msg[0] = '\0';
+    generate_debug_flag_str(settings->log_file_level, cmd_line_size, cmd_line_msg);
+    if (strlen(cmd_line_msg)) {
+        loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "Loader Settings Filters for Logging to the Log File: %s", cmd_line_msg);
+    }
 
     loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "Layer Configurations count = %d", settings->layer_configuration_count);
     for (uint32_t i = 0; i < settings->layer_configuration_count; i++) {
@@ -305,46 +348,68 @@ void log_settings(const struct loader_instance* inst, loader_settings* settings)
     loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0, "---------------------------------");
 }
 
-// Loads the vk_loader_settings.json file
-// Returns VK_SUCCESS if it was found & was successfully parsed. Otherwise, it returns VK_ERROR_INITIALIZATION_FAILED if it
-// wasn't found or failed to parse, and returns VK_ERROR_OUT_OF_HOST_MEMORY if it was unable to allocate enough memory.
-VkResult get_loader_settings(const struct loader_instance* inst, loader_settings* loader_settings) {
-    VkResult res = VK_SUCCESS;
-    cJSON* json = NULL;
-    char* file_format_version_string = NULL;
-    char* settings_file_path = NULL;
-#if defined(WIN32)
-    res = windows_get_loader_settings_file_path(inst, &settings_file_path);
-    if (res != VK_SUCCESS) {
-        loader_log(inst, VULKAN_LOADER_INFO_BIT, 0,
-                   "No valid vk_loader_settings.json file found, no loader settings will be active");
-        goto out;
+// Files modified this many seconds or less before they were read may be modified again without the modification time changing, as
+// file systems only update it with a coarse granularity (two seconds on FAT). Such files are always reparsed.
+#define LOADER_SETTINGS_FILE_MODIFICATION_WINDOW 2
+
+// The most recently read settings file. The parsed json is kept along with an index of the app_keys of every settings object, so
+// that picking the settings object which applies to the current executable is a single lookup. Guarded by
+// settings_file_cache_lock.
+typedef struct loader_settings_file_cache {
+    bool valid;  // whether file_info can be trusted to detect modifications of the file
+    bool indexed;
+    VkResult result;
+    char* settings_file_path;
+    loader_platform_file_info file_info;
+    cJSON* json;
+    // First settings object without app_keys
+    cJSON* global_settings;
+    // Same as global_settings, but only set if it comes before every settings object with app_keys
+    cJSON* global_settings_before_app_keys;
+    // Maps each app key to the first settings object that lists it
+    struct loader_string_map app_key_map;
+    // Whether global_loader_settings was last updated from the contents of this file
+    bool global_loader_settings_current;
+} loader_settings_file_cache;
+
+loader_platform_thread_mutex settings_file_cache_lock;
+loader_settings_file_cache settings_file_cache;
+
+void clear_loader_settings_file_cache(loader_settings_file_cache* cache) {
+    loader_free(NULL, cache->settings_file_path);
+    if (NULL != cache->json) {
+        loader_cJSON_Delete(cache->json);
     }
+    loader_destroy_string_map(NULL, &cache->app_key_map);
+    memset(cache, 0, sizeof(loader_settings_file_cache));
+}
 
-#elif COMMON_UNIX_PLATFORMS
-    res = get_unix_settings_path(inst, &settings_file_path);
-    if (res != VK_SUCCESS) {
-        loader_log(inst, VULKAN_LOADER_INFO_BIT, 0,
-                   "No valid vk_loader_settings.json file found, no loader settings will be active");
-        goto out;
-    }
-#else
-#warning "Unsupported platform - must specify platform specific location for vk_loader_settings.json"
-#endif
+bool check_if_settings_file_is_unchanged(const loader_settings_file_cache* cache, const char* settings_file_path,
+                                         const loader_platform_file_info* file_info) {
+    return cache->valid && NULL != cache->settings_file_path && 0 == strcmp(cache->settings_file_path, settings_file_path) &&
+           cache->file_info.size == file_info->size && cache->file_info.modification_time_sec == file_info->modification_time_sec &&
+           cache->file_info.modification_time_nsec == file_info->modification_time_nsec &&
+           cache->file_info.file_id == file_info->file_id;
+}
+
+// Parses the settings file and indexes every settings object in it by its app keys
+VkResult index_loader_settings_file(const struct loader_instance* inst, loader_settings_file_cache* cache) {
+    char* file_format_version_string = NULL;
 
-    res = loader_get_json(inst, settings_file_path, &json);
+    // The parsed file outlives any one instance, so it always uses the default allocator
+    VkResult res = loader_get_json(NULL, cache->settings_file_path, &cache->json);
     // Make sure sure the top level json value is an object
-    if (res != VK_SUCCESS || NULL == json || json->type != cJSON_Object) {
+    if (res != VK_SUCCESS || NULL == cache->json || cache->json->type != cJSON_Object) {
         goto out;
     }
 
-    res = loader_parse_json_string(json, "file_format_version", &file_format_version_string);
+    res = loader_parse_json_string(cache->json, "file_format_version", &file_format_version_string);
     if (res != VK_SUCCESS) {
         if (res != VK_ERROR_OUT_OF_HOST_MEMORY) {
             loader_log(
                 inst, VULKAN_LOADER_DEBUG_BIT, 0,
                 "Loader settings file from %s missing required field file_format_version - no loader settings will be active",
-                settings_file_path);
+                cache->settings_file_path);
         }
         goto out;
     }
@@ -353,8 +418,8 @@ VkResult get_loader_settings(const struct loader_instance* inst, loader_settings
     // can iterate on both cases with common code
     cJSON settings_iter_parent = {0};
 
-    cJSON* settings_array = loader_cJSON_GetObjectItem(json, "settings_array");
-    cJSON* single_settings_object = loader_cJSON_GetObjectItem(json, "settings");
+    cJSON* settings_array = loader_cJSON_GetObjectItem(cache->json, "settings_array");
+    cJSON* single_settings_object = loader_cJSON_GetObjectItem(cache->json, "settings");
     if (NULL != settings_array) {
         memcpy(&settings_iter_parent, settings_array, sizeof(cJSON));
     } else if (NULL != single_settings_object) {
@@ -363,65 +428,102 @@ VkResult get_loader_settings(const struct loader_instance* inst, loader_settings
         loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0,
                    "Loader settings file from %s missing required settings objects: Either one of the \"settings\" or "
                    "\"settings_array\" objects must be present - no loader settings will be active",
-                   settings_file_path);
+                   cache->settings_file_path);
         res = VK_ERROR_INITIALIZATION_FAILED;
         goto out;
     }
 
-    // Corresponds to the settings object that has no app keys
-    cJSON* global_settings = NULL;
-    // Corresponds to the settings object which has a matching app key
-    cJSON* settings_to_use = NULL;
-
-    char current_process_path[1024];
-    bool valid_exe_path = NULL != loader_platform_executable_path(current_process_path, 1024);
-
+    bool found_app_keys = false;
     cJSON* settings_object_iter = NULL;
     cJSON_ArrayForEach(settings_object_iter, &settings_iter_parent) {
         if (settings_object_iter->type != cJSON_Object) {
             loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0,
-                       "Loader settings file from %s has a settings element that is not an object", settings_file_path);
+                       "Loader settings file from %s has a settings element that is not an object", cache->settings_file_path);
             break;
         }
 
         cJSON* app_keys = loader_cJSON_GetObjectItem(settings_object_iter, "app_keys");
         if (NULL == app_keys) {
             // use the first 'global' settings that has no app keys as the global one
-            if (global_settings == NULL) {
-                global_settings = settings_object_iter;
+            if (cache->global_settings == NULL) {
+                cache->global_settings = settings_object_iter;
+                if (!found_app_keys) {
+                    cache->global_settings_before_app_keys = settings_object_iter;
+                }
             }
             continue;
         }
-        // No sense iterating if we couldn't get the executable path
-        if (!valid_exe_path) {
-            break;
-        }
+        found_app_keys = true;
+
+        // Earlier settings objects take precedence, which loader_string_map_insert guarantees by not replacing existing keys
         cJSON* app_key = NULL;
         cJSON_ArrayForEach(app_key, app_keys) {
             char* app_key_str = loader_cJSON_GetStringValue(app_key);
-            if (app_key_str && strcmp(current_process_path, app_key_str) == 0) {
-                settings_to_use = settings_object_iter;
-                break;
+            if (NULL != app_key_str) {
+                res = loader_string_map_insert(NULL, &cache->app_key_map, app_key_str, settings_object_iter);
+                if (res != VK_SUCCESS) {
+                    goto out;
+                }
             }
         }
+    }
+    cache->indexed = true;
 
-        // Break if we have found a matching current_process_path
-        if (NULL != settings_to_use) {
-            break;
-        }
+out:
+    loader_instance_heap_free(NULL, file_format_version_string);
+    return res;
+}
+
+// Make sure the settings file cache holds the contents of the settings file at settings_file_path, reading it only if it is a
+// different file than the cached one or was modified since then. Must be called with settings_file_cache_lock held.
+VkResult update_loader_settings_file_cache(const struct loader_instance* inst, const char* settings_file_path,
+                                           const loader_platform_file_info* file_info) {
+    if (check_if_settings_file_is_unchanged(&settings_file_cache, settings_file_path, file_info)) {
+        return settings_file_cache.result;
     }
+    clear_loader_settings_file_cache(&settings_file_cache);
 
-    // No app specific settings match - either use global settings or exit
-    if (settings_to_use == NULL) {
-        if (global_settings == NULL) {
-            loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0,
-                       "Loader settings file from %s missing global settings and none of the app specific settings matched the "
-                       "current application - no loader settings will be active",
-                       settings_file_path);
-            goto out;  // No global settings were found - exit
-        } else {
-            settings_to_use = global_settings;  // Global settings are present - use it
+    VkResult res = loader_copy_to_new_str(NULL, settings_file_path, &settings_file_cache.settings_file_path);
+    if (res != VK_SUCCESS) {
+        return res;
+    }
+    settings_file_cache.file_info = *file_info;
+    res = index_loader_settings_file(inst, &settings_file_cache);
+    if (res == VK_ERROR_OUT_OF_HOST_MEMORY) {
+        clear_loader_settings_file_cache(&settings_file_cache);
+        return res;
+    }
+    settings_file_cache.valid = (int64_t)time(NULL) - file_info->modification_time_sec > LOADER_SETTINGS_FILE_MODIFICATION_WINDOW;
+    settings_file_cache.result = res;
+    return res;
+}
+
+// Fills out loader_settings from the settings object in the cached settings file which applies to the current executable.
+// Must be called with settings_file_cache_lock held.
+VkResult get_loader_settings_from_cache(const struct loader_instance* inst, loader_settings* loader_settings) {
+    VkResult res = VK_SUCCESS;
+    if (!settings_file_cache.indexed) {
+        return res;
+    }
+
+    cJSON* settings_to_use = NULL;
+    char current_process_path[1024];
+    if (NULL != loader_platform_executable_path(current_process_path, 1024)) {
+        settings_to_use = loader_string_map_find(&settings_file_cache.app_key_map, current_process_path);
+        // No app specific settings match - use global settings
+        if (settings_to_use == NULL) {
+            settings_to_use = settings_file_cache.global_settings;
         }
+    } else {
+        // Without the executable path only the global settings which precede all app specific settings can be used
+        settings_to_use = settings_file_cache.global_settings_before_app_keys;
+    }
+    if (settings_to_use == NULL) {
+        loader_log(inst, VULKAN_LOADER_DEBUG_BIT, 0,
+                   "Loader settings file from %s missing global settings and none of the app specific settings matched the "
+                   "current application - no loader settings will be active",
+                   settings_file_cache.settings_file_path);
+        return res;
     }
 
     // optional
@@ -436,6 +538,27 @@ VkResult get_loader_settings(const struct loader_instance* inst, loader_settings
         free_string_list(inst, &stderr_log);
     }
 
+    // optional
+    if (NULL != loader_cJSON_GetObjectItem(settings_to_use, "log_file")) {
+        res = loader_parse_json_string(settings_to_use, "log_file", &loader_settings->log_file_path);
+        if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
+            goto out;
+        }
+        res = VK_SUCCESS;
+    }
+
+    // optional
+    if (NULL != loader_cJSON_GetObjectItem(settings_to_use, "log_file_level")) {
+        struct loader_string_list log_file_level = {0};
+        res = loader_parse_json_array_of_strings(inst, settings_to_use, "log_file_level", &log_file_level);
+        if (VK_ERROR_OUT_OF_HOST_MEMORY == res) {
+            goto out;
+        }
+        loader_settings->log_file_level = parse_log_filters_from_strings(&log_file_level);
+        free_string_list(inst, &log_file_level);
+        res = VK_SUCCESS;
+    }
+
     // optional
     cJSON* logs_to_use = loader_cJSON_GetObjectItem(settings_to_use, "log_locations");
     if (NULL != logs_to_use) {
@@ -471,25 +594,63 @@ VkResult get_loader_settings(const struct loader_instance* inst, loader_settings
         }
     }
 
-    loader_settings->settings_file_path = settings_file_path;
-    settings_file_path = NULL;
+    res = loader_copy_to_new_str(inst, settings_file_cache.settings_file_path, &loader_settings->settings_file_path);
+    if (res != VK_SUCCESS) {
+        goto out;
+    }
     loader_settings->settings_active = true;
 out:
-    if (NULL != json) {
-        loader_cJSON_Delete(json);
+    if (res != VK_SUCCESS) {
+        free_loader_settings(inst, loader_settings);
     }
+    return res;
+}
 
+// Loads the vk_loader_settings.json file
+// Returns VK_SUCCESS if it was found & was successfully parsed. Otherwise, it returns VK_ERROR_INITIALIZATION_FAILED if it
+// wasn't found or failed to parse, and returns VK_ERROR_OUT_OF_HOST_MEMORY if it was unable to allocate enough memory.
+VkResult get_loader_settings(const struct loader_instance* inst, loader_settings* loader_settings) {
+    char* settings_file_path = NULL;
+    loader_platform_file_info file_info = {0};
+    VkResult res = get_loader_settings_file_path(inst, &settings_file_path, &file_info);
+    if (res != VK_SUCCESS) {
+        return res;
+    }
+    loader_platform_thread_lock_mutex(&settings_file_cache_lock);
+    res = update_loader_settings_file_cache(inst, settings_file_path, &file_info);
+    if (res == VK_SUCCESS) {
+        res = get_loader_settings_from_cache(inst, loader_settings);
+    }
+    loader_platform_thread_unlock_mutex(&settings_file_cache_lock);
     loader_instance_heap_free(inst, settings_file_path);
-
-    loader_instance_heap_free(inst, file_format_version_string);
     return res;
 }
 
 TEST_FUNCTION_EXPORT VkResult update_global_loader_settings(void) {
     loader_settings settings = {0};
-    VkResult res = get_loader_settings(NULL, &settings);
-    loader_platform_thread_lock_mutex(&global_loader_settings_lock);
+    char* settings_file_path = NULL;
+    loader_platform_file_info file_info = {0};
+    VkResult res = get_loader_settings_file_path(NULL, &settings_file_path, &file_info);
 
+    loader_platform_thread_lock_mutex(&settings_file_cache_lock);
+    if (res == VK_SUCCESS) {
+        res = update_loader_settings_file_cache(NULL, settings_file_path, &file_info);
+        loader_free(NULL, settings_file_path);
+        // Nothing to do if the global settings were already made from the same, unmodified settings file
+        if (settings_file_cache.global_loader_settings_current) {
+            loader_platform_thread_unlock_mutex(&settings_file_cache_lock);
+            return res;
+        }
+        if (res == VK_SUCCESS) {
+            res = get_loader_settings_from_cache(NULL, &settings);
+        }
+        settings_file_cache.global_loader_settings_current = res != VK_ERROR_OUT_OF_HOST_MEMORY;
+    } else {
+        clear_loader_settings_file_cache(&settings_file_cache);
+    }
+    loader_platform_thread_unlock_mutex(&settings_file_cache_lock);
+
+    loader_platform_thread_lock_mutex(&global_loader_settings_lock);
     free_loader_settings(NULL, &global_loader_settings);
     if (res == VK_SUCCESS) {
         if (!check_if_settings_are_equal(&settings, &global_loader_settings)) {
@@ -501,17 +662,22 @@ TEST_FUNCTION_EXPORT VkResult update_global_loader_settings(void) {
             loader_set_global_debug_level(global_loader_settings.debug_level);
         }
     }
+    loader_set_log_file_from_settings(global_loader_settings.log_file_path, global_loader_settings.log_file_level);
     loader_platform_thread_unlock_mutex(&global_loader_settings_lock);
     return res;
 }
 
 void init_global_loader_settings(void) {
     loader_platform_thread_create_mutex(&global_loader_settings_lock);
+    loader_platform_thread_create_mutex(&settings_file_cache_lock);
     // Free out the global settings in case the process was loaded & unloaded
     free_loader_settings(NULL, &global_loader_settings);
+    clear_loader_settings_file_cache(&settings_file_cache);
 }
 void teardown_global_loader_settings(void) {
     free_loader_settings(NULL, &global_loader_settings);
+    clear_loader_settings_file_cache(&settings_file_cache);
+    loader_platform_thread_delete_mutex(&settings_file_cache_lock);
     loader_platform_thread_delete_mutex(&global_loader_settings_lock);
 }
 
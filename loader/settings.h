@@ -70,6 +70,11 @@ typedef struct loader_settings {
     loader_settings_layer_configuration* layer_configurations;
 
     char* settings_file_path;
+
+    // Path of the structured log file, only used from the global settings as the log file is shared by the whole process
+    char* log_file_path;
+    // Message types written to the structured log file, zero when the settings file doesn't specify them
+    enum vulkan_loader_debug_flags log_file_level;
 } loader_settings;
 
 // Call this function to get the current settings that the loader should use.
@@ -154,103 +154,337 @@ LOADER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDev
         return NULL;
     }
     // Return the dispatch table entrypoint for the fastest case
-    const VkLayerDispatchTable *disp_table = loader_get_dispatch(device);
+    VkLayerDispatchTable *disp_table = loader_get_dispatch(device);
     if (disp_table == NULL) return NULL;
 
     bool found_name = false;
     void *addr = loader_lookup_device_dispatch_table(disp_table, pName, &found_name);
-    if (found_name) return addr;
+    if (found_name) {
+        // Never hand out a resolve-on-first-call stub, the application must see the same NULL as with a fully populated table
+        if (loader_lazy_device_dispatch) addr = loader_resolve_lazy_device_stub(disp_table, addr);
+        // Entries of extensions which weren't enabled and of API versions newer than both the application's and the device's are
+        // left at vkDevExtError and never queried, so they are reported as NULL even when the driver exports them
+        if (addr == (void *)vkDevExtError) return NULL;
+        return addr;
+    }
 
     if (disp_table->GetDeviceProcAddr == NULL) return NULL;
     return disp_table->GetDeviceProcAddr(device, pName);
 }
 
-LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionProperties(const char *pLayerName,
-                                                                                    uint32_t *pPropertyCount,
-                                                                                    VkExtensionProperties *pProperties) {
-    LOADER_PLATFORM_THREAD_ONCE(&once_init, loader_initialize);
+// Pre-instance functions which implicit layers may intercept through the "pre_instance_functions" manifest field
+enum loader_pre_instance_function {
+    LOADER_PRE_INSTANCE_ENUMERATE_INSTANCE_EXTENSION_PROPERTIES = 0,
+    LOADER_PRE_INSTANCE_ENUMERATE_INSTANCE_LAYER_PROPERTIES,
+    LOADER_PRE_INSTANCE_ENUMERATE_INSTANCE_VERSION,
+    LOADER_PRE_INSTANCE_FUNCTION_COUNT,  // Not a real field, used for possible loop terminator
+};
+
+union loader_pre_instance_chain_link {
+    VkChainHeader header;
+    VkEnumerateInstanceExtensionPropertiesChain extension_properties;
+    VkEnumerateInstanceLayerPropertiesChain layer_properties;
+    VkEnumerateInstanceVersionChain version;
+};
+
+// A fully assembled pre-instance chain along with the layer libraries it uses. With VK_LOADER_CACHE_LAYER_LIBRARIES set, the chain
+// for each pre-instance function is kept around until the next vkDestroyInstance (or loader teardown) so repeated calls, and the
+// vkCreateInstance following them, don't need to open the layer libraries and assemble the chain again. Otherwise the chain and
+// its libraries are released as soon as the call using it returns.
+struct loader_pre_instance_chain {
+    uint32_t ref_count;
+
+    // Library & symbol name of every layer which exposes the function, used to check if the chain is still up to date
+    struct loader_string_list lib_names;
+    struct loader_string_list function_names;
+
+    // References to the layer library cache, NULL where the library failed to load
+    loader_platform_dl_handle *lib_handles;
+
+    uint32_t link_count;
+    union loader_pre_instance_chain_link *links;
+    union loader_pre_instance_chain_link tail;
+    union loader_pre_instance_chain_link *head;
+};
+
+struct loader_pre_instance_chain *pre_instance_chains[LOADER_PRE_INSTANCE_FUNCTION_COUNT];
+
+const char *loader_get_pre_instance_function_name(const struct loader_layer_properties *prop,
+                                                  enum loader_pre_instance_function function) {
+    switch (function) {
+        case LOADER_PRE_INSTANCE_ENUMERATE_INSTANCE_EXTENSION_PROPERTIES:
+            return prop->pre_instance_functions.enumerate_instance_extension_properties;
+        case LOADER_PRE_INSTANCE_ENUMERATE_INSTANCE_LAYER_PROPERTIES:
+            return prop->pre_instance_functions.enumerate_instance_layer_properties;
+        case LOADER_PRE_INSTANCE_ENUMERATE_INSTANCE_VERSION:
+            return prop->pre_instance_functions.enumerate_instance_version;
+        default:
+            return NULL;
+    }
+}
 
-    update_global_loader_settings();
+void loader_init_pre_instance_chain_link(union loader_pre_instance_chain_link *link, enum loader_pre_instance_function function,
+                                         void *pfn, const union loader_pre_instance_chain_link *next) {
+    memset(link, 0, sizeof(union loader_pre_instance_chain_link));
+    link->header.version = VK_CURRENT_CHAIN_VERSION;
+    switch (function) {
+        case LOADER_PRE_INSTANCE_ENUMERATE_INSTANCE_EXTENSION_PROPERTIES:
+            link->header.type = VK_CHAIN_TYPE_ENUMERATE_INSTANCE_EXTENSION_PROPERTIES;
+            link->header.size = sizeof(VkEnumerateInstanceExtensionPropertiesChain);
+            link->extension_properties.pfnNextLayer = pfn;
+            link->extension_properties.pNextLink = next ? &next->extension_properties : NULL;
+            break;
+        case LOADER_PRE_INSTANCE_ENUMERATE_INSTANCE_LAYER_PROPERTIES:
+            link->header.type = VK_CHAIN_TYPE_ENUMERATE_INSTANCE_LAYER_PROPERTIES;
+            link->header.size = sizeof(VkEnumerateInstanceLayerPropertiesChain);
+            link->layer_properties.pfnNextLayer = pfn;
+            link->layer_properties.pNextLink = next ? &next->layer_properties : NULL;
+            break;
+        case LOADER_PRE_INSTANCE_ENUMERATE_INSTANCE_VERSION:
+            link->header.type = VK_CHAIN_TYPE_ENUMERATE_INSTANCE_VERSION;
+            link->header.size = sizeof(VkEnumerateInstanceVersionChain);
+            link->version.pfnNextLayer = pfn;
+            link->version.pNextLink = next ? &next->version : NULL;
+            break;
+        default:
+            break;
+    }
+}
 
-    // We know we need to call at least the terminator
+void loader_destroy_pre_instance_chain(struct loader_pre_instance_chain *chain) {
+    if (NULL == chain) {
+        return;
+    }
+    if (NULL != chain->lib_handles) {
+        for (uint32_t i = 0; i < chain->lib_names.count; i++) {
+            if (NULL != chain->lib_handles[i] && !loader_release_cached_layer_library(chain->lib_handles[i])) {
+                loader_platform_close_library(chain->lib_handles[i]);
+            }
+        }
+    }
+    free_string_list(NULL, &chain->lib_names);
+    free_string_list(NULL, &chain->function_names);
+    loader_free(NULL, chain->lib_handles);
+    loader_free(NULL, chain->links);
+    loader_free(NULL, chain);
+}
+
+void loader_release_pre_instance_chain(struct loader_pre_instance_chain *chain) {
+    loader_platform_thread_lock_mutex(&loader_pre_instance_chain_lock);
+    bool destroy_chain = --chain->ref_count == 0;
+    loader_platform_thread_unlock_mutex(&loader_pre_instance_chain_lock);
+    if (destroy_chain) {
+        loader_destroy_pre_instance_chain(chain);
+    }
+}
+
+// Drop the cached pre-instance chains, releasing the layer libraries they hold once no caller is using them anymore
+void loader_clear_pre_instance_chains(void) {
+    for (uint32_t i = 0; i < LOADER_PRE_INSTANCE_FUNCTION_COUNT; i++) {
+        loader_platform_thread_lock_mutex(&loader_pre_instance_chain_lock);
+        struct loader_pre_instance_chain *chain = pre_instance_chains[i];
+        pre_instance_chains[i] = NULL;
+        loader_platform_thread_unlock_mutex(&loader_pre_instance_chain_lock);
+        if (NULL != chain) {
+            loader_release_pre_instance_chain(chain);
+        }
+    }
+}
+
+bool loader_pre_instance_chain_matches(const struct loader_pre_instance_chain *chain, enum loader_pre_instance_function function,
+                                       const struct loader_layer_list *layers) {
+    uint32_t index = 0;
+    for (uint32_t i = 0; i < layers->count; ++i) {
+        const char *function_name = loader_get_pre_instance_function_name(&layers->list[i], function);
+        if (NULL == function_name) {
+            continue;
+        }
+        if (index >= chain->lib_names.count || strcmp(chain->lib_names.list[index], layers->list[i].lib_name) != 0 ||
+            strcmp(chain->function_names.list[index], function_name) != 0) {
+            return false;
+        }
+        index++;
+    }
+    return index == chain->lib_names.count;
+}
+
+VkResult loader_create_pre_instance_chain(enum loader_pre_instance_function function, struct loader_layer_list *layers,
+                                          void *terminator, struct loader_pre_instance_chain **out_chain) {
     VkResult res = VK_SUCCESS;
-    VkEnumerateInstanceExtensionPropertiesChain chain_tail = {
-        .header =
-            {
-                .type = VK_CHAIN_TYPE_ENUMERATE_INSTANCE_EXTENSION_PROPERTIES,
-                .version = VK_CURRENT_CHAIN_VERSION,
-                .size = sizeof(chain_tail),
-            },
-        .pfnNextLayer = &terminator_pre_instance_EnumerateInstanceExtensionProperties,
-        .pNextLink = NULL,
-    };
-    VkEnumerateInstanceExtensionPropertiesChain *chain_head = &chain_tail;
+    uint32_t layer_count = 0;
+    for (uint32_t i = 0; i < layers->count; ++i) {
+        if (NULL != loader_get_pre_instance_function_name(&layers->list[i], function)) {
+            layer_count++;
+        }
+    }
 
-    // Get the implicit layers
-    struct loader_layer_list layers = {0};
-    memset(&layers, 0, sizeof(layers));
-    struct loader_envvar_all_filters layer_filters = {0};
+    struct loader_pre_instance_chain *chain =
+        loader_calloc(NULL, sizeof(struct loader_pre_instance_chain), VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == chain) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    loader_init_pre_instance_chain_link(&chain->tail, function, terminator, NULL);
+    chain->head = &chain->tail;
+    if (layer_count == 0) {
+        *out_chain = chain;
+        return VK_SUCCESS;
+    }
 
-    res = parse_layer_environment_var_filters(NULL, &layer_filters);
+    res = create_string_list(NULL, layer_count, &chain->lib_names);
     if (VK_SUCCESS != res) {
-        return res;
+        goto out;
     }
-
-    res = loader_scan_for_implicit_layers(NULL, &layers, &layer_filters);
+    res = create_string_list(NULL, layer_count, &chain->function_names);
     if (VK_SUCCESS != res) {
-        return res;
+        goto out;
+    }
+    chain->lib_handles = loader_calloc(NULL, sizeof(loader_platform_dl_handle) * layer_count, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    chain->links =
+        loader_calloc(NULL, sizeof(union loader_pre_instance_chain_link) * layer_count, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (NULL == chain->lib_handles || NULL == chain->links) {
+        res = VK_ERROR_OUT_OF_HOST_MEMORY;
+        goto out;
     }
 
     // Prepend layers onto the chain if they implement this entry point
-    for (uint32_t i = 0; i < layers.count; ++i) {
+    for (uint32_t i = 0; i < layers->count; ++i) {
+        struct loader_layer_properties *prop = &layers->list[i];
+        const char *function_name = loader_get_pre_instance_function_name(prop, function);
         // Skip this layer if it doesn't expose the entry-point
-        if (NULL == layers.list[i].pre_instance_functions.enumerate_instance_extension_properties) {
+        if (NULL == function_name) {
             continue;
         }
 
-        loader_open_layer_file(NULL, &layers.list[i]);
-        if (layers.list[i].lib_handle == NULL) {
+        uint32_t index = chain->lib_names.count;
+        res = copy_str_to_string_list(NULL, &chain->lib_names, prop->lib_name, strlen(prop->lib_name));
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+        res = copy_str_to_string_list(NULL, &chain->function_names, function_name, strlen(function_name));
+        if (VK_SUCCESS != res) {
+            goto out;
+        }
+
+        // The chain keeps the reference to the library, so the layer list must not close it
+        chain->lib_handles[index] = loader_open_cached_layer_file(NULL, prop);
+        prop->lib_handle = NULL;
+        if (chain->lib_handles[index] == NULL) {
             continue;
         }
 
-        void *pfn = loader_platform_get_proc_address(layers.list[i].lib_handle,
-                                                     layers.list[i].pre_instance_functions.enumerate_instance_extension_properties);
+        void *pfn = loader_platform_get_proc_address(chain->lib_handles[index], function_name);
         if (pfn == NULL) {
             loader_log(NULL, VULKAN_LOADER_WARN_BIT | VULKAN_LOADER_LAYER_BIT, 0,
-                       "%s: Unable to resolve symbol \"%s\" in implicit layer library \"%s\"", __FUNCTION__,
-                       layers.list[i].pre_instance_functions.enumerate_instance_extension_properties, layers.list[i].lib_name);
+                       "%s: Unable to resolve symbol \"%s\" in implicit layer library \"%s\"", __FUNCTION__, function_name,
+                       prop->lib_name);
             continue;
         }
 
-        VkEnumerateInstanceExtensionPropertiesChain *chain_link =
-            loader_alloc(NULL, sizeof(VkEnumerateInstanceExtensionPropertiesChain), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
-        if (chain_link == NULL) {
-            res = VK_ERROR_OUT_OF_HOST_MEMORY;
-            break;
+        union loader_pre_instance_chain_link *chain_link = &chain->links[chain->link_count++];
+        loader_init_pre_instance_chain_link(chain_link, function, pfn, chain->head);
+        chain->head = chain_link;
+    }
+
+out:
+    if (VK_SUCCESS != res) {
+        loader_destroy_pre_instance_chain(chain);
+        return res;
+    }
+    *out_chain = chain;
+    return VK_SUCCESS;
+}
+
+// Returns a reference to the chain for function built from the implicit layers in layers, reusing the cached chain if the same
+// layers still expose the function. Chains are only cached when layer library caching is enabled, as they keep their layer
+// libraries loaded. The reference must be released with loader_release_pre_instance_chain().
+VkResult loader_acquire_pre_instance_chain(enum loader_pre_instance_function function, struct loader_layer_list *layers,
+                                           void *terminator, struct loader_pre_instance_chain **out_chain) {
+    loader_platform_thread_lock_mutex(&loader_pre_instance_chain_lock);
+    struct loader_pre_instance_chain *cached_chain = pre_instance_chains[function];
+    if (NULL != cached_chain && loader_pre_instance_chain_matches(cached_chain, function, layers)) {
+        cached_chain->ref_count++;
+        uint32_t loaded_library_count = 0;
+        for (uint32_t i = 0; i < cached_chain->lib_names.count; i++) {
+            if (NULL != cached_chain->lib_handles[i]) {
+                loaded_library_count++;
+            }
         }
-        memset(chain_link, 0, sizeof(VkEnumerateInstanceLayerPropertiesChain));
-        chain_link->header.type = VK_CHAIN_TYPE_ENUMERATE_INSTANCE_EXTENSION_PROPERTIES;
-        chain_link->header.version = VK_CURRENT_CHAIN_VERSION;
-        chain_link->header.size = sizeof(*chain_link);
-        chain_link->pfnNextLayer = pfn;
-        chain_link->pNextLink = chain_head;
+        loader_platform_thread_unlock_mutex(&loader_pre_instance_chain_lock);
+        if (loaded_library_count > 0) {
+            uint32_t total = loader_add_avoided_layer_library_opens(loaded_library_count);
+            loader_log(NULL, VULKAN_LOADER_DEBUG_BIT | VULKAN_LOADER_LAYER_BIT, 0,
+                       "Reusing cached pre-instance chain, avoided opening %u layer libraries (%u layer library opens avoided so "
+                       "far)",
+                       loaded_library_count, total);
+        }
+        *out_chain = cached_chain;
+        return VK_SUCCESS;
+    }
+    loader_platform_thread_unlock_mutex(&loader_pre_instance_chain_lock);
 
-        chain_head = chain_link;
+    struct loader_pre_instance_chain *new_chain = NULL;
+    VkResult res = loader_create_pre_instance_chain(function, layers, terminator, &new_chain);
+    if (VK_SUCCESS != res) {
+        return res;
     }
 
-    // Call down the chain
-    if (res == VK_SUCCESS) {
-        res = chain_head->pfnNextLayer(chain_head->pNextLink, pLayerName, pPropertyCount, pProperties);
+    if (!loader_cache_layer_libraries) {
+        new_chain->ref_count = 1;
+        *out_chain = new_chain;
+        return VK_SUCCESS;
+    }
+
+    // One reference for the cache and one for the caller
+    new_chain->ref_count = 2;
+    loader_platform_thread_lock_mutex(&loader_pre_instance_chain_lock);
+    struct loader_pre_instance_chain *old_chain = pre_instance_chains[function];
+    pre_instance_chains[function] = new_chain;
+    loader_platform_thread_unlock_mutex(&loader_pre_instance_chain_lock);
+    if (NULL != old_chain) {
+        loader_release_pre_instance_chain(old_chain);
+    }
+    *out_chain = new_chain;
+    return VK_SUCCESS;
+}
+
+LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionProperties(const char *pLayerName,
+                                                                                    uint32_t *pPropertyCount,
+                                                                                    VkExtensionProperties *pProperties) {
+    LOADER_PLATFORM_THREAD_ONCE(&once_init, loader_initialize);
+
+    update_global_loader_settings();
+
+    VkResult res = VK_SUCCESS;
+
+    // Get the implicit layers
+    struct loader_layer_list layers = {0};
+    memset(&layers, 0, sizeof(layers));
+    struct loader_envvar_all_filters layer_filters = {0};
+
+    res = parse_layer_environment_var_filters(NULL, &layer_filters);
+    if (VK_SUCCESS != res) {
+        return res;
+    }
+
+    res = loader_scan_for_implicit_layers(NULL, &layers, &layer_filters);
+    free_layer_environment_var_filters(NULL, &layer_filters);
+    if (VK_SUCCESS != res) {
+        return res;
     }
 
+    // We know we need to call at least the terminator
+    struct loader_pre_instance_chain *chain = NULL;
+    res = loader_acquire_pre_instance_chain(LOADER_PRE_INSTANCE_ENUMERATE_INSTANCE_EXTENSION_PROPERTIES, &layers,
+                                            &terminator_pre_instance_EnumerateInstanceExtensionProperties, &chain);
+
     // Free up the layers
     loader_delete_layer_list_and_properties(NULL, &layers);
 
-    // Tear down the chain
-    while (chain_head != &chain_tail) {
-        VkEnumerateInstanceExtensionPropertiesChain *holder = chain_head;
-        chain_head = (VkEnumerateInstanceExtensionPropertiesChain *)chain_head->pNextLink;
-        loader_free(NULL, holder);
+    // Call down the chain
+    if (res == VK_SUCCESS) {
+        const VkEnumerateInstanceExtensionPropertiesChain *chain_head = &chain->head->extension_properties;
+        res = chain_head->pfnNextLayer(chain_head->pNextLink, pLayerName, pPropertyCount, pProperties);
+        loader_release_pre_instance_chain(chain);
     }
 
     return res;
@@ -262,19 +496,7 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceLayerProperties(
 
     update_global_loader_settings();
 
-    // We know we need to call at least the terminator
     VkResult res = VK_SUCCESS;
-    VkEnumerateInstanceLayerPropertiesChain chain_tail = {
-        .header =
-            {
-                .type = VK_CHAIN_TYPE_ENUMERATE_INSTANCE_LAYER_PROPERTIES,
-                .version = VK_CURRENT_CHAIN_VERSION,
-                .size = sizeof(chain_tail),
-            },
-        .pfnNextLayer = &terminator_pre_instance_EnumerateInstanceLayerProperties,
-        .pNextLink = NULL,
-    };
-    VkEnumerateInstanceLayerPropertiesChain *chain_head = &chain_tail;
 
     // Get the implicit layers
     struct loader_layer_list layers;
@@ -287,60 +509,24 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceLayerProperties(
     }
 
     res = loader_scan_for_implicit_layers(NULL, &layers, &layer_filters);
+    free_layer_environment_var_filters(NULL, &layer_filters);
     if (VK_SUCCESS != res) {
         return res;
     }
 
-    // Prepend layers onto the chain if they implement this entry point
-    for (uint32_t i = 0; i < layers.count; ++i) {
-        // Skip this layer if it doesn't expose the entry-point
-        if (NULL == layers.list[i].pre_instance_functions.enumerate_instance_layer_properties) {
-            continue;
-        }
-
-        loader_open_layer_file(NULL, &layers.list[i]);
-        if (layers.list[i].lib_handle == NULL) {
-            continue;
-        }
-
-        void *pfn = loader_platform_get_proc_address(layers.list[i].lib_handle,
-                                                     layers.list[i].pre_instance_functions.enumerate_instance_layer_properties);
-        if (pfn == NULL) {
-            loader_log(NULL, VULKAN_LOADER_WARN_BIT, 0, "%s: Unable to resolve symbol \"%s\" in implicit layer library \"%s\"",
-                       __FUNCTION__, layers.list[i].pre_instance_functions.enumerate_instance_layer_properties,
-                       layers.list[i].lib_name);
-            continue;
-        }
-
-        VkEnumerateInstanceLayerPropertiesChain *chain_link =
-            loader_alloc(NULL, sizeof(VkEnumerateInstanceLayerPropertiesChain), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
-        if (chain_link == NULL) {
-            res = VK_ERROR_OUT_OF_HOST_MEMORY;
-            break;
-        }
-        memset(chain_link, 0, sizeof(VkEnumerateInstanceLayerPropertiesChain));
-        chain_link->header.type = VK_CHAIN_TYPE_ENUMERATE_INSTANCE_LAYER_PROPERTIES;
-        chain_link->header.version = VK_CURRENT_CHAIN_VERSION;
-        chain_link->header.size = sizeof(*chain_link);
-        chain_link->pfnNextLayer = pfn;
-        chain_link->pNextLink = chain_head;
+    // We know we need to call at least the terminator
+    struct loader_pre_instance_chain *chain = NULL;
+    res = loader_acquire_pre_instance_chain(LOADER_PRE_INSTANCE_ENUMERATE_INSTANCE_LAYER_PROPERTIES, &layers,
+                                            &terminator_pre_instance_EnumerateInstanceLayerProperties, &chain);
 
-        chain_head = chain_link;
-    }
+    // Free up the layers
+    loader_delete_layer_list_and_properties(NULL, &layers);
 
     // Call down the chain
     if (res == VK_SUCCESS) {
+        const VkEnumerateInstanceLayerPropertiesChain *chain_head = &chain->head->layer_properties;
         res = chain_head->pfnNextLayer(chain_head->pNextLink, pPropertyCount, pProperties);
-    }
-
-    // Free up the layers
-    loader_delete_layer_list_and_properties(NULL, &layers);
-
-    // Tear down the chain
-    while (chain_head != &chain_tail) {
-        VkEnumerateInstanceLayerPropertiesChain *holder = chain_head;
-        chain_head = (VkEnumerateInstanceLayerPropertiesChain *)chain_head->pNextLink;
-        loader_free(NULL, holder);
+        loader_release_pre_instance_chain(chain);
     }
 
     return res;
@@ -359,19 +545,7 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceVersion(uint32_t
         return VK_ERROR_OUT_OF_HOST_MEMORY;
     }
 
-    // We know we need to call at least the terminator
     VkResult res = VK_SUCCESS;
-    VkEnumerateInstanceVersionChain chain_tail = {
-        .header =
-            {
-                .type = VK_CHAIN_TYPE_ENUMERATE_INSTANCE_VERSION,
-                .version = VK_CURRENT_CHAIN_VERSION,
-                .size = sizeof(chain_tail),
-            },
-        .pfnNextLayer = &terminator_pre_instance_EnumerateInstanceVersion,
-        .pNextLink = NULL,
-    };
-    VkEnumerateInstanceVersionChain *chain_head = &chain_tail;
 
     // Get the implicit layers
     struct loader_layer_list layers;
@@ -384,59 +558,24 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceVersion(uint32_t
     }
 
     res = loader_scan_for_implicit_layers(NULL, &layers, &layer_filters);
+    free_layer_environment_var_filters(NULL, &layer_filters);
     if (VK_SUCCESS != res) {
         return res;
     }
 
-    // Prepend layers onto the chain if they implement this entry point
-    for (uint32_t i = 0; i < layers.count; ++i) {
-        // Skip this layer if it doesn't expose the entry-point
-        if (NULL == layers.list[i].pre_instance_functions.enumerate_instance_version) {
-            continue;
-        }
-
-        loader_open_layer_file(NULL, &layers.list[i]);
-        if (layers.list[i].lib_handle == NULL) {
-            continue;
-        }
-
-        void *pfn = loader_platform_get_proc_address(layers.list[i].lib_handle,
-                                                     layers.list[i].pre_instance_functions.enumerate_instance_version);
-        if (pfn == NULL) {
-            loader_log(NULL, VULKAN_LOADER_WARN_BIT, 0, "%s: Unable to resolve symbol \"%s\" in implicit layer library \"%s\"",
-                       __FUNCTION__, layers.list[i].pre_instance_functions.enumerate_instance_version, layers.list[i].lib_name);
-            continue;
-        }
-
-        VkEnumerateInstanceVersionChain *chain_link =
-            loader_alloc(NULL, sizeof(VkEnumerateInstanceVersionChain), VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
-        if (chain_link == NULL) {
-            res = VK_ERROR_OUT_OF_HOST_MEMORY;
-            break;
-        }
-        memset(chain_link, 0, sizeof(VkEnumerateInstanceLayerPropertiesChain));
-        chain_link->header.type = VK_CHAIN_TYPE_ENUMERATE_INSTANCE_VERSION;
-        chain_link->header.version = VK_CURRENT_CHAIN_VERSION;
-        chain_link->header.size = sizeof(*chain_link);
-        chain_link->pfnNextLayer = pfn;
-        chain_link->pNextLink = chain_head;
+    // We know we need to call at least the terminator
+    struct loader_pre_instance_chain *chain = NULL;
+    res = loader_acquire_pre_instance_chain(LOADER_PRE_INSTANCE_ENUMERATE_INSTANCE_VERSION, &layers,
+                                            &terminator_pre_instance_EnumerateInstanceVersion, &chain);
 
-        chain_head = chain_link;
-    }
+    // Free up the layers
+    loader_delete_layer_list_and_properties(NULL, &layers);
 
     // Call down the chain
     if (res == VK_SUCCESS) {
+        const VkEnumerateInstanceVersionChain *chain_head = &chain->head->version;
         res = chain_head->pfnNextLayer(chain_head->pNextLink, pApiVersion);
-    }
-
-    // Free up the layers
-    loader_delete_layer_list_and_properties(NULL, &layers);
-
-    // Tear down the chain
-    while (chain_head != &chain_tail) {
-        VkEnumerateInstanceVersionChain *holder = chain_head;
-        chain_head = (VkEnumerateInstanceVersionChain *)chain_head->pNextLink;
-        loader_free(NULL, holder);
+        loader_release_pre_instance_chain(chain);
     }
 
     return res;
@@ -461,6 +600,7 @@ void loader_add_instance_only_debug_funcs(struct loader_instance *ptr_instance)
             cur_node = cur_node->pNext;
         }
     }
+    util_UpdateDebugCallbackMasks(ptr_instance);
 }
 
 // Remove the "instance-only" debug functions from the list of active debug functions.
@@ -479,6 +619,7 @@ void loader_remove_instance_only_debug_funcs(struct loader_instance *ptr_instanc
         }
         cur_node = cur_node->pNext;
     }
+    util_UpdateDebugCallbackMasks(ptr_instance);
 }
 
 LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCreateInfo *pCreateInfo,
@@ -511,6 +652,8 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
         res = VK_ERROR_OUT_OF_HOST_MEMORY;
         goto out;
     }
+    loader_platform_thread_create_mutex(&ptr_instance->surfaces_lock);
+    loader_platform_thread_create_recursive_mutex(&ptr_instance->debug_callbacks_lock);
 
     loader_platform_thread_lock_mutex(&loader_lock);
     if (pAllocator) {
@@ -518,6 +661,11 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
     }
     ptr_instance->magic = LOADER_MAGIC_NUMBER;
 
+    res = loader_create_instance_arena(ptr_instance);
+    if (VK_SUCCESS != res) {
+        goto out;
+    }
+
     // Save the application version
     if (NULL == pCreateInfo->pApplicationInfo || 0 == pCreateInfo->pApplicationInfo->apiVersion) {
         ptr_instance->app_api_version = LOADER_VERSION_1_0_0;
@@ -664,8 +812,7 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
         goto out;
     }
 
-    ptr_instance->disp = loader_instance_heap_alloc(ptr_instance, sizeof(struct loader_instance_dispatch_table),
-                                                    VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    ptr_instance->disp = loader_instance_heap_calloc_long_lived(ptr_instance, sizeof(struct loader_instance_dispatch_table));
     if (ptr_instance->disp == NULL) {
         loader_log(ptr_instance, VULKAN_LOADER_ERROR_BIT, 0,
                    "vkCreateInstance:  Failed to allocate Loader's full Instance dispatch table.");
@@ -715,6 +862,8 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
 out:
 
     if (NULL != ptr_instance) {
+        free_layer_environment_var_filters(ptr_instance, &layer_filters);
+
         if (res != VK_SUCCESS) {
             loader_platform_thread_lock_mutex(&loader_global_instance_list_lock);
             // error path, should clean everything up
@@ -750,7 +899,7 @@ out:
                 // our way back out of it.
                 if (icd_term->instance) {
                     loader_icd_close_objects(ptr_instance, icd_term);
-                    icd_term->dispatch.DestroyInstance(icd_term->instance, pAllocator);
+                    ICD_DISPATCH(icd_term, DestroyInstance)(icd_term->instance, pAllocator);
                 }
                 icd_term->instance = VK_NULL_HANDLE;
                 ptr_instance->icd_terms = icd_term->next;
@@ -759,13 +908,23 @@ out:
 
             free_string_list(ptr_instance, &ptr_instance->enabled_layer_names);
 
+            loader_platform_thread_delete_mutex(&ptr_instance->debug_callbacks_lock);
+            loader_platform_thread_delete_mutex(&ptr_instance->surfaces_lock);
+            loader_destroy_instance_arena(ptr_instance);
             loader_instance_heap_free(ptr_instance, ptr_instance);
         } else {
             // success path, swap out created debug callbacks out so they aren't used until instance destruction
             loader_remove_instance_only_debug_funcs(ptr_instance);
+
+            // Anything allocated from here on may be freed and reallocated many times, so it comes from the heap
+            loader_close_instance_arena(ptr_instance);
         }
         // Only unlock when ptr_instance isn't NULL, as if it is, the above code didn't make it to when loader_lock was locked.
         loader_platform_thread_unlock_mutex(&loader_lock);
+
+        if (res != VK_SUCCESS) {
+            loader_unload_unpinned_layer_libraries();
+        }
     }
 
     return res;
@@ -825,12 +984,25 @@ LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(VkInstance instance,
     destroy_debug_callbacks_chain(ptr_instance, pAllocator);
 
     loader_instance_heap_free(ptr_instance, ptr_instance->disp);
+    loader_platform_thread_delete_mutex(&ptr_instance->debug_callbacks_lock);
+    loader_platform_thread_delete_mutex(&ptr_instance->surfaces_lock);
+    loader_destroy_instance_arena(ptr_instance);
     loader_instance_heap_free(ptr_instance, ptr_instance);
     loader_platform_thread_unlock_mutex(&loader_lock);
 
     // Unload preloaded layers, so if vkEnumerateInstanceExtensionProperties or vkCreateInstance is called again, the ICD's are
     // up to date
     loader_unload_preloaded_icds();
+
+    // Likewise drop the cached pre-instance chains so the next pre-instance call picks up any change to the implicit layers
+    loader_clear_pre_instance_chains();
+
+    // With the last instance gone, nothing but a pinned cache keeps the layer libraries loaded
+    loader_unload_unpinned_layer_libraries();
+
+    // Make sure everything logged about this instance has been written out by the time it is destroyed
+    loader_flush_async_log_output();
+    loader_flush_log_file_output();
 }
 
 LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumeratePhysicalDevices(VkInstance instance, uint32_t *pPhysicalDeviceCount,
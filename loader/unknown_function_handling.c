@@ -72,39 +72,21 @@ void *loader_get_phys_dev_ext_termin(uint32_t index);
 
 // Device function handling
 
-// Initialize device_ext dispatch table entry as follows:
-// If dev == NULL find all logical devices created within this instance and
-//  init the entry (given by idx) in the ext dispatch table.
-// If dev != NULL only initialize the entry in the given dev's dispatch table.
-// The initialization value is gotten by calling down the device chain with
-// GDPA.
+// Initialize the device_ext dispatch table entries of dev for every function name registered since the last time this was called
+// for dev. The names in dev_ext_disp_functions are only ever appended, so dev->dev_ext_generation (the number of names which were
+// already looked up for dev) is all that is needed to tell which entries are missing.
+// The initialization value is gotten by calling down the device chain with GDPA.
 // If GDPA returns NULL then don't initialize the dispatch table entry.
-void loader_init_dispatch_dev_ext_entry(struct loader_instance *inst, struct loader_device *dev, uint32_t idx, const char *funcName)
-
-{
-    void *gdpa_value;
-    if (dev != NULL) {
-        gdpa_value = dev->loader_dispatch.core_dispatch.GetDeviceProcAddr(dev->chain_device, funcName);
-        if (gdpa_value != NULL) dev->loader_dispatch.ext_dispatch[idx] = (PFN_vkDevExt)gdpa_value;
-    } else {
-        for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-            struct loader_device *ldev = icd_term->logical_device_list;
-            while (ldev) {
-                gdpa_value = ldev->loader_dispatch.core_dispatch.GetDeviceProcAddr(ldev->chain_device, funcName);
-                if (gdpa_value != NULL) ldev->loader_dispatch.ext_dispatch[idx] = (PFN_vkDevExt)gdpa_value;
-                ldev = ldev->next;
-            }
-        }
-    }
-}
-
-// Find all dev extension in the function names array  and initialize the dispatch table
-// for dev  for each of those extension entrypoints found in function names array.
 void loader_init_dispatch_dev_ext(struct loader_instance *inst, struct loader_device *dev) {
-    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) {
-        if (inst->dev_ext_disp_functions[i] != NULL)
-            loader_init_dispatch_dev_ext_entry(inst, dev, i, inst->dev_ext_disp_functions[i]);
+    // The device chain hasn't been created yet, vkCreateDevice calls this again once it is
+    if (NULL == dev->loader_dispatch.core_dispatch.GetDeviceProcAddr) {
+        return;
+    }
+    for (uint32_t i = dev->dev_ext_generation; i < inst->dev_ext_disp_function_count; i++) {
+        void *gdpa_value = dev->loader_dispatch.core_dispatch.GetDeviceProcAddr(dev->chain_device, inst->dev_ext_disp_functions[i]);
+        if (gdpa_value != NULL) dev->loader_dispatch.ext_dispatch[i] = (PFN_vkDevExt)gdpa_value;
     }
+    dev->dev_ext_generation = inst->dev_ext_disp_function_count;
 }
 
 bool loader_check_icds_for_dev_ext_address(struct loader_instance *inst, const char *funcName) {
@@ -203,10 +185,15 @@ void *loader_dev_ext_gpa_impl(struct loader_instance *inst, const char *funcName
         return NULL;
     }
     loader_strncpy(inst->dev_ext_disp_functions[inst->dev_ext_disp_function_count], funcName_len, funcName, funcName_len);
-    // init any dev dispatch table entries as needed
-    loader_init_dispatch_dev_ext_entry(inst, NULL, inst->dev_ext_disp_function_count, funcName);
     void *out_function = loader_get_dev_ext_trampoline(inst->dev_ext_disp_function_count);
     inst->dev_ext_disp_function_count++;
+    // init the new entry in the dispatch table of every device created within this instance, only the new name is looked up as
+    // every other registered name was already handled when the device was created or when that name was added
+    for (struct loader_icd_term *icd_term = inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
+        for (struct loader_device *ldev = icd_term->logical_device_list; ldev != NULL; ldev = ldev->next) {
+            loader_init_dispatch_dev_ext(inst, ldev);
+        }
+    }
     return out_function;
 }
 
@@ -52,11 +52,16 @@
 
 #if COMMON_UNIX_PLATFORMS
 #include <unistd.h>
+#include <sys/stat.h>
 // Note: The following file is for dynamic loading:
 #include <dlfcn.h>
 #include <pthread.h>
 #include <stdlib.h>
 #include <libgen.h>
+#include <time.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 
 #elif defined(_WIN32)
 // WinBase.h defines CreateSemaphore and synchapi.h defines CreateEvent
@@ -139,6 +144,14 @@
 #define LAYERS_PATH_ENV "VK_LAYER_PATH"
 #define ENABLED_LAYERS_ENV "VK_INSTANCE_LAYERS"
 
+// Identity of a file on disk - used to tell whether a file was modified since it was last read without having to open it.
+typedef struct loader_platform_file_info {
+    uint64_t size;
+    int64_t modification_time_sec;
+    int64_t modification_time_nsec;
+    uint64_t file_id;
+} loader_platform_file_info;
+
 #if COMMON_UNIX_PLATFORMS
 /* Linux-specific common code: */
 
@@ -285,6 +298,26 @@ static inline bool loader_platform_file_exists(const char *path) {
         return true;
 }
 
+// Fills out file_info with the size, modification time, and inode of the file at path. Returns false if the file doesn't exist.
+static inline bool loader_platform_get_file_info(const char *path, loader_platform_file_info *file_info) {
+    struct stat path_stat;
+    if (0 != stat(path, &path_stat)) {
+        return false;
+    }
+    file_info->size = (uint64_t)path_stat.st_size;
+    file_info->modification_time_sec = (int64_t)path_stat.st_mtime;
+#if defined(__APPLE__)
+    file_info->modification_time_nsec = (int64_t)path_stat.st_mtimespec.tv_nsec;
+#elif defined(__linux__) || defined(__Fuchsia__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__) || \
+    defined(__DragonFly__) || defined(__GNU__)
+    file_info->modification_time_nsec = (int64_t)path_stat.st_mtim.tv_nsec;
+#else
+    file_info->modification_time_nsec = 0;
+#endif
+    file_info->file_id = (uint64_t)path_stat.st_ino;
+    return true;
+}
+
 // Returns true if the given string appears to be a relative or absolute
 // path, as opposed to a bare filename.
 static inline bool loader_platform_is_path_absolute(const char *path) {
@@ -453,6 +486,48 @@ static inline void loader_platform_thread_create_mutex(loader_platform_thread_mu
 static inline void loader_platform_thread_lock_mutex(loader_platform_thread_mutex *pMutex) { pthread_mutex_lock(pMutex); }
 static inline void loader_platform_thread_unlock_mutex(loader_platform_thread_mutex *pMutex) { pthread_mutex_unlock(pMutex); }
 static inline void loader_platform_thread_delete_mutex(loader_platform_thread_mutex *pMutex) { pthread_mutex_destroy(pMutex); }
+// A mutex which may be locked again by the thread already holding it
+static inline void loader_platform_thread_create_recursive_mutex(loader_platform_thread_mutex *pMutex) {
+    pthread_mutexattr_t attributes;
+    pthread_mutexattr_init(&attributes);
+    pthread_mutexattr_settype(&attributes, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(pMutex, &attributes);
+    pthread_mutexattr_destroy(&attributes);
+}
+
+// Thread condition variables:
+static inline void loader_platform_thread_create_cond(loader_platform_thread_cond *pCond) { pthread_cond_init(pCond, NULL); }
+static inline void loader_platform_thread_cond_wait(loader_platform_thread_cond *pCond, loader_platform_thread_mutex *pMutex) {
+    pthread_cond_wait(pCond, pMutex);
+}
+static inline void loader_platform_thread_cond_broadcast(loader_platform_thread_cond *pCond) { pthread_cond_broadcast(pCond); }
+static inline void loader_platform_thread_delete_cond(loader_platform_thread_cond *pCond) { pthread_cond_destroy(pCond); }
+
+// Threads:
+static inline bool loader_platform_thread_create(loader_platform_thread *pThread, void *(*func)(void *), void *arg) {
+    return 0 == pthread_create(pThread, NULL, func, arg);
+}
+static inline void loader_platform_thread_join(loader_platform_thread thread) { pthread_join(thread, NULL); }
+
+// Nanoseconds from an arbitrary starting point, unaffected by changes to the system clock
+static inline uint64_t loader_platform_get_monotonic_time_ns(void) {
+    struct timespec time = {0};
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (uint64_t)time.tv_sec * 1000000000ULL + (uint64_t)time.tv_nsec;
+}
+
+// Numeric id of the calling thread, matching the one shown by debuggers and system tools where possible
+static inline uint64_t loader_platform_get_thread_id(void) {
+#if defined(__linux__)
+    return (uint64_t)syscall(SYS_gettid);
+#elif defined(__APPLE__)
+    uint64_t thread_id = 0;
+    pthread_threadid_np(NULL, &thread_id);
+    return thread_id;
+#else
+    return (uint64_t)(uintptr_t)pthread_self();
+#endif
+}
 
 static inline void *thread_safe_strtok(char *str, const char *delim, char **saveptr) { return strtok_r(str, delim, saveptr); }
 
@@ -523,6 +598,32 @@ static inline bool loader_platform_file_exists(const char *path) {
         return true;
 }
 
+// Fills out file_info with the size and last write time of the file at path. Returns false if the file doesn't exist.
+// Windows has no inode equivalent available without opening the file, so file_id is always zero.
+static inline bool loader_platform_get_file_info(const char *path, loader_platform_file_info *file_info) {
+    int path_utf16_size = MultiByteToWideChar(CP_UTF8, 0, path, -1, NULL, 0);
+    if (path_utf16_size <= 0) {
+        return false;
+    }
+    wchar_t *path_utf16 = (wchar_t *)loader_stack_alloc(path_utf16_size * sizeof(wchar_t));
+    if (MultiByteToWideChar(CP_UTF8, 0, path, -1, path_utf16, path_utf16_size) != path_utf16_size) {
+        return false;
+    }
+    WIN32_FILE_ATTRIBUTE_DATA attribute_data;
+    if (!GetFileAttributesExW(path_utf16, GetFileExInfoStandard, &attribute_data)) {
+        return false;
+    }
+    // FILETIME is in 100 nanosecond intervals since January 1, 1601 - convert it to the unix epoch
+    uint64_t write_time =
+        ((uint64_t)attribute_data.ftLastWriteTime.dwHighDateTime << 32) | (uint64_t)attribute_data.ftLastWriteTime.dwLowDateTime;
+    write_time -= 116444736000000000ULL;
+    file_info->size = ((uint64_t)attribute_data.nFileSizeHigh << 32) | (uint64_t)attribute_data.nFileSizeLow;
+    file_info->modification_time_sec = (int64_t)(write_time / 10000000ULL);
+    file_info->modification_time_nsec = (int64_t)(write_time % 10000000ULL) * 100;
+    file_info->file_id = 0;
+    return true;
+}
+
 // Returns true if the given string appears to be a relative or absolute
 // path, as opposed to a bare filename.
 static inline bool loader_platform_is_path_absolute(const char *path) {
@@ -619,6 +720,25 @@ static inline void loader_platform_thread_create_mutex(loader_platform_thread_mu
 static inline void loader_platform_thread_lock_mutex(loader_platform_thread_mutex *pMutex) { EnterCriticalSection(pMutex); }
 static inline void loader_platform_thread_unlock_mutex(loader_platform_thread_mutex *pMutex) { LeaveCriticalSection(pMutex); }
 static inline void loader_platform_thread_delete_mutex(loader_platform_thread_mutex *pMutex) { DeleteCriticalSection(pMutex); }
+// Critical sections can always be locked again by the thread already holding them
+static inline void loader_platform_thread_create_recursive_mutex(loader_platform_thread_mutex *pMutex) {
+    InitializeCriticalSection(pMutex);
+}
+
+// Nanoseconds from an arbitrary starting point, unaffected by changes to the system clock
+static inline uint64_t loader_platform_get_monotonic_time_ns(void) {
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    // Split the conversion to avoid overflowing when the counter is large
+    uint64_t seconds = (uint64_t)(counter.QuadPart / frequency.QuadPart);
+    uint64_t remainder = (uint64_t)(counter.QuadPart % frequency.QuadPart);
+    return seconds * 1000000000ULL + remainder * 1000000000ULL / (uint64_t)frequency.QuadPart;
+}
+
+// Numeric id of the calling thread, matching the one shown by debuggers and system tools
+static inline uint64_t loader_platform_get_thread_id(void) { return (uint64_t)GetCurrentThreadId(); }
 
 static inline void *thread_safe_strtok(char *str, const char *delimiters, char **context) {
     return strtok_s(str, delimiters, context);
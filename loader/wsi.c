@@ -188,27 +188,37 @@ LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroySurfaceKHR(VkInstance instance
 }
 
 // This is the instance chain terminator function for DestroySurfaceKHR
+// Destroys the surfaces drivers made for icd_surface, must be called with surfaces_lock held
+void wsi_destroy_icd_surfaces(struct loader_instance *loader_inst, const VkIcdSurface *icd_surface,
+                              const VkAllocationCallbacks *pAllocator) {
+    for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
+        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
+            // Drivers which were never asked about this surface didn't create it
+            if (NULL != ICD_DISPATCH(icd_term, DestroySurfaceKHR) && NULL != icd_term->surface_list.list &&
+                icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR) &&
+                icd_term->surface_list.list[icd_surface->surface_index]) {
+                ICD_DISPATCH(icd_term, DestroySurfaceKHR)(icd_term->instance,
+                                                          icd_term->surface_list.list[icd_surface->surface_index], pAllocator);
+                icd_term->surface_list.list[icd_surface->surface_index] = (VkSurfaceKHR)(uintptr_t)NULL;
+            }
+        } else {
+            // ICDs not supporting the proper interface version never get a
+            // surface list.  If they have one, then we have a problem.
+            assert(NULL == icd_term->surface_list.list);
+        }
+    }
+}
+
 VKAPI_ATTR void VKAPI_CALL terminator_DestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface,
                                                         const VkAllocationCallbacks *pAllocator) {
     struct loader_instance *loader_inst = loader_get_instance(instance);
 
     VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)(surface);
     if (NULL != icd_surface) {
-        for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-            if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-                if (NULL != icd_term->dispatch.DestroySurfaceKHR && icd_term->surface_list.list[icd_surface->surface_index]) {
-                    icd_term->dispatch.DestroySurfaceKHR(icd_term->instance,
-                                                         icd_term->surface_list.list[icd_surface->surface_index], pAllocator);
-                    icd_term->surface_list.list[icd_surface->surface_index] = (VkSurfaceKHR)(uintptr_t)NULL;
-                }
-            } else {
-                // The real_icd_surface for any ICD not supporting the
-                // proper interface version should be NULL.  If not, then
-                // we have a problem.
-                assert((VkSurfaceKHR)(uintptr_t)NULL == icd_term->surface_list.list[icd_surface->surface_index]);
-            }
-        }
+        loader_platform_thread_lock_mutex(&loader_inst->surfaces_lock);
+        wsi_destroy_icd_surfaces(loader_inst, icd_surface, pAllocator);
         loader_release_object_from_list(&loader_inst->surfaces_list, icd_surface->surface_index);
+        loader_platform_thread_unlock_mutex(&loader_inst->surfaces_lock);
         loader_instance_heap_free(loader_inst, (void *)(uintptr_t)surface);
     }
 }
@@ -251,7 +261,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceSupportKHR(VkP
     }
     *pSupported = false;
 
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceSurfaceSupportKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceSupportKHR)) {
         // set pSupported to false as this driver doesn't support WSI functionality
         *pSupported = false;
         loader_log(loader_inst, VULKAN_LOADER_ERROR_BIT, 0,
@@ -259,15 +269,18 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceSupportKHR(VkP
         return VK_SUCCESS;
     }
 
-    VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)surface;
-    if (NULL != icd_term->surface_list.list &&
-        icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR) &&
-        icd_term->surface_list.list[icd_surface->surface_index]) {
-        return icd_term->dispatch.GetPhysicalDeviceSurfaceSupportKHR(
-            phys_dev_term->phys_dev, queueFamilyIndex, icd_term->surface_list.list[icd_surface->surface_index], pSupported);
+    VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;
+    VkResult res = wsi_unwrap_icd_surface(icd_term, surface, &unwrapped_surface);
+    if (VK_SUCCESS != res) {
+        return res;
+    }
+    if (VK_NULL_HANDLE != unwrapped_surface) {
+        return ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceSupportKHR)(phys_dev_term->phys_dev, queueFamilyIndex,
+                                                                          unwrapped_surface, pSupported);
     }
 
-    return icd_term->dispatch.GetPhysicalDeviceSurfaceSupportKHR(phys_dev_term->phys_dev, queueFamilyIndex, surface, pSupported);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceSupportKHR)(phys_dev_term->phys_dev, queueFamilyIndex, surface,
+                                                                      pSupported);
 }
 
 // This is the trampoline entrypoint for GetPhysicalDeviceSurfaceCapabilitiesKHR
@@ -306,7 +319,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceCapabilitiesKH
         abort();
     }
 
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceSurfaceCapabilitiesKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceCapabilitiesKHR)) {
         // Zero out the capabilities as this driver doesn't support WSI functionality
         memset(pSurfaceCapabilities, 0, sizeof(VkSurfaceCapabilitiesKHR));
         loader_log(loader_inst, VULKAN_LOADER_ERROR_BIT, 0,
@@ -314,16 +327,17 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceCapabilitiesKH
         return VK_SUCCESS;
     }
 
-    VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)surface;
-    if (NULL != phys_dev_term->this_icd_term->surface_list.list &&
-        phys_dev_term->this_icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR) &&
-        phys_dev_term->this_icd_term->surface_list.list[icd_surface->surface_index]) {
-        return icd_term->dispatch.GetPhysicalDeviceSurfaceCapabilitiesKHR(
-            phys_dev_term->phys_dev, phys_dev_term->this_icd_term->surface_list.list[icd_surface->surface_index],
-            pSurfaceCapabilities);
+    VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;
+    VkResult res = wsi_unwrap_icd_surface(icd_term, surface, &unwrapped_surface);
+    if (VK_SUCCESS != res) {
+        return res;
+    }
+    if (VK_NULL_HANDLE != unwrapped_surface) {
+        return ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceCapabilitiesKHR)(phys_dev_term->phys_dev, unwrapped_surface,
+                                                                               pSurfaceCapabilities);
     }
 
-    return icd_term->dispatch.GetPhysicalDeviceSurfaceCapabilitiesKHR(phys_dev_term->phys_dev, surface, pSurfaceCapabilities);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceCapabilitiesKHR)(phys_dev_term->phys_dev, surface, pSurfaceCapabilities);
 }
 
 // This is the trampoline entrypoint for GetPhysicalDeviceSurfaceFormatsKHR
@@ -364,7 +378,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceFormatsKHR(VkP
         abort();
     }
 
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceSurfaceFormatsKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceFormatsKHR)) {
         // Zero out the format count as this driver doesn't support WSI functionality
         *pSurfaceFormatCount = 0;
         loader_log(loader_inst, VULKAN_LOADER_ERROR_BIT, 0,
@@ -372,18 +386,17 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceFormatsKHR(VkP
         return VK_SUCCESS;
     }
 
-    if (VK_NULL_HANDLE != surface) {
-        VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)surface;
-        if (NULL != phys_dev_term->this_icd_term->surface_list.list &&
-            phys_dev_term->this_icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR) &&
-            phys_dev_term->this_icd_term->surface_list.list[icd_surface->surface_index]) {
-            return icd_term->dispatch.GetPhysicalDeviceSurfaceFormatsKHR(
-                phys_dev_term->phys_dev, phys_dev_term->this_icd_term->surface_list.list[icd_surface->surface_index],
-                pSurfaceFormatCount, pSurfaceFormats);
-        }
+    VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;
+    VkResult res = wsi_unwrap_icd_surface(icd_term, surface, &unwrapped_surface);
+    if (VK_SUCCESS != res) {
+        return res;
+    }
+    if (VK_NULL_HANDLE != unwrapped_surface) {
+        return ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceFormatsKHR)(phys_dev_term->phys_dev, unwrapped_surface,
+                                                                          pSurfaceFormatCount, pSurfaceFormats);
     }
-    return icd_term->dispatch.GetPhysicalDeviceSurfaceFormatsKHR(phys_dev_term->phys_dev, surface, pSurfaceFormatCount,
-                                                                 pSurfaceFormats);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceFormatsKHR)(phys_dev_term->phys_dev, surface, pSurfaceFormatCount,
+                                                                      pSurfaceFormats);
 }
 
 // This is the trampoline entrypoint for GetPhysicalDeviceSurfacePresentModesKHR
@@ -424,26 +437,24 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfacePresentModesKH
         abort();
     }
 
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceSurfacePresentModesKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfacePresentModesKHR)) {
         // Zero out the present mode count as this driver doesn't support WSI functionality
         *pPresentModeCount = 0;
         loader_log(loader_inst, VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD for selected physical device does not export vkGetPhysicalDeviceSurfacePresentModesKHR!");
         return VK_SUCCESS;
     }
-    if (VK_NULL_HANDLE != surface) {
-        VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)surface;
-
-        if (icd_surface != NULL && NULL != phys_dev_term->this_icd_term->surface_list.list &&
-            phys_dev_term->this_icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR) &&
-            phys_dev_term->this_icd_term->surface_list.list[icd_surface->surface_index]) {
-            return icd_term->dispatch.GetPhysicalDeviceSurfacePresentModesKHR(
-                phys_dev_term->phys_dev, phys_dev_term->this_icd_term->surface_list.list[icd_surface->surface_index],
-                pPresentModeCount, pPresentModes);
-        }
+    VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;
+    VkResult res = wsi_unwrap_icd_surface(icd_term, surface, &unwrapped_surface);
+    if (VK_SUCCESS != res) {
+        return res;
     }
-    return icd_term->dispatch.GetPhysicalDeviceSurfacePresentModesKHR(phys_dev_term->phys_dev, surface, pPresentModeCount,
-                                                                      pPresentModes);
+    if (VK_NULL_HANDLE != unwrapped_surface) {
+        return ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfacePresentModesKHR)(phys_dev_term->phys_dev, unwrapped_surface,
+                                                                               pPresentModeCount, pPresentModes);
+    }
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfacePresentModesKHR)(phys_dev_term->phys_dev, surface, pPresentModeCount,
+                                                                           pPresentModes);
 }
 
 // Functions for the VK_KHR_swapchain extension:
@@ -492,10 +503,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateSwapchainKHR(VkDevice device, co
                    "extension enabled?");
         return VK_SUCCESS;
     }
-    VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)pCreateInfo->surface;
-    if (NULL != icd_term->surface_list.list &&
-        icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR) &&
-        icd_term->surface_list.list[icd_surface->surface_index]) {
+    VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;
+    VkResult res = wsi_unwrap_icd_surface(icd_term, pCreateInfo->surface, &unwrapped_surface);
+    if (VK_SUCCESS != res) {
+        return res;
+    }
+    if (VK_NULL_HANDLE != unwrapped_surface) {
         // We found the ICD, and there is an ICD KHR surface
         // associated with it, so copy the CreateInfo struct
         // and point it at the ICD's surface.
@@ -504,7 +517,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateSwapchainKHR(VkDevice device, co
             return VK_ERROR_OUT_OF_HOST_MEMORY;
         }
         memcpy(pCreateCopy, pCreateInfo, sizeof(VkSwapchainCreateInfoKHR));
-        pCreateCopy->surface = icd_term->surface_list.list[icd_surface->surface_index];
+        pCreateCopy->surface = unwrapped_surface;
         return dev->loader_dispatch.extension_terminator_dispatch.CreateSwapchainKHR(device, pCreateCopy, pAllocator, pSwapchain);
     }
     return dev->loader_dispatch.extension_terminator_dispatch.CreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
@@ -557,11 +570,14 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkQueuePresentKHR(VkQueue queue, co
     return disp->QueuePresentKHR(queue, pPresentInfo);
 }
 
+// Only allocates the loader's surface, drivers get their own the first time they are asked about it in wsi_unwrap_icd_surface
 VkResult allocate_icd_surface_struct(struct loader_instance *instance, size_t base_size, size_t platform_size,
                                      const VkAllocationCallbacks *pAllocator, VkIcdSurface **out_icd_surface) {
     uint32_t next_index = 0;
     VkIcdSurface *icd_surface = NULL;
+    loader_platform_thread_lock_mutex(&instance->surfaces_lock);
     VkResult res = loader_get_next_available_entry(instance, &instance->surfaces_list, &next_index, pAllocator);
+    loader_platform_thread_unlock_mutex(&instance->surfaces_lock);
     if (res != VK_SUCCESS) {
         goto out;
     }
@@ -569,6 +585,9 @@ VkResult allocate_icd_surface_struct(struct loader_instance *instance, size_t ba
     // Next, if so, proceed with the implementation of this function:
     icd_surface = loader_instance_heap_alloc(instance, sizeof(VkIcdSurface), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
     if (icd_surface == NULL) {
+        loader_platform_thread_lock_mutex(&instance->surfaces_lock);
+        loader_release_object_from_list(&instance->surfaces_list, next_index);
+        loader_platform_thread_unlock_mutex(&instance->surfaces_lock);
         res = VK_ERROR_OUT_OF_HOST_MEMORY;
         goto out;
     }
@@ -579,29 +598,16 @@ VkResult allocate_icd_surface_struct(struct loader_instance *instance, size_t ba
     icd_surface->non_platform_offset = (uint32_t)((uint8_t *)(&icd_surface->base_size) - (uint8_t *)icd_surface);
     icd_surface->entire_size = sizeof(VkIcdSurface);
     icd_surface->surface_index = next_index;
-
-    for (struct loader_icd_term *icd_term = instance->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-            if (icd_term->surface_list.list == NULL) {
-                res =
-                    loader_init_generic_list(instance, (struct loader_generic_list *)&icd_term->surface_list, sizeof(VkSurfaceKHR));
-                if (res != VK_SUCCESS) {
-                    goto out;
-                }
-            } else if (icd_term->surface_list.capacity <= next_index * sizeof(VkSurfaceKHR)) {
-                res = loader_resize_generic_list(instance, (struct loader_generic_list *)&icd_term->surface_list);
-                if (res != VK_SUCCESS) {
-                    goto out;
-                }
-            }
-        }
+    if (NULL != pAllocator) {
+        icd_surface->allocation_callbacks = *pAllocator;
+    } else {
+        memset(&icd_surface->allocation_callbacks, 0, sizeof(VkAllocationCallbacks));
     }
 
     *out_icd_surface = icd_surface;
 out:
     if (res != VK_SUCCESS) {
         loader_instance_heap_free(instance, icd_surface);
-        // cleanup of icd_term->surface_list is done during instance destruction
     }
     return res;
 }
@@ -609,23 +615,194 @@ out:
 void cleanup_surface_creation(struct loader_instance *loader_inst, VkResult result, VkIcdSurface *icd_surface,
                               const VkAllocationCallbacks *pAllocator) {
     if (VK_SUCCESS != result && NULL != icd_surface) {
-        for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-            if (NULL != icd_term->surface_list.list &&
-                icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR) &&
-                icd_term->surface_list.list[icd_surface->surface_index] && NULL != icd_term->dispatch.DestroySurfaceKHR) {
-                icd_term->dispatch.DestroySurfaceKHR(icd_term->instance, icd_term->surface_list.list[icd_surface->surface_index],
-                                                     pAllocator);
+        loader_platform_thread_lock_mutex(&loader_inst->surfaces_lock);
+        wsi_destroy_icd_surfaces(loader_inst, icd_surface, pAllocator);
+        loader_release_object_from_list(&loader_inst->surfaces_list, icd_surface->surface_index);
+        loader_platform_thread_unlock_mutex(&loader_inst->surfaces_lock);
+        loader_instance_heap_free(loader_inst, icd_surface);
+    }
+}
+
+// Creates the surface of icd_term for icd_surface from the parameters stored in it. The structures recreated here don't have any
+// pNext extensions or flags in use, so nothing the application passed in is lost. Display surfaces can be extended, so those are
+// made in every driver by terminator_CreateDisplayPlaneSurfaceKHR instead.
+VkResult wsi_create_icd_surface(struct loader_icd_term *icd_term, const VkIcdSurface *icd_surface,
+                                const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    switch (icd_surface->headless_surf.base.platform) {
+#if defined(VK_USE_PLATFORM_WIN32_KHR)
+        case VK_ICD_WSI_PLATFORM_WIN32:
+            if (NULL != ICD_DISPATCH(icd_term, CreateWin32SurfaceKHR)) {
+                VkWin32SurfaceCreateInfoKHR create_info = {0};
+                create_info.sType = VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR;
+                create_info.hinstance = icd_surface->win_surf.hinstance;
+                create_info.hwnd = icd_surface->win_surf.hwnd;
+                return ICD_DISPATCH(icd_term, CreateWin32SurfaceKHR)(icd_term->instance, &create_info, pAllocator, pSurface);
             }
-        }
-        if (loader_inst->surfaces_list.list &&
-            loader_inst->surfaces_list.capacity > icd_surface->surface_index * sizeof(struct loader_used_object_status)) {
-            loader_inst->surfaces_list.list[icd_surface->surface_index].status = VK_FALSE;
-            if (NULL != pAllocator) {
-                loader_inst->surfaces_list.list[icd_surface->surface_index].allocation_callbacks = *pAllocator;
+            break;
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+#if defined(VK_USE_PLATFORM_WAYLAND_KHR)
+        case VK_ICD_WSI_PLATFORM_WAYLAND:
+            if (NULL != ICD_DISPATCH(icd_term, CreateWaylandSurfaceKHR)) {
+                VkWaylandSurfaceCreateInfoKHR create_info = {0};
+                create_info.sType = VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR;
+                create_info.display = icd_surface->wayland_surf.display;
+                create_info.surface = icd_surface->wayland_surf.surface;
+                return ICD_DISPATCH(icd_term, CreateWaylandSurfaceKHR)(icd_term->instance, &create_info, pAllocator, pSurface);
+            }
+            break;
+#endif  // VK_USE_PLATFORM_WAYLAND_KHR
+#if defined(VK_USE_PLATFORM_XCB_KHR)
+        case VK_ICD_WSI_PLATFORM_XCB:
+            if (NULL != ICD_DISPATCH(icd_term, CreateXcbSurfaceKHR)) {
+                VkXcbSurfaceCreateInfoKHR create_info = {0};
+                create_info.sType = VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR;
+                create_info.connection = icd_surface->xcb_surf.connection;
+                create_info.window = icd_surface->xcb_surf.window;
+                return ICD_DISPATCH(icd_term, CreateXcbSurfaceKHR)(icd_term->instance, &create_info, pAllocator, pSurface);
+            }
+            break;
+#endif  // VK_USE_PLATFORM_XCB_KHR
+#if defined(VK_USE_PLATFORM_XLIB_KHR)
+        case VK_ICD_WSI_PLATFORM_XLIB:
+            if (NULL != ICD_DISPATCH(icd_term, CreateXlibSurfaceKHR)) {
+                VkXlibSurfaceCreateInfoKHR create_info = {0};
+                create_info.sType = VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR;
+                create_info.dpy = icd_surface->xlib_surf.dpy;
+                create_info.window = icd_surface->xlib_surf.window;
+                return ICD_DISPATCH(icd_term, CreateXlibSurfaceKHR)(icd_term->instance, &create_info, pAllocator, pSurface);
+            }
+            break;
+#endif  // VK_USE_PLATFORM_XLIB_KHR
+#if defined(VK_USE_PLATFORM_DIRECTFB_EXT)
+        case VK_ICD_WSI_PLATFORM_DIRECTFB:
+            if (NULL != ICD_DISPATCH(icd_term, CreateDirectFBSurfaceEXT)) {
+                VkDirectFBSurfaceCreateInfoEXT create_info = {0};
+                create_info.sType = VK_STRUCTURE_TYPE_DIRECTFB_SURFACE_CREATE_INFO_EXT;
+                create_info.dfb = icd_surface->directfb_surf.dfb;
+                create_info.surface = icd_surface->directfb_surf.surface;
+                return ICD_DISPATCH(icd_term, CreateDirectFBSurfaceEXT)(icd_term->instance, &create_info, pAllocator, pSurface);
+            }
+            break;
+#endif  // VK_USE_PLATFORM_DIRECTFB_EXT
+#if defined(VK_USE_PLATFORM_MACOS_MVK)
+        case VK_ICD_WSI_PLATFORM_MACOS:
+            if (NULL != ICD_DISPATCH(icd_term, CreateMacOSSurfaceMVK)) {
+                VkMacOSSurfaceCreateInfoMVK create_info = {0};
+                create_info.sType = VK_STRUCTURE_TYPE_MACOS_SURFACE_CREATE_INFO_MVK;
+                create_info.pView = icd_surface->macos_surf.pView;
+                return ICD_DISPATCH(icd_term, CreateMacOSSurfaceMVK)(icd_term->instance, &create_info, pAllocator, pSurface);
+            }
+            break;
+#endif  // VK_USE_PLATFORM_MACOS_MVK
+#if defined(VK_USE_PLATFORM_GGP)
+        case VK_ICD_WSI_PLATFORM_GGP:
+            if (NULL != ICD_DISPATCH(icd_term, CreateStreamDescriptorSurfaceGGP)) {
+                VkStreamDescriptorSurfaceCreateInfoGGP create_info = {0};
+                create_info.sType = VK_STRUCTURE_TYPE_STREAM_DESCRIPTOR_SURFACE_CREATE_INFO_GGP;
+                create_info.streamDescriptor = icd_surface->ggp_surf.streamDescriptor;
+                return ICD_DISPATCH(icd_term, CreateStreamDescriptorSurfaceGGP)(icd_term->instance, &create_info, pAllocator,
+                                                                                pSurface);
+            }
+            break;
+#endif  // VK_USE_PLATFORM_GGP
+#if defined(VK_USE_PLATFORM_FUCHSIA)
+        case VK_ICD_WSI_PLATFORM_FUCHSIA:
+            if (NULL != ICD_DISPATCH(icd_term, CreateImagePipeSurfaceFUCHSIA)) {
+                VkImagePipeSurfaceCreateInfoFUCHSIA create_info = {0};
+                create_info.sType = VK_STRUCTURE_TYPE_IMAGEPIPE_SURFACE_CREATE_INFO_FUCHSIA;
+                create_info.imagePipeHandle = icd_surface->imagepipe_surf.imagePipeHandle;
+                return ICD_DISPATCH(icd_term, CreateImagePipeSurfaceFUCHSIA)(icd_term->instance, &create_info, pAllocator,
+                                                                             pSurface);
+            }
+            break;
+#endif  // VK_USE_PLATFORM_FUCHSIA
+#if defined(VK_USE_PLATFORM_METAL_EXT)
+        case VK_ICD_WSI_PLATFORM_METAL:
+            if (NULL != ICD_DISPATCH(icd_term, CreateMetalSurfaceEXT)) {
+                VkMetalSurfaceCreateInfoEXT create_info = {0};
+                create_info.sType = VK_STRUCTURE_TYPE_METAL_SURFACE_CREATE_INFO_EXT;
+                create_info.pLayer = icd_surface->metal_surf.pLayer;
+                return ICD_DISPATCH(icd_term, CreateMetalSurfaceEXT)(icd_term->instance, &create_info, pAllocator, pSurface);
+            }
+            break;
+#endif  // VK_USE_PLATFORM_METAL_EXT
+#if defined(VK_USE_PLATFORM_SCREEN_QNX)
+        case VK_ICD_WSI_PLATFORM_SCREEN:
+            if (NULL != ICD_DISPATCH(icd_term, CreateScreenSurfaceQNX)) {
+                VkScreenSurfaceCreateInfoQNX create_info = {0};
+                create_info.sType = VK_STRUCTURE_TYPE_SCREEN_SURFACE_CREATE_INFO_QNX;
+                create_info.context = icd_surface->screen_surf.context;
+                create_info.window = icd_surface->screen_surf.window;
+                return ICD_DISPATCH(icd_term, CreateScreenSurfaceQNX)(icd_term->instance, &create_info, pAllocator, pSurface);
+            }
+            break;
+#endif  // VK_USE_PLATFORM_SCREEN_QNX
+#if defined(VK_USE_PLATFORM_VI_NN)
+        case VK_ICD_WSI_PLATFORM_VI:
+            if (NULL != ICD_DISPATCH(icd_term, CreateViSurfaceNN)) {
+                VkViSurfaceCreateInfoNN create_info = {0};
+                create_info.sType = VK_STRUCTURE_TYPE_VI_SURFACE_CREATE_INFO_NN;
+                create_info.window = icd_surface->vi_surf.window;
+                return ICD_DISPATCH(icd_term, CreateViSurfaceNN)(icd_term->instance, &create_info, pAllocator, pSurface);
+            }
+            break;
+#endif  // VK_USE_PLATFORM_VI_NN
+        case VK_ICD_WSI_PLATFORM_HEADLESS:
+            if (NULL != ICD_DISPATCH(icd_term, CreateHeadlessSurfaceEXT)) {
+                VkHeadlessSurfaceCreateInfoEXT create_info = {0};
+                create_info.sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT;
+                return ICD_DISPATCH(icd_term, CreateHeadlessSurfaceEXT)(icd_term->instance, &create_info, pAllocator, pSurface);
+            }
+            break;
+        default:
+            break;
+    }
+    return VK_SUCCESS;
+}
+
+VkResult wsi_unwrap_icd_surface(struct loader_icd_term *icd_term, VkSurfaceKHR surface, VkSurfaceKHR *pIcdSurface) {
+    *pIcdSurface = VK_NULL_HANDLE;
+
+    VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)surface;
+    if (NULL == icd_surface || icd_term->scanned_icd->interface_version < ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
+        return VK_SUCCESS;
+    }
+    // These surfaces are always handed to the driver as they are, and don't have a surface_index
+    switch (icd_surface->headless_surf.base.platform) {
+        case VK_ICD_WSI_PLATFORM_ANDROID:
+        case VK_ICD_WSI_PLATFORM_IOS:
+#if defined(VK_USE_PLATFORM_OHOS)
+        case VK_ICD_WSI_PLATFORM_OHOS:
+#endif  // VK_USE_PLATFORM_OHOS
+            return VK_SUCCESS;
+        default:
+            break;
+    }
+
+    struct loader_instance *loader_inst = (struct loader_instance *)icd_term->this_instance;
+    uint32_t index = icd_surface->surface_index;
+    loader_platform_thread_lock_mutex(&loader_inst->surfaces_lock);
+    VkResult res = loader_reserve_generic_list_index(loader_inst, (struct loader_generic_list *)&icd_term->surface_list,
+                                                     sizeof(VkSurfaceKHR), index);
+    if (VK_SUCCESS == res && (VkSurfaceKHR)(uintptr_t)NULL == icd_term->surface_list.list[index]) {
+        res = wsi_create_icd_surface(icd_term, icd_surface, ignore_null_callback(&icd_surface->allocation_callbacks),
+                                     &icd_term->surface_list.list[index]);
+        if (VK_SUCCESS != res) {
+            icd_term->surface_list.list[index] = (VkSurfaceKHR)(uintptr_t)NULL;
+            loader_log(loader_inst, VULKAN_LOADER_ERROR_BIT | VULKAN_LOADER_DRIVER_BIT, 0,
+                       "wsi_unwrap_icd_surface: Failed to create the surface in ICD %s", icd_term->scanned_icd->lib_name);
+            // The error comes back from whichever command first asked about the surface, which may not be allowed to return
+            // what surface creation can, so anything other than running out of memory is reported as the surface being lost
+            if (VK_ERROR_OUT_OF_HOST_MEMORY != res && VK_ERROR_OUT_OF_DEVICE_MEMORY != res) {
+                res = VK_ERROR_SURFACE_LOST_KHR;
             }
         }
-        loader_instance_heap_free(loader_inst, icd_surface);
     }
+    if (VK_SUCCESS == res) {
+        *pIcdSurface = icd_term->surface_list.list[index];
+    }
+    loader_platform_thread_unlock_mutex(&loader_inst->surfaces_lock);
+    return res;
 }
 
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
@@ -675,19 +852,6 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateWin32SurfaceKHR(VkInstance insta
     icd_surface->win_surf.hinstance = pCreateInfo->hinstance;
     icd_surface->win_surf.hwnd = pCreateInfo->hwnd;
 
-    // Loop through each ICD and determine if they need to create a surface
-    for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-            if (NULL != icd_term->dispatch.CreateWin32SurfaceKHR) {
-                result = icd_term->dispatch.CreateWin32SurfaceKHR(icd_term->instance, pCreateInfo, pAllocator,
-                                                                  &icd_term->surface_list.list[icd_surface->surface_index]);
-                if (VK_SUCCESS != result) {
-                    goto out;
-                }
-            }
-        }
-    }
-
     *pSurface = (VkSurfaceKHR)(uintptr_t)icd_surface;
 
 out:
@@ -726,14 +890,14 @@ VKAPI_ATTR VkBool32 VKAPI_CALL terminator_GetPhysicalDeviceWin32PresentationSupp
         return VK_FALSE;
     }
 
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceWin32PresentationSupportKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceWin32PresentationSupportKHR)) {
         // return VK_FALSE as this driver doesn't support WSI functionality
         loader_log(loader_inst, VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD for selected physical device does not export vkGetPhysicalDeviceWin32PresentationSupportKHR!");
         return VK_FALSE;
     }
 
-    return icd_term->dispatch.GetPhysicalDeviceWin32PresentationSupportKHR(phys_dev_term->phys_dev, queueFamilyIndex);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceWin32PresentationSupportKHR)(phys_dev_term->phys_dev, queueFamilyIndex);
 }
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 
@@ -781,19 +945,6 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateWaylandSurfaceKHR(VkInstance ins
     icd_surface->wayland_surf.display = pCreateInfo->display;
     icd_surface->wayland_surf.surface = pCreateInfo->surface;
 
-    // Loop through each ICD and determine if they need to create a surface
-    for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-            if (NULL != icd_term->dispatch.CreateWaylandSurfaceKHR) {
-                result = icd_term->dispatch.CreateWaylandSurfaceKHR(icd_term->instance, pCreateInfo, pAllocator,
-                                                                    &icd_term->surface_list.list[icd_surface->surface_index]);
-                if (VK_SUCCESS != result) {
-                    goto out;
-                }
-            }
-        }
-    }
-
     *pSurface = (VkSurfaceKHR)(uintptr_t)icd_surface;
 
 out:
@@ -835,14 +986,15 @@ VKAPI_ATTR VkBool32 VKAPI_CALL terminator_GetPhysicalDeviceWaylandPresentationSu
         return VK_FALSE;
     }
 
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceWaylandPresentationSupportKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceWaylandPresentationSupportKHR)) {
         // return VK_FALSE as this driver doesn't support WSI functionality
         loader_log(loader_inst, VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD for selected physical device does not export vkGetPhysicalDeviceWaylandPresentationSupportKHR!");
         return VK_FALSE;
     }
 
-    return icd_term->dispatch.GetPhysicalDeviceWaylandPresentationSupportKHR(phys_dev_term->phys_dev, queueFamilyIndex, display);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceWaylandPresentationSupportKHR)(phys_dev_term->phys_dev, queueFamilyIndex,
+                                                                                  display);
 }
 #endif  // VK_USE_PLATFORM_WAYLAND_KHR
 
@@ -891,19 +1043,6 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateXcbSurfaceKHR(VkInstance instanc
     icd_surface->xcb_surf.connection = pCreateInfo->connection;
     icd_surface->xcb_surf.window = pCreateInfo->window;
 
-    // Loop through each ICD and determine if they need to create a surface
-    for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-            if (NULL != icd_term->dispatch.CreateXcbSurfaceKHR) {
-                result = icd_term->dispatch.CreateXcbSurfaceKHR(icd_term->instance, pCreateInfo, pAllocator,
-                                                                &icd_term->surface_list.list[icd_surface->surface_index]);
-                if (VK_SUCCESS != result) {
-                    goto out;
-                }
-            }
-        }
-    }
-
     *pSurface = (VkSurfaceKHR)(uintptr_t)icd_surface;
 
 out:
@@ -947,15 +1086,15 @@ VKAPI_ATTR VkBool32 VKAPI_CALL terminator_GetPhysicalDeviceXcbPresentationSuppor
         return VK_FALSE;
     }
 
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceXcbPresentationSupportKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceXcbPresentationSupportKHR)) {
         // return VK_FALSE as this driver doesn't support WSI functionality
         loader_log(loader_inst, VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD for selected physical device does not export vkGetPhysicalDeviceXcbPresentationSupportKHR!");
         return VK_FALSE;
     }
 
-    return icd_term->dispatch.GetPhysicalDeviceXcbPresentationSupportKHR(phys_dev_term->phys_dev, queueFamilyIndex, connection,
-                                                                         visual_id);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceXcbPresentationSupportKHR)(phys_dev_term->phys_dev, queueFamilyIndex, connection,
+                                                                              visual_id);
 }
 #endif  // VK_USE_PLATFORM_XCB_KHR
 
@@ -1004,19 +1143,6 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateXlibSurfaceKHR(VkInstance instan
     icd_surface->xlib_surf.dpy = pCreateInfo->dpy;
     icd_surface->xlib_surf.window = pCreateInfo->window;
 
-    // Loop through each ICD and determine if they need to create a surface
-    for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-            if (NULL != icd_term->dispatch.CreateXlibSurfaceKHR) {
-                result = icd_term->dispatch.CreateXlibSurfaceKHR(icd_term->instance, pCreateInfo, pAllocator,
-                                                                 &icd_term->surface_list.list[icd_surface->surface_index]);
-                if (VK_SUCCESS != result) {
-                    goto out;
-                }
-            }
-        }
-    }
-
     *pSurface = (VkSurfaceKHR)(uintptr_t)icd_surface;
 
 out:
@@ -1058,14 +1184,15 @@ VKAPI_ATTR VkBool32 VKAPI_CALL terminator_GetPhysicalDeviceXlibPresentationSuppo
         return VK_FALSE;
     }
 
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceXlibPresentationSupportKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceXlibPresentationSupportKHR)) {
         // return VK_FALSE as this driver doesn't support WSI functionality
         loader_log(loader_inst, VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD for selected physical device does not export vkGetPhysicalDeviceXlibPresentationSupportKHR!");
         return VK_FALSE;
     }
 
-    return icd_term->dispatch.GetPhysicalDeviceXlibPresentationSupportKHR(phys_dev_term->phys_dev, queueFamilyIndex, dpy, visualID);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceXlibPresentationSupportKHR)(phys_dev_term->phys_dev, queueFamilyIndex, dpy,
+                                                                               visualID);
 }
 #endif  // VK_USE_PLATFORM_XLIB_KHR
 
@@ -1116,19 +1243,6 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDirectFBSurfaceEXT(VkInstance in
     icd_surface->directfb_surf.dfb = pCreateInfo->dfb;
     icd_surface->directfb_surf.surface = pCreateInfo->surface;
 
-    // Loop through each ICD and determine if they need to create a surface
-    for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-            if (NULL != icd_term->dispatch.CreateDirectFBSurfaceEXT) {
-                result = icd_term->dispatch.CreateDirectFBSurfaceEXT(icd_term->instance, pCreateInfo, pAllocator,
-                                                                     &icd_term->surface_list.list[icd_surface->surface_index]);
-                if (VK_SUCCESS != result) {
-                    goto out;
-                }
-            }
-        }
-    }
-
     *pSurface = (VkSurfaceKHR)(uintptr_t)icd_surface;
 
 out:
@@ -1171,14 +1285,14 @@ VKAPI_ATTR VkBool32 VKAPI_CALL terminator_GetPhysicalDeviceDirectFBPresentationS
         return VK_FALSE;
     }
 
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceDirectFBPresentationSupportEXT) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceDirectFBPresentationSupportEXT)) {
         // return VK_FALSE as this driver doesn't support WSI functionality
         loader_log(loader_inst, VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD for selected physical device does not export vkGetPhysicalDeviceDirectFBPresentationSupportEXT!");
         return VK_FALSE;
     }
 
-    return icd_term->dispatch.GetPhysicalDeviceDirectFBPresentationSupportEXT(phys_dev_term->phys_dev, queueFamilyIndex, dfb);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceDirectFBPresentationSupportEXT)(phys_dev_term->phys_dev, queueFamilyIndex, dfb);
 }
 
 #endif  // VK_USE_PLATFORM_DIRECTFB_EXT
@@ -1319,19 +1433,6 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateHeadlessSurfaceEXT(VkInstance in
     }
 
     icd_surface->headless_surf.base.platform = VK_ICD_WSI_PLATFORM_HEADLESS;
-    // Loop through each ICD and determine if they need to create a surface
-    for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-            if (NULL != icd_term->dispatch.CreateHeadlessSurfaceEXT) {
-                result = icd_term->dispatch.CreateHeadlessSurfaceEXT(icd_term->instance, pCreateInfo, pAllocator,
-                                                                     &icd_term->surface_list.list[icd_surface->surface_index]);
-                if (VK_SUCCESS != result) {
-                    goto out;
-                }
-            }
-        }
-    }
-
     *pSurface = (VkSurfaceKHR)(uintptr_t)icd_surface;
 
 out:
@@ -1412,19 +1513,6 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateMacOSSurfaceMVK(VkInstance insta
     icd_surface->macos_surf.base.platform = VK_ICD_WSI_PLATFORM_MACOS;
     icd_surface->macos_surf.pView = pCreateInfo->pView;
 
-    // Loop through each ICD and determine if they need to create a surface
-    for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-            if (NULL != icd_term->dispatch.CreateMacOSSurfaceMVK) {
-                result = icd_term->dispatch.CreateMacOSSurfaceMVK(icd_term->instance, pCreateInfo, pAllocator,
-                                                                  &icd_term->surface_list.list[icd_surface->surface_index]);
-                if (VK_SUCCESS != result) {
-                    goto out;
-                }
-            }
-        }
-    }
-
     *pSurface = (VkSurfaceKHR)(uintptr_t)icd_surface;
 
 out:
@@ -1530,19 +1618,6 @@ terminator_CreateStreamDescriptorSurfaceGGP(VkInstance instance, const VkStreamD
     icd_surface->ggp_surf.base.platform = VK_ICD_WSI_PLATFORM_GGP;
     icd_surface->ggp_surf.streamDescriptor = pCreateInfo->streamDescriptor;
 
-    // Loop through each ICD and determine if they need to create a surface
-    for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-            if (NULL != icd_term->dispatch.CreateStreamDescriptorSurfaceGGP) {
-                result = icd_term->dispatch.CreateStreamDescriptorSurfaceGGP(
-                    icd_term->instance, pCreateInfo, pAllocator, &icd_term->surface_list.list[icd_surface->surface_index]);
-                if (VK_SUCCESS != result) {
-                    goto out;
-                }
-            }
-        }
-    }
-
     *pSurface = (VkSurfaceKHR)(uintptr_t)icd_surface;
 
 out:
@@ -1592,18 +1667,6 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateMetalSurfaceEXT(VkInstance insta
     icd_surface->metal_surf.base.platform = VK_ICD_WSI_PLATFORM_METAL;
     icd_surface->metal_surf.pLayer = pCreateInfo->pLayer;
 
-    // Loop through each ICD and determine if they need to create a surface
-    for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-            if (NULL != icd_term->dispatch.CreateMetalSurfaceEXT) {
-                result = icd_term->dispatch.CreateMetalSurfaceEXT(icd_term->instance, pCreateInfo, pAllocator,
-                                                                  &icd_term->surface_list.list[icd_surface->surface_index]);
-                if (VK_SUCCESS != result) {
-                    goto out;
-                }
-            }
-        }
-    }
     *pSurface = (VkSurfaceKHR)(uintptr_t)icd_surface;
 
 out:
@@ -1659,19 +1722,6 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateScreenSurfaceQNX(VkInstance inst
     icd_surface->screen_surf.context = pCreateInfo->context;
     icd_surface->screen_surf.window = pCreateInfo->window;
 
-    // Loop through each ICD and determine if they need to create a surface
-    for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-            if (NULL != icd_term->dispatch.CreateScreenSurfaceQNX) {
-                result = icd_term->dispatch.CreateScreenSurfaceQNX(icd_term->instance, pCreateInfo, pAllocator,
-                                                                   &icd_term->surface_list.list[icd_surface->surface_index]);
-                if (VK_SUCCESS != result) {
-                    goto out;
-                }
-            }
-        }
-    }
-
     *pSurface = (VkSurfaceKHR)(uintptr_t)icd_surface;
 
 out:
@@ -1713,14 +1763,14 @@ VKAPI_ATTR VkBool32 VKAPI_CALL terminator_GetPhysicalDeviceScreenPresentationSup
         return VK_FALSE;
     }
 
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceScreenPresentationSupportQNX) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceScreenPresentationSupportQNX)) {
         // return VK_FALSE as this driver doesn't support WSI functionality
         loader_log(loader_inst, VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD for selected physical device does not export vkGetPhysicalDeviceScreenPresentationSupportQNX!");
         return VK_FALSE;
     }
 
-    return icd_term->dispatch.GetPhysicalDeviceScreenPresentationSupportQNX(phys_dev_term->phys_dev, queueFamilyIndex, window);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceScreenPresentationSupportQNX)(phys_dev_term->phys_dev, queueFamilyIndex, window);
 }
 #endif  // VK_USE_PLATFORM_SCREEN_QNX
 
@@ -1766,19 +1816,6 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateViSurfaceNN(VkInstance instance,
     icd_surface->vi_surf.base.platform = VK_ICD_WSI_PLATFORM_VI;
     icd_surface->vi_surf.window = pCreateInfo->window;
 
-    // Loop through each ICD and determine if they need to create a surface
-    for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-            if (NULL != icd_term->dispatch.CreateViSurfaceNN) {
-                result = icd_term->dispatch.CreateViSurfaceNN(icd_term->instance, pCreateInfo, pAllocator,
-                                                              &icd_term->surface_list.list[icd_surface->surface_index]);
-                if (VK_SUCCESS != result) {
-                    goto out;
-                }
-            }
-        }
-    }
-
     *pSurface = (VkSurfaceKHR)(uintptr_t)icd_surface;
 
 out:
@@ -1820,7 +1857,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceDisplayPropertiesKHR(
         return VK_SUCCESS;
     }
 
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceDisplayPropertiesKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceDisplayPropertiesKHR)) {
         loader_log(loader_inst, VULKAN_LOADER_WARN_BIT, 0,
                    "ICD for selected physical device does not export vkGetPhysicalDeviceDisplayPropertiesKHR!");
         // return 0 for property count as this driver doesn't support WSI functionality
@@ -1830,7 +1867,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceDisplayPropertiesKHR(
         return VK_SUCCESS;
     }
 
-    return icd_term->dispatch.GetPhysicalDeviceDisplayPropertiesKHR(phys_dev_term->phys_dev, pPropertyCount, pProperties);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceDisplayPropertiesKHR)(phys_dev_term->phys_dev, pPropertyCount, pProperties);
 }
 
 LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetPhysicalDeviceDisplayPlanePropertiesKHR(
@@ -1861,7 +1898,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceDisplayPlanePropertie
         return VK_SUCCESS;
     }
 
-    if (NULL == icd_term->dispatch.GetPhysicalDeviceDisplayPlanePropertiesKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceDisplayPlanePropertiesKHR)) {
         loader_log(loader_inst, VULKAN_LOADER_WARN_BIT, 0,
                    "ICD for selected physical device does not export vkGetPhysicalDeviceDisplayPlanePropertiesKHR!");
         // return 0 for property count as this driver doesn't support WSI functionality
@@ -1871,7 +1908,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceDisplayPlanePropertie
         return VK_SUCCESS;
     }
 
-    return icd_term->dispatch.GetPhysicalDeviceDisplayPlanePropertiesKHR(phys_dev_term->phys_dev, pPropertyCount, pProperties);
+    return ICD_DISPATCH(icd_term, GetPhysicalDeviceDisplayPlanePropertiesKHR)(phys_dev_term->phys_dev, pPropertyCount, pProperties);
 }
 
 LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDevice physicalDevice,
@@ -1902,7 +1939,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetDisplayPlaneSupportedDisplaysKHR(Vk
         return VK_SUCCESS;
     }
 
-    if (NULL == icd_term->dispatch.GetDisplayPlaneSupportedDisplaysKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetDisplayPlaneSupportedDisplaysKHR)) {
         loader_log(loader_inst, VULKAN_LOADER_WARN_BIT, 0,
                    "ICD for selected physical device does not export vkGetDisplayPlaneSupportedDisplaysKHR!");
         // return 0 for property count as this driver doesn't support WSI functionality
@@ -1912,7 +1949,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetDisplayPlaneSupportedDisplaysKHR(Vk
         return VK_SUCCESS;
     }
 
-    return icd_term->dispatch.GetDisplayPlaneSupportedDisplaysKHR(phys_dev_term->phys_dev, planeIndex, pDisplayCount, pDisplays);
+    return ICD_DISPATCH(icd_term, GetDisplayPlaneSupportedDisplaysKHR)(phys_dev_term->phys_dev, planeIndex, pDisplayCount,
+                                                                       pDisplays);
 }
 
 LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display,
@@ -1944,7 +1982,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetDisplayModePropertiesKHR(VkPhysical
         return VK_SUCCESS;
     }
 
-    if (NULL == icd_term->dispatch.GetDisplayModePropertiesKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetDisplayModePropertiesKHR)) {
         loader_log(loader_inst, VULKAN_LOADER_WARN_BIT, 0,
                    "ICD for selected physical device does not export vkGetDisplayModePropertiesKHR!");
         // return 0 for property count as this driver doesn't support WSI functionality
@@ -1954,7 +1992,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetDisplayModePropertiesKHR(VkPhysical
         return VK_SUCCESS;
     }
 
-    return icd_term->dispatch.GetDisplayModePropertiesKHR(phys_dev_term->phys_dev, display, pPropertyCount, pProperties);
+    return ICD_DISPATCH(icd_term, GetDisplayModePropertiesKHR)(phys_dev_term->phys_dev, display, pPropertyCount, pProperties);
 }
 
 LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateDisplayModeKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display,
@@ -1987,14 +2025,14 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDisplayModeKHR(VkPhysicalDevice
         return VK_ERROR_EXTENSION_NOT_PRESENT;
     }
 
-    if (NULL == icd_term->dispatch.CreateDisplayModeKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, CreateDisplayModeKHR)) {
         // Can't emulate, so return an appropriate error
         loader_log(loader_inst, VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD for selected physical device does not export vkCreateDisplayModeKHR!");
         return VK_ERROR_INITIALIZATION_FAILED;
     }
 
-    return icd_term->dispatch.CreateDisplayModeKHR(phys_dev_term->phys_dev, display, pCreateInfo, pAllocator, pMode);
+    return ICD_DISPATCH(icd_term, CreateDisplayModeKHR)(phys_dev_term->phys_dev, display, pCreateInfo, pAllocator, pMode);
 }
 
 LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkGetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice physicalDevice,
@@ -2026,7 +2064,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetDisplayPlaneCapabilitiesKHR(VkPhysi
         return VK_SUCCESS;
     }
 
-    if (NULL == icd_term->dispatch.GetDisplayPlaneCapabilitiesKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetDisplayPlaneCapabilitiesKHR)) {
         // Emulate support
         loader_log(loader_inst, VULKAN_LOADER_WARN_BIT, 0,
                    "ICD for selected physical device does not export vkGetDisplayPlaneCapabilitiesKHR!");
@@ -2036,7 +2074,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetDisplayPlaneCapabilitiesKHR(VkPhysi
         return VK_SUCCESS;
     }
 
-    return icd_term->dispatch.GetDisplayPlaneCapabilitiesKHR(phys_dev_term->phys_dev, mode, planeIndex, pCapabilities);
+    return ICD_DISPATCH(icd_term, GetDisplayPlaneCapabilitiesKHR)(phys_dev_term->phys_dev, mode, planeIndex, pCapabilities);
 }
 
 LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateDisplayPlaneSurfaceKHR(VkInstance instance,
@@ -2086,18 +2124,30 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateDisplayPlaneSurfaceKHR(VkInstanc
     icd_surface->display_surf.alphaMode = pCreateInfo->alphaMode;
     icd_surface->display_surf.imageExtent = pCreateInfo->imageExtent;
 
-    // Loop through each ICD and determine if they need to create a surface
+    // Unlike other surfaces, the drivers' display surfaces are made right away, since the application's pNext chain, such as
+    // VkDisplaySurfaceStereoCreateInfoNV, has to reach them and isn't kept around
+    loader_platform_thread_lock_mutex(&loader_inst->surfaces_lock);
     for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-            if (NULL != icd_term->dispatch.CreateDisplayPlaneSurfaceKHR) {
-                result = icd_term->dispatch.CreateDisplayPlaneSurfaceKHR(icd_term->instance, pCreateInfo, pAllocator,
-                                                                         &icd_term->surface_list.list[icd_surface->surface_index]);
-                if (VK_SUCCESS != result) {
-                    goto out;
-                }
-            }
+        if (icd_term->scanned_icd->interface_version < ICD_VER_SUPPORTS_ICD_SURFACE_KHR ||
+            NULL == ICD_DISPATCH(icd_term, CreateDisplayPlaneSurfaceKHR)) {
+            continue;
+        }
+        result = loader_reserve_generic_list_index(loader_inst, (struct loader_generic_list *)&icd_term->surface_list,
+                                                   sizeof(VkSurfaceKHR), icd_surface->surface_index);
+        if (VK_SUCCESS != result) {
+            break;
+        }
+        result = ICD_DISPATCH(icd_term, CreateDisplayPlaneSurfaceKHR)(icd_term->instance, pCreateInfo, pAllocator,
+                                                                      &icd_term->surface_list.list[icd_surface->surface_index]);
+        if (VK_SUCCESS != result) {
+            icd_term->surface_list.list[icd_surface->surface_index] = (VkSurfaceKHR)(uintptr_t)NULL;
+            break;
         }
     }
+    loader_platform_thread_unlock_mutex(&loader_inst->surfaces_lock);
+    if (VK_SUCCESS != result) {
+        goto out;
+    }
 
     *pSurface = (VkSurfaceKHR)(uintptr_t)icd_surface;
 
@@ -2136,12 +2186,6 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateSharedSwapchainsKHR(VkDevice dev
                    "[VUID-vkCreateSharedSwapchainsKHR-device-parameter]");
         abort(); /* Intentionally fail so user can correct issue. */
     }
-    if (NULL != icd_term->surface_list.list) {
-        loader_log(NULL, VULKAN_LOADER_ERROR_BIT, 0,
-                   "vkCreateSharedSwapchainsKHR Terminator: No VkSurfaceKHR objects were created, indicating an application "
-                   "bug. Returning VK_SUCCESS. ");
-        return VK_SUCCESS;
-    }
     if (NULL == dev->loader_dispatch.extension_terminator_dispatch.CreateSharedSwapchainsKHR) {
         loader_log(NULL, VULKAN_LOADER_ERROR_BIT, 0,
                    "vkCreateSharedSwapchainsKHR Terminator: Driver's function pointer was NULL, returning VK_SUCCESS. Was the "
@@ -2154,11 +2198,15 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateSharedSwapchainsKHR(VkDevice dev
         return VK_ERROR_OUT_OF_HOST_MEMORY;
     }
     memcpy(pCreateCopy, pCreateInfos, sizeof(VkSwapchainCreateInfoKHR) * swapchainCount);
+    // The driver's surfaces are made here if they don't exist yet, so an empty surface_list is not an error
     for (uint32_t sc = 0; sc < swapchainCount; sc++) {
-        VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)pCreateCopy[sc].surface;
-        if (icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR) &&
-            icd_term->surface_list.list[icd_surface->surface_index]) {
-            pCreateCopy[sc].surface = icd_term->surface_list.list[icd_surface->surface_index];
+        VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;
+        VkResult res = wsi_unwrap_icd_surface(icd_term, pCreateCopy[sc].surface, &unwrapped_surface);
+        if (VK_SUCCESS != res) {
+            return res;
+        }
+        if (VK_NULL_HANDLE != unwrapped_surface) {
+            pCreateCopy[sc].surface = unwrapped_surface;
         }
     }
     return dev->loader_dispatch.extension_terminator_dispatch.CreateSharedSwapchainsKHR(device, swapchainCount, pCreateCopy,
@@ -2206,12 +2254,14 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetDeviceGroupSurfacePresentModesKHR(V
                    "extensions enabled when using Vulkan 1.0?");
         return VK_SUCCESS;
     }
-    VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)surface;
-    if (NULL != icd_term->surface_list.list &&
-        icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR) &&
-        icd_term->surface_list.list[icd_surface->surface_index]) {
-        return dev->loader_dispatch.extension_terminator_dispatch.GetDeviceGroupSurfacePresentModesKHR(
-            device, icd_term->surface_list.list[icd_surface->surface_index], pModes);
+    VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;
+    VkResult res = wsi_unwrap_icd_surface(icd_term, surface, &unwrapped_surface);
+    if (VK_SUCCESS != res) {
+        return res;
+    }
+    if (VK_NULL_HANDLE != unwrapped_surface) {
+        return dev->loader_dispatch.extension_terminator_dispatch.GetDeviceGroupSurfacePresentModesKHR(device, unwrapped_surface,
+                                                                                                       pModes);
     }
     return dev->loader_dispatch.extension_terminator_dispatch.GetDeviceGroupSurfacePresentModesKHR(device, surface, pModes);
 }
@@ -2236,7 +2286,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDevicePresentRectanglesKHR(
                                                                                 VkRect2D *pRects) {
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
-    if (NULL == icd_term->dispatch.GetPhysicalDevicePresentRectanglesKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDevicePresentRectanglesKHR)) {
         loader_log(icd_term->this_instance, VULKAN_LOADER_ERROR_BIT, 0,
                    "ICD associated with VkPhysicalDevice does not support GetPhysicalDevicePresentRectanglesKHX");
         // return as this driver doesn't support WSI functionality
@@ -2245,14 +2295,16 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDevicePresentRectanglesKHR(
         }
         return VK_SUCCESS;
     }
-    VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t)(surface);
-    if (NULL != icd_term->surface_list.list &&
-        icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR) &&
-        icd_term->surface_list.list[icd_surface->surface_index]) {
-        return icd_term->dispatch.GetPhysicalDevicePresentRectanglesKHR(
-            phys_dev_term->phys_dev, icd_term->surface_list.list[icd_surface->surface_index], pRectCount, pRects);
+    VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;
+    VkResult res = wsi_unwrap_icd_surface(icd_term, surface, &unwrapped_surface);
+    if (VK_SUCCESS != res) {
+        return res;
     }
-    return icd_term->dispatch.GetPhysicalDevicePresentRectanglesKHR(phys_dev_term->phys_dev, surface, pRectCount, pRects);
+    if (VK_NULL_HANDLE != unwrapped_surface) {
+        return ICD_DISPATCH(icd_term, GetPhysicalDevicePresentRectanglesKHR)(phys_dev_term->phys_dev, unwrapped_surface, pRectCount,
+                                                                             pRects);
+    }
+    return ICD_DISPATCH(icd_term, GetPhysicalDevicePresentRectanglesKHR)(phys_dev_term->phys_dev, surface, pRectCount, pRects);
 }
 
 LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkAcquireNextImage2KHR(VkDevice device, const VkAcquireNextImageInfoKHR *pAcquireInfo,
@@ -2290,8 +2342,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceDisplayProperties2KHR
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
 
     // If the function is available in the driver, just call into it
-    if (icd_term->dispatch.GetPhysicalDeviceDisplayProperties2KHR != NULL) {
-        return icd_term->dispatch.GetPhysicalDeviceDisplayProperties2KHR(phys_dev_term->phys_dev, pPropertyCount, pProperties);
+    if (ICD_DISPATCH(icd_term, GetPhysicalDeviceDisplayProperties2KHR) != NULL) {
+        return ICD_DISPATCH(icd_term, GetPhysicalDeviceDisplayProperties2KHR)(phys_dev_term->phys_dev, pPropertyCount, pProperties);
     }
 
     // We have to emulate the function.
@@ -2299,14 +2351,14 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceDisplayProperties2KHR
                "vkGetPhysicalDeviceDisplayProperties2KHR: Emulating call in ICD \"%s\"", icd_term->scanned_icd->lib_name);
 
     // If the icd doesn't support VK_KHR_display, then no properties are available
-    if (icd_term->dispatch.GetPhysicalDeviceDisplayPropertiesKHR == NULL) {
+    if (ICD_DISPATCH(icd_term, GetPhysicalDeviceDisplayPropertiesKHR) == NULL) {
         *pPropertyCount = 0;
         return VK_SUCCESS;
     }
 
     // If we aren't writing to pProperties, then emulation is straightforward
     if (pProperties == NULL || *pPropertyCount == 0) {
-        return icd_term->dispatch.GetPhysicalDeviceDisplayPropertiesKHR(phys_dev_term->phys_dev, pPropertyCount, NULL);
+        return ICD_DISPATCH(icd_term, GetPhysicalDeviceDisplayPropertiesKHR)(phys_dev_term->phys_dev, pPropertyCount, NULL);
     }
 
     // If we do have to write to pProperties, then we need to write to a temporary array of VkDisplayPropertiesKHR and copy it
@@ -2314,7 +2366,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceDisplayProperties2KHR
     if (properties == NULL) {
         return VK_ERROR_OUT_OF_HOST_MEMORY;
     }
-    VkResult res = icd_term->dispatch.GetPhysicalDeviceDisplayPropertiesKHR(phys_dev_term->phys_dev, pPropertyCount, properties);
+    VkResult res = ICD_DISPATCH(icd_term, GetPhysicalDeviceDisplayPropertiesKHR)(phys_dev_term->phys_dev, pPropertyCount,
+                                                                                 properties);
     if (res < 0) {
         return res;
     }
@@ -2345,8 +2398,9 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceDisplayPlanePropertie
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
 
     // If the function is available in the driver, just call into it
-    if (icd_term->dispatch.GetPhysicalDeviceDisplayPlaneProperties2KHR != NULL) {
-        return icd_term->dispatch.GetPhysicalDeviceDisplayPlaneProperties2KHR(phys_dev_term->phys_dev, pPropertyCount, pProperties);
+    if (ICD_DISPATCH(icd_term, GetPhysicalDeviceDisplayPlaneProperties2KHR) != NULL) {
+        return ICD_DISPATCH(icd_term, GetPhysicalDeviceDisplayPlaneProperties2KHR)(phys_dev_term->phys_dev, pPropertyCount,
+                                                                                   pProperties);
     }
 
     // We have to emulate the function.
@@ -2354,14 +2408,14 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceDisplayPlanePropertie
                "vkGetPhysicalDeviceDisplayPlaneProperties2KHR: Emulating call in ICD \"%s\"", icd_term->scanned_icd->lib_name);
 
     // If the icd doesn't support VK_KHR_display, then no properties are available
-    if (icd_term->dispatch.GetPhysicalDeviceDisplayPlanePropertiesKHR == NULL) {
+    if (ICD_DISPATCH(icd_term, GetPhysicalDeviceDisplayPlanePropertiesKHR) == NULL) {
         *pPropertyCount = 0;
         return VK_SUCCESS;
     }
 
     // If we aren't writing to pProperties, then emulation is straightforward
     if (pProperties == NULL || *pPropertyCount == 0) {
-        return icd_term->dispatch.GetPhysicalDeviceDisplayPlanePropertiesKHR(phys_dev_term->phys_dev, pPropertyCount, NULL);
+        return ICD_DISPATCH(icd_term, GetPhysicalDeviceDisplayPlanePropertiesKHR)(phys_dev_term->phys_dev, pPropertyCount, NULL);
     }
 
     // If we do have to write to pProperties, then we need to write to a temporary array of VkDisplayPlanePropertiesKHR and copy it
@@ -2370,7 +2424,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceDisplayPlanePropertie
         return VK_ERROR_OUT_OF_HOST_MEMORY;
     }
     VkResult res =
-        icd_term->dispatch.GetPhysicalDeviceDisplayPlanePropertiesKHR(phys_dev_term->phys_dev, pPropertyCount, properties);
+        ICD_DISPATCH(icd_term, GetPhysicalDeviceDisplayPlanePropertiesKHR)(phys_dev_term->phys_dev, pPropertyCount, properties);
     if (res < 0) {
         return res;
     }
@@ -2402,8 +2456,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetDisplayModeProperties2KHR(VkPhysica
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
 
     // If the function is available in the driver, just call into it
-    if (icd_term->dispatch.GetDisplayModeProperties2KHR != NULL) {
-        return icd_term->dispatch.GetDisplayModeProperties2KHR(phys_dev_term->phys_dev, display, pPropertyCount, pProperties);
+    if (ICD_DISPATCH(icd_term, GetDisplayModeProperties2KHR) != NULL) {
+        return ICD_DISPATCH(icd_term, GetDisplayModeProperties2KHR)(phys_dev_term->phys_dev, display, pPropertyCount, pProperties);
     }
 
     // We have to emulate the function.
@@ -2411,14 +2465,14 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetDisplayModeProperties2KHR(VkPhysica
                icd_term->scanned_icd->lib_name);
 
     // If the icd doesn't support VK_KHR_display, then no properties are available
-    if (icd_term->dispatch.GetDisplayModePropertiesKHR == NULL) {
+    if (ICD_DISPATCH(icd_term, GetDisplayModePropertiesKHR) == NULL) {
         *pPropertyCount = 0;
         return VK_SUCCESS;
     }
 
     // If we aren't writing to pProperties, then emulation is straightforward
     if (pProperties == NULL || *pPropertyCount == 0) {
-        return icd_term->dispatch.GetDisplayModePropertiesKHR(phys_dev_term->phys_dev, display, pPropertyCount, NULL);
+        return ICD_DISPATCH(icd_term, GetDisplayModePropertiesKHR)(phys_dev_term->phys_dev, display, pPropertyCount, NULL);
     }
 
     // If we do have to write to pProperties, then we need to write to a temporary array of VkDisplayModePropertiesKHR and copy it
@@ -2426,7 +2480,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetDisplayModeProperties2KHR(VkPhysica
     if (properties == NULL) {
         return VK_ERROR_OUT_OF_HOST_MEMORY;
     }
-    VkResult res = icd_term->dispatch.GetDisplayModePropertiesKHR(phys_dev_term->phys_dev, display, pPropertyCount, properties);
+    VkResult res = ICD_DISPATCH(icd_term, GetDisplayModePropertiesKHR)(phys_dev_term->phys_dev, display, pPropertyCount,
+                                                                       properties);
     if (res < 0) {
         return res;
     }
@@ -2458,8 +2513,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetDisplayPlaneCapabilities2KHR(VkPhys
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
 
     // If the function is available in the driver, just call into it
-    if (icd_term->dispatch.GetDisplayPlaneCapabilities2KHR != NULL) {
-        return icd_term->dispatch.GetDisplayPlaneCapabilities2KHR(phys_dev_term->phys_dev, pDisplayPlaneInfo, pCapabilities);
+    if (ICD_DISPATCH(icd_term, GetDisplayPlaneCapabilities2KHR) != NULL) {
+        return ICD_DISPATCH(icd_term, GetDisplayPlaneCapabilities2KHR)(phys_dev_term->phys_dev, pDisplayPlaneInfo, pCapabilities);
     }
 
     // We have to emulate the function.
@@ -2467,7 +2522,7 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetDisplayPlaneCapabilities2KHR(VkPhys
                "vkGetDisplayPlaneCapabilities2KHR: Emulating call in ICD \"%s\"", icd_term->scanned_icd->lib_name);
 
     // If the icd doesn't support VK_KHR_display, then there are no capabilities
-    if (NULL == icd_term->dispatch.GetDisplayPlaneCapabilitiesKHR) {
+    if (NULL == ICD_DISPATCH(icd_term, GetDisplayPlaneCapabilitiesKHR)) {
         if (pCapabilities) {
             memset(&pCapabilities->capabilities, 0, sizeof(VkDisplayPlaneCapabilitiesKHR));
         }
@@ -2475,8 +2530,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetDisplayPlaneCapabilities2KHR(VkPhys
     }
 
     // Just call into the old version of the function.
-    return icd_term->dispatch.GetDisplayPlaneCapabilitiesKHR(phys_dev_term->phys_dev, pDisplayPlaneInfo->mode,
-                                                             pDisplayPlaneInfo->planeIndex, &pCapabilities->capabilities);
+    return ICD_DISPATCH(icd_term, GetDisplayPlaneCapabilitiesKHR)(phys_dev_term->phys_dev, pDisplayPlaneInfo->mode,
+                                                                  pDisplayPlaneInfo->planeIndex, &pCapabilities->capabilities);
 }
 
 #if defined(VK_USE_PLATFORM_FUCHSIA)
@@ -2525,19 +2580,6 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateImagePipeSurfaceFUCHSIA(VkInstan
 
     icd_surface->imagepipe_surf.base.platform = VK_ICD_WSI_PLATFORM_FUCHSIA;
 
-    // Loop through each ICD and determine if they need to create a surface
-    for (struct loader_icd_term *icd_term = loader_inst->icd_terms; icd_term != NULL; icd_term = icd_term->next) {
-        if (icd_term->scanned_icd->interface_version >= ICD_VER_SUPPORTS_ICD_SURFACE_KHR) {
-            if (NULL != icd_term->dispatch.CreateImagePipeSurfaceFUCHSIA) {
-                result = icd_term->dispatch.CreateImagePipeSurfaceFUCHSIA(icd_term->instance, pCreateInfo, pAllocator,
-                                                                          &icd_term->surface_list.list[icd_surface->surface_index]);
-                if (VK_SUCCESS != result) {
-                    goto out;
-                }
-            }
-        }
-    }
-
     *pSurface = (VkSurfaceKHR)(uintptr_t)icd_surface;
 
 out:
@@ -2623,10 +2665,6 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceCapabilities2K
     struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *)physicalDevice;
     struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;
     struct loader_instance *loader_inst = (struct loader_instance *)icd_term->this_instance;
-    VkIcdSurface *icd_surface = NULL;
-    if (pSurfaceInfo->surface) {
-        icd_surface = (VkIcdSurface *)(uintptr_t)pSurfaceInfo->surface;
-    }
 
     if (!loader_inst->wsi_surface_enabled) {
         loader_log(loader_inst, VULKAN_LOADER_ERROR_BIT, 0,
@@ -2634,7 +2672,13 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceCapabilities2K
         return VK_SUCCESS;
     }
 
-    if (icd_term->dispatch.GetPhysicalDeviceSurfaceCapabilities2KHR != NULL) {
+    VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;
+    VkResult unwrap_res = wsi_unwrap_icd_surface(icd_term, pSurfaceInfo->surface, &unwrapped_surface);
+    if (VK_SUCCESS != unwrap_res) {
+        return unwrap_res;
+    }
+
+    if (ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceCapabilities2KHR) != NULL) {
         void *pNext = pSurfaceCapabilities->pNext;
         while (pNext != NULL) {
             VkBaseOutStructure pNext_out_structure = {0};
@@ -2651,16 +2695,14 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceCapabilities2K
         VkResult res = VK_SUCCESS;
 
         // Pass the call to the driver, possibly unwrapping the ICD surface
-        if (NULL != icd_surface && NULL != icd_term->surface_list.list &&
-            icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR) &&
-            icd_term->surface_list.list[icd_surface->surface_index]) {
+        if (VK_NULL_HANDLE != unwrapped_surface) {
             VkPhysicalDeviceSurfaceInfo2KHR info_copy = *pSurfaceInfo;
-            info_copy.surface = icd_term->surface_list.list[icd_surface->surface_index];
-            res = icd_term->dispatch.GetPhysicalDeviceSurfaceCapabilities2KHR(phys_dev_term->phys_dev, &info_copy,
-                                                                              pSurfaceCapabilities);
+            info_copy.surface = unwrapped_surface;
+            res = ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceCapabilities2KHR)(phys_dev_term->phys_dev, &info_copy,
+                                                                                   pSurfaceCapabilities);
         } else {
-            res = icd_term->dispatch.GetPhysicalDeviceSurfaceCapabilities2KHR(phys_dev_term->phys_dev, pSurfaceInfo,
-                                                                              pSurfaceCapabilities);
+            res = ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceCapabilities2KHR)(phys_dev_term->phys_dev, pSurfaceInfo,
+                                                                                   pSurfaceCapabilities);
         }
 
         // Because VK_EXT_surface_maintenance1 is an instance extension, applications will use it to query info on drivers which do
@@ -2678,22 +2720,17 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceCapabilities2K
                    icd_term->scanned_icd->lib_name);
 
         // Write to the VkSurfaceCapabilities2KHR struct
-        VkSurfaceKHR surface = VK_NULL_HANDLE;
-        if (NULL != icd_surface && NULL != icd_term->surface_list.list &&
-            icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR) &&
-            icd_term->surface_list.list[icd_surface->surface_index]) {
-            surface = icd_term->surface_list.list[icd_surface->surface_index];
-        }
+        VkSurfaceKHR surface = unwrapped_surface;
 
         // If the icd doesn't support VK_KHR_surface, then there are no capabilities
-        if (NULL == icd_term->dispatch.GetPhysicalDeviceSurfaceCapabilitiesKHR) {
+        if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceCapabilitiesKHR)) {
             if (pSurfaceCapabilities) {
                 memset(&pSurfaceCapabilities->surfaceCapabilities, 0, sizeof(VkSurfaceCapabilitiesKHR));
             }
             return VK_SUCCESS;
         }
-        VkResult res = icd_term->dispatch.GetPhysicalDeviceSurfaceCapabilitiesKHR(phys_dev_term->phys_dev, surface,
-                                                                                  &pSurfaceCapabilities->surfaceCapabilities);
+        VkResult res = ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceCapabilitiesKHR)(phys_dev_term->phys_dev, surface,
+                                                                                       &pSurfaceCapabilities->surfaceCapabilities);
 
         emulate_VK_EXT_surface_maintenance1(icd_term, pSurfaceInfo, pSurfaceCapabilities);
         return res;
@@ -2729,23 +2766,22 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceFormats2KHR(Vk
         return VK_SUCCESS;
     }
 
-    VkIcdSurface *icd_surface = NULL;
-    if (VK_NULL_HANDLE != pSurfaceInfo->surface) {
-        icd_surface = (VkIcdSurface *)(uintptr_t)(pSurfaceInfo->surface);
+    VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;
+    VkResult unwrap_res = wsi_unwrap_icd_surface(icd_term, pSurfaceInfo->surface, &unwrapped_surface);
+    if (VK_SUCCESS != unwrap_res) {
+        return unwrap_res;
     }
 
-    if (icd_term->dispatch.GetPhysicalDeviceSurfaceFormats2KHR != NULL) {
+    if (ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceFormats2KHR) != NULL) {
         // Pass the call to the driver, possibly unwrapping the ICD surface
-        if (NULL != icd_surface && NULL != icd_term->surface_list.list &&
-            icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR) &&
-            icd_term->surface_list.list[icd_surface->surface_index]) {
+        if (VK_NULL_HANDLE != unwrapped_surface) {
             VkPhysicalDeviceSurfaceInfo2KHR info_copy = *pSurfaceInfo;
-            info_copy.surface = icd_term->surface_list.list[icd_surface->surface_index];
-            return icd_term->dispatch.GetPhysicalDeviceSurfaceFormats2KHR(phys_dev_term->phys_dev, &info_copy, pSurfaceFormatCount,
-                                                                          pSurfaceFormats);
+            info_copy.surface = unwrapped_surface;
+            return ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceFormats2KHR)(phys_dev_term->phys_dev, &info_copy,
+                                                                               pSurfaceFormatCount, pSurfaceFormats);
         } else {
-            return icd_term->dispatch.GetPhysicalDeviceSurfaceFormats2KHR(phys_dev_term->phys_dev, pSurfaceInfo,
-                                                                          pSurfaceFormatCount, pSurfaceFormats);
+            return ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceFormats2KHR)(phys_dev_term->phys_dev, pSurfaceInfo,
+                                                                               pSurfaceFormatCount, pSurfaceFormats);
         }
     } else {
         // Emulate the call
@@ -2760,14 +2796,12 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceFormats2KHR(Vk
         }
 
         VkSurfaceKHR surface = pSurfaceInfo->surface;
-        if (NULL != icd_surface && NULL != icd_term->surface_list.list &&
-            icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR) &&
-            icd_term->surface_list.list[icd_surface->surface_index]) {
-            surface = icd_term->surface_list.list[icd_surface->surface_index];
+        if (VK_NULL_HANDLE != unwrapped_surface) {
+            surface = unwrapped_surface;
         }
 
         // If the icd doesn't support VK_KHR_surface, then there are no formats
-        if (NULL == icd_term->dispatch.GetPhysicalDeviceSurfaceFormatsKHR) {
+        if (NULL == ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceFormatsKHR)) {
             if (pSurfaceFormatCount) {
                 *pSurfaceFormatCount = 0;
             }
@@ -2776,8 +2810,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceFormats2KHR(Vk
 
         if (*pSurfaceFormatCount == 0 || pSurfaceFormats == NULL) {
             // Write to pSurfaceFormatCount
-            return icd_term->dispatch.GetPhysicalDeviceSurfaceFormatsKHR(phys_dev_term->phys_dev, surface, pSurfaceFormatCount,
-                                                                         NULL);
+            return ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceFormatsKHR)(phys_dev_term->phys_dev, surface, pSurfaceFormatCount,
+                                                                              NULL);
         } else {
             // Allocate a temporary array for the output of the old function
             VkSurfaceFormatKHR *formats = loader_stack_alloc(*pSurfaceFormatCount * sizeof(VkSurfaceFormatKHR));
@@ -2785,8 +2819,8 @@ VKAPI_ATTR VkResult VKAPI_CALL terminator_GetPhysicalDeviceSurfaceFormats2KHR(Vk
                 return VK_ERROR_OUT_OF_HOST_MEMORY;
             }
 
-            VkResult res = icd_term->dispatch.GetPhysicalDeviceSurfaceFormatsKHR(phys_dev_term->phys_dev, surface,
-                                                                                 pSurfaceFormatCount, formats);
+            VkResult res = ICD_DISPATCH(icd_term, GetPhysicalDeviceSurfaceFormatsKHR)(phys_dev_term->phys_dev, surface,
+                                                                                      pSurfaceFormatCount, formats);
             for (uint32_t i = 0; i < *pSurfaceFormatCount; ++i) {
                 pSurfaceFormats[i].surfaceFormat = formats[i];
                 if (pSurfaceFormats[i].pNext != NULL) {
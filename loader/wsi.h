@@ -71,6 +71,8 @@ typedef struct {
     uint32_t non_platform_offset;  // Start offset to base_size
     uint32_t entire_size;          // Size of entire VkIcdSurface
     uint32_t surface_index;        // This surface's index into each drivers list of created surfaces
+    // Copy of the callbacks the surface was created with, used when a driver's surface is created on first use
+    VkAllocationCallbacks allocation_callbacks;
 } VkIcdSurface;
 
 bool wsi_swapchain_instance_gpa(struct loader_instance *ptr_instance, const char *name, void **addr);
@@ -78,6 +80,15 @@ bool wsi_swapchain_instance_gpa(struct loader_instance *ptr_instance, const char
 void wsi_create_instance(struct loader_instance *ptr_instance, const VkInstanceCreateInfo *pCreateInfo);
 bool wsi_unsupported_instance_extension(const VkExtensionProperties *ext_prop);
 
+// Returns in pIcdSurface the surface icd_term made for the loader's surface, creating it the first time a driver is asked about
+// it. pIcdSurface is VK_NULL_HANDLE when the driver takes the loader's surface as is. When the driver fails to create its surface,
+// VK_ERROR_SURFACE_LOST_KHR is returned unless it ran out of memory.
+VkResult wsi_unwrap_icd_surface(struct loader_icd_term *icd_term, VkSurfaceKHR surface, VkSurfaceKHR *pIcdSurface);
+VkResult wsi_create_icd_surface(struct loader_icd_term *icd_term, const VkIcdSurface *icd_surface,
+                                const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface);
+void wsi_destroy_icd_surfaces(struct loader_instance *loader_inst, const VkIcdSurface *icd_surface,
+                              const VkAllocationCallbacks *pAllocator);
+
 VKAPI_ATTR VkResult VKAPI_CALL terminator_CreateHeadlessSurfaceEXT(VkInstance instance,
                                                                    const VkHeadlessSurfaceCreateInfoEXT *pCreateInfo,
                                                                    const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface);
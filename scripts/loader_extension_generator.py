@@ -241,6 +241,7 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
 
 
         elif self.genOpts.filename == 'vk_loader_extensions.c':
+            preamble += '#include <stddef.h>\n'
             preamble += '#include <stdio.h>\n'
             preamble += '#include <stdlib.h>\n'
             preamble += '#include <string.h>\n'
@@ -279,6 +280,7 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
             file_data += self.OutputUtilitiesInSource()
             file_data += self.OutputIcdDispatchTableInit()
             file_data += self.OutputLoaderDispatchTables()
+            file_data += self.OutputLazyDeviceDispatchTables()
             file_data += self.InitDeviceFunctionTerminatorDispatchTable()
             file_data += self.OutputDeviceFunctionTrampolinePrototypes()
             file_data += self.OutputLoaderLookupFunc()
@@ -529,14 +531,32 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
         protos += '\n'
         protos += '// Init Device function pointer dispatch table with core commands\n'
         protos += 'VKAPI_ATTR void VKAPI_CALL loader_init_device_dispatch_table(struct loader_dev_dispatch_table *dev_table, PFN_vkGetDeviceProcAddr gpa,\n'
-        protos += '                                                             VkDevice dev);\n'
+        protos += '                                                             VkDevice dev, uint32_t api_version);\n'
         protos += '\n'
         protos += '// Init Device function pointer dispatch table with extension commands\n'
         protos += 'VKAPI_ATTR void VKAPI_CALL loader_init_device_extension_dispatch_table(struct loader_dev_dispatch_table *dev_table,\n'
         protos += '                                                                       PFN_vkGetInstanceProcAddr gipa,\n'
         protos += '                                                                       PFN_vkGetDeviceProcAddr gdpa,\n'
         protos += '                                                                       VkInstance inst,\n'
-        protos += '                                                                       VkDevice dev);\n'
+        protos += '                                                                       VkDevice dev,\n'
+        protos += '                                                                       const VkDeviceCreateInfo *pCreateInfo);\n'
+        protos += '\n'
+        protos += '// Init Device function pointer dispatch table with resolve-on-first-call stubs for the core commands\n'
+        protos += 'VKAPI_ATTR void VKAPI_CALL loader_init_lazy_device_dispatch_table(struct loader_dev_dispatch_table *dev_table, PFN_vkGetDeviceProcAddr gpa);\n'
+        protos += '\n'
+        protos += '// Init Device function pointer dispatch table with resolve-on-first-call stubs for the extension commands\n'
+        protos += 'VKAPI_ATTR void VKAPI_CALL loader_init_lazy_device_extension_dispatch_table(struct loader_dev_dispatch_table *dev_table,\n'
+        protos += '                                                                            PFN_vkGetInstanceProcAddr gipa,\n'
+        protos += '                                                                            PFN_vkGetDeviceProcAddr gdpa,\n'
+        protos += '                                                                            VkInstance inst,\n'
+        protos += '                                                                            VkDevice dev);\n'
+        protos += '\n'
+        protos += '// Builds and destroys the map from each lazy device dispatch stub to its command, used by loader_resolve_lazy_device_stub\n'
+        protos += 'VKAPI_ATTR VkResult VKAPI_CALL loader_init_lazy_device_stub_map(void);\n'
+        protos += 'VKAPI_ATTR void VKAPI_CALL loader_destroy_lazy_device_stub_map(void);\n'
+        protos += '\n'
+        protos += '// If addr is one of the lazy device dispatch stubs, resolves its command and returns that instead\n'
+        protos += 'VKAPI_ATTR void* VKAPI_CALL loader_resolve_lazy_device_stub(VkLayerDispatchTable *table, void *addr);\n'
         protos += '\n'
         protos += '// Init Instance function pointer dispatch table with core commands\n'
         protos += 'VKAPI_ATTR void VKAPI_CALL loader_init_instance_core_dispatch_table(VkLayerInstanceDispatchTable *table, PFN_vkGetInstanceProcAddr gpa,\n'
@@ -733,7 +753,21 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
         table += '        }                                                                               \\\n'
         table += '    } while (0)\n'
         table += '\n'
+        table += '// Commands the loader doesn\'t need itself are looked up by ICD_DISPATCH the first time they are used\n'
+        table += '#define LAZY_GIPA(func)                                                                 \\\n'
+        table += '    do {                                                                                \\\n'
+        table += '        icd_term->dispatch.func = (PFN_vk##func)loader_icd_unresolved_entry;            \\\n'
+        table += '        icd_term->lazy_dispatch_entry_count++;                                          \\\n'
+        table += '    } while (0)\n'
+        table += '\n'
+
 
+        # Optional commands which the loader calls on every driver while creating the instance and enumerating physical devices
+        eager_gipa_commands = ['vkEnumeratePhysicalDeviceGroups',
+                               'vkEnumeratePhysicalDeviceGroupsKHR',
+                               'vkGetPhysicalDeviceProperties2',
+                               'vkGetPhysicalDeviceProperties2KHR',
+                              ]
 
         skip_gipa_commands = ['vkGetInstanceProcAddr',
                               'vkEnumerateDeviceLayerProperties',
@@ -773,12 +807,15 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                         # The Core Vulkan code will be wrapped in a feature called VK_VERSION_#_#
                         # For example: VK_VERSION_1_0 wraps the core 1.0 Vulkan functionality
                         table += f'    LOOKUP_REQUIRED_GIPA({base_name});\n'
-                    else:
+                    elif cur_cmd.name in eager_gipa_commands:
                         table += f'    LOOKUP_GIPA({base_name});\n'
+                    else:
+                        table += f'    LAZY_GIPA({base_name});\n'
                     if cur_cmd.protect is not None:
                         table += f'#endif // {cur_cmd.protect}\n'
 
         table += '\n'
+        table += '#undef LAZY_GIPA\n'
         table += '#undef LOOKUP_REQUIRED_GIPA\n'
         table += '#undef LOOKUP_GIPA\n'
         table += '\n'
@@ -846,30 +883,59 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
         cur_type = ''
         cur_extension_name = ''
 
+        # The loader checks these commands for NULL, so they are always queried even if their extension wasn't enabled
+        always_queried = ['vkCreateSwapchainKHR']
+
+        # Some commands are provided by more than one extension, so collect every extension which lists each command
+        command_extensions = {}
+        for extension in self.registry.tree.findall('extensions/extension'):
+            if 'vulkan' not in extension.get('supported', '').split(','):
+                continue
+            for command in extension.findall('require/command'):
+                extension_names = command_extensions.setdefault(command.get('name'), [])
+                if extension.get('name') not in extension_names:
+                    extension_names.append(extension.get('name'))
+
+        tables += '// Returns whether extension_name is in the list of extensions enabled in pCreateInfo\n'
+        tables += 'static bool loader_device_extension_enabled(const VkDeviceCreateInfo *pCreateInfo, const char *extension_name) {\n'
+        tables += '    for (uint32_t i = 0; i < pCreateInfo->enabledExtensionCount; i++) {\n'
+        tables += '        if (!strcmp(pCreateInfo->ppEnabledExtensionNames[i], extension_name)) return true;\n'
+        tables += '    }\n'
+        tables += '    return false;\n'
+        tables += '}\n'
+        tables += '\n'
+
         for x in range(0, 4):
             if x == 0:
                 cur_type = 'device'
                 gpa_param = 'dev'
                 commands = self.core_commands
 
-                tables += '// Init Device function pointer dispatch table with core commands\n'
+                tables += '// Init Device function pointer dispatch table with core commands. Only the commands of API versions up to api_version\n'
+                tables += '// are queried, every other entry points at vkDevExtError.\n'
                 tables += 'VKAPI_ATTR void VKAPI_CALL loader_init_device_dispatch_table(struct loader_dev_dispatch_table *dev_table, PFN_vkGetDeviceProcAddr gpa,\n'
-                tables += '                                                             VkDevice dev) {\n'
+                tables += '                                                             VkDevice dev, uint32_t api_version) {\n'
                 tables += '    VkLayerDispatchTable *table = &dev_table->core_dispatch;\n'
                 tables += '    if (table->magic != DEVICE_DISP_TABLE_MAGIC_NUMBER) { abort(); }\n'
                 tables += '    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) dev_table->ext_dispatch[i] = (PFN_vkDevExt)vkDevExtError;\n'
+                tables += '    PFN_vkVoidFunction *entries = (PFN_vkVoidFunction *)&table->GetDeviceProcAddr;\n'
+                tables += '    for (size_t i = 0; i < (sizeof(*table) - offsetof(VkLayerDispatchTable, GetDeviceProcAddr)) / sizeof(PFN_vkVoidFunction); i++) {\n'
+                tables += '        entries[i] = (PFN_vkVoidFunction)vkDevExtError;\n'
+                tables += '    }\n'
 
             elif x == 1:
                 cur_type = 'device'
                 gpa_param = 'dev'
                 commands = self.ext_commands
 
-                tables += '// Init Device function pointer dispatch table with extension commands\n'
+                tables += '// Init Device function pointer dispatch table with extension commands. Only the commands of the extensions enabled in\n'
+                tables += '// pCreateInfo are queried, the entries of the other extensions are left pointing at vkDevExtError.\n'
                 tables += 'VKAPI_ATTR void VKAPI_CALL loader_init_device_extension_dispatch_table(struct loader_dev_dispatch_table *dev_table,\n'
                 tables += '                                                                       PFN_vkGetInstanceProcAddr gipa,\n'
                 tables += '                                                                       PFN_vkGetDeviceProcAddr gdpa,\n'
                 tables += '                                                                       VkInstance inst,\n'
-                tables += '                                                                       VkDevice dev) {\n'
+                tables += '                                                                       VkDevice dev,\n'
+                tables += '                                                                       const VkDeviceCreateInfo *pCreateInfo) {\n'
                 tables += '    VkLayerDispatchTable *table = &dev_table->core_dispatch;\n'
                 tables += '    table->magic = DEVICE_DISP_TABLE_MAGIC_NUMBER;\n'
 
@@ -891,11 +957,16 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                 tables += 'VKAPI_ATTR void VKAPI_CALL loader_init_instance_extension_dispatch_table(VkLayerInstanceDispatchTable *table, PFN_vkGetInstanceProcAddr gpa,\n'
                 tables += '                                                                        VkInstance inst) {\n'
 
+            # The condition of the if block the commands are currently being written into, if any
+            open_condition = None
             for cur_cmd in commands:
                 version = self.getAPIVersion(cur_cmd.ext_name)
                 is_inst_handle_type = cur_cmd.handle_type == 'VkInstance' or cur_cmd.handle_type == 'VkPhysicalDevice'
                 if ((cur_type == 'instance' and is_inst_handle_type) or (cur_type == 'device' and not is_inst_handle_type)):
                     if cur_cmd.ext_name != cur_extension_name:
+                        if open_condition is not None:
+                            tables += '    }\n'
+                            open_condition = None
                         if version:
                             tables += f'\n    // ---- Core {version.name} commands\n'
                         else:
@@ -912,6 +983,22 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                         base_name == 'EnumerateInstanceVersion'):
                         continue
 
+                    # Device commands are only queried for the API versions and extensions the device can use
+                    condition = None
+                    if x == 0 and version and version.token.startswith('VK_VERSION_') and version.token != 'VK_VERSION_1_0':
+                        condition = f'api_version >= {version.token.replace("VK_VERSION_", "VK_API_VERSION_")}'
+                    elif (x == 1 and cur_cmd.ext_type == 'device' and base_name != 'GetDeviceProcAddr' and
+                          cur_cmd.name not in always_queried):
+                        extension_names = command_extensions.get(cur_cmd.name, [cur_cmd.ext_name])
+                        condition = ' || '.join(f'loader_device_extension_enabled(pCreateInfo, "{name}")' for name in extension_names)
+                    if condition != open_condition:
+                        if open_condition is not None:
+                            tables += '    }\n'
+                        if condition is not None:
+                            tables += f'    if ({condition}) {{\n'
+                        open_condition = condition
+                    indent = '    ' if open_condition is None else '        '
+
                     if cur_cmd.protect is not None:
                         tables += f'#if defined({cur_cmd.protect})\n'
 
@@ -919,24 +1006,172 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                     # a layer overrides the function name for the loader.
                     if x == 1:
                         if base_name == 'GetDeviceProcAddr':
-                            tables += '    table->GetDeviceProcAddr = gdpa;\n'
+                            tables += f'{indent}table->GetDeviceProcAddr = gdpa;\n'
                         elif cur_cmd.ext_type == 'instance':
-                            tables += f'    table->{base_name} = (PFN_{cur_cmd.name})gipa(inst, "{cur_cmd.name}");\n'
+                            tables += f'{indent}table->{base_name} = (PFN_{cur_cmd.name})gipa(inst, "{cur_cmd.name}");\n'
                         else:
-                            tables += f'    table->{base_name} = (PFN_{cur_cmd.name})gdpa(dev, "{cur_cmd.name}");\n'
+                            tables += f'{indent}table->{base_name} = (PFN_{cur_cmd.name})gdpa(dev, "{cur_cmd.name}");\n'
                     elif (x < 1 and base_name == 'GetDeviceProcAddr'):
-                        tables += '    table->GetDeviceProcAddr = gpa;\n'
+                        tables += f'{indent}table->GetDeviceProcAddr = gpa;\n'
                     elif (x > 1 and base_name == 'GetInstanceProcAddr'):
-                        tables += '    table->GetInstanceProcAddr = gpa;\n'
+                        tables += f'{indent}table->GetInstanceProcAddr = gpa;\n'
                     else:
-                        tables += f'    table->{base_name} = (PFN_{cur_cmd.name})gpa({gpa_param}, "{cur_cmd.name}");\n'
+                        tables += f'{indent}table->{base_name} = (PFN_{cur_cmd.name})gpa({gpa_param}, "{cur_cmd.name}");\n'
 
                     if cur_cmd.protect is not None:
                         tables += f'#endif // {cur_cmd.protect}\n'
 
+            if open_condition is not None:
+                tables += '    }\n'
             tables += '}\n\n'
         return tables
 
+    #
+    # Creates the resolve-on-first-call stubs used by the lazy device dispatch mode (VK_LOADER_LAZY_DEVICE_DISPATCH), along with
+    # the functions which point the device dispatch table at them
+    def OutputLazyDeviceDispatchTables(self):
+        # The loader checks these commands for NULL, so they are always looked up when the device is created
+        eager_commands = ['vkCreateSwapchainKHR']
+        skip_names = ['CreateInstance', 'CreateDevice', 'EnumerateInstanceExtensionProperties',
+                      'EnumerateInstanceLayerProperties', 'EnumerateInstanceVersion', 'GetDeviceProcAddr']
+
+        stubs = '// Resolve-on-first-call stubs for the lazy device dispatch mode. Each one looks its command up through the top of the\n'
+        stubs += '// device chain, stores it in the dispatch table and then calls it, so later calls go straight to the command.\n'
+        command_lists = ['', '']
+        eager_init = ''
+        cur_extension_name = ''
+
+        for x in range(0, 2):
+            commands = self.core_commands if x == 0 else self.ext_commands
+            for cur_cmd in commands:
+                if cur_cmd.handle_type == 'VkInstance' or cur_cmd.handle_type == 'VkPhysicalDevice':
+                    continue
+                base_name = cur_cmd.name[2:]
+                if base_name in skip_names:
+                    continue
+
+                if x == 1 and (cur_cmd.ext_type == 'instance' or cur_cmd.name in eager_commands):
+                    if cur_cmd.protect is not None:
+                        eager_init += f'#if defined({cur_cmd.protect})\n'
+                    if cur_cmd.ext_type == 'instance':
+                        eager_init += f'    table->{base_name} = (PFN_{cur_cmd.name})gipa(inst, "{cur_cmd.name}");\n'
+                    else:
+                        eager_init += f'    table->{base_name} = (PFN_{cur_cmd.name})gdpa(dev, "{cur_cmd.name}");\n'
+                    if cur_cmd.protect is not None:
+                        eager_init += f'#endif // {cur_cmd.protect}\n'
+                    continue
+
+                if cur_cmd.ext_name != cur_extension_name:
+                    version = self.getAPIVersion(cur_cmd.ext_name)
+                    if version:
+                        stubs += f'\n// ---- Core {version.name} commands\n'
+                    else:
+                        stubs += f'\n// ---- {cur_cmd.ext_name} extension commands\n'
+                    cur_extension_name = cur_cmd.ext_name
+
+                if cur_cmd.protect is not None:
+                    stubs += f'#if defined({cur_cmd.protect})\n'
+                    command_lists[x] += f'#if defined({cur_cmd.protect})\n'
+
+                stubs += 'static ' + cur_cmd.cdecl.replace(";", " {\n").replace("VKAPI_CALL vk", "VKAPI_CALL loader_lazy_")
+                stubs += f'    VkLayerDispatchTable *table = loader_get_dispatch({cur_cmd.params[0].name});\n'
+                stubs += f'    PFN_{cur_cmd.name} fp = (PFN_{cur_cmd.name})loader_resolve_lazy_device_command(table, "{cur_cmd.name}",\n'
+                stubs += f'        (PFN_vkVoidFunction *)&table->{base_name});\n'
+                return_prefix = '    ' if cur_cmd.return_type is None else '    return '
+                stubs += f'{return_prefix}fp({", ".join(param.name for param in cur_cmd.params)});\n'
+                stubs += '}\n'
+
+                command_lists[x] += f'    {{"{cur_cmd.name}", offsetof(VkLayerDispatchTable, {base_name}), (PFN_vkVoidFunction)loader_lazy_{base_name}}},\n'
+
+                if cur_cmd.protect is not None:
+                    stubs += f'#endif // {cur_cmd.protect}\n'
+                    command_lists[x] += f'#endif // {cur_cmd.protect}\n'
+
+        tables = stubs
+        tables += '\n'
+        tables += 'struct loader_lazy_device_command {\n'
+        tables += '    const char *name;\n'
+        tables += '    size_t offset;  // Offset of the command in VkLayerDispatchTable\n'
+        tables += '    PFN_vkVoidFunction stub;\n'
+        tables += '};\n'
+        tables += '\n'
+        tables += 'static const struct loader_lazy_device_command loader_lazy_device_core_commands[] = {\n'
+        tables += command_lists[0]
+        tables += '};\n'
+        tables += '\n'
+        tables += 'static const struct loader_lazy_device_command loader_lazy_device_extension_commands[] = {\n'
+        tables += command_lists[1]
+        tables += '};\n'
+        tables += '\n'
+        tables += 'static void loader_set_lazy_device_stubs(VkLayerDispatchTable *table, const struct loader_lazy_device_command *commands, size_t count) {\n'
+        tables += '    for (size_t i = 0; i < count; i++) {\n'
+        tables += '        *(PFN_vkVoidFunction *)((uint8_t *)table + commands[i].offset) = commands[i].stub;\n'
+        tables += '    }\n'
+        tables += '}\n'
+        tables += '\n'
+        tables += '// Init Device function pointer dispatch table with resolve-on-first-call stubs for the core commands\n'
+        tables += 'VKAPI_ATTR void VKAPI_CALL loader_init_lazy_device_dispatch_table(struct loader_dev_dispatch_table *dev_table, PFN_vkGetDeviceProcAddr gpa) {\n'
+        tables += '    VkLayerDispatchTable *table = &dev_table->core_dispatch;\n'
+        tables += '    if (table->magic != DEVICE_DISP_TABLE_MAGIC_NUMBER) { abort(); }\n'
+        tables += '    for (uint32_t i = 0; i < MAX_NUM_UNKNOWN_EXTS; i++) dev_table->ext_dispatch[i] = (PFN_vkDevExt)vkDevExtError;\n'
+        tables += '\n'
+        tables += '    table->GetDeviceProcAddr = gpa;\n'
+        tables += '    loader_set_lazy_device_stubs(table, loader_lazy_device_core_commands,\n'
+        tables += '                                 sizeof(loader_lazy_device_core_commands) / sizeof(loader_lazy_device_core_commands[0]));\n'
+        tables += '}\n'
+        tables += '\n'
+        tables += '// Init Device function pointer dispatch table with resolve-on-first-call stubs for the extension commands\n'
+        tables += 'VKAPI_ATTR void VKAPI_CALL loader_init_lazy_device_extension_dispatch_table(struct loader_dev_dispatch_table *dev_table,\n'
+        tables += '                                                                            PFN_vkGetInstanceProcAddr gipa,\n'
+        tables += '                                                                            PFN_vkGetDeviceProcAddr gdpa,\n'
+        tables += '                                                                            VkInstance inst,\n'
+        tables += '                                                                            VkDevice dev) {\n'
+        tables += '    VkLayerDispatchTable *table = &dev_table->core_dispatch;\n'
+        tables += '    table->magic = DEVICE_DISP_TABLE_MAGIC_NUMBER;\n'
+        tables += '\n'
+        tables += '    loader_set_lazy_device_stubs(table, loader_lazy_device_extension_commands,\n'
+        tables += '                                 sizeof(loader_lazy_device_extension_commands) / sizeof(loader_lazy_device_extension_commands[0]));\n'
+        tables += '\n'
+        tables += '    // Commands which are not resolved lazily\n'
+        tables += eager_init
+        tables += '}\n'
+        tables += '\n'
+        tables += '// Maps each stub to its entry in the command lists above. Only written in loader_initialize and loader_release.\n'
+        tables += 'static struct loader_handle_map loader_lazy_device_stub_map;\n'
+        tables += '\n'
+        tables += 'VKAPI_ATTR VkResult VKAPI_CALL loader_init_lazy_device_stub_map(void) {\n'
+        tables += '    const struct loader_lazy_device_command *lists[2] = {loader_lazy_device_core_commands, loader_lazy_device_extension_commands};\n'
+        tables += '    size_t counts[2] = {sizeof(loader_lazy_device_core_commands) / sizeof(loader_lazy_device_core_commands[0]),\n'
+        tables += '                        sizeof(loader_lazy_device_extension_commands) / sizeof(loader_lazy_device_extension_commands[0])};\n'
+        tables += '    VkResult res = loader_init_handle_map(NULL, &loader_lazy_device_stub_map, (uint32_t)(counts[0] + counts[1]));\n'
+        tables += '    for (uint32_t list = 0; list < 2 && VK_SUCCESS == res; list++) {\n'
+        tables += '        for (size_t i = 0; i < counts[list] && VK_SUCCESS == res; i++) {\n'
+        tables += '            res = loader_handle_map_insert(NULL, &loader_lazy_device_stub_map, (const void *)lists[list][i].stub,\n'
+        tables += '                                           (void *)&lists[list][i]);\n'
+        tables += '        }\n'
+        tables += '    }\n'
+        tables += '    if (VK_SUCCESS != res) {\n'
+        tables += '        loader_destroy_handle_map(NULL, &loader_lazy_device_stub_map);\n'
+        tables += '    }\n'
+        tables += '    return res;\n'
+        tables += '}\n'
+        tables += '\n'
+        tables += 'VKAPI_ATTR void VKAPI_CALL loader_destroy_lazy_device_stub_map(void) {\n'
+        tables += '    loader_destroy_handle_map(NULL, &loader_lazy_device_stub_map);\n'
+        tables += '}\n'
+        tables += '\n'
+        tables += '// If addr is one of the stubs, resolves its command and returns that instead\n'
+        tables += 'VKAPI_ATTR void* VKAPI_CALL loader_resolve_lazy_device_stub(VkLayerDispatchTable *table, void *addr) {\n'
+        tables += '    const struct loader_lazy_device_command *command = loader_handle_map_find(&loader_lazy_device_stub_map, addr);\n'
+        tables += '    if (NULL == command) {\n'
+        tables += '        return addr;\n'
+        tables += '    }\n'
+        tables += '    return (void *)loader_resolve_lazy_device_command(table, command->name,\n'
+        tables += '                                                      (PFN_vkVoidFunction *)((uint8_t *)table + command->offset));\n'
+        tables += '}\n'
+        tables += '\n'
+        return tables
+
     #
     # Create a lookup table function from the appropriate list of entrypoints and
     # return it as a string
@@ -1260,9 +1495,7 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                 if ext_cmd.handle_type == 'VkPhysicalDevice':
                     funcs += f'    struct loader_physical_device_term *phys_dev_term = (struct loader_physical_device_term *){phys_dev_var_name};\n'
                     funcs += '    struct loader_icd_term *icd_term = phys_dev_term->this_icd_term;\n'
-                    funcs += '    if (NULL == icd_term->dispatch.'
-                    funcs += base_name
-                    funcs += ') {\n'
+                    funcs += f'    if (NULL == ICD_DISPATCH(icd_term, {base_name})) {{\n'
                     fatal_error_bit = '' if ext_cmd.ext_type =='instance' and has_return_type else 'VULKAN_LOADER_FATAL_ERROR_BIT | '
                     funcs += f'        loader_log(icd_term->this_instance, {fatal_error_bit}VULKAN_LOADER_ERROR_BIT, 0,\n'
                     funcs += '                   "ICD associated with VkPhysicalDevice does not support '
@@ -1288,9 +1521,7 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                         if update_structure_surface == 1:
                             funcs += update_structure_string
 
-                        funcs += '    ' + return_prefix + 'icd_term->dispatch.'
-                        funcs += base_name
-                        funcs += '('
+                        funcs += '    ' + return_prefix + f'ICD_DISPATCH(icd_term, {base_name})('
                         count = 0
                         for param in ext_cmd.params:
                             if count != 0:
@@ -1313,9 +1544,7 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                         funcs += '    }\n'
 
                     funcs += return_prefix
-                    funcs += 'icd_term->dispatch.'
-                    funcs += base_name
-                    funcs += '('
+                    funcs += f'ICD_DISPATCH(icd_term, {base_name})('
                     count = 0
                     for param in ext_cmd.params:
                         if count != 0:
@@ -1364,10 +1593,17 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
                         funcs += '    // If this is a KHR_surface, and the ICD has created its own, we have to replace it with the proper one for the next call.\n'
                         funcs += f'    }} else if ({debug_struct_name}->objectType == {surf_check}) {{\n'
                         funcs += '        if (NULL != dev && NULL != dev->loader_dispatch.core_dispatch.CreateSwapchainKHR) {\n'
-                        funcs += f'            VkIcdSurface *icd_surface = (VkIcdSurface *)(uintptr_t){debug_struct_name}->{member_name};\n'
-                        funcs += '            if (NULL != icd_term->surface_list.list && icd_term->surface_list.capacity > icd_surface->surface_index * sizeof(VkSurfaceKHR)\n'
-                        funcs += '                && icd_term->surface_list.list[icd_surface->surface_index]) {\n'
-                        funcs += f'                {local_struct}.{member_name} = (uint64_t)icd_term->surface_list.list[icd_surface->surface_index];\n'
+                        funcs += '            VkSurfaceKHR unwrapped_surface = VK_NULL_HANDLE;\n'
+                        funcs += f'            VkResult res = wsi_unwrap_icd_surface(icd_term, (VkSurfaceKHR)(uintptr_t){debug_struct_name}->{member_name}, &unwrapped_surface);\n'
+                        funcs += '            // The driver has no surface to name if it failed to make one\n'
+                        funcs += '            if (VK_ERROR_SURFACE_LOST_KHR == res) {\n'
+                        funcs += '                return VK_SUCCESS;\n'
+                        funcs += '            }\n'
+                        funcs += '            if (VK_SUCCESS != res) {\n'
+                        funcs += '                return res;\n'
+                        funcs += '            }\n'
+                        funcs += '            if (VK_NULL_HANDLE != unwrapped_surface) {\n'
+                        funcs += f'                {local_struct}.{member_name} = (uint64_t)unwrapped_surface;\n'
                         funcs += '            }\n'
                         funcs += '        }\n'
                         funcs += '    // If this is an instance we have to replace it with the proper one for the next call.\n'
@@ -1664,7 +1900,7 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
         term_func += '// device function. This is used in the terminators themselves.\n'
         term_func += 'void init_extension_device_proc_terminator_dispatch(struct loader_device *dev) {\n'
         term_func += '    struct loader_device_terminator_dispatch* dispatch = &dev->loader_dispatch.extension_terminator_dispatch;\n'
-        term_func += '    PFN_vkGetDeviceProcAddr gpda = (PFN_vkGetDeviceProcAddr)dev->phys_dev_term->this_icd_term->dispatch.GetDeviceProcAddr;\n'
+        term_func += '    PFN_vkGetDeviceProcAddr gpda = (PFN_vkGetDeviceProcAddr)ICD_DISPATCH(dev->phys_dev_term->this_icd_term, GetDeviceProcAddr);\n'
         last_protect = None
         last_ext = None
         for ext_cmd in self.ext_commands:
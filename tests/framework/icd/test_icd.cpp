@@ -512,6 +512,9 @@ VKAPI_ATTR void VKAPI_CALL test_vkGetPhysicalDeviceQueueFamilyProperties(VkPhysi
 
 VKAPI_ATTR VkResult VKAPI_CALL test_vkCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo,
                                                    [[maybe_unused]] const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) {
+    if (icd.create_device_return_code != VK_SUCCESS) {
+        return icd.create_device_return_code;
+    }
     // VK_SUCCESS
     auto found = std::find_if(icd.physical_devices.begin(), icd.physical_devices.end(), [physicalDevice](PhysicalDevice& phys_dev) {
         return phys_dev.vk_physical_device.handle == physicalDevice;
@@ -638,6 +641,9 @@ VKAPI_ATTR VkResult VKAPI_CALL test_vkCreateXcbSurfaceKHR([[maybe_unused]] VkIns
                                                           [[maybe_unused]] const VkXcbSurfaceCreateInfoKHR* pCreateInfo,
                                                           [[maybe_unused]] const VkAllocationCallbacks* pAllocator,
                                                           VkSurfaceKHR* pSurface) {
+    if (icd.create_surface_return_code != VK_SUCCESS) {
+        return icd.create_surface_return_code;
+    }
     common_nondispatch_handle_creation(icd.surface_handles, pSurface);
     return VK_SUCCESS;
 }
@@ -933,9 +939,17 @@ VKAPI_ATTR VkResult VKAPI_CALL test_vkGetDisplayPlaneCapabilitiesKHR(VkPhysicalD
     }
     return VK_SUCCESS;
 }
-VKAPI_ATTR VkResult VKAPI_CALL test_vkCreateDisplayPlaneSurfaceKHR(
-    [[maybe_unused]] VkInstance instance, [[maybe_unused]] const VkDisplaySurfaceCreateInfoKHR* pCreateInfo,
-    [[maybe_unused]] const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+VKAPI_ATTR VkResult VKAPI_CALL test_vkCreateDisplayPlaneSurfaceKHR([[maybe_unused]] VkInstance instance,
+                                                                   const VkDisplaySurfaceCreateInfoKHR* pCreateInfo,
+                                                                   [[maybe_unused]] const VkAllocationCallbacks* pAllocator,
+                                                                   VkSurfaceKHR* pSurface) {
+    icd.display_surface_create_info_chain.clear();
+    for (auto next = reinterpret_cast<const VkBaseInStructure*>(pCreateInfo->pNext); next != nullptr; next = next->pNext) {
+        icd.display_surface_create_info_chain.push_back(next->sType);
+    }
+    if (icd.create_surface_return_code != VK_SUCCESS) {
+        return icd.create_surface_return_code;
+    }
     common_nondispatch_handle_creation(icd.surface_handles, pSurface);
     return VK_SUCCESS;
 }
@@ -1148,6 +1162,8 @@ VKAPI_ATTR void VKAPI_CALL test_vkGetPhysicalDeviceProperties2(VkPhysicalDevice
             if (pNext->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT) {
                 auto* bus_info = reinterpret_cast<VkPhysicalDevicePCIBusInfoPropertiesEXT*>(pNext);
                 bus_info->pciBus = phys_dev.pci_bus;
+                bus_info->pciDevice = phys_dev.pci_device;
+                bus_info->pciFunction = phys_dev.pci_function;
             }
             if (pNext->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LAYERED_DRIVER_PROPERTIES_MSFT) {
                 auto* layered_driver_props = reinterpret_cast<VkPhysicalDeviceLayeredDriverPropertiesMSFT*>(pNext);
@@ -1700,6 +1716,7 @@ VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL test_vkGetInstanceProcAddr(VkInstance i
 }
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL test_vkGetDeviceProcAddr(VkDevice device, const char* pName) {
+    if (device != NULL && pName != nullptr) icd.device_proc_addr_queries.push_back(pName);
     return get_device_func(device, pName);
 }
 
@@ -1730,6 +1747,7 @@ PFN_vkVoidFunction base_get_instance_proc_addr(VkInstance instance, const char*
             return icd.can_query_vkEnumerateInstanceVersion ? to_vkVoidFunction(test_vkEnumerateInstanceVersion) : nullptr;
         if (string_eq(pName, "vkCreateInstance")) return to_vkVoidFunction(test_vkCreateInstance);
     }
+    if (instance != NULL) icd.instance_proc_addr_queries.push_back(pName);
     if (string_eq(pName, "vkGetDeviceProcAddr")) return to_vkVoidFunction(test_vkGetDeviceProcAddr);
 
     auto instance_func_return = get_instance_func(instance, pName);
@@ -88,6 +88,8 @@ struct PhysicalDevice {
     BUILDER_VALUE(PhysicalDevice, VkExternalSemaphoreProperties, external_semaphore_properties, {})
     BUILDER_VALUE(PhysicalDevice, VkExternalFenceProperties, external_fence_properties, {})
     BUILDER_VALUE(PhysicalDevice, uint32_t, pci_bus, {})
+    BUILDER_VALUE(PhysicalDevice, uint32_t, pci_device, {})
+    BUILDER_VALUE(PhysicalDevice, uint32_t, pci_function, {})
 
     BUILDER_VECTOR(PhysicalDevice, MockQueueFamilyProperties, queue_family_properties, queue_family_properties)
     BUILDER_VECTOR(PhysicalDevice, VkFormatProperties, format_properties, format_properties)
@@ -163,6 +165,10 @@ struct TestICD {
 #endif
 
     CalledICDGIPA called_vk_icd_gipa = CalledICDGIPA::not_called;
+    // Every name the loader looked up with the exported vkGetInstanceProcAddr for a created instance, in order
+    std::vector<std::string> instance_proc_addr_queries;
+    // Every name the loader looked up with vkGetDeviceProcAddr for a created device, in order
+    std::vector<std::string> device_proc_addr_queries;
     CalledNegotiateInterface called_negotiate_interface = CalledNegotiateInterface::not_called;
 
     InterfaceVersionCheck interface_version_check = InterfaceVersionCheck::not_called;
@@ -189,17 +195,32 @@ struct TestICD {
 
     BUILDER_VECTOR_MOVE_ONLY(TestICD, PhysicalDevice, physical_devices, physical_device);
 
+    // Emulates an SR-IOV capable device: adds the physical function followed by virtual_function_count virtual functions, each of
+    // which shows up as its own physical device on pci_bus. Makes it easy to give the loader hundreds of physical devices.
+    TestICD& add_sr_iov_physical_devices(std::string const& name, uint32_t pci_bus, uint32_t virtual_function_count) {
+        for (uint32_t i = 0; i <= virtual_function_count; i++) {
+            PhysicalDevice phys_dev{name + (i == 0 ? std::string("_PF") : std::string("_VF") + std::to_string(i - 1))};
+            phys_dev.set_pci_bus(pci_bus).set_pci_device(i / 8).set_pci_function(i % 8);
+            physical_devices.push_back(std::move(phys_dev));
+        }
+        return *this;
+    }
+
     BUILDER_VECTOR(TestICD, PhysicalDeviceGroup, physical_device_groups, physical_device_group);
 
     DispatchableHandle<VkInstance> instance_handle;
     std::vector<DispatchableHandle<VkDevice>> device_handles;
     std::vector<uint64_t> surface_handles;
+    // The sType of every structure chained to the last VkDisplaySurfaceCreateInfoKHR the driver got
+    std::vector<VkStructureType> display_surface_create_info_chain;
     std::vector<uint64_t> messenger_handles;
     std::vector<uint64_t> callback_handles;
     std::vector<uint64_t> swapchain_handles;
 
     BUILDER_VALUE(TestICD, bool, can_query_vkEnumerateInstanceVersion, true);
     BUILDER_VALUE(TestICD, bool, can_query_GetPhysicalDeviceFuncs, true);
+    // Returned by the surface creation functions instead of making a surface when it isn't VK_SUCCESS
+    BUILDER_VALUE(TestICD, VkResult, create_surface_return_code, VK_SUCCESS);
 
     // Unknown instance functions Add a `VulkanFunction` to this list which will be searched in
     // vkGetInstanceProcAddr for custom_instance_functions and vk_icdGetPhysicalDeviceProcAddr for
@@ -219,6 +240,7 @@ struct TestICD {
 
     BUILDER_VALUE(TestICD, VkResult, enum_physical_devices_return_code, VK_SUCCESS);
     BUILDER_VALUE(TestICD, VkResult, enum_adapter_physical_devices_return_code, VK_SUCCESS);
+    BUILDER_VALUE(TestICD, VkResult, create_device_return_code, VK_SUCCESS);
 
     PhysicalDevice& GetPhysDevice(VkPhysicalDevice physicalDevice) {
         for (auto& phys_dev : physical_devices) {
@@ -218,6 +218,20 @@ struct PlatformShim {
     std::unordered_map<std::string, std::filesystem::path> dlopen_redirection_map;
     std::unordered_set<std::string> known_path_set;
 
+    // Number of times fopen was called on each file, keyed by the path after redirection
+    std::unordered_map<std::string, size_t> fopen_counts;
+    size_t get_fopen_count(std::filesystem::path const& path) const {
+        auto it = fopen_counts.find(path.string());
+        return it != fopen_counts.end() ? it->second : 0;
+    }
+
+    // References dlopen handed out to each library which weren't released with dlclose yet
+    std::unordered_map<void*, size_t> open_library_counts;
+    size_t get_open_library_count(void* handle) const {
+        auto it = open_library_counts.find(handle);
+        return it != open_library_counts.end() ? it->second : 0;
+    }
+
     void set_elevated_privilege(bool elev) { use_fake_elevation = elev; }
     bool use_fake_elevation = false;
 
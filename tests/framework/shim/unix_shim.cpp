@@ -29,6 +29,8 @@
 
 #include <algorithm>
 
+#include <sys/stat.h>
+
 #if defined(__APPLE__)
 #include <CoreFoundation/CoreFoundation.h>
 #endif
@@ -53,8 +55,10 @@ FRAMEWORK_EXPORT PlatformShim* get_platform_shim(std::vector<fs::FolderManager>*
 #define READDIR_FUNC_NAME readdir
 #define CLOSEDIR_FUNC_NAME closedir
 #define ACCESS_FUNC_NAME access
+#define STAT_FUNC_NAME stat
 #define FOPEN_FUNC_NAME fopen
 #define DLOPEN_FUNC_NAME dlopen
+#define DLCLOSE_FUNC_NAME dlclose
 #define GETEUID_FUNC_NAME geteuid
 #define GETEGID_FUNC_NAME getegid
 #if defined(HAVE_SECURE_GETENV)
@@ -71,8 +75,10 @@ FRAMEWORK_EXPORT PlatformShim* get_platform_shim(std::vector<fs::FolderManager>*
 #define READDIR_FUNC_NAME my_readdir
 #define CLOSEDIR_FUNC_NAME my_closedir
 #define ACCESS_FUNC_NAME my_access
+#define STAT_FUNC_NAME my_stat
 #define FOPEN_FUNC_NAME my_fopen
 #define DLOPEN_FUNC_NAME my_dlopen
+#define DLCLOSE_FUNC_NAME my_dlclose
 #define GETEUID_FUNC_NAME my_geteuid
 #define GETEGID_FUNC_NAME my_getegid
 #if !defined(TARGET_OS_IPHONE)
@@ -91,8 +97,19 @@ using PFN_OPENDIR = DIR* (*)(const char* path_name);
 using PFN_READDIR = struct dirent* (*)(DIR* dir_stream);
 using PFN_CLOSEDIR = int (*)(DIR* dir_stream);
 using PFN_ACCESS = int (*)(const char* pathname, int mode);
+using PFN_STAT = int (*)(const char* pathname, struct stat* statbuf);
+#if defined(__GLIBC__) && !defined(__USE_FILE_OFFSET64) && __GLIBC_PREREQ(2, 33)
+using PFN_STAT64 = int (*)(const char* pathname, struct stat64* statbuf);
+#endif
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 33)
+using PFN_XSTAT = int (*)(int ver, const char* pathname, struct stat* statbuf);
+#if !defined(__USE_FILE_OFFSET64)
+using PFN_XSTAT64 = int (*)(int ver, const char* pathname, struct stat64* statbuf);
+#endif
+#endif
 using PFN_FOPEN = FILE* (*)(const char* filename, const char* mode);
 using PFN_DLOPEN = void* (*)(const char* in_filename, int flags);
+using PFN_DLCLOSE = int (*)(void* handle);
 using PFN_GETEUID = uid_t (*)(void);
 using PFN_GETEGID = gid_t (*)(void);
 #if defined(HAVE_SECURE_GETENV) || defined(HAVE___SECURE_GETENV)
@@ -106,8 +123,10 @@ using PFN_FPUTC = int (*)(int c, FILE* stream);
 #define real_readdir readdir
 #define real_closedir closedir
 #define real_access access
+#define real_stat stat
 #define real_fopen fopen
 #define real_dlopen dlopen
+#define real_dlclose dlclose
 #define real_geteuid geteuid
 #define real_getegid getegid
 #if defined(HAVE_SECURE_GETENV)
@@ -123,8 +142,19 @@ PFN_OPENDIR real_opendir = nullptr;
 PFN_READDIR real_readdir = nullptr;
 PFN_CLOSEDIR real_closedir = nullptr;
 PFN_ACCESS real_access = nullptr;
+PFN_STAT real_stat = nullptr;
+#if defined(__GLIBC__) && !defined(__USE_FILE_OFFSET64) && __GLIBC_PREREQ(2, 33)
+PFN_STAT64 real_stat64 = nullptr;
+#endif
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 33)
+PFN_XSTAT real__xstat = nullptr;
+#if !defined(__USE_FILE_OFFSET64)
+PFN_XSTAT64 real__xstat64 = nullptr;
+#endif
+#endif
 PFN_FOPEN real_fopen = nullptr;
 PFN_DLOPEN real_dlopen = nullptr;
+PFN_DLCLOSE real_dlclose = nullptr;
 PFN_GETEUID real_geteuid = nullptr;
 PFN_GETEGID real_getegid = nullptr;
 #if defined(HAVE_SECURE_GETENV)
@@ -256,6 +286,64 @@ FRAMEWORK_EXPORT int ACCESS_FUNC_NAME(const char* in_pathname, int mode) {
     return real_access(in_pathname, mode);
 }
 
+// Calls stat_func with the real path when in_pathname is inside of a fake path, and with in_pathname otherwise
+template <typename StatFunc>
+int redirect_stat_call(const char* in_pathname, StatFunc stat_func) {
+    if (platform_shim.is_during_destruction) {
+        return stat_func(in_pathname);
+    }
+    std::filesystem::path path{in_pathname};
+    if (!path.has_parent_path()) {
+        return stat_func(in_pathname);
+    }
+
+    if (platform_shim.is_fake_path(path.parent_path())) {
+        std::filesystem::path real_path = platform_shim.get_real_path_from_fake_path(path.parent_path());
+        real_path /= path.filename();
+        return stat_func(real_path.c_str());
+    }
+    return stat_func(in_pathname);
+}
+
+FRAMEWORK_EXPORT int STAT_FUNC_NAME(const char* in_pathname, struct stat* statbuf) {
+#if !defined(__APPLE__)
+    if (!real_stat) {
+        if (sizeof(void*) == 8) {
+            real_stat = (PFN_STAT)dlsym(RTLD_NEXT, "stat");
+        } else {
+            // Necessary to specify the 64 bit stat version since that is what is linked in when using _FILE_OFFSET_BITS
+            real_stat = (PFN_STAT)dlsym(RTLD_NEXT, "stat64");
+        }
+    }
+#endif
+    return redirect_stat_call(in_pathname, [statbuf](const char* pathname) { return real_stat(pathname, statbuf); });
+}
+
+// Code built with _FILE_OFFSET_BITS=64, or calling stat64 directly, links against stat64 instead of stat. When this file is
+// built with _FILE_OFFSET_BITS=64 the stat hook above is already exported as stat64 by the glibc headers.
+#if defined(__GLIBC__) && !defined(__USE_FILE_OFFSET64) && __GLIBC_PREREQ(2, 33)
+FRAMEWORK_EXPORT int stat64(const char* in_pathname, struct stat64* statbuf) {
+    if (!real_stat64) real_stat64 = (PFN_STAT64)dlsym(RTLD_NEXT, "stat64");
+    return redirect_stat_call(in_pathname, [statbuf](const char* pathname) { return real_stat64(pathname, statbuf); });
+}
+#endif
+
+// Older versions of glibc implement stat and stat64 as inline functions which call __xstat and __xstat64
+#if defined(__GLIBC__) && !__GLIBC_PREREQ(2, 33)
+FRAMEWORK_EXPORT int __xstat(int ver, const char* in_pathname, struct stat* statbuf) {
+    if (!real__xstat) real__xstat = (PFN_XSTAT)dlsym(RTLD_NEXT, "__xstat");
+    return redirect_stat_call(in_pathname, [ver, statbuf](const char* pathname) { return real__xstat(ver, pathname, statbuf); });
+}
+
+#if !defined(__USE_FILE_OFFSET64)
+FRAMEWORK_EXPORT int __xstat64(int ver, const char* in_pathname, struct stat64* statbuf) {
+    if (!real__xstat64) real__xstat64 = (PFN_XSTAT64)dlsym(RTLD_NEXT, "__xstat64");
+    return redirect_stat_call(in_pathname,
+                              [ver, statbuf](const char* pathname) { return real__xstat64(ver, pathname, statbuf); });
+}
+#endif
+#endif
+
 FRAMEWORK_EXPORT FILE* FOPEN_FUNC_NAME(const char* in_filename, const char* mode) {
 #if !defined(__APPLE__)
     if (!real_fopen) real_fopen = (PFN_FOPEN)dlsym(RTLD_NEXT, "fopen");
@@ -269,8 +357,10 @@ FRAMEWORK_EXPORT FILE* FOPEN_FUNC_NAME(const char* in_filename, const char* mode
     if (platform_shim.is_fake_path(path.parent_path())) {
         auto real_path = platform_shim.get_real_path_from_fake_path(path.parent_path()) / path.filename();
         f_ptr = real_fopen(real_path.c_str(), mode);
+        if (!platform_shim.is_during_destruction) platform_shim.fopen_counts[real_path.string()]++;
     } else {
         f_ptr = real_fopen(in_filename, mode);
+        if (!platform_shim.is_during_destruction) platform_shim.fopen_counts[path.string()]++;
     }
 
     return f_ptr;
@@ -281,10 +371,25 @@ FRAMEWORK_EXPORT void* DLOPEN_FUNC_NAME(const char* in_filename, int flags) {
     if (!real_dlopen) real_dlopen = (PFN_DLOPEN)dlsym(RTLD_NEXT, "dlopen");
 #endif
 
-    if (platform_shim.is_dlopen_redirect_name(in_filename)) {
-        return real_dlopen(platform_shim.dlopen_redirection_map[in_filename].c_str(), flags);
+    void* handle = nullptr;
+    if (in_filename != nullptr && platform_shim.is_dlopen_redirect_name(in_filename)) {
+        handle = real_dlopen(platform_shim.dlopen_redirection_map[in_filename].c_str(), flags);
+    } else {
+        handle = real_dlopen(in_filename, flags);
+    }
+    if (handle != nullptr && !platform_shim.is_during_destruction) platform_shim.open_library_counts[handle]++;
+    return handle;
+}
+
+FRAMEWORK_EXPORT int DLCLOSE_FUNC_NAME(void* handle) {
+#if !defined(__APPLE__)
+    if (!real_dlclose) real_dlclose = (PFN_DLCLOSE)dlsym(RTLD_NEXT, "dlclose");
+#endif
+    if (!platform_shim.is_during_destruction) {
+        auto it = platform_shim.open_library_counts.find(handle);
+        if (it != platform_shim.open_library_counts.end() && it->second > 0) it->second--;
     }
-    return real_dlopen(in_filename, flags);
+    return real_dlclose(handle);
 }
 
 FRAMEWORK_EXPORT uid_t GETEUID_FUNC_NAME(void) {
@@ -400,8 +505,10 @@ __attribute__((used)) static Interposer _interpose_opendir MACOS_ATTRIB = {VOIDP
 __attribute__((used)) static Interposer _interpose_readdir MACOS_ATTRIB = {VOIDP_CAST(my_readdir), VOIDP_CAST(readdir)};
 __attribute__((used)) static Interposer _interpose_closedir MACOS_ATTRIB = {VOIDP_CAST(my_closedir), VOIDP_CAST(closedir)};
 __attribute__((used)) static Interposer _interpose_access MACOS_ATTRIB = {VOIDP_CAST(my_access), VOIDP_CAST(access)};
+__attribute__((used)) static Interposer _interpose_stat MACOS_ATTRIB = {VOIDP_CAST(my_stat), VOIDP_CAST(stat)};
 __attribute__((used)) static Interposer _interpose_fopen MACOS_ATTRIB = {VOIDP_CAST(my_fopen), VOIDP_CAST(fopen)};
 __attribute__((used)) static Interposer _interpose_dlopen MACOS_ATTRIB = {VOIDP_CAST(my_dlopen), VOIDP_CAST(dlopen)};
+__attribute__((used)) static Interposer _interpose_dlclose MACOS_ATTRIB = {VOIDP_CAST(my_dlclose), VOIDP_CAST(dlclose)};
 __attribute__((used)) static Interposer _interpose_euid MACOS_ATTRIB = {VOIDP_CAST(my_geteuid), VOIDP_CAST(geteuid)};
 __attribute__((used)) static Interposer _interpose_egid MACOS_ATTRIB = {VOIDP_CAST(my_getegid), VOIDP_CAST(getegid)};
 #if !defined(TARGET_OS_IPHONE)
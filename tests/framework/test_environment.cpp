@@ -753,6 +753,16 @@ std::string get_loader_settings_file_contents(const LoaderSettings& loader_setti
             }
             writer.EndArray();
         }
+        if (!setting.log_file.empty()) {
+            writer.AddKeyedString("log_file", setting.log_file.native());
+        }
+        if (!setting.log_file_level.empty()) {
+            writer.StartKeyedArray("log_file_level");
+            for (const auto& filter : setting.log_file_level) {
+                writer.AddString(filter);
+            }
+            writer.EndArray();
+        }
         if (!setting.log_configurations.empty()) {
             writer.StartKeyedArray("log_locations");
             for (const auto& config : setting.log_configurations) {
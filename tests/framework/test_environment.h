@@ -505,6 +505,8 @@ struct AppSpecificSettings {
     BUILDER_VECTOR(AppSpecificSettings, LoaderSettingsLayerConfiguration, layer_configurations, layer_configuration)
     BUILDER_VECTOR(AppSpecificSettings, std::string, stderr_log, stderr_log_filter)
     BUILDER_VECTOR(AppSpecificSettings, LoaderLogConfiguration, log_configurations, log_configuration)
+    BUILDER_VALUE(AppSpecificSettings, std::filesystem::path, log_file, {})
+    BUILDER_VECTOR(AppSpecificSettings, std::string, log_file_level, log_file_level_filter)
 };
 
 struct LoaderSettings {
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and/or associated documentation files (the "Materials"), to
+ * deal in the Materials without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Materials, and to permit persons to whom the Materials are
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be included in
+ * all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE MATERIALS OR THE
+ * USE OR OTHER DEALINGS IN THE MATERIALS.
+ *
+ */
+
+// Times vkCreateDevice & vkDestroyDevice with the test driver and a chain of 0 to 20 implicit test layers, once with the device
+// dispatch table filled in eagerly and once with VK_LOADER_LAZY_DEVICE_DISPATCH=1. The driver and layers are set up by the test
+// framework so that the timings don't depend on what is installed on the machine or on the VK_INSTANCE_LAYERS of the shell.
+
+#include "test_environment.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct Timings {
+    std::chrono::microseconds average{};
+    std::chrono::microseconds median{};
+    std::chrono::microseconds min{};
+};
+
+Timings time_device_creation(uint32_t layer_count, bool lazy, uint32_t iterations) {
+    EnvVarWrapper lazy_device_dispatch_env_var{"VK_LOADER_LAZY_DEVICE_DISPATCH", lazy ? "1" : "0"};
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA)).add_physical_device("physical_device_0");
+    std::vector<std::unique_ptr<EnvVarWrapper>> disable_env_vars;
+    for (uint32_t i = 0; i < layer_count; i++) {
+        disable_env_vars.push_back(std::make_unique<EnvVarWrapper>("DISABLE_ME_" + std::to_string(i)));
+        env.add_implicit_layer(ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                             .set_name("VK_LAYER_ImplicitTestLayer_" + std::to_string(i))
+                                                             .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                                                             .set_disable_environment(disable_env_vars.back()->get())),
+                               "implicit_test_layer_" + std::to_string(i) + ".json");
+    }
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    VkPhysicalDevice phys_dev = inst.GetPhysDev();
+
+    std::vector<std::chrono::microseconds> samples;
+    samples.resize(iterations);
+    for (uint32_t i = 0; i < iterations; i++) {
+        DeviceWrapper dev{inst};
+        dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(0.0f));
+        auto t1 = std::chrono::steady_clock::now();
+        dev.CheckCreate(phys_dev);
+        env.vulkan_functions.vkDestroyDevice(dev.dev, nullptr);
+        dev.dev = VK_NULL_HANDLE;
+        auto t2 = std::chrono::steady_clock::now();
+        samples[i] = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1);
+    }
+
+    Timings timings{};
+    std::chrono::microseconds total_time{};
+    for (uint32_t i = 0; i < iterations; i++) {
+        total_time += samples[i];
+    }
+    std::sort(samples.begin(), samples.end());
+    timings.average = total_time / iterations;
+    timings.median = samples[iterations / 2];
+    timings.min = samples[0];
+    return timings;
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = 100;
+    if (argc > 1) {
+        iterations = static_cast<uint32_t>(std::max(1, std::atoi(argv[1])));
+    }
+
+    // Only the layers and drivers set up by the framework may be found
+    EnvVarWrapper vk_icd_filenames_env_var{"VK_ICD_FILENAMES"};
+    EnvVarWrapper vk_driver_files_env_var{"VK_DRIVER_FILES"};
+    EnvVarWrapper vk_add_driver_files_env_var{"VK_ADD_DRIVER_FILES"};
+    EnvVarWrapper vk_layer_path_env_var{"VK_LAYER_PATH"};
+    EnvVarWrapper vk_add_layer_path_env_var{"VK_ADD_LAYER_PATH"};
+    EnvVarWrapper vk_implicit_layer_path_env_var{"VK_IMPLICIT_LAYER_PATH"};
+    EnvVarWrapper vk_add_implicit_layer_path_env_var{"VK_ADD_IMPLICIT_LAYER_PATH"};
+    EnvVarWrapper vk_instance_layers_env_var{"VK_INSTANCE_LAYERS"};
+    EnvVarWrapper vk_loader_layers_enable_env_var{"VK_LOADER_LAYERS_ENABLE"};
+    EnvVarWrapper vk_loader_layers_disable_env_var{"VK_LOADER_LAYERS_DISABLE"};
+    EnvVarWrapper vk_loader_debug_env_var{"VK_LOADER_DEBUG"};
+#if COMMON_UNIX_PLATFORMS
+    EnvVarWrapper xdg_config_home_env_var{"XDG_CONFIG_HOME", ETC_DIR};
+    EnvVarWrapper xdg_config_dirs_env_var{"XDG_CONFIG_DIRS"};
+    EnvVarWrapper xdg_data_home_env_var{"XDG_DATA_HOME"};
+    EnvVarWrapper xdg_data_dirs_env_var{"XDG_DATA_DIRS"};
+    EnvVarWrapper home_env_var{"HOME", HOME_DIR};
+#endif
+
+    std::cout << std::setw(8) << "Layers" << std::setw(8) << "Lazy" << std::setw(16) << "Average (μs)" << std::setw(16)
+              << "Median (μs)" << std::setw(16) << "Min (μs)" << "\n";
+    for (uint32_t layer_count : {0U, 1U, 5U, 10U, 20U}) {
+        for (bool lazy : {false, true}) {
+            Timings timings = time_device_creation(layer_count, lazy, iterations);
+            std::cout << std::setw(8) << layer_count << std::setw(8) << (lazy ? "on" : "off") << std::setw(16)
+                      << timings.average.count() << std::setw(16) << timings.median.count() << std::setw(16)
+                      << timings.min.count() << "\n";
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2023 The Khronos Group Inc.
+ * Copyright (c) 2023 Valve Corporation
+ * Copyright (c) 2023 LunarG, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and/or associated documentation files (the "Materials"), to
+ * deal in the Materials without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Materials, and to permit persons to whom the Materials are
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be included in
+ * all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE MATERIALS OR THE
+ * USE OR OTHER DEALINGS IN THE MATERIALS.
+ *
+ */
+
+// Times vkCreateInstance & vkDestroyInstance against the drivers and layers installed on the system.
+// Run it without VK_LOADER_DEBUG set to measure the cost of the loader when logging is disabled.
+
+#include <vulkan/vulkan.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv) {
+    uint32_t iterations = 100;
+    if (argc > 1) {
+        iterations = static_cast<uint32_t>(std::max(1, std::atoi(argv[1])));
+    }
+    if (std::getenv("VK_LOADER_DEBUG") != nullptr) {
+        std::cout << "VK_LOADER_DEBUG is set, the timings will include the cost of logging\n";
+    }
+
+    VkInstanceCreateInfo ci{};
+    ci.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+
+    std::vector<std::chrono::microseconds> samples;
+    samples.resize(iterations);
+    for (uint32_t i = 0; i < iterations; i++) {
+        auto t1 = std::chrono::steady_clock::now();
+        VkInstance inst{};
+        VkResult res = vkCreateInstance(&ci, nullptr, &inst);
+        if (res != VK_SUCCESS) {
+            std::cout << "vkCreateInstance failed with " << res << "\n";
+            return -1;
+        }
+        vkDestroyInstance(inst, nullptr);
+        auto t2 = std::chrono::steady_clock::now();
+        samples[i] = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1);
+    }
+
+    std::chrono::microseconds total_time{};
+    for (uint32_t i = 0; i < iterations; i++) {
+        total_time += samples[i];
+    }
+    std::sort(samples.begin(), samples.end());
+    std::cout << std::setw(10) << "Iterations" << std::setw(16) << "Average (μs)" << std::setw(16) << "Median (μs)"
+              << std::setw(16) << "Min (μs)" << "\n";
+    std::cout << std::setw(10) << iterations << std::setw(16) << total_time.count() / iterations << std::setw(16)
+              << samples[iterations / 2].count() << std::setw(16) << samples[0].count() << "\n";
+}
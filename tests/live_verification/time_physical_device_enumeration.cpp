@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 The Khronos Group Inc.
+ * Copyright (c) 2025 Valve Corporation
+ * Copyright (c) 2025 LunarG, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and/or associated documentation files (the "Materials"), to
+ * deal in the Materials without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Materials, and to permit persons to whom the Materials are
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be included in
+ * all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE MATERIALS OR THE
+ * USE OR OTHER DEALINGS IN THE MATERIALS.
+ *
+ */
+
+// Times repeated vkEnumeratePhysicalDevices & vkEnumeratePhysicalDeviceGroups calls on one instance. Every call after the first
+// matches the physical devices the drivers report against the ones handed out before, so the time per call shows how well that
+// matching scales with the number of physical devices. Pointing VK_DRIVER_FILES at many drivers, or at a driver exposing many
+// devices such as the SR-IOV virtual functions of a GPU, makes the difference between loader builds easy to see.
+
+#include <vulkan/vulkan.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct TimingResult {
+    std::string name;
+    std::vector<std::chrono::microseconds> samples;
+};
+
+void print_results(uint32_t phys_dev_count, std::vector<TimingResult>& results) {
+    std::cout << "Physical devices: " << phys_dev_count << "\n";
+    std::cout << std::setw(36) << "Call" << std::setw(10) << "Iterations" << std::setw(16) << "Average (μs)" << std::setw(16)
+              << "Median (μs)" << std::setw(16) << "Min (μs)" << "\n";
+    for (auto& result : results) {
+        std::chrono::microseconds total_time{};
+        for (auto const& sample : result.samples) {
+            total_time += sample;
+        }
+        size_t iterations = result.samples.size();
+        std::sort(result.samples.begin(), result.samples.end());
+        std::cout << std::setw(36) << result.name << std::setw(10) << iterations << std::setw(16) << total_time.count() / iterations
+                  << std::setw(16) << result.samples[iterations / 2].count() << std::setw(16) << result.samples[0].count() << "\n";
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = 100;
+    if (argc > 1) {
+        iterations = static_cast<uint32_t>(std::max(1, std::atoi(argv[1])));
+    }
+    if (std::getenv("VK_LOADER_DEBUG") != nullptr) {
+        std::cout << "VK_LOADER_DEBUG is set, the timings will include the cost of logging\n";
+    }
+
+    VkApplicationInfo app_info{};
+    app_info.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    app_info.apiVersion = VK_API_VERSION_1_1;
+    VkInstanceCreateInfo ci{};
+    ci.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    ci.pApplicationInfo = &app_info;
+    VkInstance inst{};
+    VkResult res = vkCreateInstance(&ci, nullptr, &inst);
+    if (res != VK_SUCCESS) {
+        std::cout << "vkCreateInstance failed with " << res << "\n";
+        return -1;
+    }
+
+    uint32_t phys_dev_count = 0;
+    res = vkEnumeratePhysicalDevices(inst, &phys_dev_count, nullptr);
+    if (res != VK_SUCCESS || phys_dev_count == 0) {
+        std::cout << "No physical devices were found\n";
+        vkDestroyInstance(inst, nullptr);
+        return -1;
+    }
+    std::vector<VkPhysicalDevice> phys_devs(phys_dev_count);
+    uint32_t group_count = 0;
+    res = vkEnumeratePhysicalDeviceGroups(inst, &group_count, nullptr);
+    if (res != VK_SUCCESS) {
+        std::cout << "vkEnumeratePhysicalDeviceGroups failed with " << res << "\n";
+        vkDestroyInstance(inst, nullptr);
+        return -1;
+    }
+    std::vector<VkPhysicalDeviceGroupProperties> groups(group_count);
+
+    std::vector<TimingResult> results = {{"vkEnumeratePhysicalDevices (count)", {}},
+                                         {"vkEnumeratePhysicalDevices (all)", {}},
+                                         {"vkEnumeratePhysicalDevices (half)", {}},
+                                         {"vkEnumeratePhysicalDeviceGroups (all)", {}}};
+    for (auto& result : results) {
+        result.samples.resize(iterations);
+    }
+    for (uint32_t i = 0; i < iterations; i++) {
+        uint32_t count = 0;
+        auto t1 = std::chrono::steady_clock::now();
+        vkEnumeratePhysicalDevices(inst, &count, nullptr);
+        auto t2 = std::chrono::steady_clock::now();
+        results[0].samples[i] = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1);
+
+        count = phys_dev_count;
+        t1 = std::chrono::steady_clock::now();
+        vkEnumeratePhysicalDevices(inst, &count, phys_devs.data());
+        t2 = std::chrono::steady_clock::now();
+        results[1].samples[i] = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1);
+
+        // Asking for fewer devices than there are still reconciles every device the drivers report
+        count = std::max(1U, phys_dev_count / 2);
+        t1 = std::chrono::steady_clock::now();
+        vkEnumeratePhysicalDevices(inst, &count, phys_devs.data());
+        t2 = std::chrono::steady_clock::now();
+        results[2].samples[i] = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1);
+
+        count = group_count;
+        for (auto& group : groups) {
+            group = VkPhysicalDeviceGroupProperties{};
+            group.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES;
+        }
+        t1 = std::chrono::steady_clock::now();
+        vkEnumeratePhysicalDeviceGroups(inst, &count, groups.data());
+        t2 = std::chrono::steady_clock::now();
+        results[3].samples[i] = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1);
+    }
+    vkDestroyInstance(inst, nullptr);
+
+    print_results(phys_dev_count, results);
+}
@@ -52,6 +52,9 @@ class MemoryTracker {
     const static size_t UNKNOWN_ALLOCATION = std::numeric_limits<size_t>::max();
     size_t allocation_count = 0;
     size_t call_count = 0;
+    size_t instance_scope_allocation_count = 0;  // allocations made with VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE, including reallocs
+    size_t allocated_bytes = 0;                  // requested bytes of every live allocation
+    size_t peak_allocated_bytes = 0;
     std::unordered_map<void*, AllocationDetails> allocations;
 
     void* allocate(size_t size, size_t alignment, VkSystemAllocationScope alloc_scope) {
@@ -61,6 +64,7 @@ class MemoryTracker {
         }
         call_count++;
         allocation_count++;
+        if (alloc_scope == VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE) instance_scope_allocation_count++;
         AllocationDetails detail{nullptr, size, size + (alignment - 1), alignment, alloc_scope};
         detail.allocation = std::unique_ptr<char[]>(new char[detail.actual_size_bytes]);
         if (!detail.allocation) {
@@ -71,6 +75,8 @@ class MemoryTracker {
         addr &= ~(alignment - 1);
         void* aligned_alloc = (void*)addr;
         allocations.insert(std::make_pair(aligned_alloc, std::move(detail)));
+        allocated_bytes += size;
+        peak_allocated_bytes = std::max(peak_allocated_bytes, allocated_bytes);
         return aligned_alloc;
     }
     void* reallocate(void* pOriginal, size_t size, size_t alignment, VkSystemAllocationScope alloc_scope) {
@@ -88,6 +94,7 @@ class MemoryTracker {
         if (size == 0) {
             allocations.erase(elem);
             allocation_count--;
+            allocated_bytes -= original_size;
             return nullptr;
         } else if (size < original_size) {
             return pOriginal;
@@ -98,6 +105,7 @@ class MemoryTracker {
             call_count--;        // allocate() also increments this, we don't want that
             memcpy(new_alloc, pOriginal, original_size);
             allocations.erase(elem);
+            allocated_bytes -= original_size;
             return new_alloc;
         }
     }
@@ -108,6 +116,7 @@ class MemoryTracker {
             assert(false && "Should never be freeing memory that wasn't allocated by the MemoryTracker!");
             return;
         }
+        allocated_bytes -= elem->second.requested_size_bytes;
         allocations.erase(elem);
         assert(allocation_count != 0 && "Cant free when there are no valid allocations");
         allocation_count--;
@@ -157,6 +166,17 @@ class MemoryTracker {
 
     bool empty() noexcept { return allocation_count == 0; }
 
+    size_t get_instance_scope_allocation_count() noexcept {
+        std::lock_guard<std::mutex> lg(main_mutex);
+        return instance_scope_allocation_count;
+    }
+
+    // Most bytes that were allocated at the same time
+    size_t get_peak_allocated_bytes() noexcept {
+        std::lock_guard<std::mutex> lg(main_mutex);
+        return peak_allocated_bytes;
+    }
+
     // Static callbacks
     static VKAPI_ATTR void* VKAPI_CALL public_allocation(void* pUserData, size_t size, size_t alignment,
                                                          VkSystemAllocationScope allocationScope) noexcept {
@@ -194,6 +214,70 @@ TEST(Allocation, Instance) {
     ASSERT_TRUE(tracker.empty());
 }
 
+// Test that the instance data allocated in bulk during vkCreateInstance is released properly, even when lists created during
+// creation are grown afterwards. Allocating each layer's data separately takes at least three instance scoped calls per layer
+// (its manifest file name and the name and value of its disable environment variable), while the arena only needs a call per
+// chunk on top of the one string cJSON prints for each layer's library path. Only data that lives as long as the instance goes
+// into the arena, so its peak memory use can't be more than a chunk above that of creating the same instance without it.
+TEST(Allocation, InstanceWithManyLayers) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device("physical_device_0");
+
+    for (uint32_t i = 0; i < 40; i++) {
+        env.add_implicit_layer(ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                             .set_name("VK_LAYER_implicit_layer_" + std::to_string(i))
+                                                             .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                                                             .set_disable_environment("DISABLE_ENV")),
+                               "implicit_layer_" + std::to_string(i) + ".json");
+    }
+
+#if !defined(APPLE_STATIC_LOADER)
+    bool* arena_enabled = env.vulkan_functions.loader.get_symbol("loader_instance_arena_enabled");
+    ASSERT_NE(arena_enabled, nullptr);
+    MemoryTracker tracker_without_arena;
+    *arena_enabled = false;
+    {
+        InstWrapper inst{env.vulkan_functions, tracker_without_arena.get()};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+    }
+    *arena_enabled = true;
+    ASSERT_TRUE(tracker_without_arena.empty());
+#endif
+
+    MemoryTracker tracker;
+    {
+        InstWrapper inst{env.vulkan_functions, tracker.get()};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        ASSERT_NO_FATAL_FAILURE(inst.CheckCreate());
+        ASSERT_LT(tracker.get_instance_scope_allocation_count(), 3U * 40U);
+#if !defined(APPLE_STATIC_LOADER)
+        // One chunk plus the bookkeeping that sorts the chunks
+        ASSERT_LE(tracker.get_peak_allocated_bytes(), tracker_without_arena.get_peak_allocated_bytes() + 64U * 1024U + 1024U);
+#endif
+
+        auto layers = inst.GetActiveLayers(inst.GetPhysDev(), 40);
+        ASSERT_EQ(layers.size(), 40U);
+
+        // Enough messengers to grow the list that was set up during vkCreateInstance
+        std::vector<VkDebugUtilsMessengerEXT> messengers(40);
+        VkDebugUtilsMessengerCreateInfoEXT messenger_create_info{VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT};
+        messenger_create_info.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+        messenger_create_info.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT;
+        messenger_create_info.pfnUserCallback = DebugUtilsLogger::DebugUtilsMessengerLoggerCallback;
+        messenger_create_info.pUserData = &env.debug_log;
+        PFN_vkCreateDebugUtilsMessengerEXT create_messenger = inst.load("vkCreateDebugUtilsMessengerEXT");
+        PFN_vkDestroyDebugUtilsMessengerEXT destroy_messenger = inst.load("vkDestroyDebugUtilsMessengerEXT");
+        for (auto& messenger : messengers) {
+            ASSERT_EQ(VK_SUCCESS, create_messenger(inst, &messenger_create_info, tracker.get(), &messenger));
+        }
+        for (auto& messenger : messengers) {
+            destroy_messenger(inst, messenger, tracker.get());
+        }
+    }
+    ASSERT_TRUE(tracker.empty());
+}
+
 // Test making sure the allocation functions are called to allocate and cleanup everything during
 // a CreateInstance/DestroyInstance call pair with a call to GetInstanceProcAddr.
 TEST(Allocation, GetInstanceProcAddr) {
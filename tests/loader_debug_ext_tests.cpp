@@ -851,6 +851,81 @@ TEST_F(ManualMessage, InfoMessage) {
     ASSERT_EQ(true, message_found);
 }
 
+// Test that messages stop being delivered once the only messenger which accepts them is destroyed, while messengers with other
+// severities are still present
+TEST_F(ManualMessage, InfoMessageIgnoredAfterMessengerDestroyed) {
+    const char my_message[] = "This is my special message!";
+    expected_message = my_message;
+    expected_object_type = VK_OBJECT_TYPE_INSTANCE;
+    expected_message_flags = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT;
+    expected_severity_flags = VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT;
+
+    VkInstance inst = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, CreateUtilsInstance(VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT,
+                                              VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT, &inst));
+
+    VkDebugUtilsMessengerEXT error_messenger = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, CreateUtilsMessenger(inst, VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT,
+                                               VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT, &error_messenger));
+    VkDebugUtilsMessengerEXT info_messenger = VK_NULL_HANDLE;
+    ASSERT_EQ(VK_SUCCESS, CreateUtilsMessenger(inst, VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT,
+                                               VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT, &info_messenger));
+
+    PFN_vkSubmitDebugUtilsMessageEXT submit_message = reinterpret_cast<PFN_vkSubmitDebugUtilsMessageEXT>(
+        env->vulkan_functions.vkGetInstanceProcAddr(inst, "vkSubmitDebugUtilsMessageEXT"));
+    ASSERT_NE(nullptr, submit_message);
+
+    VkDebugUtilsObjectNameInfoEXT object{VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT};
+    object.objectType = VK_OBJECT_TYPE_INSTANCE;
+    object.objectHandle = (uint64_t)inst;
+    VkDebugUtilsMessengerCallbackDataEXT message_data{VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT};
+    message_data.pMessage = my_message;
+    message_data.objectCount = 1;
+    message_data.pObjects = &object;
+    submit_message(inst, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT, &message_data);
+    ASSERT_EQ(true, message_found);
+
+    ASSERT_EQ(VK_SUCCESS, DestroyUtilsMessenger(inst, info_messenger));
+    message_found = false;
+    submit_message(inst, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT, &message_data);
+    ASSERT_EQ(false, message_found);
+
+    ASSERT_EQ(VK_SUCCESS, DestroyUtilsMessenger(inst, error_messenger));
+    env->vulkan_functions.vkDestroyInstance(inst, nullptr);
+}
+
+TEST(DebugUtils, DriverMessengersCreatedOnFirstDevice) {
+    FrameworkEnvironment env{};
+    for (uint32_t i = 0; i < 2; i++) {
+        env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2))
+            .add_instance_extension(VK_EXT_DEBUG_UTILS_EXTENSION_NAME)
+            .add_physical_device(PhysicalDevice{}.set_api_version(VK_API_VERSION_1_1).finish());
+    }
+    auto messenger_count = [&env]() {
+        return env.get_test_icd(0).messenger_handles.size() + env.get_test_icd(1).messenger_handles.size();
+    };
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.create_info.add_extension(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    inst.CheckCreate();
+    {
+        DebugUtilsWrapper log{inst};
+        ASSERT_EQ(VK_SUCCESS, CreateDebugUtilsMessenger(log));
+        // No driver is in use yet, so none of them was asked to create the messenger
+        ASSERT_EQ(0U, messenger_count());
+
+        DeviceWrapper device{inst};
+        device.CheckCreate(inst.GetPhysDevs(2).at(0));
+        ASSERT_EQ(1U, messenger_count());
+
+        // Messengers made after the device exists go straight to the driver which is in use
+        DebugUtilsWrapper second_log{inst};
+        ASSERT_EQ(VK_SUCCESS, CreateDebugUtilsMessenger(second_log));
+        ASSERT_EQ(2U, messenger_count());
+    }
+    ASSERT_EQ(0U, messenger_count());
+}
+
 void CheckDeviceFunctions(FrameworkEnvironment& env, bool use_GIPA, bool enable_debug_extensions,
                           bool hardware_supports_debug_exts) {
     InstWrapper inst(env.vulkan_functions);
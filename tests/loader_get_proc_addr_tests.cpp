@@ -27,6 +27,9 @@
 
 #include "test_environment.h"
 
+#include <algorithm>
+#include <regex>
+
 // Verify that the various ways to get vkGetInstanceProcAddr return the same value
 TEST(GetProcAddr, VerifyGetInstanceProcAddr) {
     FrameworkEnvironment env{};
@@ -81,6 +84,143 @@ TEST(GetProcAddr, VerifyGetDeviceProcAddr) {
     ASSERT_EQ(gdpa_loader, gdpa_dev_queried);
 }
 
+// With VK_LOADER_LAZY_DEVICE_DISPATCH set, device commands are resolved on first use but the application must not be able to tell
+TEST(GetDeviceProcAddr, LazyDeviceDispatch) {
+    EnvVarWrapper lazy_device_dispatch_env_var{"VK_LOADER_LAZY_DEVICE_DISPATCH", "1"};
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA)).add_physical_device("physical_device_0");
+    env.add_implicit_layer(ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                         .set_name("VK_LAYER_implicit_layer")
+                                                         .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                                                         .set_disable_environment("DISABLE_ME")),
+                           "implicit_layer.json");
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+
+    DeviceWrapper dev{inst};
+    dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(0.0f));
+    dev.CheckCreate(inst.GetPhysDev());
+
+    // The loader's exported entrypoints go through the stubs in the dispatch table
+    VkQueue queue{};
+    env.vulkan_functions.vkGetDeviceQueue(dev.dev, 0, 0, &queue);
+    ASSERT_NE(queue, VK_NULL_HANDLE);
+
+    PFN_vkCreateCommandPool CreateCommandPool = dev.load("vkCreateCommandPool");
+    ASSERT_NE(CreateCommandPool, nullptr);
+    ASSERT_EQ(CreateCommandPool, dev.load("vkCreateCommandPool"));
+    PFN_vkDestroyCommandPool DestroyCommandPool = dev.load("vkDestroyCommandPool");
+    ASSERT_NE(DestroyCommandPool, nullptr);
+
+    VkCommandPool cmd_pool{};
+    VkCommandPoolCreateInfo cmd_pool_info{};
+    cmd_pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    ASSERT_EQ(VK_SUCCESS, CreateCommandPool(dev.dev, &cmd_pool_info, nullptr, &cmd_pool));
+    DestroyCommandPool(dev.dev, cmd_pool, nullptr);
+
+    // Commands from extensions which weren't enabled are still NULL rather than a stub
+    PFN_vkCreateSwapchainKHR CreateSwapchainKHR = dev.load("vkCreateSwapchainKHR");
+    ASSERT_EQ(CreateSwapchainKHR, nullptr);
+    PFN_vkCreateSharedSwapchainsKHR CreateSharedSwapchainsKHR = dev.load("vkCreateSharedSwapchainsKHR");
+    ASSERT_EQ(CreateSharedSwapchainsKHR, nullptr);
+    PFN_vkDebugMarkerSetObjectNameEXT DebugMarkerSetObjectNameEXT = dev.load("vkDebugMarkerSetObjectNameEXT");
+    ASSERT_EQ(DebugMarkerSetObjectNameEXT, nullptr);
+}
+
+// Creates a device without any layers in between, using vkCreateCommandPool call_count times, and returns the number of names the
+// driver's vkGetDeviceProcAddr was asked for while the device was created
+size_t get_driver_device_lookups_at_creation(bool lazy, uint32_t call_count) {
+    EnvVarWrapper lazy_device_dispatch_env_var{"VK_LOADER_LAZY_DEVICE_DISPATCH", lazy ? "1" : "0"};
+    FrameworkEnvironment env{};
+    auto& driver = env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA)).add_physical_device("physical_device_0");
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    DeviceWrapper dev{inst};
+    dev.create_info.add_device_queue(DeviceQueueCreateInfo{}.add_priority(0.0f));
+    dev.CheckCreate(inst.GetPhysDev());
+    size_t lookups_at_creation = driver.device_proc_addr_queries.size();
+
+    auto queries = [&driver](const char* name) {
+        return std::count(driver.device_proc_addr_queries.begin(), driver.device_proc_addr_queries.end(), name);
+    };
+    auto lookups_of_command = queries("vkCreateCommandPool");
+    if (lazy) {
+        EXPECT_EQ(lookups_of_command, 0);
+    }
+    VkCommandPoolCreateInfo cmd_pool_info{};
+    cmd_pool_info.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    for (uint32_t i = 0; i < call_count; i++) {
+        VkCommandPool cmd_pool{};
+        EXPECT_EQ(VK_SUCCESS, env.vulkan_functions.vkCreateCommandPool(dev.dev, &cmd_pool_info, nullptr, &cmd_pool));
+        env.vulkan_functions.vkDestroyCommandPool(dev.dev, cmd_pool, nullptr);
+    }
+    // However often it is called, a command which hadn't been looked up yet is looked up in the driver once
+    EXPECT_EQ(queries("vkCreateCommandPool"), lookups_of_command + (lazy && call_count > 0 ? 1 : 0));
+    return lookups_at_creation;
+}
+
+// With VK_LOADER_LAZY_DEVICE_DISPATCH set, vkCreateDevice skips looking up commands which haven't been used yet in the driver
+TEST(GetDeviceProcAddr, LazyDeviceDispatchSkipsDriverLookups) {
+    size_t eager_lookups = get_driver_device_lookups_at_creation(false, 2);
+    size_t lazy_lookups = get_driver_device_lookups_at_creation(true, 2);
+    ASSERT_GT(eager_lookups, 0U);
+    ASSERT_LT(lazy_lookups, eager_lookups / 2);
+    ASSERT_EQ(lazy_lookups, get_driver_device_lookups_at_creation(true, 0));
+}
+
+// The dispatch table only holds the commands of enabled extensions and of the API versions the device and application use, the
+// commands of other extensions and versions must return NULL even when the driver exposes them.
+TEST(GetDeviceProcAddr, OnlyEnabledExtensionCommandsQueried) {
+    FrameworkEnvironment env{};
+    auto& driver = env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA))
+                       .add_physical_device(PhysicalDevice{}
+                                                .add_extension(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME)
+                                                .add_extension(VK_EXT_SHADER_OBJECT_EXTENSION_NAME)
+                                                .finish());
+    std::vector<const char*> functions = {"vkCmdSetCullModeEXT", "vkTrimCommandPool"};
+    for (const auto& f : functions) {
+        driver.physical_devices.back().add_device_function(VulkanFunction{f, [] {}});
+    }
+    {  // enables neither extension nor Vulkan 1.1
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+
+        DeviceWrapper dev{inst};
+        dev.CheckCreate(inst.GetPhysDev());
+        ASSERT_EQ(nullptr, dev->vkGetDeviceProcAddr(dev.dev, "vkCmdSetCullModeEXT"));
+        ASSERT_EQ(nullptr, dev->vkGetDeviceProcAddr(dev.dev, "vkTrimCommandPool"));
+    }
+    {  // enables the extension which introduced the command
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+
+        DeviceWrapper dev{inst};
+        dev.create_info.add_extension(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+        dev.CheckCreate(inst.GetPhysDev());
+        ASSERT_NE(nullptr, dev->vkGetDeviceProcAddr(dev.dev, "vkCmdSetCullModeEXT"));
+    }
+    {  // enables another extension which also provides the command
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+
+        DeviceWrapper dev{inst};
+        dev.create_info.add_extension(VK_EXT_SHADER_OBJECT_EXTENSION_NAME);
+        dev.CheckCreate(inst.GetPhysDev());
+        ASSERT_NE(nullptr, dev->vkGetDeviceProcAddr(dev.dev, "vkCmdSetCullModeEXT"));
+    }
+    {  // uses Vulkan 1.1
+        InstWrapper inst{env.vulkan_functions};
+        inst.create_info.set_api_version(VK_API_VERSION_1_1);
+        inst.CheckCreate();
+
+        DeviceWrapper dev{inst};
+        dev.CheckCreate(inst.GetPhysDev());
+        ASSERT_NE(nullptr, dev->vkGetDeviceProcAddr(dev.dev, "vkTrimCommandPool"));
+    }
+}
+
 // Load the global function pointers with and without a NULL vkInstance handle.
 // Call the function to make sure it is callable, don't care about what is returned.
 TEST(GetProcAddr, GlobalFunctions) {
@@ -178,6 +318,66 @@ TEST(GetProcAddr, GlobalFunctions) {
     }
 }
 
+// Creates and destroys an instance, calling vkGetPhysicalDeviceFeatures2 call_count times in between, and returns the numbers of
+// avoided and deferred driver lookups which the loader reports when destroying the instance
+std::pair<uint32_t, uint32_t> get_avoided_driver_lookups(FrameworkEnvironment& env, uint32_t call_count) {
+    env.debug_log.clear();
+    auto& driver = env.get_test_icd();
+    driver.instance_proc_addr_queries.clear();
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.create_info.set_api_version(VK_API_VERSION_1_1);
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+
+        auto queries = [&driver](const char* name) {
+            return std::count(driver.instance_proc_addr_queries.begin(), driver.instance_proc_addr_queries.end(), name);
+        };
+        // Core 1.0 commands are required, so they are looked up while creating the instance to reject drivers lacking them
+        EXPECT_EQ(queries("vkGetPhysicalDeviceSparseImageFormatProperties"), 1);
+        // Other commands are only looked up from the driver when the loader needs them for the first time
+        EXPECT_EQ(queries("vkGetPhysicalDeviceFeatures2"), 0);
+        PFN_vkGetPhysicalDeviceFeatures2 GetPhysicalDeviceFeatures2 = inst.load("vkGetPhysicalDeviceFeatures2");
+        EXPECT_NE(GetPhysicalDeviceFeatures2, nullptr);
+        VkPhysicalDevice physical_device = inst.GetPhysDev();
+        for (uint32_t i = 0; i < call_count; i++) {
+            VkPhysicalDeviceFeatures2 features{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2};
+            GetPhysicalDeviceFeatures2(physical_device, &features);
+            EXPECT_EQ(features.sType, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2);
+        }
+        EXPECT_EQ(queries("vkGetPhysicalDeviceFeatures2"), call_count > 0 ? 1 : 0);
+    }
+
+    std::smatch match;
+    std::regex avoided_regex{"Avoided ([0-9]+) of ([0-9]+) vkGetInstanceProcAddr calls into driver"};
+    if (!std::regex_search(env.debug_log.returned_output, match, avoided_regex)) {
+        ADD_FAILURE() << "Missing the avoided driver lookups message";
+        return {0, 0};
+    }
+    return {static_cast<uint32_t>(std::stoul(match[1])), static_cast<uint32_t>(std::stoul(match[2]))};
+}
+
+// Driver commands the loader doesn't need while creating the instance are only looked up once used, and the number of lookups which
+// were avoided is reported when the instance is destroyed
+TEST(GetProcAddr, DriverCommandsLookedUpOnFirstUse) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2, VK_API_VERSION_1_1))
+        .set_icd_api_version(VK_API_VERSION_1_1)
+        .add_physical_device(PhysicalDevice{}.set_api_version(VK_API_VERSION_1_1).finish());
+
+    auto unused = get_avoided_driver_lookups(env, 0);
+    auto used = get_avoided_driver_lookups(env, 2);
+
+    // Most commands are never used, and the loader's own use of a few of them during instance creation and destruction is the
+    // same for both instances
+    ASSERT_GT(unused.second, 0U);
+    ASSERT_LT(unused.first, unused.second);
+    ASSERT_GT(unused.first, unused.second / 2);
+    ASSERT_EQ(used.second, unused.second);
+    // vkGetPhysicalDeviceFeatures2 was deferred, and calling it resolved exactly that one entry no matter how often it was called
+    ASSERT_EQ(used.first, unused.first - 1);
+}
+
 TEST(GetProcAddr, Verify10FunctionsFailToLoadWithSingleDriver) {
     FrameworkEnvironment env{};
     env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({}).set_can_query_GetPhysicalDeviceFuncs(false);
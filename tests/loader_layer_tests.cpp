@@ -124,6 +124,57 @@ TEST(ImplicitLayers, OnlyDisableEnvVar) {
     }
 }
 
+TEST(ImplicitLayers, ManyEnableAndDisableEnvVars) {
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA)).add_physical_device({});
+
+    // Pad the environment out with unrelated variables
+    std::vector<std::unique_ptr<EnvVarWrapper>> unrelated_env_vars;
+    for (uint32_t i = 0; i < 1000; i++) {
+        unrelated_env_vars.push_back(std::make_unique<EnvVarWrapper>("VK_LOADER_TEST_UNRELATED_" + std::to_string(i), "1"));
+    }
+
+    // Every third layer is enabled, unless its disable env-var is set. Layers whose enable env-var names are prefixes of
+    // another layer's (ENABLE_ME_1 and ENABLE_ME_10) must not be affected by each other.
+    const uint32_t layer_count = 30;
+    std::vector<std::unique_ptr<EnvVarWrapper>> enable_env_vars;
+    std::vector<std::unique_ptr<EnvVarWrapper>> disable_env_vars;
+    std::vector<std::string> expected_layers;
+    for (uint32_t i = 0; i < layer_count; i++) {
+        std::string layer_name = "VK_LAYER_ImplicitTestLayer_" + std::to_string(i);
+        enable_env_vars.push_back(std::make_unique<EnvVarWrapper>("ENABLE_ME_" + std::to_string(i)));
+        disable_env_vars.push_back(std::make_unique<EnvVarWrapper>("DISABLE_ME_" + std::to_string(i)));
+        env.add_implicit_layer(ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                             .set_name(layer_name)
+                                                             .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                                                             .set_disable_environment(disable_env_vars.back()->get())
+                                                             .set_enable_environment(enable_env_vars.back()->get())),
+                               "implicit_test_layer_" + std::to_string(i) + ".json");
+        if (i % 3 == 1) {
+            enable_env_vars.back()->set_new_value("1");
+        } else if (i % 3 == 2) {
+            enable_env_vars.back()->set_new_value("0");
+        }
+        if (i % 4 == 1) {
+            disable_env_vars.back()->set_new_value("1");
+        }
+        if (i % 3 == 1 && i % 4 != 1) {
+            expected_layers.push_back(layer_name);
+        }
+    }
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    auto active_layers = inst.GetActiveLayers(inst.GetPhysDev(), static_cast<uint32_t>(expected_layers.size()));
+    for (const auto& expected_layer : expected_layers) {
+        bool found = false;
+        for (const auto& active_layer : active_layers) {
+            found |= string_eq(active_layer.layerName, expected_layer.c_str());
+        }
+        ASSERT_TRUE(found);
+    }
+}
+
 TEST(ImplicitLayers, PreInstanceEnumInstLayerProps) {
     FrameworkEnvironment env;
     env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
@@ -229,6 +280,104 @@ TEST(ImplicitLayers, PreInstanceVersion) {
     ASSERT_NE(version, layer_version);
 }
 
+// Pre-instance chains are only cached along with the layer libraries
+TEST(ImplicitLayers, PreInstanceChainReusedAcrossCalls) {
+    EnvVarWrapper cache_layer_libraries_env_var{"VK_LOADER_CACHE_LAYER_LIBRARIES", "1"};
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA)).add_physical_device({});
+    const char* implicit_layer_name = "VK_LAYER_ImplicitTestLayer";
+    EnvVarWrapper disable_env_var{"DISABLE_ME"};
+
+    env.add_implicit_layer(
+        ManifestLayer{}.set_file_format_version({1, 1, 2}).add_layer(
+            ManifestLayer::LayerDescription{}
+                .set_name(implicit_layer_name)
+                .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                .set_disable_environment(disable_env_var.get())
+                .add_pre_instance_function(ManifestLayer::LayerDescription::FunctionOverride{}
+                                               .set_vk_func("vkEnumerateInstanceLayerProperties")
+                                               .set_override_name("test_preinst_vkEnumerateInstanceLayerProperties"))),
+        "implicit_test_layer.json");
+
+    auto& layer = env.get_test_layer(0);
+    layer.set_reported_layer_props(43);
+
+    uint32_t count = 0;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&count, nullptr));
+    ASSERT_EQ(count, 43U);
+
+    // The cached chain still calls into the same layer library
+    layer.set_reported_layer_props(44);
+    count = 0;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&count, nullptr));
+    ASSERT_EQ(count, 44U);
+
+    // A change in which layers are enabled must not reuse the old chain
+    disable_env_var.set_new_value("1");
+    count = 0;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&count, nullptr));
+    ASSERT_NE(count, 44U);
+
+    disable_env_var.remove_value();
+    count = 0;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&count, nullptr));
+    ASSERT_EQ(count, 44U);
+
+    // vkCreateInstance reuses the library opened for the pre-instance chain
+    {
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+        ASSERT_TRUE(env.debug_log.find("Using cached layer library"));
+    }
+
+    // The cached chain is dropped in vkDestroyInstance but a new one is built on the next call
+    count = 0;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&count, nullptr));
+    ASSERT_EQ(count, 44U);
+}
+
+#if COMMON_UNIX_PLATFORMS
+// Checks how many references to the layer library are held after a pre-instance call, and that none are left once an instance was
+// created and destroyed
+void check_pre_instance_chain_layer_library_references(bool cached) {
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA)).add_physical_device({});
+    env.add_implicit_layer(
+        ManifestLayer{}.set_file_format_version({1, 1, 2}).add_layer(
+            ManifestLayer::LayerDescription{}
+                .set_name("VK_LAYER_ImplicitTestLayer")
+                .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                .set_disable_environment("DISABLE_ME")
+                .add_pre_instance_function(ManifestLayer::LayerDescription::FunctionOverride{}
+                                               .set_vk_func("vkEnumerateInstanceLayerProperties")
+                                               .set_override_name("test_preinst_vkEnumerateInstanceLayerProperties"))),
+        "implicit_test_layer.json");
+    // The framework keeps its own reference to the layer library
+    void* layer_library = env.layers.back().layer_library.lib_handle;
+    size_t framework_references = env.platform_shim->get_open_library_count(layer_library);
+
+    uint32_t count = 0;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkEnumerateInstanceLayerProperties(&count, nullptr));
+    ASSERT_EQ(env.platform_shim->get_open_library_count(layer_library), framework_references + (cached ? 1U : 0U));
+
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+    }
+    ASSERT_EQ(env.platform_shim->get_open_library_count(layer_library), framework_references);
+}
+
+// Without VK_LOADER_CACHE_LAYER_LIBRARIES the pre-instance chain doesn't keep the layer library loaded once the call returns
+TEST(ImplicitLayers, PreInstanceChainNotCachedByDefault) { check_pre_instance_chain_layer_library_references(false); }
+
+// With VK_LOADER_CACHE_LAYER_LIBRARIES set to "1" the cached chain's library is closed when the last instance is destroyed
+TEST(ImplicitLayers, PreInstanceChainReleasedWithLastInstance) {
+    EnvVarWrapper cache_layer_libraries_env_var{"VK_LOADER_CACHE_LAYER_LIBRARIES", "1"};
+    check_pre_instance_chain_layer_library_references(true);
+}
+#endif
+
 // Run with a pre-Negotiate function version of the layer so that it has to query vkCreateInstance using the
 // renamed vkGetInstanceProcAddr function which returns one that intentionally fails.  Then disable the
 // layer and verify it works.  The non-override version of vkCreateInstance in the layer also works (and is
@@ -2031,6 +2180,142 @@ TEST(OverrideMetaLayer, RunningWithElevatedPrivilegesFromUnsecureLocation) {
     }
 }
 
+// With VK_LOADER_CACHE_LAYER_LIBRARIES set to "pin", the library of a layer stays loaded after vkDestroyInstance and the next
+// instance uses it
+TEST(ExplicitLayers, LayerLibraryCachedAcrossInstances) {
+    EnvVarWrapper cache_layer_libraries_env_var{"VK_LOADER_CACHE_LAYER_LIBRARIES", "pin"};
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
+    const char* explicit_layer_name = "VK_LAYER_CachedExplicitLayer";
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(explicit_layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "explicit_cached_layer.json");
+
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.create_info.add_layer(explicit_layer_name);
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+        ASSERT_FALSE(env.debug_log.find("Using cached layer library"));
+    }
+    for (uint32_t i = 0; i < 2; i++) {
+        env.debug_log.clear();
+        InstWrapper inst{env.vulkan_functions};
+        inst.create_info.add_layer(explicit_layer_name);
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+        ASSERT_TRUE(env.debug_log.find("Using cached layer library"));
+        ASSERT_NO_FATAL_FAILURE(inst.GetActiveLayers(inst.GetPhysDev(), 1));
+    }
+}
+
+// Without VK_LOADER_CACHE_LAYER_LIBRARIES, layer libraries are closed in vkDestroyInstance like before
+TEST(ExplicitLayers, LayerLibraryNotCachedByDefault) {
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
+    const char* explicit_layer_name = "VK_LAYER_UncachedExplicitLayer";
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(explicit_layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "explicit_uncached_layer.json");
+
+    for (uint32_t i = 0; i < 2; i++) {
+        env.debug_log.clear();
+        InstWrapper inst{env.vulkan_functions};
+        inst.create_info.add_layer(explicit_layer_name);
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+        ASSERT_FALSE(env.debug_log.find("Using cached layer library"));
+    }
+}
+
+#if COMMON_UNIX_PLATFORMS
+// With VK_LOADER_CACHE_LAYER_LIBRARIES set to "1", instances share the cached library, which is closed when the last one of them
+// is destroyed
+TEST(ExplicitLayers, LayerLibraryCacheReleasedWithLastInstance) {
+    EnvVarWrapper cache_layer_libraries_env_var{"VK_LOADER_CACHE_LAYER_LIBRARIES", "1"};
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
+    const char* explicit_layer_name = "VK_LAYER_ReleasedExplicitLayer";
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(explicit_layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "explicit_released_layer.json");
+    // The framework keeps its own reference to the layer library
+    void* layer_library = env.layers.back().layer_library.lib_handle;
+    size_t framework_references = env.platform_shim->get_open_library_count(layer_library);
+
+    for (uint32_t i = 0; i < 2; i++) {
+        {
+            InstWrapper first_inst{env.vulkan_functions};
+            first_inst.create_info.add_layer(explicit_layer_name);
+            first_inst.CheckCreate();
+            {
+                env.debug_log.clear();
+                InstWrapper second_inst{env.vulkan_functions};
+                second_inst.create_info.add_layer(explicit_layer_name);
+                FillDebugUtilsCreateDetails(second_inst.create_info, env.debug_log);
+                second_inst.CheckCreate();
+                ASSERT_TRUE(env.debug_log.find("Using cached layer library"));
+            }
+            ASSERT_EQ(env.platform_shim->get_open_library_count(layer_library), framework_references + 1);
+        }
+        ASSERT_EQ(env.platform_shim->get_open_library_count(layer_library), framework_references);
+    }
+}
+#endif
+
+#if !defined(APPLE_STATIC_LOADER)
+// Unloading a pinned cache closes the libraries which no instance uses, and keeps the ones which are still in use
+TEST(ExplicitLayers, UnloadCachedLayerLibraries) {
+    EnvVarWrapper cache_layer_libraries_env_var{"VK_LOADER_CACHE_LAYER_LIBRARIES", "pin"};
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
+    const char* explicit_layer_name = "VK_LAYER_UnloadedExplicitLayer";
+    env.add_explicit_layer(
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(explicit_layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "explicit_unloaded_layer.json");
+    using PFN_loader_unload_cached_layer_libraries = void (*)(void);
+    PFN_loader_unload_cached_layer_libraries unload_cached_layer_libraries =
+        env.vulkan_functions.loader.get_symbol("loader_unload_cached_layer_libraries");
+
+    auto create_instance_uses_cache = [&]() {
+        env.debug_log.clear();
+        InstWrapper inst{env.vulkan_functions};
+        inst.create_info.add_layer(explicit_layer_name);
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+        return env.debug_log.find("Using cached layer library");
+    };
+
+    ASSERT_FALSE(create_instance_uses_cache());
+    ASSERT_TRUE(create_instance_uses_cache());
+
+    // Nothing uses the library anymore, so it is closed and the next instance has to open it again
+#if COMMON_UNIX_PLATFORMS
+    void* layer_library = env.layers.back().layer_library.lib_handle;
+    size_t references = env.platform_shim->get_open_library_count(layer_library);
+    unload_cached_layer_libraries();
+    ASSERT_EQ(env.platform_shim->get_open_library_count(layer_library), references - 1);
+#else
+    unload_cached_layer_libraries();
+#endif
+    ASSERT_FALSE(create_instance_uses_cache());
+
+    // A library which an instance still holds isn't closed
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.create_info.add_layer(explicit_layer_name);
+        inst.CheckCreate();
+        unload_cached_layer_libraries();
+        ASSERT_TRUE(create_instance_uses_cache());
+    }
+    ASSERT_TRUE(create_instance_uses_cache());
+}
+#endif
+
 // Makes sure explicit layers can't override pre-instance functions even if enabled by the override layer
 TEST(ExplicitLayers, OverridePreInstanceFunctions) {
     FrameworkEnvironment env;
@@ -3864,6 +4149,65 @@ TEST(TestLayers, EnvironLayerEnableExplicitLayer) {
     ASSERT_FALSE(env.debug_log.find_prefix_then_postfix(explicit_layer_name_3, "disabled because name matches filter of env var"));
 }
 
+// Verify that VK_LOADER_LAYERS_ENABLE filters which share parts of their strings, or which appear in the wrong position of a
+// layer name, only enable the layers they actually match
+TEST(TestLayers, EnvironLayerEnableOverlappingFilters) {
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
+
+    const std::array<const char*, 6> layer_names = {"VK_LAYER_aabab_layer", "VK_LAYER_mid_end_layer", "VK_LAYER_test_end",
+                                                    "VK_LAYER_abba",        "VK_LAYER_FULL",          "VK_LAYER_NOT_FULL"};
+    const std::array<bool, 6> expected_enabled = {true, false, true, false, true, false};
+    for (const auto& layer_name : layer_names) {
+        env.add_explicit_layer(
+            ManifestLayer{}.add_layer(
+                ManifestLayer::LayerDescription{}.set_name(layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+            std::string(layer_name) + ".json");
+    }
+
+    EnvVarWrapper layers_enable_env_var{"VK_LOADER_LAYERS_ENABLE", "*abab*,*_end,layer_mid*,vk_layer_full"};
+    // Check twice so that both a freshly parsed and a previously parsed value of the env-var are used
+    for (uint32_t i = 0; i < 2; i++) {
+        env.debug_log.clear();
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+        for (size_t layer = 0; layer < layer_names.size(); layer++) {
+            ASSERT_EQ(expected_enabled[layer],
+                      env.debug_log.find_prefix_then_postfix(layer_names[layer], "forced enabled due to env var"));
+        }
+        inst.GetActiveLayers(inst.GetPhysDev(), 3);
+    }
+}
+
+// Verify that a lone '*' in VK_LOADER_LAYERS_ENABLE, which is parsed as an empty prefix, still enables every layer when it is
+// compiled alongside other filters
+TEST(TestLayers, EnvironLayerEnableLoneStarWithOtherFilters) {
+    FrameworkEnvironment env;
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
+
+    const std::array<const char*, 3> layer_names = {"VK_LAYER_first", "VK_LAYER_second", "VK_LAYER_third"};
+    for (const auto& layer_name : layer_names) {
+        env.add_explicit_layer(
+            ManifestLayer{}.add_layer(
+                ManifestLayer::LayerDescription{}.set_name(layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+            std::string(layer_name) + ".json");
+    }
+
+    EnvVarWrapper layers_enable_env_var{"VK_LOADER_LAYERS_ENABLE", "vk_layer_first,*"};
+    // Check twice so that both a freshly parsed and a previously parsed value of the env-var are used
+    for (uint32_t i = 0; i < 2; i++) {
+        env.debug_log.clear();
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+        for (const auto& layer_name : layer_names) {
+            ASSERT_TRUE(env.debug_log.find_prefix_then_postfix(layer_name, "forced enabled due to env var"));
+        }
+        inst.GetActiveLayers(inst.GetPhysDev(), 3);
+    }
+}
+
 // Verify that VK_LOADER_LAYERS_DISABLE work.  To test this, make sure that an explicit layer does not affect an instance until
 // it is set with VK_LOADER_LAYERS_DISABLE
 TEST(TestLayers, EnvironLayerDisableExplicitLayer) {
@@ -530,6 +530,48 @@ TEST(EnumerateDeviceExtensionProperties, ImplicitLayerPresentWithExtensions) {
     exercise_EnumerateDeviceExtensionProperties(inst, physical_device, exts);
 }
 
+// With VK_LOADER_CACHE_PHYSICAL_DEVICE_PROPERTIES set, the merged list of driver and implicit layer extensions is only built once
+TEST(EnumerateDeviceExtensionProperties, CachedExtensions) {
+    EnvVarWrapper cache_properties_env_var{"VK_LOADER_CACHE_PHYSICAL_DEVICE_PROPERTIES", "1"};
+    FrameworkEnvironment env{};
+    auto& driver = env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
+
+    std::vector<Extension> exts;
+    std::vector<ManifestLayer::LayerDescription::Extension> layer_exts;
+    for (uint32_t i = 0; i < 4; i++) {
+        exts.emplace_back(std::string("LayerExtNumba") + std::to_string(i), i + 10);
+        layer_exts.emplace_back(std::string("LayerExtNumba") + std::to_string(i), i + 10);
+    }
+    env.add_implicit_layer(ManifestLayer{}.add_layer(ManifestLayer::LayerDescription{}
+                                                         .set_name("implicit_layer_name")
+                                                         .set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)
+                                                         .set_disable_environment("DISABLE_ME")
+                                                         .add_device_extensions({layer_exts})),
+                           "implicit_test_layer.json");
+    auto& layer = env.get_test_layer();
+    layer.device_extensions = exts;
+
+    // The driver also provides one of the layer's extensions, which must only be reported once
+    driver.physical_devices.front().extensions.emplace_back("MyDriverExtension0", 4);
+    driver.physical_devices.front().extensions.emplace_back("LayerExtNumba0", 10);
+    exts.erase(exts.begin());
+    exts.insert(exts.begin(), driver.physical_devices.front().extensions.begin(), driver.physical_devices.front().extensions.end());
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+
+    VkPhysicalDevice physical_device = inst.GetPhysDev();
+    exercise_EnumerateDeviceExtensionProperties(inst, physical_device, exts);
+
+    // The driver changing what it reports shows whether the loader asked it again
+    driver.physical_devices.front().extensions.emplace_back("MyDriverExtension1", 7);
+    exercise_EnumerateDeviceExtensionProperties(inst, physical_device, exts);
+
+    DeviceWrapper dev{inst};
+    dev.create_info.add_extension("MyDriverExtension0").add_extension("LayerExtNumba1");
+    dev.CheckCreate(physical_device);
+}
+
 TEST(EnumerateDeviceExtensionProperties, ImplicitLayerPresentWithLotsOfExtensions) {
     FrameworkEnvironment env{};
     auto& driver = env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
@@ -1163,6 +1205,68 @@ TEST(EnumeratePhysicalDevices, MultipleAddRemoves) {
     ASSERT_GE(found_items[6], 4U);
 }
 
+// Drivers exposing SR-IOV virtual functions can report hundreds of physical devices. Every call to vkEnumeratePhysicalDevices
+// matches the physical devices it finds with the ones from previous calls, so the time reported for this test mostly measures
+// how that matching scales with the number of physical devices.
+TEST(EnumeratePhysicalDevices, HundredsOfPhysicalDevices) {
+    FrameworkEnvironment env{};
+    auto& driver = env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).set_min_icd_interface_version(5);
+    driver.add_sr_iov_physical_devices("sr_iov_device", 3, 511);
+    uint32_t physical_count = static_cast<uint32_t>(driver.physical_devices.size());
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+
+    auto physical_devices = inst.GetPhysDevs(physical_count);
+    for (uint32_t i = 0; i < 100; i++) {
+        auto partial_physical_devices = inst.GetPhysDevs(physical_count / 2, VK_INCOMPLETE);
+        ASSERT_TRUE(std::equal(partial_physical_devices.begin(), partial_physical_devices.end(), physical_devices.begin()));
+        ASSERT_EQ(physical_devices, inst.GetPhysDevs(physical_count));
+    }
+
+    // Remove every other virtual function, the remaining physical devices must keep their handles
+    for (uint32_t i = 1; i < driver.physical_devices.size(); i++) {
+        driver.physical_devices.erase(driver.physical_devices.begin() + i);
+    }
+    physical_count = static_cast<uint32_t>(driver.physical_devices.size());
+    auto remaining_physical_devices = inst.GetPhysDevs(physical_count);
+    std::sort(physical_devices.begin(), physical_devices.end());
+    for (auto const& physical_device : remaining_physical_devices) {
+        ASSERT_TRUE(std::binary_search(physical_devices.begin(), physical_devices.end(), physical_device));
+    }
+}
+
+// With VK_LOADER_CACHE_PHYSICAL_DEVICES set, the drivers are only asked for their physical devices again once the loader sees a
+// sign of physical devices changing, such as a driver failing to create a device.
+TEST(EnumeratePhysicalDevices, CachedPhysicalDevices) {
+    EnvVarWrapper cache_physical_devices_env_var{"VK_LOADER_CACHE_PHYSICAL_DEVICES", "1"};
+    FrameworkEnvironment env{};
+    auto& driver = env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).set_min_icd_interface_version(5);
+    driver.physical_devices.emplace_back("physical_device_0");
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    auto physical_devices = inst.GetPhysDevs(1);
+
+    // The new physical device isn't seen while the cached physical devices are still valid
+    driver.physical_devices.emplace_back("physical_device_1");
+    uint32_t returned_physical_count = 0;
+    ASSERT_EQ(VK_SUCCESS, inst->vkEnumeratePhysicalDevices(inst, &returned_physical_count, nullptr));
+    ASSERT_EQ(1U, returned_physical_count);
+    ASSERT_EQ(physical_devices, inst.GetPhysDevs(1));
+
+    driver.set_create_device_return_code(VK_ERROR_DEVICE_LOST);
+    {
+        DeviceWrapper dev{inst};
+        dev.create_info.add_device_queue({});
+        dev.CheckCreate(physical_devices.at(0), VK_ERROR_DEVICE_LOST);
+    }
+    driver.set_create_device_return_code(VK_SUCCESS);
+
+    auto refreshed_physical_devices = inst.GetPhysDevs(2);
+    ASSERT_EQ(physical_devices.at(0), refreshed_physical_devices.at(0));
+}
+
 TEST(EnumeratePhysicalDevices, OneDriverWithWrongErrorCodes) {
     FrameworkEnvironment env;
     env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
@@ -1223,6 +1327,54 @@ TEST(EnumeratePhysicalDevices, TwoDriversOneWithWrongErrorCodes) {
     }
 }
 
+// With VK_LOADER_CACHE_PHYSICAL_DEVICE_PROPERTIES set, the driver is asked once for each of the properties which can't change, and
+// later queries are answered by the loader.
+TEST(PhysicalDevicePropertyCache, DriverQueriedOnce) {
+    EnvVarWrapper cache_properties_env_var{"VK_LOADER_CACHE_PHYSICAL_DEVICE_PROPERTIES", "1"};
+    FrameworkEnvironment env{};
+    auto& driver = env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).set_min_icd_interface_version(5);
+    driver.physical_devices.emplace_back("physical_device_0");
+    auto& physical_device_info = driver.physical_devices.back();
+    physical_device_info.properties.deviceID = 1234;
+    physical_device_info.memory_properties.memoryTypeCount = 2;
+    physical_device_info.add_queue_family_properties({{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, false})
+        .add_queue_family_properties({{VK_QUEUE_TRANSFER_BIT, 2, 0, {1, 1, 1}}, false});
+    physical_device_info.format_properties.resize(VK_FORMAT_R8G8B8A8_UNORM + 1);
+    physical_device_info.format_properties[VK_FORMAT_R8G8B8A8_UNORM].optimalTilingFeatures = VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT;
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+    VkPhysicalDevice physical_device = inst.GetPhysDev();
+
+    // The driver changing what it reports shows whether the loader asked it again
+    for (uint32_t i = 0; i < 2; i++) {
+        VkPhysicalDeviceProperties props{};
+        inst->vkGetPhysicalDeviceProperties(physical_device, &props);
+        ASSERT_EQ(props.deviceID, 1234U);
+        VkPhysicalDeviceMemoryProperties memory_props{};
+        inst->vkGetPhysicalDeviceMemoryProperties(physical_device, &memory_props);
+        ASSERT_EQ(memory_props.memoryTypeCount, 2U);
+        uint32_t queue_family_count = 0;
+        inst->vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &queue_family_count, nullptr);
+        ASSERT_EQ(queue_family_count, 2U);
+        // Asking for fewer queue families than there are only returns those
+        queue_family_count = 1;
+        std::array<VkQueueFamilyProperties, 2> queue_family_props{};
+        inst->vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &queue_family_count, queue_family_props.data());
+        ASSERT_EQ(queue_family_count, 1U);
+        ASSERT_EQ(queue_family_props[0].queueFlags, static_cast<VkQueueFlags>(VK_QUEUE_GRAPHICS_BIT));
+        ASSERT_EQ(queue_family_props[1].queueFlags, 0U);
+        VkFormatProperties format_props{};
+        inst->vkGetPhysicalDeviceFormatProperties(physical_device, VK_FORMAT_R8G8B8A8_UNORM, &format_props);
+        ASSERT_EQ(format_props.optimalTilingFeatures, static_cast<VkFormatFeatureFlags>(VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT));
+
+        driver.physical_devices.back().properties.deviceID = 5678;
+        driver.physical_devices.back().memory_properties.memoryTypeCount = 3;
+        driver.physical_devices.back().queue_family_properties.pop_back();
+        driver.physical_devices.back().format_properties[VK_FORMAT_R8G8B8A8_UNORM].optimalTilingFeatures = 0;
+    }
+}
+
 TEST(CreateDevice, ExtensionNotPresent) {
     FrameworkEnvironment env{};
     env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device("physical_device_0");
@@ -3145,6 +3297,43 @@ TEST(SortedPhysicalDevices, DevicesSortEnabled11) {
     }
 }
 
+// Devices on the same PCI bus, such as the virtual functions of an SR-IOV device, are ordered by PCI device and function number.
+// The loader keeps the sorting information of each physical device around, so enumerating again must give the same order.
+TEST(SortedPhysicalDevices, DevicesSortedByPCIDeviceAndFunction) {
+    FrameworkEnvironment env{};
+    auto& driver = env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2, VK_API_VERSION_1_1)).set_icd_api_version(VK_API_VERSION_1_1);
+    driver.add_instance_extension({VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME});
+    driver.add_sr_iov_physical_devices("sr_iov_device", 2, 15);
+    // Report the virtual functions before the physical function
+    std::reverse(driver.physical_devices.begin(), driver.physical_devices.end());
+    for (auto& physical_device : driver.physical_devices) {
+        FillInRandomDeviceProps(physical_device.properties, VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU, VK_API_VERSION_1_1, 888,
+                                0xAAA001);
+        physical_device.extensions.push_back({VK_EXT_PCI_BUS_INFO_EXTENSION_NAME, 0});
+    }
+    const uint32_t physical_count = static_cast<uint32_t>(driver.physical_devices.size());
+
+    InstWrapper instance(env.vulkan_functions);
+    instance.create_info.set_api_version(VK_API_VERSION_1_1);
+    instance.CheckCreate();
+
+    PFN_vkGetPhysicalDeviceProperties2 GetPhysDevProps2 = instance.load("vkGetPhysicalDeviceProperties2");
+    ASSERT_NE(GetPhysDevProps2, nullptr);
+
+    auto physical_devices = instance.GetPhysDevs(physical_count);
+    for (uint32_t dev = 0; dev < physical_count; ++dev) {
+        VkPhysicalDeviceProperties2 props2{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2};
+        VkPhysicalDevicePCIBusInfoPropertiesEXT pci_bus_info{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT};
+        props2.pNext = &pci_bus_info;
+        GetPhysDevProps2(physical_devices[dev], &props2);
+        ASSERT_EQ(pci_bus_info.pciBus, 2U);
+        ASSERT_EQ(pci_bus_info.pciDevice, dev / 8);
+        ASSERT_EQ(pci_bus_info.pciFunction, dev % 8);
+    }
+
+    ASSERT_EQ(physical_devices, instance.GetPhysDevs(physical_count));
+}
+
 TEST(SortedPhysicalDevices, DevicesSortedDisabled) {
     FrameworkEnvironment env{};
 
@@ -27,6 +27,7 @@
 
 #include "test_environment.h"
 
+#include <chrono>
 #include <fstream>
 
 std::string get_settings_location_log_message([[maybe_unused]] FrameworkEnvironment const& env,
@@ -258,6 +259,45 @@ TEST(SettingsFile, SupportsMultipleSettingsSimultaneously) {
     }
 }
 
+// Make sure the settings matching the current executable are found among many app specific settings
+TEST(SettingsFile, ManyAppSpecificSettings) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
+    const char* app_specific_layer_name = "VK_LAYER_TestLayer_0";
+    env.add_explicit_layer(TestLayerDetails{
+        ManifestLayer{}.add_layer(
+            ManifestLayer::LayerDescription{}.set_name(app_specific_layer_name).set_lib_path(TEST_LAYER_PATH_EXPORT_VERSION_2)),
+        "VK_LAYER_app_specific.json"}
+                               .set_discovery_type(ManifestDiscoveryType::override_folder));
+    for (uint32_t i = 0; i < 300; i++) {
+        env.loader_settings.add_app_specific_setting(AppSpecificSettings{}
+                                                         .add_stderr_log_filter("all")
+                                                         .add_layer_configuration(LoaderSettingsLayerConfiguration{}
+                                                                                      .set_name("VK_LAYER_haha" + std::to_string(i))
+                                                                                      .set_path("/made/up/path")
+                                                                                      .set_control("on"))
+                                                         .add_app_key("/made/up/app" + std::to_string(i))
+                                                         .add_app_key("key" + std::to_string(i)));
+    }
+    env.loader_settings.app_specific_settings.at(150).layer_configurations.at(0) =
+        LoaderSettingsLayerConfiguration{}.set_name(app_specific_layer_name).set_path(env.get_layer_manifest_path(0)).set_control("on");
+    env.loader_settings.app_specific_settings.at(150).add_app_key(test_platform_executable_path());
+    // Settings which come later in the file don't take precedence, even if they also match
+    env.loader_settings.app_specific_settings.at(151).add_app_key(test_platform_executable_path());
+    env.update_loader_settings(env.loader_settings);
+    {
+        auto layer_props = env.GetLayerProperties(1);
+        EXPECT_TRUE(string_eq(layer_props.at(0).layerName, app_specific_layer_name));
+
+        InstWrapper inst{env.vulkan_functions};
+        FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+        inst.CheckCreate();
+        ASSERT_TRUE(env.debug_log.find(get_settings_location_log_message(env)));
+        auto layers = inst.GetActiveLayers(inst.GetPhysDev(), 1);
+        ASSERT_TRUE(string_eq(layers.at(0).layerName, app_specific_layer_name));
+    }
+}
+
 // Make sure layers found through the settings file are enableable by environment variables
 TEST(SettingsFile, LayerAutoEnabledByEnvVars) {
     FrameworkEnvironment env{};
@@ -3018,3 +3058,196 @@ TEST(SettingsFile, EnvVarsWorkTogether) {
         EXPECT_TRUE(env.platform_shim->find_in_log("Insert instance layer \"VK_LAYER_add_env_var_implicit_layer\""));
     }
 }
+
+#if COMMON_UNIX_PLATFORMS
+// Make sure an unmodified settings file isn't reopened on every call, and that modifying it causes it to be read again
+TEST(SettingsFile, UnmodifiedFileIsNotReread) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
+    env.loader_settings.add_app_specific_setting(AppSpecificSettings{}.add_stderr_log_filter("all"));
+    const char* regular_layer_name = add_layer_and_settings(env, "VK_LAYER_TestLayer_0", LayerType::exp, "on");
+    env.update_loader_settings(env.loader_settings);
+
+    // Files modified in the last few seconds are always read again, so make the settings file look older than that
+    auto settings_file_path = env.get_folder(ManifestLocation::settings_location).location() / "vk_loader_settings.json";
+    std::filesystem::last_write_time(settings_file_path,
+                                     std::filesystem::last_write_time(settings_file_path) - std::chrono::hours(1));
+
+    size_t open_count = env.platform_shim->get_fopen_count(settings_file_path);
+    for (uint32_t i = 0; i < 5; i++) {
+        auto layer_props = env.GetLayerProperties(1);
+        EXPECT_TRUE(string_eq(layer_props.at(0).layerName, regular_layer_name));
+    }
+    ASSERT_EQ(env.platform_shim->get_fopen_count(settings_file_path), open_count + 1);
+
+    // The file size changes, so the new contents must be read even though the modification time is again an hour in the past
+    env.loader_settings.app_specific_settings.at(0).stderr_log.at(0) = "error";
+    env.update_loader_settings(env.loader_settings);
+    std::filesystem::last_write_time(settings_file_path,
+                                     std::filesystem::last_write_time(settings_file_path) - std::chrono::hours(1));
+    {
+        auto layer_props = env.GetLayerProperties(1);
+        EXPECT_TRUE(string_eq(layer_props.at(0).layerName, regular_layer_name));
+    }
+    ASSERT_EQ(env.platform_shim->get_fopen_count(settings_file_path), open_count + 2);
+}
+#endif
+
+bool is_valid_utf8(std::string const& str) {
+    for (size_t i = 0; i < str.size();) {
+        unsigned char lead = static_cast<unsigned char>(str[i]);
+        size_t length = 0;
+        if (lead < 0x80) {
+            length = 1;
+        } else if (lead >= 0xC2 && lead <= 0xDF) {
+            length = 2;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            length = 3;
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            length = 4;
+        }
+        if (length == 0 || i + length > str.size()) return false;
+        for (size_t j = 1; j < length; j++) {
+            if ((static_cast<unsigned char>(str[i + j]) & 0xC0) != 0x80) return false;
+        }
+        i += length;
+    }
+    return true;
+}
+
+// Checks that every line of the structured log file is a complete record of valid UTF-8, returning the lines
+std::vector<std::string> read_structured_log_file(std::filesystem::path const& log_file_path) {
+    std::vector<std::string> lines;
+    std::ifstream log_file(log_file_path);
+    std::string line;
+    while (std::getline(log_file, line)) {
+        EXPECT_EQ(line.find("{\"timestamp_ns\":"), 0U) << line;
+        EXPECT_NE(line.find(",\"thread_id\":"), std::string::npos) << line;
+        EXPECT_NE(line.find(",\"instance\":\"0x"), std::string::npos) << line;
+        EXPECT_NE(line.find(",\"message_type\":"), std::string::npos) << line;
+        EXPECT_NE(line.find(",\"message\":\""), std::string::npos) << line;
+        EXPECT_EQ(line.substr(line.size() - 2), "\"}") << line;
+        EXPECT_TRUE(is_valid_utf8(line)) << line;
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+bool structured_log_contains(std::vector<std::string> const& lines, std::string const& message) {
+    for (auto const& line : lines) {
+        if (line.find(message) != std::string::npos) return true;
+    }
+    return false;
+}
+
+TEST(SettingsFile, StructuredLogFile) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
+    auto log_file_path = env.get_folder(ManifestLocation::unsecured_location).location() / "loader_log.jsonl";
+    env.update_loader_settings(env.loader_settings.set_file_format_version({1, 0, 0}).add_app_specific_setting(
+        AppSpecificSettings{}.add_stderr_log_filter("all").set_log_file(log_file_path)));
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+    }
+
+    auto lines = read_structured_log_file(log_file_path);
+    ASSERT_FALSE(lines.empty());
+    EXPECT_TRUE(structured_log_contains(lines, "Found ICD manifest file"));
+    EXPECT_TRUE(env.platform_shim->find_in_log("Found ICD manifest file"));
+}
+
+TEST(SettingsFile, StructuredLogFileHasItsOwnFilter) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
+    auto log_file_path = env.get_folder(ManifestLocation::unsecured_location).location() / "loader_log.jsonl";
+    // The file gets driver messages which the console doesn't, while the console gets layer messages which the file doesn't
+    env.update_loader_settings(env.loader_settings.set_file_format_version({1, 0, 0}).add_app_specific_setting(
+        AppSpecificSettings{}
+            .add_stderr_log_filter("layer")
+            .set_log_file(log_file_path)
+            .add_log_file_level_filter("error")
+            .add_log_file_level_filter("driver")));
+    env.platform_shim->clear_logs();
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+    }
+
+    auto lines = read_structured_log_file(log_file_path);
+    EXPECT_TRUE(structured_log_contains(lines, "Found ICD manifest file"));
+    EXPECT_FALSE(env.platform_shim->find_in_log("Found ICD manifest file"));
+    EXPECT_FALSE(structured_log_contains(lines, "Loader Settings Filters for Logging to Standard Error"));
+    // VULKAN_LOADER_ERROR_BIT, VULKAN_LOADER_DRIVER_BIT, and VULKAN_LOADER_FATAL_ERROR_BIT
+    const unsigned long file_level = 0x08 | 0x40 | 0x100;
+    for (auto const& line : lines) {
+        auto message_type_pos = line.find("\"message_type\":") + strlen("\"message_type\":");
+        EXPECT_NE(0U, std::stoul(line.substr(message_type_pos)) & file_level) << line;
+    }
+}
+
+TEST(SettingsFile, StructuredLogFileLevelEnvVar) {
+    fs::FolderManager log_folder{FRAMEWORK_BUILD_DIRECTORY, "structured_log_level_folder"};
+    auto log_file_path = log_folder.location() / "loader_log.jsonl";
+    EnvVarWrapper log_file_env_var{"VK_LOADER_LOG_FILE", log_file_path.string()};
+    EnvVarWrapper log_file_level_env_var{"VK_LOADER_LOG_FILE_LEVEL", "error,driver"};
+
+    // Both environment variables are read when the loader is loaded, so they must be set before the environment is created
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
+    // The environment variable takes precedence over the settings file's level
+    env.update_loader_settings(env.loader_settings.set_file_format_version({1, 0, 0}).add_app_specific_setting(
+        AppSpecificSettings{}.add_stderr_log_filter("error").add_log_file_level_filter("error")));
+    env.platform_shim->clear_logs();
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+    }
+
+    auto lines = read_structured_log_file(log_file_path);
+    EXPECT_TRUE(structured_log_contains(lines, "Found ICD manifest file"));
+    EXPECT_FALSE(env.platform_shim->find_in_log("Found ICD manifest file"));
+}
+
+TEST(SettingsFile, StructuredLogFileIsValidUTF8) {
+    // Long enough for the message repeating it to be truncated, which happens in the middle of a two byte character
+    std::string layers_env_var = "\xffx";
+    for (uint32_t i = 0; i < 300; i++) {
+        layers_env_var += "\xc3\xa9";
+    }
+    EnvVarWrapper instance_layers_env_var{"VK_INSTANCE_LAYERS", layers_env_var};
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
+    auto log_file_path = env.get_folder(ManifestLocation::unsecured_location).location() / "loader_log.jsonl";
+    env.update_loader_settings(env.loader_settings.set_file_format_version({1, 0, 0}).add_app_specific_setting(
+        AppSpecificSettings{}.add_stderr_log_filter("all").set_log_file(log_file_path)));
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+    }
+
+    // The invalid byte is replaced, while the characters around it are kept
+    auto lines = read_structured_log_file(log_file_path);
+    EXPECT_TRUE(structured_log_contains(lines, "adding layers: \\ufffdx\xc3\xa9\xc3\xa9"));
+}
+
+TEST(SettingsFile, StructuredLogFileEnvVarTakesPrecedence) {
+    fs::FolderManager log_folder{FRAMEWORK_BUILD_DIRECTORY, "structured_log_folder"};
+    auto env_var_log_file_path = log_folder.location() / "env_var_loader_log.jsonl";
+    auto settings_log_file_path = log_folder.location() / "settings_loader_log.jsonl";
+    EnvVarWrapper log_file_env_var{"VK_LOADER_LOG_FILE", env_var_log_file_path.string()};
+
+    // VK_LOADER_LOG_FILE is read when the loader is loaded, so it must be set before the environment is created
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2)).add_physical_device({});
+    env.update_loader_settings(env.loader_settings.set_file_format_version({1, 0, 0}).add_app_specific_setting(
+        AppSpecificSettings{}.add_stderr_log_filter("all").set_log_file(settings_log_file_path)));
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+    }
+
+    auto lines = read_structured_log_file(env_var_log_file_path);
+    EXPECT_TRUE(structured_log_contains(lines, "Found ICD manifest file"));
+    EXPECT_FALSE(std::filesystem::exists(settings_log_file_path));
+}
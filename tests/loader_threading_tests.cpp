@@ -27,6 +27,7 @@
 
 #include "test_environment.h"
 
+#include <regex>
 #include <thread>
 
 void create_destroy_instance_loop_with_function_queries(FrameworkEnvironment* env, uint32_t num_loops_create_destroy_instance,
@@ -103,6 +104,74 @@ TEST(Threading, InstanceCreateDestroyLoop) {
     }
 }
 
+#if COMMON_UNIX_PLATFORMS
+// Creates and destroys an instance and returns what the loader wrote to stderr meanwhile, without the addresses which differ
+// between runs
+std::string log_create_destroy_instance(FrameworkEnvironment& env) {
+    env.platform_shim->clear_logs();
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+    }
+    return std::regex_replace(env.platform_shim->fputs_stderr_log, std::regex("0x[0-9a-fA-F]+"), "0x");
+}
+
+TEST(Threading, InstanceCreateDestroyLoopWithAsyncLogOutput) {
+    const auto processor_count = std::thread::hardware_concurrency();
+
+    std::string sync_log;
+    {
+        FrameworkEnvironment env{};
+        env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA)).add_physical_device("physical_device_0");
+        sync_log = log_create_destroy_instance(env);
+    }
+    ASSERT_NE(sync_log.find("Searching for driver manifest files"), std::string::npos);
+
+    // Read when the loader is loaded, so it has to be set before the FrameworkEnvironment is created
+    EnvVarWrapper async_log_env_var{"VK_LOADER_LOG_ASYNC", "1"};
+    FrameworkEnvironment env{};
+    auto& driver = env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA));
+    driver.physical_devices.emplace_back("physical_device_0")
+        .known_device_functions.push_back({"vkCmdBindPipeline", to_vkVoidFunction(test_vkCmdBindPipeline)});
+
+    // By the time vkDestroyInstance returns, everything has been written out in the order it was logged
+    ASSERT_EQ(sync_log, log_create_destroy_instance(env));
+
+    // Holding the lock of stderr stalls the writer thread, so the ring fills up and later messages are dropped. Each call logs at
+    // least the search for driver manifest files.
+    env.platform_shim->clear_logs();
+    flockfile(stderr);
+    for (uint32_t i = 0; i < 2048; i++) {
+        uint32_t count = 0;
+        env.vulkan_functions.vkEnumerateInstanceExtensionProperties(nullptr, &count, nullptr);
+    }
+    funlockfile(stderr);
+    {
+        InstWrapper inst{env.vulkan_functions};
+        inst.CheckCreate();
+    }
+    ASSERT_TRUE(env.platform_shim->find_in_log("log messages were dropped because the asynchronous log output fell behind"));
+    // The records queued before the ring filled up are still written out after the drop count
+    ASSERT_NE(env.platform_shim->fputs_stderr_log.rfind("Searching for driver manifest files"), std::string::npos);
+    ASSERT_GT(env.platform_shim->fputs_stderr_log.rfind("Searching for driver manifest files"),
+              env.platform_shim->fputs_stderr_log.find("log messages were dropped"));
+
+    std::vector<std::thread> instance_creation_threads;
+    for (uint32_t i = 0; i < processor_count; i++) {
+        instance_creation_threads.emplace_back(create_destroy_instance_loop_with_function_queries, &env, 50, 1, 1);
+    }
+    for (uint32_t i = 0; i < processor_count; i++) {
+        instance_creation_threads[i].join();
+    }
+
+    // Messages delivered to debug utils messengers aren't queued
+    InstWrapper inst{env.vulkan_functions};
+    FillDebugUtilsCreateDetails(inst.create_info, env.debug_log);
+    inst.CheckCreate();
+    ASSERT_TRUE(env.debug_log.find("Searching for driver manifest files"));
+}
+#endif
+
 TEST(Threading, DeviceCreateDestroyLoop) {
     const auto processor_count = std::thread::hardware_concurrency();
 
@@ -129,3 +198,59 @@ TEST(Threading, DeviceCreateDestroyLoop) {
         device_creation_threads[i].join();
     }
 }
+
+void create_destroy_messenger_loop(InstWrapper* inst, uint32_t num_loops_create_destroy_messenger) {
+    for (uint32_t i = 0; i < num_loops_create_destroy_messenger; i++) {
+        DebugUtilsWrapper messenger{*inst, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT};
+        ASSERT_EQ(VK_SUCCESS, CreateDebugUtilsMessenger(messenger));
+    }
+}
+
+void submit_debug_utils_message_loop(InstWrapper* inst, uint32_t num_loops_submit_message) {
+    PFN_vkSubmitDebugUtilsMessageEXT submit_message = inst->load("vkSubmitDebugUtilsMessageEXT");
+    ASSERT_NE(submit_message, nullptr);
+    VkDebugUtilsMessengerCallbackDataEXT message_data{VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT};
+    message_data.pMessage = "Threading test message";
+    for (uint32_t i = 0; i < num_loops_submit_message; i++) {
+        submit_message(inst->inst, VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT, VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT,
+                       &message_data);
+    }
+}
+
+TEST(Threading, DebugUtilsMessengerCreateDestroyLoop) {
+    const auto processor_count = std::thread::hardware_concurrency();
+
+    FrameworkEnvironment env{FrameworkSettings{}.set_log_filter("")};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA)).add_physical_device({});
+
+    uint32_t num_loops_create_destroy_messenger = 500;
+    uint32_t num_loops_submit_message = 2000;
+
+    // Every instance has one thread attaching and detaching messengers while another sends messages to them, and all instances
+    // do so at the same time
+    std::vector<std::unique_ptr<InstWrapper>> instances;
+    for (uint32_t i = 0; i < processor_count; i++) {
+        instances.emplace_back(new InstWrapper{env.vulkan_functions});
+        instances.back()->create_info.add_extension(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+        instances.back()->CheckCreate();
+    }
+
+    // A messenger that stays attached for the whole run must receive every message, however many others come and go around it
+    std::vector<std::unique_ptr<DebugUtilsWrapper>> persistent_messengers;
+    for (uint32_t i = 0; i < processor_count; i++) {
+        persistent_messengers.emplace_back(new DebugUtilsWrapper{*instances[i], VK_DEBUG_UTILS_MESSAGE_SEVERITY_INFO_BIT_EXT});
+        ASSERT_EQ(VK_SUCCESS, CreateDebugUtilsMessenger(*persistent_messengers.back()));
+    }
+
+    std::vector<std::thread> messenger_threads;
+    for (uint32_t i = 0; i < processor_count; i++) {
+        messenger_threads.emplace_back(create_destroy_messenger_loop, instances[i].get(), num_loops_create_destroy_messenger);
+        messenger_threads.emplace_back(submit_debug_utils_message_loop, instances[i].get(), num_loops_submit_message);
+    }
+    for (auto& thread : messenger_threads) {
+        thread.join();
+    }
+    for (auto& messenger : persistent_messengers) {
+        ASSERT_EQ(num_loops_submit_message, messenger->count("Threading test message"));
+    }
+}
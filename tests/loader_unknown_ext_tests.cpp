@@ -777,6 +777,44 @@ TEST(UnknownFunction, QueueFromGIPAWithLayerInterceptionAndLayerImplementation)
     unknown_function_test_impl<VkInstance, VkQueue>({TestConfig::add_layer_interception, TestConfig::add_layer_implementation});
 }
 
+// Names registered before a device was created are filled in when the device is created, names registered afterwards are filled
+// in for every existing device when they are first queried
+TEST(UnknownFunction, DeviceFunctionsRegisteredBeforeAndAfterDeviceCreation) {
+    FrameworkEnvironment env{};
+    auto& driver = env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2_EXPORT_ICD_GPDPA)).add_physical_device({});
+    uint32_t function_count = 20;
+
+    std::vector<std::string> function_names;
+    add_function_names(function_names, function_count);
+    fill_implementation_functions(driver.physical_devices.back().known_device_functions, function_names,
+                                  custom_functions<VkDevice>{}, function_count);
+
+    InstWrapper inst{env.vulkan_functions};
+    inst.CheckCreate();
+
+    // Register the first half of the names before any device exists
+    for (uint32_t i = 0; i < function_count / 2; i++) {
+        ASSERT_NE(env.vulkan_functions.vkGetInstanceProcAddr(inst.inst, function_names.at(i).c_str()), nullptr);
+    }
+
+    DeviceWrapper dev_0{inst};
+    dev_0.create_info.add_device_queue({});
+    dev_0.CheckCreate(inst.GetPhysDev());
+
+    // The second half gets registered while dev_0 is alive
+    check_custom_functions(env.vulkan_functions, inst.inst, dev_0.dev, custom_functions<VkDevice>{}, function_names,
+                           function_count / 2, function_count / 2);
+
+    DeviceWrapper dev_1{inst};
+    dev_1.create_info.add_device_queue({});
+    dev_1.CheckCreate(inst.GetPhysDev());
+
+    check_custom_functions(env.vulkan_functions, inst.inst, dev_0.dev, custom_functions<VkDevice>{}, function_names,
+                           function_count);
+    check_custom_functions(env.vulkan_functions, inst.inst, dev_1.dev, custom_functions<VkDevice>{}, function_names,
+                           function_count);
+}
+
 /*
  The purpose of LayerInterceptData is to provide a place to store data that is accessible inside the interception function.
  It works by being a templated type with static variables. Every unique type used creates a new template instantiation, with its own
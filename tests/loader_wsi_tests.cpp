@@ -390,6 +390,132 @@ TEST(WsiTests, XcbGetPhysicalDeviceSurfaceSupportKHR) {
 
     env.vulkan_functions.vkDestroySurfaceKHR(instance.inst, surface, nullptr);
 }
+
+// Drivers should only be asked to create their surface once the surface is first used with one of their physical devices
+TEST(WsiTests, XcbDriverSurfacesCreatedOnFirstUse) {
+    FrameworkEnvironment env{};
+    const uint32_t max_device_count = 2;
+    for (uint32_t icd = 0; icd < max_device_count; ++icd) {
+        env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+        auto& cur_icd = env.get_test_icd(icd);
+        cur_icd.icd_api_version = VK_API_VERSION_1_0;
+        cur_icd.set_min_icd_interface_version(5);
+        cur_icd.add_instance_extensions({{VK_KHR_SURFACE_EXTENSION_NAME}, {VK_KHR_XCB_SURFACE_EXTENSION_NAME}});
+        cur_icd.physical_devices.emplace_back("phys_dev_" + std::to_string(icd));
+        cur_icd.physical_devices.back().add_queue_family_properties({{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, true});
+        cur_icd.enable_icd_wsi = true;
+    }
+
+    InstWrapper instance(env.vulkan_functions);
+    instance.create_info.add_extensions({VK_KHR_SURFACE_EXTENSION_NAME, VK_KHR_XCB_SURFACE_EXTENSION_NAME});
+    instance.CheckCreate();
+
+    VkSurfaceKHR surface{VK_NULL_HANDLE};
+    VkXcbSurfaceCreateInfoKHR xcb_createInfo{VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR};
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkCreateXcbSurfaceKHR(instance.inst, &xcb_createInfo, nullptr, &surface));
+    ASSERT_TRUE(surface != VK_NULL_HANDLE);
+
+    auto driver_surface_count = [&env]() {
+        return env.get_test_icd(0).surface_handles.size() + env.get_test_icd(1).surface_handles.size();
+    };
+    ASSERT_EQ(driver_surface_count(), 0U);
+
+    auto phys_devs = instance.GetPhysDevs(max_device_count);
+    VkBool32 supported = VK_FALSE;
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkGetPhysicalDeviceSurfaceSupportKHR(phys_devs[0], 0, surface, &supported));
+    ASSERT_EQ(driver_surface_count(), 1U);
+
+    // Querying again reuses the surface the driver already made
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkGetPhysicalDeviceSurfaceSupportKHR(phys_devs[0], 0, surface, &supported));
+    ASSERT_EQ(driver_surface_count(), 1U);
+
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkGetPhysicalDeviceSurfaceSupportKHR(phys_devs[1], 0, surface, &supported));
+    ASSERT_EQ(driver_surface_count(), 2U);
+
+    env.vulkan_functions.vkDestroySurfaceKHR(instance.inst, surface, nullptr);
+    ASSERT_EQ(driver_surface_count(), 0U);
+}
+
+// Surfaces released in the middle of the instance's list have their slot reused without leaking or mixing up driver surfaces
+TEST(WsiTests, XcbSurfaceSlotsReused) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    auto& driver = env.get_test_icd(0);
+    driver.set_min_icd_interface_version(5);
+    driver.add_instance_extensions({{VK_KHR_SURFACE_EXTENSION_NAME}, {VK_KHR_XCB_SURFACE_EXTENSION_NAME}});
+    driver.physical_devices.emplace_back("phys_dev");
+    driver.physical_devices.back().add_queue_family_properties({{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, true});
+    driver.enable_icd_wsi = true;
+
+    InstWrapper instance(env.vulkan_functions);
+    instance.create_info.add_extensions({VK_KHR_SURFACE_EXTENSION_NAME, VK_KHR_XCB_SURFACE_EXTENSION_NAME});
+    instance.CheckCreate();
+    auto phys_dev = instance.GetPhysDev();
+
+    VkXcbSurfaceCreateInfoKHR xcb_createInfo{VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR};
+    auto create_and_use_surface = [&]() {
+        VkSurfaceKHR surface{VK_NULL_HANDLE};
+        EXPECT_EQ(VK_SUCCESS, env.vulkan_functions.vkCreateXcbSurfaceKHR(instance.inst, &xcb_createInfo, nullptr, &surface));
+        VkBool32 supported = VK_FALSE;
+        EXPECT_EQ(VK_SUCCESS, env.vulkan_functions.vkGetPhysicalDeviceSurfaceSupportKHR(phys_dev, 0, surface, &supported));
+        return surface;
+    };
+
+    // Enough surfaces to grow the list past its initial size
+    std::vector<VkSurfaceKHR> surfaces;
+    for (uint32_t i = 0; i < 40; i++) {
+        surfaces.push_back(create_and_use_surface());
+    }
+    ASSERT_EQ(driver.surface_handles.size(), 40U);
+
+    for (uint32_t i = 0; i < 40; i += 2) {
+        env.vulkan_functions.vkDestroySurfaceKHR(instance.inst, surfaces[i], nullptr);
+        surfaces[i] = create_and_use_surface();
+    }
+    ASSERT_EQ(driver.surface_handles.size(), 40U);
+
+    for (auto& surface : surfaces) {
+        env.vulkan_functions.vkDestroySurfaceKHR(instance.inst, surface, nullptr);
+    }
+    ASSERT_EQ(driver.surface_handles.size(), 0U);
+}
+
+// A driver failing to create its surface on first use is reported with an error the query is allowed to return
+TEST(WsiTests, XcbDriverSurfaceCreationFailure) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    auto& driver = env.get_test_icd(0);
+    driver.set_min_icd_interface_version(5);
+    driver.add_instance_extensions({{VK_KHR_SURFACE_EXTENSION_NAME}, {VK_KHR_XCB_SURFACE_EXTENSION_NAME}});
+    driver.physical_devices.emplace_back("phys_dev");
+    driver.physical_devices.back().add_queue_family_properties({{VK_QUEUE_GRAPHICS_BIT, 1, 0, {1, 1, 1}}, true});
+    driver.enable_icd_wsi = true;
+
+    InstWrapper instance(env.vulkan_functions);
+    instance.create_info.add_extensions({VK_KHR_SURFACE_EXTENSION_NAME, VK_KHR_XCB_SURFACE_EXTENSION_NAME});
+    instance.CheckCreate();
+    auto phys_dev = instance.GetPhysDev();
+
+    VkSurfaceKHR surface{VK_NULL_HANDLE};
+    VkXcbSurfaceCreateInfoKHR xcb_createInfo{VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR};
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkCreateXcbSurfaceKHR(instance.inst, &xcb_createInfo, nullptr, &surface));
+
+    VkBool32 supported = VK_FALSE;
+    driver.set_create_surface_return_code(VK_ERROR_NATIVE_WINDOW_IN_USE_KHR);
+    ASSERT_EQ(VK_ERROR_SURFACE_LOST_KHR,
+              env.vulkan_functions.vkGetPhysicalDeviceSurfaceSupportKHR(phys_dev, 0, surface, &supported));
+    driver.set_create_surface_return_code(VK_ERROR_OUT_OF_HOST_MEMORY);
+    ASSERT_EQ(VK_ERROR_OUT_OF_HOST_MEMORY,
+              env.vulkan_functions.vkGetPhysicalDeviceSurfaceSupportKHR(phys_dev, 0, surface, &supported));
+    ASSERT_EQ(driver.surface_handles.size(), 0U);
+
+    // The driver is asked again the next time the surface is used
+    driver.set_create_surface_return_code(VK_SUCCESS);
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkGetPhysicalDeviceSurfaceSupportKHR(phys_dev, 0, surface, &supported));
+    ASSERT_EQ(driver.surface_handles.size(), 1U);
+
+    env.vulkan_functions.vkDestroySurfaceKHR(instance.inst, surface, nullptr);
+}
 #endif
 
 #if defined(VK_USE_PLATFORM_XLIB_KHR)
@@ -820,6 +946,37 @@ TEST(WsiTests, GoogleSurfaceslessQuery) {
 #endif
 }
 
+// Display surfaces are created in the drivers right away, so the structures chained to the application's create info reach them
+TEST(WsiTests, DisplaySurfaceCreateInfoChainReachesDrivers) {
+    FrameworkEnvironment env{};
+    env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2));
+    auto& driver = env.get_test_icd(0);
+    driver.set_min_icd_interface_version(5);
+    driver.add_instance_extensions({{VK_KHR_SURFACE_EXTENSION_NAME}, {VK_KHR_DISPLAY_EXTENSION_NAME}});
+    driver.physical_devices.emplace_back("phys_dev");
+    driver.enable_icd_wsi = true;
+
+    InstWrapper instance(env.vulkan_functions);
+    instance.create_info.add_extensions({VK_KHR_SURFACE_EXTENSION_NAME, VK_KHR_DISPLAY_EXTENSION_NAME});
+    instance.CheckCreate();
+
+    VkDisplaySurfaceStereoCreateInfoNV stereo_create_info{VK_STRUCTURE_TYPE_DISPLAY_SURFACE_STEREO_CREATE_INFO_NV};
+    VkDisplaySurfaceCreateInfoKHR create_info{VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR};
+    create_info.pNext = &stereo_create_info;
+    VkSurfaceKHR surface{VK_NULL_HANDLE};
+    ASSERT_EQ(VK_SUCCESS, env.vulkan_functions.vkCreateDisplayPlaneSurfaceKHR(instance.inst, &create_info, nullptr, &surface));
+    ASSERT_EQ(driver.surface_handles.size(), 1U);
+    ASSERT_EQ(driver.display_surface_create_info_chain,
+              std::vector<VkStructureType>{VK_STRUCTURE_TYPE_DISPLAY_SURFACE_STEREO_CREATE_INFO_NV});
+    env.vulkan_functions.vkDestroySurfaceKHR(instance.inst, surface, nullptr);
+    ASSERT_EQ(driver.surface_handles.size(), 0U);
+
+    // A driver failing to create its display surface fails the application's call, without leaving a surface behind
+    driver.set_create_surface_return_code(VK_ERROR_OUT_OF_DEVICE_MEMORY);
+    ASSERT_EQ(VK_ERROR_OUT_OF_DEVICE_MEMORY,
+              env.vulkan_functions.vkCreateDisplayPlaneSurfaceKHR(instance.inst, &create_info, nullptr, &surface));
+}
+
 TEST(WsiTests, ForgetEnableSurfaceExtensions) {
     FrameworkEnvironment env{};
     env.add_icd(TestICDDetails(TEST_ICD_PATH_VERSION_2))